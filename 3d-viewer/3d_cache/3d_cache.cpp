@@ -82,6 +82,10 @@ public:
     SCENEGRAPH*   sceneData;
     S3DMODEL*     renderData;
 
+    /// Serializes loading of this entry; held instead of the cache-wide mutex while the
+    /// plugin or the cache file is read, so different models can load concurrently.
+    std::mutex    m_loadMutex;
+
 private:
     // prohibit assignment and default copy constructor
     S3D_CACHE_ENTRY( const S3D_CACHE_ENTRY& source );
@@ -147,6 +151,10 @@ SCENEGRAPH* S3D_CACHE::load( const wxString& aModelFile, const wxString& aBasePa
     if( aCachePtr )
         *aCachePtr = nullptr;
 
+    // The resolver lazily appends to its internal search path list, so it is also guarded
+    // by the cache-wide mutex
+    std::unique_lock<std::mutex> lock( mutex3D_cache );
+
     wxString full3Dpath = m_FNResolver->ResolvePath( aModelFile, aBasePath, std::move( aEmbeddedFilesStack ) );
 
     if( full3Dpath.empty() )
@@ -158,57 +166,64 @@ SCENEGRAPH* S3D_CACHE::load( const wxString& aModelFile, const wxString& aBasePa
     }
 
     // check cache if file is already loaded
-    std::lock_guard<std::mutex> lock( mutex3D_cache );
-
     std::map< wxString, S3D_CACHE_ENTRY*, rsort_wxString >::iterator mi;
     mi = m_CacheMap.find( full3Dpath );
 
     if( mi != m_CacheMap.end() )
     {
+        S3D_CACHE_ENTRY* ep = mi->second;
+        bool             reload = false;
+
         wxFileName fname( full3Dpath );
 
         if( fname.FileExists() )    // Only check if file exists. If not, it will
         {                           // use the same model in cache.
-            bool       reload = ADVANCED_CFG::GetCfg().m_Skip3DModelMemoryCache;
+            reload = ADVANCED_CFG::GetCfg().m_Skip3DModelMemoryCache;
             wxDateTime fmdate = fname.GetModificationTime();
 
-            if( fmdate != mi->second->modTime )
+            if( fmdate != ep->modTime )
             {
                 HASH_128 hashSum;
                 getHash( full3Dpath, hashSum );
-                mi->second->modTime = fmdate;
+                ep->modTime = fmdate;
 
-                if( hashSum != mi->second->m_hash )
+                if( hashSum != ep->m_hash )
                 {
-                    mi->second->SetHash( hashSum );
+                    ep->SetHash( hashSum );
                     reload = true;
                 }
             }
+        }
 
-            if( reload )
-            {
-                if( nullptr != mi->second->sceneData )
-                {
-                    S3D::DestroyNode( mi->second->sceneData );
-                    mi->second->sceneData = nullptr;
-                }
+        if( nullptr != aCachePtr )
+            *aCachePtr = ep;
+
+        // Wait on the entry lock rather than the cache lock, so an in-flight load of this
+        // model is waited for while loads of other models proceed on other threads.
+        // Entries are never deleted before FlushCache(), so ep remains valid here.
+        lock.unlock();
 
-                if( nullptr != mi->second->renderData )
-                    S3D::Destroy3DModel( &mi->second->renderData );
+        std::lock_guard<std::mutex> entryLock( ep->m_loadMutex );
 
-                mi->second->sceneData = m_Plugins->Load3DModel( full3Dpath,
-                                                                mi->second->pluginInfo );
+        if( reload )
+        {
+            if( nullptr != ep->sceneData )
+            {
+                S3D::DestroyNode( ep->sceneData );
+                ep->sceneData = nullptr;
             }
-        }
 
-        if( nullptr != aCachePtr )
-            *aCachePtr = mi->second;
+            if( nullptr != ep->renderData )
+                S3D::Destroy3DModel( &ep->renderData );
+
+            ep->sceneData = m_Plugins->Load3DModel( full3Dpath, ep->pluginInfo );
+        }
 
-        return mi->second->sceneData;
+        return ep->sceneData;
     }
 
     // a cache item does not exist; search the Filename->Cachename map
-    return checkCache( full3Dpath, aCachePtr );
+    return checkCache( full3Dpath, aCachePtr, lock );
 }
 
 
@@ -219,7 +234,8 @@ SCENEGRAPH* S3D_CACHE::Load( const wxString& aModelFile, const wxString& aBasePa
 }
 
 
-SCENEGRAPH* S3D_CACHE::checkCache( const wxString& aFileName, S3D_CACHE_ENTRY** aCachePtr )
+SCENEGRAPH* S3D_CACHE::checkCache( const wxString& aFileName, S3D_CACHE_ENTRY** aCachePtr,
+                                   std::unique_lock<std::mutex>& aCacheLock )
 {
     if( aCachePtr )
         *aCachePtr = nullptr;
@@ -273,6 +289,12 @@ SCENEGRAPH* S3D_CACHE::checkCache( const wxString& aFileName, S3D_CACHE_ENTRY**
     wxString bname = ep->GetCacheBaseName();
     wxString cachename = m_CacheDir + bname + wxT( ".3dc" );
 
+    // The entry is now discoverable through the cache map, so take the entry lock before
+    // releasing the cache lock: other threads asking for the same model will block on the
+    // entry until this load finishes, while loads of other models run concurrently
+    std::lock_guard<std::mutex> entryLock( ep->m_loadMutex );
+    aCacheLock.unlock();
+
     if( !ADVANCED_CFG::GetCfg().m_Skip3DModelFileCache && wxFileName::FileExists( cachename )
         && loadCacheData( ep ) )
         return ep->sceneData;
@@ -524,6 +546,8 @@ std::list< wxString > const* S3D_CACHE::GetFileFilters() const
 
 void S3D_CACHE::FlushCache( bool closePlugins )
 {
+    std::lock_guard<std::mutex> lock( mutex3D_cache );
+
     std::list< S3D_CACHE_ENTRY* >::iterator sCL = m_CacheList.begin();
     std::list< S3D_CACHE_ENTRY* >::iterator eCL = m_CacheList.end();
 
@@ -566,6 +590,8 @@ S3DMODEL* S3D_CACHE::GetModel( const wxString& aModelFileName, const wxString& a
         return nullptr;
     }
 
+    std::lock_guard<std::mutex> entryLock( cp->m_loadMutex );
+
     if( cp->renderData )
         return cp->renderData;
 
@@ -35,6 +35,7 @@
 #include <hash_128.h>
 #include <list>
 #include <map>
+#include <mutex>
 #include "plugins/3dapi/c3dmodel.h"
 #include <project.h>
 #include <wx/string.h>
@@ -127,6 +128,9 @@ public:
      * Attempt to load the scene data for a model and to translate it into an S3D_MODEL
      * structure for display by a renderer.
      *
+     * May be called concurrently from several threads; loads of distinct models proceed
+     * in parallel while requests for the same model block until the first load finishes.
+     *
      * @param aModelFileName is the full path to the model to be loaded.
      * @param aBasePath is the path to search for any relative files.
      * @param aEmbeddedFilesStack is a stack of pointers to the embedded files lists.  They will
@@ -154,9 +158,12 @@ private:
      *
      * @param aFileName  is the file name (full or partial path).
      * @param aCachePtr is an optional return address for cache entry pointer.
+     * @param aCacheLock is the held cache-wide lock; it is released once the new entry's
+     *                   own lock is taken, so other models can load concurrently.
      * @return SCENEGRAPH object associated with file name or NULL on error.
      */
-    SCENEGRAPH* checkCache( const wxString& aFileName, S3D_CACHE_ENTRY** aCachePtr = nullptr );
+    SCENEGRAPH* checkCache( const wxString& aFileName, S3D_CACHE_ENTRY** aCachePtr,
+                            std::unique_lock<std::mutex>& aCacheLock );
 
     /**
      * Calculate the SHA1 hash of the given file.
@@ -567,6 +567,12 @@ void BOARD_ADAPTER::InitSettings( REPORTER* aStatusReporter, REPORTER* aWarningR
 
     createLayers( aStatusReporter );
 
+    UpdateColors();
+}
+
+
+void BOARD_ADAPTER::UpdateColors()
+{
     auto to_SFVEC4F =
             []( const COLOR4D& src )
             {
@@ -753,6 +759,10 @@ void BOARD_ADAPTER::SetLayerColors( const std::map<int, COLOR4D>& aColors )
     }
 
     Pgm().GetSettingsManager().SaveColorSettings( settings, "3d_viewer" );
+
+    // Refresh the cached colors so renderers that read them at draw time (the OpenGL
+    // engine) pick up the change on the next repaint without a scene rebuild
+    UpdateColors();
 }
 
 
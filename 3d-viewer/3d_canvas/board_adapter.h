@@ -116,6 +116,13 @@ public:
     std::map<int, COLOR4D> GetDefaultColors() const;
     void SetLayerColors( const std::map<int, COLOR4D>& aColors );
 
+    /**
+     * Refresh the cached per-layer render colors from the current color list.
+     *
+     * Cheap to call: no geometry is touched, so it can run on every color change.
+     */
+    void UpdateColors();
+
     std::bitset<LAYER_3D_END> GetVisibleLayers() const;
     std::bitset<LAYER_3D_END> GetDefaultVisibleLayers() const;
     void SetVisibleLayers( const std::bitset<LAYER_3D_END>& aLayers );
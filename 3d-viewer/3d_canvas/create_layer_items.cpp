@@ -302,30 +302,67 @@ void BOARD_ADAPTER::createLayers( REPORTER* aStatusReporter )
         m_offboardPadsBack = new BVH_CONTAINER_2D;
     }
 
+    // Fan per-layer conversion out over the copper layers.  Each worker claims layers from
+    // the shared index and only touches that layer's own containers and polygon sets (all
+    // pre-created above), so no locking is needed.  Work that accumulates into containers
+    // shared between layers (THT holes, backdrill cutouts, ...) must stay serial.
+    auto forEachLayerParallel =
+            [&layer_ids]( const auto& aPerLayerWork )
+            {
+                std::atomic<size_t> nextItem( 0 );
+                std::atomic<size_t> threadsFinished( 0 );
+
+                size_t parallelThreadCount = std::min<size_t>(
+                        std::max<size_t>( std::thread::hardware_concurrency(), 2 ),
+                        layer_ids.size() );
+
+                for( size_t ii = 0; ii < parallelThreadCount; ++ii )
+                {
+                    std::thread t = std::thread(
+                            [&]()
+                            {
+                                for( size_t i = nextItem.fetch_add( 1 );
+                                            i < layer_ids.size();
+                                            i = nextItem.fetch_add( 1 ) )
+                                {
+                                    aPerLayerWork( layer_ids[i] );
+                                }
+
+                                threadsFinished++;
+                            } );
+
+                    t.detach();
+                }
+
+                while( threadsFinished < parallelThreadCount )
+                    std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+            };
+
     if( aStatusReporter )
         aStatusReporter->Report( _( "Create tracks and vias" ) );
 
     // Create tracks as objects and add it to container
-    for( PCB_LAYER_ID layer : layer_ids )
-    {
-        wxASSERT( m_layerMap.contains( layer ) );
+    forEachLayerParallel(
+            [&]( PCB_LAYER_ID layer )
+            {
+                wxASSERT( m_layerMap.contains( layer ) );
 
-        BVH_CONTAINER_2D *layerContainer = m_layerMap[layer];
+                BVH_CONTAINER_2D *layerContainer = m_layerMap[layer];
 
-        for( const PCB_TRACK* track : trackList )
-        {
-            // NOTE: Vias can be on multiple layers
-            if( !track->IsOnLayer( layer ) )
-                continue;
+                for( const PCB_TRACK* track : trackList )
+                {
+                    // NOTE: Vias can be on multiple layers
+                    if( !track->IsOnLayer( layer ) )
+                        continue;
 
-            // Skip vias annulus when not flashed on this layer
-            if( track->Type() == PCB_VIA_T && !static_cast<const PCB_VIA*>( track )->FlashLayer( layer ) )
-                continue;
+                    // Skip vias annulus when not flashed on this layer
+                    if( track->Type() == PCB_VIA_T && !static_cast<const PCB_VIA*>( track )->FlashLayer( layer ) )
+                        continue;
 
-            // Add object item to layer container
-            createTrackWithMargin( track, layerContainer, layer );
-        }
-    }
+                    // Add object item to layer container
+                    createTrackWithMargin( track, layerContainer, layer );
+                }
+            } );
 
     // Create VIAS and THTs objects and add it to holes containers
     for( PCB_LAYER_ID layer : layer_ids )
@@ -695,30 +732,31 @@ void BOARD_ADAPTER::createLayers( REPORTER* aStatusReporter )
     // Creates vertical outline contours of the tracks and add it to the poly of the layer
     if( cfg.opengl_copper_thickness && cfg.engine == RENDER_ENGINE::OPENGL )
     {
-        for( PCB_LAYER_ID layer : layer_ids )
-        {
-            wxASSERT( m_layers_poly.contains( layer ) );
+        forEachLayerParallel(
+                [&]( PCB_LAYER_ID layer )
+                {
+                    wxASSERT( m_layers_poly.contains( layer ) );
 
-            SHAPE_POLY_SET *layerPoly = m_layers_poly[layer];
+                    SHAPE_POLY_SET *layerPoly = m_layers_poly[layer];
 
-            // ADD TRACKS
-            unsigned int nTracks = trackList.size();
+                    // ADD TRACKS
+                    unsigned int nTracks = trackList.size();
 
-            for( unsigned int trackIdx = 0; trackIdx < nTracks; ++trackIdx )
-            {
-                const PCB_TRACK *track = trackList[trackIdx];
+                    for( unsigned int trackIdx = 0; trackIdx < nTracks; ++trackIdx )
+                    {
+                        const PCB_TRACK *track = trackList[trackIdx];
 
-                if( !track->IsOnLayer( layer ) )
-                    continue;
+                        if( !track->IsOnLayer( layer ) )
+                            continue;
 
-                // Skip vias annulus when not flashed on this layer
-                if( track->Type() == PCB_VIA_T && !static_cast<const PCB_VIA*>( track )->FlashLayer( layer ) )
-                    continue;
+                        // Skip vias annulus when not flashed on this layer
+                        if( track->Type() == PCB_VIA_T && !static_cast<const PCB_VIA*>( track )->FlashLayer( layer ) )
+                            continue;
 
-                // Add the track/via contour
-                track->TransformShapeToPolygon( *layerPoly, layer, 0, track->GetMaxError(), ERROR_INSIDE );
-            }
-        }
+                        // Add the track/via contour
+                        track->TransformShapeToPolygon( *layerPoly, layer, 0, track->GetMaxError(), ERROR_INSIDE );
+                    }
+                } );
     }
 
     // Add holes of footprints
@@ -981,206 +1019,211 @@ void BOARD_ADAPTER::createLayers( REPORTER* aStatusReporter )
         }
     }
 
-    // Add footprints copper items (pads, shapes and text) to containers
-    for( PCB_LAYER_ID layer : layer_ids )
-    {
-        wxASSERT( m_layerMap.contains( layer ) );
-
-        BVH_CONTAINER_2D *layerContainer = m_layerMap[layer];
-
-        for( FOOTPRINT* fp : m_board->Footprints() )
-        {
-            addPads( fp, layerContainer, layer );
-            addFootprintShapes( fp, layerContainer, layer, visibilityFlags );
-
-            // Add copper item to the plated copper polygon list if required
-            if( cfg.DifferentiatePlatedCopper() && IsExternalCopperLayer( layer ) )
+    // Add footprints copper items (pads, shapes and text) to containers.  The plated copper
+    // polygon lists are external-layer only, so each one is written by a single worker.
+    forEachLayerParallel(
+            [&]( PCB_LAYER_ID layer )
             {
-                SHAPE_POLY_SET* layerPoly = layer == F_Cu ? m_frontPlatedCopperPolys : m_backPlatedCopperPolys;
+                wxASSERT( m_layerMap.contains( layer ) );
 
-                fp->TransformPadsToPolySet( *layerPoly, layer, 0, fp->GetMaxError(), ERROR_INSIDE );
-                transformFPTextToPolySet( fp, layer, visibilityFlags, *layerPoly, fp->GetMaxError(), ERROR_INSIDE );
-                transformFPShapesToPolySet( fp, layer, *layerPoly, fp->GetMaxError(), ERROR_INSIDE );
-            }
+                BVH_CONTAINER_2D *layerContainer = m_layerMap[layer];
 
-            // Add copper item to poly contours (vertical outlines) if required
-            if( cfg.opengl_copper_thickness && cfg.engine == RENDER_ENGINE::OPENGL )
-            {
-                wxASSERT( m_layers_poly.contains( layer ) );
+                for( FOOTPRINT* fp : m_board->Footprints() )
+                {
+                    addPads( fp, layerContainer, layer );
+                    addFootprintShapes( fp, layerContainer, layer, visibilityFlags );
 
-                SHAPE_POLY_SET* layerPoly = m_layers_poly[layer];
+                    // Add copper item to the plated copper polygon list if required
+                    if( cfg.DifferentiatePlatedCopper() && IsExternalCopperLayer( layer ) )
+                    {
+                        SHAPE_POLY_SET* layerPoly = layer == F_Cu ? m_frontPlatedCopperPolys : m_backPlatedCopperPolys;
 
-                fp->TransformPadsToPolySet( *layerPoly, layer, 0, fp->GetMaxError(), ERROR_INSIDE );
-                transformFPTextToPolySet( fp, layer, visibilityFlags, *layerPoly, fp->GetMaxError(), ERROR_INSIDE );
-                transformFPShapesToPolySet( fp, layer, *layerPoly, fp->GetMaxError(), ERROR_INSIDE );
-            }
-        }
-    }
+                        fp->TransformPadsToPolySet( *layerPoly, layer, 0, fp->GetMaxError(), ERROR_INSIDE );
+                        transformFPTextToPolySet( fp, layer, visibilityFlags, *layerPoly, fp->GetMaxError(),
+                                                  ERROR_INSIDE );
+                        transformFPShapesToPolySet( fp, layer, *layerPoly, fp->GetMaxError(), ERROR_INSIDE );
+                    }
 
-    // Add graphic item on copper layers to object containers
-    for( PCB_LAYER_ID layer : layer_ids )
-    {
-        wxASSERT( m_layerMap.contains( layer ) );
+                    // Add copper item to poly contours (vertical outlines) if required
+                    if( cfg.opengl_copper_thickness && cfg.engine == RENDER_ENGINE::OPENGL )
+                    {
+                        wxASSERT( m_layers_poly.contains( layer ) );
 
-        BVH_CONTAINER_2D *layerContainer = m_layerMap[layer];
+                        SHAPE_POLY_SET* layerPoly = m_layers_poly[layer];
 
-        // Add graphic items on copper layers (texts and other graphics)
-        for( BOARD_ITEM* item : m_board->Drawings() )
-        {
-            if( !item->IsOnLayer( layer ) )
-                continue;
+                        fp->TransformPadsToPolySet( *layerPoly, layer, 0, fp->GetMaxError(), ERROR_INSIDE );
+                        transformFPTextToPolySet( fp, layer, visibilityFlags, *layerPoly, fp->GetMaxError(),
+                                                  ERROR_INSIDE );
+                        transformFPShapesToPolySet( fp, layer, *layerPoly, fp->GetMaxError(), ERROR_INSIDE );
+                    }
+                }
+            } );
 
-            switch( item->Type() )
+    // Add graphic item on copper layers to object containers
+    forEachLayerParallel(
+            [&]( PCB_LAYER_ID layer )
             {
-            case PCB_SHAPE_T:
-                addShape( static_cast<PCB_SHAPE*>( item ), layerContainer, item, layer );
-                break;
-
-            case PCB_TEXT_T:
-                addText( static_cast<PCB_TEXT*>( item ), layerContainer, item );
-                break;
-
-            case PCB_TEXTBOX_T:
-                addShape( static_cast<PCB_TEXTBOX*>( item ), layerContainer, item );
-                break;
-
-            case PCB_TABLE_T:
-                addTable( static_cast<PCB_TABLE*>( item ), layerContainer, item );
-                break;
-
-            case PCB_BARCODE_T:
-                addBarCode( static_cast<PCB_BARCODE*>( item ), layerContainer, item );
-                break;
-
-            case PCB_DIM_ALIGNED_T:
-            case PCB_DIM_CENTER_T:
-            case PCB_DIM_RADIAL_T:
-            case PCB_DIM_ORTHOGONAL_T:
-            case PCB_DIM_LEADER_T:
-                addShape( static_cast<PCB_DIMENSION_BASE*>( item ), layerContainer, item );
-                break;
-
-            case PCB_REFERENCE_IMAGE_T:     // ignore
-                break;
-
-            default:
-                wxLogTrace( m_logTrace, wxT( "createLayers: item type: %d not implemented" ), item->Type() );
-                break;
-            }
+                wxASSERT( m_layerMap.contains( layer ) );
 
-            // Add copper item to the plated copper polygon list if required
-            if( cfg.DifferentiatePlatedCopper() && IsExternalCopperLayer( layer ) )
-            {
-                SHAPE_POLY_SET* copperPolys = layer == F_Cu ? m_frontPlatedCopperPolys : m_backPlatedCopperPolys;
+                BVH_CONTAINER_2D *layerContainer = m_layerMap[layer];
 
-                // Note: for TEXT and TEXTBOX, TransformShapeToPolygon returns the bounding
-                // box shape, not the exact text shape. So it is not used for these items
-                if( item->Type() == PCB_TEXTBOX_T )
+                // Add graphic items on copper layers (texts and other graphics)
+                for( BOARD_ITEM* item : m_board->Drawings() )
                 {
-                    PCB_TEXTBOX* text_box = static_cast<PCB_TEXTBOX*>( item );
-                    text_box->TransformTextToPolySet( *copperPolys, 0, text_box->GetMaxError(), ERROR_INSIDE );
+                    if( !item->IsOnLayer( layer ) )
+                        continue;
 
-                    // Add box outlines
-                    text_box->PCB_SHAPE::TransformShapeToPolygon( *copperPolys, layer, 0, text_box->GetMaxError(),
-                                                                  ERROR_INSIDE );
-                }
-                else if( item->Type() == PCB_TEXT_T )
-                {
-                    PCB_TEXT* text = static_cast<PCB_TEXT*>( item );
-                    text->TransformTextToPolySet( *copperPolys, 0, text->GetMaxError(), ERROR_INSIDE );
-                }
-                else if( item->Type() != PCB_REFERENCE_IMAGE_T )
-                {
-                    item->TransformShapeToPolySet( *copperPolys, layer, 0, item->GetMaxError(), ERROR_INSIDE );
-                }
-            }
+                    switch( item->Type() )
+                    {
+                    case PCB_SHAPE_T:
+                        addShape( static_cast<PCB_SHAPE*>( item ), layerContainer, item, layer );
+                        break;
 
-            // Add copper item to poly contours (vertical outlines) if required
-            if( cfg.opengl_copper_thickness && cfg.engine == RENDER_ENGINE::OPENGL )
-            {
-                wxASSERT( m_layers_poly.contains( layer ) );
+                    case PCB_TEXT_T:
+                        addText( static_cast<PCB_TEXT*>( item ), layerContainer, item );
+                        break;
 
-                SHAPE_POLY_SET *layerPoly = m_layers_poly[layer];
+                    case PCB_TEXTBOX_T:
+                        addShape( static_cast<PCB_TEXTBOX*>( item ), layerContainer, item );
+                        break;
 
-                switch( item->Type() )
-                {
-                case PCB_SHAPE_T:
-                    item->TransformShapeToPolySet( *layerPoly, layer, 0, item->GetMaxError(), ERROR_INSIDE );
-                    break;
+                    case PCB_TABLE_T:
+                        addTable( static_cast<PCB_TABLE*>( item ), layerContainer, item );
+                        break;
 
-                case PCB_TEXT_T:
-                {
-                    PCB_TEXT* text = static_cast<PCB_TEXT*>( item );
+                    case PCB_BARCODE_T:
+                        addBarCode( static_cast<PCB_BARCODE*>( item ), layerContainer, item );
+                        break;
 
-                    text->TransformTextToPolySet( *layerPoly, 0, text->GetMaxError(), ERROR_INSIDE );
-                    break;
-                }
+                    case PCB_DIM_ALIGNED_T:
+                    case PCB_DIM_CENTER_T:
+                    case PCB_DIM_RADIAL_T:
+                    case PCB_DIM_ORTHOGONAL_T:
+                    case PCB_DIM_LEADER_T:
+                        addShape( static_cast<PCB_DIMENSION_BASE*>( item ), layerContainer, item );
+                        break;
 
-                case PCB_TEXTBOX_T:
-                {
-                    PCB_TEXTBOX* textbox = static_cast<PCB_TEXTBOX*>( item );
+                    case PCB_REFERENCE_IMAGE_T:     // ignore
+                        break;
 
-                    if( textbox->IsBorderEnabled() )
+                    default:
+                        wxLogTrace( m_logTrace, wxT( "createLayers: item type: %d not implemented" ), item->Type() );
+                        break;
+                    }
+
+                    // Add copper item to the plated copper polygon list if required
+                    if( cfg.DifferentiatePlatedCopper() && IsExternalCopperLayer( layer ) )
                     {
-                        textbox->PCB_SHAPE::TransformShapeToPolygon( *layerPoly, layer, 0, textbox->GetMaxError(),
-                                                                     ERROR_INSIDE );
+                        SHAPE_POLY_SET* copperPolys = layer == F_Cu ? m_frontPlatedCopperPolys : m_backPlatedCopperPolys;
+
+                        // Note: for TEXT and TEXTBOX, TransformShapeToPolygon returns the bounding
+                        // box shape, not the exact text shape. So it is not used for these items
+                        if( item->Type() == PCB_TEXTBOX_T )
+                        {
+                            PCB_TEXTBOX* text_box = static_cast<PCB_TEXTBOX*>( item );
+                            text_box->TransformTextToPolySet( *copperPolys, 0, text_box->GetMaxError(), ERROR_INSIDE );
+
+                            // Add box outlines
+                            text_box->PCB_SHAPE::TransformShapeToPolygon( *copperPolys, layer, 0, text_box->GetMaxError(),
+                                                                          ERROR_INSIDE );
+                        }
+                        else if( item->Type() == PCB_TEXT_T )
+                        {
+                            PCB_TEXT* text = static_cast<PCB_TEXT*>( item );
+                            text->TransformTextToPolySet( *copperPolys, 0, text->GetMaxError(), ERROR_INSIDE );
+                        }
+                        else if( item->Type() != PCB_REFERENCE_IMAGE_T )
+                        {
+                            item->TransformShapeToPolySet( *copperPolys, layer, 0, item->GetMaxError(), ERROR_INSIDE );
+                        }
                     }
 
-                    textbox->TransformTextToPolySet( *layerPoly, 0, textbox->GetMaxError(), ERROR_INSIDE );
-                    break;
-                }
+                    // Add copper item to poly contours (vertical outlines) if required
+                    if( cfg.opengl_copper_thickness && cfg.engine == RENDER_ENGINE::OPENGL )
+                    {
+                        wxASSERT( m_layers_poly.contains( layer ) );
 
-                case PCB_TABLE_T:
-                {
-                    PCB_TABLE* table = static_cast<PCB_TABLE*>( item );
+                        SHAPE_POLY_SET *layerPoly = m_layers_poly[layer];
 
-                    for( PCB_TABLECELL* cell : table->GetCells() )
-                        cell->TransformTextToPolySet( *layerPoly, 0, cell->GetMaxError(), ERROR_INSIDE );
+                        switch( item->Type() )
+                        {
+                        case PCB_SHAPE_T:
+                            item->TransformShapeToPolySet( *layerPoly, layer, 0, item->GetMaxError(), ERROR_INSIDE );
+                            break;
 
-                    table->DrawBorders(
-                            [&]( const VECTOR2I& ptA, const VECTOR2I& ptB,
-                                 const STROKE_PARAMS& stroke )
+                        case PCB_TEXT_T:
+                        {
+                            PCB_TEXT* text = static_cast<PCB_TEXT*>( item );
+
+                            text->TransformTextToPolySet( *layerPoly, 0, text->GetMaxError(), ERROR_INSIDE );
+                            break;
+                        }
+
+                        case PCB_TEXTBOX_T:
+                        {
+                            PCB_TEXTBOX* textbox = static_cast<PCB_TEXTBOX*>( item );
+
+                            if( textbox->IsBorderEnabled() )
                             {
-                                SHAPE_SEGMENT seg( ptA, ptB, stroke.GetWidth()  );
-                                seg.TransformToPolygon( *layerPoly, table->GetMaxError(), ERROR_INSIDE );
-                            } );
-                    break;
-                }
+                                textbox->PCB_SHAPE::TransformShapeToPolygon( *layerPoly, layer, 0, textbox->GetMaxError(),
+                                                                             ERROR_INSIDE );
+                            }
 
-                case PCB_BARCODE_T:
-                {
-                    PCB_BARCODE* bar_code = static_cast<PCB_BARCODE*>( item );
+                            textbox->TransformTextToPolySet( *layerPoly, 0, textbox->GetMaxError(), ERROR_INSIDE );
+                            break;
+                        }
 
-                    bar_code->TransformShapeToPolySet( *layerPoly, layer, 0, 0, ERROR_INSIDE );
-                    break;
-                }
+                        case PCB_TABLE_T:
+                        {
+                            PCB_TABLE* table = static_cast<PCB_TABLE*>( item );
+
+                            for( PCB_TABLECELL* cell : table->GetCells() )
+                                cell->TransformTextToPolySet( *layerPoly, 0, cell->GetMaxError(), ERROR_INSIDE );
+
+                            table->DrawBorders(
+                                    [&]( const VECTOR2I& ptA, const VECTOR2I& ptB,
+                                         const STROKE_PARAMS& stroke )
+                                    {
+                                        SHAPE_SEGMENT seg( ptA, ptB, stroke.GetWidth()  );
+                                        seg.TransformToPolygon( *layerPoly, table->GetMaxError(), ERROR_INSIDE );
+                                    } );
+                            break;
+                        }
 
-                case PCB_DIM_ALIGNED_T:
-                case PCB_DIM_CENTER_T:
-                case PCB_DIM_RADIAL_T:
-                case PCB_DIM_ORTHOGONAL_T:
-                case PCB_DIM_LEADER_T:
-                {
-                    PCB_DIMENSION_BASE* dimension = static_cast<PCB_DIMENSION_BASE*>( item );
+                        case PCB_BARCODE_T:
+                        {
+                            PCB_BARCODE* bar_code = static_cast<PCB_BARCODE*>( item );
 
-                    dimension->TransformTextToPolySet( *layerPoly, 0, dimension->GetMaxError(), ERROR_INSIDE );
+                            bar_code->TransformShapeToPolySet( *layerPoly, layer, 0, 0, ERROR_INSIDE );
+                            break;
+                        }
 
-                    for( const std::shared_ptr<SHAPE>& shape : dimension->GetShapes() )
-                        shape->TransformToPolygon( *layerPoly, dimension->GetMaxError(), ERROR_INSIDE );
+                        case PCB_DIM_ALIGNED_T:
+                        case PCB_DIM_CENTER_T:
+                        case PCB_DIM_RADIAL_T:
+                        case PCB_DIM_ORTHOGONAL_T:
+                        case PCB_DIM_LEADER_T:
+                        {
+                            PCB_DIMENSION_BASE* dimension = static_cast<PCB_DIMENSION_BASE*>( item );
 
-                    break;
-                }
+                            dimension->TransformTextToPolySet( *layerPoly, 0, dimension->GetMaxError(), ERROR_INSIDE );
 
-                case PCB_REFERENCE_IMAGE_T:     // ignore
-                    break;
+                            for( const std::shared_ptr<SHAPE>& shape : dimension->GetShapes() )
+                                shape->TransformToPolygon( *layerPoly, dimension->GetMaxError(), ERROR_INSIDE );
 
-                default:
-                    wxLogTrace( m_logTrace, wxT( "createLayers: item type: %d not implemented" ), item->Type() );
-                    break;
+                            break;
+                        }
+
+                        case PCB_REFERENCE_IMAGE_T:     // ignore
+                            break;
+
+                        default:
+                            wxLogTrace( m_logTrace, wxT( "createLayers: item type: %d not implemented" ), item->Type() );
+                            break;
+                        }
+                    }
                 }
-            }
-        }
-    }
+            } );
 
     if( cfg.show_zones )
     {
@@ -1744,20 +1787,21 @@ void BOARD_ADAPTER::createLayers( REPORTER* aStatusReporter )
     if( aStatusReporter )
         aStatusReporter->Report( _( "Simplify holes contours" ) );
 
-    for( PCB_LAYER_ID layer : layer_ids )
-    {
-        if( m_layerHoleOdPolys.contains( layer ) )
-        {
-            // found
-            SHAPE_POLY_SET *polyLayer = m_layerHoleOdPolys[layer];
-            polyLayer->Simplify();
+    forEachLayerParallel(
+            [&]( PCB_LAYER_ID layer )
+            {
+                if( m_layerHoleOdPolys.contains( layer ) )
+                {
+                    // found
+                    SHAPE_POLY_SET *polyLayer = m_layerHoleOdPolys[layer];
+                    polyLayer->Simplify();
 
-            wxASSERT( m_layerHoleIdPolys.contains( layer ) );
+                    wxASSERT( m_layerHoleIdPolys.contains( layer ) );
 
-            polyLayer = m_layerHoleIdPolys[layer];
-            polyLayer->Simplify();
-        }
-    }
+                    polyLayer = m_layerHoleIdPolys[layer];
+                    polyLayer->Simplify();
+                }
+            } );
 
     // Build BVH (Bounding volume hierarchy) for holes and vias
 
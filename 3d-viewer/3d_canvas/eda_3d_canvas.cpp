@@ -179,8 +179,17 @@ EDA_3D_CANVAS::~EDA_3D_CANVAS()
 }
 
 
+void EDA_3D_CANVAS::joinRaytraceCalcThread()
+{
+    if( m_raytraceCalcThread.joinable() )
+        m_raytraceCalcThread.join();
+}
+
+
 void EDA_3D_CANVAS::releaseOpenGL()
 {
+    joinRaytraceCalcThread();
+
     if( m_glRC )
     {
         GL_CONTEXT_MANAGER* gl_mgr = Pgm().GetGLContextManager();
@@ -511,6 +520,11 @@ void EDA_3D_CANVAS::DoRePaint()
                 reloadRaytracingForCalculations = true;
             }
 
+            // A background picking rebuild reads the same containers the raytracing renderer
+            // redraws from; let it finish before that renderer runs
+            if( m_3d_render == m_3d_render_raytracing )
+                joinRaytraceCalcThread();
+
             requested_redraw = m_3d_render->Redraw( m_mouse_was_moved || m_camera_is_moving,
                                                     &activityReporter, &warningReporter );
 
@@ -521,8 +535,42 @@ void EDA_3D_CANVAS::DoRePaint()
             // cosmetic, so I'm not fixing that for now: I don't know how to do this without
             // reloading twice (maybe it's not too bad of an idea?) or doing a complicated
             // refactor.
+            //
+            // Rebuilding the picking data can take as long as the reload itself, so hand it
+            // to a worker thread: the UI is responsive again as soon as the GL scene is up,
+            // and mouse-over picking simply stays off until the data is ready.
             if( reloadRaytracingForCalculations )
-                m_3d_render_raytracing->Reload( nullptr, nullptr, true );
+                m_raytraceReloadPending.store( true );
+
+            if( m_raytraceReloadPending.load() && !m_raytraceCalcInProgress.exchange( true ) )
+            {
+                joinRaytraceCalcThread();
+
+                m_raytraceCalcThread = std::thread(
+                        [this]()
+                        {
+                            do
+                            {
+                                while( m_raytraceReloadPending.exchange( false ) )
+                                {
+                                    try
+                                    {
+                                        m_3d_render_raytracing->Reload( nullptr, nullptr, true );
+                                    }
+                                    catch( ... )
+                                    {
+                                    }
+                                }
+
+                                m_raytraceCalcInProgress.store( false );
+
+                                // A request latched between the last check and the store above
+                                // would otherwise wait for the next repaint (which may never
+                                // come); re-acquire and service it here instead
+                            } while( m_raytraceReloadPending.load()
+                                     && !m_raytraceCalcInProgress.exchange( true ) );
+                        } );
+            }
         }
         catch( std::runtime_error& )
         {
@@ -774,6 +822,10 @@ void EDA_3D_CANVAS::RenderToFrameBuffer( unsigned char* buffer, int width, int h
 
             requested_redraw = m_3d_render->Redraw( false, nullptr, nullptr );
 
+            // Off-screen rendering is synchronous, so finish any background picking
+            // rebuild and reload in place
+            joinRaytraceCalcThread();
+
             if( reloadRaytracingForCalculations )
                 m_3d_render_raytracing->Reload( nullptr, nullptr, true );
         }
@@ -951,7 +1003,8 @@ void EDA_3D_CANVAS::OnMouseMove( wxMouseEvent& event )
         // OnMiddleUp() will do it at the end of mouse drag/move command
     }
 
-    if( !event.Dragging() && m_boardAdapter.m_Cfg->m_Render.engine == RENDER_ENGINE::OPENGL )
+    if( !event.Dragging() && m_boardAdapter.m_Cfg->m_Render.engine == RENDER_ENGINE::OPENGL
+            && !m_raytraceCalcInProgress )
     {
         STATUSBAR_REPORTER reporter( m_parentStatusBar, EDA_3D_VIEWER_STATUSBAR::HOVERED_ITEM );
         RAY                mouseRay = getRayAtCurrentMousePosition();
@@ -1058,7 +1111,7 @@ void EDA_3D_CANVAS::OnLeftDown( wxMouseEvent& event )
     // opening a context menu)
     OnMouseMoveCamera( event );
 
-    if( !event.Dragging() && ( m_3d_render_raytracing != nullptr ) )
+    if( !event.Dragging() && ( m_3d_render_raytracing != nullptr ) && !m_raytraceCalcInProgress )
     {
         RAY mouseRay = getRayAtCurrentMousePosition();
 
@@ -26,6 +26,7 @@
 #define EDA_3D_CANVAS_H
 
 #include <atomic>
+#include <thread>
 #include "board_adapter.h"
 #include "3d_rendering/raytracing/accelerators/accelerator_3d.h"
 #include "3d_rendering/render_3d_base.h"
@@ -301,6 +302,14 @@ private:
 
     RAY getRayAtCurrentMousePosition();
 
+    /**
+     * Wait for a pending background rebuild of the raytracing picking data to finish.
+     *
+     * Must be called before anything that reads or frees the raytracing containers
+     * (raytracing redraw, off-screen rendering, renderer teardown).
+     */
+    void joinRaytraceCalcThread();
+
 private:
     TOOL_DISPATCHER*       m_eventDispatcher = nullptr;
     wxStatusBar*           m_parentStatusBar = nullptr;         // Parent statusbar to report progress
@@ -329,6 +338,15 @@ private:
     bool                   m_opengl_supports_raytracing = true;
     bool                   m_render_raytracing_was_requested = false;
 
+    // Rebuilds the raytracing picking data in the background after an OpenGL scene
+    // reload, so the UI thread does not stall twice for a single rebuild
+    std::thread            m_raytraceCalcThread;
+    std::atomic<bool>      m_raytraceCalcInProgress{ false };
+
+    // Latches a reload request that arrives while a rebuild is still running, so it is
+    // serviced instead of dropped (the renderer's own pending flag is consumed by Redraw())
+    std::atomic<bool>      m_raytraceReloadPending{ false };
+
     ACCELERATOR_3D*        m_accelerator3DShapes = nullptr;    // used for mouse over searching
 
     BOARD_ITEM*            m_currentRollOverItem = nullptr;
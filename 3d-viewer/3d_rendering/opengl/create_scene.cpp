@@ -37,6 +37,8 @@
 #include <footprint_library_adapter.h>
 #include <eda_3d_viewer_frame.h>
 #include <project_pcb.h>
+#include <thread_pool.h>
+#include <tuple>
 
 
 void RENDER_3D_OPENGL::addObjectTriangles( const FILLED_CIRCLE_2D* aCircle,
@@ -457,8 +459,30 @@ void RENDER_3D_OPENGL::backfillPostMachine()
         return ( absZ - boardBot ) / boardThick;
     };
 
-    // We'll accumulate all plug geometry into a single triangle list
-    TRIANGLE_DISPLAY_LIST* plugTriangles = new TRIANGLE_DISPLAY_LIST( 1024 );
+    // Plugs come in a handful of distinct shapes (drill sizes and spans repeat across a
+    // board), so rather than tessellating a cylinder or cone per item we group the items
+    // by shape, tessellate each distinct shape once at the XY origin and replay it at
+    // every instance position at draw time.
+    struct PLUG_SHAPE
+    {
+        bool  cone;         // countersink cone rather than a plain cylinder ring
+        float innerRadius;
+        float outerRadius;
+        float zTop;
+        float zBot;
+        int   segments;
+        int   angleTenths;  // countersink angle in tenths of a degree (0 for cylinders)
+
+        bool operator<( const PLUG_SHAPE& aOther ) const
+        {
+            return std::tie( cone, innerRadius, outerRadius, zTop, zBot, segments,
+                             angleTenths )
+                 < std::tie( aOther.cone, aOther.innerRadius, aOther.outerRadius,
+                             aOther.zTop, aOther.zBot, aOther.segments, aOther.angleTenths );
+        }
+    };
+
+    std::map<PLUG_SHAPE, std::vector<SFVEC2F>> plugInstances;
 
     // Process vias for backdrill and post-machining plugs
     for( const PCB_TRACK* track : m_boardAdapter.GetBoard()->Tracks() )
@@ -507,8 +531,9 @@ void RENDER_3D_OPENGL::backfillPostMachine()
             getLayerZPos( plug_start_layer, plugZTop, temp );
 
             // Create a ring from holeOuterRadius to backdrillRadius
-            generateCylinder( center, holeOuterRadius, std::max( secondaryDrillRadius, tertiaryDrillRadius ),
-                                plugZTop, plugZBot, nrSegments, plugTriangles );
+            plugInstances[PLUG_SHAPE{ false, holeOuterRadius,
+                                      std::max( secondaryDrillRadius, tertiaryDrillRadius ),
+                                      plugZTop, plugZBot, nrSegments, 0 }].push_back( center );
         }
 
         // Handle front post-machining plugs
@@ -531,14 +556,16 @@ void RENDER_3D_OPENGL::backfillPostMachine()
                 {
                     if( frontMode.value() == PAD_DRILL_POST_MACHINING_MODE::COUNTERSINK )
                     {
-                        EDA_ANGLE angle( via->GetFrontPostMachiningAngle(), TENTHS_OF_A_DEGREE_T );
-                        generateInvCone( center, holeOuterRadius, frontRadius,
-                                         pmBottomZ, plugZBot, nrSegments, plugTriangles, angle );
+                        plugInstances[PLUG_SHAPE{ true, holeOuterRadius, frontRadius,
+                                                  pmBottomZ, plugZBot, nrSegments,
+                                                  via->GetFrontPostMachiningAngle() }]
+                                .push_back( center );
                     }
                     else
                     {
-                        generateCylinder( center, holeOuterRadius, frontRadius,
-                                          pmBottomZ, plugZBot, nrSegments, plugTriangles );
+                        plugInstances[PLUG_SHAPE{ false, holeOuterRadius, frontRadius,
+                                                  pmBottomZ, plugZBot, nrSegments, 0 }]
+                                .push_back( center );
                     }
                 }
             }
@@ -564,14 +591,16 @@ void RENDER_3D_OPENGL::backfillPostMachine()
                 {
                     if( backMode.value() == PAD_DRILL_POST_MACHINING_MODE::COUNTERSINK )
                     {
-                        EDA_ANGLE angle( via->GetBackPostMachiningAngle(), TENTHS_OF_A_DEGREE_T );
-                        generateInvCone( center, holeOuterRadius, backRadius,
-                                         plugZTop, pmTopZ, nrSegments, plugTriangles, angle );
+                        plugInstances[PLUG_SHAPE{ true, holeOuterRadius, backRadius,
+                                                  plugZTop, pmTopZ, nrSegments,
+                                                  via->GetBackPostMachiningAngle() }]
+                                .push_back( center );
                     }
                     else
                     {
-                        generateCylinder( center, holeOuterRadius, backRadius,
-                                          plugZTop, pmTopZ, nrSegments, plugTriangles );
+                        plugInstances[PLUG_SHAPE{ false, holeOuterRadius, backRadius,
+                                                  plugZTop, pmTopZ, nrSegments, 0 }]
+                                .push_back( center );
                     }
                 }
             }
@@ -618,14 +647,16 @@ void RENDER_3D_OPENGL::backfillPostMachine()
                     {
                         if( frontMode.value() == PAD_DRILL_POST_MACHINING_MODE::COUNTERSINK )
                         {
-                            EDA_ANGLE angle( pad->GetFrontPostMachiningAngle(), TENTHS_OF_A_DEGREE_T );
-                            generateInvCone( padCenter, holeOuterRadius, frontRadius,
-                                             pmBottomZ, plugZBot, nrSegments, plugTriangles, angle );
+                            plugInstances[PLUG_SHAPE{ true, holeOuterRadius, frontRadius,
+                                                      pmBottomZ, plugZBot, nrSegments,
+                                                      pad->GetFrontPostMachiningAngle() }]
+                                    .push_back( padCenter );
                         }
                         else
                         {
-                            generateCylinder( padCenter, holeOuterRadius, frontRadius,
-                                              pmBottomZ, plugZBot, nrSegments, plugTriangles );
+                            plugInstances[PLUG_SHAPE{ false, holeOuterRadius, frontRadius,
+                                                      pmBottomZ, plugZBot, nrSegments, 0 }]
+                                    .push_back( padCenter );
                         }
                     }
                 }
@@ -650,14 +681,16 @@ void RENDER_3D_OPENGL::backfillPostMachine()
                     {
                         if( backMode.value() == PAD_DRILL_POST_MACHINING_MODE::COUNTERSINK )
                         {
-                            EDA_ANGLE angle( pad->GetBackPostMachiningAngle(), TENTHS_OF_A_DEGREE_T );
-                            generateInvCone( padCenter, holeOuterRadius, backRadius,
-                                             plugZTop, pmTopZ, nrSegments, plugTriangles, angle );
+                            plugInstances[PLUG_SHAPE{ true, holeOuterRadius, backRadius,
+                                                      plugZTop, pmTopZ, nrSegments,
+                                                      pad->GetBackPostMachiningAngle() }]
+                                    .push_back( padCenter );
                         }
                         else
                         {
-                            generateCylinder( padCenter, holeOuterRadius, backRadius,
-                                              plugZTop, pmTopZ, nrSegments, plugTriangles );
+                            plugInstances[PLUG_SHAPE{ false, holeOuterRadius, backRadius,
+                                                      plugZTop, pmTopZ, nrSegments, 0 }]
+                                    .push_back( padCenter );
                         }
                     }
                 }
@@ -665,22 +698,35 @@ void RENDER_3D_OPENGL::backfillPostMachine()
         }
     }
 
-    // If we have any plug geometry, create a render list for it
-    if( plugTriangles->m_layer_top_triangles->GetVertexSize() > 0
-        || plugTriangles->m_layer_bot_triangles->GetVertexSize() > 0
-        || plugTriangles->m_layer_middle_contours_quads->GetVertexSize() > 0 )
+    // Tessellate each distinct plug shape once and keep the positions it is drawn at.
+    // The render lists use the same Z range as the board; they will be scaled and drawn
+    // alongside m_boardWithHoles in renderBoardBody()
+    for( auto& [shape, centers] : plugInstances )
     {
+        TRIANGLE_DISPLAY_LIST* plugTriangles = new TRIANGLE_DISPLAY_LIST( shape.segments * 4 );
+
+        if( shape.cone )
+        {
+            EDA_ANGLE angle( shape.angleTenths, TENTHS_OF_A_DEGREE_T );
+            generateInvCone( SFVEC2F( 0.0f, 0.0f ), shape.innerRadius, shape.outerRadius,
+                             shape.zTop, shape.zBot, shape.segments, plugTriangles, angle );
+        }
+        else
+        {
+            generateCylinder( SFVEC2F( 0.0f, 0.0f ), shape.innerRadius, shape.outerRadius,
+                              shape.zTop, shape.zBot, shape.segments, plugTriangles );
+        }
+
         // Store the triangles for later cleanup
         m_triangles.push_back( plugTriangles );
 
-        // Create a render list for the plugs using the same Z range as the board
-        // This will be scaled and drawn alongside m_boardWithHoles in renderBoardBody()
-        m_postMachinePlugs = new OPENGL_RENDER_LIST( *plugTriangles, m_circleTexture,
-                                                     boardZTop, boardZTop );
-    }
-    else
-    {
-        delete plugTriangles;
+        INSTANCED_RENDER_LIST plugs;
+
+        plugs.m_mesh = new OPENGL_RENDER_LIST( *plugTriangles, m_circleTexture,
+                                               boardZTop, boardZTop );
+        plugs.m_centers = std::move( centers );
+
+        m_postMachinePlugs.push_back( std::move( plugs ) );
     }
 }
 
@@ -1621,29 +1667,68 @@ void RENDER_3D_OPENGL::load3dModels( REPORTER* aStatusReporter )
 
     S3D_CACHE* cacheMgr = m_boardAdapter.Get3dCacheManager();
 
-    // Go for all footprints
+    auto basePathForFootprint =
+            [this]( const FOOTPRINT* aFootprint ) -> wxString
+            {
+                wxString basePath = wxEmptyString;
+
+                if( m_boardAdapter.GetBoard()->GetProject() )
+                {
+                    try
+                    {
+                        // FindRow() can throw an exception
+                        std::optional<LIBRARY_TABLE_ROW*> fpRow =
+                            PROJECT_PCB::FootprintLibAdapter(
+                                    m_boardAdapter.GetBoard()->GetProject() )
+                                    ->GetRow( aFootprint->GetFPID().GetLibNickname() );
+
+                        if( fpRow )
+                            basePath = LIBRARY_MANAGER::GetFullURI( *fpRow, true );
+                    }
+                    catch( ... )
+                    {
+                        // Do nothing if the library nickname is not found in lib table
+                    }
+                }
+
+                return basePath;
+            };
+
+    // Resolve and load the referenced models concurrently on the thread pool, so the loop
+    // below only sees warm cache entries.  MODEL_3D creation touches the GL context, so it
+    // stays on this thread.
+    thread_pool& tp = GetKiCadThreadPool();
+    BS::multi_future<void> prefetch;
+
     for( const FOOTPRINT* footprint : m_boardAdapter.GetBoard()->Footprints() )
     {
-        wxString libraryName = footprint->GetFPID().GetLibNickname();
-        wxString footprintBasePath = wxEmptyString;
+        wxString footprintBasePath = basePathForFootprint( footprint );
 
-        if( m_boardAdapter.GetBoard()->GetProject() )
+        for( const FP_3DMODEL& fp_model : footprint->Models() )
         {
-            try
-            {
-                // FindRow() can throw an exception
-                std::optional<LIBRARY_TABLE_ROW*> fpRow =
-                    PROJECT_PCB::FootprintLibAdapter( m_boardAdapter.GetBoard()->GetProject() )
-                            ->GetRow( libraryName );
+            if( !fp_model.m_Show || fp_model.m_Filename.empty()
+                    || m_3dModelMap.contains( fp_model.m_Filename ) )
+                continue;
 
-                if( fpRow )
-                    footprintBasePath = LIBRARY_MANAGER::GetFullURI( *fpRow, true );
-            }
-            catch( ... )
-            {
-                // Do nothing if the libraryName is not found in lib table
-            }
+            std::vector<const EMBEDDED_FILES*> embeddedFilesStack;
+            embeddedFilesStack.push_back( footprint->GetEmbeddedFiles() );
+            embeddedFilesStack.push_back( m_boardAdapter.GetBoard()->GetEmbeddedFiles() );
+
+            prefetch.push_back( tp.submit_task(
+                    [cacheMgr, filename = fp_model.m_Filename, footprintBasePath,
+                     embeddedFilesStack]()
+                    {
+                        cacheMgr->GetModel( filename, footprintBasePath, embeddedFilesStack );
+                    } ) );
         }
+    }
+
+    prefetch.wait();
+
+    // Go for all footprints
+    for( const FOOTPRINT* footprint : m_boardAdapter.GetBoard()->Footprints() )
+    {
+        wxString footprintBasePath = basePathForFootprint( footprint );
 
         for( const FP_3DMODEL& fp_model : footprint->Models() )
         {
@@ -80,7 +80,6 @@ RENDER_3D_OPENGL::RENDER_3D_OPENGL( EDA_3D_CANVAS* aCanvas, BOARD_ADAPTER& aAdap
     m_lastGridType = GRID3D_TYPE::NONE;
     m_currentRollOverItem = nullptr;
     m_boardWithHoles = nullptr;
-    m_postMachinePlugs = nullptr;
 
     m_3dModelMap.clear();
 
@@ -485,13 +484,24 @@ void RENDER_3D_OPENGL::renderBoardBody( bool aSkipRenderHoles )
     }
 
     // Also render post-machining plugs (board material that remains after backdrill/counterbore/countersink)
-    if( !aSkipRenderHoles && m_postMachinePlugs )
+    if( !aSkipRenderHoles )
     {
-        m_postMachinePlugs->ApplyScalePosition( -m_boardAdapter.GetBoardBodyThickness() / 2.0f,
-                                                m_boardAdapter.GetBoardBodyThickness() );
+        for( const INSTANCED_RENDER_LIST& plugs : m_postMachinePlugs )
+        {
+            plugs.m_mesh->ApplyScalePosition( -m_boardAdapter.GetBoardBodyThickness() / 2.0f,
+                                              m_boardAdapter.GetBoardBodyThickness() );
+
+            plugs.m_mesh->SetItIsTransparent( true );
 
-        m_postMachinePlugs->SetItIsTransparent( true );
-        m_postMachinePlugs->DrawAll();
+            // Replay the shared mesh at every instance position
+            for( const SFVEC2F& center : plugs.m_centers )
+            {
+                glPushMatrix();
+                glTranslatef( center.x, center.y, 0.0f );
+                plugs.m_mesh->DrawAll();
+                glPopMatrix();
+            }
+        }
     }
 }
 
@@ -952,9 +962,13 @@ void RENDER_3D_OPENGL::freeAllLists()
 
     DELETE_AND_FREE( m_board )
     DELETE_AND_FREE( m_boardWithHoles )
-    DELETE_AND_FREE( m_postMachinePlugs )
     DELETE_AND_FREE( m_antiBoard )
 
+    for( INSTANCED_RENDER_LIST& plugs : m_postMachinePlugs )
+        delete plugs.m_mesh;
+
+    m_postMachinePlugs.clear();
+
     DELETE_AND_FREE( m_outerThroughHoles )
     DELETE_AND_FREE( m_outerViaThroughHoles )
     DELETE_AND_FREE( m_outerThroughHoleRings )
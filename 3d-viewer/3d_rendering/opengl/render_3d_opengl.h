@@ -254,6 +254,16 @@ private:
 
     EDA_3D_CANVAS* m_canvas;
 
+    /**
+     * One distinct mesh tessellated at the XY origin plus the positions it is drawn at;
+     * the display-list analogue of instanced rendering for repeated primitives.
+     */
+    struct INSTANCED_RENDER_LIST
+    {
+        OPENGL_RENDER_LIST*  m_mesh = nullptr;
+        std::vector<SFVEC2F> m_centers;
+    };
+
     MAP_OGL_DISP_LISTS  m_layers;
     OPENGL_RENDER_LIST* m_platedPadsFront;
     OPENGL_RENDER_LIST* m_platedPadsBack;
@@ -263,7 +273,9 @@ private:
     MAP_OGL_DISP_LISTS  m_innerLayerHoles;
     OPENGL_RENDER_LIST* m_board;
     OPENGL_RENDER_LIST* m_boardWithHoles;
-    OPENGL_RENDER_LIST* m_postMachinePlugs;     ///< Board material plugs for backdrill/counterbore/countersink
+    ///< Board material plugs for backdrill/counterbore/countersink, one entry per
+    ///< distinct plug shape drawn at every stored center
+    std::vector<INSTANCED_RENDER_LIST> m_postMachinePlugs;
     OPENGL_RENDER_LIST* m_antiBoard;
     OPENGL_RENDER_LIST* m_outerThroughHoles;
     OPENGL_RENDER_LIST* m_outerViaThroughHoles;
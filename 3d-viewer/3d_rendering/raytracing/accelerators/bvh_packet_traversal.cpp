@@ -44,7 +44,8 @@ struct StackNode
 };
 
 
-static inline unsigned int getFirstHit( const RAYPACKET& aRayPacket, const BBOX_3D& aBBox,
+static inline unsigned int getFirstHit( const RAYPACKET& aRayPacket,
+                                        const RAYPACKET_SOA& aRaysSoA, const BBOX_3D& aBBox,
                                         unsigned int ia, HITINFO_PACKET* aHitInfoPacket )
 {
     float hitT;
@@ -56,10 +57,14 @@ static inline unsigned int getFirstHit( const RAYPACKET& aRayPacket, const BBOX_
     if( !aRayPacket.m_Frustum.Intersect( aBBox ) )
         return RAYPACKET_RAYS_PER_PACKET;
 
+    float hitTs[RAYPACKET_RAYS_PER_PACKET];
+    bool  hits[RAYPACKET_RAYS_PER_PACKET];
+
+    aRaysSoA.IntersectBBox( aBBox, hitTs, hits );
+
     for( unsigned int i = ia + 1; i < RAYPACKET_RAYS_PER_PACKET; ++i )
     {
-        if( aBBox.Intersect( aRayPacket.m_ray[i], &hitT )
-          && ( hitT < aHitInfoPacket[i].m_HitInfo.m_tHit ) )
+        if( hits[i] && ( hitTs[i] < aHitInfoPacket[i].m_HitInfo.m_tHit ) )
             return i;
     }
 
@@ -69,15 +74,17 @@ static inline unsigned int getFirstHit( const RAYPACKET& aRayPacket, const BBOX_
 
 #ifdef BVH_RANGED_TRAVERSAL
 
-static inline unsigned int getLastHit( const RAYPACKET& aRayPacket, const BBOX_3D& aBBox,
+static inline unsigned int getLastHit( const RAYPACKET_SOA& aRaysSoA, const BBOX_3D& aBBox,
                                        unsigned int ia, HITINFO_PACKET* aHitInfoPacket )
 {
+    float hitTs[RAYPACKET_RAYS_PER_PACKET];
+    bool  hits[RAYPACKET_RAYS_PER_PACKET];
+
+    aRaysSoA.IntersectBBox( aBBox, hitTs, hits );
+
     for( unsigned int ie = (RAYPACKET_RAYS_PER_PACKET - 1); ie > ia; --ie )
     {
-        float hitT;
-
-        if( aBBox.Intersect( aRayPacket.m_ray[ie], &hitT )
-          && ( hitT < aHitInfoPacket[ie].m_HitInfo.m_tHit ) )
+        if( hits[ie] && ( hitTs[ie] < aHitInfoPacket[ie].m_HitInfo.m_tHit ) )
             return ie + 1;
     }
 
@@ -101,13 +108,15 @@ bool BVH_PBRT::Intersect( const RAYPACKET& aRayPacket, HITINFO_PACKET* aHitInfoP
     int todoOffset = 0, nodeNum = 0;
     StackNode todo[MAX_TODOS];
 
+    const RAYPACKET_SOA raysSoA( aRayPacket.m_ray );
+
     unsigned int ia = 0;
 
     while( true )
     {
         const LinearBVHNode *curCell = &m_nodes[nodeNum];
 
-        ia = getFirstHit( aRayPacket, curCell->bounds, ia, aHitInfoPacket );
+        ia = getFirstHit( aRayPacket, raysSoA, curCell->bounds, ia, aHitInfoPacket );
 
         if( ia < RAYPACKET_RAYS_PER_PACKET )
         {
@@ -121,7 +130,7 @@ bool BVH_PBRT::Intersect( const RAYPACKET& aRayPacket, HITINFO_PACKET* aHitInfoP
             }
             else
             {
-                const unsigned int ie = getLastHit( aRayPacket, curCell->bounds, ia,
+                const unsigned int ie = getLastHit( raysSoA, curCell->bounds, ia,
                                                     aHitInfoPacket );
 
                 for( int j = 0; j < curCell->nPrimitives; ++j )
@@ -72,10 +72,12 @@
 
 #include <boost/range/algorithm/nth_element.hpp>
 #include <boost/range/algorithm/partition.hpp>
+#include <atomic>
 #include <cstdlib>
 #include <vector>
 
 #include <stack>
+#include <thread_pool.h>
 #include <wx/debug.h>
 
 #ifdef PRINT_STATISTICS_3D_VIEWER
@@ -685,27 +687,46 @@ BVHBuildNode *BVH_PBRT::HLBVHBuild( const std::vector<BVHPrimitiveInfo>& primiti
     for( unsigned int i = 0; i < primitiveInfo.size(); ++i )
         bounds.Union( primitiveInfo[i].centroid );
 
-    // Compute Morton indices of primitives
+    // Compute Morton indices of primitives in parallel; each entry only touches its own slot,
+    // so the worker threads can simply stride over the vector
     std::vector<MortonPrimitive> mortonPrims( primitiveInfo.size() );
 
-    for( int i = 0; i < (int)primitiveInfo.size(); ++i )
-    {
-        // Initialize _mortonPrims[i]_ for _i_th primitive
-        const int mortonBits  = 10;
-        const int mortonScale = 1 << mortonBits;
+    thread_pool& tp = GetKiCadThreadPool();
 
-        wxASSERT( primitiveInfo[i].primitiveNumber < (int)primitiveInfo.size() );
+    std::atomic<size_t> nextMortonPrim( 0 );
 
-        mortonPrims[i].primitiveIndex = primitiveInfo[i].primitiveNumber;
+    auto computeMortonCodes =
+            [&]()
+            {
+                for( size_t i = nextMortonPrim.fetch_add( 1 );
+                            i < primitiveInfo.size();
+                            i = nextMortonPrim.fetch_add( 1 ) )
+                {
+                    // Initialize _mortonPrims[i]_ for _i_th primitive
+                    const int mortonBits  = 10;
+                    const int mortonScale = 1 << mortonBits;
 
-        const SFVEC3F centroidOffset = bounds.Offset( primitiveInfo[i].centroid );
+                    wxASSERT( primitiveInfo[i].primitiveNumber < (int)primitiveInfo.size() );
 
-        wxASSERT( ( centroidOffset.x >= 0.0f ) && ( centroidOffset.x <= 1.0f ) );
-        wxASSERT( ( centroidOffset.y >= 0.0f ) && ( centroidOffset.y <= 1.0f ) );
-        wxASSERT( ( centroidOffset.z >= 0.0f ) && ( centroidOffset.z <= 1.0f ) );
+                    mortonPrims[i].primitiveIndex = primitiveInfo[i].primitiveNumber;
 
-        mortonPrims[i].mortonCode = EncodeMorton3( centroidOffset * SFVEC3F( (float)mortonScale ) );
-    }
+                    const SFVEC3F centroidOffset = bounds.Offset( primitiveInfo[i].centroid );
+
+                    wxASSERT( ( centroidOffset.x >= 0.0f ) && ( centroidOffset.x <= 1.0f ) );
+                    wxASSERT( ( centroidOffset.y >= 0.0f ) && ( centroidOffset.y <= 1.0f ) );
+                    wxASSERT( ( centroidOffset.z >= 0.0f ) && ( centroidOffset.z <= 1.0f ) );
+
+                    mortonPrims[i].mortonCode = EncodeMorton3( centroidOffset *
+                                                               SFVEC3F( (float)mortonScale ) );
+                }
+            };
+
+    BS::multi_future<void> mortonFutures;
+
+    for( size_t i = 0; i < tp.get_thread_count(); ++i )
+        mortonFutures.push_back( tp.submit_task( computeMortonCodes, TP_PRIORITY_BATCH ) );
+
+    mortonFutures.wait();
 
     // Radix sort primitive Morton indices
     RadixSort( &mortonPrims );
@@ -755,28 +776,46 @@ BVHBuildNode *BVH_PBRT::HLBVHBuild( const std::vector<BVHPrimitiveInfo>& primiti
         }
     }
 
-    // Create LBVHs for treelets in parallel
-    int atomicTotal = 0;
-    int orderedPrimsOffset = 0;
+    // Create LBVHs for treelets in parallel.  Each treelet writes only into its own
+    // pre-allocated node array and claims a disjoint range of _orderedPrims_ slots through
+    // the shared atomic offset, so the treelets are fully independent of each other.
+    std::atomic<int> atomicTotal( 0 );
+    std::atomic<int> orderedPrimsOffset( 0 );
 
     orderedPrims.resize( m_primitives.size() );
 
-    for( int index = 0; index < (int)treeletsToBuild.size(); ++index )
-    {
-        // Generate _index_th LBVH treelet
-        int nodesCreated = 0;
-        const int firstBit = 29 - 12;
+    std::atomic<size_t> nextTreelet( 0 );
 
-        LBVHTreelet &tr = treeletsToBuild[index];
+    auto buildTreelets =
+            [&]()
+            {
+                for( size_t index = nextTreelet.fetch_add( 1 );
+                            index < treeletsToBuild.size();
+                            index = nextTreelet.fetch_add( 1 ) )
+                {
+                    // Generate _index_th LBVH treelet
+                    int nodesCreated = 0;
+                    const int firstBit = 29 - 12;
 
-        wxASSERT( tr.startIndex < (int)mortonPrims.size() );
+                    LBVHTreelet& tr = treeletsToBuild[index];
 
-        tr.buildNodes = emitLBVH( tr.buildNodes, primitiveInfo, &mortonPrims[tr.startIndex],
-                                  tr.numPrimitives, &nodesCreated, orderedPrims,
-                                  &orderedPrimsOffset, firstBit );
+                    wxASSERT( tr.startIndex < (int)mortonPrims.size() );
 
-        atomicTotal += nodesCreated;
-    }
+                    tr.buildNodes = emitLBVH( tr.buildNodes, primitiveInfo,
+                                              &mortonPrims[tr.startIndex], tr.numPrimitives,
+                                              &nodesCreated, orderedPrims, &orderedPrimsOffset,
+                                              firstBit );
+
+                    atomicTotal += nodesCreated;
+                }
+            };
+
+    BS::multi_future<void> treeletFutures;
+
+    for( size_t i = 0; i < tp.get_thread_count(); ++i )
+        treeletFutures.push_back( tp.submit_task( buildTreelets, TP_PRIORITY_BATCH ) );
+
+    treeletFutures.wait();
 
     *totalNodes = atomicTotal;
 
@@ -795,8 +834,8 @@ BVHBuildNode *BVH_PBRT::HLBVHBuild( const std::vector<BVHPrimitiveInfo>& primiti
 BVHBuildNode *BVH_PBRT::emitLBVH( BVHBuildNode* &buildNodes,
                                   const std::vector<BVHPrimitiveInfo>& primitiveInfo,
                                   MortonPrimitive* mortonPrims, int nPrimitives, int* totalNodes,
-                                  CONST_VECTOR_OBJECT& orderedPrims, int *orderedPrimsOffset,
-                                  int bit )
+                                  CONST_VECTOR_OBJECT& orderedPrims,
+                                  std::atomic<int>* orderedPrimsOffset, int bit )
 {
     wxASSERT( nPrimitives > 0 );
     wxASSERT( totalNodes != nullptr );
@@ -813,8 +852,7 @@ BVHBuildNode *BVH_PBRT::emitLBVH( BVHBuildNode* &buildNodes,
         BBOX_3D bounds;
         bounds.Reset();
 
-        int firstPrimOffset = *orderedPrimsOffset;
-        *orderedPrimsOffset += nPrimitives;
+        const int firstPrimOffset = orderedPrimsOffset->fetch_add( nPrimitives );
 
         wxASSERT( ( firstPrimOffset + ( nPrimitives - 1 ) ) < (int) orderedPrims.size() );
 
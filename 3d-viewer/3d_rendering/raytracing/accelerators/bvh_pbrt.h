@@ -71,6 +71,7 @@
 #define _BVH_PBRT_H_
 
 #include "accelerator_3d.h"
+#include <atomic>
 #include <cstdint>
 #include <list>
 
@@ -136,7 +137,8 @@ private:
     BVHBuildNode* emitLBVH( BVHBuildNode* &buildNodes,
                             const std::vector<BVHPrimitiveInfo>& primitiveInfo,
                             MortonPrimitive* mortonPrims, int nPrimitives, int* totalNodes,
-                            CONST_VECTOR_OBJECT& orderedPrims, int* orderedPrimsOffset, int bit );
+                            CONST_VECTOR_OBJECT& orderedPrims,
+                            std::atomic<int>* orderedPrimsOffset, int bit );
 
     BVHBuildNode* buildUpperSAH( std::vector<BVHBuildNode*>& treeletRoots, int start, int end,
                                  int* totalNodes );
@@ -47,6 +47,7 @@
 
 #include <base_units.h>
 #include <core/profile.h>        // To use GetRunningMicroSecs or another profiling utility
+#include <thread_pool.h>
 
 /**
  * Perform an interpolation step to easy control the transparency based on the
@@ -1049,9 +1050,11 @@ void RENDER_3D_RAYTRACE_BASE::Reload( REPORTER* aStatusReporter, REPORTER* aWarn
         m_camera.SetMinZoom( min_zoom );
     }
 
-    // Create an accelerator
+    // Create an accelerator.  HLBVH builds its bottom-level treelets in parallel and applies
+    // the surface area heuristic to the treelet roots, which both builds faster and traces
+    // faster than a plain spatial-middle split on dense boards.
     delete m_accelerator;
-    m_accelerator = new BVH_PBRT( m_objectContainer, 8, SPLITMETHOD::MIDDLE );
+    m_accelerator = new BVH_PBRT( m_objectContainer, 8, SPLITMETHOD::HLBVH );
 
     if( aStatusReporter )
     {
@@ -1907,6 +1910,71 @@ void RENDER_3D_RAYTRACE_BASE::load3DModels( CONTAINER_3D& aDstContainer,
         return;
     }
 
+    auto basePathForFootprint =
+            [this]( const FOOTPRINT* aFootprint ) -> wxString
+            {
+                wxString basePath = wxEmptyString;
+
+                if( m_boardAdapter.GetBoard()->GetProject() )
+                {
+                    try
+                    {
+                        // FindRow() can throw an exception
+                        std::optional<LIBRARY_TABLE_ROW*> fpRow =
+                            PROJECT_PCB::FootprintLibAdapter(
+                                    m_boardAdapter.GetBoard()->GetProject() )
+                                    ->GetRow( aFootprint->GetFPID().GetLibNickname() );
+
+                        if( fpRow )
+                            basePath = LIBRARY_MANAGER::GetFullURI( *fpRow, true );
+                    }
+                    catch( ... )
+                    {
+                        // Do nothing if the library nickname is not found in lib table
+                    }
+                }
+
+                return basePath;
+            };
+
+    // Resolve and load the referenced models concurrently on the thread pool, so the
+    // footprint loop below only sees warm cache entries
+    {
+        S3D_CACHE* cacheMgr = m_boardAdapter.Get3dCacheManager();
+
+        thread_pool& tp = GetKiCadThreadPool();
+        BS::multi_future<void> prefetch;
+
+        for( const FOOTPRINT* fp : m_boardAdapter.GetBoard()->Footprints() )
+        {
+            if( fp->Models().empty()
+              || !m_boardAdapter.IsFootprintShown( (FOOTPRINT_ATTR_T) fp->GetAttributes() ) )
+                continue;
+
+            wxString footprintBasePath = basePathForFootprint( fp );
+
+            for( const FP_3DMODEL& model : fp->Models() )
+            {
+                if( !model.m_Show || model.m_Filename.empty() )
+                    continue;
+
+                std::vector<const EMBEDDED_FILES*> embeddedFilesStack;
+                embeddedFilesStack.push_back( fp->GetEmbeddedFiles() );
+                embeddedFilesStack.push_back( m_boardAdapter.GetBoard()->GetEmbeddedFiles() );
+
+                prefetch.push_back( tp.submit_task(
+                        [cacheMgr, filename = model.m_Filename, footprintBasePath,
+                         embeddedFilesStack]()
+                        {
+                            cacheMgr->GetModel( filename, footprintBasePath,
+                                                embeddedFilesStack );
+                        } ) );
+            }
+        }
+
+        prefetch.wait();
+    }
+
     // Go for all footprints
     for( FOOTPRINT* fp : m_boardAdapter.GetBoard()->Footprints() )
     {
@@ -1947,27 +2015,7 @@ void RENDER_3D_RAYTRACE_BASE::load3DModels( CONTAINER_3D& aDstContainer,
             // Get the list of model files for this model
             S3D_CACHE* cacheMgr = m_boardAdapter.Get3dCacheManager();
 
-            wxString                libraryName = fp->GetFPID().GetLibNickname();
-
-            wxString                footprintBasePath = wxEmptyString;
-
-            if( m_boardAdapter.GetBoard()->GetProject() )
-            {
-                try
-                {
-                    // FindRow() can throw an exception
-                    std::optional<LIBRARY_TABLE_ROW*> fpRow =
-                    PROJECT_PCB::FootprintLibAdapter( m_boardAdapter.GetBoard()->GetProject() )
-                            ->GetRow( libraryName );
-
-                    if( fpRow )
-                        footprintBasePath = LIBRARY_MANAGER::GetFullURI( *fpRow, true );
-                }
-                catch( ... )
-                {
-                    // Do nothing if the libraryName is not found in lib table
-                }
-            }
+            wxString footprintBasePath = basePathForFootprint( fp );
 
             for( FP_3DMODEL& model : fp->Models() )
             {
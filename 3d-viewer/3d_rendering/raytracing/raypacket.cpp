@@ -180,3 +180,42 @@ void RAYPACKET_InitRays_with2DDisplacement( const CAMERA& aCamera, const SFVEC2F
         }
     }
 }
+
+
+RAYPACKET_SOA::RAYPACKET_SOA( const RAY* aRayPck )
+{
+    for( unsigned int i = 0; i < RAYPACKET_RAYS_PER_PACKET; ++i )
+    {
+        m_OriginX[i] = aRayPck[i].m_Origin.x;
+        m_OriginY[i] = aRayPck[i].m_Origin.y;
+        m_OriginZ[i] = aRayPck[i].m_Origin.z;
+        m_InvDirX[i] = aRayPck[i].m_InvDir.x;
+        m_InvDirY[i] = aRayPck[i].m_InvDir.y;
+        m_InvDirZ[i] = aRayPck[i].m_InvDir.z;
+    }
+}
+
+
+void RAYPACKET_SOA::IntersectBBox( const BBOX_3D& aBBox, float* aOutHitT, bool* aOutHit ) const
+{
+    const SFVEC3F& boxMin = aBBox.Min();
+    const SFVEC3F& boxMax = aBBox.Max();
+
+    for( unsigned int i = 0; i < RAYPACKET_RAYS_PER_PACKET; ++i )
+    {
+        const float tx1 = ( boxMin.x - m_OriginX[i] ) * m_InvDirX[i];
+        const float tx2 = ( boxMax.x - m_OriginX[i] ) * m_InvDirX[i];
+        const float ty1 = ( boxMin.y - m_OriginY[i] ) * m_InvDirY[i];
+        const float ty2 = ( boxMax.y - m_OriginY[i] ) * m_InvDirY[i];
+        const float tz1 = ( boxMin.z - m_OriginZ[i] ) * m_InvDirZ[i];
+        const float tz2 = ( boxMax.z - m_OriginZ[i] ) * m_InvDirZ[i];
+
+        const float tmin = glm::max( glm::max( glm::min( tx1, tx2 ), glm::min( ty1, ty2 ) ),
+                                     glm::max( glm::min( tz1, tz2 ), 0.0f ) );
+        const float tmax = glm::min( glm::min( glm::max( tx1, tx2 ), glm::max( ty1, ty2 ) ),
+                                     glm::max( tz1, tz2 ) );
+
+        aOutHitT[i] = tmin;
+        aOutHit[i]  = ( tmax >= tmin );
+    }
+}
@@ -54,6 +54,37 @@ struct RAYPACKET
     RAY         m_ray[RAYPACKET_RAYS_PER_PACKET];
 };
 
+
+/**
+ * Structure-of-arrays mirror of the rays of a #RAYPACKET.
+ *
+ * The ray origins and inverse directions are stored as contiguous per component
+ * arrays so that bundle level tests compile down to straight line loops the
+ * compiler can vectorize, instead of going through the per ray slope
+ * classification switch of #BBOX_3D::Intersect.
+ */
+struct RAYPACKET_SOA
+{
+    explicit RAYPACKET_SOA( const RAY* aRayPck );
+
+    /**
+     * Batched slab test of every ray of the bundle against a bounding box.
+     *
+     * @param aBBox the box to test against.
+     * @param aOutHitT receives, per ray, the entry distance into the box
+     *                 (clamped to zero when the ray origin is inside the box).
+     * @param aOutHit receives, per ray, true if the ray intersects the box.
+     */
+    void IntersectBBox( const BBOX_3D& aBBox, float* aOutHitT, bool* aOutHit ) const;
+
+    float m_OriginX[RAYPACKET_RAYS_PER_PACKET];
+    float m_OriginY[RAYPACKET_RAYS_PER_PACKET];
+    float m_OriginZ[RAYPACKET_RAYS_PER_PACKET];
+    float m_InvDirX[RAYPACKET_RAYS_PER_PACKET];
+    float m_InvDirY[RAYPACKET_RAYS_PER_PACKET];
+    float m_InvDirZ[RAYPACKET_RAYS_PER_PACKET];
+};
+
 void RAYPACKET_InitRays( const CAMERA& aCamera, const SFVEC2F& aWindowsPosition, RAY* aRayPck );
 
 void RAYPACKET_InitRays_with2DDisplacement( const CAMERA& aCamera, const SFVEC2F& aWindowsPosition,
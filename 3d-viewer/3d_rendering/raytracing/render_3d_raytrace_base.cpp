@@ -111,6 +111,7 @@ RENDER_3D_RAYTRACE_BASE::RENDER_3D_RAYTRACE_BASE( BOARD_ADAPTER& aAdapter, CAMER
     m_renderState = RT_RENDER_STATE_MAX; // Set to an initial invalid state
     m_renderStartTime = 0;
     m_blockRenderProgressCount = 0;
+    m_blockPositionsResume = 0;
 }
 
 
@@ -142,7 +143,7 @@ void RENDER_3D_RAYTRACE_BASE::restartRenderState()
 {
     m_renderStartTime = GetRunningMicroSecs();
 
-    m_renderState = RT_RENDER_STATE_TRACING;
+    m_renderState = RT_RENDER_STATE_COARSE_PREVIEW;
     m_blockRenderProgressCount = 0;
 
     m_postShaderSsao.InitFrame();
@@ -151,6 +152,8 @@ void RENDER_3D_RAYTRACE_BASE::restartRenderState()
 
     // Mark the blocks not processed yet
     std::fill( m_blockPositionsWasProcessed.begin(), m_blockPositionsWasProcessed.end(), 0 );
+
+    m_blockPositionsResume = 0;
 }
 
 
@@ -214,6 +217,15 @@ void RENDER_3D_RAYTRACE_BASE::render( uint8_t* ptrPBO, REPORTER* aStatusReporter
 
     switch( m_renderState )
     {
+    case RT_RENDER_STATE_COARSE_PREVIEW:
+        // Paint the whole frame with the fast 1/16 resolution pass before the full quality
+        // blocks start to land, so a restarted render refines a complete image instead of
+        // trickling blocks in over the background
+        renderPreview( ptrPBO );
+        m_isPreview = false;
+        m_renderState = RT_RENDER_STATE_TRACING;
+        break;
+
     case RT_RENDER_STATE_TRACING:
         renderTracing( ptrPBO, aStatusReporter );
         break;
@@ -248,7 +260,11 @@ void RENDER_3D_RAYTRACE_BASE::renderTracing( uint8_t* ptrPBO, REPORTER* aStatusR
 
     auto startTime = std::chrono::steady_clock::now();
     std::atomic<size_t> numBlocksRendered( 0 );
-    std::atomic<size_t> currentBlock( 0 );
+
+    // Workers claim one block at a time from this shared queue, so threads that land on
+    // cheap background tiles keep pulling work while a thread chews on a dense area.
+    // Resume from the first unrendered block instead of rescanning the processed prefix.
+    std::atomic<size_t> currentBlock( m_blockPositionsResume );
 
     thread_pool& tp = GetKiCadThreadPool();
     const int timeLimit = m_blockPositions.size() > 40000 ? 750 : 400;
@@ -282,6 +298,11 @@ void RENDER_3D_RAYTRACE_BASE::renderTracing( uint8_t* ptrPBO, REPORTER* aStatusR
 
     futures.wait();
 
+    // All blocks below the lowest unprocessed index were claimed and finished this slice
+    while( m_blockPositionsResume < m_blockPositions.size()
+           && m_blockPositionsWasProcessed[m_blockPositionsResume] )
+        m_blockPositionsResume++;
+
     m_blockRenderProgressCount += numBlocksRendered;
 
     if( aStatusReporter )
@@ -43,7 +43,8 @@ typedef std::map< const S3DMODEL* , MODEL_MATERIALS > MAP_MODEL_MATERIALS;
 
 typedef enum
 {
-    RT_RENDER_STATE_TRACING = 0,
+    RT_RENDER_STATE_COARSE_PREVIEW = 0, ///< fill the frame with a 1/16 resolution pass first
+    RT_RENDER_STATE_TRACING,
     RT_RENDER_STATE_POST_PROCESS_SHADE,
     RT_RENDER_STATE_POST_PROCESS_BLUR_AND_FINISH,
     RT_RENDER_STATE_FINISH,
@@ -194,6 +195,10 @@ protected:
     /// Flag if a position was already processed (cleared each new render).
     std::vector< int > m_blockPositionsWasProcessed;
 
+    /// First block not yet rendered; the next time slice resumes the shared block
+    /// queue from here instead of rescanning the processed prefix.
+    size_t m_blockPositionsResume;
+
     /// Encode the Morton code positions (on fast preview mode).
     std::vector< SFVEC2UI > m_blockPositionsFast;
 
@@ -537,7 +537,17 @@ void APPEARANCE_CONTROLS_3D::onColorSwatchChanged( COLOR_SWATCH* aSwatch )
     else
         syncLayerPresetSelection();
 
-    m_frame->NewDisplay( true );
+    if( m_frame->GetAdapter().m_Cfg->m_Render.engine == RENDER_ENGINE::OPENGL )
+    {
+        // The OpenGL renderer reads the adapter colors at draw time, so a color change
+        // only needs a repaint; rebuilding the scene is only required by the raytracer,
+        // which bakes colors into the objects
+        m_frame->GetCanvas()->Request_refresh();
+    }
+    else
+    {
+        m_frame->NewDisplay( true );
+    }
 }
 
 
@@ -80,9 +80,12 @@ static const wxChar DrawArcCenterStartEndMaxAngle[] = wxT( "DrawArcCenterStartEn
 static const wxChar MaxTangentTrackAngleDeviation[] = wxT( "MaxTangentTrackAngleDeviation" );
 static const wxChar MaxTrackLengthToKeep[] = wxT( "MaxTrackLengthToKeep" );
 static const wxChar StrokeTriangulation[] = wxT( "StrokeTriangulation" );
+static const wxChar ShowFrameTimingHUD[] = wxT( "ShowFrameTimingHUD" );
 static const wxChar ExtraZoneDisplayModes[] = wxT( "ExtraZoneDisplayModes" );
 static const wxChar MinPlotPenWidth[] = wxT( "MinPlotPenWidth" );
 static const wxChar DebugZoneFiller[] = wxT( "DebugZoneFiller" );
+static const wxChar EnableDRCPairCache[] = wxT( "EnableDRCPairCache" );
+static const wxChar EnableTriangulationCache[] = wxT( "EnableTriangulationCache" );
 static const wxChar DebugPDFWriter[] = wxT( "DebugPDFWriter" );
 static const wxChar PDFStrokeFontWidthFactor[] = wxT( "PDFStrokeFontWidthFactor" );
 static const wxChar PDFStrokeFontXOffset[] = wxT( "PDFStrokeFontXOffset" );
@@ -241,6 +244,7 @@ ADVANCED_CFG::ADVANCED_CFG()
     m_MaxTrackLengthToKeep      = 0.0005;
     m_ExtraZoneDisplayModes     = false;
     m_DrawTriangulationOutlines = false;
+    m_ShowFrameTimingHUD        = false;
 
     m_ExtraClearance            = 0.0005;
     m_EnableCreepageSlot        = false;
@@ -257,6 +261,8 @@ ADVANCED_CFG::ADVANCED_CFG()
     m_MinPlotPenWidth           = 0.0212;   // 1 pixel at 1200dpi.
 
     m_DebugZoneFiller           = false;
+    m_EnableDRCPairCache        = false;
+    m_EnableTriangulationCache  = false;
     m_DebugPDFWriter            = false;
     m_PDFStrokeFontWidthFactor  = .12; // default 12% of EM
     m_PDFStrokeFontXOffset      = 0.1;
@@ -473,6 +479,10 @@ void ADVANCED_CFG::loadSettings( wxConfigBase& aCfg )
                                                 &m_DrawTriangulationOutlines,
                                                 m_DrawTriangulationOutlines ) );
 
+    m_entries.push_back( std::make_unique<PARAM_CFG_BOOL>( true, AC_KEYS::ShowFrameTimingHUD,
+                                                &m_ShowFrameTimingHUD,
+                                                m_ShowFrameTimingHUD ) );
+
     m_entries.push_back( std::make_unique<PARAM_CFG_DOUBLE>( true, AC_KEYS::MinPlotPenWidth,
                                                   &m_MinPlotPenWidth, m_MinPlotPenWidth,
                                                   0.0, 1.0 ) );
@@ -480,6 +490,13 @@ void ADVANCED_CFG::loadSettings( wxConfigBase& aCfg )
     m_entries.push_back( std::make_unique<PARAM_CFG_BOOL>( true, AC_KEYS::DebugZoneFiller,
                                                 &m_DebugZoneFiller, m_DebugZoneFiller ) );
 
+    m_entries.push_back( std::make_unique<PARAM_CFG_BOOL>( true, AC_KEYS::EnableDRCPairCache,
+                                                &m_EnableDRCPairCache, m_EnableDRCPairCache ) );
+
+    m_entries.push_back( std::make_unique<PARAM_CFG_BOOL>( true, AC_KEYS::EnableTriangulationCache,
+                                                &m_EnableTriangulationCache,
+                                                m_EnableTriangulationCache ) );
+
     m_entries.push_back( std::make_unique<PARAM_CFG_BOOL>( true, AC_KEYS::DebugPDFWriter,
                                                 &m_DebugPDFWriter, m_DebugPDFWriter ) );
 
@@ -32,6 +32,7 @@
 #endif
 
 #include <wx/file.h>
+#include <wx/filefn.h>
 #include <wx/filename.h>
 #include <wx/utils.h>
 #include <wx/tokenzr.h>
@@ -365,16 +366,14 @@ std::pair<bool, std::string> AI_BACKEND_CLIENT::syncKicadToTrace( const std::str
 std::optional<AI_BACKEND_EVENT> AI_BACKEND_CLIENT::parseSSEEvent( const std::string& aLine )
 {
     // SSE format: "data: {json}"
-    if( aLine.substr( 0, 6 ) != "data: " )
+    if( aLine.compare( 0, 6, "data: " ) != 0 )
     {
         return std::nullopt;
     }
 
-    std::string jsonStr = aLine.substr( 6 );
-
     try
     {
-        nlohmann::json json = nlohmann::json::parse( jsonStr );
+        nlohmann::json json = nlohmann::json::parse( aLine.begin() + 6, aLine.end() );
         AI_BACKEND_EVENT event;
 
         std::string eventType = json.value( "type", "" );
@@ -593,21 +592,63 @@ AI_STREAM_RESULT AI_BACKEND_CLIENT::StreamChat( const std::string& aMessage,
             }
         }
 
-        // Read file content for context
-        std::ifstream file( aFilePath );
-        if( file.is_open() )
+        // Read file content for context.  The serialized design is cached and
+        // reused while the file on disk is unchanged; an edit (from a tool
+        // call or a user save) bumps the mtime and the next request
+        // re-serializes, so this prep cost is only paid when the design
+        // actually changed.
+        std::string content;
+        int         lineCount = 0;
+        bool        haveContent = false;
+
+        wxStructStat st;
+
+        if( wxStat( wxString::FromUTF8( aFilePath ), &st ) == 0 )
         {
-            std::stringstream buffer;
-            buffer << file.rdbuf();
-            std::string content = buffer.str();
+            std::lock_guard<std::mutex> lock( m_contextCacheMutex );
 
-            // Count lines
-            int lineCount = 0;
-            for( char c : content )
+            if( m_contextCache.path == aFilePath
+                    && m_contextCache.mtime == static_cast<long long>( st.st_mtime )
+                    && m_contextCache.size == static_cast<long long>( st.st_size ) )
             {
-                if( c == '\n' )
-                    lineCount++;
+                content = m_contextCache.content;
+                lineCount = m_contextCache.lineCount;
+                haveContent = true;
             }
+        }
+
+        if( !haveContent )
+        {
+            std::ifstream file( aFilePath );
+            if( file.is_open() )
+            {
+                std::stringstream buffer;
+                buffer << file.rdbuf();
+                content = buffer.str();
+
+                // Count lines
+                for( char c : content )
+                {
+                    if( c == '\n' )
+                        lineCount++;
+                }
+
+                haveContent = true;
+
+                if( wxStat( wxString::FromUTF8( aFilePath ), &st ) == 0 )
+                {
+                    std::lock_guard<std::mutex> lock( m_contextCacheMutex );
+                    m_contextCache.path = aFilePath;
+                    m_contextCache.mtime = static_cast<long long>( st.st_mtime );
+                    m_contextCache.size = static_cast<long long>( st.st_size );
+                    m_contextCache.lineCount = lineCount;
+                    m_contextCache.content = content;
+                }
+            }
+        }
+
+        if( haveContent )
+        {
             payload["total_lines"] = lineCount;
 
             // Send trace file content directly
@@ -654,7 +695,7 @@ AI_STREAM_RESULT AI_BACKEND_CLIENT::StreamChat( const std::string& aMessage,
             return;
         }
 
-        AI_BACKEND_EVENT event = *eventOpt;
+        AI_BACKEND_EVENT& event = *eventOpt;
         result.eventCount++;  // Track event count for debugging
 
         // Accumulate text deltas
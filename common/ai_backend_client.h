@@ -26,6 +26,7 @@
 #include <functional>
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <utility>
 #include <nlohmann/json.hpp>
@@ -301,11 +302,32 @@ private:
                                                     const std::string& aTraceFilePath,
                                                     const std::string& aAppType );
 
+    /**
+     * Cached serialized design context for prompt assembly.
+     *
+     * Trace files grow to several megabytes on dense designs, and re-reading
+     * and re-counting one for every request adds noticeable client-side prep
+     * to each assistant round-trip.  An entry is validated against the file's
+     * modification time and size, so a tool edit or user save invalidates it
+     * and the next request re-serializes only then.
+     */
+    struct DESIGN_CONTEXT_CACHE
+    {
+        std::string path;          ///< Trace file path this entry describes
+        long long   mtime = 0;     ///< File modification time when cached
+        long long   size = -1;     ///< File size in bytes when cached
+        int         lineCount = 0; ///< Pre-computed line count of the content
+        std::string content;       ///< Full serialized design content
+    };
+
     std::string              m_backendUrl;
     AI_TOOL_EXECUTOR*        m_toolExecutor;
     std::atomic<bool>        m_isStreaming;
     std::atomic<bool>        m_stopRequested;
 
+    DESIGN_CONTEXT_CACHE     m_contextCache;
+    std::mutex               m_contextCacheMutex;
+
     std::function<void( const AI_BACKEND_EVENT& )> m_eventCallback;
 };
 
@@ -22,10 +22,36 @@
 #include <sstream>
 #include <algorithm>
 #include <cmath>
+#include <list>
+#include <mutex>
 #include <regex>
 #include <iostream>
 
 
+namespace
+{
+
+/*
+ * The analyzer is constructed fresh for every tool edit, but consecutive edits diff
+ * old against new contents where the old side is usually the previous edit's new
+ * side.  Cache the few most recently parsed contents keyed by content hash so a
+ * typical edit only pays to parse the text that actually changed, instead of
+ * re-parsing the whole design twice per tool action.
+ */
+struct PARSE_CACHE_ENTRY
+{
+    size_t                               hash;
+    std::map<std::string, TRACE_ELEMENT> elements;
+};
+
+std::mutex                   s_parseCacheMutex;
+std::list<PARSE_CACHE_ENTRY> s_parseCache;      // most recently used first
+
+constexpr size_t PARSE_CACHE_MAX = 8;
+
+} // namespace
+
+
 std::string TRACE_ELEMENT::GetKey() const
 {
     // Use uid if available
@@ -416,27 +442,54 @@ DIFF_RESULT AI_DIFF_ANALYZER::AnalyzeFileDiff( const std::string& aOldContent,
 
     try
     {
-        // Parse both contents
-        auto oldElements = ParseTraceSchContent( aOldContent );
-        auto newElements = ParseTraceSchContent( aNewContent );
-
-        // Build maps by key
-        std::map<std::string, TRACE_ELEMENT> oldMap;
-        std::map<std::string, TRACE_ELEMENT> newMap;
+        std::hash<std::string> hasher;
+        size_t                 oldHash = hasher( aOldContent );
+        size_t                 newHash = hasher( aNewContent );
 
-        for( const auto& elem : oldElements )
+        // Identical contents: nothing to parse or compare
+        if( oldHash == newHash && aOldContent == aNewContent )
         {
-            std::string key = elem.GetKey();
-            if( !key.empty() )
-                oldMap[key] = elem;
+            ClassifyComplexity( result );
+            return result;
         }
 
-        for( const auto& elem : newElements )
+        // Parse both contents, reusing cached parses where possible
+        auto buildMap = [this, &hasher]( const std::string& aContent, size_t aHash )
         {
-            std::string key = elem.GetKey();
-            if( !key.empty() )
-                newMap[key] = elem;
-        }
+            {
+                std::lock_guard<std::mutex> lock( s_parseCacheMutex );
+
+                for( auto it = s_parseCache.begin(); it != s_parseCache.end(); ++it )
+                {
+                    if( it->hash == aHash )
+                    {
+                        s_parseCache.splice( s_parseCache.begin(), s_parseCache, it );
+                        return s_parseCache.front().elements;
+                    }
+                }
+            }
+
+            std::map<std::string, TRACE_ELEMENT> map;
+
+            for( const auto& elem : ParseTraceSchContent( aContent ) )
+            {
+                std::string key = elem.GetKey();
+                if( !key.empty() )
+                    map[key] = elem;
+            }
+
+            std::lock_guard<std::mutex> lock( s_parseCacheMutex );
+
+            s_parseCache.push_front( { aHash, map } );
+
+            while( s_parseCache.size() > PARSE_CACHE_MAX )
+                s_parseCache.pop_back();
+
+            return map;
+        };
+
+        std::map<std::string, TRACE_ELEMENT> oldMap = buildMap( aOldContent, oldHash );
+        std::map<std::string, TRACE_ELEMENT> newMap = buildMap( aNewContent, newHash );
 
         // Find added elements (in new but not in old)
         for( const auto& [key, elem] : newMap )
@@ -458,6 +511,10 @@ DIFF_RESULT AI_DIFF_ANALYZER::AnalyzeFileDiff( const std::string& aOldContent,
             auto it = newMap.find( key );
             if( it != newMap.end() )
             {
+                // Identical source lines cannot differ once parsed
+                if( oldElem.rawContent == it->second.rawContent )
+                    continue;
+
                 if( !oldElem.Equals( it->second ) )
                 {
                     ELEMENT_MODIFICATION mod;
@@ -18,6 +18,7 @@
  */
 
 #include "ai_tool_executor.h"
+#include <perf_counters.h>
 #include <python_manager.h>
 #include <paths.h>
 #include <pgm_base.h>
@@ -511,6 +512,10 @@ AI_TOOL_RESULT AI_TOOL_EXECUTOR::ExecuteTool( const std::string&    aToolName,
         {
             return executeRunErc( aToolArgs, aKicadFilePath );
         }
+        else if( aToolName == "get_perf_counters" )
+        {
+            return executeGetPerfCounters( aToolArgs );
+        }
         else if( aToolName == "run_annotate" || aToolName == "annotate_schematic" )
         {
             return executeRunAnnotate( aToolArgs, aKicadFilePath );
@@ -731,16 +736,27 @@ AI_TOOL_RESULT AI_TOOL_EXECUTOR::executeWrite( const nlohmann::json& aArgs,
     
     if( ext == "trace_sch" || ext == "trace_pcb" )
     {
-        CONVERSION_RESULT convResult = syncTraceToKicad( resolvedPath, kicadPath );
-        result.conversionLogs = convResult.output;
-        
-        if( convResult.success )
+        // Queue the conversion instead of paying a synchronous Python round trip per
+        // tool call; a burst of edits collapses into one conversion per touched file
+        // once the debounce window closes (stream end force-flushes the queue).
+        queueConversion( resolvedPath, kicadPath );
+        bool converted = flushPendingConversion( false );
+
+        if( m_conversionPending.load() )
         {
+            result.result = "File written successfully. Conversion batched with pending edits.";
+        }
+        else if( converted )
+        {
+            std::lock_guard<std::mutex> lock( m_conversionResultMutex );
+            result.conversionLogs = m_lastConversionOutput;
             result.result = "File written successfully. Conversion completed.";
         }
         else
         {
-            result.result = "File written, but conversion failed: " + convResult.errorMessage;
+            std::lock_guard<std::mutex> lock( m_conversionResultMutex );
+            result.conversionLogs = m_lastConversionOutput;
+            result.result = "File written, but conversion failed: " + m_lastConversionError;
             result.success = false;
         }
     }
@@ -898,18 +914,29 @@ AI_TOOL_RESULT AI_TOOL_EXECUTOR::executeSearchReplace( const nlohmann::json& aAr
     
     if( !kicadPath.empty() )
     {
-        CONVERSION_RESULT convResult = syncTraceToKicad( resolvedPath, kicadPath );
-        result.conversionLogs = convResult.output;
-        
+        // Batched like executeWrite: rapid edits share one conversion per file
+        queueConversion( resolvedPath, kicadPath );
+        bool converted = flushPendingConversion( false );
+
         std::string countMsg = replaceAll ? " (" + std::to_string( count ) + " occurrences)" : "";
-        
-        if( convResult.success )
+
+        if( m_conversionPending.load() )
+        {
+            result.result = "Replacement successful" + countMsg
+                            + ". Conversion batched with pending edits.";
+        }
+        else if( converted )
         {
+            std::lock_guard<std::mutex> lock( m_conversionResultMutex );
+            result.conversionLogs = m_lastConversionOutput;
             result.result = "Replacement successful" + countMsg + ". Conversion completed.";
         }
         else
         {
-            result.result = "Replacement successful" + countMsg + ", but conversion failed: " + convResult.errorMessage;
+            std::lock_guard<std::mutex> lock( m_conversionResultMutex );
+            result.conversionLogs = m_lastConversionOutput;
+            result.result = "Replacement successful" + countMsg + ", but conversion failed: "
+                            + m_lastConversionError;
             result.success = false;
         }
     }
@@ -1813,6 +1840,17 @@ AI_TOOL_RESULT AI_TOOL_EXECUTOR::executeRunErc( const nlohmann::json& aArgs,
 }
 
 
+AI_TOOL_RESULT AI_TOOL_EXECUTOR::executeGetPerfCounters( const nlohmann::json& aArgs )
+{
+    nlohmann::json response = PERF_COUNTERS::Get().ExportJson();
+
+    if( aArgs.contains( "reset" ) && aArgs["reset"].is_boolean() && aArgs["reset"].get<bool>() )
+        PERF_COUNTERS::Get().Reset();
+
+    return AI_TOOL_RESULT( response.dump( 2 ), false, true );
+}
+
+
 AI_TOOL_RESULT AI_TOOL_EXECUTOR::executeRunAnnotate( const nlohmann::json& aArgs,
                                                        const std::string&    aKicadFilePath )
 {
@@ -2187,71 +2225,86 @@ void AI_TOOL_EXECUTOR::queueConversion( const std::string& aTraceFilePath,
                                         const std::string& aKicadFilePath )
 {
     std::lock_guard<std::mutex> lock( m_conversionMutex );
-    
-    // Update pending conversion (last request wins)
-    m_pendingConversionTrace = aTraceFilePath;
-    m_pendingConversionKicad = aKicadFilePath;
+
+    // One pending entry per trace file; a repeat edit just refreshes it
+    auto it = std::find_if( m_pendingConversions.begin(), m_pendingConversions.end(),
+                            [&]( const auto& aPair )
+                            {
+                                return aPair.first == aTraceFilePath;
+                            } );
+
+    if( it != m_pendingConversions.end() )
+        it->second = aKicadFilePath;
+    else
+        m_pendingConversions.emplace_back( aTraceFilePath, aKicadFilePath );
+
     m_conversionPending.store( true );
     m_lastConversionRequest = std::chrono::steady_clock::now();
-    
 }
 
 
 bool AI_TOOL_EXECUTOR::flushPendingConversion( bool force )
 {
-    std::lock_guard<std::mutex> lock( m_conversionMutex );
-    
-    if( !m_conversionPending.load() )
-        return false; // Nothing queued
-    
-    // Check if debounce period has elapsed (unless forced)
-    if( !force )
+    std::vector<std::pair<std::string, std::string>> pending;
+
     {
-        auto now = std::chrono::steady_clock::now();
-        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-                           now - m_lastConversionRequest ).count();
-        
-        if( elapsed < CONVERSION_DEBOUNCE_MS )
+        std::lock_guard<std::mutex> lock( m_conversionMutex );
+
+        if( !m_conversionPending.load() )
+            return false; // Nothing queued
+
+        // Check if debounce period has elapsed (unless forced)
+        if( !force )
         {
-            // Still within debounce window - wait for more edits
-            return false;
+            auto now = std::chrono::steady_clock::now();
+            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                               now - m_lastConversionRequest ).count();
+
+            if( elapsed < CONVERSION_DEBOUNCE_MS )
+            {
+                // Still within debounce window - wait for more edits
+                return false;
+            }
         }
+
+        // Take ownership of the queue and clear the pending flag before converting
+        // (prevents re-entry)
+        pending = std::move( m_pendingConversions );
+        m_pendingConversions.clear();
+        m_conversionPending.store( false );
     }
-    else
+
+    // Execute conversions outside the lock (slow Python calls); one conversion per
+    // touched file no matter how many edits were queued against it
+    bool        allSucceeded = true;
+    std::string firstError;
+    std::string output;
+
+    for( const auto& [tracePath, kicadPath] : pending )
     {
-        // Force flushing pending conversion (bypassing debounce)
+        CONVERSION_RESULT convResult = syncTraceToKicad( tracePath, kicadPath );
+
+        if( !output.empty() )
+            output += "\n";
+
+        output += convResult.output;
+
+        if( !convResult.success && allSucceeded )
+        {
+            allSucceeded = false;
+            firstError = convResult.errorMessage;
+        }
     }
-    
-    std::string tracePath = m_pendingConversionTrace;
-    std::string kicadPath = m_pendingConversionKicad;
-    
-    // Clear pending flag before conversion (prevents re-entry)
-    m_conversionPending.store( false );
-    m_pendingConversionTrace.clear();
-    m_pendingConversionKicad.clear();
-    
-    // Execute conversion (unlock during slow Python call to avoid blocking other operations)
-    m_conversionMutex.unlock();
-    CONVERSION_RESULT convResult = syncTraceToKicad( tracePath, kicadPath );
-    m_conversionMutex.lock();
-    
+
     // Track conversion result for later querying
-    m_lastConversionSucceeded.store( convResult.success );
+    m_lastConversionSucceeded.store( allSucceeded );
     {
         std::lock_guard<std::mutex> resultLock( m_conversionResultMutex );
-        m_lastConversionError = convResult.success ? "" : convResult.errorMessage;
-    }
-    
-    if( convResult.success )
-    {
-        // Conversion successful
+        m_lastConversionError = allSucceeded ? "" : firstError;
+        m_lastConversionOutput = output;
     }
-    else
-    {
-        // Conversion failed
-    }
-    
-    return convResult.success;
+
+    return allSucceeded;
 }
 
 
@@ -370,6 +370,14 @@ private:
      */
     AI_TOOL_RESULT executeRunErc( const nlohmann::json& aArgs, const std::string& aKicadFilePath );
 
+    /**
+     * Execute get_perf_counters tool.
+     * Exports the session's accumulated performance counters (fill/DRC/save/frame timings).
+     * @param aArgs Tool arguments (pass "reset": true to clear after export).
+     * @return JSON object of counters and duration histograms.
+     */
+    AI_TOOL_RESULT executeGetPerfCounters( const nlohmann::json& aArgs );
+
     /**
      * Execute run_annotate tool.
      * Runs annotation and returns result messages from schematic editor.
@@ -559,15 +567,19 @@ private:
     // Conversion debouncing (prevent memory spikes from rapid tool calls)
     std::mutex                   m_conversionMutex;        ///< Protects conversion queue
     std::atomic<bool>            m_conversionPending;      ///< True if conversion queued
-    std::string                  m_pendingConversionTrace; ///< Queued trace file path
-    std::string                  m_pendingConversionKicad; ///< Queued KiCad file path
+
+    /// Queued (trace, kicad) path pairs in first-edit order; repeat edits to the
+    /// same trace file collapse into its existing entry
+    std::vector<std::pair<std::string, std::string>> m_pendingConversions;
+
     std::chrono::steady_clock::time_point m_lastConversionRequest; ///< Time of last request
     static constexpr int         CONVERSION_DEBOUNCE_MS = 200; ///< Debounce delay
-    
+
     // Conversion result tracking
     std::atomic<bool>            m_lastConversionSucceeded; ///< True if last conversion succeeded
     std::string                  m_lastConversionError;     ///< Error message from last failed conversion
-    mutable std::mutex           m_conversionResultMutex;   ///< Protects m_lastConversionError
+    std::string                  m_lastConversionOutput;    ///< Output from the last flushed conversion batch
+    mutable std::mutex           m_conversionResultMutex;   ///< Protects m_lastConversionError/Output
     
     // Modified symbol tracking for autoplace
     std::set<std::string>        m_modifiedSymbolUUIDs;     ///< UUIDs of symbols modified in this session
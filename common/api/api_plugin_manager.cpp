@@ -23,6 +23,8 @@
 #include <env_vars.h>
 #include <fmt/format.h>
 #include <wx/dir.h>
+#include <wx/ffile.h>
+#include <wx/filefn.h>
 #include <wx/log.h>
 #include <wx/timer.h>
 #include <wx/utils.h>
@@ -42,6 +44,35 @@ wxDEFINE_EVENT( EDA_EVT_PLUGIN_MANAGER_JOB_FINISHED, wxCommandEvent );
 wxDEFINE_EVENT( EDA_EVT_PLUGIN_AVAILABILITY_CHANGED, wxCommandEvent );
 
 
+namespace
+{
+
+/**
+ * Build a content signature for a plugin's requirements.txt, used to decide whether the
+ * dependencies already installed in an environment are still up to date.
+ */
+wxString requirementsSignature( const wxFileName& aRequirements )
+{
+    wxStructStat fileStat;
+
+    if( wxStat( aRequirements.GetFullPath(), &fileStat ) != 0 )
+        return wxEmptyString;
+
+    return wxString::Format( wxS( "%lld:%lld" ),
+                             static_cast<long long>( fileStat.st_mtime ),
+                             static_cast<long long>( fileStat.st_size ) );
+}
+
+
+/// The stamp file recording the requirements signature of the last successful install
+wxFileName requirementsStampFile( const wxString& aEnvPath )
+{
+    return wxFileName( aEnvPath, wxS( "kicad-requirements.stamp" ) );
+}
+
+} // namespace
+
+
 API_PLUGIN_MANAGER::API_PLUGIN_MANAGER( wxEvtHandler* aEvtHandler ) :
         wxEvtHandler(),
         m_parent( aEvtHandler ),
@@ -431,6 +462,30 @@ void API_PLUGIN_MANAGER::processPluginDependencies()
             wxLogTrace( traceApi, wxString::Format( "Manager: Python env for %s exists at %s",
                                                     plugin->Identifier(),
                                                     envConfigPath.GetPath() ) );
+
+            // If the requirements haven't changed since the last successful install, the
+            // environment is already good to go: don't pay for a pip run at every startup.
+            wxFileName requirements( plugin->BasePath(), wxS( "requirements.txt" ) );
+            wxString   signature = requirementsSignature( requirements );
+            wxFileName stamp = requirementsStampFile( envConfigPath.GetPath() );
+
+            if( !signature.IsEmpty() && stamp.IsFileReadable() )
+            {
+                wxFFile  stampFile( stamp.GetFullPath(), wxS( "r" ) );
+                wxString stored;
+
+                if( stampFile.IsOpened() && stampFile.ReadAll( &stored ) && stored == signature )
+                {
+                    wxLogTrace( traceApi,
+                                wxString::Format( "Manager: %s dependencies unchanged; "
+                                                  "skipping install",
+                                                  plugin->Identifier() ) );
+                    m_readyPlugins.insert( plugin->Identifier() );
+                    m_busyPlugins.erase( plugin->Identifier() );
+                    continue;
+                }
+            }
+
             JOB job;
             job.type = JOB_TYPE::INSTALL_REQUIREMENTS;
             job.identifier = plugin->Identifier();
@@ -654,6 +709,21 @@ void API_PLUGIN_MANAGER::processNextJob( wxCommandEvent& aEvent )
                                                                 job.identifier ) );
                         m_readyPlugins.insert( job.identifier );
                         m_busyPlugins.erase( job.identifier );
+
+                        // Record the requirements signature so the next startup can skip pip
+                        // when nothing has changed
+                        wxFileName reqs( job.plugin_path, wxS( "requirements.txt" ) );
+                        wxString   signature = requirementsSignature( reqs );
+
+                        if( !signature.IsEmpty() )
+                        {
+                            wxFFile stampFile(
+                                    requirementsStampFile( job.env_path ).GetFullPath(),
+                                    wxS( "w" ) );
+
+                            if( stampFile.IsOpened() )
+                                stampFile.Write( signature );
+                        }
                         wxCommandEvent* availabilityEvt =
                                 new wxCommandEvent( EDA_EVT_PLUGIN_AVAILABILITY_CHANGED, wxID_ANY );
                         wxTheApp->QueueEvent( availabilityEvt );
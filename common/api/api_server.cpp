@@ -128,6 +128,19 @@ void KICAD_API_SERVER::Start()
             fmt::format( "ipc://{}", socket.GetFullPath().ToStdString() ) );
     m_server->SetCallback( [&]( std::string* aRequest ) { onApiRequest( aRequest ); } );
 
+    // Change events are pushed over a pub/sub socket next to the request socket, so clients
+    // that only want notifications never contend with the request/reply channel.
+    wxFileName eventSocket( socket );
+    eventSocket.SetName( socket.GetName() + wxS( ".events" ) );
+
+    // We own the corresponding request socket name at this point, so any leftover event
+    // socket with this name is orphaned and can be removed.
+    if( eventSocket.Exists() )
+        wxRemoveFile( eventSocket.GetFullPath() );
+
+    m_eventServer = std::make_unique<KINNG_PUBLISH_SERVER>(
+            fmt::format( "ipc://{}", eventSocket.GetFullPath().ToStdString() ) );
+
     m_logFilePath.AssignDir( PATHS::GetLogsPath() );
     m_logFilePath.SetName( s_logFileName );
 
@@ -151,6 +164,12 @@ void KICAD_API_SERVER::Stop()
     wxLogTrace( traceApi, "Stopping server" );
     Unbind( API_REQUEST_EVENT, &KICAD_API_SERVER::handleApiEvent, this );
 
+    if( m_eventServer )
+    {
+        m_eventServer->Stop();
+        m_eventServer.reset( nullptr );
+    }
+
     m_server->Stop();
     m_server.reset( nullptr );
 }
@@ -181,6 +200,30 @@ std::string KICAD_API_SERVER::SocketPath() const
 }
 
 
+void KICAD_API_SERVER::Publish( const std::string& aEvent )
+{
+    if( !m_eventServer )
+        return;
+
+    m_eventServer->Publish( aEvent );
+
+    if( ADVANCED_CFG::GetCfg().m_EnableAPILogging )
+        log( "Event: " + aEvent );
+}
+
+
+bool KICAD_API_SERVER::Publishing() const
+{
+    return m_eventServer && m_eventServer->Running();
+}
+
+
+std::string KICAD_API_SERVER::EventSocketPath() const
+{
+    return m_eventServer ? m_eventServer->SocketPath() : "";
+}
+
+
 void KICAD_API_SERVER::onApiRequest( std::string* aRequest )
 {
     if( !m_readyToReply )
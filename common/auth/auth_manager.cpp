@@ -32,6 +32,7 @@
 #include <wx/msgdlg.h>
 #include <nlohmann/json.hpp>
 #include <kiplatform/secrets.h>
+#include <thread>
 
 #if defined( __WXMSW__ )
 #include <wx/msw/registry.h>
@@ -71,7 +72,8 @@ AUTH_MANAGER::AUTH_MANAGER() :
         m_callbackServer( nullptr ),
         m_callbackPort( 0 ),
         m_waitingForCallback( false ),
-        m_lastFailedRefreshAt( 0 )
+        m_lastFailedRefreshAt( 0 ),
+        m_refreshInFlight( false )
 {
 }
 
@@ -891,13 +893,23 @@ int AUTH_MANAGER::findAvailablePort()
 
 bool AUTH_MANAGER::RefreshAccessToken()
 {
+    // Serialize refreshes: a caller that arrives while another thread is already
+    // refreshing blocks here, then finds a fresh token below instead of issuing
+    // a second network request.
+    std::lock_guard<std::mutex> refreshLock( m_refreshMutex );
+
+    if( !IsTokenExpired() && !IsTokenExpiringSoon() )
+        return true;  // Refreshed by another caller while we waited
+
+    wxString refreshToken = GetRefreshToken();
+
     // If no refresh token, can't refresh
-    if( m_refreshToken.IsEmpty() )
+    if( refreshToken.IsEmpty() )
     {
         wxLogDebug( wxT( "No refresh token available" ) );
         return false;
     }
-    
+
     try
     {
         // Get backend URL from environment variable (overrides build default)
@@ -919,9 +931,9 @@ bool AUTH_MANAGER::RefreshAccessToken()
         }
         
         // Build JSON request body
-        wxString jsonBody = wxString::Format( 
+        wxString jsonBody = wxString::Format(
             wxT( "{\"refresh_token\":\"%s\"}" ),
-            m_refreshToken
+            refreshToken
         );
         
         // Make HTTP POST request to /auth/refresh using CURL (supports HTTPS)
@@ -998,23 +1010,31 @@ void AUTH_MANAGER::SetTokens( const wxString& aAccessToken, const wxString& aRef
     // Update access token
     if( !aAccessToken.IsEmpty() )
     {
-        m_token = aAccessToken;
+        {
+            std::lock_guard<std::mutex> lock( m_tokenMutex );
+            m_token = aAccessToken;
+
+            // Calculate absolute expiry time (current time + expires_in)
+            m_tokenExpiresAt = wxGetUTCTimeMillis() + (aExpiresIn * 1000LL);
+        }
+
         storeToken( aAccessToken );
-        
-        // Calculate absolute expiry time (current time + expires_in)
-        m_tokenExpiresAt = wxGetUTCTimeMillis() + (aExpiresIn * 1000LL);
-        
-        wxLogDebug( wxT( "Access token updated (length: %zu, expires in %d seconds)" ), 
+
+        wxLogDebug( wxT( "Access token updated (length: %zu, expires in %d seconds)" ),
                    aAccessToken.length(), aExpiresIn );
-        
+
         // Clear failed refresh timestamp on successful token update
         m_lastFailedRefreshAt = 0;
     }
-    
+
     // Update refresh token if provided
     if( !aRefreshToken.IsEmpty() )
     {
-        m_refreshToken = aRefreshToken;
+        {
+            std::lock_guard<std::mutex> lock( m_tokenMutex );
+            m_refreshToken = aRefreshToken;
+        }
+
         KIPLATFORM::SECRETS::StoreSecret( KEYCHAIN_SERVICE_NAME, KEYCHAIN_REFRESH_ACCOUNT_NAME, aRefreshToken );
         wxLogDebug( wxT( "Refresh token updated (length: %zu)" ), aRefreshToken.length() );
     }
@@ -1023,13 +1043,45 @@ void AUTH_MANAGER::SetTokens( const wxString& aAccessToken, const wxString& aRef
 
 bool AUTH_MANAGER::IsTokenExpiringSoon() const
 {
+    std::lock_guard<std::mutex> lock( m_tokenMutex );
+
     if( m_tokenExpiresAt == 0 )
         return false;  // No expiry info
-    
+
     // Token is expiring soon if less than 5 minutes remain
     wxLongLong now = wxGetUTCTimeMillis();
     wxLongLong fiveMinutes = 5 * 60 * 1000LL;
-    
+
     return (m_tokenExpiresAt - now) < fiveMinutes;
 }
 
+
+bool AUTH_MANAGER::IsTokenExpired() const
+{
+    std::lock_guard<std::mutex> lock( m_tokenMutex );
+
+    if( m_tokenExpiresAt == 0 )
+        return false;  // No expiry info
+
+    return m_tokenExpiresAt <= wxGetUTCTimeMillis();
+}
+
+
+void AUTH_MANAGER::RefreshAccessTokenAsync()
+{
+    if( !IsTokenExpired() && !IsTokenExpiringSoon() )
+        return;
+
+    // Coalesce concurrent callers into a single background refresh
+    bool expected = false;
+
+    if( !m_refreshInFlight.compare_exchange_strong( expected, true ) )
+        return;
+
+    std::thread( [this]()
+                 {
+                     RefreshAccessToken();
+                     m_refreshInFlight.store( false );
+                 } ).detach();
+}
+
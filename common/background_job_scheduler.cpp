@@ -0,0 +1,338 @@
+/*
+ * This program source code file is part of Trace, an AI-native PCB design application.
+ *
+ * Copyright The Trace Developers, see TRACE_AUTHORS.txt for contributors.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <background_job_scheduler.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+#include <background_jobs_monitor.h>
+
+using namespace std::chrono;
+
+
+/// How long running jobs stay paused after each piece of user input.
+static constexpr int64_t INTERACTION_HOLD_MS = 500;
+
+
+struct BACKGROUND_JOB_SCHEDULER::CORE
+{
+    CORE( BACKGROUND_JOBS_MONITOR& aMonitor ) :
+            m_monitor( aMonitor )
+    {
+    }
+
+    static int64_t nowMs()
+    {
+        return duration_cast<milliseconds>( steady_clock::now().time_since_epoch() ).count();
+    }
+
+    int64_t HoldRemainingMs() const
+    {
+        return m_lastActivityMs.load() + INTERACTION_HOLD_MS - nowMs();
+    }
+
+    /// Valid to touch only before Shutdown(); the scheduler (and thus the hold on the
+    /// monitor's lifetime) can be gone by the time an already-cancelled task drains.
+    BACKGROUND_JOBS_MONITOR& m_monitor;
+
+    std::mutex              m_mutex;
+    std::condition_variable m_cv;
+
+    std::atomic<int64_t>    m_lastActivityMs = INT64_MIN / 2;
+    std::atomic<bool>       m_shutdown = false;
+
+    /// All jobs not yet FINISHED/CANCELLED; guarded by m_mutex.
+    std::vector<std::shared_ptr<SCHEDULED_JOB>> m_live;
+
+    /// Jobs currently executing a work function; guarded by m_mutex.
+    int m_running = 0;
+};
+
+
+std::vector<std::shared_ptr<SCHEDULED_JOB>>
+BACKGROUND_JOB_SCHEDULER::finishJobLocked( const std::shared_ptr<CORE>& aCore,
+                                           const std::shared_ptr<SCHEDULED_JOB>& aJob )
+{
+    std::vector<std::shared_ptr<SCHEDULED_JOB>> ready;
+    std::vector<std::shared_ptr<SCHEDULED_JOB>> toFinish{ aJob };
+
+    while( !toFinish.empty() )
+    {
+        std::shared_ptr<SCHEDULED_JOB> job = toFinish.back();
+        toFinish.pop_back();
+
+        job->m_state.store( job->m_cancelled.load() ? SCHEDULED_JOB::STATE::CANCELLED
+                                                    : SCHEDULED_JOB::STATE::FINISHED );
+
+        // Release captured resources now; handles can be held indefinitely.
+        job->m_work = nullptr;
+
+        for( const std::shared_ptr<SCHEDULED_JOB>& dependent : job->m_dependents )
+        {
+            if( dependent->GetState() != SCHEDULED_JOB::STATE::PENDING )
+                continue;
+
+            if( job->m_cancelled.load() )
+            {
+                dependent->m_cancelled.store( true );
+                toFinish.push_back( dependent );
+            }
+            else if( --dependent->m_pendingDeps == 0 )
+            {
+                ready.push_back( dependent );
+            }
+        }
+
+        job->m_dependents.clear();
+
+        std::erase( aCore->m_live, job );
+    }
+
+    return ready;
+}
+
+
+void BACKGROUND_JOB_SCHEDULER::runJob( const std::shared_ptr<CORE>& aCore,
+                                       const std::shared_ptr<SCHEDULED_JOB>& aJob )
+{
+    if( !aJob->m_cancelled.load() && !aCore->m_shutdown.load() )
+    {
+        {
+            std::lock_guard<std::mutex> lock( aCore->m_mutex );
+            aJob->m_state.store( SCHEDULED_JOB::STATE::RUNNING );
+            aCore->m_running++;
+        }
+
+        aJob->m_monitorJob = aCore->m_monitor.Create( aJob->m_name );
+
+        BACKGROUND_JOB_WORK work( aCore, aJob );
+
+        try
+        {
+            aJob->m_work( work );
+        }
+        catch( ... )
+        {
+            // A background job must not take the application down; treat a throw as
+            // completion so dependents aren't stranded.
+        }
+
+        aCore->m_monitor.Remove( aJob->m_monitorJob );
+        aJob->m_monitorJob.reset();
+    }
+
+    std::vector<std::shared_ptr<SCHEDULED_JOB>> ready;
+
+    {
+        std::lock_guard<std::mutex> lock( aCore->m_mutex );
+
+        if( aJob->GetState() == SCHEDULED_JOB::STATE::RUNNING )
+            aCore->m_running--;
+
+        ready = finishJobLocked( aCore, aJob );
+    }
+
+    aCore->m_cv.notify_all();
+
+    for( const std::shared_ptr<SCHEDULED_JOB>& job : ready )
+        enqueueJob( aCore, job );
+}
+
+
+void BACKGROUND_JOB_SCHEDULER::enqueueJob( const std::shared_ptr<CORE>& aCore,
+                                           const std::shared_ptr<SCHEDULED_JOB>& aJob )
+{
+    GetKiCadThreadPool().detach_task(
+            [aCore, aJob]()
+            {
+                runJob( aCore, aJob );
+            },
+            aJob->m_priority );
+}
+
+
+bool BACKGROUND_JOB_WORK::KeepGoing() const
+{
+    BACKGROUND_JOB_SCHEDULER::CORE* core =
+            static_cast<BACKGROUND_JOB_SCHEDULER::CORE*>( m_core.get() );
+
+    while( !m_job->m_cancelled.load() && !core->m_shutdown.load() )
+    {
+        int64_t remainingMs = core->HoldRemainingMs();
+
+        if( remainingMs <= 0 )
+            return true;
+
+        // Sleep in short slices: the hold window extends with every new input event, and
+        // cancellation must still be noticed promptly.
+        std::unique_lock<std::mutex> lock( core->m_mutex );
+        core->m_cv.wait_for( lock, milliseconds( std::min<int64_t>( remainingMs, 100 ) ) );
+    }
+
+    return false;
+}
+
+
+bool BACKGROUND_JOB_WORK::IsCancelled() const
+{
+    return m_job->m_cancelled.load();
+}
+
+
+PROGRESS_REPORTER* BACKGROUND_JOB_WORK::Reporter() const
+{
+    return m_job->m_monitorJob ? m_job->m_monitorJob->m_reporter.get() : nullptr;
+}
+
+
+BACKGROUND_JOB_SCHEDULER::BACKGROUND_JOB_SCHEDULER( BACKGROUND_JOBS_MONITOR& aMonitor ) :
+        m_core( std::make_shared<CORE>( aMonitor ) )
+{
+}
+
+
+BACKGROUND_JOB_SCHEDULER::~BACKGROUND_JOB_SCHEDULER()
+{
+    m_core->m_shutdown.store( true );
+
+    CancelAll();
+
+    // Wait for running jobs to notice and unwind; queued-but-cancelled tasks will drain
+    // against the (still referenced) CORE without touching the monitor.
+    std::unique_lock<std::mutex> lock( m_core->m_mutex );
+
+    m_core->m_cv.wait( lock,
+            [&]()
+            {
+                return m_core->m_running == 0;
+            } );
+}
+
+
+std::shared_ptr<SCHEDULED_JOB>
+BACKGROUND_JOB_SCHEDULER::Submit( const wxString& aName, KICAD_TASK_PRIORITY aPriority,
+                                  std::function<void( BACKGROUND_JOB_WORK& )> aWork,
+                                  std::vector<std::shared_ptr<SCHEDULED_JOB>> aDependsOn )
+{
+    std::shared_ptr<SCHEDULED_JOB> job = std::make_shared<SCHEDULED_JOB>();
+
+    job->m_name = aName;
+    job->m_priority = aPriority;
+    job->m_work = std::move( aWork );
+
+    bool start = false;
+
+    {
+        std::lock_guard<std::mutex> lock( m_core->m_mutex );
+
+        for( const std::shared_ptr<SCHEDULED_JOB>& dep : aDependsOn )
+        {
+            if( !dep )
+                continue;
+
+            if( dep->IsCancelled() )
+            {
+                job->m_cancelled.store( true );
+                job->m_state.store( SCHEDULED_JOB::STATE::CANCELLED );
+                job->m_work = nullptr;
+                return job;
+            }
+
+            if( dep->GetState() == SCHEDULED_JOB::STATE::PENDING
+                    || dep->GetState() == SCHEDULED_JOB::STATE::RUNNING )
+            {
+                dep->m_dependents.push_back( job );
+                job->m_pendingDeps++;
+            }
+        }
+
+        m_core->m_live.push_back( job );
+        start = ( job->m_pendingDeps == 0 );
+    }
+
+    if( start )
+        enqueueJob( m_core, job );
+
+    return job;
+}
+
+
+void BACKGROUND_JOB_SCHEDULER::Cancel( const std::shared_ptr<SCHEDULED_JOB>& aJob )
+{
+    if( !aJob )
+        return;
+
+    std::vector<std::shared_ptr<SCHEDULED_JOB>> toDrop;
+
+    {
+        std::lock_guard<std::mutex> lock( m_core->m_mutex );
+
+        aJob->m_cancelled.store( true );
+
+        if( aJob->m_monitorJob && aJob->m_monitorJob->m_reporter )
+            aJob->m_monitorJob->m_reporter->Cancel();
+
+        // A still-pending job will never reach runJob()'s cleanup path with its own worker,
+        // so retire it (and its dependents) here.
+        if( aJob->GetState() == SCHEDULED_JOB::STATE::PENDING )
+            finishJobLocked( m_core, aJob );
+    }
+
+    m_core->m_cv.notify_all();
+}
+
+
+void BACKGROUND_JOB_SCHEDULER::CancelAll()
+{
+    std::vector<std::shared_ptr<SCHEDULED_JOB>> live;
+
+    {
+        std::lock_guard<std::mutex> lock( m_core->m_mutex );
+        live = m_core->m_live;
+    }
+
+    for( const std::shared_ptr<SCHEDULED_JOB>& job : live )
+        Cancel( job );
+}
+
+
+void BACKGROUND_JOB_SCHEDULER::Wait( const std::shared_ptr<SCHEDULED_JOB>& aJob )
+{
+    if( !aJob )
+        return;
+
+    std::unique_lock<std::mutex> lock( m_core->m_mutex );
+
+    m_core->m_cv.wait( lock,
+            [&]()
+            {
+                return aJob->GetState() == SCHEDULED_JOB::STATE::FINISHED
+                        || aJob->GetState() == SCHEDULED_JOB::STATE::CANCELLED;
+            } );
+}
+
+
+void BACKGROUND_JOB_SCHEDULER::NotifyUserActivity()
+{
+    m_core->m_lastActivityMs.store( CORE::nowMs() );
+}
@@ -40,7 +40,11 @@ void CALLBACK_GAL::DrawGlyph( const KIFONT::GLYPH& aGlyph, int aNth, int aTotal
         {
             for( size_t ii = 1; ii < pointList.size(); ii++ )
             {
-                if( m_stroke )
+                if( m_buffered )
+                {
+                    m_segBuffer.emplace_back( pointList[ ii - 1 ], pointList[ ii ] );
+                }
+                else if( m_stroke )
                 {
                     m_strokeCallback( pointList[ ii - 1 ], pointList[ ii ] );
                 }
@@ -60,7 +64,29 @@ void CALLBACK_GAL::DrawGlyph( const KIFONT::GLYPH& aGlyph, int aNth, int aTotal
     }
     else if( aGlyph.IsOutline() )
     {
-        if( m_triangulate )
+        if( m_buffered )
+        {
+            const KIFONT::OUTLINE_GLYPH& glyph = static_cast<const KIFONT::OUTLINE_GLYPH&>( aGlyph );
+
+            const_cast<KIFONT::OUTLINE_GLYPH&>( glyph ).CacheTriangulation( false );
+
+            // Copy the triangle soup straight out of the triangulation data rather than going
+            // through the per-triangle callback in OUTLINE_GLYPH::Triangulate().
+            for( unsigned int ii = 0; ii < glyph.TriangulatedPolyCount(); ii++ )
+            {
+                const SHAPE_POLY_SET::TRIANGULATED_POLYGON* polygon = glyph.TriangulatedPolygon( ii );
+
+                for( size_t jj = 0; jj < polygon->GetTriangleCount(); jj++ )
+                {
+                    VECTOR2I a, b, c;
+                    polygon->GetTriangle( jj, a, b, c );
+                    m_triBuffer.push_back( a );
+                    m_triBuffer.push_back( b );
+                    m_triBuffer.push_back( c );
+                }
+            }
+        }
+        else if( m_triangulate )
         {
             const KIFONT::OUTLINE_GLYPH& glyph = static_cast<const KIFONT::OUTLINE_GLYPH&>( aGlyph );
 
@@ -77,6 +103,25 @@ void CALLBACK_GAL::DrawGlyph( const KIFONT::GLYPH& aGlyph, int aNth, int aTotal
                 m_outlineCallback( glyph.Outline( ii ) );
         }
     }
+
+    if( m_buffered && aNth == aTotal - 1 )
+        flushBatches();
+}
+
+
+void CALLBACK_GAL::flushBatches()
+{
+    if( !m_segBuffer.empty() )
+    {
+        m_strokeBatchCallback( m_segBuffer );
+        m_segBuffer.clear();
+    }
+
+    if( !m_triBuffer.empty() )
+    {
+        m_triangleBatchCallback( m_triBuffer );
+        m_triBuffer.clear();
+    }
 }
 
 
@@ -135,7 +135,7 @@ COMMIT& COMMIT::Stage( const PICKED_ITEMS_LIST &aItems, UNDO_REDO aModFlag, BASE
 
 void COMMIT::Unstage( EDA_ITEM* aItem, BASE_SCREEN* aScreen )
 {
-    std::erase_if( m_entries,
+    size_t count = std::erase_if( m_entries,
                    [&]( COMMIT_LINE& line )
                    {
                        if( line.m_item == aItem && line.m_screen == aScreen )
@@ -150,6 +150,15 @@ void COMMIT::Unstage( EDA_ITEM* aItem, BASE_SCREEN* aScreen )
 
                        return false;
                    } );
+
+    // Erasing shifts the remaining entries; rebuild the lookup index (unstaging is rare)
+    if( count )
+    {
+        m_entryIndex.clear();
+
+        for( size_t ii = 0; ii < m_entries.size(); ++ii )
+            m_entryIndex.try_emplace( { m_entries[ii].m_item, m_entries[ii].m_screen }, ii );
+    }
 }
 
 
@@ -192,17 +201,17 @@ void COMMIT::makeEntry( EDA_ITEM* aItem, CHANGE_TYPE aType, EDA_ITEM* aCopy, BAS
     default:         wxFAIL;                                      break;
     }
 
+    m_entryIndex.try_emplace( { aItem, aScreen }, m_entries.size() );
     m_entries.push_back( ent );
 }
 
 
 COMMIT::COMMIT_LINE* COMMIT::findEntry( EDA_ITEM* aItem, BASE_SCREEN *aScreen )
 {
-    for( COMMIT_LINE& entry : m_entries )
-    {
-        if( entry.m_item == aItem && entry.m_screen == aScreen )
-            return &entry;
-    }
+    auto it = m_entryIndex.find( { aItem, aScreen } );
+
+    if( it != m_entryIndex.end() )
+        return &m_entries[ it->second ];
 
     return nullptr;
 }
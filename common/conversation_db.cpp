@@ -80,6 +80,12 @@ bool CONVERSATION_DB::Initialize()
     // Enable foreign keys
     execute( "PRAGMA foreign_keys = ON;" );
     
+    // WAL keeps readers (history loads) from blocking behind writers (message inserts)
+    // and, with synchronous = NORMAL, avoids an fsync on every implicit transaction.
+    // NORMAL in WAL mode is still durable against application crashes.
+    execute( "PRAGMA journal_mode = WAL;" );
+    execute( "PRAGMA synchronous = NORMAL;" );
+    
     // Create tables
     if( !createTables() )
     {
@@ -90,8 +96,16 @@ bool CONVERSATION_DB::Initialize()
     
     // Cleanup old conversations (older than 7 days) to respect privacy
     // and keep the database size reasonable
-    (void) DeleteOldConversations( 7 );
-    
+    int deleted = DeleteOldConversations( 7 );
+
+    // Compact when the cleanup actually expired something: without this the file
+    // only ever grows with historical usage, and table scans slow down with it.
+    if( deleted > 0 )
+        execute( "VACUUM;" );
+
+    // Let SQLite refresh planner statistics for the indexes
+    execute( "PRAGMA optimize;" );
+
     return true;
 }
 
@@ -102,6 +116,11 @@ void CONVERSATION_DB::Close()
     
     if( m_db )
     {
+        for( auto& [sql, stmt] : m_stmtCache )
+            sqlite3_finalize( stmt );
+        
+        m_stmtCache.clear();
+        
         sqlite3_close( m_db );
         m_db = nullptr;
     }
@@ -126,6 +145,8 @@ bool CONVERSATION_DB::createTables()
         CREATE INDEX IF NOT EXISTS idx_conversations_user ON conversations(user_id);
         CREATE INDEX IF NOT EXISTS idx_conversations_updated ON conversations(updated_at DESC);
         CREATE INDEX IF NOT EXISTS idx_conversations_session ON conversations(session_id);
+        CREATE INDEX IF NOT EXISTS idx_conversations_unsynced ON conversations(is_synced)
+            WHERE is_synced = 0;
     )SQL";
     
     // Messages table - matches Supabase schema
@@ -142,6 +163,8 @@ bool CONVERSATION_DB::createTables()
         );
         CREATE INDEX IF NOT EXISTS idx_messages_conversation ON messages(conversation_id);
         CREATE INDEX IF NOT EXISTS idx_messages_created ON messages(conversation_id, created_at);
+        CREATE INDEX IF NOT EXISTS idx_messages_unsynced ON messages(is_synced)
+            WHERE is_synced = 0;
     )SQL";
     
     // Open tabs table - for persisting tab state across app restarts
@@ -191,6 +214,32 @@ bool CONVERSATION_DB::execute( const char* aSql )
 }
 
 
+sqlite3_stmt* CONVERSATION_DB::prepareCached( const char* aSql )
+{
+    auto it = m_stmtCache.find( aSql );
+    
+    if( it != m_stmtCache.end() )
+    {
+        sqlite3_reset( it->second );
+        sqlite3_clear_bindings( it->second );
+        return it->second;
+    }
+    
+    sqlite3_stmt* stmt = nullptr;
+    int rc = sqlite3_prepare_v2( m_db, aSql, -1, &stmt, nullptr );
+    
+    if( rc != SQLITE_OK )
+    {
+        wxLogError( wxT( "Failed to prepare statement: %s" ), 
+                    wxString::FromUTF8( sqlite3_errmsg( m_db ) ) );
+        return nullptr;
+    }
+    
+    m_stmtCache[aSql] = stmt;
+    return stmt;
+}
+
+
 wxString CONVERSATION_DB::GenerateUUID()
 {
     KIID id;
@@ -233,14 +282,9 @@ std::optional<CONVERSATION> CONVERSATION_DB::CreateConversation( const wxString&
                       "(id, user_id, project_file_path, session_id, title, summary, created_at, updated_at, is_synced) "
                       "VALUES (?, ?, ?, ?, ?, ?, ?, ?, 0);";
     
-    sqlite3_stmt* stmt;
-    int rc = sqlite3_prepare_v2( m_db, sql, -1, &stmt, nullptr );
-    if( rc != SQLITE_OK )
-    {
-        wxLogError( wxT( "Failed to prepare statement: %s" ), 
-                    wxString::FromUTF8( sqlite3_errmsg( m_db ) ) );
+    sqlite3_stmt* stmt = prepareCached( sql );
+    if( !stmt )
         return std::nullopt;
-    }
     
     sqlite3_bind_text( stmt, 1, conv.id.utf8_str(), -1, SQLITE_TRANSIENT );
     sqlite3_bind_text( stmt, 2, conv.user_id.utf8_str(), -1, SQLITE_TRANSIENT );
@@ -251,8 +295,8 @@ std::optional<CONVERSATION> CONVERSATION_DB::CreateConversation( const wxString&
     sqlite3_bind_text( stmt, 7, conv.created_at.utf8_str(), -1, SQLITE_TRANSIENT );
     sqlite3_bind_text( stmt, 8, conv.updated_at.utf8_str(), -1, SQLITE_TRANSIENT );
     
-    rc = sqlite3_step( stmt );
-    sqlite3_finalize( stmt );
+    int rc = sqlite3_step( stmt );
+    sqlite3_reset( stmt );
     
     if( rc != SQLITE_DONE )
     {
@@ -275,17 +319,16 @@ std::optional<CONVERSATION> CONVERSATION_DB::LoadConversation( const wxString& a
     const char* sql = "SELECT id, user_id, project_file_path, session_id, title, summary, "
                       "created_at, updated_at, is_synced FROM conversations WHERE id = ?;";
     
-    sqlite3_stmt* stmt;
-    int rc = sqlite3_prepare_v2( m_db, sql, -1, &stmt, nullptr );
-    if( rc != SQLITE_OK )
+    sqlite3_stmt* stmt = prepareCached( sql );
+    if( !stmt )
         return std::nullopt;
     
     sqlite3_bind_text( stmt, 1, aConversationId.utf8_str(), -1, SQLITE_TRANSIENT );
     
-    rc = sqlite3_step( stmt );
+    int rc = sqlite3_step( stmt );
     if( rc != SQLITE_ROW )
     {
-        sqlite3_finalize( stmt );
+        sqlite3_reset( stmt );
         return std::nullopt;
     }
     
@@ -300,7 +343,7 @@ std::optional<CONVERSATION> CONVERSATION_DB::LoadConversation( const wxString& a
     conv.updated_at = wxString::FromUTF8( reinterpret_cast<const char*>( sqlite3_column_text( stmt, 7 ) ) );
     conv.is_synced = sqlite3_column_int( stmt, 8 ) != 0;
     
-    sqlite3_finalize( stmt );
+    sqlite3_reset( stmt );
     return conv;
 }
 
@@ -329,9 +372,8 @@ std::vector<CONVERSATION> CONVERSATION_DB::ListConversations( const wxString& aU
               "ORDER BY updated_at DESC LIMIT ?;";
     }
     
-    sqlite3_stmt* stmt;
-    int rc = sqlite3_prepare_v2( m_db, sql.c_str(), -1, &stmt, nullptr );
-    if( rc != SQLITE_OK )
+    sqlite3_stmt* stmt = prepareCached( sql.c_str() );
+    if( !stmt )
         return conversations;
     
     int paramIndex = 1;
@@ -356,7 +398,7 @@ std::vector<CONVERSATION> CONVERSATION_DB::ListConversations( const wxString& aU
         conversations.push_back( conv );
     }
     
-    sqlite3_finalize( stmt );
+    sqlite3_reset( stmt );
     return conversations;
 }
 
@@ -370,9 +412,8 @@ bool CONVERSATION_DB::UpdateConversationTitle( const wxString& aConversationId,
     
     const char* sql = "UPDATE conversations SET title = ?, updated_at = ?, is_synced = 0 WHERE id = ?;";
     
-    sqlite3_stmt* stmt;
-    int rc = sqlite3_prepare_v2( m_db, sql, -1, &stmt, nullptr );
-    if( rc != SQLITE_OK )
+    sqlite3_stmt* stmt = prepareCached( sql );
+    if( !stmt )
         return false;
     
     wxString now = GetCurrentTimestamp();
@@ -380,8 +421,8 @@ bool CONVERSATION_DB::UpdateConversationTitle( const wxString& aConversationId,
     sqlite3_bind_text( stmt, 2, now.utf8_str(), -1, SQLITE_TRANSIENT );
     sqlite3_bind_text( stmt, 3, aConversationId.utf8_str(), -1, SQLITE_TRANSIENT );
     
-    rc = sqlite3_step( stmt );
-    sqlite3_finalize( stmt );
+    int rc = sqlite3_step( stmt );
+    sqlite3_reset( stmt );
     
     return rc == SQLITE_DONE;
 }
@@ -396,9 +437,8 @@ bool CONVERSATION_DB::UpdateConversationSummary( const wxString& aConversationId
     
     const char* sql = "UPDATE conversations SET summary = ?, updated_at = ?, is_synced = 0 WHERE id = ?;";
     
-    sqlite3_stmt* stmt;
-    int rc = sqlite3_prepare_v2( m_db, sql, -1, &stmt, nullptr );
-    if( rc != SQLITE_OK )
+    sqlite3_stmt* stmt = prepareCached( sql );
+    if( !stmt )
         return false;
     
     wxString now = GetCurrentTimestamp();
@@ -406,8 +446,8 @@ bool CONVERSATION_DB::UpdateConversationSummary( const wxString& aConversationId
     sqlite3_bind_text( stmt, 2, now.utf8_str(), -1, SQLITE_TRANSIENT );
     sqlite3_bind_text( stmt, 3, aConversationId.utf8_str(), -1, SQLITE_TRANSIENT );
     
-    rc = sqlite3_step( stmt );
-    sqlite3_finalize( stmt );
+    int rc = sqlite3_step( stmt );
+    sqlite3_reset( stmt );
     
     return rc == SQLITE_DONE;
 }
@@ -423,15 +463,14 @@ bool CONVERSATION_DB::DeleteConversation( const wxString& aConversationId )
     // Messages will be deleted automatically due to ON DELETE CASCADE
     const char* sql = "DELETE FROM conversations WHERE id = ?;";
     
-    sqlite3_stmt* stmt;
-    int rc = sqlite3_prepare_v2( m_db, sql, -1, &stmt, nullptr );
-    if( rc != SQLITE_OK )
+    sqlite3_stmt* stmt = prepareCached( sql );
+    if( !stmt )
         return false;
     
     sqlite3_bind_text( stmt, 1, aConversationId.utf8_str(), -1, SQLITE_TRANSIENT );
     
-    rc = sqlite3_step( stmt );
-    sqlite3_finalize( stmt );
+    int rc = sqlite3_step( stmt );
+    sqlite3_reset( stmt );
     
     return rc == SQLITE_DONE;
 }
@@ -464,15 +503,15 @@ std::optional<MESSAGE> CONVERSATION_DB::SaveMessage( const wxString& aConversati
                       "(id, conversation_id, role, content, created_at, metadata, is_synced) "
                       "VALUES (?, ?, ?, ?, ?, ?, 0);";
     
-    sqlite3_stmt* stmt;
-    int rc = sqlite3_prepare_v2( m_db, sql, -1, &stmt, nullptr );
-    if( rc != SQLITE_OK )
-    {
-        wxLogError( wxT( "Failed to prepare statement: %s" ), 
-                    wxString::FromUTF8( sqlite3_errmsg( m_db ) ) );
+    sqlite3_stmt* stmt = prepareCached( sql );
+    if( !stmt )
         return std::nullopt;
-    }
-    
+
+    // The message insert and the conversation timestamp update commit together;
+    // two separate implicit transactions would mean two journal syncs per message.
+    if( !execute( "BEGIN TRANSACTION;" ) )
+        return std::nullopt;
+
     sqlite3_bind_text( stmt, 1, msg.id.utf8_str(), -1, SQLITE_TRANSIENT );
     sqlite3_bind_text( stmt, 2, msg.conversation_id.utf8_str(), -1, SQLITE_TRANSIENT );
     sqlite3_bind_text( stmt, 3, msg.role.utf8_str(), -1, SQLITE_TRANSIENT );
@@ -480,51 +519,59 @@ std::optional<MESSAGE> CONVERSATION_DB::SaveMessage( const wxString& aConversati
     sqlite3_bind_text( stmt, 5, msg.created_at.utf8_str(), -1, SQLITE_TRANSIENT );
     sqlite3_bind_text( stmt, 6, msg.metadata.utf8_str(), -1, SQLITE_TRANSIENT );
     
-    rc = sqlite3_step( stmt );
-    sqlite3_finalize( stmt );
+    int rc = sqlite3_step( stmt );
+    sqlite3_reset( stmt );
     
     if( rc != SQLITE_DONE )
     {
-        wxLogError( wxT( "Failed to save message: %s" ), 
+        wxLogError( wxT( "Failed to save message: %s" ),
                     wxString::FromUTF8( sqlite3_errmsg( m_db ) ) );
+        execute( "ROLLBACK;" );
         return std::nullopt;
     }
-    
+
     // Update conversation's updated_at timestamp
     const char* updateSql = "UPDATE conversations SET updated_at = ?, is_synced = 0 WHERE id = ?;";
-    sqlite3_stmt* updateStmt;
-    rc = sqlite3_prepare_v2( m_db, updateSql, -1, &updateStmt, nullptr );
-    if( rc == SQLITE_OK )
+    sqlite3_stmt* updateStmt = prepareCached( updateSql );
+    if( updateStmt )
     {
         sqlite3_bind_text( updateStmt, 1, msg.created_at.utf8_str(), -1, SQLITE_TRANSIENT );
         sqlite3_bind_text( updateStmt, 2, aConversationId.utf8_str(), -1, SQLITE_TRANSIENT );
         sqlite3_step( updateStmt );
-        sqlite3_finalize( updateStmt );
+        sqlite3_reset( updateStmt );
     }
-    
+
+    if( !execute( "COMMIT;" ) )
+    {
+        execute( "ROLLBACK;" );
+        return std::nullopt;
+    }
+
     return msg;
 }
 
 
-std::vector<MESSAGE> CONVERSATION_DB::LoadMessages( const wxString& aConversationId, int aLimit )
+std::vector<MESSAGE> CONVERSATION_DB::LoadMessages( const wxString& aConversationId, int aLimit,
+                                                    int aOffset )
 {
     std::lock_guard<std::recursive_mutex> lock( m_mutex );
-    
+
     std::vector<MESSAGE> messages;
-    
+
     if( !m_db && !Initialize() )
         return messages;
-    
+
     const char* sql = "SELECT id, conversation_id, role, content, created_at, metadata, is_synced "
-                      "FROM messages WHERE conversation_id = ? ORDER BY created_at ASC LIMIT ?;";
-    
-    sqlite3_stmt* stmt;
-    int rc = sqlite3_prepare_v2( m_db, sql, -1, &stmt, nullptr );
-    if( rc != SQLITE_OK )
+                      "FROM messages WHERE conversation_id = ? ORDER BY created_at ASC "
+                      "LIMIT ? OFFSET ?;";
+
+    sqlite3_stmt* stmt = prepareCached( sql );
+    if( !stmt )
         return messages;
-    
+
     sqlite3_bind_text( stmt, 1, aConversationId.utf8_str(), -1, SQLITE_TRANSIENT );
     sqlite3_bind_int( stmt, 2, aLimit );
+    sqlite3_bind_int( stmt, 3, aOffset );
     
     while( sqlite3_step( stmt ) == SQLITE_ROW )
     {
@@ -539,7 +586,7 @@ std::vector<MESSAGE> CONVERSATION_DB::LoadMessages( const wxString& aConversatio
         messages.push_back( msg );
     }
     
-    sqlite3_finalize( stmt );
+    sqlite3_reset( stmt );
     return messages;
 }
 
@@ -554,17 +601,16 @@ std::optional<MESSAGE> CONVERSATION_DB::GetLastMessage( const wxString& aConvers
     const char* sql = "SELECT id, conversation_id, role, content, created_at, metadata, is_synced "
                       "FROM messages WHERE conversation_id = ? ORDER BY created_at DESC LIMIT 1;";
     
-    sqlite3_stmt* stmt;
-    int rc = sqlite3_prepare_v2( m_db, sql, -1, &stmt, nullptr );
-    if( rc != SQLITE_OK )
+    sqlite3_stmt* stmt = prepareCached( sql );
+    if( !stmt )
         return std::nullopt;
     
     sqlite3_bind_text( stmt, 1, aConversationId.utf8_str(), -1, SQLITE_TRANSIENT );
     
-    rc = sqlite3_step( stmt );
+    int rc = sqlite3_step( stmt );
     if( rc != SQLITE_ROW )
     {
-        sqlite3_finalize( stmt );
+        sqlite3_reset( stmt );
         return std::nullopt;
     }
     
@@ -577,7 +623,7 @@ std::optional<MESSAGE> CONVERSATION_DB::GetLastMessage( const wxString& aConvers
     msg.metadata = wxString::FromUTF8( reinterpret_cast<const char*>( sqlite3_column_text( stmt, 5 ) ) );
     msg.is_synced = sqlite3_column_int( stmt, 6 ) != 0;
     
-    sqlite3_finalize( stmt );
+    sqlite3_reset( stmt );
     return msg;
 }
 
@@ -595,15 +641,14 @@ bool CONVERSATION_DB::MarkConversationSynced( const wxString& aConversationId )
     
     const char* sql = "UPDATE conversations SET is_synced = 1 WHERE id = ?;";
     
-    sqlite3_stmt* stmt;
-    int rc = sqlite3_prepare_v2( m_db, sql, -1, &stmt, nullptr );
-    if( rc != SQLITE_OK )
+    sqlite3_stmt* stmt = prepareCached( sql );
+    if( !stmt )
         return false;
     
     sqlite3_bind_text( stmt, 1, aConversationId.utf8_str(), -1, SQLITE_TRANSIENT );
     
-    rc = sqlite3_step( stmt );
-    sqlite3_finalize( stmt );
+    int rc = sqlite3_step( stmt );
+    sqlite3_reset( stmt );
     
     return rc == SQLITE_DONE;
 }
@@ -618,15 +663,14 @@ bool CONVERSATION_DB::MarkMessageSynced( const wxString& aMessageId )
     
     const char* sql = "UPDATE messages SET is_synced = 1 WHERE id = ?;";
     
-    sqlite3_stmt* stmt;
-    int rc = sqlite3_prepare_v2( m_db, sql, -1, &stmt, nullptr );
-    if( rc != SQLITE_OK )
+    sqlite3_stmt* stmt = prepareCached( sql );
+    if( !stmt )
         return false;
     
     sqlite3_bind_text( stmt, 1, aMessageId.utf8_str(), -1, SQLITE_TRANSIENT );
     
-    rc = sqlite3_step( stmt );
-    sqlite3_finalize( stmt );
+    int rc = sqlite3_step( stmt );
+    sqlite3_reset( stmt );
     
     return rc == SQLITE_DONE;
 }
@@ -645,9 +689,8 @@ std::vector<CONVERSATION> CONVERSATION_DB::GetUnsyncedConversations()
                       "created_at, updated_at, is_synced FROM conversations "
                       "WHERE is_synced = 0;";
     
-    sqlite3_stmt* stmt;
-    int rc = sqlite3_prepare_v2( m_db, sql, -1, &stmt, nullptr );
-    if( rc != SQLITE_OK )
+    sqlite3_stmt* stmt = prepareCached( sql );
+    if( !stmt )
         return conversations;
     
     while( sqlite3_step( stmt ) == SQLITE_ROW )
@@ -665,7 +708,7 @@ std::vector<CONVERSATION> CONVERSATION_DB::GetUnsyncedConversations()
         conversations.push_back( conv );
     }
     
-    sqlite3_finalize( stmt );
+    sqlite3_reset( stmt );
     return conversations;
 }
 
@@ -682,9 +725,8 @@ std::vector<MESSAGE> CONVERSATION_DB::GetUnsyncedMessages()
     const char* sql = "SELECT id, conversation_id, role, content, created_at, metadata, is_synced "
                       "FROM messages WHERE is_synced = 0;";
     
-    sqlite3_stmt* stmt;
-    int rc = sqlite3_prepare_v2( m_db, sql, -1, &stmt, nullptr );
-    if( rc != SQLITE_OK )
+    sqlite3_stmt* stmt = prepareCached( sql );
+    if( !stmt )
         return messages;
     
     while( sqlite3_step( stmt ) == SQLITE_ROW )
@@ -700,7 +742,7 @@ std::vector<MESSAGE> CONVERSATION_DB::GetUnsyncedMessages()
         messages.push_back( msg );
     }
     
-    sqlite3_finalize( stmt );
+    sqlite3_reset( stmt );
     return messages;
 }
 
@@ -715,16 +757,15 @@ int CONVERSATION_DB::SetUserIdForLocalConversations( const wxString& aUserId )
     const char* sql = "UPDATE conversations SET user_id = ?, is_synced = 0 "
                       "WHERE user_id IS NULL OR user_id = '';";
     
-    sqlite3_stmt* stmt;
-    int rc = sqlite3_prepare_v2( m_db, sql, -1, &stmt, nullptr );
-    if( rc != SQLITE_OK )
+    sqlite3_stmt* stmt = prepareCached( sql );
+    if( !stmt )
         return 0;
     
     sqlite3_bind_text( stmt, 1, aUserId.utf8_str(), -1, SQLITE_TRANSIENT );
     
-    rc = sqlite3_step( stmt );
+    int rc = sqlite3_step( stmt );
     int changes = sqlite3_changes( m_db );
-    sqlite3_finalize( stmt );
+    sqlite3_reset( stmt );
     
     return ( rc == SQLITE_DONE ) ? changes : 0;
 }
@@ -744,20 +785,15 @@ int CONVERSATION_DB::DeleteOldConversations( int aDays )
     // Delete old conversations (messages will cascade delete)
     const char* sql = "DELETE FROM conversations WHERE updated_at < ?;";
     
-    sqlite3_stmt* stmt;
-    int rc = sqlite3_prepare_v2( m_db, sql, -1, &stmt, nullptr );
-    if( rc != SQLITE_OK )
-    {
-        wxLogError( wxT( "Failed to prepare delete statement: %s" ),
-                    wxString::FromUTF8( sqlite3_errmsg( m_db ) ) );
+    sqlite3_stmt* stmt = prepareCached( sql );
+    if( !stmt )
         return 0;
-    }
     
     sqlite3_bind_text( stmt, 1, cutoffStr.utf8_str(), -1, SQLITE_TRANSIENT );
     
-    rc = sqlite3_step( stmt );
+    int rc = sqlite3_step( stmt );
     int changes = sqlite3_changes( m_db );
-    sqlite3_finalize( stmt );
+    sqlite3_reset( stmt );
     
     if( rc == SQLITE_DONE && changes > 0 )
     {
@@ -785,50 +821,48 @@ bool CONVERSATION_DB::SaveOpenTabs( const std::vector<OPEN_TAB>& aTabs, const wx
     
     // Clear existing tabs for this project
     const char* deleteSql = "DELETE FROM open_tabs WHERE project_file_path = ? OR project_file_path IS NULL;";
-    sqlite3_stmt* deleteStmt;
-    int rc = sqlite3_prepare_v2( m_db, deleteSql, -1, &deleteStmt, nullptr );
-    if( rc != SQLITE_OK )
+    sqlite3_stmt* deleteStmt = prepareCached( deleteSql );
+    if( !deleteStmt )
     {
         execute( "ROLLBACK;" );
         return false;
     }
-    
+
     sqlite3_bind_text( deleteStmt, 1, aProjectFilePath.utf8_str(), -1, SQLITE_TRANSIENT );
-    rc = sqlite3_step( deleteStmt );
-    sqlite3_finalize( deleteStmt );
-    
+    int rc = sqlite3_step( deleteStmt );
+    sqlite3_reset( deleteStmt );
+
     if( rc != SQLITE_DONE )
     {
         execute( "ROLLBACK;" );
         return false;
     }
-    
+
     // Insert new tabs
     const char* insertSql = "INSERT INTO open_tabs "
                             "(conversation_id, tab_order, is_active, project_file_path, created_at) "
                             "VALUES (?, ?, ?, ?, ?);";
-    
+
+    sqlite3_stmt* insertStmt = prepareCached( insertSql );
+    if( !insertStmt )
+    {
+        execute( "ROLLBACK;" );
+        return false;
+    }
+
     wxString now = GetCurrentTimestamp();
-    
+
     for( const auto& tab : aTabs )
     {
-        sqlite3_stmt* insertStmt;
-        rc = sqlite3_prepare_v2( m_db, insertSql, -1, &insertStmt, nullptr );
-        if( rc != SQLITE_OK )
-        {
-            execute( "ROLLBACK;" );
-            return false;
-        }
-        
         sqlite3_bind_text( insertStmt, 1, tab.conversation_id.utf8_str(), -1, SQLITE_TRANSIENT );
         sqlite3_bind_int( insertStmt, 2, tab.tab_order );
         sqlite3_bind_int( insertStmt, 3, tab.is_active ? 1 : 0 );
         sqlite3_bind_text( insertStmt, 4, aProjectFilePath.utf8_str(), -1, SQLITE_TRANSIENT );
         sqlite3_bind_text( insertStmt, 5, now.utf8_str(), -1, SQLITE_TRANSIENT );
-        
+
         rc = sqlite3_step( insertStmt );
-        sqlite3_finalize( insertStmt );
-        
+        sqlite3_reset( insertStmt );
+
         if( rc != SQLITE_DONE )
         {
             execute( "ROLLBACK;" );
@@ -858,9 +892,8 @@ std::vector<OPEN_TAB> CONVERSATION_DB::LoadOpenTabs( const wxString& aProjectFil
     const char* sql = "SELECT id, conversation_id, tab_order, is_active, project_file_path, created_at "
                       "FROM open_tabs WHERE project_file_path = ? ORDER BY tab_order ASC;";
     
-    sqlite3_stmt* stmt;
-    int rc = sqlite3_prepare_v2( m_db, sql, -1, &stmt, nullptr );
-    if( rc != SQLITE_OK )
+    sqlite3_stmt* stmt = prepareCached( sql );
+    if( !stmt )
         return tabs;
     
     sqlite3_bind_text( stmt, 1, aProjectFilePath.utf8_str(), -1, SQLITE_TRANSIENT );
@@ -880,7 +913,7 @@ std::vector<OPEN_TAB> CONVERSATION_DB::LoadOpenTabs( const wxString& aProjectFil
         tabs.push_back( tab );
     }
     
-    sqlite3_finalize( stmt );
+    sqlite3_reset( stmt );
     
     return tabs;
 }
@@ -895,15 +928,14 @@ bool CONVERSATION_DB::ClearOpenTabs( const wxString& aProjectFilePath )
     
     const char* sql = "DELETE FROM open_tabs WHERE project_file_path = ?;";
     
-    sqlite3_stmt* stmt;
-    int rc = sqlite3_prepare_v2( m_db, sql, -1, &stmt, nullptr );
-    if( rc != SQLITE_OK )
+    sqlite3_stmt* stmt = prepareCached( sql );
+    if( !stmt )
         return false;
     
     sqlite3_bind_text( stmt, 1, aProjectFilePath.utf8_str(), -1, SQLITE_TRANSIENT );
     
-    rc = sqlite3_step( stmt );
-    sqlite3_finalize( stmt );
+    int rc = sqlite3_step( stmt );
+    sqlite3_reset( stmt );
     
     return rc == SQLITE_DONE;
 }
@@ -22,13 +22,16 @@
 
 #include <wx/string.h>
 #include <kicommon.h>
+#include <map>
+#include <string>
 #include <vector>
 #include <memory>
 #include <optional>
 #include <mutex>
 
-// Forward declaration
+// Forward declarations
 struct sqlite3;
+struct sqlite3_stmt;
 
 /**
  * Represents a single conversation in the local database.
@@ -183,12 +186,16 @@ public:
                                          const wxString& aMetadata = wxEmptyString );
 
     /**
-     * Load all messages for a conversation, ordered by created_at ascending.
+     * Load messages for a conversation, ordered by created_at ascending.
+     * Use aLimit/aOffset to page through long histories instead of loading
+     * everything up front.
      * @param aConversationId The conversation ID.
      * @param aLimit Maximum number of messages to return.
+     * @param aOffset Number of messages to skip from the start of the history.
      * @return Vector of messages.
      */
-    std::vector<MESSAGE> LoadMessages( const wxString& aConversationId, int aLimit = 500 );
+    std::vector<MESSAGE> LoadMessages( const wxString& aConversationId, int aLimit = 500,
+                                       int aOffset = 0 );
 
     /**
      * Get the last message for a conversation (for preview).
@@ -312,7 +319,18 @@ private:
      */
     bool execute( const char* aSql );
 
+    /**
+     * Get a prepared statement for the given SQL, compiling it on first use.
+     * Cached statements are reset (and their bindings cleared) before being
+     * handed back, and are finalized in Close().  Callers must not finalize
+     * the returned statement; reset it after stepping instead.
+     * @param aSql The SQL to prepare.
+     * @return The prepared statement, or nullptr on error.
+     */
+    sqlite3_stmt* prepareCached( const char* aSql );
+
     sqlite3* m_db;                        ///< SQLite database handle
+    std::map<std::string, sqlite3_stmt*> m_stmtCache; ///< Prepared statements, keyed by SQL text
     mutable std::recursive_mutex m_mutex; ///< Thread safety for concurrent access (recursive for nested calls)
 };
 
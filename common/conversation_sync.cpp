@@ -23,6 +23,7 @@
 #include <kicad_curl/kicad_curl_easy.h>
 #include <wx/log.h>
 #include <nlohmann/json.hpp>
+#include <algorithm>
 #include <chrono>
 
 CONVERSATION_SYNC& CONVERSATION_SYNC::Instance()
@@ -141,7 +142,10 @@ int CONVERSATION_SYNC::pushConversations()
     if( authToken.IsEmpty() )
         return 0;
 
-    int synced = 0;
+    // Upsert all changed conversations in a single request: PostgREST accepts an
+    // array payload, so the per-row HTTP round trip is what we save here.
+    nlohmann::json payload = nlohmann::json::array();
+    std::vector<wxString> pushedIds;
 
     for( const auto& conv : unsynced )
     {
@@ -149,49 +153,53 @@ int CONVERSATION_SYNC::pushConversations()
         if( conv.user_id.IsEmpty() )
             continue;
 
-        try
-        {
-            nlohmann::json payload;
-            payload["id"] = conv.id.ToUTF8().data();
-            payload["user_id"] = conv.user_id.ToUTF8().data();
-            payload["project_file_path"] = conv.project_file_path.ToUTF8().data();
-            payload["session_id"] = conv.session_id.ToUTF8().data();
-            payload["title"] = conv.title.ToUTF8().data();
-            payload["summary"] = conv.summary.ToUTF8().data();
-            payload["created_at"] = conv.created_at.ToUTF8().data();
-            payload["updated_at"] = conv.updated_at.ToUTF8().data();
-
-            std::string url = m_supabaseUrl.ToStdString() + "/conversations";
-            std::string body = payload.dump();
+        nlohmann::json row;
+        row["id"] = conv.id.ToUTF8().data();
+        row["user_id"] = conv.user_id.ToUTF8().data();
+        row["project_file_path"] = conv.project_file_path.ToUTF8().data();
+        row["session_id"] = conv.session_id.ToUTF8().data();
+        row["title"] = conv.title.ToUTF8().data();
+        row["summary"] = conv.summary.ToUTF8().data();
+        row["created_at"] = conv.created_at.ToUTF8().data();
+        row["updated_at"] = conv.updated_at.ToUTF8().data();
+        payload.push_back( std::move( row ) );
+        pushedIds.push_back( conv.id );
+    }
 
-            KICAD_CURL_EASY curl;
-            curl.SetURL( url );
-            curl.SetPostFields( body );
-            curl.SetHeader( "Content-Type", "application/json" );
-            curl.SetHeader( "Authorization", ( "Bearer " + authToken ).ToStdString() );
-            curl.SetHeader( "Prefer", "resolution=merge-duplicates" );
+    if( payload.empty() )
+        return 0;
 
-            int httpCode = curl.Perform();
+    try
+    {
+        std::string url = m_supabaseUrl.ToStdString() + "/conversations";
+        std::string body = payload.dump();
 
-            if( httpCode == 200 || httpCode == 201 )
-            {
-                db.MarkConversationSynced( conv.id );
-                synced++;
-            }
-            else
-            {
-                wxLogWarning( wxT( "Failed to sync conversation %s: HTTP %d" ),
-                              conv.id.Left( 8 ), httpCode );
-            }
-        }
-        catch( const std::exception& e )
+        KICAD_CURL_EASY curl;
+        curl.SetURL( url );
+        curl.SetPostFields( body );
+        curl.SetHeader( "Content-Type", "application/json" );
+        curl.SetHeader( "Authorization", ( "Bearer " + authToken ).ToStdString() );
+        curl.SetHeader( "Prefer", "resolution=merge-duplicates" );
+
+        int httpCode = curl.Perform();
+
+        if( httpCode == 200 || httpCode == 201 )
         {
-            wxLogWarning( wxT( "Error syncing conversation %s: %s" ),
-                          conv.id.Left( 8 ), wxString::FromUTF8( e.what() ) );
+            for( const wxString& id : pushedIds )
+                db.MarkConversationSynced( id );
+
+            return static_cast<int>( pushedIds.size() );
         }
+
+        wxLogWarning( wxT( "Failed to sync %zu conversations: HTTP %d" ),
+                      pushedIds.size(), httpCode );
+    }
+    catch( const std::exception& e )
+    {
+        wxLogWarning( wxT( "Error syncing conversations: %s" ), wxString::FromUTF8( e.what() ) );
     }
 
-    return synced;
+    return 0;
 }
 
 
@@ -210,35 +218,51 @@ int CONVERSATION_SYNC::pushMessages()
     if( authToken.IsEmpty() )
         return 0;
 
+    // Batch the unsynced messages into a few array upserts rather than one request
+    // per message; the batch size keeps a request with large tool outputs from
+    // growing without bound.
+    constexpr size_t BATCH_SIZE = 200;
+
     int synced = 0;
 
-    for( const auto& msg : unsynced )
+    for( size_t start = 0; start < unsynced.size(); start += BATCH_SIZE )
     {
-        try
+        size_t end = std::min( start + BATCH_SIZE, unsynced.size() );
+
+        nlohmann::json payload = nlohmann::json::array();
+
+        for( size_t i = start; i < end; i++ )
         {
-            nlohmann::json payload;
-            payload["id"] = msg.id.ToUTF8().data();
-            payload["conversation_id"] = msg.conversation_id.ToUTF8().data();
-            payload["role"] = msg.role.ToUTF8().data();
-            payload["content"] = msg.content.ToUTF8().data();
-            payload["created_at"] = msg.created_at.ToUTF8().data();
+            const MESSAGE& msg = unsynced[i];
+
+            nlohmann::json row;
+            row["id"] = msg.id.ToUTF8().data();
+            row["conversation_id"] = msg.conversation_id.ToUTF8().data();
+            row["role"] = msg.role.ToUTF8().data();
+            row["content"] = msg.content.ToUTF8().data();
+            row["created_at"] = msg.created_at.ToUTF8().data();
 
             if( !msg.metadata.IsEmpty() )
             {
                 try
                 {
-                    payload["metadata"] = nlohmann::json::parse( msg.metadata.ToStdString() );
+                    row["metadata"] = nlohmann::json::parse( msg.metadata.ToStdString() );
                 }
                 catch( ... )
                 {
-                    payload["metadata"] = nlohmann::json::object();
+                    row["metadata"] = nlohmann::json::object();
                 }
             }
             else
             {
-                payload["metadata"] = nlohmann::json::object();
+                row["metadata"] = nlohmann::json::object();
             }
 
+            payload.push_back( std::move( row ) );
+        }
+
+        try
+        {
             std::string url = m_supabaseUrl.ToStdString() + "/messages";
             std::string body = payload.dump();
 
@@ -253,19 +277,20 @@ int CONVERSATION_SYNC::pushMessages()
 
             if( httpCode == 200 || httpCode == 201 )
             {
-                db.MarkMessageSynced( msg.id );
-                synced++;
+                for( size_t i = start; i < end; i++ )
+                    db.MarkMessageSynced( unsynced[i].id );
+
+                synced += static_cast<int>( end - start );
             }
             else
             {
-                wxLogWarning( wxT( "Failed to sync message %s: HTTP %d" ),
-                              msg.id.Left( 8 ), httpCode );
+                wxLogWarning( wxT( "Failed to sync %zu messages: HTTP %d" ),
+                              end - start, httpCode );
             }
         }
         catch( const std::exception& e )
         {
-            wxLogWarning( wxT( "Error syncing message %s: %s" ),
-                          msg.id.Left( 8 ), wxString::FromUTF8( e.what() ) );
+            wxLogWarning( wxT( "Error syncing messages: %s" ), wxString::FromUTF8( e.what() ) );
         }
     }
 
@@ -286,6 +311,11 @@ int CONVERSATION_SYNC::FetchFromSupabase()
     {
         std::string url = m_supabaseUrl.ToStdString() + "/conversations?order=updated_at.desc&limit=50";
 
+        // After the first fetch only pull conversations changed since the newest
+        // updated_at we have already seen, so repeat fetches transfer deltas only.
+        if( !m_pullCursor.IsEmpty() )
+            url += "&updated_at=gt." + m_pullCursor.ToStdString();
+
         KICAD_CURL_EASY curl;
         curl.SetURL( url );
         curl.SetHeader( "Authorization", ( "Bearer " + authToken ).ToStdString() );
@@ -308,6 +338,11 @@ int CONVERSATION_SYNC::FetchFromSupabase()
         for( const auto& item : data )
         {
             wxString convId = wxString::FromUTF8( item.value( "id", "" ) );
+            wxString updatedAt = wxString::FromUTF8( item.value( "updated_at", "" ) );
+
+            // ISO-8601 timestamps compare lexicographically
+            if( updatedAt > m_pullCursor )
+                m_pullCursor = updatedAt;
 
             // Check if conversation already exists locally
             auto existing = db.LoadConversation( convId );
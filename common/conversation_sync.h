@@ -78,7 +78,8 @@ public:
 
     /**
      * Fetch conversations from Supabase and merge with local.
-     * Called after successful sign-in.
+     * Called after successful sign-in.  Repeat calls only request conversations
+     * updated since the previous fetch.
      * @return Number of conversations fetched.
      */
     int FetchFromSupabase();
@@ -130,6 +131,10 @@ private:
     std::thread               m_thread;
     std::mutex                m_mutex;
     wxString                  m_supabaseUrl;
+
+    /// Newest conversation updated_at seen from the server; subsequent fetches
+    /// request only rows changed after this cursor
+    wxString                  m_pullCursor;
 };
 
 #endif // CONVERSATION_SYNC_H
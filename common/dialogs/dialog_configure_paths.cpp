@@ -36,6 +36,7 @@
 #include <filename_resolver.h>
 #include <env_vars.h>
 #include <grid_tricks.h>
+#include <libraries/library_manager.h>
 #include <pgm_base.h>
 #include <widgets/grid_text_button_helpers.h>
 #include <widgets/grid_text_helpers.h>
@@ -281,6 +282,9 @@ bool DIALOG_CONFIGURE_PATHS::TransferDataFromWindow()
 
     Pgm().SetLocalEnvVariables();
 
+    // Cached library URI resolutions may depend on the old variable values
+    LIBRARY_MANAGER::EnvVarsChanged();
+
     return true;
 }
 
@@ -24,9 +24,11 @@
  * or you may write to the Free Software Foundation, Inc.,
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
  */
+#include <advanced_config.h>
 #include <eda_draw_frame.h>
 #include <kiface_base.h>
 #include <macros.h>
+#include <perf_counters.h>
 #include <scoped_set_reset.h>
 #include <settings/app_settings.h>
 #include <trace_helpers.h>
@@ -51,10 +53,13 @@
 #include <kiplatform/ui.h>
 
 #include <core/profile.h>
+#include <core/profile_trace.h>
 
 #include <pgm_base.h>
 #include <confirm.h>
 
+#include <algorithm>
+
 
 /**
  * Flag to enable drawing panel debugging output.
@@ -236,6 +241,15 @@ bool EDA_DRAW_PANEL_GAL::DoRePaint()
     KIGFX::RENDER_SETTINGS* settings =
             static_cast<KIGFX::RENDER_SETTINGS*>( m_painter->GetSettings() );
 
+    const bool showTimingHUD = ADVANCED_CFG::GetCfg().m_ShowFrameTimingHUD;
+
+    // The HUD contents change every frame, so with it enabled each paint is a full redraw;
+    // this also keeps the overlay from being smeared by partial (damage-scissored) frames.
+    if( showTimingHUD )
+        m_view->MarkDirty();
+
+    TRACE_SCOPE frameScope( "EDA_DRAW_PANEL_GAL::DoRePaint", "gal" );
+
     PROF_TIMER cntUpd("view-upd-items");
     PROF_TIMER cntTotal("view-total");
     PROF_TIMER cntCtx("view-context-create");
@@ -252,6 +266,8 @@ bool EDA_DRAW_PANEL_GAL::DoRePaint()
 
         try
         {
+            TRACE_SCOPE updScope( "VIEW::UpdateItems", "gal" );
+
             m_view->UpdateItems();
         }
         catch( std::out_of_range& err )
@@ -301,9 +317,18 @@ bool EDA_DRAW_PANEL_GAL::DoRePaint()
                     m_gal->DrawGrid();
 
                 cntRedraw.Start();
-                m_view->Redraw();
+
+                {
+                    TRACE_SCOPE redrawScope( "VIEW::Redraw", "gal" );
+
+                    m_view->Redraw();
+                }
+
                 cntRedraw.Stop();
                 isDirty = true;
+
+                if( showTimingHUD )
+                    drawTimingHUD( cntTotal.msecs(), cntUpd.msecs(), cntRedraw.msecs() );
             }
 
             m_gal->DrawCursor( m_viewControls->GetCursorPosition() );
@@ -337,6 +362,9 @@ bool EDA_DRAW_PANEL_GAL::DoRePaint()
 
     if( isDirty )
     {
+        PERF_COUNTERS::Get().RecordDuration( "frame_paint",
+                cntTotal.SinceStart<std::chrono::nanoseconds>() );
+
         KI_TRACE( traceGalProfile, "View timing: %s %s %s %s %s\n",
             cntTotal.to_string(),
             cntUpd.to_string(),
@@ -352,6 +380,53 @@ bool EDA_DRAW_PANEL_GAL::DoRePaint()
 }
 
 
+void EDA_DRAW_PANEL_GAL::drawTimingHUD( double aFrameMs, double aUpdateMs, double aRedrawMs )
+{
+    // The HUD is drawn in world coordinates (like everything else), anchored to a fixed
+    // screen position
+    const double lineHeight = 14.0 / m_gal->GetWorldScale();
+
+    m_gal->SetTarget( KIGFX::TARGET_OVERLAY );
+    m_gal->SetLayerDepth( m_gal->GetMinDepth() );
+    m_gal->SetIsFill( false );
+    m_gal->SetIsStroke( true );
+    m_gal->SetStrokeColor( KIGFX::COLOR4D( 1.0, 1.0, 1.0, 0.8 ) );
+    m_gal->ResetTextAttributes();
+    m_gal->SetGlyphSize( VECTOR2I( lineHeight, lineHeight ) );
+
+    const VECTOR2D anchor = m_view->ToWorld( VECTOR2D( 10.0, 20.0 ) );
+    int            line = 0;
+
+    auto print =
+            [&]( const wxString& aText )
+            {
+                VECTOR2I pos( anchor.x, anchor.y + line * lineHeight * 1.3 );
+                m_gal->BitmapText( aText, pos, ANGLE_HORIZONTAL );
+                line++;
+            };
+
+    print( wxString::Format( wxT( "frame %.1f ms (update %.1f ms, redraw %.1f ms)" ),
+                             aFrameMs, aUpdateMs, aRedrawMs ) );
+
+    std::vector<KIGFX::VIEW::LAYER_TIMING> timings = m_view->GetLastLayerTimings();
+
+    std::sort( timings.begin(), timings.end(),
+               []( const KIGFX::VIEW::LAYER_TIMING& a, const KIGFX::VIEW::LAYER_TIMING& b )
+               {
+                   return a.durationMs > b.durationMs;
+               } );
+
+    if( timings.size() > 5 )
+        timings.resize( 5 );
+
+    for( const KIGFX::VIEW::LAYER_TIMING& timing : timings )
+    {
+        print( wxString::Format( wxT( "layer %d: %d items, %.2f ms" ), timing.layer,
+                                 timing.itemCount, timing.durationMs ) );
+    }
+}
+
+
 void EDA_DRAW_PANEL_GAL::onSize( wxSizeEvent& aEvent )
 {
     // If we get a second wx update call before the first finishes, don't crash
@@ -462,6 +537,9 @@ void EDA_DRAW_PANEL_GAL::SetHighContrastLayer( int aLayer )
     rSettings->ClearHighContrastLayers();
     rSettings->SetLayerIsHighContrast( aLayer );
 
+    // High contrast settings feed the items' ViewGetLOD() calculations
+    m_view->MarkLODsDirty();
+
     m_view->UpdateAllLayersColor();
 }
 
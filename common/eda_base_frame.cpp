@@ -45,6 +45,8 @@
 #include <hotkeys_basic.h>
 #include <panel_hotkeys_editor.h>
 #include <paths.h>
+#include <perf_counters.h>
+#include <background_job_scheduler.h>
 #include <local_history.h>
 #include <confirm.h>
 #include <panel_packages_and_updates.h>
@@ -372,9 +374,35 @@ bool EDA_BASE_FRAME::doAutoSave()
     m_autoSavePending = false;
 
     // Use registered saver callbacks to snapshot editor state into .history and only commit
-    // if there are material changes.
+    // if there are material changes.  The savers have to run here -- they read the live
+    // documents -- but once the mirror files are on disk the libgit2 staging and commit are
+    // self-contained, so they go to the background scheduler where they can't hitch the
+    // editor.  Successive commits chain on the previous job to keep them serialized.
     if( !Prj().IsReadOnly() )
-        Kiway().LocalHistory().RunRegisteredSaversAndCommit( Prj().GetProjectPath(), wxS( "Autosave" ) );
+    {
+        LOCAL_HISTORY&        history = Kiway().LocalHistory();
+        wxString              projectPath = Prj().GetProjectPath();
+        std::vector<wxString> files = history.RunRegisteredSavers( projectPath );
+
+        if( !files.empty() )
+        {
+            std::vector<std::shared_ptr<SCHEDULED_JOB>> deps;
+
+            if( m_historyCommitJob )
+                deps.push_back( m_historyCommitJob );
+
+            m_historyCommitJob = Pgm().GetBackgroundJobScheduler().Submit(
+                    _( "Local history commit" ), TP_PRIORITY_BATCH,
+                    [&history, projectPath, files = std::move( files )]( BACKGROUND_JOB_WORK& aWork )
+                    {
+                        if( !aWork.KeepGoing() )
+                            return;
+
+                        history.CommitFiles( projectPath, files, wxS( "Autosave" ) );
+                    },
+                    std::move( deps ) );
+        }
+    }
 
     return true;
 }
@@ -1632,6 +1660,16 @@ void EDA_BASE_FRAME::PushCommandToUndoList( PICKED_ITEMS_LIST* aNewitem )
         if( extraitems > 0 )
             ClearUndoORRedoList( UNDO_LIST, extraitems );
     }
+
+    // The owned clones in the stack are heterogeneous EDA_ITEMs with no per-item size API,
+    // so the depth gauges are the memory-accounting proxy for undo.
+    size_t undoItems = 0;
+
+    for( const PICKED_ITEMS_LIST* cmd : m_undoList.m_CommandsList )
+        undoItems += cmd->GetCount();
+
+    PERF_COUNTERS::Get().Set( "undo.commands", GetUndoCommandCount() );
+    PERF_COUNTERS::Get().Set( "undo.items", (int64_t) undoItems );
 }
 
 
@@ -24,6 +24,7 @@
 
 #include <eda_pattern_match.h>
 #include <limits>
+#include <list>
 #include <wx/log.h>
 #include <wx/tokenzr.h>
 #include <algorithm>
@@ -387,10 +388,80 @@ const std::map<wxString, double> EDA_PATTERN_MATCH_RELATIONAL::m_units = {
     { wxS( "ti" ), 1099511627776. } };
 
 
+namespace
+{
+
+using COMPILED_MATCHER_SET = std::vector<std::unique_ptr<EDA_PATTERN_MATCH>>;
+
+/**
+ * LRU cache of compiled matcher sets keyed by (context, pattern).
+ *
+ * Interactive filtering (net inspector, search pane, library trees) constructs a fresh
+ * #EDA_COMBINED_MATCHER per keystroke and re-runs it over thousands of candidates, and
+ * the pattern compilation (wxRegEx) dominates construction.  wxRegEx carries its match
+ * state internally so compiled matchers must not be shared across threads; the cache is
+ * therefore thread-local, which still covers the UI thread doing virtually all of this
+ * work.
+ */
+class COMPILED_MATCHER_CACHE
+{
+public:
+    std::shared_ptr<COMPILED_MATCHER_SET> Get( COMBINED_MATCHER_CONTEXT aContext,
+                                               const wxString& aPattern )
+    {
+        auto it = m_entries.find( KEY( aContext, aPattern ) );
+
+        if( it == m_entries.end() )
+            return nullptr;
+
+        m_lru.splice( m_lru.begin(), m_lru, it->second.lruIt );
+        return it->second.matchers;
+    }
+
+    void Put( COMBINED_MATCHER_CONTEXT aContext, const wxString& aPattern,
+              const std::shared_ptr<COMPILED_MATCHER_SET>& aMatchers )
+    {
+        m_lru.push_front( KEY( aContext, aPattern ) );
+        m_entries[ m_lru.front() ] = { aMatchers, m_lru.begin() };
+
+        while( m_entries.size() > CAPACITY )
+        {
+            m_entries.erase( m_lru.back() );
+            m_lru.pop_back();
+        }
+    }
+
+private:
+    static constexpr size_t CAPACITY = 256;
+
+    using KEY = std::pair<int, wxString>;
+
+    struct ENTRY
+    {
+        std::shared_ptr<COMPILED_MATCHER_SET> matchers;
+        std::list<KEY>::iterator              lruIt;
+    };
+
+    std::list<KEY>       m_lru;         // Front is most recently used
+    std::map<KEY, ENTRY> m_entries;
+};
+
+thread_local COMPILED_MATCHER_CACHE compiledMatcherCache;
+
+} // namespace
+
+
 EDA_COMBINED_MATCHER::EDA_COMBINED_MATCHER( const wxString& aPattern,
                                             COMBINED_MATCHER_CONTEXT aContext ) :
         m_pattern( aPattern )
 {
+    m_matchers = compiledMatcherCache.Get( aContext, aPattern );
+
+    if( m_matchers )
+        return;
+
+    m_matchers = std::make_shared<COMPILED_MATCHER_SET>();
+
     switch( aContext )
     {
     case CTX_LIBITEM:
@@ -427,6 +498,8 @@ EDA_COMBINED_MATCHER::EDA_COMBINED_MATCHER( const wxString& aPattern,
         AddMatcher( aPattern, std::make_unique<EDA_PATTERN_MATCH_SUBSTR>() );
         break;
     }
+
+    compiledMatcherCache.Put( aContext, aPattern, m_matchers );
 }
 
 
@@ -435,7 +508,7 @@ bool EDA_COMBINED_MATCHER::Find( const wxString& aTerm, int& aMatchersTriggered,
     aPosition = EDA_PATTERN_NOT_FOUND;
     aMatchersTriggered = 0;
 
-    for( const std::unique_ptr<EDA_PATTERN_MATCH>& matcher : m_matchers )
+    for( const std::unique_ptr<EDA_PATTERN_MATCH>& matcher : *m_matchers )
     {
         EDA_PATTERN_MATCH::FIND_RESULT local_find = matcher->Find( aTerm );
 
@@ -454,7 +527,7 @@ bool EDA_COMBINED_MATCHER::Find( const wxString& aTerm, int& aMatchersTriggered,
 
 bool EDA_COMBINED_MATCHER::Find( const wxString& aTerm )
 {
-    for( const std::unique_ptr<EDA_PATTERN_MATCH>& matcher : m_matchers )
+    for( const std::unique_ptr<EDA_PATTERN_MATCH>& matcher : *m_matchers )
     {
         if( matcher->Find( aTerm ).start >= 0 )
             return true;
@@ -466,7 +539,7 @@ bool EDA_COMBINED_MATCHER::Find( const wxString& aTerm )
 
 bool EDA_COMBINED_MATCHER::StartsWith( const wxString& aTerm )
 {
-    for( const std::unique_ptr<EDA_PATTERN_MATCH>& matcher : m_matchers )
+    for( const std::unique_ptr<EDA_PATTERN_MATCH>& matcher : *m_matchers )
     {
         if( matcher->Find( aTerm ).start == 0 )
             return true;
@@ -482,17 +555,7 @@ int EDA_COMBINED_MATCHER::ScoreTerms( std::vector<SEARCH_TERM>& aWeightedTerms )
 
     for( SEARCH_TERM& term : aWeightedTerms )
     {
-        if( !term.Normalized )
-        {
-            term.Text = term.Text.MakeLower().Trim( false ).Trim( true );
-
-            // Don't cause KiCad to hang if someone accidentally pastes the PCB or schematic
-            // into the search box.
-            if( term.Text.Length() > 1000 )
-                term.Text = term.Text.Left( 1000 );
-
-            term.Normalized = true;
-        }
+        term.Normalize();
 
         int found_pos = EDA_PATTERN_NOT_FOUND;
         int matchers_fired = 0;
@@ -524,5 +587,5 @@ void EDA_COMBINED_MATCHER::AddMatcher( const wxString &aPattern,
                                        std::unique_ptr<EDA_PATTERN_MATCH> aMatcher )
 {
     if ( aMatcher->SetPattern( aPattern ) )
-        m_matchers.push_back( std::move( aMatcher ) );
+        m_matchers->push_back( std::move( aMatcher ) );
 }
@@ -1164,20 +1164,24 @@ std::shared_ptr<SHAPE_COMPOUND> EDA_TEXT::GetEffectiveTextShape( bool aTriangula
     {
         CALLBACK_GAL callback_gal(
                 empty_opts,
-                // Stroke callback
-                [&]( const VECTOR2I& aPt1, const VECTOR2I& aPt2 )
+                // Batched stroke callback
+                [&]( const std::vector<SEG>& aSegs )
                 {
-                    shape->AddShape( new SHAPE_SEGMENT( aPt1, aPt2, penWidth ) );
+                    for( const SEG& seg : aSegs )
+                        shape->AddShape( new SHAPE_SEGMENT( seg.A, seg.B, penWidth ) );
                 },
-                // Triangulation callback
-                [&]( const VECTOR2I& aPt1, const VECTOR2I& aPt2, const VECTOR2I& aPt3 )
+                // Batched triangulation callback (three points per triangle)
+                [&]( const std::vector<VECTOR2I>& aTris )
                 {
-                    SHAPE_SIMPLE* triShape = new SHAPE_SIMPLE;
+                    for( size_t ii = 0; ii + 2 < aTris.size(); ii += 3 )
+                    {
+                        SHAPE_SIMPLE* triShape = new SHAPE_SIMPLE;
 
-                    for( const VECTOR2I& point : { aPt1, aPt2, aPt3 } )
-                        triShape->Append( point.x, point.y );
+                        for( size_t jj = 0; jj < 3; jj++ )
+                            triShape->Append( aTris[ii + jj].x, aTris[ii + jj].y );
 
-                    shape->AddShape( triShape );
+                        shape->AddShape( triShape );
+                    }
                 } );
 
         if( cache )
@@ -125,6 +125,109 @@ private:
 
 static MARKUP_CACHE s_markupCache( 1024 );
 static std::mutex s_markupCacheMutex;
+
+
+// Process-wide cache of shaped single-line texts.  Dense boards repeat the same strings
+// (reference designators, "GND", pin numbers) across thousands of items; each distinct
+// string is shaped once, relative to the rotation/mirror origin, and every instance just
+// translates the shared glyph list into place.
+class SHAPED_TEXT_CACHE
+{
+public:
+    struct KEY
+    {
+        const FONT*      font;
+        wxString         text;
+        VECTOR2I         size;
+        VECTOR2I         relPosition;
+        EDA_ANGLE        angle;
+        bool             mirror;
+        TEXT_STYLE_FLAGS textStyle;
+        double           overbarHeight;
+        double           underlineOffset;
+
+        bool operator==( const KEY& rhs ) const
+        {
+            return font == rhs.font
+                    && text == rhs.text
+                    && size == rhs.size
+                    && relPosition == rhs.relPosition
+                    && angle == rhs.angle
+                    && mirror == rhs.mirror
+                    && textStyle == rhs.textStyle
+                    && overbarHeight == rhs.overbarHeight
+                    && underlineOffset == rhs.underlineOffset;
+        }
+    };
+
+    struct KEY_HASH
+    {
+        std::size_t operator()( const KEY& aKey ) const
+        {
+            return hash_val( aKey.font, aKey.text, aKey.size.x, aKey.size.y, aKey.relPosition.x,
+                             aKey.relPosition.y, aKey.angle.AsDegrees(), aKey.mirror,
+                             aKey.textStyle, aKey.overbarHeight, aKey.underlineOffset );
+        }
+    };
+
+    struct ENTRY
+    {
+        std::vector<std::unique_ptr<GLYPH>> glyphs;
+        BOX2I                               boundingBox;
+        VECTOR2I                            cursorDelta;
+    };
+
+    SHAPED_TEXT_CACHE( size_t aMaxSize ) :
+            m_maxSize( aMaxSize )
+    {
+    }
+
+    ENTRY& Put( const KEY& aQuery, ENTRY&& aResult )
+    {
+        auto it = m_cache.find( aQuery );
+
+        m_cacheMru.emplace_front( std::make_pair( aQuery, std::move( aResult ) ) );
+
+        if( it != m_cache.end() )
+        {
+            m_cacheMru.erase( it->second );
+            m_cache.erase( it );
+        }
+
+        m_cache[aQuery] = m_cacheMru.begin();
+
+        if( m_cache.size() > m_maxSize )
+        {
+            auto last = m_cacheMru.end();
+            last--;
+            m_cache.erase( last->first );
+            m_cacheMru.pop_back();
+        }
+
+        return m_cacheMru.begin()->second;
+    }
+
+    ENTRY* Get( const KEY& aQuery )
+    {
+        auto it = m_cache.find( aQuery );
+
+        if( it == m_cache.end() )
+            return nullptr;
+
+        m_cacheMru.splice( m_cacheMru.begin(), m_cacheMru, it->second );
+
+        return &m_cacheMru.begin()->second;
+    }
+
+private:
+    size_t                                                                      m_maxSize;
+    std::list<std::pair<KEY, ENTRY>>                                            m_cacheMru;
+    std::unordered_map<KEY, std::list<std::pair<KEY, ENTRY>>::iterator, KEY_HASH> m_cache;
+};
+
+
+static SHAPED_TEXT_CACHE s_shapedTextCache( 4096 );
+static std::mutex s_shapedTextCacheMutex;
 static std::mutex s_defaultFontMutex;;
 
 
@@ -394,6 +497,64 @@ VECTOR2I FONT::drawMarkup( BOX2I* aBoundingBox, std::vector<std::unique_ptr<GLYP
 
     wxASSERT( markup && markup->root );
 
+    if( aGlyphs )
+    {
+        // Shape relative to the rotation/mirror origin; the transform is linear about the
+        // origin, so the shaped result is position independent and can be shared between
+        // every instance of the same string.
+        VECTOR2I relPosition = aPosition - aOrigin;
+
+        SHAPED_TEXT_CACHE::KEY key = { this, aText, aSize, relPosition, aAngle, aMirror,
+                                       aTextStyle, aFontMetrics.m_OverbarHeight,
+                                       aFontMetrics.m_UnderlineOffset };
+
+        std::lock_guard<std::mutex> shapedLock( s_shapedTextCacheMutex );
+
+        SHAPED_TEXT_CACHE::ENTRY* shaped = s_shapedTextCache.Get( key );
+
+        if( !shaped )
+        {
+            SHAPED_TEXT_CACHE::ENTRY entry;
+
+            VECTOR2I cursor = ::drawMarkup( &entry.boundingBox, &entry.glyphs,
+                                            markup->root.get(), relPosition, this, aSize, aAngle,
+                                            aMirror, VECTOR2I( 0, 0 ), aTextStyle, aFontMetrics );
+
+            entry.cursorDelta = cursor - relPosition;
+            shaped = &s_shapedTextCache.Put( key, std::move( entry ) );
+        }
+
+        for( const std::unique_ptr<GLYPH>& glyph : shaped->glyphs )
+        {
+            if( glyph->IsOutline() )
+            {
+                auto copy = std::make_unique<OUTLINE_GLYPH>(
+                        static_cast<const OUTLINE_GLYPH&>( *glyph ) );
+
+                copy->Move( aOrigin );
+                aGlyphs->push_back( std::move( copy ) );
+            }
+            else
+            {
+                auto copy = std::make_unique<STROKE_GLYPH>(
+                        static_cast<const STROKE_GLYPH&>( *glyph ) );
+
+                copy->Move( aOrigin );
+                aGlyphs->push_back( std::move( copy ) );
+            }
+        }
+
+        if( aBoundingBox )
+        {
+            BOX2I bbox = shaped->boundingBox;
+
+            bbox.Offset( aOrigin );
+            aBoundingBox->Merge( bbox );
+        }
+
+        return aPosition + shaped->cursorDelta;
+    }
+
     return ::drawMarkup( aBoundingBox, aGlyphs, markup->root.get(), aPosition, this, aSize, aAngle,
                          aMirror, aOrigin, aTextStyle, aFontMetrics );
 }
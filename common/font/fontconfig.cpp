@@ -19,7 +19,9 @@
  * with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <map>
 #include <mutex>
+#include <tuple>
 #include <font/fontconfig.h>
 #include <wx/log.h>
 #include <trace_helpers.h>
@@ -41,6 +43,21 @@ static bool        g_fcInitSuccess = false;
 REPORTER* FONTCONFIG::s_reporter = nullptr;
 static std::mutex g_fontConfigMutex;
 
+/**
+ * Memoized FindFont() results.  Fontconfig matching walks the whole installed font set, which
+ * is too slow to repeat for every face variant of the same request; cross-session persistence
+ * is provided by Fontconfig's own on-disk caches, so this only needs to live for the session.
+ */
+struct MATCH_CACHE_ENTRY
+{
+    FONTCONFIG::FF_RESULT retval;
+    wxString              fontFile;
+    int                   faceIndex;
+};
+
+static std::map<std::tuple<wxString, bool, bool>, MATCH_CACHE_ENTRY> g_matchCache;
+static std::mutex                                                    g_matchCacheMutex;
+
 /**
  * A simple wrapper to avoid exporting fontconfig in the header
  */
@@ -212,6 +229,28 @@ FONTCONFIG::FF_RESULT FONTCONFIG::FindFont( const wxString& aFontName, wxString&
     if( !g_fcInitSuccess )
         return retval;
 
+    std::tuple<wxString, bool, bool> cacheKey = { aFontName, aBold, aItalic };
+
+    // Embedded fonts are project-specific and can change underneath us, so only
+    // name-based lookups are memoized.
+    if( !aEmbeddedFiles )
+    {
+        std::lock_guard<std::mutex> lock( g_matchCacheMutex );
+
+        auto it = g_matchCache.find( cacheKey );
+
+        if( it != g_matchCache.end() )
+        {
+            if( it->second.retval != FF_RESULT::FF_ERROR )
+            {
+                aFontFile = it->second.fontFile;
+                aFaceIndex = it->second.faceIndex;
+            }
+
+            return it->second.retval;
+        }
+    }
+
     // If the original font name contains any of these, then it is bold, regardless
     // of whether we are looking for bold or not
     if( aFontName.Lower().Contains( wxS( "bold" ) )       // also catches ultrabold
@@ -373,6 +412,17 @@ FONTCONFIG::FF_RESULT FONTCONFIG::FindFont( const wxString& aFontName, wxString&
     }
 
     FcPatternDestroy( pat );
+
+    if( !aEmbeddedFiles )
+    {
+        std::lock_guard<std::mutex> lock( g_matchCacheMutex );
+
+        if( retval == FF_RESULT::FF_ERROR )
+            g_matchCache[cacheKey] = { retval, wxEmptyString, 0 };
+        else
+            g_matchCache[cacheKey] = { retval, aFontFile, aFaceIndex };
+    }
+
     return retval;
 }
 
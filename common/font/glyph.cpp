@@ -179,3 +179,11 @@ void OUTLINE_GLYPH::CacheTriangulation(
 {
     cacheTriangulation( false, false, &aHintData );
 }
+
+
+void OUTLINE_GLYPH::CacheTriangulation(
+        const std::vector<std::unique_ptr<SHAPE_POLY_SET::TRIANGULATED_POLYGON>>& aFontUnitMesh,
+        const std::function<VECTOR2I( const VECTOR2I& )>& aVertexTransform )
+{
+    SHAPE_POLY_SET::CacheTriangulation( aFontUnitMesh, aVertexTransform );
+}
@@ -363,28 +363,25 @@ static const HARFBUZZ_CACHE_ENTRY& getHarfbuzzShape( FT_Face aFace, const wxStri
 }
 
 
+// The glyph cache is keyed only on properties that change the decomposed contours; the
+// per-instance transform (size, position, rotation, mirroring) is applied to the cached
+// contours and meshes when the glyphs are built.
 struct GLYPH_CACHE_KEY {
     FT_Face        face;
     hb_codepoint_t codepoint;
-    VECTOR2D       scale;
     bool           forDrawingSheet;
     bool           fakeItalic;
     bool           fakeBold;
-    bool           mirror;
     bool           supersub;
-    EDA_ANGLE      angle;
 
     bool operator==(const GLYPH_CACHE_KEY& rhs ) const
     {
         return face == rhs.face
                 && codepoint == rhs.codepoint
-                && scale == rhs.scale
                 && forDrawingSheet == rhs.forDrawingSheet
                 && fakeItalic == rhs.fakeItalic
                 && fakeBold == rhs.fakeBold
-                && mirror == rhs.mirror
-                && supersub == rhs.supersub
-                && angle == rhs.angle;
+                && supersub == rhs.supersub;
     }
 };
 
@@ -396,13 +393,47 @@ namespace std
     {
         std::size_t operator()( const GLYPH_CACHE_KEY& k ) const
         {
-            return hash_val( k.face, k.codepoint, k.scale.x, k.scale.y, k.forDrawingSheet,
-                             k.fakeItalic, k.fakeBold, k.mirror, k.supersub, k.angle.AsDegrees() );
+            return hash_val( k.face, k.codepoint, k.forDrawingSheet, k.fakeItalic, k.fakeBold,
+                             k.supersub );
         }
     };
 }
 
 
+// The faceSize() grid used for decomposing the contours is too coarse to tessellate on
+// directly (rounding would collapse closely-spaced points), so the cached font-unit meshes
+// are built at a finer resolution and scaled back down when instanced.
+static constexpr double GLYPH_MESH_SCALER = 1024.0;
+
+
+static void addGlyphHoles( OUTLINE_GLYPH& aGlyph, std::vector<SHAPE_LINE_CHAIN>& aHoles )
+{
+    for( SHAPE_LINE_CHAIN& hole : aHoles )
+    {
+        bool added_hole = false;
+
+        if( hole.PointCount() )
+        {
+            for( int ii = 0; ii < aGlyph.OutlineCount(); ++ii )
+            {
+                if( aGlyph.Outline( ii ).PointInside( hole.GetPoint( 0 ) ) )
+                {
+                    aGlyph.AddHole( std::move( hole ), ii );
+                    added_hole = true;
+                    break;
+                }
+            }
+
+            // Some lovely TTF fonts decided that winding didn't matter for outlines that
+            // don't have holes, so holes that don't fit in any outline are added as
+            // outlines.
+            if( !added_hole )
+                aGlyph.AddOutline( std::move( hole ) );
+        }
+    }
+}
+
+
 VECTOR2I OUTLINE_FONT::getTextAsGlyphsUnlocked( BOX2I* aBBox,
                                                 std::vector<std::unique_ptr<GLYPH>>* aGlyphs,
                                                 const wxString& aText, const VECTOR2I& aSize,
@@ -443,8 +474,8 @@ VECTOR2I OUTLINE_FONT::getTextAsGlyphsUnlocked( BOX2I* aBBox,
     {
         if( aGlyphs )
         {
-            GLYPH_CACHE_KEY key = { face, glyphInfo[i].codepoint, scaleFactor, m_forDrawingSheet,
-                                    m_fakeItal, m_fakeBold, aMirror, supersub, aAngle };
+            GLYPH_CACHE_KEY key = { face, glyphInfo[i].codepoint, m_forDrawingSheet,
+                                    m_fakeItal, m_fakeBold, supersub };
             GLYPH_DATA&     glyphData = s_glyphCache[ key ];
 
             if( glyphData.m_Contours.empty() )
@@ -500,33 +531,70 @@ VECTOR2I OUTLINE_FONT::getTextAsGlyphsUnlocked( BOX2I* aBBox,
                 }
             }
 
+            if( glyphData.m_TriangulationData.empty() )
+            {
+                // Tessellate the glyph exactly once, in font units; every instance of the
+                // glyph at any size, position, rotation or mirroring then reuses the mesh
+                // with its vertices run through the instance transform below.
+                OUTLINE_GLYPH                 fontUnitGlyph;
+                std::vector<SHAPE_LINE_CHAIN> fontUnitHoles;
+
+                for( CONTOUR& c : glyphData.m_Contours )
+                {
+                    SHAPE_LINE_CHAIN shape;
+
+                    shape.ReservePoints( c.m_Points.size() );
+
+                    for( const VECTOR2D& v : c.m_Points )
+                        shape.Append( v.x * GLYPH_MESH_SCALER, v.y * GLYPH_MESH_SCALER );
+
+                    shape.SetClosed( true );
+
+                    if( contourIsHole( c ) )
+                        fontUnitHoles.push_back( std::move( shape ) );
+                    else
+                        fontUnitGlyph.AddOutline( std::move( shape ) );
+                }
+
+                addGlyphHoles( fontUnitGlyph, fontUnitHoles );
+                fontUnitGlyph.CacheTriangulation( false, false );
+                glyphData.m_TriangulationData = fontUnitGlyph.GetTriangulationData();
+            }
+
+            auto transformPoint =
+                    [&]( const VECTOR2D& aPt ) -> VECTOR2D
+                    {
+                        VECTOR2D pt( aPt + cursor );
+
+                        if( IsSubscript( aTextStyle ) )
+                            pt.y += m_subscriptVerticalOffset * scaler;
+                        else if( IsSuperscript( aTextStyle ) )
+                            pt.y += m_superscriptVerticalOffset * scaler;
+
+                        pt *= scaleFactor;
+                        pt += aPosition;
+
+                        if( aMirror )
+                            pt.x = aOrigin.x - ( pt.x - aOrigin.x );
+
+                        if( !aAngle.IsZero() )
+                            RotatePoint( pt, aOrigin, aAngle );
+
+                        return pt;
+                    };
+
             std::unique_ptr<OUTLINE_GLYPH> glyph = std::make_unique<OUTLINE_GLYPH>();
             std::vector<SHAPE_LINE_CHAIN>  holes;
 
             for( CONTOUR& c : glyphData.m_Contours )
             {
-                std::vector<VECTOR2D> points = c.m_Points;
-                SHAPE_LINE_CHAIN      shape;
+                SHAPE_LINE_CHAIN shape;
 
-                shape.ReservePoints( points.size() );
+                shape.ReservePoints( c.m_Points.size() );
 
-                for( const VECTOR2D& v : points )
+                for( const VECTOR2D& v : c.m_Points )
                 {
-                    VECTOR2D pt( v + cursor );
-
-                    if( IsSubscript( aTextStyle ) )
-                        pt.y += m_subscriptVerticalOffset * scaler;
-                    else if( IsSuperscript( aTextStyle ) )
-                        pt.y += m_superscriptVerticalOffset * scaler;
-
-                    pt *= scaleFactor;
-                    pt += aPosition;
-
-                    if( aMirror )
-                        pt.x = aOrigin.x - ( pt.x - aOrigin.x );
-
-                    if( !aAngle.IsZero() )
-                        RotatePoint( pt, aOrigin, aAngle );
+                    VECTOR2D pt = transformPoint( v );
 
                     shape.Append( pt.x, pt.y );
                 }
@@ -539,38 +607,23 @@ VECTOR2I OUTLINE_FONT::getTextAsGlyphsUnlocked( BOX2I* aBBox,
                     glyph->AddOutline( std::move( shape ) );
             }
 
-            for( SHAPE_LINE_CHAIN& hole : holes )
-            {
-                bool added_hole = false;
+            addGlyphHoles( *glyph, holes );
 
-                if( hole.PointCount() )
-                {
-                    for( int ii = 0; ii < glyph->OutlineCount(); ++ii )
-                    {
-                        if( glyph->Outline( ii ).PointInside( hole.GetPoint( 0 ) ) )
+            if( !glyphData.m_TriangulationData.empty() )
+            {
+                glyph->CacheTriangulation( glyphData.m_TriangulationData,
+                        [&]( const VECTOR2I& aVertex ) -> VECTOR2I
                         {
-                            glyph->AddHole( std::move( hole ), ii );
-                            added_hole = true;
-                            break;
-                        }
-                    }
-
-                    // Some lovely TTF fonts decided that winding didn't matter for outlines that
-                    // don't have holes, so holes that don't fit in any outline are added as
-                    // outlines.
-                    if( !added_hole )
-                        glyph->AddOutline( std::move( hole ) );
-                }
-            }
+                            VECTOR2D pt = transformPoint( VECTOR2D( aVertex ) / GLYPH_MESH_SCALER );
 
-            if( glyphData.m_TriangulationData.empty() )
-            {
-                glyph->CacheTriangulation( false, false );
-                glyphData.m_TriangulationData = glyph->GetTriangulationData();
+                            return VECTOR2I( pt.x, pt.y );
+                        } );
             }
             else
             {
-                glyph->CacheTriangulation( glyphData.m_TriangulationData );
+                // Tessellation of the shared font-unit mesh failed; fall back to
+                // tessellating this instance directly.
+                glyph->CacheTriangulation( false, false );
             }
 
             aGlyphs->push_back( std::move( glyph ) );
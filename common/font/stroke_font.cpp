@@ -55,6 +55,8 @@ std::mutex                          g_defaultFontLoadMutex;
 
 
 STROKE_FONT::STROKE_FONT() :
+        m_fontData( nullptr ),
+        m_fontDataSize( 0 ),
         m_glyphs( nullptr ),
         m_glyphBoundingBoxes( nullptr ),
         m_maxGlyphWidth( 0.0 )
@@ -98,17 +100,38 @@ void buildGlyphBoundingBox( std::shared_ptr<STROKE_GLYPH>& aGlyph, double aGlyph
 
 void STROKE_FONT::loadNewStrokeFont( const char* const aNewStrokeFont[], int aNewStrokeFontSize )
 {
+    // Just record where the data lives; parsing the tens of thousands of glyph strings
+    // is deferred until a glyph is actually needed (see ensureGlyphsLoaded()), so
+    // processes that never render stroke text -- most CLI jobs -- skip it entirely.
+    m_fontData = aNewStrokeFont;
+    m_fontDataSize = aNewStrokeFontSize;
+    m_fontName = KICAD_FONT_NAME;
+    m_fontFileName = wxEmptyString;
+}
+
+
+void STROKE_FONT::ensureGlyphsLoaded() const
+{
+    if( m_glyphs )
+        return;
+
+    const char* const* fontData = m_fontData;
+    int                fontDataSize = m_fontDataSize;
+
+    if( !fontData )
+        return;
+
     // Protect the initialization sequence against multiple entries
     std::lock_guard<std::mutex> lock( g_defaultFontLoadMutex );
 
     if( !g_defaultFontInitialized )
     {
-        g_defaultFontGlyphs.reserve( aNewStrokeFontSize );
+        g_defaultFontGlyphs.reserve( fontDataSize );
 
         g_defaultFontGlyphBoundingBoxes = new std::vector<BOX2D>;
-        g_defaultFontGlyphBoundingBoxes->reserve( aNewStrokeFontSize );
+        g_defaultFontGlyphBoundingBoxes->reserve( fontDataSize );
 
-        for( int j = 0; j < aNewStrokeFontSize; j++ )
+        for( int j = 0; j < fontDataSize; j++ )
         {
             std::shared_ptr<STROKE_GLYPH> glyph = std::make_shared<STROKE_GLYPH>();
 
@@ -118,9 +141,9 @@ void STROKE_FONT::loadNewStrokeFont( const char* const aNewStrokeFont[], int aNe
             int    strokes = 0;
             int    i = 0;
 
-            while( aNewStrokeFont[j][i] )
+            while( fontData[j][i] )
             {
-                if( aNewStrokeFont[j][i] == ' ' && aNewStrokeFont[j][i+1] == 'R' )
+                if( fontData[j][i] == ' ' && fontData[j][i+1] == 'R' )
                     strokes++;
 
                 i += 2;
@@ -130,13 +153,13 @@ void STROKE_FONT::loadNewStrokeFont( const char* const aNewStrokeFont[], int aNe
 
             i = 0;
 
-            while( aNewStrokeFont[j][i] )
+            while( fontData[j][i] )
             {
                 VECTOR2D point( 0.0, 0.0 );
                 char     coordinate[2] = { 0, };
 
                 for( int k : { 0, 1 } )
-                    coordinate[k] = aNewStrokeFont[j][i + k];
+                    coordinate[k] = fontData[j][i + k];
 
                 if( i < 2 )
                 {
@@ -186,8 +209,6 @@ void STROKE_FONT::loadNewStrokeFont( const char* const aNewStrokeFont[], int aNe
 
     m_glyphs = &g_defaultFontGlyphs;
     m_glyphBoundingBoxes = g_defaultFontGlyphBoundingBoxes;
-    m_fontName = KICAD_FONT_NAME;
-    m_fontFileName = wxEmptyString;
 }
 
 
@@ -205,6 +226,8 @@ VECTOR2I STROKE_FONT::GetTextAsGlyphs( BOX2I* aBBox, std::vector<std::unique_ptr
                                        bool aMirror, const VECTOR2I& aOrigin,
                                        TEXT_STYLE_FLAGS aTextStyle ) const
 {
+    ensureGlyphsLoaded();
+
     constexpr int    TAB_WIDTH = 4;
     constexpr double INTER_CHAR = 0.2;
     constexpr double SUPER_SUB_SIZE_MULTIPLIER = 0.8;
@@ -293,12 +316,16 @@ VECTOR2I STROKE_FONT::GetTextAsGlyphs( BOX2I* aBBox, std::vector<std::unique_ptr
 
 unsigned STROKE_FONT::GetGlyphCount() const
 {
+    ensureGlyphsLoaded();
+
     return m_glyphs ? m_glyphs->size() : 0;
 }
 
 
 const STROKE_GLYPH* STROKE_FONT::GetGlyph( unsigned aIndex ) const
 {
+    ensureGlyphsLoaded();
+
     if( !m_glyphs || aIndex >= m_glyphs->size() )
         return nullptr;
 
@@ -310,6 +337,8 @@ const BOX2D& STROKE_FONT::GetGlyphBoundingBox( unsigned aIndex ) const
 {
     static const BOX2D empty;
 
+    ensureGlyphsLoaded();
+
     if( !m_glyphBoundingBoxes || aIndex >= m_glyphBoundingBoxes->size() )
         return empty;
 
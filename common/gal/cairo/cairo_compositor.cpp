@@ -31,6 +31,7 @@
  */
 
 #include <gal/cairo/cairo_compositor.h>
+#include <thread_pool.h>
 #include <wx/log.h>
 
 using namespace KIGFX;
@@ -169,6 +170,65 @@ void CAIRO_COMPOSITOR::DrawBuffer( unsigned int aBufferHandle )
 {
     wxASSERT_MSG( aBufferHandle <= usedBuffers(), wxT( "Tried to use a not existing buffer" ) );
 
+    cairo_surface_t* dstSurface = cairo_get_target( m_mainContext );
+    unsigned char*   dstData = cairo_image_surface_get_data( dstSurface );
+
+    // When the destination is a plain image surface, blend the buffer in directly, split
+    // into bands processed by the thread pool.  cairo_paint() runs the composite
+    // single-threaded, which makes it a bottleneck of software rendering on large
+    // canvases.
+    if( dstData && cairo_image_surface_get_format( dstSurface ) == CAIRO_FORMAT_ARGB32
+            && (unsigned int) cairo_image_surface_get_stride( dstSurface ) == m_stride )
+    {
+        cairo_surface_flush( dstSurface );
+        cairo_surface_flush( m_buffers[aBufferHandle - 1].surface );
+
+        const uint8_t* srcData = m_buffers[aBufferHandle - 1].bitmap;
+        unsigned int   stride = m_stride;
+        unsigned int   width = m_width;
+
+        thread_pool& tp = GetKiCadThreadPool();
+
+        tp.submit_loop( 0, m_height,
+                        [&]( size_t y )
+                        {
+                            const uint32_t* src = (const uint32_t*) ( srcData + y * stride );
+                            uint32_t*       dst = (uint32_t*) ( dstData + y * stride );
+
+                            for( unsigned int x = 0; x < width; ++x )
+                            {
+                                uint32_t s = src[x];
+                                uint32_t a = s >> 24;
+
+                                if( a == 0xff )
+                                {
+                                    dst[x] = s;
+                                }
+                                else if( a != 0 )
+                                {
+                                    // OVER for premultiplied ARGB32, channel pairs at once:
+                                    // dst = src + dst * ( 255 - alpha ) / 255
+                                    uint32_t d = dst[x];
+                                    uint32_t na = 255 - a;
+
+                                    uint32_t rb = ( d & 0x00ff00ff ) * na + 0x00800080;
+                                    rb = ( ( rb + ( ( rb >> 8 ) & 0x00ff00ff ) ) >> 8 )
+                                         & 0x00ff00ff;
+
+                                    uint32_t ag = ( ( d >> 8 ) & 0x00ff00ff ) * na + 0x00800080;
+                                    ag = ( ( ag + ( ( ag >> 8 ) & 0x00ff00ff ) ) >> 8 )
+                                         & 0x00ff00ff;
+
+                                    dst[x] = s + ( ( ag << 8 ) | rb );
+                                }
+                            }
+                        } )
+                .wait();
+
+        cairo_surface_mark_dirty( dstSurface );
+        return;
+    }
+
     // Reset the transformation matrix, so it is possible to composite images using
     // screen coordinates instead of world coordinates
     cairo_get_matrix( m_mainContext, &m_matrix );
@@ -36,6 +36,7 @@
 #include <geometry/shape_poly_set.h>
 #include <math/vector2wx.h>
 #include <math/util.h> // for KiROUND
+#include <thread_pool.h>
 #include <trigo.h>
 #include <bitmap_base.h>
 
@@ -1448,36 +1449,38 @@ void CAIRO_GAL::EndDrawing()
     m_compositor->DrawBuffer( m_overlayBuffer );
 
     // Now translate the raw context data from the format stored
-    // by cairo into a format understood by wxImage.
+    // by cairo into a format understood by wxImage.  The rows are independent, so the
+    // conversion is split over the thread pool.
     int height = m_screenSize.y;
     int stride = m_stride;
 
-    unsigned char* srcRow = m_bitmapBuffer;
-    unsigned char* dst = m_wxOutput;
+    thread_pool& tp = GetKiCadThreadPool();
 
-    for( int y = 0; y < height; y++ )
-    {
-        for( int x = 0; x < stride; x += 4 )
-        {
-            const unsigned char* src = srcRow + x;
+    tp.submit_loop( 0, height,
+                    [&]( size_t y )
+                    {
+                        const unsigned char* src = m_bitmapBuffer + y * stride;
+                        unsigned char*       dst = m_wxOutput + y * m_wxBufferWidth * 3;
 
+                        for( int x = 0; x < stride; x += 4 )
+                        {
 #if defined( __BYTE_ORDER__ ) && ( __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__ )
-            // XRGB
-            dst[0] = src[1];
-            dst[1] = src[2];
-            dst[2] = src[3];
+                            // XRGB
+                            dst[0] = src[1];
+                            dst[1] = src[2];
+                            dst[2] = src[3];
 #else
-            // BGRX
-            dst[0] = src[2];
-            dst[1] = src[1];
-            dst[2] = src[0];
+                            // BGRX
+                            dst[0] = src[2];
+                            dst[1] = src[1];
+                            dst[2] = src[0];
 #endif
 
-            dst += 3;
-        }
-
-        srcRow += stride;
-    }
+                            src += 4;
+                            dst += 3;
+                        }
+                    } )
+            .wait();
 
     wxImage    img( m_wxBufferWidth, m_screenSize.y, m_wxOutput, true );
     wxBitmap   bmp( img );
@@ -52,9 +52,11 @@ static const wxChar* const traceGalCachedContainerGpu = wxT( "KICAD_GAL_CACHED_C
 CACHED_CONTAINER_GPU::CACHED_CONTAINER_GPU( unsigned int aSize ) :
         CACHED_CONTAINER( aSize ),
         m_isMapped( false ),
-        m_glBufferHandle( -1 )
+        m_glBufferHandle( -1 ),
+        m_fence( nullptr )
 {
     m_useCopyBuffer = GLEW_ARB_copy_buffer;
+    m_usePersistentBuffer = GLEW_ARB_buffer_storage;
 
     wxString vendor( glGetString( GL_VENDOR ) );
 
@@ -71,7 +73,20 @@ CACHED_CONTAINER_GPU::CACHED_CONTAINER_GPU( unsigned int aSize ) :
 
     glGenBuffers( 1, &m_glBufferHandle );
     glBindBuffer( GL_ARRAY_BUFFER, m_glBufferHandle );
-    glBufferData( GL_ARRAY_BUFFER, m_currentSize * VERTEX_SIZE, nullptr, GL_DYNAMIC_DRAW );
+
+    if( m_usePersistentBuffer )
+    {
+        // An immutable data store that stays mapped while the GPU draws from it; geometry
+        // updates then never stall in glMapBuffer/glUnmapBuffer driver validation.
+        glBufferStorage( GL_ARRAY_BUFFER, m_currentSize * VERTEX_SIZE, nullptr,
+                         GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT
+                                 | GL_MAP_COHERENT_BIT );
+    }
+    else
+    {
+        glBufferData( GL_ARRAY_BUFFER, m_currentSize * VERTEX_SIZE, nullptr, GL_DYNAMIC_DRAW );
+    }
+
     glBindBuffer( GL_ARRAY_BUFFER, 0 );
     checkGlError( "allocating video memory for cached container", __FILE__, __LINE__ );
 }
@@ -82,6 +97,9 @@ CACHED_CONTAINER_GPU::~CACHED_CONTAINER_GPU()
     if( m_isMapped )
         Unmap();
 
+    if( m_fence && glDeleteSync )
+        glDeleteSync( m_fence );
+
     if( glDeleteBuffers )
         glDeleteBuffers( 1, &m_glBufferHandle );
 }
@@ -96,7 +114,31 @@ void CACHED_CONTAINER_GPU::Map()
         throw std::runtime_error( "OpenGL no longer available!" );
 
     glBindBuffer( GL_ARRAY_BUFFER, m_glBufferHandle );
-    m_vertices = static_cast<VERTEX*>( glMapBuffer( GL_ARRAY_BUFFER, GL_READ_WRITE ) );
+
+    if( m_usePersistentBuffer )
+    {
+        // The mapping is established once and survives drawing; before letting the CPU
+        // modify the buffer again, wait until the GPU has finished the last frame that
+        // reads from it.
+        if( !m_vertices )
+        {
+            m_vertices = static_cast<VERTEX*>(
+                    glMapBufferRange( GL_ARRAY_BUFFER, 0, m_currentSize * VERTEX_SIZE,
+                                      GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT
+                                              | GL_MAP_COHERENT_BIT ) );
+        }
+
+        if( m_fence )
+        {
+            glClientWaitSync( m_fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000 );
+            glDeleteSync( m_fence );
+            m_fence = nullptr;
+        }
+    }
+    else
+    {
+        m_vertices = static_cast<VERTEX*>( glMapBuffer( GL_ARRAY_BUFFER, GL_READ_WRITE ) );
+    }
 
     if( checkGlError( "mapping vertices buffer", __FILE__, __LINE__ ) == GL_NO_ERROR )
         m_isMapped = true;
@@ -111,10 +153,16 @@ void CACHED_CONTAINER_GPU::Unmap()
     // the dtor, catch it here instead.
     try
     {
-        glUnmapBuffer( GL_ARRAY_BUFFER );
-        checkGlError( "unmapping vertices buffer", __FILE__, __LINE__ );
+        // Persistent mappings stay valid while the GPU draws; there is nothing to hand
+        // back to the driver.
+        if( !m_usePersistentBuffer )
+        {
+            glUnmapBuffer( GL_ARRAY_BUFFER );
+            checkGlError( "unmapping vertices buffer", __FILE__, __LINE__ );
+            m_vertices = nullptr;
+        }
+
         glBindBuffer( GL_ARRAY_BUFFER, 0 );
-        m_vertices = nullptr;
         checkGlError( "unbinding vertices buffer", __FILE__, __LINE__ );
     }
     catch( const std::runtime_error& err )
@@ -126,9 +174,25 @@ void CACHED_CONTAINER_GPU::Unmap()
 }
 
 
+void CACHED_CONTAINER_GPU::FinishDrawing()
+{
+    if( !m_usePersistentBuffer )
+        return;
+
+    // All draw calls referencing the buffer have been issued; the fence tells the next
+    // Map() when its storage may be rewritten.
+    if( m_fence )
+        glDeleteSync( m_fence );
+
+    m_fence = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+}
+
+
 bool CACHED_CONTAINER_GPU::defragmentResize( unsigned int aNewSize )
 {
-    if( !m_useCopyBuffer )
+    // Persistently mapped buffers are defragmented through their CPU-visible mappings;
+    // GPU-side copies into an always-mapped destination would need extra synchronization.
+    if( !m_useCopyBuffer || m_usePersistentBuffer )
         return defragmentResizeMemcpy( aNewSize );
 
     wxCHECK( IsMapped(), false );
@@ -261,20 +325,45 @@ bool CACHED_CONTAINER_GPU::defragmentResizeMemcpy( unsigned int aNewSize )
 #endif /* KICAD_GAL_PROFILE */
 
     glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, newBuffer );
-    glBufferData( GL_ELEMENT_ARRAY_BUFFER, aNewSize * VERTEX_SIZE, nullptr, GL_DYNAMIC_DRAW );
-    newBufferMem = static_cast<VERTEX*>( glMapBuffer( GL_ELEMENT_ARRAY_BUFFER, GL_WRITE_ONLY ) );
+
+    if( m_usePersistentBuffer )
+    {
+        glBufferStorage( GL_ELEMENT_ARRAY_BUFFER, aNewSize * VERTEX_SIZE, nullptr,
+                         GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT
+                                 | GL_MAP_COHERENT_BIT );
+        newBufferMem = static_cast<VERTEX*>(
+                glMapBufferRange( GL_ELEMENT_ARRAY_BUFFER, 0, aNewSize * VERTEX_SIZE,
+                                  GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT
+                                          | GL_MAP_COHERENT_BIT ) );
+    }
+    else
+    {
+        glBufferData( GL_ELEMENT_ARRAY_BUFFER, aNewSize * VERTEX_SIZE, nullptr,
+                      GL_DYNAMIC_DRAW );
+        newBufferMem = static_cast<VERTEX*>( glMapBuffer( GL_ELEMENT_ARRAY_BUFFER,
+                                                          GL_WRITE_ONLY ) );
+    }
+
     checkGlError( "creating buffer during defragmentation", __FILE__, __LINE__ );
 
     defragment( newBufferMem );
 
     // Cleanup
-    glUnmapBuffer( GL_ELEMENT_ARRAY_BUFFER );
+    if( !m_usePersistentBuffer )
+        glUnmapBuffer( GL_ELEMENT_ARRAY_BUFFER );
+
     glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, 0 );
     Unmap();
+
+    // Deleting the old buffer also releases its persistent mapping
     glDeleteBuffers( 1, &m_glBufferHandle );
 
     // Switch to the new vertex buffer
     m_glBufferHandle = newBuffer;
+
+    if( m_usePersistentBuffer )
+        m_vertices = newBufferMem;
+
     Map();
     checkGlError( "switching buffers during defragmentation", __FILE__, __LINE__ );
 
@@ -84,13 +84,7 @@ void GPU_MANAGER::SetShader( SHADER& aShader )
 // Cached manager
 GPU_CACHED_MANAGER::GPU_CACHED_MANAGER( VERTEX_CONTAINER* aContainer ) :
         GPU_MANAGER( aContainer ),
-        m_buffersInitialized( false ),
-        m_indicesCapacity( 0 ),
-        m_totalHuge( 0 ),
-        m_totalNormal( 0 ),
-        m_indexBufSize( 0 ),
-        m_indexBufMaxSize( 0 ),
-        m_curVrangeSize( 0 )
+        m_buffersInitialized( false )
 {
 }
 
@@ -104,10 +98,8 @@ void GPU_CACHED_MANAGER::BeginDrawing()
 {
     wxASSERT( !m_isDrawing );
 
-    m_curVrangeSize = 0;
-    m_indexBufMaxSize = 0;
-    m_indexBufSize = 0;
-    m_vranges.clear();
+    m_vrangeFirsts.clear();
+    m_vrangeCounts.clear();
 
     m_isDrawing = true;
 }
@@ -124,19 +116,10 @@ void GPU_CACHED_MANAGER::DrawIndices( const VERTEX_ITEM* aItem )
     if( size == 0 )
         return;
 
-    if( size <= 1000 )
-    {
-        m_totalNormal += size;
-        m_vranges.emplace_back( offset, offset + size - 1, false );
-        m_curVrangeSize += size;
-    }
-    else
-    {
-        m_totalHuge += size;
-        m_vranges.emplace_back( offset, offset + size - 1, true );
-        m_indexBufSize = std::max( m_curVrangeSize, m_indexBufSize );
-        m_curVrangeSize = 0;
-    }
+    // Pool the item's vertex range; all the ranges are submitted in draw order by a
+    // single glMultiDrawArrays call in EndDrawing()
+    m_vrangeFirsts.push_back( offset );
+    m_vrangeCounts.push_back( size );
 }
 
 
@@ -149,11 +132,6 @@ void GPU_CACHED_MANAGER::EndDrawing()
     if( cached->IsMapped() )
         cached->Unmap();
 
-    m_indexBufSize = std::max( m_curVrangeSize, m_indexBufSize );
-    m_indexBufMaxSize = std::max( 2*m_indexBufSize, m_indexBufMaxSize );
-
-    resizeIndices( m_indexBufMaxSize );
-
     if( m_enableDepthTest )
         glEnable( GL_DEPTH_TEST );
     else
@@ -178,58 +156,37 @@ void GPU_CACHED_MANAGER::EndDrawing()
 
     PROF_TIMER cntDraw( "gl-draw-elements" );
 
-    int     n_ranges = m_vranges.size();
-    int     n = 0;
-    GLuint* iptr = m_indices.get();
-    GLuint  icnt = 0;
-
     int drawCalls = 0;
 
-    while( n < n_ranges )
+    // The ranges reference the vertex buffer directly, so there is no per-frame index
+    // array to build and transfer; the driver walks the range list instead.
+    if( !m_vrangeFirsts.empty() )
     {
-        VRANGE* cur = &m_vranges[n];
-
-        if( cur->m_isContinuous )
+        if( glMultiDrawArrays )
         {
-            if( icnt > 0 )
-            {
-                glDrawElements( GL_TRIANGLES, icnt, GL_UNSIGNED_INT, m_indices.get() );
-                drawCalls++;
-            }
-
-            icnt = 0;
-            iptr = m_indices.get();
-
-            glDrawArrays( GL_TRIANGLES, cur->m_start, cur->m_end - cur->m_start + 1 );
-            drawCalls++;
+            glMultiDrawArrays( GL_TRIANGLES, m_vrangeFirsts.data(), m_vrangeCounts.data(),
+                               (GLsizei) m_vrangeFirsts.size() );
+            drawCalls = 1;
         }
         else
         {
-            for( GLuint i = cur->m_start; i <= cur->m_end; i++ )
+            for( size_t ii = 0; ii < m_vrangeFirsts.size(); ++ii )
             {
-                *iptr++ = i;
-                icnt++;
+                glDrawArrays( GL_TRIANGLES, m_vrangeFirsts[ii], m_vrangeCounts[ii] );
+                drawCalls++;
             }
         }
-
-        n++;
-    }
-
-    if( icnt > 0 )
-    {
-        glDrawElements( GL_TRIANGLES, icnt, GL_UNSIGNED_INT, m_indices.get() );
-        drawCalls++;
     }
 
     cntDraw.Stop();
 
-    KI_TRACE( traceGalProfile,
-              "Cached manager size: VBO size %u iranges %zu max elt size %u drawcalls %u\n",
-              cached->AllItemsSize(), m_vranges.size(), m_indexBufMaxSize, drawCalls );
+    KI_TRACE( traceGalProfile, "Cached manager size: VBO size %u vranges %zu drawcalls %u\n",
+              cached->AllItemsSize(), m_vrangeFirsts.size(), drawCalls );
     KI_TRACE( traceGalProfile, "Timing: %s\n", cntDraw.to_string() );
 
     glBindBuffer( GL_ARRAY_BUFFER, 0 );
     cached->ClearDirty();
+    cached->FinishDrawing();
 
     // Deactivate vertex array
     glDisableClientState( GL_COLOR_ARRAY );
@@ -245,16 +202,6 @@ void GPU_CACHED_MANAGER::EndDrawing()
 }
 
 
-void GPU_CACHED_MANAGER::resizeIndices( unsigned int aNewSize )
-{
-    if( aNewSize > m_indicesCapacity )
-    {
-        m_indicesCapacity = aNewSize;
-        m_indices.reset( new GLuint[m_indicesCapacity] );
-    }
-}
-
-
 // Noncached manager
 GPU_NONCACHED_MANAGER::GPU_NONCACHED_MANAGER( VERTEX_CONTAINER* aContainer ) :
         GPU_MANAGER( aContainer )
@@ -1417,10 +1417,17 @@ void OPENGL_GAL::drawTriangulatedPolyset( const SHAPE_POLY_SET& aPolySet,
         {
             auto triPoly = aPolySet.TriangulatedPolygon( j );
 
-            for( size_t i = 0; i < triPoly->GetTriangleCount(); i++ )
+            // Iterate the triangle and vertex stores directly; zone fills can run into
+            // millions of triangles, so the per-triangle random access and VECTOR2I
+            // copies of GetTriangle() add up when a fill is (re)streamed to the GPU
+            const std::deque<VECTOR2I>& vertices = triPoly->Vertices();
+
+            for( const SHAPE_POLY_SET::TRIANGULATED_POLYGON::TRI& tri : triPoly->Triangles() )
             {
-                VECTOR2I a, b, c;
-                triPoly->GetTriangle( i, a, b, c );
+                const VECTOR2I& a = vertices[tri.a];
+                const VECTOR2I& b = vertices[tri.b];
+                const VECTOR2I& c = vertices[tri.c];
+
                 m_currentManager->Vertex( a.x, a.y, m_layerDepth );
                 m_currentManager->Vertex( b.x, b.y, m_layerDepth );
                 m_currentManager->Vertex( c.x, c.y, m_layerDepth );
@@ -2144,6 +2151,29 @@ bool OPENGL_GAL::HasTarget( RENDER_TARGET aTarget )
 }
 
 
+bool OPENGL_GAL::SetScissor( const BOX2I& aRect )
+{
+    BOX2I rect = aRect;
+    rect = rect.Intersect( BOX2I( VECTOR2I( 0, 0 ), m_screenSize ) );
+
+    if( rect.GetWidth() <= 0 || rect.GetHeight() <= 0 )
+        return false;
+
+    // OpenGL window coordinates have their origin in the bottom left corner
+    glEnable( GL_SCISSOR_TEST );
+    glScissor( rect.GetX(), m_screenSize.y - rect.GetY() - rect.GetHeight(), rect.GetWidth(),
+               rect.GetHeight() );
+
+    return true;
+}
+
+
+void OPENGL_GAL::ClearScissor()
+{
+    glDisable( GL_SCISSOR_TEST );
+}
+
+
 void OPENGL_GAL::StartDiffLayer()
 {
     m_currentManager->EndDrawing();
@@ -2176,6 +2206,32 @@ void OPENGL_GAL::EndDiffLayer()
 }
 
 
+void OPENGL_GAL::StartNegativesLayer()
+{
+    m_currentManager->EndDrawing();
+
+    if( m_tempBuffer )
+    {
+        SetTarget( TARGET_TEMP );
+        ClearTarget( TARGET_TEMP );
+    }
+}
+
+
+void OPENGL_GAL::EndNegativesLayer()
+{
+    if( m_tempBuffer )
+    {
+        // Negative items already cut their holes through the depth buffer while the
+        // layer was drawn, so a plain alpha blend of the finished layer is all that
+        // is left to do
+        m_currentManager->EndDrawing();
+
+        m_compositor->DrawBuffer( m_tempBuffer, m_mainBuffer );
+    }
+}
+
+
 bool OPENGL_GAL::SetNativeCursorStyle( KICURSOR aCursor, bool aHiDPI )
 {
     // Store the current cursor type and get the wx cursor for it
@@ -2232,12 +2288,23 @@ void OPENGL_GAL::drawLineQuad( const VECTOR2D& aStartPoint, const VECTOR2D& aEnd
      * dots mark triangles' hypotenuses
      */
 
-    auto v1 = m_currentManager->GetTransformation()
-              * glm::vec4( aStartPoint.x, aStartPoint.y, 0.0, 0.0 );
-    auto v2 = m_currentManager->GetTransformation()
-              * glm::vec4( aEndPoint.x, aEndPoint.y, 0.0, 0.0 );
+    VECTOR2D vs;
 
-    VECTOR2D vs( v2.x - v1.x, v2.y - v1.y );
+    if( m_currentManager->IsTransformIdentity() )
+    {
+        // Hot path for the vast majority of items (tracks in particular), which are drawn
+        // without a transformation on the stack
+        vs = aEndPoint - aStartPoint;
+    }
+    else
+    {
+        auto v1 = m_currentManager->GetTransformation()
+                  * glm::vec4( aStartPoint.x, aStartPoint.y, 0.0, 0.0 );
+        auto v2 = m_currentManager->GetTransformation()
+                  * glm::vec4( aEndPoint.x, aEndPoint.y, 0.0, 0.0 );
+
+        vs = VECTOR2D( v2.x - v1.x, v2.y - v1.y );
+    }
 
     if( aReserve )
         reserveLineQuads( 1 );
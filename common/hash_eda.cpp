@@ -88,6 +88,32 @@ size_t hash_fp_item( const EDA_ITEM* aItem, int aFlags )
     }
         break;
 
+    case PCB_TRACE_T:
+    case PCB_ARC_T:
+    {
+        const PCB_TRACK* track = static_cast<const PCB_TRACK*>( aItem );
+
+        ret = hash_board_item( track, aFlags );
+        hash_combine( ret, track->GetWidth() );
+
+        if( aFlags & HASH_NET )
+            hash_combine( ret, track->GetNetCode() );
+
+        if( aFlags & HASH_POS )
+        {
+            hash_combine( ret, track->GetStart().x, track->GetStart().y );
+            hash_combine( ret, track->GetEnd().x, track->GetEnd().y );
+
+            if( aItem->Type() == PCB_ARC_T )
+            {
+                const PCB_ARC* arc = static_cast<const PCB_ARC*>( aItem );
+                hash_combine( ret, arc->GetMid().x, arc->GetMid().y );
+            }
+        }
+
+        break;
+    }
+
     case PCB_VIA_T:
     {
         const PCB_VIA* via = static_cast<const PCB_VIA*>( aItem );
@@ -103,6 +129,12 @@ size_t hash_fp_item( const EDA_ITEM* aItem, int aFlags )
                     hash_combine( ret, via->FlashLayer( layer ) );
                 } );
 
+        if( aFlags & HASH_NET )
+            hash_combine( ret, via->GetNetCode() );
+
+        if( aFlags & HASH_POS )
+            hash_combine( ret, via->GetPosition().x, via->GetPosition().y );
+
         break;
     }
 
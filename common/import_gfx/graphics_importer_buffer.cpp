@@ -190,7 +190,7 @@ void GRAPHICS_IMPORTER_BUFFER::ImportTo( GRAPHICS_IMPORTER& aImporter )
 
 // converts a single SVG-style polygon (multiple outlines, hole detection based on orientation,
 // custom fill rule) to a format that can be digested by KiCad (single outline, fractured).
-static void convertPolygon( std::list<std::unique_ptr<IMPORTED_SHAPE>>& aShapes,
+static void convertPolygon( std::vector<std::unique_ptr<IMPORTED_SHAPE>>& aShapes,
                             std::vector<IMPORTED_POLYGON*>&             aPaths,
                             GRAPHICS_IMPORTER::POLY_FILL_RULE           aFillRule,
                             const IMPORTED_STROKE& aStroke, bool aFilled,
@@ -289,7 +289,8 @@ void GRAPHICS_IMPORTER_BUFFER::PostprocessNestedPolygons()
     bool            lastFilled = false;
     COLOR4D         lastFillColor = COLOR4D::UNSPECIFIED;
 
-    std::list<std::unique_ptr<IMPORTED_SHAPE>> newShapes;
+    std::vector<std::unique_ptr<IMPORTED_SHAPE>> newShapes;
+    newShapes.reserve( m_shapes.size() );
     std::vector<IMPORTED_POLYGON*>             polypaths;
 
     for( std::unique_ptr<IMPORTED_SHAPE>& shape : m_shapes )
@@ -298,7 +299,9 @@ void GRAPHICS_IMPORTER_BUFFER::PostprocessNestedPolygons()
 
         if( !poly || poly->GetParentShapeIndex() < 0 )
         {
-            newShapes.push_back( shape->clone() );
+            // Not part of a nested-polygon group: keep the shape as-is instead of
+            // deep-copying it; m_shapes is replaced wholesale below
+            newShapes.push_back( std::move( shape ) );
             continue;
         }
 
@@ -31,7 +31,7 @@
 
 #include <math/matrix3x3.h>
 #include <math/box2.h>
-#include <list>
+#include <vector>
 
 
 class IMPORTED_SHAPE
@@ -380,7 +380,7 @@ public:
     void ImportTo( GRAPHICS_IMPORTER& aImporter );
     void AddShape( std::unique_ptr<IMPORTED_SHAPE>& aShape );
 
-    std::list<std::unique_ptr<IMPORTED_SHAPE>>& GetShapes() { return m_shapes; }
+    std::vector<std::unique_ptr<IMPORTED_SHAPE>>& GetShapes() { return m_shapes; }
 
     void ClearShapes() { m_shapes.clear(); }
 
@@ -388,7 +388,7 @@ public:
 
 protected:
     /// List of imported shapes.
-    std::list<std::unique_ptr<IMPORTED_SHAPE>> m_shapes;
+    std::vector<std::unique_ptr<IMPORTED_SHAPE>> m_shapes;
 };
 
 #endif /* GRAPHICS_IMPORTER_BUFFER */
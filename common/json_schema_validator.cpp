@@ -18,6 +18,8 @@
  */
 
 #include <fstream>
+#include <map>
+#include <mutex>
 #include <wx/filename.h>
 #include <wx/log.h>
 
@@ -25,34 +27,92 @@
 #include <locale_io.h>
 
 
-JSON_SCHEMA_VALIDATOR::JSON_SCHEMA_VALIDATOR( const wxFileName& aSchemaFile )
+struct COMPILED_SCHEMA
 {
-    std::ifstream schema_stream( aSchemaFile.GetFullPath().fn_str() );
+    long long                                              stamp;  ///< file stamp at compile time
+    std::shared_ptr<nlohmann::json_schema::json_validator> validator;
+};
+
+/// Process-wide cache of compiled schemas; schema compilation is expensive enough to show up
+/// in frame startup times when several kifaces validate against the same stock schemas.
+static std::map<wxString, COMPILED_SCHEMA> s_compiledSchemas;
+static std::mutex                          s_compiledSchemasMutex;
+
+
+static long long schemaStamp( const wxFileName& aFile )
+{
+    if( !aFile.FileExists() )
+        return 0;
+
+    long long stamp = 0;
+
+    wxDateTime lastModDate = aFile.GetModificationTime();
+
+    if( lastModDate.IsValid() )
+        stamp += lastModDate.GetValue().GetValue();
+
+    stamp += aFile.GetSize().GetValue();
+
+    return stamp;
+}
+
+
+JSON_SCHEMA_VALIDATOR::JSON_SCHEMA_VALIDATOR( const wxFileName& aSchemaFile ) :
+        m_schemaFile( aSchemaFile )
+{
+    // Deliberately does no work; see compileIfNeeded()
+}
+
+
+void JSON_SCHEMA_VALIDATOR::compileIfNeeded() const
+{
+    if( m_validator )
+        return;
+
+    std::lock_guard<std::mutex> lock( s_compiledSchemasMutex );
+
+    wxString  key = m_schemaFile.GetFullPath();
+    long long stamp = schemaStamp( m_schemaFile );
+
+    auto it = s_compiledSchemas.find( key );
+
+    if( it != s_compiledSchemas.end() && stamp != 0 && it->second.stamp == stamp )
+    {
+        m_validator = it->second.validator;
+        return;
+    }
+
+    auto validator = std::make_shared<nlohmann::json_schema::json_validator>();
+
+    std::ifstream  schema_stream( m_schemaFile.GetFullPath().fn_str() );
     nlohmann::json schema;
 
     try
     {
         // For some obscure reason on MINGW, using UCRT option,
-        // m_schema_validator.set_root_schema() hangs without switching to locale "C"
+        // set_root_schema() hangs without switching to locale "C"
 #if defined(__MINGW32__) && defined(_UCRT)
         LOCALE_IO dummy;
 #endif
 
         schema_stream >> schema;
-        m_validator.set_root_schema( schema );
+        validator->set_root_schema( schema );
     }
     catch( std::exception& e )
     {
-        if( !aSchemaFile.FileExists() )
+        if( !m_schemaFile.FileExists() )
         {
             wxLogError( wxString::Format( _( "schema file '%s' not found" ),
-                                          aSchemaFile.GetFullPath() ) );
+                                          m_schemaFile.GetFullPath() ) );
         }
         else
         {
             wxLogError( wxString::Format( _( "Error loading schema: %s" ), e.what() ) );
         }
     }
+
+    m_validator = std::move( validator );
+    s_compiledSchemas[key] = { stamp, m_validator };
 }
 
 
@@ -60,5 +120,6 @@ nlohmann::json JSON_SCHEMA_VALIDATOR::Validate( const nlohmann::json& aJson,
                              nlohmann::json_schema::error_handler& aErrorHandler,
                              const nlohmann::json_uri& aInitialUri ) const
 {
-    return m_validator.validate( aJson, aErrorHandler, aInitialUri );
+    compileIfNeeded();
+    return m_validator->validate( aJson, aErrorHandler, aInitialUri );
 }
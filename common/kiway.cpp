@@ -660,11 +660,14 @@ void KIWAY::ProjectChanged()
             top->ProjectChanged();
     }
 
-    // Cancel an in-progress load of libraries; handled through the schematic and PCB ifaces
-    if ( KIFACE* schface = KiFACE( KIWAY::FACE_SCH ) )
+    // Cancel an in-progress load of libraries; handled through the schematic and PCB ifaces.
+    // This is a notification only, so don't force the DSOs to load just to hear it: a face
+    // that was never loaded has no project state to cancel, and loading both editors here
+    // would defeat on-demand kiface loading for every project switch.
+    if ( KIFACE* schface = KiFACE( KIWAY::FACE_SCH, false ) )
         schface->ProjectChanged();
 
-    if ( KIFACE* pcbface = KiFACE( KIWAY::FACE_PCB ) )
+    if ( KIFACE* pcbface = KiFACE( KIWAY::FACE_PCB, false ) )
         pcbface->ProjectChanged();
 
     for( unsigned i=0;  i < KIWAY_PLAYER_COUNT;  ++i )
@@ -30,6 +30,48 @@
 #include <string_utils.h>
 
 
+/**
+ * Pack three characters into a trigram key.  Characters are truncated to 10 bits; a
+ * collision can only widen a candidate set, never narrow it, so this stays safe for
+ * non-Latin text.
+ */
+static inline uint32_t trigramKey( wxUniChar a, wxUniChar b, wxUniChar c )
+{
+    return ( ( (uint32_t) a.GetValue() & 0x3FF ) << 20 )
+           | ( ( (uint32_t) b.GetValue() & 0x3FF ) << 10 )
+           | ( (uint32_t) c.GetValue() & 0x3FF );
+}
+
+
+static void extractTrigrams( const wxString& aText, std::vector<uint32_t>& aTrigrams )
+{
+    if( aText.Length() < 3 )
+        return;
+
+    for( size_t ii = 0; ii + 2 < aText.Length(); ++ii )
+        aTrigrams.push_back( trigramKey( aText[ii], aText[ii + 1], aText[ii + 2] ) );
+}
+
+
+/**
+ * A term can be answered from the trigram index only if it is a plain token: regex,
+ * wildcard and relational syntax can match text that shares no trigram with the
+ * pattern.  Terms shorter than a trigram can't be looked up at all.
+ */
+static bool isIndexableTerm( const wxString& aTerm )
+{
+    if( aTerm.Length() < 3 )
+        return false;
+
+    for( wxUniChar c : aTerm )
+    {
+        if( !wxIsalnum( c ) && c != '_' && c != '-' )
+            return false;
+    }
+
+    return true;
+}
+
 
 void LIB_TREE_NODE::RebuildSearchTerms( const std::vector<wxString>& aShownColumns )
 {
@@ -48,6 +90,16 @@ void LIB_TREE_NODE::AssignIntrinsicRanks( const std::vector<wxString>& aShownCol
     for( std::unique_ptr<LIB_TREE_NODE>& child: m_Children )
         child->RebuildSearchTerms( aShownColumns );
 
+    // The search terms feed the root's trigram index; every code path that rebuilds them
+    // comes through here, so this is where the index goes stale.
+    LIB_TREE_NODE* root = this;
+
+    while( root->m_Parent )
+        root = root->m_Parent;
+
+    if( root->m_Type == TYPE::ROOT )
+        static_cast<LIB_TREE_NODE_ROOT*>( root )->InvalidateTrigramIndex();
+
     std::vector<LIB_TREE_NODE*> sort_buf;
 
     if( presorted )
@@ -162,7 +214,8 @@ LIB_TREE_NODE_UNIT::LIB_TREE_NODE_UNIT( LIB_TREE_NODE* aParent, LIB_TREE_ITEM* a
 
 
 void LIB_TREE_NODE_UNIT::UpdateScore( const std::vector<std::unique_ptr<EDA_COMBINED_MATCHER>>& aMatchers,
-                                      std::function<bool( LIB_TREE_NODE& aNode )>* aFilter )
+                                      std::function<bool( LIB_TREE_NODE& aNode )>* aFilter,
+                                      const std::unordered_set<LIB_TREE_NODE*>* aCandidates )
 {
     m_Score = 1;
 
@@ -231,28 +284,37 @@ void LIB_TREE_NODE_ITEM::Update( LIB_TREE_ITEM* aItem )
 
 
 void LIB_TREE_NODE_ITEM::UpdateScore( const std::vector<std::unique_ptr<EDA_COMBINED_MATCHER>>& aMatchers,
-                                      std::function<bool( LIB_TREE_NODE& aNode )>* aFilter )
+                                      std::function<bool( LIB_TREE_NODE& aNode )>* aFilter,
+                                      const std::unordered_set<LIB_TREE_NODE*>* aCandidates )
 {
-    m_Score = 1;
-
-    for( const std::unique_ptr<EDA_COMBINED_MATCHER>& matcher : aMatchers )
+    if( aCandidates && !aCandidates->count( this ) )
+    {
+        // The trigram index already proved some search term can't match this item.
+        m_Score = 0;
+    }
+    else
     {
-        int score = matcher->ScoreTerms( m_SearchTerms );
+        m_Score = 1;
 
-        if( score == 0 )
+        for( const std::unique_ptr<EDA_COMBINED_MATCHER>& matcher : aMatchers )
         {
-            m_Score = 0;
-            break;
+            int score = matcher->ScoreTerms( m_SearchTerms );
+
+            if( score == 0 )
+            {
+                m_Score = 0;
+                break;
+            }
+
+            m_Score += score;
         }
 
-        m_Score += score;
+        if( aFilter && !(*aFilter)(*this) )
+            m_Score = 0;
     }
 
-    if( aFilter && !(*aFilter)(*this) )
-        m_Score = 0;
-
     for( std::unique_ptr<LIB_TREE_NODE>& child: m_Children )
-        child->UpdateScore( aMatchers, aFilter );
+        child->UpdateScore( aMatchers, aFilter, aCandidates );
 }
 
 
@@ -278,7 +340,8 @@ LIB_TREE_NODE_ITEM& LIB_TREE_NODE_LIBRARY::AddItem( LIB_TREE_ITEM* aItem )
 
 
 void LIB_TREE_NODE_LIBRARY::UpdateScore( const std::vector<std::unique_ptr<EDA_COMBINED_MATCHER>>& aMatchers,
-                                         std::function<bool( LIB_TREE_NODE& aNode )>* aFilter )
+                                         std::function<bool( LIB_TREE_NODE& aNode )>* aFilter,
+                                         const std::unordered_set<LIB_TREE_NODE*>* aCandidates )
 {
     if( m_Children.empty() )
     {
@@ -303,14 +366,15 @@ void LIB_TREE_NODE_LIBRARY::UpdateScore( const std::vector<std::unique_ptr<EDA_C
 
         for( std::unique_ptr<LIB_TREE_NODE>& child: m_Children )
         {
-            child->UpdateScore( aMatchers, aFilter );
+            child->UpdateScore( aMatchers, aFilter, aCandidates );
             m_Score = std::max( m_Score, child->m_Score );
         }
     }
 }
 
 
-LIB_TREE_NODE_ROOT::LIB_TREE_NODE_ROOT()
+LIB_TREE_NODE_ROOT::LIB_TREE_NODE_ROOT() :
+        m_trigramIndexValid( false )
 {
     m_Type = TYPE::ROOT;
 }
@@ -320,10 +384,25 @@ LIB_TREE_NODE_LIBRARY& LIB_TREE_NODE_ROOT::AddLib( wxString const& aName, wxStri
 {
     LIB_TREE_NODE_LIBRARY* lib = new LIB_TREE_NODE_LIBRARY( this, aName, aDesc );
     m_Children.push_back( std::unique_ptr<LIB_TREE_NODE>( lib ) );
+    InvalidateTrigramIndex();
     return *lib;
 }
 
 
+void LIB_TREE_NODE_ROOT::RemoveLib( wxString const& aName )
+{
+    m_Children.erase( std::remove_if( m_Children.begin(), m_Children.end(),
+                                      [&]( std::unique_ptr<LIB_TREE_NODE>& aNode )
+                                      {
+                                          return aNode->m_Type == LIB_TREE_NODE::TYPE::LIBRARY
+                                                 && aNode->m_Name == aName;
+                                      } ),
+                      m_Children.end() );
+
+    InvalidateTrigramIndex();
+}
+
+
 void LIB_TREE_NODE_ROOT::RemoveGroup( bool aRecentlyUsedGroup, bool aAlreadyPlacedGroup )
 {
     m_Children.erase( std::remove_if( m_Children.begin(), m_Children.end(),
@@ -338,19 +417,148 @@ void LIB_TREE_NODE_ROOT::RemoveGroup( bool aRecentlyUsedGroup, bool aAlreadyPlac
                                           return false;
                                       } ),
                       m_Children.end() );
+
+    InvalidateTrigramIndex();
 }
 
 
 void LIB_TREE_NODE_ROOT::Clear()
 {
     m_Children.clear();
+    InvalidateTrigramIndex();
 }
 
 
 void LIB_TREE_NODE_ROOT::UpdateScore( const std::vector<std::unique_ptr<EDA_COMBINED_MATCHER>>& aMatchers,
-                                      std::function<bool( LIB_TREE_NODE& aNode )>* aFilter )
+                                      std::function<bool( LIB_TREE_NODE& aNode )>* aFilter,
+                                      const std::unordered_set<LIB_TREE_NODE*>* aCandidates )
 {
     for( std::unique_ptr<LIB_TREE_NODE>& child: m_Children )
-        child->UpdateScore( aMatchers, aFilter );
+        child->UpdateScore( aMatchers, aFilter, aCandidates );
+}
+
+
+void LIB_TREE_NODE_ROOT::buildTrigramIndex()
+{
+    m_trigramIndex.clear();
+
+    std::vector<uint32_t> trigrams;
+
+    for( std::unique_ptr<LIB_TREE_NODE>& lib : m_Children )
+    {
+        for( std::unique_ptr<LIB_TREE_NODE>& item : lib->m_Children )
+        {
+            if( item->m_Type != TYPE::ITEM )
+                continue;
+
+            trigrams.clear();
+
+            for( SEARCH_TERM& term : item->m_SearchTerms )
+            {
+                term.Normalize();
+                extractTrigrams( term.Text, trigrams );
+            }
+
+            std::sort( trigrams.begin(), trigrams.end() );
+            trigrams.erase( std::unique( trigrams.begin(), trigrams.end() ), trigrams.end() );
+
+            for( uint32_t key : trigrams )
+                m_trigramIndex[key].push_back( item.get() );
+        }
+    }
+
+    for( auto& [key, list] : m_trigramIndex )
+        std::sort( list.begin(), list.end() );
+
+    m_trigramIndexValid = true;
+}
+
+
+bool LIB_TREE_NODE_ROOT::GetSearchCandidates( const std::vector<std::unique_ptr<EDA_COMBINED_MATCHER>>& aMatchers,
+                                              std::unordered_set<LIB_TREE_NODE*>& aCandidates )
+{
+    bool narrowed = false;
+
+    for( const std::unique_ptr<EDA_COMBINED_MATCHER>& matcher : aMatchers )
+    {
+        const wxString& term = matcher->GetPattern();
+
+        if( !isIndexableTerm( term ) )
+            continue;
+
+        if( !m_trigramIndexValid )
+            buildTrigramIndex();
+
+        // An item can only contain the term if it contains every trigram of the term.
+        std::vector<const std::vector<LIB_TREE_NODE*>*> lists;
+        std::vector<uint32_t>                           trigrams;
+        bool                                            miss = false;
+
+        extractTrigrams( term, trigrams );
+
+        for( uint32_t key : trigrams )
+        {
+            auto it = m_trigramIndex.find( key );
+
+            if( it == m_trigramIndex.end() )
+            {
+                miss = true;
+                break;
+            }
+
+            lists.push_back( &it->second );
+        }
+
+        std::unordered_set<LIB_TREE_NODE*> termMatches;
+
+        if( !miss )
+        {
+            const std::vector<LIB_TREE_NODE*>* smallest = lists[0];
+
+            for( const std::vector<LIB_TREE_NODE*>* list : lists )
+            {
+                if( list->size() < smallest->size() )
+                    smallest = list;
+            }
+
+            for( LIB_TREE_NODE* item : *smallest )
+            {
+                bool inAll = true;
+
+                for( const std::vector<LIB_TREE_NODE*>* list : lists )
+                {
+                    if( list != smallest
+                            && !std::binary_search( list->begin(), list->end(), item ) )
+                    {
+                        inAll = false;
+                        break;
+                    }
+                }
+
+                if( inAll )
+                    termMatches.insert( item );
+            }
+        }
+
+        if( !narrowed )
+        {
+            aCandidates = std::move( termMatches );
+            narrowed = true;
+        }
+        else
+        {
+            std::erase_if( aCandidates,
+                           [&]( LIB_TREE_NODE* aNode )
+                           {
+                               return !termMatches.count( aNode );
+                           } );
+        }
+
+        // An empty set is still a valid (and final) answer: nothing can match.
+        if( aCandidates.empty() )
+            break;
+    }
+
+    return narrowed;
 }
 
@@ -309,7 +309,16 @@ void LIB_TREE_MODEL_ADAPTER::UpdateSearchString( const wxString& aSearch, bool a
             termMatchers.emplace_back( std::make_unique<EDA_COMBINED_MATCHER>( term, CTX_LIBITEM ) );
         }
 
-        m_tree.UpdateScore( termMatchers, m_filter );
+        // Ask the tree's trigram index for the subset of items that can possibly match
+        // every plain search term; with large footprint libraries this keeps a keystroke
+        // from running the matchers against every item in the tree.
+        std::unordered_set<LIB_TREE_NODE*>        candidates;
+        const std::unordered_set<LIB_TREE_NODE*>* candidatesPtr = nullptr;
+
+        if( !termMatchers.empty() && m_tree.GetSearchCandidates( termMatchers, candidates ) )
+            candidatesPtr = &candidates;
+
+        m_tree.UpdateScore( termMatchers, m_filter, candidatesPtr );
 
         m_tree.SortNodes( m_sort_mode == BEST_MATCH );
         AfterReset();
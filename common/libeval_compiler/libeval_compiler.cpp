@@ -1132,6 +1132,9 @@ bool COMPILER::generateUCode( UCODE* aCode, CONTEXT* aPreflightContext )
     if( !missingUnitsMsg.IsEmpty() && numericValueCount == 1 )
         reportError( CST_CODEGEN, missingUnitsMsg, missingUnitsSrcPos );
 
+    if( !m_errorStatus.pendingError )
+        aCode->ConstantFold();
+
     libeval_dbg(2,"dump: \n%s\n", aCode->Dump().c_str() );
 
     return true;
@@ -1314,6 +1317,59 @@ void UOP::Exec( CONTEXT* ctx )
 }
 
 
+void UCODE::ConstantFold()
+{
+    bool folded = true;
+
+    // Iterate to a fixpoint so nested constant subexpressions collapse fully.
+    while( folded )
+    {
+        folded = false;
+
+        for( size_t ii = 0; ii < m_ucode.size(); ++ii )
+        {
+            UOP*   op = m_ucode[ii];
+            size_t argCount = 0;
+
+            if( ( op->GetOp() & TR_OP_BINARY_MASK ) && ii >= 2 )
+                argCount = 2;
+            else if( ( op->GetOp() & TR_OP_UNARY_MASK ) && ii >= 1 )
+                argCount = 1;
+            else
+                continue;
+
+            bool constantArgs = true;
+
+            for( size_t jj = ii - argCount; jj < ii; ++jj )
+                constantArgs &= m_ucode[jj]->IsValuePush();
+
+            if( !constantArgs )
+                continue;
+
+            // Execute the candidate ops on a scratch context to get the runtime result.
+            CONTEXT ctx;
+
+            for( size_t jj = ii - argCount; jj <= ii; ++jj )
+                m_ucode[jj]->Exec( &ctx );
+
+            if( ctx.SP() != 1 )
+                continue;
+
+            std::unique_ptr<VALUE> result = std::make_unique<VALUE>( *ctx.Pop() );
+
+            for( size_t jj = ii - argCount; jj <= ii; ++jj )
+                delete m_ucode[jj];
+
+            m_ucode[ii - argCount] = new UOP( TR_UOP_PUSH_VALUE, std::move( result ) );
+            m_ucode.erase( m_ucode.begin() + ii - argCount + 1, m_ucode.begin() + ii + 1 );
+
+            folded = true;
+            break;
+        }
+    }
+}
+
+
 VALUE* UCODE::Run( CONTEXT* ctx )
 {
     try
@@ -19,6 +19,7 @@
  * with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <atomic>
 #include <common.h>
 #include <env_vars.h>
 #include <list>
@@ -43,6 +44,10 @@ struct LIBRARY_MANAGER_INTERNALS
 };
 
 
+/// Bumped whenever the substitution environment changes; folded into every table fingerprint
+static std::atomic<long long> s_envGeneration( 1 );
+
+
 LIBRARY_MANAGER::LIBRARY_MANAGER()
 {
 }
@@ -72,6 +77,12 @@ void LIBRARY_MANAGER::loadTables( const wxString& aTablePath, LIBRARY_TABLE_SCOP
 
     std::map<LIBRARY_TABLE_TYPE, std::unique_ptr<LIBRARY_TABLE>>& aTarget = getTarget();
 
+    // The tables (and therefore any cached row pointers) are about to be replaced
+    {
+        std::lock_guard lock( m_rowCacheMutex );
+        m_rowCache.clear();
+    }
+
     if( aTablesToLoad.size() == 0 )
         aTablesToLoad = { LIBRARY_TABLE_TYPE::SYMBOL, LIBRARY_TABLE_TYPE::FOOTPRINT, LIBRARY_TABLE_TYPE::DESIGN_BLOCK };
 
@@ -633,6 +644,19 @@ std::optional<LIBRARY_TABLE_ROW*> LIBRARY_MANAGER::GetRow( LIBRARY_TABLE_TYPE  a
                                                            const wxString&     aNickname,
                                                            LIBRARY_TABLE_SCOPE aScope ) const
 {
+    // The common case (and the hot path during netlist update and library loads) looks up a
+    // nickname across both scopes; that path is served from the precomputed hash map.
+    if( aScope == LIBRARY_TABLE_SCOPE::BOTH )
+    {
+        std::lock_guard lock( m_rowCacheMutex );
+        ROW_CACHE& cache = rowCache( aType );
+
+        if( auto it = cache.rows.find( aNickname ); it != cache.rows.end() )
+            return it->second;
+
+        return std::nullopt;
+    }
+
     for( LIBRARY_TABLE_ROW* row : Rows( aType, aScope, true ) )
     {
         if( row->Nickname() == aNickname )
@@ -643,6 +667,58 @@ std::optional<LIBRARY_TABLE_ROW*> LIBRARY_MANAGER::GetRow( LIBRARY_TABLE_TYPE  a
 }
 
 
+long long LIBRARY_MANAGER::tableFingerprint( LIBRARY_TABLE_TYPE aType ) const
+{
+    long long fingerprint = s_envGeneration.load();
+
+    auto addTable =
+            [&]( const std::unique_ptr<LIBRARY_TABLE>& aTable )
+            {
+                if( aTable && aTable->Type() == aType )
+                    fingerprint += aTable->Generation();
+            };
+
+    for( const std::unique_ptr<LIBRARY_TABLE>& table : m_tables | std::views::values )
+        addTable( table );
+
+    for( const std::unique_ptr<LIBRARY_TABLE>& table : m_projectTables | std::views::values )
+        addTable( table );
+
+    for( const std::unique_ptr<LIBRARY_TABLE>& table : m_childTables | std::views::values )
+        addTable( table );
+
+    return fingerprint;
+}
+
+
+LIBRARY_MANAGER::ROW_CACHE& LIBRARY_MANAGER::rowCache( LIBRARY_TABLE_TYPE aType ) const
+{
+    ROW_CACHE& cache = m_rowCache[aType];
+    long long  fingerprint = tableFingerprint( aType );
+
+    if( cache.fingerprint != fingerprint )
+    {
+        cache.rows.clear();
+        cache.resolvedUris.clear();
+
+        // Rows() already resolves nickname collisions (project tables override global ones),
+        // so each nickname appears exactly once here.
+        for( LIBRARY_TABLE_ROW* row : Rows( aType, LIBRARY_TABLE_SCOPE::BOTH, true ) )
+            cache.rows.emplace( row->Nickname(), row );
+
+        cache.fingerprint = fingerprint;
+    }
+
+    return cache;
+}
+
+
+void LIBRARY_MANAGER::EnvVarsChanged()
+{
+    s_envGeneration.fetch_add( 1 );
+}
+
+
 std::optional<LIBRARY_TABLE_ROW*> LIBRARY_MANAGER::FindRowByURI( LIBRARY_TABLE_TYPE aType,
         const wxString& aUri,
         LIBRARY_TABLE_SCOPE aScope ) const
@@ -685,10 +761,25 @@ std::optional<wxString> LIBRARY_MANAGER::GetFullURI( LIBRARY_TABLE_TYPE aType,
                                                      const wxString& aNickname,
                                                      bool aSubstituted ) const
 {
-    if( std::optional<const LIBRARY_TABLE_ROW*> result = GetRow( aType, aNickname ) )
-        return GetFullURI( *result, aSubstituted );
+    std::lock_guard lock( m_rowCacheMutex );
+    ROW_CACHE& cache = rowCache( aType );
 
-    return std::nullopt;
+    auto it = cache.rows.find( aNickname );
+
+    if( it == cache.rows.end() )
+        return std::nullopt;
+
+    if( !aSubstituted )
+        return it->second->URI();
+
+    // Environment-variable substitution is surprisingly expensive when done per-access;
+    // memoize it until the tables or the environment change.
+    auto uriIt = cache.resolvedUris.find( aNickname );
+
+    if( uriIt == cache.resolvedUris.end() )
+        uriIt = cache.resolvedUris.emplace( aNickname, GetFullURI( it->second, true ) ).first;
+
+    return uriIt->second;
 }
 
 
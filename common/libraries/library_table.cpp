@@ -18,6 +18,7 @@
  * with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <atomic>
 #include <boost/lexical_cast.hpp>
 
 #include <libraries/library_table.h>
@@ -55,6 +56,8 @@ std::map<std::string, UTF8> LIBRARY_TABLE_ROW::GetOptionsMap() const
 LIBRARY_TABLE::LIBRARY_TABLE( const wxFileName &aPath, LIBRARY_TABLE_SCOPE aScope ) :
         m_scope( aScope )
 {
+    Touch();
+
     LIBRARY_TABLE_PARSER parser;
 
     wxFileName file( aPath );
@@ -87,6 +90,8 @@ LIBRARY_TABLE::LIBRARY_TABLE( const wxString &aBuffer, LIBRARY_TABLE_SCOPE aScop
         m_path( wxEmptyString ),
         m_scope( aScope )
 {
+    Touch();
+
     LIBRARY_TABLE_PARSER parser;
 
     tl::expected<LIBRARY_TABLE_IR, LIBRARY_PARSE_ERROR> ir =
@@ -206,10 +211,18 @@ LIBRARY_TABLE_ROW LIBRARY_TABLE::MakeRow() const
 
 LIBRARY_TABLE_ROW& LIBRARY_TABLE::InsertRow()
 {
+    Touch();
     return Rows().emplace_back( MakeRow() );
 }
 
 
+void LIBRARY_TABLE::Touch()
+{
+    static std::atomic<long long> nextGeneration( 1 );
+    m_generation = nextGeneration.fetch_add( 1 );
+}
+
+
 bool LIBRARY_TABLE::HasRow( const wxString& aNickname ) const
 {
     for( const LIBRARY_TABLE_ROW& row : m_rows )
@@ -264,6 +277,9 @@ std::optional<const LIBRARY_TABLE_ROW*> LIBRARY_TABLE::Row( const wxString& aNic
 
 LIBRARY_RESULT<void> LIBRARY_TABLE::Save()
 {
+    // Saving is how edited rows are committed, so treat it as a structural change
+    Touch();
+
     wxLogTrace( traceLibraries, "Saving %s", Path() );
     wxFileName fn( Path() );
     // This should already be normalized, but just in case...
@@ -55,6 +55,166 @@ static wxString historyPath( const wxString& aProjectPath )
     return p.GetPath();
 }
 
+
+/**
+ * Number of loose objects tolerated in the history repository before it is repacked.
+ *
+ * Git stores each new object as a whole zlib-compressed loose file; delta compression only
+ * happens inside packfiles, and libgit2 never repacks on its own.  Without repacking, every
+ * autosave of a large board costs a full compressed copy of each changed file.  Packing
+ * delta-compresses consecutive snapshots of the same file against each other, so the history
+ * grows roughly with the size of the edits instead.
+ */
+#define LOOSE_OBJECT_REPACK_THRESHOLD 64
+
+static size_t countLooseObjects( const wxString& aGitDir )
+{
+    wxFileName objectsPath( aGitDir, wxEmptyString );
+    objectsPath.AppendDir( wxS( "objects" ) );
+
+    wxDir objectsDir( objectsPath.GetPath() );
+
+    if( !objectsDir.IsOpened() )
+        return 0;
+
+    size_t   count = 0;
+    wxString name;
+    bool     cont = objectsDir.GetFirst( &name, wxEmptyString, wxDIR_DIRS );
+
+    while( cont )
+    {
+        // Loose object fan-out directories are exactly two hex digits
+        if( name.length() == 2 && wxIsxdigit( name[0] ) && wxIsxdigit( name[1] ) )
+        {
+            wxDir sub( objectsPath.GetPath() + wxFILE_SEP_PATH + name );
+
+            if( sub.IsOpened() )
+            {
+                wxString file;
+                bool     fcont = sub.GetFirst( &file, wxEmptyString, wxDIR_FILES );
+
+                while( fcont )
+                {
+                    ++count;
+                    fcont = sub.GetNext( &file );
+                }
+            }
+        }
+
+        cont = objectsDir.GetNext( &name );
+    }
+
+    return count;
+}
+
+
+static void repackHistoryIfNeeded( git_repository* aRepo )
+{
+    wxString gitDir = wxString::FromUTF8( git_repository_path( aRepo ) );
+
+    if( countLooseObjects( gitDir ) < LOOSE_OBJECT_REPACK_THRESHOLD )
+        return;
+
+    wxLogTrace( traceAutoSave, wxS("[history] repacking loose objects into delta-compressed pack") );
+
+    git_packbuilder* rawPb = nullptr;
+
+    if( git_packbuilder_new( &rawPb, aRepo ) != 0 )
+        return;
+
+    std::unique_ptr<git_packbuilder, decltype( &git_packbuilder_free )> pb( rawPb,
+                                                                            &git_packbuilder_free );
+
+    // Insert every commit reachable from any ref (branches and Last_Save tags); the
+    // packbuilder pulls in the trees and blobs and deltifies similar blobs.
+    git_revwalk* walk = nullptr;
+
+    if( git_revwalk_new( &walk, aRepo ) != 0 )
+        return;
+
+    git_revwalk_sorting( walk, GIT_SORT_TIME );
+    git_revwalk_push_head( walk );
+    git_revwalk_push_glob( walk, "*" );
+
+    git_oid oid;
+    bool    ok = true;
+
+    while( git_revwalk_next( &oid, walk ) == 0 )
+    {
+        if( git_packbuilder_insert_commit( pb.get(), &oid ) != 0 )
+        {
+            ok = false;
+            break;
+        }
+    }
+
+    git_revwalk_free( walk );
+
+    if( !ok )
+    {
+        wxLogTrace( traceAutoSave, wxS("[history] repack aborted: insert failed") );
+        return;
+    }
+
+    wxFileName packPath( gitDir, wxEmptyString );
+    packPath.AppendDir( wxS( "objects" ) );
+    packPath.AppendDir( wxS( "pack" ) );
+    wxFileName::Mkdir( packPath.GetPath(), 0777, wxPATH_MKDIR_FULL );
+
+    if( git_packbuilder_write( pb.get(), packPath.GetPath().mb_str().data(), 0, nullptr,
+                               nullptr ) != 0 )
+    {
+        wxLogTrace( traceAutoSave, wxS("[history] repack aborted: pack write failed") );
+        return;
+    }
+
+    // Everything reachable is now in the pack; drop the loose copies (and any unreachable
+    // leftovers from trimmed history).  We hold the history lock, so nothing else is writing.
+    wxFileName objectsPath( gitDir, wxEmptyString );
+    objectsPath.AppendDir( wxS( "objects" ) );
+
+    wxDir objectsDir( objectsPath.GetPath() );
+
+    if( !objectsDir.IsOpened() )
+        return;
+
+    size_t   removed = 0;
+    wxString name;
+    bool     cont = objectsDir.GetFirst( &name, wxEmptyString, wxDIR_DIRS );
+
+    while( cont )
+    {
+        if( name.length() == 2 && wxIsxdigit( name[0] ) && wxIsxdigit( name[1] ) )
+        {
+            wxString fanoutPath = objectsPath.GetPath() + wxFILE_SEP_PATH + name;
+
+            {
+                wxDir sub( fanoutPath );
+
+                if( sub.IsOpened() )
+                {
+                    wxString file;
+                    bool     fcont = sub.GetFirst( &file, wxEmptyString, wxDIR_FILES );
+
+                    while( fcont )
+                    {
+                        if( wxRemoveFile( fanoutPath + wxFILE_SEP_PATH + file ) )
+                            ++removed;
+
+                        fcont = sub.GetNext( &file );
+                    }
+                }
+            }
+
+            wxRmdir( fanoutPath );  // fails harmlessly if not empty
+        }
+
+        cont = objectsDir.GetNext( &name );
+    }
+
+    wxLogTrace( traceAutoSave, wxS("[history] repack done; %zu loose objects removed"), removed );
+}
+
 LOCAL_HISTORY::LOCAL_HISTORY()
 {
 }
@@ -107,24 +267,18 @@ void LOCAL_HISTORY::ClearAllSavers()
 }
 
 
-bool LOCAL_HISTORY::RunRegisteredSaversAndCommit( const wxString& aProjectPath, const wxString& aTitle )
+std::vector<wxString> LOCAL_HISTORY::RunRegisteredSavers( const wxString& aProjectPath )
 {
+    std::vector<wxString> files;
+
     if( !Pgm().GetCommonSettings()->m_Backup.enabled )
     {
         wxLogTrace( traceAutoSave, wxS("Autosave disabled, returning" ) );
-        return true;
+        return files;
     }
 
-    wxLogTrace( traceAutoSave, wxS("[history] RunRegisteredSaversAndCommit start project='%s' title='%s' savers=%zu"),
-                aProjectPath, aTitle, m_savers.size() );
-
-    if( m_savers.empty() )
-    {
-        wxLogTrace( traceAutoSave, wxS("[history] no savers registered; skipping") );
-        return false;
-    }
-
-    std::vector<wxString> files;
+    wxLogTrace( traceAutoSave, wxS("[history] RunRegisteredSavers start project='%s' savers=%zu"),
+                aProjectPath, m_savers.size() );
 
     for( const auto& [saverObject, saver] : m_savers )
     {
@@ -151,12 +305,39 @@ bool LOCAL_HISTORY::RunRegisteredSaversAndCommit( const wxString& aProjectPath,
         } );
     files.erase( it, files.end() );
 
+    return files;
+}
+
+
+bool LOCAL_HISTORY::RunRegisteredSaversAndCommit( const wxString& aProjectPath, const wxString& aTitle )
+{
+    if( !Pgm().GetCommonSettings()->m_Backup.enabled )
+    {
+        wxLogTrace( traceAutoSave, wxS("Autosave disabled, returning" ) );
+        return true;
+    }
+
+    if( m_savers.empty() )
+    {
+        wxLogTrace( traceAutoSave, wxS("[history] no savers registered; skipping") );
+        return false;
+    }
+
+    std::vector<wxString> files = RunRegisteredSavers( aProjectPath );
+
     if( files.empty() )
     {
         wxLogTrace( traceAutoSave, wxS("[history] saver set produced no files; skipping") );
         return false;
     }
 
+    return CommitFiles( aProjectPath, files, aTitle );
+}
+
+
+bool LOCAL_HISTORY::CommitFiles( const wxString& aProjectPath, const std::vector<wxString>& aFiles,
+                                 const wxString& aTitle )
+{
     // Acquire locks using hybrid locking strategy
     HISTORY_LOCK_MANAGER lock( aProjectPath );
 
@@ -171,7 +352,7 @@ bool LOCAL_HISTORY::RunRegisteredSaversAndCommit( const wxString& aProjectPath,
     wxString hist = historyPath( aProjectPath );
 
     // Stage selected files (mirroring logic from CommitSnapshot but limited to given files)
-    for( const wxString& file : files )
+    for( const wxString& file : aFiles )
     {
         wxFileName src( file );
 
@@ -278,13 +459,17 @@ bool LOCAL_HISTORY::RunRegisteredSaversAndCommit( const wxString& aProjectPath,
 
     if( rc == 0 )
         wxLogTrace( traceAutoSave, wxS("[history] commit created %s (%s files=%zu)"),
-                    wxString::FromUTF8( git_oid_tostr_s( &commit_id ) ), msg, files.size() );
+                    wxString::FromUTF8( git_oid_tostr_s( &commit_id ) ), msg, aFiles.size() );
     else
         wxLogTrace( traceAutoSave, wxS("[history] commit failed rc=%d"), rc );
 
     if( parent ) git_commit_free( parent );
 
     git_index_write( index );
+
+    if( rc == 0 )
+        repackHistoryIfNeeded( repo );
+
     return rc == 0;
 }
 
@@ -514,6 +699,7 @@ bool LOCAL_HISTORY::CommitSnapshot( const std::vector<wxString>& aFiles, const w
                        msg.mb_str().data(), tree.get(), parents,
                        parentPtr ? &constParentPtr : nullptr );
     git_index_write( index );
+    repackHistoryIfNeeded( repo );
     return true;
 }
 
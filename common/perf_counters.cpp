@@ -0,0 +1,137 @@
+/*
+ * This program source code file is part of Trace, an AI-native PCB design application.
+ *
+ * Copyright The Trace Developers, see TRACE_AUTHORS.txt for contributors.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <perf_counters.h>
+
+#include <algorithm>
+#include <fstream>
+
+#include <nlohmann/json.hpp>
+#include <wx/log.h>
+#include <wx/string.h>
+
+#include <build_version.h>
+
+
+PERF_COUNTERS& PERF_COUNTERS::Get()
+{
+    static PERF_COUNTERS instance;
+    return instance;
+}
+
+
+void PERF_COUNTERS::Increment( const std::string& aName, int64_t aDelta )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_counters[aName] += aDelta;
+}
+
+
+void PERF_COUNTERS::Set( const std::string& aName, int64_t aValue )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_counters[aName] = aValue;
+}
+
+
+void PERF_COUNTERS::RecordDuration( const std::string& aName,
+                                    const std::chrono::nanoseconds& aDuration )
+{
+    int64_t ns = std::max<int64_t>( aDuration.count(), 0 );
+
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    DURATION_STAT& stat = m_durations[aName];
+
+    stat.count++;
+    stat.totalNs += ns;
+    stat.minNs = std::min( stat.minNs, ns );
+    stat.maxNs = std::max( stat.maxNs, ns );
+
+    int64_t us = ns / 1000;
+    size_t  bucket = 0;
+
+    while( ( int64_t( 1 ) << ( bucket + 1 ) ) <= us && bucket + 1 < stat.buckets.size() )
+        bucket++;
+
+    stat.buckets[bucket]++;
+}
+
+
+nlohmann::json PERF_COUNTERS::ExportJson() const
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    nlohmann::json json;
+
+    json["version"] = GetBuildVersion().ToStdString();
+    json["counters"] = nlohmann::json::object();
+    json["durations"] = nlohmann::json::object();
+
+    for( const auto& [name, value] : m_counters )
+        json["counters"][name] = value;
+
+    for( const auto& [name, stat] : m_durations )
+    {
+        nlohmann::json entry;
+
+        entry["count"] = stat.count;
+        entry["total_ms"] = stat.totalNs / 1e6;
+        entry["min_ms"] = ( stat.count > 0 ? stat.minNs : 0 ) / 1e6;
+        entry["max_ms"] = stat.maxNs / 1e6;
+        entry["mean_ms"] = ( stat.count > 0 ? stat.totalNs / stat.count : 0 ) / 1e6;
+
+        nlohmann::json histogram = nlohmann::json::object();
+
+        for( size_t ii = 0; ii < stat.buckets.size(); ++ii )
+        {
+            if( stat.buckets[ii] > 0 )
+                histogram[std::to_string( int64_t( 1 ) << ii )] = stat.buckets[ii];
+        }
+
+        entry["histogram_us"] = histogram;
+
+        json["durations"][name] = entry;
+    }
+
+    return json;
+}
+
+
+bool PERF_COUNTERS::WriteJsonFile( const wxString& aPath ) const
+{
+    std::ofstream file( aPath.ToStdString() );
+
+    if( !file.is_open() )
+    {
+        wxLogWarning( wxT( "Could not write performance counters to '%s'" ), aPath );
+        return false;
+    }
+
+    file << ExportJson().dump( 4 ) << std::endl;
+    return file.good();
+}
+
+
+void PERF_COUNTERS::Reset()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_counters.clear();
+    m_durations.clear();
+}
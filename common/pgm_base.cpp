@@ -46,6 +46,7 @@
 
 #include <advanced_config.h>
 #include <app_monitor.h>
+#include <background_job_scheduler.h>
 #include <background_jobs_monitor.h>
 #include <bitmaps.h>
 #include <build_version.h>
@@ -413,6 +414,7 @@ bool PGM_BASE::InitPgm( bool aHeadless, bool aSkipPyInit, bool aIsUnitTest )
     m_settings_manager = std::make_unique<SETTINGS_MANAGER>();
     m_library_manager = std::make_unique<LIBRARY_MANAGER>();
     m_background_jobs_monitor = std::make_unique<BACKGROUND_JOBS_MONITOR>();
+    m_background_job_scheduler = std::make_unique<BACKGROUND_JOB_SCHEDULER>( *m_background_jobs_monitor );
     m_notifications_manager = std::make_unique<NOTIFICATIONS_MANAGER>();
 
 #ifdef KICAD_IPC_API
@@ -861,43 +863,43 @@ void PGM_BASE::PreloadDesignBlockLibraries( KIWAY* aKiway )
     constexpr static int interval = 150;
     constexpr static int timeLimit = 120000;
 
-    if( m_libraryPreloadInProgress.load() )
+    if( m_libraryPreloadJob
+            && ( m_libraryPreloadJob->GetState() == SCHEDULED_JOB::STATE::PENDING
+                    || m_libraryPreloadJob->GetState() == SCHEDULED_JOB::STATE::RUNNING ) )
+    {
         return;
+    }
 
-    m_libraryPreloadBackgroundJob = Pgm().GetBackgroundJobMonitor().Create( _( "Loading Design Block Libraries" ) );
-
-    auto preload = [this, aKiway]() -> void
+    auto preload = [aKiway]( BACKGROUND_JOB_WORK& aWork ) -> void
     {
-        std::shared_ptr<BACKGROUND_JOB_REPORTER> reporter = m_libraryPreloadBackgroundJob->m_reporter;
-
         DESIGN_BLOCK_LIBRARY_ADAPTER* adapter = aKiway->Prj().DesignBlockLibs();
 
         int elapsed = 0;
 
-        reporter->Report( _( "Loading Design Block Libraries" ) );
+        if( PROGRESS_REPORTER* reporter = aWork.Reporter() )
+            reporter->Report( _( "Loading Design Block Libraries" ) );
+
         adapter->AsyncLoad();
 
-        while( true )
+        while( aWork.KeepGoing() )
         {
-            if( m_libraryPreloadAbort.load() )
-            {
-                m_libraryPreloadAbort.store( false );
-                break;
-            }
-
             std::this_thread::sleep_for( std::chrono::milliseconds( interval ) );
 
             if( std::optional<float> loadStatus = adapter->AsyncLoadProgress() )
             {
                 float progress = *loadStatus;
-                reporter->SetCurrentProgress( progress );
+
+                if( PROGRESS_REPORTER* reporter = aWork.Reporter() )
+                    reporter->SetCurrentProgress( progress );
 
                 if( progress >= 1 )
                     break;
             }
             else
             {
-                reporter->SetCurrentProgress( 1 );
+                if( PROGRESS_REPORTER* reporter = aWork.Reporter() )
+                    reporter->SetCurrentProgress( 1 );
+
                 break;
             }
 
@@ -907,20 +909,18 @@ void PGM_BASE::PreloadDesignBlockLibraries( KIWAY* aKiway )
                 break;
         }
 
-        adapter->BlockUntilLoaded();
+        if( aWork.IsCancelled() )
+            return;
 
-        Pgm().GetBackgroundJobMonitor().Remove( m_libraryPreloadBackgroundJob );
-        m_libraryPreloadBackgroundJob.reset();
-        m_libraryPreloadInProgress.store( false );
+        adapter->BlockUntilLoaded();
 
         std::string payload = "";
         aKiway->ExpressMail( FRAME_SCH, MAIL_RELOAD_LIB, payload, nullptr, true );
         aKiway->ExpressMail( FRAME_PCB_EDITOR, MAIL_RELOAD_LIB, payload, nullptr, true );
     };
 
-    thread_pool& tp = GetKiCadThreadPool();
-    m_libraryPreloadInProgress.store( true );
-    m_libraryPreloadReturn = tp.submit_task( preload );
+    m_libraryPreloadJob = GetBackgroundJobScheduler().Submit(
+            _( "Loading Design Block Libraries" ), TP_PRIORITY_BATCH, preload );
 }
 
 
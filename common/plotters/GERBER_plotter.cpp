@@ -97,6 +97,10 @@ GERBER_PLOTTER::GERBER_PLOTTER()
     finalFile = nullptr;
     m_currentApertureIdx = -1;
     m_apertureAttribute = 0;
+    m_batchedEmit = false;
+    m_lastEmitX = 0;
+    m_lastEmitY = 0;
+    m_lastEmitValid = false;
 
     // number of digits after the point (number of digits of the mantissa
     // Be careful: the Gerber coordinates are stored in an integer
@@ -157,7 +161,38 @@ void GERBER_PLOTTER::SetGerberCoordinatesFormat( int aResolution, bool aUseInche
 
 void GERBER_PLOTTER::emitDcode( const VECTOR2D& pt, int dcode )
 {
-    fmt::println( m_outputFile, "X{}Y{}D{:02d}*", KiROUND( pt.x ), KiROUND( pt.y ), dcode );
+    const int x = KiROUND( pt.x );
+    const int y = KiROUND( pt.y );
+
+    auto out = std::back_inserter( m_emitBuffer );
+
+    // Coordinates are modal, so an ordinate equal to the last emitted one can be left
+    // out; rectilinear zone fills roughly halve in size this way.
+    if( !m_lastEmitValid || x != m_lastEmitX )
+        fmt::format_to( out, "X{}", x );
+
+    if( !m_lastEmitValid || y != m_lastEmitY )
+        fmt::format_to( out, "Y{}", y );
+
+    fmt::format_to( out, "D{:02d}*\n", dcode );
+
+    m_lastEmitX = x;
+    m_lastEmitY = y;
+    m_lastEmitValid = true;
+
+    if( !m_batchedEmit )
+        flushEmitBuffer();
+}
+
+
+void GERBER_PLOTTER::flushEmitBuffer()
+{
+    if( m_emitBuffer.size() )
+    {
+        fmt::print( m_outputFile, "{}",
+                    fmt::string_view( m_emitBuffer.data(), m_emitBuffer.size() ) );
+        m_emitBuffer.clear();
+    }
 }
 
 
@@ -246,6 +281,9 @@ bool GERBER_PLOTTER::StartPlot( const wxString& aPageNumber )
                                         // is in use
     m_hasApertureChamferedRect = false; // true is at least one chamfered rect is in use
     m_am_freepoly_list.ClearList();
+    m_batchedEmit = false;
+    m_lastEmitValid = false;
+    m_emitBuffer.clear();
 
     wxASSERT( m_outputFile );
 
@@ -937,6 +975,11 @@ void GERBER_PLOTTER::plotArc( const SHAPE_ARC& aArc, bool aPlotInRegion )
              KiROUND( devEnd.x ), KiROUND( devEnd.y ),
              KiROUND( devRelCenter.x ), KiROUND( devRelCenter.y ) );
 
+    // Keep the modal coordinate tracking of emitDcode() in sync
+    m_lastEmitX = KiROUND( devEnd.x );
+    m_lastEmitY = KiROUND( devEnd.y );
+    m_lastEmitValid = true;
+
     fmt::println( m_outputFile, "G01*" ); // Back to linear interpolate (perhaps useless here).
 }
 
@@ -971,6 +1014,11 @@ void GERBER_PLOTTER::plotArc( const VECTOR2I& aCenter, const EDA_ANGLE& aStartAn
              KiROUND( devEnd.x ), KiROUND( devEnd.y ),
              KiROUND( devRelCenter.x ), KiROUND( devRelCenter.y ) );
 
+    // Keep the modal coordinate tracking of emitDcode() in sync
+    m_lastEmitX = KiROUND( devEnd.x );
+    m_lastEmitY = KiROUND( devEnd.y );
+    m_lastEmitValid = true;
+
     fmt::println( m_outputFile, "G01*" ); // Back to linear interpolate (perhaps useless here).
 }
 
@@ -1073,6 +1121,10 @@ void GERBER_PLOTTER::PlotPoly( const SHAPE_LINE_CHAIN& aPoly, FILL_T aFill, int
 
         fmt::println( m_outputFile, "G01*" ); // Set linear interpolation.
 
+        // Batch the vertex records: a flooded zone region can have tens of thousands of
+        // vertices, and one stdio call each dominates the plot time
+        m_batchedEmit = true;
+
         for( int ii = 1; ii < aPoly.PointCount(); ii++ )
         {
             int arcindex = aPoly.ArcIndex( ii );
@@ -1086,8 +1138,15 @@ void GERBER_PLOTTER::PlotPoly( const SHAPE_LINE_CHAIN& aPoly, FILL_T aFill, int
             {
                 const SHAPE_ARC& arc = aPoly.Arc( arcindex );
 
+                // plotArc() interleaves interpolation mode commands with coordinates,
+                // so it must write straight to the file
+                flushEmitBuffer();
+                m_batchedEmit = false;
+
                 plotArc( arc, true );
 
+                m_batchedEmit = true;
+
                 // skip points on arcs, since we plot the arc itself
                 while( ii+1 < aPoly.PointCount() && arcindex == aPoly.ArcIndex( ii+1 ) )
                     ii++;
@@ -1098,6 +1157,9 @@ void GERBER_PLOTTER::PlotPoly( const SHAPE_LINE_CHAIN& aPoly, FILL_T aFill, int
         if( aPoly.CPoint( 0 ) != aPoly.CLastPoint() )
             FinishTo( VECTOR2I( aPoly.CPoint( 0 ) ) );
 
+        flushEmitBuffer();
+        m_batchedEmit = false;
+
         fmt::println( m_outputFile, "G37*" );
     }
     else if( aWidth != 0 )    // Draw the polyline/polygon outline
@@ -1106,6 +1168,8 @@ void GERBER_PLOTTER::PlotPoly( const SHAPE_LINE_CHAIN& aPoly, FILL_T aFill, int
 
         MoveTo( VECTOR2I( aPoly.CPoint( 0 ) ) );
 
+        m_batchedEmit = true;
+
         for( int ii = 1; ii < aPoly.PointCount(); ii++ )
         {
             int arcindex = aPoly.ArcIndex( ii );
@@ -1119,8 +1183,13 @@ void GERBER_PLOTTER::PlotPoly( const SHAPE_LINE_CHAIN& aPoly, FILL_T aFill, int
             {
                 const SHAPE_ARC& arc = aPoly.Arc( arcindex );
 
+                flushEmitBuffer();
+                m_batchedEmit = false;
+
                 plotArc( arc, true );
 
+                m_batchedEmit = true;
+
                 // skip points on arcs, since we plot the arc itself
                 while( ii+1 < aPoly.PointCount() && arcindex == aPoly.ArcIndex( ii+1 ) )
                     ii++;
@@ -1132,6 +1201,9 @@ void GERBER_PLOTTER::PlotPoly( const SHAPE_LINE_CHAIN& aPoly, FILL_T aFill, int
         if( ( aPoly.CPoint( 0 ) != aPoly.CLastPoint() ) && ( aPoly.IsClosed() || aFill != FILL_T::NO_FILL ) )
             LineTo( VECTOR2I( aPoly.CPoint( 0 ) ) );
 
+        flushEmitBuffer();
+        m_batchedEmit = false;
+
         PenFinish();
     }
 }
@@ -1158,6 +1230,8 @@ void GERBER_PLOTTER::PlotPoly( const std::vector<VECTOR2I>& aCornerList, FILL_T
         MoveTo( aCornerList[0] );
         fmt::println( m_outputFile, "G01*" ); // Set linear interpolation.
 
+        m_batchedEmit = true;
+
         for( unsigned ii = 1; ii < aCornerList.size(); ii++ )
             LineTo( aCornerList[ii] );
 
@@ -1165,6 +1239,9 @@ void GERBER_PLOTTER::PlotPoly( const std::vector<VECTOR2I>& aCornerList, FILL_T
         if( aCornerList[0] != aCornerList[aCornerList.size()-1] )
             FinishTo( aCornerList[0] );
 
+        flushEmitBuffer();
+        m_batchedEmit = false;
+
         fmt::println( m_outputFile, "G37*" );
     }
 
@@ -1174,6 +1251,8 @@ void GERBER_PLOTTER::PlotPoly( const std::vector<VECTOR2I>& aCornerList, FILL_T
 
         MoveTo( aCornerList[0] );
 
+        m_batchedEmit = true;
+
         for( unsigned ii = 1; ii < aCornerList.size(); ii++ )
             LineTo( aCornerList[ii] );
 
@@ -1182,6 +1261,9 @@ void GERBER_PLOTTER::PlotPoly( const std::vector<VECTOR2I>& aCornerList, FILL_T
         if( aFill != FILL_T::NO_FILL && ( aCornerList[aCornerList.size() - 1] != aCornerList[0] ) )
             LineTo( aCornerList[0] );
 
+        flushEmitBuffer();
+        m_batchedEmit = false;
+
         PenFinish();
     }
 }
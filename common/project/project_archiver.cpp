@@ -21,6 +21,7 @@
 #include <wx/dir.h>
 #include <wx/filedlg.h>
 #include <wx/fs_zip.h>
+#include <wx/mstream.h>
 #include <wx/regex.h>
 #include <wx/uri.h>
 #include <wx/wfstream.h>
@@ -30,11 +31,15 @@
 #include <macros.h>
 #include <project/project_archiver.h>
 #include <reporter.h>
+#include <thread_pool.h>
 #include <wildcards_and_files_ext.h>
 #include <wxstream_helper.h>
 #include <wx/log.h>
 #include <kiplatform/io.h>
 
+#include <algorithm>
+#include <deque>
+#include <future>
 #include <regex>
 #include <set>
 
@@ -109,10 +114,106 @@ bool PROJECT_ARCHIVER::AreZipArchivesIdentical( const wxString& aZipFileA,
 }
 
 
+/**
+ * Extract a zip archive with per-entry inflation running on the thread pool.  Zip files are
+ * seekable, so each task opens its own stream over the archive and decompresses just its
+ * entry; the catalog pass and all reporting stay on the calling thread.
+ */
+static bool unarchiveZipParallel( const wxString& aSrcFile, const wxString& aDestDir,
+                                  REPORTER& aReporter )
+{
+    wxFFileInputStream catalogStream( aSrcFile );
+
+    if( !catalogStream.IsOk() )
+    {
+        aReporter.Report( _( "Could not open archive file." ), RPT_SEVERITY_ERROR );
+        return false;
+    }
+
+    wxZipInputStream catalog( catalogStream );
+
+    std::vector<std::unique_ptr<wxZipEntry>> entries;
+
+    for( wxZipEntry* entry = catalog.GetNextEntry(); entry; entry = catalog.GetNextEntry() )
+        entries.emplace_back( entry );
+
+    thread_pool& tp = GetKiCadThreadPool();
+
+    std::vector<std::future<bool>> futures;
+    wxString                       fileStatus;
+
+    for( const std::unique_ptr<wxZipEntry>& entry : entries )
+    {
+        fileStatus.Printf( _( "Extracting file '%s'." ), entry->GetName() );
+        aReporter.Report( fileStatus, RPT_SEVERITY_INFO );
+
+        wxString fullname = aDestDir + entry->GetName();
+
+        // Ensure the target directory exists and create it if not
+        wxString t_path = wxPathOnly( fullname );
+
+        if( !wxDirExists( t_path ) )
+        {
+            wxFileName::Mkdir( t_path, wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL );
+        }
+
+        // Directory entries need only be created, not extracted (0 size)
+        if( entry->IsDir() )
+            continue;
+
+        futures.emplace_back( tp.submit_task(
+                [entry = entry.get(), aSrcFile, fullname]() -> bool
+                {
+                    wxFFileInputStream stream( aSrcFile );
+
+                    if( !stream.IsOk() )
+                        return false;
+
+                    wxZipInputStream zipStream( stream );
+
+                    if( !zipStream.OpenEntry( *entry ) )
+                        return false;
+
+                    wxTempFileOutputStream outputFileStream( fullname );
+
+                    if( !CopyStreamData( zipStream, outputFileStream, entry->GetSize() )
+                            || !outputFileStream.Commit() )
+                    {
+                        return false;
+                    }
+
+                    // Now let's set the filetimes based on what's in the zip
+                    wxFileName outputFileName( fullname );
+                    wxDateTime fileTime = entry->GetDateTime();
+
+                    // For now we set access, mod, create to the same datetime
+                    // create (third arg) is only used on Windows
+                    outputFileName.SetTimes( &fileTime, &fileTime, &fileTime );
+
+                    return true;
+                } ) );
+    }
+
+    for( std::future<bool>& future : futures )
+    {
+        if( !future.get() )
+            aReporter.Report( _( "Error extracting file!" ), RPT_SEVERITY_ERROR );
+    }
+
+    aReporter.Report( wxT( "Extracted project." ), RPT_SEVERITY_INFO );
+    return true;
+}
+
+
 // Unarchive Files code comes from wxWidgets sample/archive/archive.cpp
 bool PROJECT_ARCHIVER::Unarchive( const wxString& aSrcFile, const wxString& aDestDir,
                                   REPORTER& aReporter )
 {
+    // Zip archives (the common case) can be extracted in parallel; other formats fall
+    // through to the generic sequential path below.
+    if( wxFileName( aSrcFile ).GetExt().Lower() == ZipFileExtension )
+        return unarchiveZipParallel( aSrcFile, aDestDir, aReporter );
+
     wxFFileInputStream stream( aSrcFile );
 
     if( !stream.IsOk() )
@@ -273,6 +374,55 @@ bool PROJECT_ARCHIVER::Archive( const wxString& aSrcDir, const wxString& aDestFi
 
     projectDir.Traverse( traverser );
 
+    // Deflate dominates archive time, so each file is compressed into a single-entry zip in
+    // memory on the thread pool, and the already-compressed entries are then spliced into the
+    // output stream (raw, no recompression) in traversal order.  The window bounds read-ahead
+    // memory while keeping every core busy.
+    struct COMPRESSED_FILE
+    {
+        wxString             absoluteFn;
+        wxString             relativeFn;
+        size_t               uncompressedBytes = 0;
+        bool                 ok = false;
+        wxMemoryOutputStream zipData;
+    };
+
+    thread_pool& tp = GetKiCadThreadPool();
+
+    std::deque<std::pair<std::unique_ptr<COMPRESSED_FILE>, std::future<void>>> window;
+    const size_t windowLimit = std::max<size_t>( 2, tp.get_thread_count() ) * 2;
+
+    auto spliceCompressedFile =
+            [&]( COMPRESSED_FILE* aFile )
+            {
+                bool copied = false;
+
+                if( aFile->ok )
+                {
+                    wxMemoryInputStream memInput( aFile->zipData );
+                    wxZipInputStream    singleZip( memInput );
+
+                    if( wxZipEntry* entry = singleZip.GetNextEntry() )
+                        copied = zipstream.CopyEntry( entry, singleZip );
+                }
+
+                if( copied )
+                {
+                    uncompressedBytes += aFile->uncompressedBytes;
+
+                    if( aVerbose )
+                    {
+                        msg.Printf( _( "Archived file '%s'." ), aFile->relativeFn );
+                        aReporter.Report( msg, RPT_SEVERITY_INFO );
+                    }
+                }
+                else if( aVerbose )
+                {
+                    msg.Printf( _( "Failed to archive file '%s'." ), aFile->relativeFn );
+                    aReporter.Report( msg, RPT_SEVERITY_ERROR );
+                }
+            };
+
     for( const wxString& fileName : traverser.GetFilesToArchive() )
     {
         wxFileName fn( fileName );
@@ -294,40 +444,48 @@ bool PROJECT_ARCHIVER::Archive( const wxString& aSrcDir, const wxString& aDestFi
         if( !archive )
             continue;
 
-        wxFileSystem fsFile;
         fn.MakeRelativeTo( aSrcDir );
 
-        wxString relativeFn = fn.GetFullPath();
+        auto file = std::make_unique<COMPRESSED_FILE>();
+        file->absoluteFn = fileName;
+        file->relativeFn = fn.GetFullPath();
 
-        // Read input file and add it to the zip file:
-        wxFSFile* infile = fsFile.OpenFile( relativeFn );
+        COMPRESSED_FILE* filePtr = file.get();
 
-        if( infile )
-        {
-            zipstream.PutNextEntry( relativeFn, infile->GetModificationTime() );
-            infile->GetStream()->Read( zipstream );
-            zipstream.CloseEntry();
+        window.emplace_back( std::move( file ), tp.submit_task(
+                [filePtr]()
+                {
+                    wxFFileInputStream input( filePtr->absoluteFn );
 
-            uncompressedBytes += infile->GetStream()->GetSize();
+                    if( !input.IsOk() )
+                        return;
 
-            if( aVerbose )
-            {
-                msg.Printf( _( "Archived file '%s'." ), relativeFn );
-                aReporter.Report( msg, RPT_SEVERITY_INFO );
-            }
+                    wxZipOutputStream singleZip( filePtr->zipData, -1, wxConvUTF8 );
 
-            delete infile;
-        }
-        else
+                    singleZip.PutNextEntry( filePtr->relativeFn,
+                                            wxFileName( filePtr->absoluteFn ).GetModificationTime() );
+                    input.Read( singleZip );
+                    singleZip.CloseEntry();
+
+                    filePtr->uncompressedBytes = input.GetSize();
+                    filePtr->ok = singleZip.Close();
+                } ) );
+
+        if( window.size() >= windowLimit )
         {
-            if( aVerbose )
-            {
-                msg.Printf( _( "Failed to archive file '%s'." ), relativeFn );
-                aReporter.Report( msg, RPT_SEVERITY_ERROR );
-            }
+            window.front().second.wait();
+            spliceCompressedFile( window.front().first.get() );
+            window.pop_front();
         }
     }
 
+    while( !window.empty() )
+    {
+        window.front().second.wait();
+        spliceCompressedFile( window.front().first.get() );
+        window.pop_front();
+    }
+
     auto reportSize =
             []( size_t aSize ) -> wxString
             {
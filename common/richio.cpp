@@ -32,9 +32,11 @@
 #include <errno.h>
 #include <advanced_config.h>
 #include <io/kicad/kicad_io_utils.h>
+#include <thread_pool.h>
 
 #include <wx/translation.h>
 #include <wx/ffile.h>
+#include <wx/filename.h>
 
 
 // Fall back to getc() when getc_unlocked() is not available on the target platform.
@@ -282,6 +284,91 @@ char* FILE_LINE_READER::ReadLine()
 }
 
 
+WHOLE_FILE_LINE_READER::WHOLE_FILE_LINE_READER( const wxString& aFileName,
+                                                unsigned aStartingLineNumber ) :
+    LINE_READER( 0 ),       // no separate line buffer; lines point into m_buffer
+    m_ndx( 0 ),
+    m_savedChar( '\0' )
+{
+    FILE* fp = KIPLATFORM::IO::SeqFOpen( aFileName, wxT( "rb" ) );
+
+    if( !fp )
+    {
+        wxString msg = wxString::Format( _( "Unable to open %s for reading." ),
+                                         aFileName.GetData() );
+        THROW_IO_ERROR( msg );
+    }
+
+    m_source  = aFileName;
+    m_lineNum = aStartingLineNumber;
+
+    fseek( fp, 0, SEEK_END );
+    long fileSize = ftell( fp );
+    rewind( fp );
+
+    if( fileSize > 0 )
+    {
+        m_buffer.resize( (size_t) fileSize );
+
+        size_t bytesRead = fread( m_buffer.data(), 1, (size_t) fileSize, fp );
+        m_buffer.resize( bytesRead );
+    }
+
+    fclose( fp );
+}
+
+
+WHOLE_FILE_LINE_READER::~WHOLE_FILE_LINE_READER()
+{
+    m_line = nullptr;       // points into m_buffer; not ours to delete
+}
+
+
+char* WHOLE_FILE_LINE_READER::ReadLine()
+{
+    // Restore the byte displaced by the previous line's nul terminator.
+    if( m_ndx > 0 && m_ndx < m_buffer.size() )
+        m_buffer[m_ndx] = m_savedChar;
+
+    size_t lineStart = m_ndx;
+    size_t nlOffset  = m_buffer.find( '\n', m_ndx );
+
+    if( nlOffset == std::string::npos )
+        m_length = m_buffer.size() - m_ndx;
+    else
+        m_length = nlOffset - m_ndx + 1;     // include the newline, so +1
+
+    m_ndx += m_length;
+
+    // Terminate the line in place; the overwritten byte (the first character of the next
+    // line) is restored on the next call.  The buffer's own trailing nul covers a file
+    // that does not end with a newline.
+    if( m_ndx < m_buffer.size() )
+    {
+        m_savedChar = m_buffer[m_ndx];
+        m_buffer[m_ndx] = '\0';
+    }
+
+    m_line = m_buffer.data() + lineStart;
+
+    // m_lineNum is incremented even if there was no line read, because this
+    // leads to better error reporting when we hit an end of file.
+    ++m_lineNum;
+
+    return m_length ? m_line : nullptr;
+}
+
+
+void WHOLE_FILE_LINE_READER::Rewind()
+{
+    if( m_ndx > 0 && m_ndx < m_buffer.size() )
+        m_buffer[m_ndx] = m_savedChar;
+
+    m_ndx = 0;
+    m_lineNum = 0;
+}
+
+
 STRING_LINE_READER::STRING_LINE_READER( const std::string& aString, const wxString& aSource ):
     LINE_READER( LINE_READER_LINE_DEFAULT_MAX ),
     m_lines( aString ), m_ndx( 0 )
@@ -613,12 +700,20 @@ PRETTIFIED_FILE_OUTPUTFORMATTER::PRETTIFIED_FILE_OUTPUTFORMATTER( const wxString
                                                                   const wxChar* aMode,
                                                                   char aQuoteChar ) :
         OUTPUTFORMATTER( OUTPUTFMTBUFZ, aQuoteChar ),
+        m_filename( aFileName ),
         m_mode( aFormatMode )
 {
     if( ADVANCED_CFG::GetCfg().m_CompactSave && m_mode == KICAD_FORMAT::FORMAT_MODE::NORMAL )
         m_mode = KICAD_FORMAT::FORMAT_MODE::COMPACT_TEXT_PROPERTIES;
 
-    m_fp = wxFopen( aFileName, aMode );
+    // Write to a sibling temp file (same directory, so the rename in Finish() stays on one
+    // filesystem and is atomic), leaving any existing file intact until the write succeeds.
+    m_tempFilename = wxFileName::CreateTempFileName( aFileName );
+
+    if( !m_tempFilename.IsEmpty() )
+        m_fp = wxFopen( m_tempFilename, aMode );
+    else
+        m_fp = nullptr;
 
     if( !m_fp )
         THROW_IO_ERROR( strerror( errno ) );
@@ -636,20 +731,73 @@ PRETTIFIED_FILE_OUTPUTFORMATTER::~PRETTIFIED_FILE_OUTPUTFORMATTER()
 }
 
 
+/**
+ * The tail end of a prettified save: prettify aBuf, write it to the (already open) temp file
+ * and atomically rename the temp file over the destination.  Runs on the caller's thread from
+ * Finish() and on a pool thread from FinishAsync(), so it must only touch its arguments.
+ */
+static bool prettifyWriteAndRename( FILE* aFile, std::string& aBuf, const wxString& aTempName,
+                                    const wxString& aDestName, KICAD_FORMAT::FORMAT_MODE aMode )
+{
+    KICAD_FORMAT::Prettify( aBuf, aMode );
+
+    if( !aBuf.empty() && fwrite( aBuf.c_str(), aBuf.length(), 1, aFile ) != 1 )
+    {
+        int error = errno;
+        fclose( aFile );
+        wxRemoveFile( aTempName );
+        THROW_IO_ERROR( strerror( error ) );
+    }
+
+    fclose( aFile );
+
+    // Preserve the permissions of any file we're replacing.
+    KIPLATFORM::IO::DuplicatePermissions( aDestName, aTempName );
+
+    if( !wxRenameFile( aTempName, aDestName, true ) )
+    {
+        wxRemoveFile( aTempName );
+        THROW_IO_ERROR( wxString::Format( _( "Unable to rename temporary file '%s' to '%s'." ),
+                                          aTempName, aDestName ) );
+    }
+
+    return true;
+}
+
+
 bool PRETTIFIED_FILE_OUTPUTFORMATTER::Finish()
 {
     if( !m_fp )
         return false;
 
-    KICAD_FORMAT::Prettify( m_buf, m_mode );
+    FILE* fp = m_fp;
+    m_fp = nullptr;
+
+    return prettifyWriteAndRename( fp, m_buf, m_tempFilename, m_filename, m_mode );
+}
 
-    if( fwrite( m_buf.c_str(), m_buf.length(), 1, m_fp ) != 1 )
-        THROW_IO_ERROR( strerror( errno ) );
 
-    fclose( m_fp );
+std::future<bool> PRETTIFIED_FILE_OUTPUTFORMATTER::FinishAsync()
+{
+    if( !m_fp )
+    {
+        std::promise<bool> done;
+        done.set_value( false );
+        return done.get_future();
+    }
+
+    FILE* fp = m_fp;
     m_fp = nullptr;
 
-    return true;
+    thread_pool& tp = GetKiCadThreadPool();
+
+    // The task owns everything it needs; the formatter may be destroyed before it runs.
+    return tp.submit_task(
+            [fp, buf = std::move( m_buf ), tempName = m_tempFilename, destName = m_filename,
+             mode = m_mode]() mutable
+            {
+                return prettifyWriteAndRename( fp, buf, tempName, destName, mode );
+            } );
 }
 
 
@@ -108,6 +108,12 @@ void SETTINGS_MANAGER::ResetToDefaults()
     {
         if( settings->GetLocation() == SETTINGS_LOC::USER || settings->GetLocation() == SETTINGS_LOC::COLORS )
         {
+            // Resetting materializes defaults on disk, so a pending deferred load is now moot
+            {
+                std::lock_guard lock( m_app_settings_mutex );
+                m_pendingLoad.erase( settings.get() );
+            }
+
             std::map<std::string, nlohmann::json> fileHistories = settings->GetFileHistories();
 
             settings->Internals()->clear();
@@ -128,6 +134,9 @@ void SETTINGS_MANAGER::ClearFileHistory()
     {
         if( settings->GetLocation() == SETTINGS_LOC::USER )
         {
+            // Pull in any deferred load first so we rewrite the user's real file, not defaults
+            loadIfPending( settings.get() );
+
             for( const auto& [path, history] : settings->GetFileHistories() )
                 settings->Set( path, nlohmann::json::array() );
 
@@ -147,13 +156,32 @@ JSON_SETTINGS* SETTINGS_MANAGER::registerSettings( JSON_SETTINGS* aSettings, boo
                 ptr->GetFullFilename() );
 
     if( aLoadNow )
+    {
         ptr->LoadFromFile( GetPathForSettingsFile( ptr.get() ) );
+    }
+    else
+    {
+        std::lock_guard lock( m_app_settings_mutex );
+        m_pendingLoad.insert( ptr.get() );
+    }
 
     m_settings.push_back( std::move( ptr ) );
     return m_settings.back().get();
 }
 
 
+void SETTINGS_MANAGER::loadIfPending( JSON_SETTINGS* aSettings )
+{
+    std::lock_guard lock( m_app_settings_mutex );
+
+    if( m_pendingLoad.erase( aSettings ) )
+    {
+        wxLogTrace( traceSettings, wxT( "Deferred load of %s" ), aSettings->GetFullFilename() );
+        aSettings->LoadFromFile( GetPathForSettingsFile( aSettings ) );
+    }
+}
+
+
 void SETTINGS_MANAGER::Load()
 {
     // TODO(JE) We should check for dirty settings here and write them if so, because
@@ -169,6 +197,9 @@ void SETTINGS_MANAGER::Load()
 
     for( JSON_SETTINGS* settings : toLoad )
         settings->LoadFromFile( GetPathForSettingsFile( settings ) );
+
+    std::lock_guard lock( m_app_settings_mutex );
+    m_pendingLoad.clear();
 }
 
 
@@ -181,7 +212,12 @@ void SETTINGS_MANAGER::Load( JSON_SETTINGS* aSettings )
                             } );
 
     if( it != m_settings.end() )
+    {
         ( *it )->LoadFromFile( GetPathForSettingsFile( it->get() ) );
+
+        std::lock_guard lock( m_app_settings_mutex );
+        m_pendingLoad.erase( it->get() );
+    }
 }
 
 
@@ -201,6 +237,15 @@ void SETTINGS_MANAGER::Save()
             continue;
         }
 
+        // Never save a settings object whose deferred load hasn't happened yet; it only holds
+        // defaults and saving it would clobber the user's file
+        {
+            std::lock_guard lock( m_app_settings_mutex );
+
+            if( m_pendingLoad.count( settings.get() ) )
+                continue;
+        }
+
         settings->SaveToFile( GetPathForSettingsFile( settings.get() ) );
     }
 }
@@ -216,6 +261,13 @@ void SETTINGS_MANAGER::Save( JSON_SETTINGS* aSettings )
 
     if( it != m_settings.end() )
     {
+        {
+            std::lock_guard lock( m_app_settings_mutex );
+
+            if( m_pendingLoad.count( it->get() ) )
+                return;     // never loaded; saving would clobber the user's file with defaults
+        }
+
         wxLogTrace( traceSettings, wxT( "Saving %s" ), ( *it )->GetFullFilename() );
         ( *it )->SaveToFile( GetPathForSettingsFile( it->get() ) );
     }
@@ -234,7 +286,16 @@ void SETTINGS_MANAGER::FlushAndRelease( JSON_SETTINGS* aSettings, bool aSave )
     {
         wxLogTrace( traceSettings, wxT( "Flush and release %s" ), ( *it )->GetFullFilename() );
 
-        if( aSave )
+        bool pending;
+
+        {
+            std::lock_guard lock( m_app_settings_mutex );
+            pending = m_pendingLoad.erase( it->get() ) > 0;
+        }
+
+        // A still-pending object was never loaded, so it only holds defaults; saving it would
+        // clobber the user's file
+        if( aSave && !pending )
             ( *it )->SaveToFile( GetPathForSettingsFile( it->get() ) );
 
         JSON_SETTINGS* tmp = it->get(); // We use a temporary to suppress a Clang warning
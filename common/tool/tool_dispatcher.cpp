@@ -32,8 +32,10 @@
 #include <wx/stc/stc.h>
 #include <wx/settings.h>
 
+#include <background_job_scheduler.h>
 #include <core/ignore.h>
 #include <macros.h>
+#include <pgm_base.h>
 #include <trace_helpers.h>
 #include <tool/tool_manager.h>
 #include <tool/actions.h>
@@ -520,6 +522,11 @@ void TOOL_DISPATCHER::DispatchWxEvent( wxEvent& aEvent )
         }
     }
 
+    // Clicks and keystrokes mark the start (or continuation) of interactive work; running
+    // background jobs pause at their next checkpoint until input has been quiet for a while.
+    if( isMouseClick( type ) || type == wxEVT_CHAR || type == wxEVT_CHAR_HOOK )
+        Pgm().GetBackgroundJobScheduler().NotifyUserActivity();
+
     // Mouse handling
     // Note: wxEVT_LEFT_DOWN event must always be skipped.
     if( type == wxEVT_MOTION || type == wxEVT_MOUSEWHEEL ||
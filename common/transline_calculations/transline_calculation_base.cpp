@@ -62,6 +62,36 @@ void TRANSLINE_CALCULATION_BASE::SetSynthesisResult( const TRANSLINE_PARAMETERS
 }
 
 
+std::vector<std::vector<double>>
+TRANSLINE_CALCULATION_BASE::AnalyseSweep( const TRANSLINE_PARAMETERS aSweptParam,
+                                          const std::vector<double>& aValues,
+                                          const std::vector<TRANSLINE_PARAMETERS>& aOutputs )
+{
+    std::vector<std::vector<double>> results;
+    results.reserve( aValues.size() );
+
+    const double restoreValue = GetParameter( aSweptParam );
+
+    for( const double value : aValues )
+    {
+        SetParameter( aSweptParam, value );
+        Analyse();
+
+        std::vector<double> row;
+        row.reserve( aOutputs.size() );
+
+        for( const TRANSLINE_PARAMETERS output : aOutputs )
+            row.push_back( GetParameter( output ) );
+
+        results.push_back( std::move( row ) );
+    }
+
+    SetParameter( aSweptParam, restoreValue );
+
+    return results;
+}
+
+
 bool TRANSLINE_CALCULATION_BASE::MinimiseZ0Error1D( const TRANSLINE_PARAMETERS aOptimise,
                                                     const TRANSLINE_PARAMETERS aMeasure, bool aRecalculateLength )
 {
@@ -23,6 +23,7 @@
 
 #include <cmath>
 #include <unordered_map>
+#include <vector>
 
 
 /// All possible parameters used (as inputs or outputs) by the transmission line calculations
@@ -136,6 +137,24 @@ public:
     /// @returns true if the synthesis converged, otherwise false
     virtual bool Synthesize( SYNTHESIZE_OPTS aOpts ) = 0;
 
+    /**
+    * Evaluates the analysis over a sweep of one input parameter.
+    *
+    * The swept parameter is set to each value in turn, Analyse() is run, and the requested
+    * output parameters are captured per point.  Batching a sweep into one call avoids paying
+    * per-point calculator setup when scripting impedance sweeps, and because the parameter
+    * state carries over between points each solve starts from the previous point's solution.
+    * The swept parameter is restored to its original value afterwards.
+    *
+    * @param aSweptParam the input parameter to sweep
+    * @param aValues the values to evaluate, in order
+    * @param aOutputs the output parameters to capture at each point
+    * @return one row per sweep value containing the captured outputs in aOutputs order
+    */
+    std::vector<std::vector<double>> AnalyseSweep( TRANSLINE_PARAMETERS aSweptParam,
+                                                   const std::vector<double>& aValues,
+                                                   const std::vector<TRANSLINE_PARAMETERS>& aOutputs );
+
 protected:
     /// Initialises the properties used (as inputs or outputs) by the calculation
     void InitProperties( const std::initializer_list<TRANSLINE_PARAMETERS>& aParams );
@@ -40,11 +40,11 @@
 #include <gal/painter.h>
 #include <algorithm>
 
+#include <advanced_config.h>
 #include <core/profile.h>
+#include <thread_pool.h>
 
-#ifdef KICAD_GAL_PROFILE
 #include <wx/log.h>
-#endif
 
 namespace KIGFX {
 
@@ -60,7 +60,8 @@ public:
         m_drawPriority( 0 ),
         m_cachedIndex( -1 ),
         m_groups( nullptr ),
-        m_groupsSize( 0 ) {}
+        m_groupsSize( 0 ),
+        m_lodGeneration( -1 ) {}
 
     ~VIEW_ITEM_DATA()
     {
@@ -220,6 +221,11 @@ private:
     std::vector<int>     m_layers;           /// Stores layer numbers used by the item.
 
     BOX2I                m_bbox;             /// Cached inserted Bbox for faster removals.
+
+    std::vector<std::pair<int, double>> m_lods;  ///< layer_number:LOD pairs cached from
+                                                 ///< ViewGetLOD().
+
+    int                  m_lodGeneration;    ///< Generation the cached LODs were computed for.
 };
 
 
@@ -245,7 +251,11 @@ VIEW::VIEW() :
     m_gal( nullptr ),
     m_useDrawPriority( false ),
     m_nextDrawPriority( 0 ),
-    m_reverseDrawOrder( false )
+    m_reverseDrawOrder( false ),
+    m_damageValid( false ),
+    m_damageFull( true ),
+    m_damageScissor( false ),
+    m_lodGeneration( 0 )
 {
     // Set m_boundary to define the max area size. The default area size
     // is defined here as the max value of a int.
@@ -942,6 +952,7 @@ struct VIEW::DRAW_ITEM_VISITOR
         layer( aLayer ),
         useDrawPriority( aUseDrawPriority ),
         reverseDrawOrder( aReverseDrawOrder ),
+        drawItemCount( 0 ),
         drawForcedTransparent( false ),
         foundForcedTransparent( false )
     {
@@ -957,7 +968,7 @@ struct VIEW::DRAW_ITEM_VISITOR
             return true;
         }
 
-        const double itemLOD = aItem->ViewGetLOD( layer, view );
+        const double itemLOD = view->itemLOD( aItem, layer );
 
         // Conditions that have to be fulfilled for an item to be drawn
         bool drawCondition = aItem->viewPrivData()->isRenderable() && itemLOD < view->m_scale;
@@ -965,6 +976,8 @@ struct VIEW::DRAW_ITEM_VISITOR
         if( !drawCondition )
             return true;
 
+        drawItemCount++;
+
         if( useDrawPriority )
             drawItems.push_back( aItem );
         else
@@ -1001,6 +1014,7 @@ struct VIEW::DRAW_ITEM_VISITOR
     VIEW* view;
     int layer, layers[VIEW_MAX_LAYERS];
     bool useDrawPriority, reverseDrawOrder;
+    int drawItemCount;
     std::vector<VIEW_ITEM*> drawItems;
     bool drawForcedTransparent;
     bool foundForcedTransparent;
@@ -1009,11 +1023,19 @@ struct VIEW::DRAW_ITEM_VISITOR
 
 void VIEW::redrawRect( const BOX2I& aRect )
 {
+    // Collecting the timings costs a timer read per layer, so it is only done when
+    // somebody is going to look at them.
+    const bool profileLayers = wxLog::IsAllowedTraceMask( traceGalProfile )
+                               || ADVANCED_CFG::GetCfg().m_ShowFrameTimingHUD;
+
+    m_lastLayerTimings.clear();
+
     for( VIEW_LAYER* l : m_orderedLayers )
     {
         if( l->visible && IsTargetDirty( l->target ) && areRequiredLayersEnabled( l->id ) )
         {
             DRAW_ITEM_VISITOR drawFunc( this, l->id, m_useDrawPriority, m_reverseDrawOrder );
+            PROF_TIMER        layerTimer;
 
             m_gal->SetTarget( l->target );
             m_gal->SetLayerDepth( l->renderingOrder );
@@ -1045,11 +1067,48 @@ void VIEW::redrawRect( const BOX2I& aRect )
 
                 l->items->Query( aRect, drawFunc );
             }
+
+            if( profileLayers && drawFunc.drawItemCount > 0 )
+            {
+                layerTimer.Stop();
+
+                m_lastLayerTimings.push_back(
+                        { l->id, drawFunc.drawItemCount, layerTimer.msecs() } );
+
+                KI_TRACE( traceGalProfile, "Layer %d target %d items %d: %.3f ms\n", l->id,
+                          l->target, drawFunc.drawItemCount, layerTimer.msecs() );
+            }
         }
     }
 }
 
 
+double VIEW::itemLOD( const VIEW_ITEM* aItem, int aLayer ) const
+{
+    VIEW_ITEM_DATA* viewData = aItem->viewPrivData();
+
+    // ViewGetLOD() implementations can be surprisingly expensive (layer visibility masks,
+    // bounding boxes), and their results only change when the item or the view settings
+    // do, so the per-layer results are cached between frames.
+    if( viewData->m_lodGeneration != m_lodGeneration )
+    {
+        viewData->m_lods.clear();
+        viewData->m_lodGeneration = m_lodGeneration;
+    }
+
+    for( const std::pair<int, double>& lod : viewData->m_lods )
+    {
+        if( lod.first == aLayer )
+            return lod.second;
+    }
+
+    const double lod = aItem->ViewGetLOD( aLayer, this );
+    viewData->m_lods.emplace_back( aLayer, lod );
+
+    return lod;
+}
+
+
 void VIEW::draw( VIEW_ITEM* aItem, int aLayer, bool aImmediate )
 {
     VIEW_ITEM_DATA* viewData = aItem->viewPrivData();
@@ -1159,12 +1218,22 @@ void VIEW::ClearTargets()
 {
     if( IsTargetDirty( TARGET_CACHED ) || IsTargetDirty( TARGET_NONCACHED ) )
     {
+        // If only a bounded region changed since the last frame, restrict the clears (and
+        // the redraw that follows) to it; the untouched part of the target framebuffers
+        // is composited as-is.
+        if( !m_damageFull && m_damageValid )
+            m_damageScissor = setDamageScissor();
+
         // TARGET_CACHED and TARGET_NONCACHED have to be redrawn together, as they contain
         // layers that rely on each other (eg. netnames are noncached, but tracks - are cached)
         m_gal->ClearTarget( TARGET_NONCACHED );
         m_gal->ClearTarget( TARGET_CACHED );
 
+        // Marking the remaining targets dirty is frame-internal bookkeeping; it must not
+        // widen the damage region that was just committed to the scissor.
+        bool damageFull = m_damageFull;
         MarkDirty();
+        m_damageFull = damageFull;
     }
 
     if( IsTargetDirty( TARGET_OVERLAY ) )
@@ -1174,6 +1243,23 @@ void VIEW::ClearTargets()
 }
 
 
+bool VIEW::setDamageScissor()
+{
+    VECTOR2D corner1 = ToScreen( VECTOR2D( m_damage.GetOrigin() ) );
+    VECTOR2D corner2 = ToScreen( VECTOR2D( m_damage.GetEnd() ) );
+
+    BOX2D screenRect( corner1, corner2 - corner1 );
+    screenRect.Normalize();
+
+    BOX2I scissor = BOX2ISafe( screenRect );
+
+    // Guard band for antialiasing filter taps and subpixel rounding
+    scissor.Inflate( 4 );
+
+    return m_gal->SetScissor( scissor );
+}
+
+
 void VIEW::Redraw()
 {
 #ifdef KICAD_GAL_PROFILE
@@ -1187,10 +1273,24 @@ void VIEW::Redraw()
     rect.Normalize();
     BOX2I recti = BOX2ISafe( rect );
 
+    // When the GAL is scissored to the damage region, querying only the damaged extent
+    // skips the items whose pixels are reused from the cached framebuffers.
+    if( m_damageScissor )
+        recti = recti.Intersect( m_damage );
+
     redrawRect( recti );
 
+    if( m_damageScissor )
+    {
+        m_gal->ClearScissor();
+        m_damageScissor = false;
+    }
+
     // All targets were redrawn, so nothing is dirty
     MarkClean();
+    m_damageValid = false;
+    m_damageFull = false;
+    m_damage = BOX2I();
 
 #ifdef KICAD_GAL_PROFILE
     totalRealTime.Stop();
@@ -1270,6 +1370,7 @@ void VIEW::invalidateItem( VIEW_ITEM* aItem, int aUpdateFlags )
         MarkTargetDirty( m_layers[layer].target );
     }
 
+    aItem->viewPrivData()->m_lods.clear();
     aItem->viewPrivData()->clearUpdateFlags();
 }
 
@@ -1508,20 +1609,41 @@ void VIEW::UpdateItems()
     {
         auto allItems = *m_allItems;
 
+        // Bounding boxes and layer sets are pure geometry and dominate the rebuild cost,
+        // so compute them on the thread pool; the R-tree inserts below then commit the
+        // results in a single serial batch.
+        std::vector<BOX2I>            bboxes( allItems.size() );
+        std::vector<std::vector<int>> itemLayers( allItems.size() );
+
+        thread_pool& tp = GetKiCadThreadPool();
+
+        tp.submit_loop( 0, allItems.size(),
+                        [&]( size_t ii )
+                        {
+                            if( VIEW_ITEM* item = allItems[ii] )
+                            {
+                                bboxes[ii] = item->ViewBBox();
+                                itemLayers[ii] = item->ViewGetLayers();
+                            }
+                        }, TP_PRIORITY_INTERACTIVE )
+                .wait();
+
         // kill all Rtrees
         for( auto& [_, layer] : m_layers )
             layer.items->RemoveAll();
 
         // and re-insert items from scratch
-        for( VIEW_ITEM* item : allItems )
+        for( size_t ii = 0; ii < allItems.size(); ++ii )
         {
+            VIEW_ITEM* item = allItems[ii];
+
             if( !item )
                 continue;
 
-            const BOX2I bbox = item->ViewBBox();
+            const BOX2I& bbox = bboxes[ii];
             item->m_viewPrivData->m_bbox = bbox;
 
-            std::vector<int> layers = item->ViewGetLayers();
+            const std::vector<int>& layers = itemLayers[ii];
             item->viewPrivData()->saveLayers( layers );
 
             for( int layer : layers )
@@ -1541,16 +1663,63 @@ void VIEW::UpdateItems()
 
     if( anyUpdated )
     {
+        // Let the painter rebuild its expensive GAL-independent caches (e.g. zone
+        // triangulation) from worker threads first; the display list rebuild below is
+        // bound to the GL context and stays serial, but then only commits ready-made
+        // geometry.
+        std::vector<VIEW_ITEM*> toPrepare;
+
+        for( VIEW_ITEM* item : *m_allItems )
+        {
+            if( item && item->viewPrivData()
+                && ( item->viewPrivData()->m_requiredUpdate
+                     & ( GEOMETRY | LAYERS | REPAINT | INITIAL_ADD ) ) )
+            {
+                toPrepare.push_back( item );
+            }
+        }
+
+        if( m_painter && !toPrepare.empty() )
+        {
+            thread_pool& tp = GetKiCadThreadPool();
+
+            tp.submit_loop( 0, toPrepare.size(),
+                            [&]( size_t ii )
+                            {
+                                m_painter->PrepareItem( toPrepare[ii] );
+                            }, TP_PRIORITY_INTERACTIVE )
+                    .wait();
+        }
+
         GAL_UPDATE_CONTEXT ctx( m_gal );
 
+        // Track the world-space extent of the items being committed (both their old and
+        // new positions), so the next redraw can be restricted to the damaged region.
+        // invalidateItem() marks targets dirty, which conservatively assumes unbounded
+        // damage; restore the flag afterwards since here the extent is known.
+        bool damageFull = m_damageFull;
+
         for( VIEW_ITEM* item : *m_allItems.get() )
         {
             if( item && item->viewPrivData() && item->viewPrivData()->m_requiredUpdate != NONE )
             {
+                if( m_damageValid )
+                {
+                    m_damage.Merge( item->viewPrivData()->m_bbox );
+                }
+                else
+                {
+                    m_damage = item->viewPrivData()->m_bbox;
+                    m_damageValid = true;
+                }
+
                 invalidateItem( item, item->viewPrivData()->m_requiredUpdate );
+                m_damage.Merge( item->viewPrivData()->m_bbox );
                 item->viewPrivData()->m_requiredUpdate = NONE;
             }
         }
+
+        m_damageFull = damageFull;
     }
 
     KI_TRACE( traceGalProfile, wxS( "View update: total items %u, geom %u anyUpdated %u\n" ),
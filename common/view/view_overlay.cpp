@@ -31,6 +31,7 @@
 #include <gal/painter.h>
 
 #include <geometry/seg.h>
+#include <geometry/shape_line_chain.h>
 
 namespace KIGFX {
 
@@ -128,11 +129,31 @@ struct VIEW_OVERLAY::COMMAND_POLYGON : public VIEW_OVERLAY::COMMAND
 };
 
 
+struct VIEW_OVERLAY::COMMAND_POLYLINE : public VIEW_OVERLAY::COMMAND
+{
+    COMMAND_POLYLINE( const SHAPE_LINE_CHAIN& aPolyLine ) :
+        m_polyLine( aPolyLine )
+    { }
+
+    virtual void Execute( VIEW* aView ) const override
+    {
+        aView->GetGAL()->DrawPolyline( m_polyLine );
+    }
+
+    SHAPE_LINE_CHAIN m_polyLine;
+};
+
+
 struct VIEW_OVERLAY::COMMAND_POLY_POLYGON : public VIEW_OVERLAY::COMMAND
 {
     COMMAND_POLY_POLYGON( const SHAPE_POLY_SET& aPolySet ) :
         m_polySet( aPolySet )
-    { }
+    {
+        // Tessellate once at record time; the command list may be replayed every frame,
+        // and an untriangulated polygon set falls back to GLU tessellation on each replay
+        if( m_polySet.OutlineCount() > 0 && !m_polySet.IsTriangulationUpToDate() )
+            m_polySet.CacheTriangulation( true, true );
+    }
 
     virtual void Execute( VIEW* aView ) const override
     {
@@ -345,8 +366,7 @@ void VIEW_OVERLAY::Polyline( const SHAPE_LINE_CHAIN& aPolyLine )
     SetIsStroke( true );
     SetIsFill( false );
 
-    for( int i = 0; i < aPolyLine.SegmentCount(); i++ )
-        Line( aPolyLine.CSegment( i ) );
+    m_commands.push_back( new COMMAND_POLYLINE( aPolyLine ) );
 }
 
 
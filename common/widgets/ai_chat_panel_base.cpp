@@ -2458,18 +2458,18 @@ void AI_CHAT_PANEL_BASE::onSendMessage( wxCommandEvent& aEvent )
     // This prevents "Session expired" errors by ensuring we always have a valid token
     if( AUTH_MANAGER::Instance().IsAuthenticated() )
     {
-        if( AUTH_MANAGER::Instance().IsTokenExpiringSoon() )
+        if( AUTH_MANAGER::Instance().IsTokenExpired() )
         {
-            if( AUTH_MANAGER::Instance().RefreshAccessToken() )
-            {
-                // Proactive token refresh successful
-            }
-            else
-            {
-                // Proactive token refresh failed, but continuing with existing token
-                // Don't block the request - the backend might still accept the token
-                // If it truly fails, we'll get auth_error from the backend
-            }
+            // Token is already dead - a request with it would fail, so refresh
+            // synchronously before sending.  If the refresh fails we continue
+            // anyway and let the backend's auth_error drive the sign-out.
+            AUTH_MANAGER::Instance().RefreshAccessToken();
+        }
+        else if( AUTH_MANAGER::Instance().IsTokenExpiringSoon() )
+        {
+            // Token is still valid for this request - refresh in the background
+            // instead of stalling the UI thread on a network round-trip
+            AUTH_MANAGER::Instance().RefreshAccessTokenAsync();
         }
     }
 
@@ -2935,12 +2935,15 @@ void AI_CHAT_PANEL_BASE::sendToBackendAsync( const wxString& aMessage )
     // Proactively refresh token if expiring soon
     if( AUTH_MANAGER::Instance().IsAuthenticated() )
     {
-        if( AUTH_MANAGER::Instance().IsTokenExpiringSoon() )
+        if( AUTH_MANAGER::Instance().IsTokenExpired() )
         {
-            if( !AUTH_MANAGER::Instance().RefreshAccessToken() )
-            {
-                // Proactive token refresh failed - will sign out on 401
-            }
+            // Already expired: refresh synchronously, will sign out on 401 if it fails
+            AUTH_MANAGER::Instance().RefreshAccessToken();
+        }
+        else if( AUTH_MANAGER::Instance().IsTokenExpiringSoon() )
+        {
+            // Still usable: refresh in the background without blocking the send
+            AUTH_MANAGER::Instance().RefreshAccessTokenAsync();
         }
     }
 
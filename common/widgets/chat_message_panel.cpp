@@ -631,7 +631,7 @@ static wxString ConvertMarkdownToStyledHtml( const wxString& aMarkdown )
     processedMarkdown = EscapeUnderscoresInMarkdown( processedMarkdown );
     
     wxString html;
-    ConvertMarkdown2Html( processedMarkdown, html );
+    ConvertMarkdown2HtmlCached( processedMarkdown, html );
     
     // Wrap HTML with CSS styling for consistent font rendering
     // Use Apple system font stack for macOS, fallback to system defaults on other platforms
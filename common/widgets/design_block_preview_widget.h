@@ -20,6 +20,11 @@
 #ifndef DESIGN_BLOCK_PREVIEW_WIDGET_H
 #define DESIGN_BLOCK_PREVIEW_WIDGET_H
 
+#include <list>
+#include <memory>
+#include <utility>
+#include <wx/filefn.h>
+#include <wx/filename.h>
 #include <wx/panel.h>
 #include <kiway.h>
 #include <gal_display_options_common.h>
@@ -63,4 +68,78 @@ protected:
 };
 
 
+/**
+ * A small MRU cache of parsed design block preview documents (#SCHEMATIC or #BOARD), so that
+ * reopening the pane or revisiting a block doesn't re-parse its file from disk.
+ *
+ * Entries are keyed by file path and stamped with the file's size and modification time; an
+ * entry whose stamp no longer matches the file on disk is dropped.  Documents are checked out
+ * exclusively: Take() removes the document from the cache until it is Release()d again, so its
+ * items are never attached to two GAL views at once.
+ */
+template <typename T>
+class DESIGN_BLOCK_PREVIEW_CACHE
+{
+public:
+    struct ENTRY
+    {
+        wxString           FilePath;
+        long long          ModTime = 0;
+        wxULongLong        Size = 0;
+        std::shared_ptr<T> Document;
+    };
+
+    /// Build a cache entry for a freshly parsed document, capturing the on-disk stamp.
+    static ENTRY MakeEntry( const wxString& aPath, std::shared_ptr<T> aDocument )
+    {
+        ENTRY entry;
+        entry.FilePath = aPath;
+        entry.ModTime = static_cast<long long>( wxFileModificationTime( aPath ) );
+        entry.Size = wxFileName::GetSize( aPath );
+        entry.Document = std::move( aDocument );
+        return entry;
+    }
+
+    /// Check out the cached document for \a aPath, or an empty entry on a miss or a stale stamp.
+    ENTRY Take( const wxString& aPath )
+    {
+        for( auto it = m_entries.begin(); it != m_entries.end(); ++it )
+        {
+            if( it->FilePath != aPath )
+                continue;
+
+            ENTRY entry = std::move( *it );
+            m_entries.erase( it );
+
+            if( entry.ModTime == static_cast<long long>( wxFileModificationTime( aPath ) )
+                    && entry.Size == wxFileName::GetSize( aPath ) )
+            {
+                return entry;
+            }
+
+            return ENTRY();     // The file changed on disk; drop the stale parse.
+        }
+
+        return ENTRY();
+    }
+
+    /// Return a checked-out (or freshly parsed) document to the cache.
+    void Release( ENTRY&& aEntry )
+    {
+        if( !aEntry.Document )
+            return;
+
+        m_entries.emplace_front( std::move( aEntry ) );
+
+        while( m_entries.size() > CACHED_DOCUMENT_LIMIT )
+            m_entries.pop_back();
+    }
+
+private:
+    static constexpr size_t CACHED_DOCUMENT_LIMIT = 8;
+
+    std::list<ENTRY> m_entries;     // MRU-first
+};
+
+
 #endif // DESIGN_BLOCK_PREVIEW_WIDGET_H
@@ -26,6 +26,9 @@
 #include <kiway.h>
 
 
+wxDEFINE_EVENT( FP_PREVIEW_LOADED_EVENT, wxCommandEvent );
+
+
 FOOTPRINT_PREVIEW_WIDGET::FOOTPRINT_PREVIEW_WIDGET( wxWindow* aParent, KIWAY& aKiway ) :
         wxPanel( aParent, wxID_ANY, wxDefaultPosition, wxDefaultSize,
                  wxFULL_REPAINT_ON_RESIZE | wxTAB_TRAVERSAL ),
@@ -62,8 +65,29 @@ FOOTPRINT_PREVIEW_WIDGET::FOOTPRINT_PREVIEW_WIDGET( wxWindow* aParent, KIWAY& aK
     m_outerSizer = new wxBoxSizer( wxVERTICAL );
 
     if( m_prev_panel )
+    {
         m_outerSizer->Add( m_prev_panel->GetCanvas(), 1, wxALL | wxEXPAND, 0 );
 
+        m_prev_panel->SetLoadHandler(
+                [this]( bool aFootprintFound )
+                {
+                    if( aFootprintFound )
+                    {
+                        ClearStatus();
+                    }
+                    else
+                    {
+                        SetStatusText( _( "Footprint not found." ) );
+                        m_libid.clear();
+                    }
+
+                    wxCommandEvent event( FP_PREVIEW_LOADED_EVENT, GetId() );
+                    event.SetEventObject( this );
+                    event.SetInt( aFootprintFound ? 1 : 0 );
+                    ProcessWindowEvent( event );
+                } );
+    }
+
     m_outerSizer->Add( m_statusPanel, 1, wxALL | wxEXPAND, 0 );
 
     SetSizer( m_outerSizer );
@@ -115,18 +139,14 @@ void FOOTPRINT_PREVIEW_WIDGET::DisplayFootprint( const LIB_ID& aFPID )
     if( !m_prev_panel || m_libid == aFPID )
         return;
 
-    wxBusyCursor busy;
+    m_libid = aFPID;
 
+    // A false return means the footprint wasn't cached and is being loaded in the background;
+    // the load handler will report the result when it arrives.
     if( m_prev_panel->DisplayFootprint( aFPID ) )
-    {
         ClearStatus();
-        m_libid = aFPID;
-    }
     else
-    {
-        SetStatusText( _( "Footprint not found." ) );
-        m_libid.clear();
-    }
+        SetStatusText( _( "Loading..." ) );
 }
 
 
@@ -36,6 +36,7 @@
 #include <wx/graphics.h>
 #include <wx/image.h>
 
+#include <algorithm>
 #include <cmath>
 #include <cstdio>   // used only for debug
 #include <ctime>    // used for representation of x axes involving date
@@ -472,6 +473,16 @@ void mpFXY::Plot( wxDC& dc, mpWindow& w )
 
     dc.SetPen( m_pen );
 
+    // Let the layer enumerate a decimated view of its data matched to the visible range and
+    // resolution, if it supports one
+    if( m_scaleX )
+    {
+        double viewX0 = m_scaleX->TransformFromPlot( w.p2x( startPx ) );
+        double viewX1 = m_scaleX->TransformFromPlot( w.p2x( endPx ) );
+
+        SetViewWindow( std::min( viewX0, viewX1 ), std::max( viewX0, viewX1 ), endPx - startPx );
+    }
+
     double x, y;
     // Do this to reset the counters to evaluate bounding box for label positioning
     Rewind();
@@ -2650,6 +2661,8 @@ void mpFXYVector::Rewind()
 {
     m_index = 0;
     m_sweepWindow = std::numeric_limits<size_t>::max();
+    m_envIndex = m_envStart;
+    m_envEmitMax = false;
 }
 
 
@@ -2657,11 +2670,33 @@ void mpFXYVector::SetSweepWindow( int aSweepIdx )
 {
     m_index = aSweepIdx * m_sweepSize;
     m_sweepWindow = ( aSweepIdx + 1 ) * m_sweepSize;
+    m_envIndex = m_envStart;
+    m_envEmitMax = false;
 }
 
 
 bool mpFXYVector::GetNextXY( double& x, double& y )
 {
+    if( m_envLevel >= 0 )
+    {
+        // Decimated enumeration: emit the exact minimum then maximum of each visible bin.  The
+        // plot loop merges same-pixel points into vertical lines, reproducing the envelope of the
+        // full-resolution data from ~2x plot-width points.
+        if( m_envIndex >= m_envEnd )
+            return false;
+
+        const ENVELOPE_LEVEL& level = m_envelope[m_envLevel];
+
+        x = m_xs[ std::min( m_envIndex * level.binSize, m_xs.size() - 1 ) ];
+        y = m_envEmitMax ? level.maxY[m_envIndex] : level.minY[m_envIndex];
+
+        if( m_envEmitMax )
+            ++m_envIndex;
+
+        m_envEmitMax = !m_envEmitMax;
+        return true;
+    }
+
     if( m_index >= m_xs.size() || m_index >= m_sweepWindow )
     {
         return false;
@@ -2679,6 +2714,8 @@ void mpFXYVector::Clear()
 {
     m_xs.clear();
     m_ys.clear();
+    m_envelope.clear();
+    m_envLevel = -1;
 }
 
 
@@ -2725,6 +2762,119 @@ void mpFXYVector::SetData( const std::vector<double>& xs, const std::vector<doub
         m_minY  = 0;
         m_maxY  = 0;
     }
+
+    buildEnvelope();
+}
+
+
+namespace
+{
+// Envelope pyramid tuning: traces below ENVELOPE_MIN_POINTS samples are always drawn at full
+// resolution; the finest level bins ENVELOPE_BASE_BIN samples and coarser levels are built by
+// pairwise reduction until no more than ENVELOPE_MIN_BINS bins remain.
+constexpr size_t ENVELOPE_MIN_POINTS = 65536;
+constexpr size_t ENVELOPE_BASE_BIN = 8;
+constexpr size_t ENVELOPE_MIN_BINS = 2048;
+}
+
+
+void mpFXYVector::buildEnvelope()
+{
+    m_envelope.clear();
+    m_envLevel = -1;
+
+    // The envelope maps x ranges to sample index ranges, which requires monotonic x data (as
+    // produced by transient and AC analyses).  Multi-sweep data restarts its x values at each
+    // sweep and is therefore excluded by the same test.
+    if( m_xs.size() < ENVELOPE_MIN_POINTS || !std::is_sorted( m_xs.begin(), m_xs.end() ) )
+        return;
+
+    ENVELOPE_LEVEL base;
+    base.binSize = ENVELOPE_BASE_BIN;
+    base.minY.reserve( ( m_ys.size() + ENVELOPE_BASE_BIN - 1 ) / ENVELOPE_BASE_BIN );
+    base.maxY.reserve( base.minY.capacity() );
+
+    for( size_t i = 0; i < m_ys.size(); i += ENVELOPE_BASE_BIN )
+    {
+        const size_t end = std::min( i + ENVELOPE_BASE_BIN, m_ys.size() );
+        double       binMin = m_ys[i];
+        double       binMax = m_ys[i];
+
+        for( size_t j = i + 1; j < end; ++j )
+        {
+            binMin = std::min( binMin, m_ys[j] );
+            binMax = std::max( binMax, m_ys[j] );
+        }
+
+        base.minY.push_back( binMin );
+        base.maxY.push_back( binMax );
+    }
+
+    m_envelope.push_back( std::move( base ) );
+
+    // Each coarser level merges pairs of bins from the previous one, so the pyramid costs only
+    // twice the finest level in memory and any zoom range is within a factor of two of an ideal
+    // bin size.
+    while( m_envelope.back().minY.size() > ENVELOPE_MIN_BINS )
+    {
+        const ENVELOPE_LEVEL& prev = m_envelope.back();
+        ENVELOPE_LEVEL        next;
+
+        next.binSize = prev.binSize * 2;
+        next.minY.reserve( ( prev.minY.size() + 1 ) / 2 );
+        next.maxY.reserve( next.minY.capacity() );
+
+        for( size_t i = 0; i < prev.minY.size(); i += 2 )
+        {
+            const size_t second = std::min( i + 1, prev.minY.size() - 1 );
+            next.minY.push_back( std::min( prev.minY[i], prev.minY[second] ) );
+            next.maxY.push_back( std::max( prev.maxY[i], prev.maxY[second] ) );
+        }
+
+        m_envelope.push_back( std::move( next ) );
+    }
+}
+
+
+void mpFXYVector::SetViewWindow( double aXMin, double aXMax, int aPixelWidth )
+{
+    m_envLevel = -1;
+
+    if( m_envelope.empty() || m_sweepCount > 1 || aPixelWidth <= 0 )
+        return;
+
+    const size_t i0 = std::lower_bound( m_xs.begin(), m_xs.end(), aXMin ) - m_xs.begin();
+    const size_t i1 = std::upper_bound( m_xs.begin(), m_xs.end(), aXMax ) - m_xs.begin();
+
+    const size_t visible = i1 - i0;
+    const size_t target = static_cast<size_t>( aPixelWidth ) * 2;
+
+    // Use the coarsest level which still yields at least ~2x plot-width bins over the visible
+    // range; if even the finest level is too coarse the raw samples are sparse enough to draw
+    // directly.
+    int chosen = -1;
+
+    for( int lvl = 0; lvl < static_cast<int>( m_envelope.size() ); ++lvl )
+    {
+        if( visible / m_envelope[lvl].binSize >= target )
+            chosen = lvl;
+        else
+            break;
+    }
+
+    if( chosen < 0 )
+        return;
+
+    const size_t binSize = m_envelope[chosen].binSize;
+
+    m_envLevel = chosen;
+
+    // Overscan by one bin on each side so connecting segments reach the plot edges
+    m_envStart = i0 / binSize;
+    m_envStart = m_envStart > 0 ? m_envStart - 1 : 0;
+    m_envEnd = std::min( i1 / binSize + 2, m_envelope[chosen].minY.size() );
+    m_envIndex = m_envStart;
+    m_envEmitMax = false;
 }
 
 
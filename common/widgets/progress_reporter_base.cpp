@@ -42,15 +42,15 @@ PROGRESS_REPORTER_BASE::PROGRESS_REPORTER_BASE( int aNumPhases ) :
 
 void PROGRESS_REPORTER_BASE::BeginPhase( int aPhase )
 {
-    m_phase.store( aPhase );
-    m_progress.store( 0 );
+    m_phase.store( aPhase, std::memory_order_relaxed );
+    m_progress.store( 0, std::memory_order_relaxed );
 }
 
 
 void PROGRESS_REPORTER_BASE::AdvancePhase()
 {
-    m_phase.fetch_add( 1 );
-    m_progress.store( 0 );
+    m_phase.fetch_add( 1, std::memory_order_relaxed );
+    m_progress.store( 0, std::memory_order_relaxed );
 }
 
 
@@ -72,20 +72,22 @@ void PROGRESS_REPORTER_BASE::Report( const wxString& aMessage )
 
 void PROGRESS_REPORTER_BASE::SetMaxProgress( int aMaxProgress )
 {
-    m_maxProgress.store( aMaxProgress );
+    m_maxProgress.store( aMaxProgress, std::memory_order_relaxed );
 }
 
 
 void PROGRESS_REPORTER_BASE::SetCurrentProgress( double aProgress )
 {
-    m_maxProgress.store( 1000 );
-    m_progress.store( (int) ( aProgress * 1000.0 ) );
+    m_maxProgress.store( 1000, std::memory_order_relaxed );
+    m_progress.store( (int) ( aProgress * 1000.0 ), std::memory_order_relaxed );
 }
 
 
 void PROGRESS_REPORTER_BASE::AdvanceProgress()
 {
-    m_progress.fetch_add( 1 );
+    // Called from worker threads in tight loops; the counters are monotonic telemetry only
+    // sampled by the UI timer, so no ordering with other memory is needed.
+    m_progress.fetch_add( 1, std::memory_order_relaxed );
 }
 
 
@@ -103,8 +105,10 @@ void PROGRESS_REPORTER_BASE::AddPhases( int aNumPhases )
 
 int PROGRESS_REPORTER_BASE::CurrentProgress() const
 {
-    double current = ( 1.0 / (double) m_numPhases ) *
-                     ( (double) m_phase + ( (double) m_progress.load() / (double) m_maxProgress ) );
+    double current = ( 1.0 / (double) m_numPhases )
+                     * ( (double) m_phase
+                         + ( (double) m_progress.load( std::memory_order_relaxed )
+                             / (double) m_maxProgress ) );
 
     return (int)( current * 1000 );
 }
@@ -114,7 +118,7 @@ bool PROGRESS_REPORTER_BASE::KeepRefreshing( bool aWait )
 {
     if( aWait )
     {
-        while( m_progress.load() < m_maxProgress && m_maxProgress > 0 )
+        while( m_progress.load( std::memory_order_relaxed ) < m_maxProgress && m_maxProgress > 0 )
         {
             if( !updateUI() )
             {
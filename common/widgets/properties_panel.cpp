@@ -266,9 +266,10 @@ void PROPERTIES_PANEL::rebuildProperties( const SELECTION& aSelection )
     bool isDesignEditor = m_frame->IsType( FRAME_PCB_EDITOR )
                        || m_frame->IsType( FRAME_SCH );
 
-    std::set<wxString> availableProps;
+    // Find a set of properties that is common to all selected items, and aggregate their
+    // values, writability and choices over the selection in a single pass.
+    std::map<wxString, PROPERTY_AGGREGATE> candidates;
 
-    // Find a set of properties that is common to all selected items
     for( auto& [name, property] : commonProps )
     {
         if( property->IsHiddenFromPropertiesManager() )
@@ -280,15 +281,18 @@ void PROPERTIES_PANEL::rebuildProperties( const SELECTION& aSelection )
         if( isDesignEditor && property->IsHiddenFromDesignEditors() )
             continue;
 
-        wxVariant   dummy;
-        wxPGChoices choices;
-        bool        writable;
-
-        if( extractValueAndWritability( aSelection, name, dummy, writable, choices ) )
-            availableProps.insert( name );
+        PROPERTY_AGGREGATE aggregate;
+        aggregate.Property = property;
+        candidates.emplace( name, std::move( aggregate ) );
     }
 
-    bool               writeable = true;
+    aggregateSelection( aSelection, candidates );
+
+    std::set<wxString> availableProps;
+
+    for( const auto& [name, aggregate] : candidates )
+        availableProps.insert( name );
+
     std::set<wxString> existingProps;
 
     for( wxPropertyGridIterator it = m_grid->GetIterator(); !it.AtEnd(); it.Next() )
@@ -300,19 +304,18 @@ void PROPERTIES_PANEL::rebuildProperties( const SELECTION& aSelection )
         // remove the properties when they are no longer available
         existingProps.insert( name );
 
-        if( !availableProps.count( name ) )
-            continue;
+        auto candidate = candidates.find( name );
 
-        wxVariant   commonVal;
-        wxPGChoices choices;
+        if( candidate == candidates.end() )
+            continue;
 
-        extractValueAndWritability( aSelection, name, commonVal, writeable, choices );
+        PROPERTY_AGGREGATE& aggregate = candidate->second;
 
-        if( choices.GetCount() > 0 )
-            pgProp->SetChoices( choices );
+        if( aggregate.Choices.GetCount() > 0 )
+            pgProp->SetChoices( aggregate.Choices );
 
-        pgProp->SetValue( commonVal );
-        pgProp->Enable( writeable );
+        pgProp->SetValue( aggregate.Value );
+        pgProp->Enable( aggregate.Writable );
     }
 
     if( !existingProps.empty() && existingProps == availableProps )
@@ -324,23 +327,18 @@ void PROPERTIES_PANEL::rebuildProperties( const SELECTION& aSelection )
     std::map<wxPGProperty*, int>                   pgPropOrders;
     std::map<wxString, std::vector<wxPGProperty*>> pgPropGroups;
 
-    for( const wxString& name : availableProps )
+    for( auto& [name, aggregate] : candidates )
     {
-        PROPERTY_BASE* property = commonProps[name];
+        PROPERTY_BASE* property = aggregate.Property;
         wxPGProperty*  pgProp   = createPGProperty( property );
-        wxVariant      commonVal;
-        wxPGChoices    choices;
-
-        if( !extractValueAndWritability( aSelection, name, commonVal, writeable, choices ) )
-            continue;
 
         if( pgProp )
         {
-            if( choices.GetCount() )
-                pgProp->SetChoices( choices );
+            if( aggregate.Choices.GetCount() )
+                pgProp->SetChoices( aggregate.Choices );
 
-            pgProp->SetValue( commonVal );
-            pgProp->Enable( writeable );
+            pgProp->SetValue( aggregate.Value );
+            pgProp->Enable( aggregate.Writable );
             m_displayed.push_back( property );
 
             wxASSERT( displayOrder.count( name ) );
@@ -409,71 +407,98 @@ bool PROPERTIES_PANEL::getItemValue( EDA_ITEM* aItem, PROPERTY_BASE* aProperty,
 }
 
 
-bool PROPERTIES_PANEL::extractValueAndWritability( const SELECTION& aSelection, const wxString& aPropName,
-                                                   wxVariant& aValue, bool& aWritable, wxPGChoices& aChoices )
+void PROPERTIES_PANEL::aggregateSelection( const SELECTION& aSelection,
+                                           std::map<wxString, PROPERTY_AGGREGATE>& aCandidates )
 {
     PROPERTY_MANAGER& propMgr = PROPERTY_MANAGER::Instance();
-    bool              different = false;
-    bool              first = true;
 
-    aWritable = true;
+    // Resolving a property name for a type is a lookup in the property manager; do it once
+    // per selected type rather than once per item.
+    std::map<TYPE_ID, std::map<wxString, PROPERTY_BASE*>> typeProps;
 
     for( EDA_ITEM* item : aSelection )
     {
-        PROPERTY_BASE* property = propMgr.GetProperty( TYPE_HASH( *item ), aPropName );
+        if( aCandidates.empty() )
+            break;
 
-        if( !property )
-            return false;
+        TYPE_ID type = TYPE_HASH( *item );
+        auto    typeIt = typeProps.find( type );
 
-        if( !propMgr.IsAvailableFor( TYPE_HASH( *item ), property, item ) )
-            return false;
-
-        if( property->IsHiddenFromPropertiesManager() )
-            return false;
+        if( typeIt == typeProps.end() )
+        {
+            std::map<wxString, PROPERTY_BASE*> props;
 
-        wxPGChoices choices = property->GetChoices( item );
+            for( const auto& [name, aggregate] : aCandidates )
+                props[name] = propMgr.GetProperty( type, name );
 
-        if( first )
-        {
-            aChoices = choices;
-            first = false;
+            typeIt = typeProps.emplace( type, std::move( props ) ).first;
         }
-        else
-        {
-            wxArrayString labels = choices.GetLabels();
-            wxArrayInt    values = choices.GetValuesForStrings( labels );
 
-            if( labels != aChoices.GetLabels() || values != aChoices.GetValuesForStrings( labels ) )
-                return false;
-        }
+        for( auto it = aCandidates.begin(); it != aCandidates.end(); )
+        {
+            PROPERTY_AGGREGATE& aggregate = it->second;
+            auto                propIt = typeIt->second.find( it->first );
+            PROPERTY_BASE*      property = propIt != typeIt->second.end() ? propIt->second : nullptr;
 
-        // If read-only for any of the selection, read-only for the whole selection.
-        if( !propMgr.IsWriteableFor( TYPE_HASH( *item ), property, item ) )
-            aWritable = false;
+            if( !property
+                    || property->IsHiddenFromPropertiesManager()
+                    || !propMgr.IsAvailableFor( type, property, item ) )
+            {
+                it = aCandidates.erase( it );
+                continue;
+            }
 
-        wxVariant value;
+            wxPGChoices choices = property->GetChoices( item );
 
-        if( getItemValue( item, property, value ) )
-        {
-            // Null value indicates different property values between items
-            if( !different && !aValue.IsNull() && value != aValue )
+            if( !aggregate.HaveChoices )
             {
-                different = true;
-                aValue.MakeNull();
+                aggregate.Choices = choices;
+                aggregate.HaveChoices = true;
             }
-            else if( !different )
+            else
             {
-                aValue = value;
+                wxArrayString labels = choices.GetLabels();
+                wxArrayInt    values = choices.GetValuesForStrings( labels );
+
+                if( labels != aggregate.Choices.GetLabels()
+                        || values != aggregate.Choices.GetValuesForStrings( labels ) )
+                {
+                    it = aCandidates.erase( it );
+                    continue;
+                }
             }
-        }
-        else
-        {
-            // getItemValue returned false -- not available for this item
-            return false;
+
+            // If read-only for any of the selection, read-only for the whole selection.
+            if( aggregate.Writable && !propMgr.IsWriteableFor( type, property, item ) )
+                aggregate.Writable = false;
+
+            // Once two items disagree the common value stays null; stop fetching values.
+            if( !aggregate.Different )
+            {
+                wxVariant value;
+
+                if( !getItemValue( item, property, value ) )
+                {
+                    // getItemValue returned false -- not available for this item
+                    it = aCandidates.erase( it );
+                    continue;
+                }
+
+                // Null value indicates different property values between items
+                if( !aggregate.Value.IsNull() && value != aggregate.Value )
+                {
+                    aggregate.Different = true;
+                    aggregate.Value.MakeNull();
+                }
+                else
+                {
+                    aggregate.Value = value;
+                }
+            }
+
+            ++it;
         }
     }
-
-    return true;
 }
 
 
@@ -27,6 +27,7 @@
 #include <wx/panel.h>
 #include <wx/propgrid/propgrid.h>
 
+#include <map>
 #include <vector>
 #include <memory>
 
@@ -93,16 +94,32 @@ protected:
     bool getItemValue( EDA_ITEM* aItem, PROPERTY_BASE* aProperty, wxVariant& aValue );
 
     /**
-     * Processes a selection and determines whether the given property should be available or not
-     * and what the common value should be for the items in the selection.
+     * Holds the aggregated state of a single property across a selection.
+     */
+    struct PROPERTY_AGGREGATE
+    {
+        PROPERTY_BASE* Property = nullptr;  ///< Instance registered for the first selected type
+        wxVariant      Value;               ///< Common value, or null once values differ
+        bool           Different = false;
+        bool           Writable = true;
+        wxPGChoices    Choices;
+        bool           HaveChoices = false;
+    };
+
+    /**
+     * Compute the per-property common value, writability and choices for the whole selection
+     * in a single pass over the items.
+     *
+     * A property drops out of \a aCandidates as soon as one item doesn't provide it, and its
+     * value fetches stop as soon as two items disagree, so mass selections cost much less than
+     * items x properties.
+     *
      * @param aSelection is a set of EDA_ITEMs to process
-     * @param aProperty is the property to look up
-     * @param aValue will be filled with the value common to the selection, or null if different
-     * @param aWritable will be set to whether or not the property can be written for the selection
-     * @return true if the property is available for all the items in the selection
+     * @param aCandidates seeds the scan with the properties common to all selected types, and
+     *                    receives the surviving properties with their aggregated state
      */
-    bool extractValueAndWritability( const SELECTION& aSelection, const wxString& aPropName,
-                                     wxVariant& aValue, bool& aWritable, wxPGChoices& aChoices );
+    void aggregateSelection( const SELECTION& aSelection,
+                             std::map<wxString, PROPERTY_AGGREGATE>& aCandidates );
 
 public:
     int                         m_SuppressGridChangeEvents;
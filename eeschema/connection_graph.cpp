@@ -659,7 +659,7 @@ CONNECTION_SUBGRAPH::PRIORITY CONNECTION_SUBGRAPH::GetDriverPriority( SCH_ITEM*
     auto libSymbolRef =
             []( const SCH_SYMBOL* symbol ) -> wxString
             {
-                if( const std::unique_ptr<LIB_SYMBOL>& part = symbol->GetLibSymbolRef() )
+                if( const std::shared_ptr<LIB_SYMBOL>& part = symbol->GetLibSymbolRef() )
                     return part->GetReferenceField().GetText();
 
                 return wxEmptyString;
@@ -811,6 +811,7 @@ void CONNECTION_GRAPH::Reset()
     m_sheet_to_subgraphs_map.clear();
     m_global_power_pins.clear();
     m_bus_alias_cache.clear();
+    m_bus_expansion_cache.clear();
     m_net_name_to_code_map.clear();
     m_bus_name_to_code_map.clear();
     m_net_code_to_subgraphs_map.clear();
@@ -908,20 +909,28 @@ void CONNECTION_GRAPH::Recalculate( const SCH_SHEET_LIST& aSheetList, bool aUnco
                     }
                 }
             }
+        }
 
-            // Ensure the hierarchy info stored in the SCH_SCREEN (such as symbol units) reflects
-            // the current SCH_SHEET_PATH
-            if( item->Type() == SCH_SYMBOL_T )
-            {
-                SCH_SYMBOL* symbol = static_cast<SCH_SYMBOL*>( item );
-                int new_unit = symbol->GetUnitSelection( &sheet );
+        // Sheets with no dirty connectivity items don't need their connectivity or dangling
+        // ends rebuilt; on large hierarchies this is nearly every sheet for a typical edit.
+        if( !aUnconditional && items.empty() )
+        {
+            done++;     // keep the progress reporter in step
+            continue;
+        }
 
-                // Store the initial unit value so we can restore it after calculations
-                if( symbol->GetUnit() != new_unit )
-                    symbolsChanged.push_back( { symbol, symbol->GetUnit() } );
+        // Ensure the hierarchy info stored in the SCH_SCREEN (such as symbol units) reflects
+        // the current SCH_SHEET_PATH
+        for( SCH_ITEM* item : sheet.LastScreen()->Items().OfType( SCH_SYMBOL_T ) )
+        {
+            SCH_SYMBOL* symbol = static_cast<SCH_SYMBOL*>( item );
+            int new_unit = symbol->GetUnitSelection( &sheet );
 
-                symbol->SetUnit( new_unit );
-            }
+            // Store the initial unit value so we can restore it after calculations
+            if( symbol->GetUnit() != new_unit )
+                symbolsChanged.push_back( { symbol, symbol->GetUnit() } );
+
+            symbol->SetUnit( new_unit );
         }
 
         m_items.reserve( m_items.size() + items.size() );
@@ -3183,6 +3192,26 @@ std::shared_ptr<BUS_ALIAS> CONNECTION_GRAPH::GetBusAlias( const wxString& aName
 }
 
 
+const BUS_LABEL_EXPANSION& CONNECTION_GRAPH::GetBusExpansion( const wxString& aUnescapedLabel )
+{
+    std::lock_guard lock( m_bus_expansion_mutex );
+
+    auto it = m_bus_expansion_cache.find( aUnescapedLabel );
+
+    if( it != m_bus_expansion_cache.end() )
+        return it->second;
+
+    BUS_LABEL_EXPANSION expansion;
+
+    if( NET_SETTINGS::ParseBusVector( aUnescapedLabel, &expansion.Prefix, &expansion.Members ) )
+        expansion.IsVector = true;
+    else if( NET_SETTINGS::ParseBusGroup( aUnescapedLabel, &expansion.Prefix, &expansion.Members ) )
+        expansion.IsGroup = true;
+
+    return m_bus_expansion_cache.emplace( aUnescapedLabel, std::move( expansion ) ).first->second;
+}
+
+
 std::vector<const CONNECTION_SUBGRAPH*> CONNECTION_GRAPH::GetBusesNeedingMigration()
 {
     std::vector<const CONNECTION_SUBGRAPH*> ret;
@@ -324,6 +324,20 @@ private:
     std::mutex m_driver_mutex;
 };
 
+/**
+ * Memoized result of parsing a bus label into its member names.
+ *
+ * Expanding a wide vector bus (e.g. `DATA[0..511]`) generates hundreds of member names,
+ * so the parse is done once per label text and cached on the connection graph.
+ */
+struct BUS_LABEL_EXPANSION
+{
+    bool                  IsVector = false;  ///< Parsed as a vector bus (e.g. `D[0..7]`).
+    bool                  IsGroup = false;   ///< Parsed as a group bus (e.g. `{A B C}`).
+    wxString              Prefix;            ///< Vector prefix or group name.
+    std::vector<wxString> Members;           ///< Expanded member labels.
+};
+
 struct NET_NAME_CODE_CACHE_KEY
 {
     wxString  Name;
@@ -412,6 +426,17 @@ public:
      */
     std::shared_ptr<BUS_ALIAS> GetBusAlias( const wxString& aName );
 
+    /**
+     * Return the memoized expansion of a bus label (see #BUS_LABEL_EXPANSION).
+     *
+     * The expansion depends only on the (unescaped) label text, so it stays valid across
+     * recalculations; changed labels simply miss the cache and aliases inside bus groups
+     * are resolved dynamically by the caller.  The cache is dropped on Reset().
+     *
+     * The returned reference is stable for the lifetime of the cache entry.
+     */
+    const BUS_LABEL_EXPANSION& GetBusExpansion( const wxString& aUnescapedLabel );
+
     /**
      * Determine which subgraphs have more than one conflicting bus label.
      *
@@ -816,6 +841,10 @@ private:
 
     std::unordered_map<wxString, std::shared_ptr<BUS_ALIAS>> m_bus_alias_cache;
 
+    /// Memoized bus label expansions; guarded because connections are resolved in parallel.
+    std::mutex m_bus_expansion_mutex;
+    std::unordered_map<wxString, BUS_LABEL_EXPANSION> m_bus_expansion_cache;
+
     std::unordered_map<wxString, int> m_net_name_to_code_map;
 
     std::unordered_map<wxString, int> m_bus_name_to_code_map;
@@ -54,19 +54,40 @@ SCH_ITEM* SCH_EDITOR_CONTROL::FindSymbolAndItem( const wxString* aPath, const wx
     SCH_SHEET_PATH* sheetWithSymbolFound = nullptr;
     SCH_SYMBOL*     symbol = nullptr;
     SCH_PIN*        pin = nullptr;
-    SCH_SHEET_LIST  sheetList;
     SCH_ITEM*       foundItem = nullptr;
 
-    if( !aSearchHierarchy )
-        sheetList.push_back( m_frame->GetCurrentSheet() );
-    else
-        sheetList = m_frame->Schematic().Hierarchy();
+    std::vector<std::pair<SCH_SYMBOL*, SCH_SHEET_PATH>> candidates;
+
+    if( aSearchHierarchy && aPath )
+    {
+        // The path is the sheet path string with the symbol UUID appended; resolve the
+        // symbol through the schematic's KIID index and pick the matching sheet instance.
+        wxString uuid = aPath->AfterLast( '/' );
+        wxString pathPrefix = aPath->Left( aPath->Length() - uuid.Length() );
 
-    for( SCH_SHEET_PATH& sheet : sheetList )
+        SCH_ITEM* item = m_frame->Schematic().ResolveItem( KIID( uuid ), nullptr, true );
+
+        if( item && item->Type() == SCH_SYMBOL_T )
+        {
+            for( SCH_SHEET_PATH& sheet : m_frame->Schematic().Hierarchy() )
+            {
+                if( sheet.PathAsString() == pathPrefix )
+                {
+                    candidates.emplace_back( static_cast<SCH_SYMBOL*>( item ), sheet );
+                    break;
+                }
+            }
+        }
+    }
+    else if( aSearchHierarchy && aReference )
     {
-        SCH_SCREEN* screen = sheet.LastScreen();
+        candidates = m_frame->Schematic().GetSymbolsByReference( *aReference );
+    }
+    else
+    {
+        SCH_SHEET_PATH& sheet = m_frame->GetCurrentSheet();
 
-        for( EDA_ITEM* item : screen->Items().OfType( SCH_SYMBOL_T ) )
+        for( EDA_ITEM* item : sheet.LastScreen()->Items().OfType( SCH_SYMBOL_T ) )
         {
             SCH_SYMBOL* candidate = static_cast<SCH_SYMBOL*>( item );
 
@@ -84,40 +105,40 @@ SCH_ITEM* SCH_EDITOR_CONTROL::FindSymbolAndItem( const wxString* aPath, const wx
             }
 
             if( found )
-            {
-                symbol = candidate;
-                sheetWithSymbolFound = &sheet;
+                candidates.emplace_back( candidate, sheet );
+        }
+    }
 
-                if( aSearchType == HIGHLIGHT_PIN )
-                {
-                    pin = symbol->GetPin( aSearchText );
+    for( auto& [candidate, sheet] : candidates )
+    {
+        symbol = candidate;
+        sheetWithSymbolFound = &sheet;
 
-                    // Ensure we have found the right unit in case of multi-units symbol
-                    if( pin )
-                    {
-                        int unit = pin->GetLibPin()->GetUnit();
+        if( aSearchType == HIGHLIGHT_PIN )
+        {
+            pin = symbol->GetPin( aSearchText );
 
-                        if( unit != 0 && unit != symbol->GetUnit() )
-                        {
-                            pin = nullptr;
-                            continue;
-                        }
+            // Ensure we have found the right unit in case of multi-units symbol
+            if( pin )
+            {
+                int unit = pin->GetLibPin()->GetUnit();
 
-                        // Get pin position in true schematic coordinate
-                        foundItem = pin;
-                        break;
-                    }
-                }
-                else
+                if( unit != 0 && unit != symbol->GetUnit() )
                 {
-                    foundItem = symbol;
-                    break;
+                    pin = nullptr;
+                    continue;
                 }
+
+                // Get pin position in true schematic coordinate
+                foundItem = pin;
+                break;
             }
         }
-
-        if( foundItem )
+        else
+        {
+            foundItem = symbol;
             break;
+        }
     }
 
     CROSS_PROBING_SETTINGS& crossProbingSettings = m_frame->eeconfig()->m_CrossProbing;
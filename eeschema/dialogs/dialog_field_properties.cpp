@@ -225,7 +225,7 @@ DIALOG_FIELD_PROPERTIES::DIALOG_FIELD_PROPERTIES( SCH_BASE_FRAME* aParent, const
         // select/filter right footprints
         wxArrayString pins;
 
-        const std::unique_ptr< LIB_SYMBOL >& lib_symbol = symbol->GetLibSymbolRef();
+        const std::shared_ptr<LIB_SYMBOL>& lib_symbol = symbol->GetLibSymbolRef();
 
         if( lib_symbol )
         {
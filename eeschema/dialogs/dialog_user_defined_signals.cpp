@@ -240,7 +240,7 @@ void DIALOG_USER_DEFINED_SIGNALS::OnFormattingHelp( wxHyperlinkEvent& aEvent )
     m_helpWindow->SetDialogSizeInDU( sz.x, sz.y );
 
     wxString html_txt;
-    ConvertMarkdown2Html( wxGetTranslation( msg ), html_txt );
+    ConvertMarkdown2HtmlCached( wxGetTranslation( msg ), html_txt );
     m_helpWindow->AddHTML_Text( html_txt );
     m_helpWindow->ShowModeless();
 }
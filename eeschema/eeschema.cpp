@@ -452,15 +452,15 @@ bool IFACE::OnKifaceStart( PGM_BASE* aProgram, int aCtlBits, KIWAY* aKiway )
     // Do nothing in here pertinent to a project!
     InitSettings( new EESCHEMA_SETTINGS );
 
-    // Register the symbol editor settings as well because they share a KiFACE and need to be
-    // loaded prior to use to avoid threading deadlocks
+    // Register the symbol editor settings as well because they share a KiFACE; the load is
+    // deferred to first access so the symbol editor doesn't tax schematic editor startup
     SYMBOL_EDITOR_SETTINGS* symSettings = new SYMBOL_EDITOR_SETTINGS();
-    aProgram->GetSettingsManager().RegisterSettings( symSettings ); // manager takes ownership
+    aProgram->GetSettingsManager().RegisterSettings( symSettings, false ); // manager takes ownership
 
     // We intentionally register KifaceSettings after SYMBOL_EDITOR_SETTINGS
     // In legacy configs, many settings were in a single editor config nd the migration routine
     // for the main editor file will try and call into the now separate settings stores
-    // to move the settings into them
+    // to move the settings into them (triggering their deferred loads first)
     aProgram->GetSettingsManager().RegisterSettings( KifaceSettings() );
 
     start_common( aCtlBits );
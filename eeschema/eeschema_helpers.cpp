@@ -86,18 +86,19 @@ PROJECT* EESCHEMA_HELPERS::GetDefaultProject( bool aSetActive )
 
 
 SCHEMATIC* EESCHEMA_HELPERS::LoadSchematic( const wxString& aFileName, bool aSetActive,
-                                            bool aForceDefaultProject, PROJECT* aProject, bool aCalculateConnectivity )
+                                            bool aForceDefaultProject, PROJECT* aProject,
+                                            bool aCalculateConnectivity, bool aUpdateUiState )
 {
     if( aFileName.EndsWith( FILEEXT::KiCadSchematicFileExtension ) )
         return LoadSchematic( aFileName, SCH_IO_MGR::SCH_KICAD, aSetActive, aForceDefaultProject,
-                              aProject, aCalculateConnectivity );
+                              aProject, aCalculateConnectivity, aUpdateUiState );
     else if( aFileName.EndsWith( FILEEXT::LegacySchematicFileExtension ) )
         return LoadSchematic( aFileName, SCH_IO_MGR::SCH_LEGACY, aSetActive, aForceDefaultProject,
-                              aProject, aCalculateConnectivity );
+                              aProject, aCalculateConnectivity, aUpdateUiState );
 
     // as fall back for any other kind use the legacy format
     return LoadSchematic( aFileName, SCH_IO_MGR::SCH_LEGACY, aSetActive, aForceDefaultProject, aProject,
-                          aCalculateConnectivity );
+                          aCalculateConnectivity, aUpdateUiState );
 }
 
 
@@ -106,7 +107,8 @@ SCHEMATIC* EESCHEMA_HELPERS::LoadSchematic( const wxString& aFileName,
                                             bool aSetActive,
                                             bool aForceDefaultProject,
                                             PROJECT* aProject,
-                                            bool aCalculateConnectivity )
+                                            bool aCalculateConnectivity,
+                                            bool aUpdateUiState )
 {
     wxFileName pro = aFileName;
     pro.SetExt( FILEEXT::ProjectFileExtension );
@@ -195,12 +197,18 @@ SCHEMATIC* EESCHEMA_HELPERS::LoadSchematic( const wxString& aFileName,
     schematic->ResolveERCExclusionsPostUpdate();
 
     schematic->SetSheetNumberAndCount();
-    schematic->RecomputeIntersheetRefs();
+
+    // Intersheet references and dangling end markers only matter when the schematic is drawn;
+    // netlist and ERC tooling loading hundreds of schematics skips them.
+    if( aUpdateUiState )
+        schematic->RecomputeIntersheetRefs();
 
     for( SCH_SHEET_PATH& sheet : sheetList )
     {
         sheet.UpdateAllScreenReferences();
-        sheet.LastScreen()->TestDanglingEnds( nullptr, nullptr );
+
+        if( aUpdateUiState )
+            sheet.LastScreen()->TestDanglingEnds( nullptr, nullptr );
     }
 
     if( aCalculateConnectivity )
@@ -44,15 +44,25 @@ public:
     static SETTINGS_MANAGER* GetSettingsManager();
     static void              SetSchEditFrame( SCH_EDIT_FRAME* aSchEditFrame );
     static PROJECT*          GetDefaultProject( bool aSetActive );
+    /**
+     * Load a schematic and its #CONNECTION_GRAPH without any frame or canvas.
+     *
+     * @param aCalculateConnectivity false skips the connection graph rebuild entirely.
+     * @param aUpdateUiState false additionally skips the display-only passes (dangling end
+     *                       marking and intersheet reference recomputation); netlist and ERC
+     *                       tooling that never draws the schematic doesn't need them.
+     */
     static SCHEMATIC*        LoadSchematic( const wxString& aFileName, bool aSetActive,
                                             bool aForceDefaultProject,
                                             PROJECT* aProject = nullptr,
-                                            bool aCalculateConnectivity = true );
+                                            bool aCalculateConnectivity = true,
+                                            bool aUpdateUiState = true );
     static SCHEMATIC*        LoadSchematic( const wxString& aFileName,
                                             SCH_IO_MGR::SCH_FILE_T aFormat,
                                             bool aSetActive, bool aForceDefaultProject,
                                             PROJECT* aProject = nullptr,
-                                            bool aCalculateConnectivity = true );
+                                            bool aCalculateConnectivity = true,
+                                            bool aUpdateUiState = true );
 
 private:
     static SCH_EDIT_FRAME*   s_SchEditFrame;
@@ -83,8 +83,7 @@
 
 
 EESCHEMA_JOBS_HANDLER::EESCHEMA_JOBS_HANDLER( KIWAY* aKiway ) :
-        JOB_DISPATCHER( aKiway ),
-        m_cliSchematic( nullptr )
+        JOB_DISPATCHER( aKiway )
 {
     Register( "bom",
               std::bind( &EESCHEMA_JOBS_HANDLER::JobExportBom, this, std::placeholders::_1 ),
@@ -171,6 +170,24 @@ EESCHEMA_JOBS_HANDLER::EESCHEMA_JOBS_HANDLER( KIWAY* aKiway ) :
 }
 
 
+SCHEMATIC* EESCHEMA_JOBS_HANDLER::loadCachedSchematic( const wxString& aPath, PROJECT* aProject )
+{
+    // Mirrors PCBNEW_JOBS_HANDLER::loadCachedBoard(): a jobset run executes many jobs in one
+    // process, so each schematic is loaded at most once no matter how many jobs reference it.
+    auto it = m_cliSchematics.find( aPath );
+
+    if( it != m_cliSchematics.end() )
+        return it->second;
+
+    SCHEMATIC* sch = EESCHEMA_HELPERS::LoadSchematic( aPath, true, false, aProject );
+
+    if( sch )
+        m_cliSchematics[aPath] = sch;
+
+    return sch;
+}
+
+
 SCHEMATIC* EESCHEMA_JOBS_HANDLER::getSchematic( const wxString& aPath )
 {
     SCHEMATIC* sch = nullptr;
@@ -188,10 +205,7 @@ SCHEMATIC* EESCHEMA_JOBS_HANDLER::getSchematic( const wxString& aPath )
             schPath = path.GetFullPath();
         }
 
-        if( !m_cliSchematic )
-            m_cliSchematic = EESCHEMA_HELPERS::LoadSchematic( schPath, true, false, &project );
-
-        sch = m_cliSchematic;
+        sch = loadCachedSchematic( schPath, &project );
     }
     else if( Pgm().IsGUI() && Pgm().GetSettingsManager().IsProjectOpen() )
     {
@@ -202,7 +216,7 @@ SCHEMATIC* EESCHEMA_JOBS_HANDLER::getSchematic( const wxString& aPath )
     }
     else if( !aPath.IsEmpty() )
     {
-        sch = EESCHEMA_HELPERS::LoadSchematic( aPath, true, false );
+        sch = loadCachedSchematic( aPath, nullptr );
     }
 
     if( !sch )
@@ -21,11 +21,14 @@
 #ifndef EESCHEMA_JOBS_HANDLER_H
 #define EESCHEMA_JOBS_HANDLER_H
 
+#include <map>
+
 #include <jobs/job_dispatcher.h>
 #include <wx/string.h>
 
 class SCH_RENDER_SETTINGS;
 class KIWAY;
+class PROJECT;
 class SCHEMATIC;
 class JOB_SYM_EXPORT_SVG;
 class LIB_SYMBOL;
@@ -65,12 +68,14 @@ public:
 private:
     SCHEMATIC* getSchematic( const wxString& aPath );
 
+    SCHEMATIC* loadCachedSchematic( const wxString& aPath, PROJECT* aProject );
+
     int doSymExportSvg( JOB_SYM_EXPORT_SVG* aSvgJob, SCH_RENDER_SETTINGS* aRenderSettings,
                         LIB_SYMBOL* symbol );
 
     DS_PROXY_VIEW_ITEM* getDrawingSheetProxyView( SCHEMATIC* aSch );
 
-    SCHEMATIC* m_cliSchematic;
+    std::map<wxString, SCHEMATIC*> m_cliSchematics;
 };
 
 #endif
@@ -24,8 +24,13 @@
  */
 
 #include <algorithm>
+#include <functional>
 #include <numeric>
 
+#include <core/profile.h>
+#include <thread_pool.h>
+#include <trace_helpers.h>
+
 #include "connection_graph.h"
 #include "kiface_ids.h"
 #include <advanced_config.h>
@@ -1664,7 +1669,7 @@ int ERC_TESTER::TestFootprintFilters()
         for( SCH_ITEM* item : sheet.LastScreen()->Items().OfType( SCH_SYMBOL_T ) )
         {
             SCH_SYMBOL*                  sch_symbol = static_cast<SCH_SYMBOL*>( item );
-            std::unique_ptr<LIB_SYMBOL>& lib_symbol = sch_symbol->GetLibSymbolRef();
+            std::shared_ptr<LIB_SYMBOL>& lib_symbol = sch_symbol->GetLibSymbolRef();
 
             if( !lib_symbol )
                 continue;
@@ -1725,75 +1730,91 @@ int ERC_TESTER::TestOffGridEndpoints()
     const int gridSize = m_schematic->Settings().m_ConnectionGridSize;
     int       err_count = 0;
 
+    std::vector<SCH_SCREEN*> screens;
+
     for( SCH_SCREEN* screen = m_screens.GetFirst(); screen; screen = m_screens.GetNext() )
-    {
-        std::vector<SCH_MARKER*> markers;
+        screens.push_back( screen );
 
-        for( SCH_ITEM* item : screen->Items() )
-        {
-            if( item->Type() == SCH_LINE_T && item->IsConnectable() )
+    // Each screen is scanned independently and only touches its own marker list, so the
+    // screens can be farmed out to the thread pool; the markers are appended serially below.
+    std::vector<std::vector<SCH_MARKER*>> screenMarkers( screens.size() );
+
+    thread_pool& tp = GetKiCadThreadPool();
+
+    tp.submit_loop( 0, screens.size(),
+            [&]( size_t ii )
             {
-                SCH_LINE* line = static_cast<SCH_LINE*>( item );
+                SCH_SCREEN*               screen = screens[ii];
+                std::vector<SCH_MARKER*>& markers = screenMarkers[ii];
 
-                if( ( line->GetStartPoint().x % gridSize ) != 0
-                        || ( line->GetStartPoint().y % gridSize ) != 0 )
+                for( SCH_ITEM* item : screen->Items() )
                 {
-                    std::shared_ptr<ERC_ITEM> ercItem = ERC_ITEM::Create( ERCE_ENDPOINT_OFF_GRID );
-                    ercItem->SetItems( line );
+                    if( item->Type() == SCH_LINE_T && item->IsConnectable() )
+                    {
+                        SCH_LINE* line = static_cast<SCH_LINE*>( item );
 
-                    markers.emplace_back( new SCH_MARKER( std::move( ercItem ), line->GetStartPoint() ) );
-                }
-                else if( ( line->GetEndPoint().x % gridSize ) != 0
-                            || ( line->GetEndPoint().y % gridSize ) != 0 )
-                {
-                    std::shared_ptr<ERC_ITEM> ercItem = ERC_ITEM::Create( ERCE_ENDPOINT_OFF_GRID );
-                    ercItem->SetItems( line );
+                        if( ( line->GetStartPoint().x % gridSize ) != 0
+                                || ( line->GetStartPoint().y % gridSize ) != 0 )
+                        {
+                            std::shared_ptr<ERC_ITEM> ercItem = ERC_ITEM::Create( ERCE_ENDPOINT_OFF_GRID );
+                            ercItem->SetItems( line );
 
-                    markers.emplace_back( new SCH_MARKER( std::move( ercItem ), line->GetEndPoint() ) );
-                }
-            }
-            if( item->Type() == SCH_BUS_WIRE_ENTRY_T )
-            {
-                SCH_BUS_WIRE_ENTRY* entry = static_cast<SCH_BUS_WIRE_ENTRY*>( item );
+                            markers.emplace_back( new SCH_MARKER( std::move( ercItem ), line->GetStartPoint() ) );
+                        }
+                        else if( ( line->GetEndPoint().x % gridSize ) != 0
+                                    || ( line->GetEndPoint().y % gridSize ) != 0 )
+                        {
+                            std::shared_ptr<ERC_ITEM> ercItem = ERC_ITEM::Create( ERCE_ENDPOINT_OFF_GRID );
+                            ercItem->SetItems( line );
 
-                for( const VECTOR2I& point : entry->GetConnectionPoints() )
-                {
-                    if( ( point.x % gridSize ) != 0
-                        || ( point.y % gridSize ) != 0 )
+                            markers.emplace_back( new SCH_MARKER( std::move( ercItem ), line->GetEndPoint() ) );
+                        }
+                    }
+                    if( item->Type() == SCH_BUS_WIRE_ENTRY_T )
                     {
-                        std::shared_ptr<ERC_ITEM> ercItem = ERC_ITEM::Create( ERCE_ENDPOINT_OFF_GRID );
-                        ercItem->SetItems( entry );
+                        SCH_BUS_WIRE_ENTRY* entry = static_cast<SCH_BUS_WIRE_ENTRY*>( item );
+
+                        for( const VECTOR2I& point : entry->GetConnectionPoints() )
+                        {
+                            if( ( point.x % gridSize ) != 0
+                                || ( point.y % gridSize ) != 0 )
+                            {
+                                std::shared_ptr<ERC_ITEM> ercItem = ERC_ITEM::Create( ERCE_ENDPOINT_OFF_GRID );
+                                ercItem->SetItems( entry );
 
-                        markers.emplace_back( new SCH_MARKER( std::move( ercItem ), point ) );
+                                markers.emplace_back( new SCH_MARKER( std::move( ercItem ), point ) );
+                            }
+                        }
                     }
-                }
-            }
-            else if( item->Type() == SCH_SYMBOL_T )
-            {
-                SCH_SYMBOL* symbol = static_cast<SCH_SYMBOL*>( item );
+                    else if( item->Type() == SCH_SYMBOL_T )
+                    {
+                        SCH_SYMBOL* symbol = static_cast<SCH_SYMBOL*>( item );
 
-                for( SCH_PIN* pin : symbol->GetPins( nullptr ) )
-                {
-                    if( pin->GetType() == ELECTRICAL_PINTYPE::PT_NC )
-                        continue;
+                        for( SCH_PIN* pin : symbol->GetPins( nullptr ) )
+                        {
+                            if( pin->GetType() == ELECTRICAL_PINTYPE::PT_NC )
+                                continue;
 
-                    VECTOR2I pinPos = pin->GetPosition();
+                            VECTOR2I pinPos = pin->GetPosition();
 
-                    if( ( pinPos.x % gridSize ) != 0 || ( pinPos.y % gridSize ) != 0 )
-                    {
-                        std::shared_ptr<ERC_ITEM> ercItem = ERC_ITEM::Create( ERCE_ENDPOINT_OFF_GRID );
-                        ercItem->SetItems( pin );
+                            if( ( pinPos.x % gridSize ) != 0 || ( pinPos.y % gridSize ) != 0 )
+                            {
+                                std::shared_ptr<ERC_ITEM> ercItem = ERC_ITEM::Create( ERCE_ENDPOINT_OFF_GRID );
+                                ercItem->SetItems( pin );
 
-                        markers.emplace_back( new SCH_MARKER( std::move( ercItem ), pinPos ) );
-                        break;
+                                markers.emplace_back( new SCH_MARKER( std::move( ercItem ), pinPos ) );
+                                break;
+                            }
+                        }
                     }
                 }
-            }
-        }
+            } ).wait();
 
-        for( SCH_MARKER* marker : markers )
+    for( size_t ii = 0; ii < screens.size(); ++ii )
+    {
+        for( SCH_MARKER* marker : screenMarkers[ii] )
         {
-            screen->Append( marker );
+            screens[ii]->Append( marker );
             err_count += 1;
         }
     }
@@ -1860,6 +1881,19 @@ void ERC_TESTER::RunTests( DS_PROXY_VIEW_ITEM* aDrawingSheet, SCH_EDIT_FRAME* aE
 {
     m_sheetList.AnnotatePowerSymbols();
 
+    // The individual tests all append markers to the shared screens and most of them walk
+    // the same lazily-built connection graph, so they must run one at a time.  Per-test wall
+    // times go to the KICAD_ERC_PROFILE trace channel so the expensive ones stand out.
+    auto runTest =
+            [&]( const char* aName, const std::function<void()>& aTest )
+            {
+                PROF_TIMER timer( aName );
+                aTest();
+                timer.Stop();
+
+                KI_TRACE( traceErcProfile, wxT( "%s: %0.1f ms\n" ), aName, timer.msecs() );
+            };
+
     // Test duplicate sheet names inside a given sheet.  While one can have multiple references
     // to the same file, each must have a unique name.
     if( m_settings.IsTestEnabled( ERCE_DUPLICATE_SHEET_NAME ) )
@@ -1867,7 +1901,7 @@ void ERC_TESTER::RunTests( DS_PROXY_VIEW_ITEM* aDrawingSheet, SCH_EDIT_FRAME* aE
         if( aProgressReporter )
             aProgressReporter->AdvancePhase( _( "Checking sheet names..." ) );
 
-        TestDuplicateSheetNames( true );
+        runTest( "TestDuplicateSheetNames", [&]() { TestDuplicateSheetNames( true ); } );
     }
 
     // The connection graph has a whole set of ERC checks it can run
@@ -1883,7 +1917,7 @@ void ERC_TESTER::RunTests( DS_PROXY_VIEW_ITEM* aDrawingSheet, SCH_EDIT_FRAME* aE
             aEditFrame->RecalculateConnections( nullptr, NO_CLEANUP );
     }
 
-    m_schematic->ConnectionGraph()->RunERC();
+    runTest( "ConnectionGraph::RunERC", [&]() { m_schematic->ConnectionGraph()->RunERC(); } );
 
     if( aProgressReporter )
         aProgressReporter->AdvancePhase( _( "Checking units..." ) );
@@ -1894,7 +1928,7 @@ void ERC_TESTER::RunTests( DS_PROXY_VIEW_ITEM* aDrawingSheet, SCH_EDIT_FRAME* aE
         if( aProgressReporter )
             aProgressReporter->AdvancePhase( _( "Checking footprints..." ) );
 
-        TestMultiunitFootprints();
+        runTest( "TestMultiunitFootprints", [&]() { TestMultiunitFootprints(); } );
     }
 
     if( m_settings.IsTestEnabled( ERCE_MISSING_UNIT )
@@ -1902,28 +1936,28 @@ void ERC_TESTER::RunTests( DS_PROXY_VIEW_ITEM* aDrawingSheet, SCH_EDIT_FRAME* aE
         || m_settings.IsTestEnabled( ERCE_MISSING_POWER_INPUT_PIN )
         || m_settings.IsTestEnabled( ERCE_MISSING_BIDI_PIN ) )
     {
-        TestMissingUnits();
+        runTest( "TestMissingUnits", [&]() { TestMissingUnits(); } );
     }
 
     if( aProgressReporter )
         aProgressReporter->AdvancePhase( _( "Checking pins..." ) );
 
     if( m_settings.IsTestEnabled( ERCE_DIFFERENT_UNIT_NET ) )
-        TestMultUnitPinConflicts();
+        runTest( "TestMultUnitPinConflicts", [&]() { TestMultUnitPinConflicts(); } );
 
     // Test pins on each net against the pin connection table
     if( m_settings.IsTestEnabled( ERCE_PIN_TO_PIN_ERROR )
         || m_settings.IsTestEnabled( ERCE_POWERPIN_NOT_DRIVEN )
         || m_settings.IsTestEnabled( ERCE_PIN_NOT_DRIVEN ) )
     {
-        TestPinToPin();
+        runTest( "TestPinToPin", [&]() { TestPinToPin(); } );
     }
 
     if( m_settings.IsTestEnabled( ERCE_GROUND_PIN_NOT_GROUND ) )
-        TestGroundPins();
+        runTest( "TestGroundPins", [&]() { TestGroundPins(); } );
 
     if( m_settings.IsTestEnabled( ERCE_STACKED_PIN_SYNTAX ) )
-        TestStackedPinNotation();
+        runTest( "TestStackedPinNotation", [&]() { TestStackedPinNotation(); } );
 
     // Test similar labels (i;e. labels which are identical when
     // using case insensitive comparisons)
@@ -1934,7 +1968,7 @@ void ERC_TESTER::RunTests( DS_PROXY_VIEW_ITEM* aDrawingSheet, SCH_EDIT_FRAME* aE
         if( aProgressReporter )
             aProgressReporter->AdvancePhase( _( "Checking similar labels..." ) );
 
-        TestSimilarLabels();
+        runTest( "TestSimilarLabels", [&]() { TestSimilarLabels(); } );
     }
 
     if( m_settings.IsTestEnabled( ERCE_SAME_LOCAL_GLOBAL_LABEL ) )
@@ -1942,7 +1976,7 @@ void ERC_TESTER::RunTests( DS_PROXY_VIEW_ITEM* aDrawingSheet, SCH_EDIT_FRAME* aE
         if( aProgressReporter )
             aProgressReporter->AdvancePhase( _( "Checking local and global labels..." ) );
 
-        TestSameLocalGlobalLabel();
+        runTest( "TestSameLocalGlobalLabel", [&]() { TestSameLocalGlobalLabel(); } );
     }
 
     if( m_settings.IsTestEnabled( ERCE_UNRESOLVED_VARIABLE ) )
@@ -1950,7 +1984,7 @@ void ERC_TESTER::RunTests( DS_PROXY_VIEW_ITEM* aDrawingSheet, SCH_EDIT_FRAME* aE
         if( aProgressReporter )
             aProgressReporter->AdvancePhase( _( "Checking for unresolved variables..." ) );
 
-        TestTextVars( aDrawingSheet );
+        runTest( "TestTextVars", [&]() { TestTextVars( aDrawingSheet ); } );
     }
 
     if( m_settings.IsTestEnabled( ERCE_SIMULATION_MODEL ) )
@@ -1958,7 +1992,7 @@ void ERC_TESTER::RunTests( DS_PROXY_VIEW_ITEM* aDrawingSheet, SCH_EDIT_FRAME* aE
         if( aProgressReporter )
             aProgressReporter->AdvancePhase( _( "Checking SPICE models..." ) );
 
-        TestSimModelIssues();
+        runTest( "TestSimModelIssues", [&]() { TestSimModelIssues(); } );
     }
 
     if( m_settings.IsTestEnabled( ERCE_NOCONNECT_CONNECTED ) )
@@ -1966,7 +2000,7 @@ void ERC_TESTER::RunTests( DS_PROXY_VIEW_ITEM* aDrawingSheet, SCH_EDIT_FRAME* aE
         if( aProgressReporter )
             aProgressReporter->AdvancePhase( _( "Checking no connect pins for connections..." ) );
 
-        TestNoConnectPins();
+        runTest( "TestNoConnectPins", [&]() { TestNoConnectPins(); } );
     }
 
     if( m_settings.IsTestEnabled( ERCE_LIB_SYMBOL_ISSUES )
@@ -1975,7 +2009,7 @@ void ERC_TESTER::RunTests( DS_PROXY_VIEW_ITEM* aDrawingSheet, SCH_EDIT_FRAME* aE
         if( aProgressReporter )
             aProgressReporter->AdvancePhase( _( "Checking for library symbol issues..." ) );
 
-        TestLibSymbolIssues();
+        runTest( "TestLibSymbolIssues", [&]() { TestLibSymbolIssues(); } );
     }
 
     if( m_settings.IsTestEnabled( ERCE_FOOTPRINT_LINK_ISSUES ) && aCvPcb )
@@ -1983,7 +2017,7 @@ void ERC_TESTER::RunTests( DS_PROXY_VIEW_ITEM* aDrawingSheet, SCH_EDIT_FRAME* aE
         if( aProgressReporter )
             aProgressReporter->AdvancePhase( _( "Checking for footprint link issues..." ) );
 
-        TestFootprintLinkIssues( aCvPcb, aProject );
+        runTest( "TestFootprintLinkIssues", [&]() { TestFootprintLinkIssues( aCvPcb, aProject ); } );
     }
 
     if( m_settings.IsTestEnabled( ERCE_FOOTPRINT_FILTERS ) )
@@ -1991,7 +2025,7 @@ void ERC_TESTER::RunTests( DS_PROXY_VIEW_ITEM* aDrawingSheet, SCH_EDIT_FRAME* aE
         if( aProgressReporter )
             aProgressReporter->AdvancePhase( _( "Checking footprint assignments against footprint filters..." ) );
 
-        TestFootprintFilters();
+        runTest( "TestFootprintFilters", [&]() { TestFootprintFilters(); } );
     }
 
     if( m_settings.IsTestEnabled( ERCE_ENDPOINT_OFF_GRID ) )
@@ -1999,7 +2033,7 @@ void ERC_TESTER::RunTests( DS_PROXY_VIEW_ITEM* aDrawingSheet, SCH_EDIT_FRAME* aE
         if( aProgressReporter )
             aProgressReporter->AdvancePhase( _( "Checking for off grid pins and wires..." ) );
 
-        TestOffGridEndpoints();
+        runTest( "TestOffGridEndpoints", [&]() { TestOffGridEndpoints(); } );
     }
 
     if( m_settings.IsTestEnabled( ERCE_FOUR_WAY_JUNCTION ) )
@@ -2007,7 +2041,7 @@ void ERC_TESTER::RunTests( DS_PROXY_VIEW_ITEM* aDrawingSheet, SCH_EDIT_FRAME* aE
         if( aProgressReporter )
             aProgressReporter->AdvancePhase( _( "Checking for four way junctions..." ) );
 
-        TestFourWayJunction();
+        runTest( "TestFourWayJunction", [&]() { TestFourWayJunction(); } );
     }
 
     if( m_settings.IsTestEnabled( ERCE_LABEL_MULTIPLE_WIRES ) )
@@ -2015,7 +2049,7 @@ void ERC_TESTER::RunTests( DS_PROXY_VIEW_ITEM* aDrawingSheet, SCH_EDIT_FRAME* aE
         if( aProgressReporter )
             aProgressReporter->AdvancePhase( _( "Checking for labels on more than one wire..." ) );
 
-        TestLabelMultipleWires();
+        runTest( "TestLabelMultipleWires", [&]() { TestLabelMultipleWires(); } );
     }
 
     if( m_settings.IsTestEnabled( ERCE_UNDEFINED_NETCLASS ) )
@@ -2023,7 +2057,7 @@ void ERC_TESTER::RunTests( DS_PROXY_VIEW_ITEM* aDrawingSheet, SCH_EDIT_FRAME* aE
         if( aProgressReporter )
             aProgressReporter->AdvancePhase( _( "Checking for undefined netclasses..." ) );
 
-        TestMissingNetclasses();
+        runTest( "TestMissingNetclasses", [&]() { TestMissingNetclasses(); } );
     }
 
     m_schematic->ResolveERCExclusionsPostUpdate();
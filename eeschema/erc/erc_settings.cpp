@@ -340,7 +340,7 @@ void SHEETLIST_ERC_ITEMS_PROVIDER::visitMarkers( std::function<void( SCH_MARKER*
 {
     std::set<SCH_SCREEN*> seenScreens;
 
-    for( const SCH_SHEET_PATH& sheet : m_schematic->BuildUnorderedSheetList() )
+    for( const SCH_SHEET_PATH& sheet : m_schematic->GetUnorderedSheets() )
     {
         bool firstTime = seenScreens.count( sheet.LastScreen() ) == 0;
 
@@ -209,8 +209,35 @@ void FIELDS_EDITOR_GRID_DATA_MODEL::AddColumn( const wxString& aFieldName, const
 
     m_cols.push_back( { aFieldName, aLabel, aAddedByUser, false, false } );
 
-    for( unsigned i = 0; i < m_symbolsList.GetCount(); ++i )
-        updateDataStoreSymbolField( m_symbolsList[i], aFieldName, aVariantNames );
+    // Don't resolve the field for every symbol up front; on large designs that dominates the
+    // time to open the dialog.  Values are materialized by getDataStoreValue() the first time
+    // a cell is shown, sorted, grouped or exported.
+    m_variantNames.insert( aVariantNames.begin(), aVariantNames.end() );
+}
+
+
+wxString FIELDS_EDITOR_GRID_DATA_MODEL::getDataStoreValue( const SCH_REFERENCE& aRef,
+                                                           const wxString&      aFieldName )
+{
+    const SCH_SYMBOL* symbol = aRef.GetSymbol();
+
+    if( !symbol )
+        return wxEmptyString;
+
+    KIID_PATH key = makeDataStoreKey( aRef.GetSheetPath(), *symbol );
+    auto      storeIt = m_dataStore.find( key );
+
+    if( storeIt != m_dataStore.end() )
+    {
+        auto fieldIt = storeIt->second.find( aFieldName );
+
+        if( fieldIt != storeIt->second.end() )
+            return fieldIt->second;
+    }
+
+    updateDataStoreSymbolField( aRef, aFieldName, m_variantNames );
+
+    return m_dataStore[key][aFieldName];
 }
 
 
@@ -405,12 +432,7 @@ wxString FIELDS_EDITOR_GRID_DATA_MODEL::GetValue( const DATA_MODEL_ROW& group, i
         }
         else // Other columns are either a single value or ROW_MULTI_ITEMS
         {
-            KIID_PATH symbolKey = makeDataStoreKey( ref.GetSheetPath(), *ref.GetSymbol() );
-
-            if( !m_dataStore.contains( symbolKey ) || !m_dataStore[symbolKey].contains( m_cols[aCol].m_fieldName ) )
-                return INDETERMINATE_STATE;
-
-            wxString refFieldValue = m_dataStore[symbolKey][m_cols[aCol].m_fieldName];
+            wxString refFieldValue = getDataStoreValue( ref, m_cols[aCol].m_fieldName );
 
             if( resolveVars )
             {
@@ -694,9 +716,6 @@ bool FIELDS_EDITOR_GRID_DATA_MODEL::groupMatch( const SCH_REFERENCE& lhRef, cons
         matchFound = true;
     }
 
-    KIID_PATH lhRefKey = makeDataStoreKey( lhRef.GetSheetPath(), *lhRef.GetSymbol() );
-    KIID_PATH rhRefKey = makeDataStoreKey( rhRef.GetSheetPath(), *rhRef.GetSymbol() );
-
     // Now check all the other columns.
     for( size_t i = 0; i < m_cols.size(); ++i )
     {
@@ -710,27 +729,14 @@ bool FIELDS_EDITOR_GRID_DATA_MODEL::groupMatch( const SCH_REFERENCE& lhRef, cons
         // If the field is generated (e.g. ${QUANTITY}), we need to resolve it through the symbol
         // to get the actual current value; otherwise we need to pull it out of the store so the
         // refresh can regroup based on values that haven't been applied to the schematic yet.
-        wxString lh, rh;
+        wxString lh = getDataStoreValue( lhRef, m_cols[i].m_fieldName );
+        wxString rh = getDataStoreValue( rhRef, m_cols[i].m_fieldName );
 
-        if( IsGeneratedField( m_cols[i].m_fieldName )
-            || IsGeneratedField( m_dataStore[lhRefKey][m_cols[i].m_fieldName] ) )
-        {
+        if( IsGeneratedField( m_cols[i].m_fieldName ) || IsGeneratedField( lh ) )
             lh = getFieldShownText( lhRef, m_cols[i].m_fieldName );
-        }
-        else
-        {
-            lh = m_dataStore[lhRefKey][m_cols[i].m_fieldName];
-        }
 
-        if( IsGeneratedField( m_cols[i].m_fieldName )
-            || IsGeneratedField( m_dataStore[rhRefKey][m_cols[i].m_fieldName] ) )
-        {
+        if( IsGeneratedField( m_cols[i].m_fieldName ) || IsGeneratedField( rh ) )
             rh = getFieldShownText( rhRef, m_cols[i].m_fieldName );
-        }
-        else
-        {
-            rh = m_dataStore[rhRefKey][m_cols[i].m_fieldName];
-        }
 
         wxString fieldName = m_cols[i].m_fieldName;
 
@@ -1231,9 +1237,7 @@ int FIELDS_EDITOR_GRID_DATA_MODEL::GetDataWidth( int aCol )
 
         for( unsigned symbolRef = 0; symbolRef < m_symbolsList.GetCount(); ++symbolRef )
         {
-            KIID_PATH key = makeDataStoreKey( m_symbolsList[symbolRef].GetSheetPath(),
-                                              *m_symbolsList[symbolRef].GetSymbol() );
-            wxString text = m_dataStore[key][fieldName];
+            wxString text = getDataStoreValue( m_symbolsList[symbolRef], fieldName );
 
             width = std::max( width, KIUI::GetTextSize( text, GetView() ).x );
         }
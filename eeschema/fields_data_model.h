@@ -365,6 +365,11 @@ private:
     void updateDataStoreSymbolField( const SCH_REFERENCE& aSymbolRef, const wxString& aFieldName,
                                      const std::set<wxString>& aVariantNames );
 
+    /* Fetch a field value from the data store, resolving it from the symbol on first access.
+     * Columns no longer resolve every symbol's field up front, so any read of the store other
+     * than an explicit write-back must go through here. */
+    wxString getDataStoreValue( const SCH_REFERENCE& aRef, const wxString& aFieldName );
+
 protected:
     /**
      * The flattened by hierarchy list of symbols.
@@ -388,9 +393,14 @@ protected:
     std::vector<DATA_MODEL_COL> m_cols;
     std::vector<DATA_MODEL_ROW> m_rows;
 
+    // Variant names seen by AddColumn(), kept for lazily resolving fields on first access
+    std::set<wxString> m_variantNames;
+
     // Data store
     // The data model is fundamentally m_componentRefs X m_fieldNames.
     // A map of compID : fieldSet, where fieldSet is a map of fieldName : fieldValue
     // The compID is now the full KIID_PATH (sheet path + symbol UUID) as a string
+    // Entries are materialized lazily: a missing entry means the field simply hasn't been
+    // resolved yet, not that the symbol lacks the field.
     std::map<KIID_PATH, std::map<wxString, wxString>> m_dataStore;
 };
@@ -74,7 +74,7 @@ static wxString netList( SCH_SYMBOL* aSymbol, SCH_SHEET_PATH& aSheetPath )
     // select/filter right footprints
     wxArrayString pins;
 
-    const std::unique_ptr< LIB_SYMBOL >& lib_symbol = aSymbol->GetLibSymbolRef();
+    const std::shared_ptr<LIB_SYMBOL>& lib_symbol = aSymbol->GetLibSymbolRef();
 
     if( lib_symbol )
     {
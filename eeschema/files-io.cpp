@@ -41,6 +41,7 @@
 #include <lockfile.h>
 #include <pgm_base.h>
 #include <core/profile.h>
+#include <perf_counters.h>
 #include <project/project_file.h>
 #include <project_rescue.h>
 #include <project_sch.h>
@@ -1975,6 +1976,8 @@ bool PrepareSaveAsFiles( SCHEMATIC& aSchematic, SCH_SCREENS& aScreens,
 
 bool SCH_EDIT_FRAME::SaveProject( bool aSaveAs )
 {
+    PERF_SCOPED_SAMPLE perfSample( "schematic_save" );
+
     wxString msg;
     SCH_SCREEN* screen;
     SCH_SCREENS screens( Schematic().Root() );
@@ -28,7 +28,7 @@
 using namespace JUNCTION_HELPERS;
 
 POINT_INFO JUNCTION_HELPERS::AnalyzePoint( const EE_RTREE& aItems, const VECTOR2I& aPosition,
-                                           bool aBreakCrossings )
+                                           bool aBreakCrossings, const EE_RTREE* aExtraItems )
 {
     enum layers
     {
@@ -51,46 +51,56 @@ POINT_INFO JUNCTION_HELPERS::AnalyzePoint( const EE_RTREE& aItems, const VECTOR2
 
     // Ignore items that are currently being moved or flagged to skip
     // and temporarily merge collinear wires before analyzing the point.
-    for( SCH_ITEM* item : aItems.Overlapping( aPosition ) )
-    {
-        if( item->GetEditFlags() & ( SKIP_STRUCT | STRUCT_DELETED ) )
-            continue;
+    auto processItem =
+            [&]( SCH_ITEM* item )
+            {
+                if( item->GetEditFlags() & ( SKIP_STRUCT | STRUCT_DELETED ) )
+                    return;
 
-        switch( item->Type() )
-        {
-        case  SCH_LINE_T:
-        {
-            SCH_LINE* line = static_cast<SCH_LINE*>( item );
+                switch( item->Type() )
+                {
+                case  SCH_LINE_T:
+                {
+                    SCH_LINE* line = static_cast<SCH_LINE*>( item );
 
-            if( line->IsConnectable() )
-                mergedLines.emplace_back( new SCH_LINE( *line ) );
+                    if( line->IsConnectable() )
+                        mergedLines.emplace_back( new SCH_LINE( *line ) );
 
-            break;
-        }
+                    break;
+                }
 
-        case SCH_JUNCTION_T:
-            if( item->HitTest( aPosition, -1 ) )
-                info.hasExplicitJunctionDot = true;
+                case SCH_JUNCTION_T:
+                    if( item->HitTest( aPosition, -1 ) )
+                        info.hasExplicitJunctionDot = true;
 
-            filtered.insert( item );
-            break;
+                    filtered.insert( item );
+                    break;
 
-        case SCH_BUS_WIRE_ENTRY_T:
-            info.hasBusEntry = true;
-            filtered.insert( item );
-            break;
+                case SCH_BUS_WIRE_ENTRY_T:
+                    info.hasBusEntry = true;
+                    filtered.insert( item );
+                    break;
 
-        case SCH_SHEET_T:
-        case SCH_SYMBOL_T:
-        case SCH_LABEL_T:
-        case SCH_HIER_LABEL_T:
-        case SCH_GLOBAL_LABEL_T:
-            filtered.insert( item );
-            break;
+                case SCH_SHEET_T:
+                case SCH_SYMBOL_T:
+                case SCH_LABEL_T:
+                case SCH_HIER_LABEL_T:
+                case SCH_GLOBAL_LABEL_T:
+                    filtered.insert( item );
+                    break;
 
-        default:
-            break;
-        }
+                default:
+                    break;
+                }
+            };
+
+    for( SCH_ITEM* item : aItems.Overlapping( aPosition ) )
+        processItem( item );
+
+    if( aExtraItems )
+    {
+        for( SCH_ITEM* item : aExtraItems->Overlapping( aPosition ) )
+            processItem( item );
     }
 
     if( mergedLines.size() + filtered.size() < 2 )
@@ -246,26 +256,19 @@ POINT_INFO JUNCTION_HELPERS::AnalyzePoint( const EE_RTREE& aItems, const VECTOR2
 std::vector<SCH_JUNCTION*> JUNCTION_HELPERS::PreviewJunctions( const SCH_SCREEN* aScreen,
                                                                const std::vector<SCH_ITEM*>& aItems )
 {
-    EE_RTREE combined;
-
-    // Existing items
-    for( const SCH_ITEM* item : aScreen->Items() )
-    {
-        if( !item->IsConnectable() )
-            continue;
+    // The screen already maintains an R-tree over its items, so only the temporary items
+    // need one built here; copying the whole sheet per preview made dragging wires on
+    // crowded sheets O(n) per mouse event.
+    EE_RTREE temporary;
 
-        combined.insert( const_cast<SCH_ITEM*>( item ) );
-    }
-
-    // Temporary items
     for( SCH_ITEM* item : aItems )
     {
         if( !item || !item->IsConnectable() )
             continue;
-        combined.insert( item );
+
+        temporary.insert( item );
     }
 
-    std::vector<VECTOR2I> connections = aScreen->GetConnections();
     std::vector<VECTOR2I> pts;
 
     for( SCH_ITEM* item : aItems )
@@ -280,10 +283,19 @@ std::vector<SCH_JUNCTION*> JUNCTION_HELPERS::PreviewJunctions( const SCH_SCREEN*
         {
             SCH_LINE* line = static_cast<SCH_LINE*>( item );
 
-            for( const VECTOR2I& pt : connections )
+            // Only connection points of items near the dragged line can land on it, so
+            // query the screen's R-tree rather than collecting every connection point on
+            // the sheet.
+            for( SCH_ITEM* other : aScreen->Items().Overlapping( line->GetBoundingBox() ) )
             {
-                if( IsPointOnSegment( line->GetStartPoint(), line->GetEndPoint(), pt ) )
-                    pts.push_back( pt );
+                if( other->GetEditFlags() & ( IS_MOVING | IS_DELETED ) )
+                    continue;
+
+                for( const VECTOR2I& pt : other->GetConnectionPoints() )
+                {
+                    if( IsPointOnSegment( line->GetStartPoint(), line->GetEndPoint(), pt ) )
+                        pts.push_back( pt );
+                }
             }
         }
     }
@@ -300,7 +312,7 @@ std::vector<SCH_JUNCTION*> JUNCTION_HELPERS::PreviewJunctions( const SCH_SCREEN*
 
     for( const VECTOR2I& pt : pts )
     {
-        POINT_INFO info = AnalyzePoint( combined, pt, false );
+        POINT_INFO info = AnalyzePoint( aScreen->Items(), pt, false, &temporary );
 
         if( info.isJunction && ( !info.hasBusEntry || info.hasBusEntryToMultipleWires ) )
         {
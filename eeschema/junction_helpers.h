@@ -50,8 +50,12 @@ struct POINT_INFO
 /**
  * Check a tree of items for a confluence at a given point and work out what kind of junction
  * it is, if any.
+ *
+ * @param aExtraItems  Optional additional tree of (e.g. temporary) items to consider as if
+ *                     they were part of \a aItem.
  */
-POINT_INFO AnalyzePoint( const EE_RTREE& aItem, const VECTOR2I& aPosition, bool aBreakCrossings );
+POINT_INFO AnalyzePoint( const EE_RTREE& aItem, const VECTOR2I& aPosition, bool aBreakCrossings,
+                         const EE_RTREE* aExtraItems = nullptr );
 
 /**
  * Determine the points where explicit junctions would be required if the given
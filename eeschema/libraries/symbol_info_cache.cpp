@@ -0,0 +1,280 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright The KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libraries/symbol_info_cache.h>
+
+#include <wx/filename.h>
+#include <wx/textfile.h>
+#include <wx/tokenzr.h>
+#include <wx/txtstrm.h>
+#include <wx/wfstream.h>
+
+#include <kiplatform/io.h>
+#include <lib_symbol.h>
+#include <paths.h>
+#include <string_utils.h>
+#include <template_fieldnames.h>
+
+
+SYMBOL_INFO_CACHE GSymbolInfoCache;
+
+
+void SYMBOL_INFO::GetChooserFields( std::map<wxString, wxString>& aColumnMap )
+{
+    aColumnMap[GetDefaultFieldName( FIELD_T::VALUE, false )] = m_name;
+
+    if( !m_footprint.IsEmpty() )
+        aColumnMap[GetDefaultFieldName( FIELD_T::FOOTPRINT, false )] = m_footprint;
+}
+
+
+std::vector<SEARCH_TERM> SYMBOL_INFO::GetSearchTerms()
+{
+    // Mirrors LIB_SYMBOL::GetSearchTerms() so placeholder items score the same as the real
+    // symbols that will replace them.
+    std::vector<SEARCH_TERM> terms;
+
+    terms.emplace_back( SEARCH_TERM( m_libNickname, 4 ) );
+    terms.emplace_back( SEARCH_TERM( m_name, 8 ) );
+    terms.emplace_back( SEARCH_TERM( GetLIB_ID().Format(), 16 ) );
+
+    wxStringTokenizer keywordTokenizer( m_keywords, " \t\r\n", wxTOKEN_STRTOK );
+
+    while( keywordTokenizer.HasMoreTokens() )
+        terms.emplace_back( SEARCH_TERM( keywordTokenizer.GetNextToken(), 4 ) );
+
+    // Also include keywords as one long string, just in case
+    terms.emplace_back( SEARCH_TERM( m_keywords, 1 ) );
+    terms.emplace_back( SEARCH_TERM( m_desc, 1 ) );
+
+    if( !m_footprint.IsEmpty() )
+        terms.emplace_back( SEARCH_TERM( m_footprint, 1 ) );
+
+    return terms;
+}
+
+
+wxString SYMBOL_INFO_CACHE::cacheFilePath()
+{
+    wxFileName fn;
+    fn.AssignDir( PATHS::GetUserCachePath() );
+    fn.SetFullName( wxT( "sym-info-cache" ) );
+    return fn.GetFullPath();
+}
+
+
+long long SYMBOL_INFO_CACHE::Timestamp( const wxString& aLibraryPath )
+{
+    wxFileName fn( aLibraryPath );
+
+    if( !fn.FileExists() )
+        return 0;
+
+    // Same recipe as TimestampDir(): last-mod-date plus size, so a same-second rewrite is
+    // still very likely to be noticed.
+    long long timestamp = 0;
+
+    wxDateTime lastModDate = fn.GetModificationTime();
+
+    if( lastModDate.IsValid() )
+        timestamp += lastModDate.GetValue().GetValue();
+
+    timestamp += fn.GetSize().GetValue();
+
+    return timestamp;
+}
+
+
+void SYMBOL_INFO_CACHE::Load()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    if( m_loaded )
+        return;
+
+    m_loaded = true;
+    m_libs.clear();
+    m_retired.clear();
+
+    wxTextFile cacheFile( cacheFilePath() );
+
+    try
+    {
+        if( !cacheFile.Exists() || !cacheFile.Open() )
+            return;
+
+        if( cacheFile.GetFirstLine() != wxT( "sym-info-cache-v1" ) )
+            return;
+
+        long libCount = 0;
+        cacheFile.GetNextLine().ToLong( &libCount );
+
+        for( long ii = 0; ii < libCount && !cacheFile.Eof(); ++ii )
+        {
+            wxStringTokenizer tokenizer( cacheFile.GetNextLine(), wxT( "\t" ) );
+
+            wxString  nickname = tokenizer.GetNextToken();
+            long long stamp = 0;
+            long      symCount = 0;
+
+            tokenizer.GetNextToken().ToLongLong( &stamp );
+            tokenizer.GetNextToken().ToLong( &symCount );
+
+            if( nickname.IsEmpty() )
+                return;     // corrupted; keep whatever parsed cleanly so far
+
+            LIB_ENTRY& entry = m_libs[nickname];
+            entry.Stamp = stamp;
+
+            for( long jj = 0; jj < symCount; ++jj )
+            {
+                if( cacheFile.GetCurrentLine() + 6 > cacheFile.GetLineCount() )
+                    return;
+
+                wxString name      = cacheFile.GetNextLine();
+                wxString desc      = UnescapeString( cacheFile.GetNextLine() );
+                wxString keywords  = UnescapeString( cacheFile.GetNextLine() );
+                wxString footprint = UnescapeString( cacheFile.GetNextLine() );
+                long     pinCount = 0;
+                long     unitCount = 0;
+
+                cacheFile.GetNextLine().ToLong( &pinCount );
+                cacheFile.GetNextLine().ToLong( &unitCount );
+
+                entry.Symbols.emplace_back( std::make_unique<SYMBOL_INFO>(
+                        nickname, name, desc, keywords, footprint, (int) pinCount,
+                        (int) unitCount ) );
+            }
+        }
+    }
+    catch( ... )
+    {
+        // wxWidgets can throw if the file is corrupted; start from an empty cache.
+        m_libs.clear();
+    }
+}
+
+
+void SYMBOL_INFO_CACHE::SaveIfDirty()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    if( !m_dirty )
+        return;
+
+    wxString   filePath = cacheFilePath();
+    wxFileName tmpFileName = wxFileName::CreateTempFileName( filePath );
+
+    wxFFileOutputStream outStream( tmpFileName.GetFullPath() );
+    wxTextOutputStream  txtStream( outStream );
+
+    if( !outStream.IsOk() )
+        return;
+
+    txtStream << wxT( "sym-info-cache-v1" ) << endl;
+    txtStream << wxString::Format( wxT( "%zu" ), m_libs.size() ) << endl;
+
+    for( const auto& [nickname, entry] : m_libs )
+    {
+        txtStream << nickname << wxT( "\t" )
+                  << wxString::Format( wxT( "%lld" ), entry.Stamp ) << wxT( "\t" )
+                  << wxString::Format( wxT( "%zu" ), entry.Symbols.size() ) << endl;
+
+        for( const std::unique_ptr<SYMBOL_INFO>& info : entry.Symbols )
+        {
+            txtStream << info->GetName() << endl;
+            txtStream << EscapeString( info->GetDesc(), CTX_LINE ) << endl;
+            txtStream << EscapeString( info->GetKeywords(), CTX_LINE ) << endl;
+            txtStream << EscapeString( info->GetFootprint(), CTX_LINE ) << endl;
+            txtStream << wxString::Format( wxT( "%d" ), info->GetPinCount() ) << endl;
+            txtStream << wxString::Format( wxT( "%d" ), info->GetSubUnitCount() ) << endl;
+        }
+    }
+
+    txtStream.Flush();
+    outStream.Close();
+
+    // Preserve the permissions of the current file
+    KIPLATFORM::IO::DuplicatePermissions( filePath, tmpFileName.GetFullPath() );
+
+    if( !wxRenameFile( tmpFileName.GetFullPath(), filePath, true ) )
+    {
+        // cleanup in case rename failed
+        // its also not the end of the world since this is just a cache file
+        wxRemoveFile( tmpFileName.GetFullPath() );
+        return;
+    }
+
+    m_dirty = false;
+}
+
+
+bool SYMBOL_INFO_CACHE::GetLibraryItems( const wxString& aNickname, long long aStamp,
+                                         std::vector<LIB_TREE_ITEM*>& aItems )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    auto it = m_libs.find( aNickname );
+
+    if( it == m_libs.end() || it->second.Stamp != aStamp || aStamp == 0 )
+        return false;
+
+    for( const std::unique_ptr<SYMBOL_INFO>& info : it->second.Symbols )
+        aItems.push_back( info.get() );
+
+    return true;
+}
+
+
+void SYMBOL_INFO_CACHE::UpdateLibrary( const wxString& aNickname, long long aStamp,
+                                       const std::vector<LIB_SYMBOL*>& aSymbols )
+{
+    if( aStamp == 0 )
+        return;
+
+    // Make sure the file has been read first, so a partial update can't clobber the cached
+    // entries of libraries this session never enumerated.
+    Load();
+
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    auto it = m_libs.find( aNickname );
+
+    if( it != m_libs.end() && it->second.Stamp == aStamp )
+        return;
+
+    LIB_ENTRY& entry = m_libs[aNickname];
+
+    // Placeholder tree nodes may still point at the old items; park them instead of freeing.
+    for( std::unique_ptr<SYMBOL_INFO>& info : entry.Symbols )
+        m_retired.emplace_back( std::move( info ) );
+
+    entry.Symbols.clear();
+    entry.Stamp = aStamp;
+
+    for( LIB_SYMBOL* symbol : aSymbols )
+    {
+        entry.Symbols.emplace_back( std::make_unique<SYMBOL_INFO>(
+                aNickname, symbol->GetName(), symbol->GetShownDescription(),
+                symbol->GetShownKeyWords(), symbol->GetFootprint(), symbol->GetPinCount(),
+                symbol->GetUnitCount() ) );
+    }
+
+    m_dirty = true;
+}
@@ -0,0 +1,143 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright The KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYMBOL_INFO_CACHE_H
+#define SYMBOL_INFO_CACHE_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <lib_tree_item.h>
+
+class LIB_SYMBOL;
+
+
+/**
+ * A lightweight stand-in for a #LIB_SYMBOL in the symbol chooser tree, built from cached
+ * metadata so the tree can be populated before the real library parse has finished.  It is
+ * never handed out for placement; once its library finishes loading the placeholder is
+ * replaced by the real symbol.
+ */
+class SYMBOL_INFO : public LIB_TREE_ITEM
+{
+public:
+    SYMBOL_INFO( const wxString& aLibNickname, const wxString& aName, const wxString& aDesc,
+                 const wxString& aKeywords, const wxString& aFootprint, int aPinCount,
+                 int aUnitCount ) :
+            m_libNickname( aLibNickname ),
+            m_name( aName ),
+            m_desc( aDesc ),
+            m_keywords( aKeywords ),
+            m_footprint( aFootprint ),
+            m_pinCount( aPinCount ),
+            m_unitCount( aUnitCount )
+    {
+    }
+
+    LIB_ID GetLIB_ID() const override { return LIB_ID( m_libNickname, m_name ); }
+
+    wxString GetName() const override { return m_name; }
+    wxString GetLibNickname() const override { return m_libNickname; }
+    wxString GetDesc() override { return m_desc; }
+
+    wxString GetKeywords() const { return m_keywords; }
+    wxString GetFootprint() override { return m_footprint; }
+
+    int GetPinCount() override { return m_pinCount; }
+    int GetSubUnitCount() const override { return m_unitCount; }
+
+    void GetChooserFields( std::map<wxString, wxString>& aColumnMap ) override;
+
+    std::vector<SEARCH_TERM> GetSearchTerms() override;
+
+private:
+    wxString m_libNickname;
+    wxString m_name;
+    wxString m_desc;
+    wxString m_keywords;
+    wxString m_footprint;
+    int      m_pinCount;
+    int      m_unitCount;
+};
+
+
+/**
+ * A per-user cache of symbol chooser metadata (names, descriptions, keywords, pin and unit
+ * counts), the symbol-library analogue of the footprint list's fp-info-cache.  It is read at
+ * chooser startup so libraries whose background parse hasn't finished can still be listed
+ * immediately, and refreshed opportunistically whenever a library's symbols are enumerated.
+ *
+ * Staleness is tracked per library with an mtime+size hash of the library file; a stale or
+ * missing entry simply means that library waits for the real parse, exactly as before.
+ */
+class SYMBOL_INFO_CACHE
+{
+public:
+    /// Read the cache file if it hasn't been read yet; safe to call repeatedly.
+    void Load();
+
+    /// Write the cache file if any library entry changed since the last read or write.
+    void SaveIfDirty();
+
+    /**
+     * Fetch the cached chooser items for a library.
+     *
+     * @param aNickname is the library nickname.
+     * @param aStamp is the current #Timestamp() of the library file.
+     * @param aItems receives the cached items; they remain owned by the cache.
+     * @return true if the cache has a fresh entry for the library.
+     */
+    bool GetLibraryItems( const wxString& aNickname, long long aStamp,
+                          std::vector<LIB_TREE_ITEM*>& aItems );
+
+    /**
+     * Replace the cached entry for a library with metadata extracted from the given (fully
+     * parsed) symbols.  A no-op if the cache is already up to date for @a aStamp.
+     */
+    void UpdateLibrary( const wxString& aNickname, long long aStamp,
+                        const std::vector<LIB_SYMBOL*>& aSymbols );
+
+    /// An mtime+size hash of the library file, 0 if it doesn't exist.
+    static long long Timestamp( const wxString& aLibraryPath );
+
+private:
+    struct LIB_ENTRY
+    {
+        long long                                 Stamp = 0;
+        std::vector<std::unique_ptr<SYMBOL_INFO>> Symbols;
+    };
+
+    static wxString cacheFilePath();
+
+    bool       m_loaded = false;
+    bool       m_dirty = false;
+    std::mutex m_mutex;
+
+    std::map<wxString, LIB_ENTRY> m_libs;
+
+    /// Superseded items are parked here rather than freed because placeholder tree nodes
+    /// may still reference them; cleared only when the cache itself is re-read.
+    std::vector<std::unique_ptr<SYMBOL_INFO>> m_retired;
+};
+
+extern SYMBOL_INFO_CACHE GSymbolInfoCache;        // KIFACE scope.
+
+#endif // SYMBOL_INFO_CACHE_H
@@ -27,6 +27,7 @@
 #include <wx/log.h>
 
 #include <lib_symbol.h>
+#include <libraries/symbol_info_cache.h>
 #include <libraries/symbol_library_adapter.h>
 
 #include <env_vars.h>
@@ -161,10 +162,42 @@ std::vector<LIB_SYMBOL*> SYMBOL_LIBRARY_ADAPTER::GetSymbols( const wxString& aNi
         symbol->SetLibId( id );
     }
 
+    // Opportunistically refresh the chooser metadata cache while we have the full parse in
+    // hand (a no-op unless the library changed on disk since the last refresh).
+    if( aType == SYMBOL_TYPE::ALL_SYMBOLS
+            && SCH_IO_MGR::EnumFromStr( lib->row->Type() ) == SCH_IO_MGR::SCH_KICAD )
+    {
+        GSymbolInfoCache.UpdateLibrary( aNickname,
+                                        SYMBOL_INFO_CACHE::Timestamp( getUri( lib->row ) ),
+                                        symbols );
+    }
+
     return symbols;
 }
 
 
+std::vector<LIB_TREE_ITEM*> SYMBOL_LIBRARY_ADAPTER::GetCachedChooserItems( const wxString& aNickname )
+{
+    std::vector<LIB_TREE_ITEM*> items;
+
+    std::optional<LIBRARY_TABLE_ROW*> row = GetRow( aNickname );
+
+    if( !row )
+        return items;
+
+    // Only file-backed KiCad libraries are cached; database and http libraries manage their
+    // own staleness and legacy libraries are rare enough to just wait for the real parse.
+    if( SCH_IO_MGR::EnumFromStr( ( *row )->Type() ) != SCH_IO_MGR::SCH_KICAD )
+        return items;
+
+    GSymbolInfoCache.Load();
+    GSymbolInfoCache.GetLibraryItems( aNickname, SYMBOL_INFO_CACHE::Timestamp( getUri( *row ) ),
+                                      items );
+
+    return items;
+}
+
+
 std::vector<wxString> SYMBOL_LIBRARY_ADAPTER::GetSymbolNames( const wxString& aNickname, SYMBOL_TYPE aType )
 {
     // TODO(JE) can we kill wxArrayString in internal API?
@@ -28,6 +28,7 @@
 #include <sch_io/sch_io.h>
 
 class LIB_SYMBOL;
+class LIB_TREE_ITEM;
 class PROJECT;
 
 
@@ -90,6 +91,13 @@ public:
     std::vector<LIB_SYMBOL*> GetSymbols( const wxString& aNickname,
                                          SYMBOL_TYPE aType = SYMBOL_TYPE::ALL_SYMBOLS );
 
+    /**
+     * Return placeholder chooser items for a library that hasn't finished loading, built
+     * from the per-user symbol metadata cache.  Returns an empty list if the library isn't
+     * file-backed or the cache is stale or missing; items remain owned by the cache.
+     */
+    std::vector<LIB_TREE_ITEM*> GetCachedChooserItems( const wxString& aNickname );
+
     std::vector<wxString> GetSymbolNames( const wxString& aNickname,
                                           SYMBOL_TYPE aType = SYMBOL_TYPE::ALL_SYMBOLS );
     /**
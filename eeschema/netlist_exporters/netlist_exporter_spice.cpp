@@ -171,6 +171,31 @@ bool NETLIST_EXPORTER_SPICE::ReadSchematicAndLibraries( unsigned aNetlistOptions
         wxRemoveFile( thisFile.GetFullPath() );
     }
 
+    // Pre-load all referenced model libraries concurrently; the per-symbol pass below is then
+    // served from the session cache instead of loading each library serially on first reference.
+    std::vector<wxString> libraryPaths;
+
+    for( const SCH_SHEET_PATH& sheet : BuildSheetList( aNetlistOptions ) )
+    {
+        for( SCH_ITEM* item : sheet.LastScreen()->Items().OfType( SCH_SYMBOL_T ) )
+        {
+            SCH_SYMBOL* symbol = static_cast<SCH_SYMBOL*>( item );
+
+            if( symbol->ResolveExcludedFromSim() )
+                continue;
+
+            if( const SCH_FIELD* field = symbol->GetField( wxString( SIM_LIBRARY::LIBRARY_FIELD ) ) )
+            {
+                wxString libraryPath = field->GetShownText( &sheet, false );
+
+                if( !libraryPath.IsEmpty() )
+                    libraryPaths.emplace_back( libraryPath );
+            }
+        }
+    }
+
+    m_libMgr.PreloadLibraries( libraryPaths, aReporter );
+
     for( SCH_SHEET_PATH& sheet : BuildSheetList( aNetlistOptions ) )
     {
         for( SCH_ITEM* item : sheet.LastScreen()->Items().OfType( SCH_SYMBOL_T ) )
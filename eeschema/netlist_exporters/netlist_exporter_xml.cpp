@@ -33,6 +33,7 @@
 #include <connection_graph.h>
 #include <pgm_base.h>
 #include <core/kicad_algo.h>
+#include <wx/sstream.h>
 #include <wx/wfstream.h>
 #include <xnode.h>      // also nests: <wx/xml/xml.h>
 #include <json_common.h>
@@ -57,10 +58,79 @@ bool NETLIST_EXPORTER_XML::WriteNetlist( const wxString& aOutFileName, unsigned
     if( !stream.IsOk() )
         return false;
 
-    wxXmlDocument xdoc;
-    xdoc.SetRoot( makeRoot( GNL_ALL | aNetlistOptions ) );
+    unsigned ctl = GNL_ALL | aNetlistOptions;
 
-    return xdoc.Save( stream, 2 /* indent bug, today was ignored by wxXml lib */ );
+    // Write the document one top-level section at a time, freeing each section's tree once
+    // it has hit the stream.  On large designs the full document tree dwarfs any single
+    // section, so this keeps peak memory bounded by the largest section rather than growing
+    // with the whole design.
+    auto writeUTF8 =
+            [&]( const wxString& aText )
+            {
+                wxScopedCharBuffer buf = aText.utf8_str();
+                stream.Write( buf.data(), buf.length() );
+            };
+
+    auto writeSection =
+            [&]( XNODE* aSection ) -> bool
+            {
+                wxXmlDocument xdoc;
+                xdoc.SetRoot( aSection );    // xdoc now owns (and will free) the section
+
+                wxStringOutputStream sectionStream;
+
+                if( !xdoc.Save( sectionStream, 2 /* indent bug, today was ignored by wxXml lib */ ) )
+                    return false;
+
+                // Strip the per-document XML declaration; only the outermost one is wanted.
+                writeUTF8( sectionStream.GetString().AfterFirst( '\n' ) );
+
+                return stream.IsOk();
+            };
+
+    writeUTF8( wxT( "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n" ) );
+    writeUTF8( wxT( "<export version=\"E\">\n" ) );
+
+    if( ctl & GNL_HEADER )
+    {
+        if( !writeSection( makeDesignHeader() ) )
+            return false;
+    }
+
+    if( ctl & GNL_SYMBOLS )
+    {
+        if( !writeSection( makeSymbols( ctl ) ) )
+            return false;
+
+        if( ctl & GNL_OPT_KICAD )
+        {
+            if( !writeSection( makeGroups() ) )
+                return false;
+        }
+    }
+
+    if( ctl & GNL_PARTS )
+    {
+        if( !writeSection( makeLibParts() ) )
+            return false;
+    }
+
+    if( ctl & GNL_LIBRARIES )
+    {
+        // must follow makeGenericLibParts()
+        if( !writeSection( makeLibraries() ) )
+            return false;
+    }
+
+    if( ctl & GNL_NETS )
+    {
+        if( !writeSection( makeListOfNets( ctl ) ) )
+            return false;
+    }
+
+    writeUTF8( wxT( "</export>\n" ) );
+
+    return stream.IsOk();
 }
 
 
@@ -402,7 +472,7 @@ XNODE* NETLIST_EXPORTER_XML::makeSymbols( unsigned aCtl )
                 xproperty->AddAttribute( wxT( "name" ), wxT( "dnp" ) );
             }
 
-            if( const std::unique_ptr<LIB_SYMBOL>& part = symbol->GetLibSymbolRef() )
+            if( const std::shared_ptr<LIB_SYMBOL>& part = symbol->GetLibSymbolRef() )
             {
                 if( part->GetKeyWords().size() )
                 {
@@ -492,7 +562,7 @@ XNODE* NETLIST_EXPORTER_XML::makeSymbols( unsigned aCtl )
             xcomp->AddChild( xunitInfo = node( wxT( "units" ) ) );
 
             // Emit all units defined by the library symbol, independent of placement
-            const std::unique_ptr<LIB_SYMBOL>& libSym = symbol->GetLibSymbolRef();
+            const std::shared_ptr<LIB_SYMBOL>& libSym = symbol->GetLibSymbolRef();
 
             if( libSym )
             {
@@ -145,19 +145,34 @@ void SCH_CONNECTION::ConfigureFromLabel( const wxString& aLabel )
     m_local_name   = aLabel;
     m_local_prefix = m_prefix;
 
-    wxString prefix;
-    std::vector<wxString> members;
-
     wxString unescaped = UnescapeString( aLabel );
 
-    if( NET_SETTINGS::ParseBusVector( unescaped, &prefix, &members ) )
+    // Parsing a bus label expands every member name, which is costly for wide vector
+    // buses, so use the graph's memoized expansion when one is available.
+    BUS_LABEL_EXPANSION        local;
+    const BUS_LABEL_EXPANSION* expansion = &local;
+
+    if( m_graph )
+    {
+        expansion = &m_graph->GetBusExpansion( unescaped );
+    }
+    else if( NET_SETTINGS::ParseBusVector( unescaped, &local.Prefix, &local.Members ) )
+    {
+        local.IsVector = true;
+    }
+    else if( NET_SETTINGS::ParseBusGroup( unescaped, &local.Prefix, &local.Members ) )
+    {
+        local.IsGroup = true;
+    }
+
+    if( expansion->IsVector )
     {
         m_type = CONNECTION_TYPE::BUS;
-        m_vector_prefix = std::move( prefix );
+        m_vector_prefix = expansion->Prefix;
 
         long i = 0;
 
-        for( const wxString& vector_member : members )
+        for( const wxString& vector_member : expansion->Members )
         {
             std::shared_ptr<SCH_CONNECTION> member = std::make_shared<SCH_CONNECTION>( m_parent, m_sheet );
 
@@ -171,8 +186,10 @@ void SCH_CONNECTION::ConfigureFromLabel( const wxString& aLabel )
             m_members.push_back( std::move( member ) );
         }
     }
-    else if( NET_SETTINGS::ParseBusGroup( unescaped, &prefix, &members ) )
+    else if( expansion->IsGroup )
     {
+        wxString prefix = expansion->Prefix;
+
         m_type       = CONNECTION_TYPE::BUS_GROUP;
         m_bus_prefix = prefix;
 
@@ -180,7 +197,7 @@ void SCH_CONNECTION::ConfigureFromLabel( const wxString& aLabel )
         if( !prefix.IsEmpty() )
             prefix += wxT( "." );
 
-        for( const wxString& group_member : members )
+        for( const wxString& group_member : expansion->Members )
         {
             // Handle alias inside bus group member list
             if( auto alias = m_graph->GetBusAlias( group_member ) )
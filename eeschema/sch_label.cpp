@@ -170,7 +170,11 @@ SCH_LABEL_BASE::SCH_LABEL_BASE( const VECTOR2I& aPos, const wxString& aText, KIC
         m_connectionType( CONNECTION_TYPE::NONE ),
         m_isDangling( true ),
         m_autoRotateOnPlacement( false ),
-        m_lastResolvedColor( COLOR4D::UNSPECIFIED )
+        m_lastResolvedColor( COLOR4D::UNSPECIFIED ),
+        m_shapeCacheShape( L_UNSPECIFIED ),
+        m_shapeCacheSpin( 0 ),
+        m_shapeCacheTextHeight( 0 ),
+        m_shapeCacheBoxWidth( 0 )
 {
     SetMultilineAllowed( false );
 
@@ -186,7 +190,11 @@ SCH_LABEL_BASE::SCH_LABEL_BASE( const SCH_LABEL_BASE& aLabel ) :
         m_isDangling( aLabel.m_isDangling ),
         m_autoRotateOnPlacement( aLabel.m_autoRotateOnPlacement ),
         m_lastResolvedColor( aLabel.m_lastResolvedColor ),
-        m_cached_driver_name( aLabel.m_cached_driver_name )
+        m_cached_driver_name( aLabel.m_cached_driver_name ),
+        m_shapeCacheShape( L_UNSPECIFIED ),
+        m_shapeCacheSpin( 0 ),
+        m_shapeCacheTextHeight( 0 ),
+        m_shapeCacheBoxWidth( 0 )
 {
     SetMultilineAllowed( false );
 
@@ -1100,6 +1108,41 @@ std::vector<int> SCH_LABEL_BASE::ViewGetLayers() const
 }
 
 
+const std::vector<VECTOR2I>& SCH_LABEL_BASE::GetCachedGraphicShape( const RENDER_SETTINGS* aSettings,
+                                                                   const VECTOR2I& aPos ) const
+{
+    int spin = (int) GetSpinStyle();
+
+    // GetTextBox() is itself cached in EDA_TEXT, so this comparison is cheap; it folds the
+    // render settings, font and shown text into a single parameter.
+    int boxWidth = GetTextBox( aSettings ).GetWidth();
+
+    if( m_shapeCache.empty()
+            || aPos != m_shapeCachePos
+            || m_shape != m_shapeCacheShape
+            || spin != m_shapeCacheSpin
+            || GetTextHeight() != m_shapeCacheTextHeight
+            || boxWidth != m_shapeCacheBoxWidth )
+    {
+        CreateGraphicShape( aSettings, m_shapeCache, aPos );
+        m_shapeCachePos = aPos;
+        m_shapeCacheShape = m_shape;
+        m_shapeCacheSpin = spin;
+        m_shapeCacheTextHeight = GetTextHeight();
+        m_shapeCacheBoxWidth = boxWidth;
+    }
+
+    return m_shapeCache;
+}
+
+
+void SCH_LABEL_BASE::ClearRenderCache()
+{
+    EDA_TEXT::ClearRenderCache();
+    m_shapeCache.clear();
+}
+
+
 int SCH_LABEL_BASE::GetLabelBoxExpansion( const RENDER_SETTINGS* aSettings ) const
 {
     double ratio;
@@ -2390,7 +2433,7 @@ HTML_MESSAGE_BOX* SCH_TEXT::ShowSyntaxHelp( wxWindow* aParentWindow )
     dlg->SetDialogSizeInDU( sz.x, sz.y );
 
     wxString html_txt;
-    ConvertMarkdown2Html( wxGetTranslation( msg ), html_txt );
+    ConvertMarkdown2HtmlCached( wxGetTranslation( msg ), html_txt );
     dlg->AddHTML_Text( html_txt );
     dlg->ShowModeless();
 
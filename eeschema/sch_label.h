@@ -310,6 +310,19 @@ public:
         aPoints.clear();
     }
 
+    /**
+     * Return the graphic shape for the label, recomputing it only when the parameters it
+     * depends on have changed since the last call.
+     *
+     * Text edits invalidate the cache through ClearRenderCache(); position, shape, spin
+     * style, text size and render settings are compared on each call.  Callers that need
+     * a one-shot shape (plotting, hit-testing) should use CreateGraphicShape() directly.
+     */
+    const std::vector<VECTOR2I>& GetCachedGraphicShape( const RENDER_SETTINGS* aSettings,
+                                                        const VECTOR2I& aPos ) const;
+
+    void ClearRenderCache() override;
+
     int GetLabelBoxExpansion( const RENDER_SETTINGS* aSettings = nullptr ) const;
 
     /**
@@ -383,6 +396,13 @@ protected:
     mutable COLOR4D         m_lastResolvedColor;
 
     wxString                m_cached_driver_name;
+
+    mutable std::vector<VECTOR2I> m_shapeCache;            ///< Cached CreateGraphicShape() result.
+    mutable VECTOR2I              m_shapeCachePos;
+    mutable LABEL_FLAG_SHAPE      m_shapeCacheShape;
+    mutable int                   m_shapeCacheSpin;
+    mutable int                   m_shapeCacheTextHeight;
+    mutable int                   m_shapeCacheBoxWidth;
 };
 
 
@@ -471,7 +491,7 @@ public:
     void SetFlagShape( FLAG_SHAPE aShape )   { m_shape = (LABEL_FLAG_SHAPE) aShape; }
 
     int GetPinLength() const         { return m_pinLength; }
-    void SetPinLength( int aLength ) { m_pinLength = aLength; }
+    void SetPinLength( int aLength ) { m_pinLength = aLength; m_shapeCache.clear(); }
 
     int GetPenWidth() const override;
 
@@ -1102,6 +1102,16 @@ std::vector<VECTOR3I> SCH_LINE::BuildWireWithHopShape( const SCH_SCREEN* aScreen
         return wire_shape;
     }
 
+    if( !m_hopShapeCache.empty()
+            && m_hopCacheScreen == aScreen
+            && m_hopCacheVersion == aScreen->GetWireGraphVersion()
+            && m_hopCacheRadius == aArcRadius
+            && m_hopCacheStart == m_start
+            && m_hopCacheEnd == m_end )
+    {
+        return m_hopShapeCache;
+    }
+
     std::vector<SCH_LINE*> existingWires;   // wires to test (candidates)
     std::vector<VECTOR2I> intersections;
 
@@ -1215,7 +1225,14 @@ std::vector<VECTOR3I> SCH_LINE::BuildWireWithHopShape( const SCH_SCREEN* aScreen
         wire_shape.emplace_back( GetEndPoint().x, GetEndPoint().y, 0 );
     }
 
-    return wire_shape;
+    m_hopShapeCache = std::move( wire_shape );
+    m_hopCacheScreen = aScreen;
+    m_hopCacheVersion = aScreen->GetWireGraphVersion();
+    m_hopCacheRadius = aArcRadius;
+    m_hopCacheStart = m_start;
+    m_hopCacheEnd = m_end;
+
+    return m_hopShapeCache;
 }
 
 
@@ -397,6 +397,16 @@ private:
     mutable int        m_lastResolvedWidth;
     mutable COLOR4D    m_lastResolvedColor;
 
+    // BuildWireWithHopShape() queries the screen for crossing wires, which is too expensive
+    // to redo on every redraw of every wire; the result is kept until the screen's wire
+    // graph, our endpoints or the arc radius change.
+    mutable std::vector<VECTOR3I> m_hopShapeCache;
+    mutable const SCH_SCREEN*     m_hopCacheScreen = nullptr;
+    mutable int                   m_hopCacheVersion = 0;
+    mutable double                m_hopCacheRadius = 0.0;
+    mutable VECTOR2I              m_hopCacheStart;
+    mutable VECTOR2I              m_hopCacheEnd;
+
     wxString           m_operatingPoint;
 };
 
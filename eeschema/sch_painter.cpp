@@ -3020,11 +3020,10 @@ void SCH_PAINTER::draw( const SCH_GLOBALLABEL* aLabel, int aLayer, bool aDimmed
         return;
     }
 
-    std::vector<VECTOR2I> pts;
+    const std::vector<VECTOR2I>& pts = aLabel->GetCachedGraphicShape( &m_schSettings,
+                                                                      aLabel->GetTextPos() );
     std::deque<VECTOR2D> pts2;
 
-    aLabel->CreateGraphicShape( &m_schSettings, pts, aLabel->GetTextPos() );
-
     for( const VECTOR2I& p : pts )
         pts2.emplace_back( VECTOR2D( p.x, p.y ) );
 
@@ -3122,11 +3121,10 @@ void SCH_PAINTER::draw( const SCH_HIERLABEL* aLabel, int aLayer, bool aDimmed )
         return;
     }
 
-    std::vector<VECTOR2I> i_pts;
+    const std::vector<VECTOR2I>& i_pts =
+            aLabel->GetCachedGraphicShape( &m_schSettings, (VECTOR2I) aLabel->GetTextPos() );
     std::deque<VECTOR2D>  d_pts;
 
-    aLabel->CreateGraphicShape( &m_schSettings, i_pts, (VECTOR2I)aLabel->GetTextPos() );
-
     for( const VECTOR2I& i_pt : i_pts )
         d_pts.emplace_back( VECTOR2D( i_pt.x, i_pt.y ) );
 
@@ -3177,11 +3175,10 @@ void SCH_PAINTER::draw( const SCH_DIRECTIVE_LABEL* aLabel, int aLayer, bool aDim
         return;
     }
 
-    std::vector<VECTOR2I> pts;
+    const std::vector<VECTOR2I>& pts = aLabel->GetCachedGraphicShape( &m_schSettings,
+                                                                      aLabel->GetTextPos() );
     std::deque<VECTOR2D> pts2;
 
-    aLabel->CreateGraphicShape( &m_schSettings, pts, aLabel->GetTextPos() );
-
     for( const VECTOR2I& p : pts )
         pts2.emplace_back( VECTOR2D( p.x, p.y ) );
 
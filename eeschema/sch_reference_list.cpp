@@ -34,6 +34,7 @@
 #include <wx/regex.h>
 #include <algorithm>
 #include <vector>
+#include <unordered_map>
 #include <unordered_set>
 
 #include <string_utils.h>
@@ -436,6 +437,56 @@ void SCH_REFERENCE_LIST::Annotate( bool aUseSheetNum, int aSheetIntervalId, int
 
     int LastReferenceNumber = 0;
 
+    // Index the flat list up front so the allocation loop below scales near-linearly with
+    // symbol count instead of rescanning the whole list for every symbol:
+    //  - the reference numbers already in use for each prefix, kept up to date as new numbers
+    //    are handed out;
+    //  - the flat list position of each symbol instance, for propagating locked multi-unit
+    //    annotations;
+    //  - the locked reference list (if any) owning each symbol instance.
+    std::unordered_map<wxString, std::map<int, std::vector<SCH_REFERENCE>>> usedNumbersByPrefix;
+
+    for( const SCH_REFERENCE& ref : m_flatList )
+    {
+        if( !ref.m_isNew )
+            usedNumbersByPrefix[ ref.GetRef().Lower() ][ ref.m_numRef ].push_back( ref );
+    }
+
+    auto markUsed =
+            [&]( const SCH_REFERENCE& aUsedRef )
+            {
+                usedNumbersByPrefix[ aUsedRef.GetRef().Lower() ][ aUsedRef.m_numRef ].push_back( aUsedRef );
+            };
+
+    auto nextUnusedReference =
+            [&]( const SCH_REFERENCE& aRef, int aMinVal, const std::vector<int>& aRequiredUnits )
+            {
+                return m_refDesTracker->GetNextRefDesForUnits( aRef,
+                                                               usedNumbersByPrefix[ aRef.GetRef().Lower() ],
+                                                               aRequiredUnits, aMinVal );
+            };
+
+    // Instances are identified by symbol and sheet path; see SCH_REFERENCE::IsSameInstance().
+    using INSTANCE_KEY = std::pair<const SCH_SYMBOL*, wxString>;
+
+    auto instanceKey =
+            []( const SCH_REFERENCE& aRef ) -> INSTANCE_KEY
+            {
+                return { aRef.GetSymbol(), aRef.GetSheetPath().Path().AsString() };
+            };
+
+    std::map<INSTANCE_KEY, unsigned>                  instancePos;
+    std::map<INSTANCE_KEY, const SCH_REFERENCE_LIST*> lockedListByInstance;
+
+    for( unsigned ii = 0; ii < m_flatList.size(); ii++ )
+        instancePos[ instanceKey( m_flatList[ii] ) ] = ii;
+
+    for( const SCH_MULTI_UNIT_REFERENCE_MAP::value_type& pair : aLockedUnitMap )
+    {
+        for( unsigned lockedI = 0; lockedI < pair.second.GetCount(); ++lockedI )
+            lockedListByInstance[ instanceKey( pair.second[lockedI] ) ] = &pair.second;
+    }
+
     /* calculate index of the first symbol with the same reference prefix
      * than the current symbol.  All symbols having the same reference
      * prefix will receive a reference number with consecutive values:
@@ -463,24 +514,10 @@ void SCH_REFERENCE_LIST::Annotate( bool aUseSheetNum, int aSheetIntervalId, int
         // Check whether this symbol is in aLockedUnitMap.
         const SCH_REFERENCE_LIST* lockedList = nullptr;
 
-        for( const SCH_MULTI_UNIT_REFERENCE_MAP::value_type& pair : aLockedUnitMap )
-        {
-            unsigned n_refs = pair.second.GetCount();
-
-            for( unsigned thisRefI = 0; thisRefI < n_refs; ++thisRefI )
-            {
-                const SCH_REFERENCE &thisRef = pair.second[thisRefI];
-
-                if( thisRef.IsSameInstance( ref_unit ) )
-                {
-                    lockedList = &pair.second;
-                    break;
-                }
-            }
+        auto lockedIt = lockedListByInstance.find( instanceKey( ref_unit ) );
 
-            if( lockedList != nullptr )
-                break;
-        }
+        if( lockedIt != lockedListByInstance.end() )
+            lockedList = lockedIt->second;
 
         if(  ( m_flatList[first].CompareRef( ref_unit ) != 0 )
           || ( aUseSheetNum && ( m_flatList[first].m_sheetNum != ref_unit.m_sheetNum ) )  )
@@ -506,9 +543,10 @@ void SCH_REFERENCE_LIST::Annotate( bool aUseSheetNum, int aSheetIntervalId, int
         {
             if( ref_unit.m_isNew )
             {
-                LastReferenceNumber = FindFirstUnusedReference( ref_unit, minRefId, {} );
+                LastReferenceNumber = nextUnusedReference( ref_unit, minRefId, {} );
                 ref_unit.m_numRef = LastReferenceNumber;
                 ref_unit.m_numRefStr = ref_unit.formatRefStr( LastReferenceNumber );
+                markUsed( ref_unit );
             }
 
             ref_unit.m_flag  = 1;
@@ -525,11 +563,12 @@ void SCH_REFERENCE_LIST::Annotate( bool aUseSheetNum, int aSheetIntervalId, int
 
             if( ref_unit.m_isNew )
             {
-                LastReferenceNumber = FindFirstUnusedReference( ref_unit, minRefId, units );
+                LastReferenceNumber = nextUnusedReference( ref_unit, minRefId, units );
                 ref_unit.m_numRef = LastReferenceNumber;
                 ref_unit.m_numRefStr = ref_unit.formatRefStr( LastReferenceNumber );
                 ref_unit.m_isNew = false;
                 ref_unit.m_flag = 1;
+                markUsed( ref_unit );
             }
 
             for( unsigned lockedRefI = 0; lockedRefI < n_refs; ++lockedRefI )
@@ -552,11 +591,11 @@ void SCH_REFERENCE_LIST::Annotate( bool aUseSheetNum, int aSheetIntervalId, int
                     continue;
 
                 // Find the matching symbol
-                for( unsigned jj = ii + 1; jj < m_flatList.size(); jj++ )
-                {
-                    if( !lockedRef.IsSameInstance( m_flatList[jj] ) )
-                        continue;
+                auto posIt = instancePos.find( instanceKey( lockedRef ) );
 
+                if( posIt != instancePos.end() && posIt->second > ii )
+                {
+                    unsigned jj = posIt->second;
                     wxString ref_candidate = buildFullReference( ref_unit, lockedRef.m_unit );
 
                     // propagate the new reference and unit selection to the "old" symbol,
@@ -568,10 +607,10 @@ void SCH_REFERENCE_LIST::Annotate( bool aUseSheetNum, int aSheetIntervalId, int
                         m_flatList[jj].m_numRefStr = ref_unit.m_numRefStr;
                         m_flatList[jj].m_isNew = false;
                         m_flatList[jj].m_flag = 1;
+                        markUsed( m_flatList[jj] );
 
                         // lock this new full reference
                         inUseRefs.insert( ref_candidate );
-                        break;
                     }
                 }
             }
@@ -582,11 +621,12 @@ void SCH_REFERENCE_LIST::Annotate( bool aUseSheetNum, int aSheetIntervalId, int
             // know what group this might belong to, so just find the first unused reference for
             // this specific unit. The other units will be annotated in the following passes.
             std::vector<int> units = { ref_unit.GetUnit() };
-            LastReferenceNumber = FindFirstUnusedReference( ref_unit, minRefId, units );
+            LastReferenceNumber = nextUnusedReference( ref_unit, minRefId, units );
             ref_unit.m_numRef = LastReferenceNumber;
             ref_unit.m_numRefStr = ref_unit.formatRefStr( LastReferenceNumber );
             ref_unit.m_isNew = false;
             ref_unit.m_flag = 1;
+            markUsed( ref_unit );
         }
     }
 
@@ -24,6 +24,7 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
  */
 
+#include <map>
 #include <stack>
 #include <vector>
 #include <wx/filefn.h>
@@ -87,6 +88,7 @@ SCH_SCREEN::SCH_SCREEN( EDA_ITEM* aParent ) :
     m_fileExists( false )
 {
     m_modification_sync = 0;
+    m_wireGraphVersion = 0;
     m_refCount = 0;
     m_zoomInitialized = false;
     m_LastZoomLevel = 1.0;
@@ -268,6 +270,9 @@ void SCH_SCREEN::Append( SCH_ITEM* aItem, bool aUpdateLibSymbol )
 
         m_rtree.insert( aItem );
         --m_modification_sync;
+
+        if( aItem->Type() == SCH_LINE_T )
+            ++m_wireGraphVersion;
     }
 }
 
@@ -334,6 +339,9 @@ bool SCH_SCREEN::Remove( SCH_ITEM* aItem, bool aUpdateLibSymbol )
 {
     bool retv = m_rtree.remove( aItem );
 
+    if( retv && aItem->Type() == SCH_LINE_T )
+        ++m_wireGraphVersion;
+
     // Check if the library symbol for the removed schematic symbol is still required.
     if( retv && aItem->Type() == SCH_SYMBOL_T && aUpdateLibSymbol )
     {
@@ -728,6 +736,9 @@ void SCH_SCREEN::UpdateSymbolLinks( REPORTER* aReporter )
     // Clear all existing symbol links.
     clearLibSymbols();
 
+    // One flattened copy per library symbol, shared by all of its instances.
+    std::map<wxString, std::shared_ptr<LIB_SYMBOL>> sharedLibSymbols;
+
     for( SCH_SYMBOL* symbol : symbols )
     {
         LIB_SYMBOL* tmp = nullptr;
@@ -746,8 +757,14 @@ void SCH_SCREEN::UpdateSymbolLinks( REPORTER* aReporter )
                 aReporter->ReportTail( msg, RPT_SEVERITY_INFO );
             }
 
-            // Internal library symbols are already flattened so just make a copy.
-            symbol->SetLibSymbol( new LIB_SYMBOL( *it->second ) );
+            // Internal library symbols are already flattened so just share one copy
+            // between all instances of the symbol.
+            std::shared_ptr<LIB_SYMBOL>& shared = sharedLibSymbols[ symbol->GetSchSymbolLibraryName() ];
+
+            if( !shared )
+                shared = std::make_shared<LIB_SYMBOL>( *it->second );
+
+            symbol->SetLibSymbol( shared );
             continue;
         }
 
@@ -866,17 +883,28 @@ void SCH_SCREEN::UpdateLocalLibSymbolLinks()
     for( SCH_ITEM* item : Items().OfType( SCH_SYMBOL_T ) )
         symbols.push_back( static_cast<SCH_SYMBOL*>( item ) );
 
+    // One flattened copy per library symbol, shared by all of its instances.
+    std::map<wxString, std::shared_ptr<LIB_SYMBOL>> sharedLibSymbols;
+
     for( SCH_SYMBOL* symbol : symbols )
     {
         // Changing the symbol may adjust the bbox of the symbol; remove and reinsert it afterwards.
         m_rtree.remove( symbol );
 
         auto it = m_libSymbols.find( symbol->GetSchSymbolLibraryName() );
+        std::shared_ptr<LIB_SYMBOL> libSymbol;
 
         if( it != m_libSymbols.end() )
-            symbol->SetLibSymbol( new LIB_SYMBOL( *it->second ) );
-        else
-            symbol->SetLibSymbol( nullptr );
+        {
+            std::shared_ptr<LIB_SYMBOL>& shared = sharedLibSymbols[ symbol->GetSchSymbolLibraryName() ];
+
+            if( !shared )
+                shared = std::make_shared<LIB_SYMBOL>( *it->second );
+
+            libSymbol = shared;
+        }
+
+        symbol->SetLibSymbol( std::move( libSymbol ) );
 
         m_rtree.insert( symbol );
     }
@@ -122,6 +122,13 @@ public:
         return m_rtree.empty();
     }
 
+    /**
+     * @return a counter bumped whenever a line is added to or removed from the screen; used
+     *         to invalidate cached wire crossing (hop over) shapes.  See
+     *         SCH_LINE::BuildWireWithHopShape().
+     */
+    int GetWireGraphVersion() const { return m_wireGraphVersion; }
+
     bool HasItems( KICAD_T aItemType ) const;
 
     bool HasSheets() const { return HasItems( SCH_SHEET_T ); }
@@ -677,6 +684,9 @@ private:
     int         m_modification_sync;        // Inequality with SYMBOL_LIBS::GetModificationHash()
                                             // will trigger ResolveAll().
 
+    int         m_wireGraphVersion;         // Bumped when lines are added or removed; see
+                                            // GetWireGraphVersion().
+
     bool        m_zoomInitialized;          // Set to true once the zoom value is initialized with
                                             // `InitZoom()`.
 
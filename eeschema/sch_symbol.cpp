@@ -159,8 +159,10 @@ SCH_SYMBOL::SCH_SYMBOL( const SCH_SYMBOL& aSymbol ) :
         m_pins.back()->SetParent( this );
     }
 
+    // Share the library symbol between the copies; edits replace it wholesale via
+    // SetLibSymbol() so the copy-on-write contract holds.
     if( aSymbol.m_part )
-        SetLibSymbol( new LIB_SYMBOL( *aSymbol.m_part ) );
+        SetLibSymbol( aSymbol.m_part );
 
     m_fieldsAutoplaced = aSymbol.m_fieldsAutoplaced;
     m_schLibSymbolName = aSymbol.m_schLibSymbolName;
@@ -265,6 +267,21 @@ void SCH_SYMBOL::SetLibSymbol( LIB_SYMBOL* aLibSymbol )
 }
 
 
+void SCH_SYMBOL::SetLibSymbol( std::shared_ptr<LIB_SYMBOL> aLibSymbol )
+{
+    wxCHECK2( !aLibSymbol || aLibSymbol->IsRoot(), aLibSymbol.reset() );
+
+    m_part = std::move( aLibSymbol );
+
+    // We've just reset the library symbol, so the lib_pins, which were just
+    // pointers to the old symbol, need to be cleared.
+    for( auto& pin : m_pins )
+        pin->SetLibPin( nullptr );
+
+    UpdatePins();
+}
+
+
 wxString SCH_SYMBOL::GetDescription() const
 {
     if( m_part )
@@ -1472,10 +1489,8 @@ void SCH_SYMBOL::swapData( SCH_ITEM* aItem )
     for( std::unique_ptr<SCH_PIN>& pin : m_pins )
         pin->SetParent( this );
 
-    LIB_SYMBOL* libSymbol = symbol->m_part.release();
-    symbol->m_part = std::move( m_part );
+    std::swap( m_part, symbol->m_part );
     symbol->UpdatePins();
-    m_part.reset( libSymbol );
     UpdatePins();
 
     std::swap( m_pos, symbol->m_pos );
@@ -2288,12 +2303,15 @@ BITMAPS SCH_SYMBOL::GetMenuImage() const
 
 EMBEDDED_FILES* SCH_SYMBOL::GetEmbeddedFiles()
 {
-    std::unique_ptr<LIB_SYMBOL>& libSymbolRef = GetLibSymbolRef();
-
-    if( !libSymbolRef )
+    if( !m_part )
         return nullptr;
 
-    return GetLibSymbolRef()->GetEmbeddedFiles();
+    // Embedded file edits must not leak into other instances sharing this library symbol,
+    // so give this instance its own copy before handing out the mutable file table.
+    if( m_part.use_count() > 1 )
+        SetLibSymbol( new LIB_SYMBOL( *m_part ) );
+
+    return m_part->GetEmbeddedFiles();
 }
 
 
@@ -2690,7 +2708,7 @@ SCH_SYMBOL& SCH_SYMBOL::operator=( const SCH_SYMBOL& aSymbol )
         SYMBOL::operator=( aSymbol );
 
         m_lib_id    = aSymbol.m_lib_id;
-        m_part.reset( aSymbol.m_part ? new LIB_SYMBOL( *aSymbol.m_part ) : nullptr );
+        m_part      = aSymbol.m_part;       // shared; copied on write via SetLibSymbol()
         m_pos       = aSymbol.m_pos;
         m_unit      = aSymbol.m_unit;
         m_bodyStyle = aSymbol.m_bodyStyle;
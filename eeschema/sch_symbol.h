@@ -181,8 +181,14 @@ public:
     wxString GetSchSymbolLibraryName() const;
     bool UseLibIdLookup() const { return m_schLibSymbolName.IsEmpty(); }
 
-    std::unique_ptr< LIB_SYMBOL >& GetLibSymbolRef() { return m_part; }
-    const std::unique_ptr< LIB_SYMBOL >& GetLibSymbolRef() const { return m_part; }
+    /**
+     * The library symbol may be shared by any number of schematic symbols (see
+     * #SetLibSymbol( std::shared_ptr<LIB_SYMBOL> )), so it must not be modified in place.
+     * To change the library symbol of a single instance, make a copy (or flatten a new
+     * one) and hand it to #SetLibSymbol().
+     */
+    std::shared_ptr<LIB_SYMBOL>& GetLibSymbolRef() { return m_part; }
+    const std::shared_ptr<LIB_SYMBOL>& GetLibSymbolRef() const { return m_part; }
 
     /**
      * Set this schematic symbol library symbol reference to \a aLibSymbol
@@ -202,6 +208,17 @@ public:
      */
     void SetLibSymbol( LIB_SYMBOL* aLibSymbol );
 
+    /**
+     * Share the library symbol \a aLibSymbol with this schematic symbol.
+     *
+     * Schematics commonly instantiate the same library symbol hundreds of times, so
+     * sharing the flattened copy between instances keeps a single set of drawing
+     * primitives in memory rather than one per instance.  A shared library symbol must
+     * be treated as immutable; to edit it for a single instance, give that instance its
+     * own copy via the #LIB_SYMBOL pointer overload above (copy-on-write).
+     */
+    void SetLibSymbol( std::shared_ptr<LIB_SYMBOL> aLibSymbol );
+
     /**
      * @return the associated LIB_SYMBOL's description field (or wxEmptyString).
      */
@@ -931,8 +948,9 @@ private:
 
     std::vector<SCH_FIELD>      m_fields;        ///< Variable length list of fields.
 
-    std::unique_ptr<LIB_SYMBOL> m_part;          ///< A flattened copy of the #LIB_SYMBOL from the
-                                                 ///< #PROJECT object's libraries.
+    std::shared_ptr<LIB_SYMBOL> m_part;          ///< A flattened copy of the #LIB_SYMBOL from the
+                                                 ///<   #PROJECT object's libraries, possibly shared
+                                                 ///<   with other instances of the same symbol.
     bool                        m_isInNetlist;   ///< True if the symbol should appear in netlist
 
     std::vector<std::unique_ptr<SCH_PIN>>  m_pins;     ///< A #SCH_PIN for every #LIB_PIN.
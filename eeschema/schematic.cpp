@@ -46,6 +46,7 @@
 #include <sch_rule_area.h>
 #include <sch_screen.h>
 #include <sch_sheet_pin.h>
+#include <sch_symbol.h>
 #include <sch_selection_tool.h>
 #include <sim/spice_settings.h>
 #include <sim/spice_value.h>
@@ -160,6 +161,8 @@ void SCHEMATIC::Reset()
     m_currentSheet->clear();
 
     m_busAliases.clear();
+
+    invalidateSheetList();
 }
 
 
@@ -351,6 +354,7 @@ void SCHEMATIC::SetRoot( SCH_SHEET* aRootSheet )
     if( m_project )
     {
         m_hierarchy = BuildSheetListSortedByPageNumbers();
+        invalidateSheetList();
         m_connectionGraph->Reset();
 
         // Build screen list from root (which now has a screen)
@@ -388,6 +392,206 @@ SCH_SHEET_LIST SCHEMATIC::Hierarchy() const
 void SCHEMATIC::RefreshHierarchy()
 {
     m_hierarchy = BuildSheetListSortedByPageNumbers();
+    invalidateSheetList();
+}
+
+
+void SCHEMATIC::rebuildItemCaches() const
+{
+    m_itemCachePaths.clear();
+    m_itemById.clear();
+    m_symbolsByRef.clear();
+    m_itemCachePathIdx.clear();
+
+    for( const SCH_SHEET_PATH& sheet : GetUnorderedSheets() )
+    {
+        m_itemCachePaths.push_back( sheet );
+        int pathIdx = (int) m_itemCachePaths.size() - 1;
+
+        // A screen reached through several sheet instances is marked shared (-1) so the
+        // incremental updaters know to fall back to a full rebuild for its items.
+        if( !m_itemCachePathIdx.try_emplace( sheet.LastScreen(), pathIdx ).second )
+            m_itemCachePathIdx[ sheet.LastScreen() ] = -1;
+
+        for( SCH_ITEM* item : sheet.LastScreen()->Items() )
+        {
+            // Screens shared between sheet instances carry the same items on several paths;
+            // keep the first path found to match SCH_SHEET_LIST::ResolveItem().
+            m_itemById.try_emplace( item->m_Uuid, std::make_pair( item, pathIdx ) );
+
+            item->RunOnChildren(
+                    [&]( SCH_ITEM* aChild )
+                    {
+                        m_itemById.try_emplace( aChild->m_Uuid, std::make_pair( aChild, pathIdx ) );
+                    },
+                    RECURSE_MODE::NO_RECURSE );
+
+            if( item->Type() == SCH_SYMBOL_T )
+            {
+                SCH_SYMBOL* symbol = static_cast<SCH_SYMBOL*>( item );
+
+                m_symbolsByRef[ symbol->GetRef( &sheet ).Upper() ].emplace_back( symbol, pathIdx );
+            }
+        }
+    }
+
+    m_itemCachesValid = true;
+}
+
+
+void SCHEMATIC::itemCachesAdd( const std::vector<SCH_ITEM*>& aItems )
+{
+    if( !m_itemCachesValid )
+        return;
+
+    for( SCH_ITEM* item : aItems )
+    {
+        SCH_SCREEN* screen = nullptr;
+
+        if( item->GetParent() && item->GetParent()->Type() == SCH_SCREEN_T )
+            screen = static_cast<SCH_SCREEN*>( item->GetParent() );
+
+        auto pathIt = screen ? m_itemCachePathIdx.find( screen )
+                             : m_itemCachePathIdx.end();
+
+        // An item on a screen we haven't indexed (or that can't reach its screen) means the
+        // hierarchy shifted under us, and an item on a shared screen belongs to every path
+        // using that screen; both cases fall back to a full rebuild on next lookup.
+        if( pathIt == m_itemCachePathIdx.end() || pathIt->second < 0 )
+        {
+            InvalidateItemCaches();
+            return;
+        }
+
+        int pathIdx = pathIt->second;
+
+        m_itemById.try_emplace( item->m_Uuid, std::make_pair( item, pathIdx ) );
+
+        item->RunOnChildren(
+                [&]( SCH_ITEM* aChild )
+                {
+                    m_itemById.try_emplace( aChild->m_Uuid, std::make_pair( aChild, pathIdx ) );
+                },
+                RECURSE_MODE::NO_RECURSE );
+
+        if( item->Type() == SCH_SYMBOL_T )
+        {
+            SCH_SYMBOL* symbol = static_cast<SCH_SYMBOL*>( item );
+
+            m_symbolsByRef[ symbol->GetRef( &m_itemCachePaths[pathIdx] ).Upper() ]
+                    .emplace_back( symbol, pathIdx );
+        }
+    }
+}
+
+
+void SCHEMATIC::itemCachesRemove( const std::vector<SCH_ITEM*>& aItems )
+{
+    if( !m_itemCachesValid )
+        return;
+
+    for( SCH_ITEM* item : aItems )
+    {
+        auto it = m_itemById.find( item->m_Uuid );
+
+        if( it == m_itemById.end() )
+            continue;
+
+        int pathIdx = it->second.second;
+
+        // Symbols on shared screens are indexed once per instance path; unpicking that
+        // incrementally isn't worth the bookkeeping, so rebuild instead.
+        if( item->Type() == SCH_SYMBOL_T )
+        {
+            auto pathIt = m_itemCachePathIdx.find( m_itemCachePaths[pathIdx].LastScreen() );
+
+            if( pathIt == m_itemCachePathIdx.end() || pathIt->second < 0 )
+            {
+                InvalidateItemCaches();
+                return;
+            }
+        }
+
+        m_itemById.erase( it );
+
+        item->RunOnChildren(
+                [&]( SCH_ITEM* aChild )
+                {
+                    m_itemById.erase( aChild->m_Uuid );
+                },
+                RECURSE_MODE::NO_RECURSE );
+
+        if( item->Type() == SCH_SYMBOL_T )
+        {
+            SCH_SYMBOL* symbol = static_cast<SCH_SYMBOL*>( item );
+            wxString    ref = symbol->GetRef( &m_itemCachePaths[pathIdx] ).Upper();
+            size_t      erased = 0;
+
+            auto refIt = m_symbolsByRef.find( ref );
+
+            if( refIt != m_symbolsByRef.end() )
+            {
+                erased = std::erase_if( refIt->second,
+                                        [&]( const std::pair<SCH_SYMBOL*, int>& aEntry )
+                                        {
+                                            return aEntry.first == symbol;
+                                        } );
+
+                if( refIt->second.empty() )
+                    m_symbolsByRef.erase( refIt );
+            }
+
+            // Indexed under a reference we can no longer compute; don't leave the dangling
+            // pointer behind.
+            if( erased == 0 )
+            {
+                InvalidateItemCaches();
+                return;
+            }
+        }
+    }
+}
+
+
+SCH_ITEM* SCHEMATIC::ResolveItem( const KIID& aID, SCH_SHEET_PATH* aPathOut,
+                                  bool aAllowNullptrReturn ) const
+{
+    if( !m_itemCachesValid )
+        rebuildItemCaches();
+
+    auto it = m_itemById.find( aID );
+
+    if( it != m_itemById.end() )
+    {
+        if( aPathOut )
+            *aPathOut = m_itemCachePaths[ it->second.second ];
+
+        return it->second.first;
+    }
+
+    // Cache miss: fall back to the walk, which also supplies the DELETED_SHEET_ITEM
+    // placeholder semantics when the weak reference has been deleted.
+    return GetUnorderedSheets().ResolveItem( aID, aPathOut, aAllowNullptrReturn );
+}
+
+
+std::vector<std::pair<SCH_SYMBOL*, SCH_SHEET_PATH>>
+SCHEMATIC::GetSymbolsByReference( const wxString& aReference ) const
+{
+    if( !m_itemCachesValid )
+        rebuildItemCaches();
+
+    std::vector<std::pair<SCH_SYMBOL*, SCH_SHEET_PATH>> symbols;
+
+    auto it = m_symbolsByRef.find( aReference.Upper() );
+
+    if( it != m_symbolsByRef.end() )
+    {
+        for( const auto& [symbol, pathIdx] : it->second )
+            symbols.emplace_back( symbol, m_itemCachePaths[ pathIdx ] );
+    }
+
+    return symbols;
 }
 
 
@@ -1087,20 +1291,45 @@ void SCHEMATIC::FixupJunctionsAfterImport()
 }
 
 
+static bool containsSheet( const std::vector<SCH_ITEM*>& aItems )
+{
+    return std::any_of( aItems.begin(), aItems.end(),
+                        []( const SCH_ITEM* aItem )
+                        {
+                            return aItem->Type() == SCH_SHEET_T;
+                        } );
+}
+
+
 void SCHEMATIC::OnItemsAdded( std::vector<SCH_ITEM*>& aNewItems )
 {
+    if( containsSheet( aNewItems ) )
+        invalidateSheetList();      // also invalidates the item caches
+    else
+        itemCachesAdd( aNewItems );
+
     InvokeListeners( &SCHEMATIC_LISTENER::OnSchItemsAdded, *this, aNewItems );
 }
 
 
 void SCHEMATIC::OnItemsRemoved( std::vector<SCH_ITEM*>& aRemovedItems )
 {
+    if( containsSheet( aRemovedItems ) )
+        invalidateSheetList();      // also invalidates the item caches
+    else
+        itemCachesRemove( aRemovedItems );
+
     InvokeListeners( &SCHEMATIC_LISTENER::OnSchItemsRemoved, *this, aRemovedItems );
 }
 
 
 void SCHEMATIC::OnItemsChanged( std::vector<SCH_ITEM*>& aItems )
 {
+    InvalidateItemCaches();
+
+    if( containsSheet( aItems ) )
+        invalidateSheetList();
+
     InvokeListeners( &SCHEMATIC_LISTENER::OnSchItemsChanged, *this, aItems );
 }
 
@@ -1972,6 +2201,18 @@ SCH_SHEET_LIST SCHEMATIC::BuildUnorderedSheetList() const
 }
 
 
+const SCH_SHEET_LIST& SCHEMATIC::GetUnorderedSheets() const
+{
+    if( !m_sheetListValid )
+    {
+        m_cachedSheetList = BuildUnorderedSheetList();
+        m_sheetListValid = true;
+    }
+
+    return m_cachedSheetList;
+}
+
+
 wxArrayString SCHEMATIC::GetVariantNamesForUI() const
 {
     wxArrayString variantNames;
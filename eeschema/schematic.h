@@ -24,6 +24,7 @@
 #include <embedded_files.h>
 #include <schematic_holder.h>
 #include <sch_sheet_path.h>
+#include <unordered_map>
 #include <schematic_settings.h>
 #include <project.h>
 
@@ -38,6 +39,7 @@ class SCH_LINE;
 class SCH_SCREEN;
 class SCH_SHEET;
 class SCH_SHEET_LIST;
+class SCH_SYMBOL;
 class SCH_GLOBALLABEL;
 class SCH_REFERENCE;
 class PROGRESS_REPORTER;
@@ -109,6 +111,21 @@ public:
 
     SCH_SHEET_LIST BuildUnorderedSheetList() const;
 
+    /**
+     * Return a cached unordered sheet list, rebuilt only after structural edits.
+     *
+     * Prefer this over BuildUnorderedSheetList() when the caller only iterates the
+     * hierarchy and does not need page-number ordering; rebuilding the list on every
+     * query gets expensive on deep, reuse-heavy hierarchies.
+     */
+    const SCH_SHEET_LIST& GetUnorderedSheets() const;
+
+    /**
+     * Generation counter for the cached sheet list.  It is bumped whenever the sheet
+     * structure changes so caches keyed on sheet paths can cheaply detect staleness.
+     */
+    int GetSheetListGeneration() const { return m_sheetListGeneration; }
+
     /**
      * Return the full schematic flattened hierarchical sheet list.
      */
@@ -116,11 +133,25 @@ public:
 
     void RefreshHierarchy();
 
+    /**
+     * Resolve an item by #KIID using a maintained index; falls back to walking the sheet
+     * list on a cache miss so the semantics match #SCH_SHEET_LIST::ResolveItem.
+     */
     SCH_ITEM* ResolveItem( const KIID& aID, SCH_SHEET_PATH* aPathOut = nullptr,
-                           bool aAllowNullptrReturn = false ) const
-    {
-        return BuildUnorderedSheetList().ResolveItem( aID, aPathOut, aAllowNullptrReturn );
-    }
+                           bool aAllowNullptrReturn = false ) const;
+
+    /**
+     * Return the symbols matching a reference designator (one entry per unit and sheet
+     * instance), using the same maintained index as ResolveItem().  The comparison is
+     * case-insensitive.
+     */
+    std::vector<std::pair<SCH_SYMBOL*, SCH_SHEET_PATH>>
+    GetSymbolsByReference( const wxString& aReference ) const;
+
+    /**
+     * Mark the item lookup indexes stale; they will be rebuilt on next use.
+     */
+    void InvalidateItemCaches() { m_itemCachesValid = false; }
 
     SCH_SHEET& Root() const
     {
@@ -539,6 +570,43 @@ private:
      */
     SCH_SHEET_LIST m_hierarchy;
 
+    /**
+     * Lazily-built lookup indexes used by ResolveItem() and GetSymbolsByReference().
+     * Bulk adds and removals (commits, undo/redo, paste) are folded in incrementally by
+     * itemCachesAdd() / itemCachesRemove(); item changes invalidate wholesale because they
+     * can silently retire children (fields, sheet pins) whose pointers we hold.  Paths are
+     * stored once and referenced by index to keep the maps small on deep hierarchies.
+     */
+    mutable bool m_itemCachesValid = false;
+    mutable std::vector<SCH_SHEET_PATH>                   m_itemCachePaths;
+    mutable std::unordered_map<KIID, std::pair<SCH_ITEM*, int>> m_itemById;
+    mutable std::unordered_map<wxString, std::vector<std::pair<SCH_SYMBOL*, int>>> m_symbolsByRef;
+    mutable std::unordered_map<const SCH_SCREEN*, int>    m_itemCachePathIdx;
+
+    void rebuildItemCaches() const;
+
+    /// Fold newly added items into the lookup indexes (no-op if they are already stale).
+    void itemCachesAdd( const std::vector<SCH_ITEM*>& aItems );
+
+    /// Drop removed items from the lookup indexes (no-op if they are already stale).
+    void itemCachesRemove( const std::vector<SCH_ITEM*>& aItems );
+
+    /**
+     * Cached result of BuildUnorderedSheetList(), invalidated by structural edits (sheets
+     * added, removed or changed, or the hierarchy reloaded).
+     */
+    mutable bool           m_sheetListValid = false;
+    mutable SCH_SHEET_LIST m_cachedSheetList;
+    mutable int            m_sheetListGeneration = 0;
+
+    /// Mark the cached sheet list (and the item caches built from it) stale.
+    void invalidateSheetList()
+    {
+        m_sheetListValid = false;
+        ++m_sheetListGeneration;
+        m_itemCachesValid = false;
+    }
+
     /**
      * Currently installed listeners.
      */
@@ -24,12 +24,17 @@
 
 #include <filename_resolver.h>
 #include <pgm_base.h>
+#include <mutex>
+#include <set>
 #include <string>
 #include <string_utils.h>
 #include <common.h>
 #include <functional>
+#include <reporter.h>
 #include <sch_symbol.h>
 #include <schematic.h>
+#include <thread_pool.h>
+#include <wx/filefn.h>
 
 // Include simulator headers after wxWidgets headers to avoid conflicts with Windows headers
 // (especially on msys2 + wxWidgets 3.0.x)
@@ -41,6 +46,24 @@
 using namespace std::placeholders;
 
 
+namespace
+{
+    // Session-wide cache of parsed model libraries.  Vendor libraries are requested again every
+    // time a simulation is built, so parsed libraries are shared between SIM_LIB_MGR instances
+    // and validated against the file signature on reuse.
+    struct SIM_LIBRARY_CACHE_ENTRY
+    {
+        long long                    mtime = 0;
+        long long                    size = -1;
+        bool                         fullParse = false;
+        std::shared_ptr<SIM_LIBRARY> library;
+    };
+
+    std::mutex                                     s_libraryCacheMutex;
+    std::map<std::string, SIM_LIBRARY_CACHE_ENTRY> s_libraryCache;
+}
+
+
 SIM_LIB_MGR::SIM_LIB_MGR( const PROJECT* aPrj ) :
         m_project( aPrj ),
         m_forceFullParse( false )
@@ -146,14 +169,95 @@ void SIM_LIB_MGR::SetLibrary( const wxString& aLibraryPath, REPORTER& aReporter
         return;
     }
 
-    std::unique_ptr<SIM_LIBRARY> library = SIM_LIBRARY::Create( path, m_forceFullParse, aReporter,
+    std::shared_ptr<SIM_LIBRARY> library = acquireLibrary( path, aReporter );
+
+    Clear();
+    m_libraries[path] = std::move( library );
+}
+
+
+std::shared_ptr<SIM_LIBRARY> SIM_LIB_MGR::acquireLibrary( const wxString& aPath, REPORTER& aReporter )
+{
+    wxStructStat fileStat;
+    const bool   haveStat = wxStat( aPath, &fileStat ) == 0;
+    std::string  key( aPath.c_str() );
+
+    if( haveStat )
+    {
+        std::lock_guard<std::mutex> lock( s_libraryCacheMutex );
+        auto                        it = s_libraryCache.find( key );
+
+        // A fully parsed library satisfies callers which would accept fallback models, but not
+        // the other way around
+        if( it != s_libraryCache.end()
+                && it->second.mtime == static_cast<long long>( fileStat.st_mtime )
+                && it->second.size == static_cast<long long>( fileStat.st_size )
+                && ( it->second.fullParse || !m_forceFullParse ) )
+        {
+            return it->second.library;
+        }
+    }
+
+    std::shared_ptr<SIM_LIBRARY> library( SIM_LIBRARY::Create( aPath, m_forceFullParse, aReporter,
             [&]( const wxString& libPath, const wxString& relativeLib ) -> wxString
             {
                 return ResolveEmbeddedLibraryPath( libPath, relativeLib, aReporter );
+            } ) );
+
+    // Don't cache libraries we cannot later validate for staleness (e.g. embedded files)
+    if( haveStat && library )
+    {
+        std::lock_guard<std::mutex> lock( s_libraryCacheMutex );
+        s_libraryCache[key] = { static_cast<long long>( fileStat.st_mtime ),
+                                static_cast<long long>( fileStat.st_size ),
+                                m_forceFullParse,
+                                library };
+    }
+
+    return library;
+}
+
+
+void SIM_LIB_MGR::PreloadLibraries( const std::vector<wxString>& aLibraryPaths, REPORTER& aReporter )
+{
+    // Resolve first, then load the distinct missing libraries concurrently: loading is dominated
+    // by per-library file I/O and parsing, which are independent between files.
+    std::vector<wxString> paths;
+    std::set<wxString>    seen;
+
+    for( const wxString& libraryPath : aLibraryPaths )
+    {
+        wxString path = ResolveLibraryPath( libraryPath, aReporter );
+
+        if( path.IsEmpty() || !wxFileName::Exists( path ) )
+            continue;
+
+        if( seen.insert( path ).second )
+            paths.emplace_back( path );
+    }
+
+    if( paths.empty() )
+        return;
+
+    // Each load reports into its own string reporter; messages are forwarded in path order once
+    // all loads have completed, as REPORTERs are not safe for concurrent use.
+    std::vector<WX_STRING_REPORTER> reporters( paths.size() );
+
+    thread_pool& tp = GetKiCadThreadPool();
+
+    auto future = tp.submit_loop( 0, paths.size(),
+            [&]( const int i )
+            {
+                acquireLibrary( paths[i], reporters[i] );
             } );
 
-    Clear();
-    m_libraries[path] = std::move( library );
+    future.get();
+
+    for( WX_STRING_REPORTER& reporter : reporters )
+    {
+        if( reporter.HasMessage() )
+            aReporter.Report( reporter.GetMessages() );
+    }
 }
 
 
@@ -293,13 +397,7 @@ SIM_LIBRARY::MODEL SIM_LIB_MGR::CreateModel( const wxString& aLibraryPath,
     auto it = m_libraries.find( path );
 
     if( it == m_libraries.end() )
-    {
-        it = m_libraries.emplace( path, SIM_LIBRARY::Create( path, m_forceFullParse, aReporter,
-                [&]( const wxString& libPath, const wxString& relativeLib ) -> wxString
-                {
-                    return ResolveEmbeddedLibraryPath( libPath, relativeLib, aReporter );
-                } ) ).first;
-    }
+        it = m_libraries.emplace( path, acquireLibrary( path, aReporter ) ).first;
 
     library = &*it->second;
 
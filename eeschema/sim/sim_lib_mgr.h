@@ -25,6 +25,7 @@
 #pragma once
 
 #include <map>
+#include <memory>
 #include <vector>
 
 #include <sim/sim_library.h>
@@ -52,6 +53,19 @@ public:
 
     void SetLibrary( const wxString& aLibraryPath, REPORTER& aReporter );
 
+    /**
+     * Loads the given model libraries concurrently, priming the session-wide library cache.
+     *
+     * Later requests for these libraries (from this or any other manager instance) are then
+     * served from the cache instead of parsing the files serially on first reference.  Paths
+     * which fail to resolve are skipped; load errors are forwarded to aReporter once all loads
+     * have completed.
+     *
+     * @param aLibraryPaths the (unresolved) library paths to load; duplicates are allowed
+     * @param aReporter the reporter to forward resolution and load messages to
+     */
+    void PreloadLibraries( const std::vector<wxString>& aLibraryPaths, REPORTER& aReporter );
+
     SIM_MODEL& CreateModel( SIM_MODEL::TYPE aType, const std::vector<SCH_PIN*>& aPins,
                             REPORTER& aReporter );
 
@@ -83,10 +97,13 @@ public:
                                          REPORTER& aReporter );
 
 private:
+    /// Fetches the library from the session-wide cache, loading (and caching) it on a miss
+    std::shared_ptr<SIM_LIBRARY> acquireLibrary( const wxString& aPath, REPORTER& aReporter );
+
     std::vector<EMBEDDED_FILES*>                     m_embeddedFilesStack;  // no ownership
     const PROJECT*                                   m_project;             // no ownership
     bool                                             m_forceFullParse;
-    std::map<wxString, std::unique_ptr<SIM_LIBRARY>> m_libraries;
+    std::map<wxString, std::shared_ptr<SIM_LIBRARY>> m_libraries;
     std::vector<std::unique_ptr<SIM_MODEL>>          m_models;
 };
 
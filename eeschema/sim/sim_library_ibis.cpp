@@ -28,13 +28,73 @@
 #include <pegtl/contrib/parse_tree.hpp>
 #include <sch_pin.h>
 
+#include <wx/filefn.h>
+
+#include <map>
+#include <mutex>
+
+
+namespace
+{
+
+struct KIBIS_CACHE_ENTRY
+{
+    long long              mtime = 0;   ///< File modification time when parsed
+    long long              size = -1;   ///< File size in bytes when parsed
+    std::shared_ptr<KIBIS> kibis;
+};
+
+std::mutex                               s_kibisCacheMutex;
+std::map<std::string, KIBIS_CACHE_ENTRY> s_kibisCache;
+
+} // namespace
+
+
+std::shared_ptr<KIBIS> SIM_LIBRARY_IBIS::GetParsedFile( const wxString& aFilePath,
+                                                        REPORTER* aReporter )
+{
+    std::string key = aFilePath.ToStdString();
+
+    wxStructStat st;
+    bool         haveStat = wxStat( aFilePath, &st ) == 0;
+
+    if( haveStat )
+    {
+        std::lock_guard<std::mutex> lock( s_kibisCacheMutex );
+        auto                        it = s_kibisCache.find( key );
+
+        if( it != s_kibisCache.end()
+                && it->second.mtime == static_cast<long long>( st.st_mtime )
+                && it->second.size == static_cast<long long>( st.st_size ) )
+        {
+            return it->second.kibis;
+        }
+    }
+
+    std::shared_ptr<KIBIS> parsed = std::make_shared<KIBIS>( key, aReporter );
+
+    // Only valid parses are worth keeping; a failed parse is cheap to retry
+    // and the user is probably about to fix the file anyway
+    if( haveStat && parsed->m_valid )
+    {
+        std::lock_guard<std::mutex> lock( s_kibisCacheMutex );
+        KIBIS_CACHE_ENTRY&          entry = s_kibisCache[key];
+
+        entry.mtime = static_cast<long long>( st.st_mtime );
+        entry.size = static_cast<long long>( st.st_size );
+        entry.kibis = parsed;
+    }
+
+    return parsed;
+}
+
 
 void SIM_LIBRARY_IBIS::ReadFile( const wxString& aFilePath, REPORTER& aReporter )
 {
     SIM_LIBRARY::ReadFile( aFilePath, aReporter );
-    m_kibis = KIBIS( aFilePath.ToStdString(), &aReporter );
+    m_kibis = GetParsedFile( aFilePath, &aReporter );
 
-    if( !m_kibis.m_valid )
+    if( !m_kibis->m_valid )
     {
         aReporter.Report( wxString::Format( _( "Invalid IBIS file '%s'" ), aFilePath ),
                           RPT_SEVERITY_ERROR );
@@ -47,7 +107,7 @@ void SIM_LIBRARY_IBIS::ReadFile( const wxString& aFilePath, REPORTER& aReporter
     pinB.SetNumber( wxT( "2" ) );
     std::vector<SCH_PIN*> pins = { &pinA, &pinB };
 
-    for( KIBIS_COMPONENT& kcomp : m_kibis.m_components )
+    for( KIBIS_COMPONENT& kcomp : m_kibis->m_components )
     {
         m_models.push_back( SIM_MODEL::Create( SIM_MODEL::TYPE::KIBIS_DEVICE, pins, aReporter ) );
         m_modelNames.emplace_back( kcomp.m_name );
@@ -62,7 +122,10 @@ void SIM_LIBRARY_IBIS::ReadFile( const wxString& aFilePath, REPORTER& aReporter
 
 bool SIM_LIBRARY_IBIS::InitModel( SIM_MODEL_IBIS& aModel, wxString aCompName )
 {
-    for( KIBIS_COMPONENT& kcomp : m_kibis.m_components )
+    if( !m_kibis )
+        return false;
+
+    for( KIBIS_COMPONENT& kcomp : m_kibis->m_components )
     {
         if( kcomp.m_name != aCompName )
             continue;
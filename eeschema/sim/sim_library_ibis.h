@@ -28,6 +28,8 @@
 #include <sim/sim_library.h>
 #include <sim/sim_model_ibis.h>
 
+#include <memory>
+
 class SIM_LIBRARY_IBIS : public SIM_LIBRARY
 {
     friend class SIM_MODEL_IBIS;
@@ -43,8 +45,20 @@ public:
     bool InitModel( SIM_MODEL_IBIS& aModel, wxString aCompName );
     bool isPinDiff( const std::string& aComp, const std::string& aPinNumber ) const;
 
+    /**
+     * Return a parsed KIBIS object for \a aFilePath.
+     *
+     * Parses are cached process-wide and revalidated against the file's
+     * modification time and size, so reopening the simulator or regenerating
+     * a netlist does not re-run the kibis parser over a vendor IBIS file that
+     * has not changed.  The returned object is shared; callers must not
+     * structurally modify it.
+     */
+    static std::shared_ptr<KIBIS> GetParsedFile( const wxString& aFilePath,
+                                                 REPORTER* aReporter = nullptr );
+
 protected:
-    mutable KIBIS m_kibis;
+    std::shared_ptr<KIBIS> m_kibis;
     std::vector<std::pair<std::string, std::string>> m_diffPins;
 };
 
@@ -25,11 +25,27 @@
 #include <sim/sim_model_ibis.h>
 #include <sim/sim_library_ibis.h>
 #include <fmt/core.h>
+#include <wx/filefn.h>
 #include <wx/filename.h>
 #include <kiway.h>
 #include <schematic.h>
 #include "sim_lib_mgr.h"
 
+#include <map>
+#include <mutex>
+
+
+namespace
+{
+    // Generated subcircuits are deterministic functions of the source IBIS file, the addressed
+    // component / pin / model and the parameter corners, so they can be reused across netlist
+    // exports and sweep re-runs.  Board-level SI netlists instantiate the same handful of driver
+    // and receiver models many times, and waveform table derivation dominates export time.
+    std::mutex                         s_ibisSubcktCacheMutex;
+    std::map<std::string, std::string> s_ibisSubcktCache;
+}
+
+
 std::string SPICE_GENERATOR_IBIS::ModelName( const SPICE_ITEM& aItem ) const
 {
     return fmt::format( "{}.{}", aItem.refName, aItem.baseModelName );
@@ -73,14 +89,45 @@ std::string SPICE_GENERATOR_IBIS::IbisDevice( const SPICE_ITEM& aItem, SCHEMATIC
     if( reporter.HasMessage() )
         THROW_IO_ERROR( reporter.GetMessages() );
 
-    KIBIS kibis( std::string( path.c_str() ) );
-    kibis.m_cacheDir = std::string( aCacheDir.c_str() );
-    kibis.m_Reporter = &aReporter;
+    // The cache key captures everything the generated subcircuit depends on: the source file
+    // (identified by path / mtime / size), the addressed component, pin and model, the model type
+    // and instance name, and every model parameter (corner selections and waveform settings).
+    std::string cacheKey;
 
-    if( !kibis.m_valid )
+    {
+        wxStructStat fileStat;
+        wxStat( path, &fileStat );
+
+        cacheKey = fmt::format( "{}|{}|{}|{}|{}|{}|{}|{}|{}|{}",
+                                std::string( path.c_str() ),
+                                static_cast<long long>( fileStat.st_mtime ),
+                                static_cast<long long>( fileStat.st_size ),
+                                ibisCompName, ibisPinName, ibisModelName, diffMode,
+                                static_cast<int>( m_model.GetType() ), aItem.modelName,
+                                std::string( aCacheDir.c_str() ) );
+
+        for( int ii = 0; ii < m_model.GetParamCount(); ++ii )
+        {
+            const SIM_MODEL::PARAM& param = m_model.GetParam( ii );
+            cacheKey += fmt::format( "|{}={}", param.info.name, param.value );
+        }
+
+        std::lock_guard<std::mutex> lock( s_ibisSubcktCacheMutex );
+
+        if( auto it = s_ibisSubcktCache.find( cacheKey ); it != s_ibisSubcktCache.end() )
+            return it->second;
+    }
+
+    // Reuse the session-wide parsed file cache; regenerating a netlist must
+    // not re-run the kibis parser over a vendor IBIS file that hasn't changed
+    std::shared_ptr<KIBIS> kibis = SIM_LIBRARY_IBIS::GetParsedFile( path );
+    kibis->m_cacheDir = std::string( aCacheDir.c_str() );
+    kibis->m_Reporter = &aReporter;
+
+    if( !kibis->m_valid )
         THROW_IO_ERROR( wxString::Format( _( "Invalid IBIS file '%s'" ), ibisLibFilename ) );
 
-    KIBIS_COMPONENT* kcomp = kibis.GetComponent( std::string( ibisCompName ) );
+    KIBIS_COMPONENT* kcomp = kibis->GetComponent( std::string( ibisCompName ) );
 
     if( !kcomp )
         THROW_IO_ERROR( wxString::Format( _( "Could not find IBIS component '%s'" ), ibisCompName ) );
@@ -105,7 +152,7 @@ std::string SPICE_GENERATOR_IBIS::IbisDevice( const SPICE_ITEM& aItem, SCHEMATIC
                                           ibisCompName ) );
     }
 
-    KIBIS_MODEL* kmodel = kibis.GetModel( ibisModelName );
+    KIBIS_MODEL* kmodel = kibis->GetModel( ibisModelName );
 
     if( !kmodel )
         THROW_IO_ERROR( wxString::Format( _( "Could not find IBIS model '%s'" ), ibisModelName ) );
@@ -219,6 +266,11 @@ std::string SPICE_GENERATOR_IBIS::IbisDevice( const SPICE_ITEM& aItem, SCHEMATIC
         return "";
     }
 
+    {
+        std::lock_guard<std::mutex> lock( s_ibisSubcktCacheMutex );
+        s_ibisSubcktCache[cacheKey] = result;
+    }
+
     return result;
 }
 
@@ -296,7 +348,8 @@ SIM_MODEL_IBIS::SIM_MODEL_IBIS( TYPE aType, const SIM_MODEL_IBIS& aSource ) :
 
 bool SIM_MODEL_IBIS::ChangePin( const SIM_LIBRARY_IBIS& aLib, const std::string& aPinNumber )
 {
-    KIBIS_COMPONENT* kcomp = aLib.m_kibis.GetComponent( std::string( GetComponentName() ) );
+    KIBIS_COMPONENT* kcomp = aLib.m_kibis ? aLib.m_kibis->GetComponent( std::string( GetComponentName() ) )
+                                          : nullptr;
 
     if( !kcomp )
         return false;
@@ -0,0 +1,123 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright The KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, you may find one here:
+ * https://www.gnu.org/licenses/gpl-3.0.html
+ * or you may search the http://www.gnu.org website for the version 3 license,
+ * or you may write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
+ */
+
+#include "spice_sweep_runner.h"
+#include "spice_simulator.h"
+
+#include <fmt/core.h>
+#include <thread_pool.h>
+
+
+SPICE_SWEEP_RUNNER::SPICE_SWEEP_RUNNER( std::shared_ptr<SPICE_SIMULATOR> aSimulator ) :
+        m_simulator( std::move( aSimulator ) ),
+        m_running( false ),
+        m_cancelled( false )
+{
+}
+
+
+SPICE_SWEEP_RUNNER::~SPICE_SWEEP_RUNNER()
+{
+    Cancel();
+
+    if( m_future.valid() )
+        m_future.wait();
+}
+
+
+bool SPICE_SWEEP_RUNNER::Start()
+{
+    if( m_running.load() || !m_simulator || m_steps.empty() )
+        return false;
+
+    m_results.clear();
+    m_results.reserve( m_steps.size() );
+    m_cancelled.store( false );
+    m_running.store( true );
+
+    thread_pool& tp = GetKiCadThreadPool();
+
+    m_future = tp.submit_task( [this]()
+                               {
+                                   runSweep();
+                               } );
+
+    return true;
+}
+
+
+std::vector<SPICE_SWEEP_RESULT> SPICE_SWEEP_RUNNER::WaitForResults()
+{
+    if( m_future.valid() )
+        m_future.wait();
+
+    return m_results;
+}
+
+
+void SPICE_SWEEP_RUNNER::runSweep()
+{
+    int total = static_cast<int>( m_steps.size() );
+
+    for( int ii = 0; ii < total && !m_cancelled.load(); ++ii )
+    {
+        const SPICE_SWEEP_STEP& step = m_steps[ii];
+
+        SPICE_SWEEP_RESULT result;
+        result.step = step;
+        result.succeeded = true;
+
+        for( const auto& [name, value] : step.params )
+        {
+            if( !m_simulator->Command( fmt::format( "alter {}={:g}", name, value ) ) )
+                result.succeeded = false;
+        }
+
+        // Foreground "run" blocks until the analysis completes, which is what
+        // we want on a worker thread: no polling, and the result vectors are
+        // guaranteed complete when it returns.
+        if( result.succeeded && m_simulator->Command( "run" ) )
+        {
+            for( const std::string& vecName : m_captureVectors )
+            {
+                std::vector<double> data = m_simulator->GetRealVector( vecName );
+
+                if( data.empty() )
+                    result.succeeded = false;
+
+                result.vectors[vecName] = std::move( data );
+            }
+        }
+        else
+        {
+            result.succeeded = false;
+        }
+
+        m_results.push_back( std::move( result ) );
+
+        if( m_progressCallback )
+            m_progressCallback( ii + 1, total );
+    }
+
+    m_running.store( false );
+}
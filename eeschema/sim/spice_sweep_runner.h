@@ -0,0 +1,137 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright The KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, you may find one here:
+ * https://www.gnu.org/licenses/gpl-3.0.html
+ * or you may search the http://www.gnu.org website for the version 3 license,
+ * or you may write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
+ */
+
+#ifndef SPICE_SWEEP_RUNNER_H
+#define SPICE_SWEEP_RUNNER_H
+
+#include <atomic>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+class SPICE_SIMULATOR;
+
+
+/**
+ * One point of a parameter sweep: the set of device parameter assignments to
+ * apply (via Spice "alter" commands) before re-running the analysis.
+ */
+struct SPICE_SWEEP_STEP
+{
+    /// Device/parameter names and their values, e.g. { "R1", 1000.0 }.
+    std::vector<std::pair<std::string, double>> params;
+};
+
+
+/**
+ * Result vectors captured after one sweep step.
+ */
+struct SPICE_SWEEP_RESULT
+{
+    SPICE_SWEEP_STEP                           step;      ///< Parameters this run used
+    std::map<std::string, std::vector<double>> vectors;   ///< Captured vectors by name
+    bool                                       succeeded = false;
+};
+
+
+/**
+ * Runs a parameter sweep (corner analysis) against an attached simulator.
+ *
+ * The circuit is parsed once; each step applies its parameter set with
+ * "alter" commands and re-runs the analysis, which skips the netlist
+ * regeneration and circuit reload that otherwise dominate short corner runs.
+ * The whole sweep executes on a thread pool worker so the UI stays
+ * responsive, and results for all steps are aggregated into one dataset for
+ * plotting.
+ *
+ * Note that shared ngspice can only be initialized once per process, so steps
+ * run sequentially through the single simulator instance; the caller must not
+ * issue other simulator commands while a sweep is in flight.
+ */
+class SPICE_SWEEP_RUNNER
+{
+public:
+    /**
+     * @param aSimulator is the simulator to drive; a netlist must already be
+     *                   attached before Start() is called.
+     */
+    explicit SPICE_SWEEP_RUNNER( std::shared_ptr<SPICE_SIMULATOR> aSimulator );
+    ~SPICE_SWEEP_RUNNER();
+
+    /// Set the parameter points to sweep, in execution order.
+    void SetSteps( std::vector<SPICE_SWEEP_STEP> aSteps ) { m_steps = std::move( aSteps ); }
+
+    /// Set the names of the vectors to capture after each run (e.g. "V(out)").
+    void SetCaptureVectors( std::vector<std::string> aNames )
+    {
+        m_captureVectors = std::move( aNames );
+    }
+
+    /**
+     * Set an optional progress callback, invoked from the worker thread after
+     * each completed step with (completed, total).
+     */
+    void SetProgressCallback( std::function<void( int, int )> aCallback )
+    {
+        m_progressCallback = std::move( aCallback );
+    }
+
+    /**
+     * Launch the sweep on the thread pool.
+     *
+     * @return false if a sweep is already running or there is nothing to do.
+     */
+    bool Start();
+
+    /// Request cancellation; the sweep stops after the step currently running.
+    void Cancel() { m_cancelled.store( true ); }
+
+    bool IsRunning() const { return m_running.load(); }
+
+    /**
+     * Block until the sweep finishes (or is cancelled) and return the
+     * aggregated per-step results.  Cancelled sweeps return the steps
+     * completed so far.
+     */
+    std::vector<SPICE_SWEEP_RESULT> WaitForResults();
+
+private:
+    /// Worker body: applies each step, runs the analysis and captures vectors.
+    void runSweep();
+
+    std::shared_ptr<SPICE_SIMULATOR> m_simulator;
+    std::vector<SPICE_SWEEP_STEP>    m_steps;
+    std::vector<std::string>         m_captureVectors;
+    std::function<void( int, int )>  m_progressCallback;
+
+    std::vector<SPICE_SWEEP_RESULT>  m_results;
+    std::future<void>                m_future;
+    std::atomic<bool>                m_running;
+    std::atomic<bool>                m_cancelled;
+};
+
+#endif /* SPICE_SWEEP_RUNNER_H */
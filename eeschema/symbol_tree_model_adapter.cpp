@@ -34,6 +34,7 @@
 #include <locale_io.h>
 #include <string_utils.h>
 #include <trace_helpers.h>
+#include <libraries/symbol_info_cache.h>
 #include <libraries/symbol_library_adapter.h>
 
 #define PROGRESS_INTERVAL_MILLIS 33      // 30 FPS refresh rate
@@ -123,9 +124,38 @@ void SYMBOL_TREE_MODEL_ADAPTER::AddLibraries( SCH_BASE_FRAME* aFrame )
         if( !m_adapter->GetLibraryStatus( lib ) )
         {
             m_pending_load_libraries.insert( lib );
+
+            // While the real parse is in flight, list the library from the per-user metadata
+            // cache so the chooser is usable immediately after boot.
+            if( !m_cached_placeholder_libraries.contains( lib ) )
+            {
+                std::vector<LIB_TREE_ITEM*> cachedItems = m_adapter->GetCachedChooserItems( lib );
+
+                if( !cachedItems.empty() )
+                {
+                    wxString desc;
+
+                    if( std::optional<const LIBRARY_TABLE_ROW*> cachedRow =
+                                manager.GetRow( LIBRARY_TABLE_TYPE::SYMBOL, lib ) )
+                    {
+                        desc = ( *cachedRow )->Description();
+                    }
+
+                    bool pinned = alg::contains( cfg->m_Session.pinned_symbol_libs, lib )
+                                  || alg::contains( project.m_PinnedSymbolLibs, lib );
+
+                    DoAddLibrary( lib, desc, cachedItems, pinned, false );
+                    m_cached_placeholder_libraries.insert( lib );
+                }
+            }
+
             continue;
         }
 
+        // Swap out any placeholder node before adding the fully parsed library.
+        if( m_cached_placeholder_libraries.erase( lib ) )
+            m_tree.RemoveLib( lib );
+
         std::optional<const LIBRARY_TABLE_ROW*> rowResult =
                 manager.GetRow( LIBRARY_TABLE_TYPE::SYMBOL, lib );
 
@@ -198,6 +228,11 @@ void SYMBOL_TREE_MODEL_ADAPTER::AddLibraries( SCH_BASE_FRAME* aFrame )
         m_check_pending_libraries_timer->Start( 1000 );
     }
 
+    // Once everything has really loaded, persist any metadata refreshed along the way so the
+    // next session's chooser populates instantly.
+    if( m_pending_load_libraries.empty() )
+        GSymbolInfoCache.SaveIfDirty();
+
     m_tree.AssignIntrinsicRanks( m_shownColumns );
 
     if( isLazyLoad && m_lazyLoadHandler )
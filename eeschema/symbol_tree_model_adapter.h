@@ -70,6 +70,10 @@ private:
     SYMBOL_LIBRARY_ADAPTER*  m_adapter;
 
     std::set<wxString> m_pending_load_libraries;
+
+    /// Libraries currently shown as metadata-cache placeholders, awaiting the real parse.
+    std::set<wxString> m_cached_placeholder_libraries;
+
     std::unique_ptr<wxTimer> m_check_pending_libraries_timer;
 };
 
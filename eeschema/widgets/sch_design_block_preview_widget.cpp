@@ -46,8 +46,7 @@ SCH_DESIGN_BLOCK_PREVIEW_WIDGET::SCH_DESIGN_BLOCK_PREVIEW_WIDGET( wxWindow* aPar
         m_preview( nullptr ),
         m_status( nullptr ),
         m_statusPanel( nullptr ),
-        m_statusSizer( nullptr ),
-        m_previewItem( nullptr )
+        m_statusSizer( nullptr )
 {
     COMMON_SETTINGS*   common_settings = Pgm().GetCommonSettings();
     EESCHEMA_SETTINGS* cfg = GetAppSettings<EESCHEMA_SETTINGS>( "eeschema" );
@@ -134,12 +133,31 @@ SCH_DESIGN_BLOCK_PREVIEW_WIDGET::SCH_DESIGN_BLOCK_PREVIEW_WIDGET( wxWindow* aPar
 }
 
 
+// Parsed design block schematics are expensive to build, so recently displayed ones are kept
+// for reuse by any preview widget instead of being torn down with the widget.
+static DESIGN_BLOCK_PREVIEW_CACHE<SCHEMATIC> g_schPreviewCache;
+
+
 SCH_DESIGN_BLOCK_PREVIEW_WIDGET::~SCH_DESIGN_BLOCK_PREVIEW_WIDGET()
 {
-    if( m_previewItem )
-        m_preview->GetView()->Remove( m_previewItem );
+    detachPreviewItem();
+}
+
+
+void SCH_DESIGN_BLOCK_PREVIEW_WIDGET::detachPreviewItem()
+{
+    if( !m_previewItem.Document )
+        return;
+
+    KIGFX::VIEW* view = m_preview->GetView();
+
+    // Remove() (unlike Clear()) unlinks each item from the view, so the cached schematic can
+    // outlive this widget and be re-displayed in a new canvas later.
+    for( EDA_ITEM* item : m_previewItem.Document->CurrentSheet().LastScreen()->Items() )
+        view->Remove( item );
 
-    delete m_previewItem;
+    g_schPreviewCache.Release( std::move( m_previewItem ) );
+    m_previewItem = {};
 }
 
 
@@ -156,7 +174,7 @@ void SCH_DESIGN_BLOCK_PREVIEW_WIDGET::SetStatusText( wxString const& aText )
 
 void SCH_DESIGN_BLOCK_PREVIEW_WIDGET::onSize( wxSizeEvent& aEvent )
 {
-    if( m_previewItem )
+    if( m_previewItem.Document )
     {
         fitOnDrawArea();
         m_preview->ForceRefresh();
@@ -168,7 +186,7 @@ void SCH_DESIGN_BLOCK_PREVIEW_WIDGET::onSize( wxSizeEvent& aEvent )
 
 void SCH_DESIGN_BLOCK_PREVIEW_WIDGET::fitOnDrawArea()
 {
-    if( !m_previewItem )
+    if( !m_previewItem.Document )
         return;
 
     // set the view scale to fit the item on screen
@@ -194,22 +212,31 @@ void SCH_DESIGN_BLOCK_PREVIEW_WIDGET::DisplayDesignBlock( DESIGN_BLOCK* aDesignB
 {
     KIGFX::VIEW* view = m_preview->GetView();
 
-    if( m_previewItem )
-    {
-        view->Clear();
-        delete m_previewItem;
-        m_previewItem = nullptr;
-    }
+    detachPreviewItem();
 
     if( aDesignBlock && wxFileExists( aDesignBlock->GetSchematicFile() ) )
     {
-        m_previewItem = EESCHEMA_HELPERS::LoadSchematic( aDesignBlock->GetSchematicFile(), SCH_IO_MGR::SCH_KICAD,
-                                                         false, true, nullptr, false );
+        const wxString& schematicFile = aDesignBlock->GetSchematicFile();
+
+        m_previewItem = g_schPreviewCache.Take( schematicFile );
+
+        if( !m_previewItem.Document )
+        {
+            SCHEMATIC* schematic = EESCHEMA_HELPERS::LoadSchematic( schematicFile, SCH_IO_MGR::SCH_KICAD,
+                                                                    false, true, nullptr, false );
+
+            if( schematic )
+            {
+                m_previewItem = DESIGN_BLOCK_PREVIEW_CACHE<SCHEMATIC>::MakeEntry(
+                        schematicFile, std::shared_ptr<SCHEMATIC>( schematic ) );
+            }
+        }
+
         BOX2I bBox;
 
-        if( m_previewItem )
+        if( m_previewItem.Document )
         {
-            for( EDA_ITEM* item : m_previewItem->CurrentSheet().LastScreen()->Items() )
+            for( EDA_ITEM* item : m_previewItem.Document->CurrentSheet().LastScreen()->Items() )
             {
                 view->Add( item );
 
@@ -62,6 +62,9 @@ protected:
 
     void fitOnDrawArea();    // set the view scale to fit the item on screen and center
 
+    /// Unlink the displayed schematic's items from the view and return it to the cache.
+    void detachPreviewItem();
+
     GAL_DISPLAY_OPTIONS_IMPL   m_galDisplayOptions;
     EDA_DRAW_PANEL_GAL*        m_preview;
 
@@ -70,7 +73,7 @@ protected:
     wxSizer*                   m_statusSizer;
     wxSizer*                   m_outerSizer;
 
-    SCHEMATIC*                 m_previewItem;
+    DESIGN_BLOCK_PREVIEW_CACHE<SCHEMATIC>::ENTRY m_previewItem;
 
     /// The bounding box of the current item
     BOX2I                      m_itemBBox;
@@ -24,12 +24,14 @@
 
 #include <wx/debug.h>
 #include <wx/filedlg.h>
+#include <wx/msgdlg.h>
 #include <wx/wfstream.h>
 #include <wx/zipstrm.h>
 #include <reporter.h>
 #include <dialogs/html_message_box.h>
 #include <gerbview_frame.h>
 #include <gerbview_id.h>
+#include <gerbview_settings.h>
 #include <gerber_file_image.h>
 #include <gerber_file_image_list.h>
 #include <excellon_image.h>
@@ -39,6 +41,11 @@
 #include <widgets/wx_progress_reporters.h>
 #include "widgets/gerbview_layer_widget.h"
 #include <tool/tool_manager.h>
+#include <thread_pool.h>
+
+#include <chrono>
+#include <future>
+#include <set>
 
 // HTML Messages used more than one time:
 #define MSG_NO_MORE_LAYER _( "<b>No more available layers</b> in GerbView to load files" )
@@ -287,6 +294,36 @@ bool GERBVIEW_FRAME::LoadListOfGerberAndDrillFiles( const wxString&      aPath,
     // Create progress dialog (only used if more than 1 file to load
     std::unique_ptr<WX_PROGRESS_REPORTER> progress = nullptr;
 
+    // Each file of the job is parsed on the thread pool: a GERBER_FILE_IMAGE is fully
+    // self-contained while loading, so files only contend for I/O.  All UI work (layer
+    // reservation, dialogs, view insertion) stays on this thread.
+    struct PENDING_LOAD
+    {
+        unsigned                           index = 0;   ///< position in aFilenameList
+        wxFileName                         fileName;
+        int                                layer = 0;
+        int                                type = 2;    ///< 0 = gerber, 1 = drill, 2 = autodetect
+        bool                               oom = false;
+        std::unique_ptr<GERBER_FILE_IMAGE> image;
+    };
+
+    std::vector<PENDING_LOAD> loads;
+    std::set<int>             reservedLayers;
+
+    // getNextAvailableLayer() only sees images already attached to the layer stack, so the
+    // layers handed to in-flight loads must be excluded by hand:
+    auto nextAvailableLayer =
+            [&]() -> int
+            {
+                for( int i = 0; i < (int) ImagesMaxCount(); ++i )
+                {
+                    if( GetGbrImage( i ) == nullptr && !reservedLayers.count( i ) )
+                        return i;
+                }
+
+                return NO_AVAILABLE_LAYERS;
+            };
+
     for( unsigned ii = 0; ii < aFilenameList.GetCount(); ii++ )
     {
         filename = aFilenameList[ii];
@@ -321,27 +358,8 @@ bool GERBVIEW_FRAME::LoadListOfGerberAndDrillFiles( const wxString&      aPath,
 
         m_lastFileName = filename.GetFullPath();
 
-        if( !progress && ( aFilenameList.GetCount() > 1 ) )
-        {
-            progress = std::make_unique<WX_PROGRESS_REPORTER>( this, _( "Load Files" ), 1, PR_CAN_ABORT );
-            progress->SetMaxProgress( aFilenameList.GetCount() - 1 );
-            progress->Report( wxString::Format( _("Loading %u/%zu %s..." ),
-                                                ii+1,
-                                                aFilenameList.GetCount(),
-                                                m_lastFileName ) );
-        }
-        else if( progress )
-        {
-            progress->Report( wxString::Format( _("Loading %u/%zu %s..." ),
-                                                ii+1,
-                                                aFilenameList.GetCount(),
-                                                m_lastFileName ) );
-            progress->KeepRefreshing();
-        }
-
-
         // Make sure we have a layer available to load into
-        layer = getNextAvailableLayer();
+        layer = nextAvailableLayer();
 
         if( layer == NO_AVAILABLE_LAYERS )
         {
@@ -358,65 +376,183 @@ bool GERBVIEW_FRAME::LoadListOfGerberAndDrillFiles( const wxString&      aPath,
             break;
         }
 
+        reservedLayers.insert( layer );
         SetActiveLayer( layer, false );
         visibility[ layer ] = true;
 
-        try
-        {
-            // 2 = Autodetect
-            if( ( *aFileType )[ii] == 2 )
-            {
-                if( EXCELLON_IMAGE::TestFileIsExcellon( filename.GetFullPath() ) )
-                    ( *aFileType )[ii] = 1;
-                else if( GERBER_FILE_IMAGE::TestFileIsRS274( filename.GetFullPath() ) )
-                    ( *aFileType )[ii] = 0;
-            }
+        loads.emplace_back();
+        loads.back().index = ii;
+        loads.back().fileName = filename;
+        loads.back().layer = layer;
+        loads.back().type = ( *aFileType )[ii];
+    }
 
-            switch( ( *aFileType )[ii] )
-            {
-            case 0:
+    if( loads.size() > 1 )
+    {
+        progress = std::make_unique<WX_PROGRESS_REPORTER>( this, _( "Load Files" ), 1,
+                                                           PR_CAN_ABORT );
+        progress->SetMaxProgress( loads.size() );
+    }
 
-                if( Read_GERBER_File( filename.GetFullPath() ) )
-                {
-                    UpdateFileHistory( filename.GetFullPath() );
+    EXCELLON_DEFAULTS nc_defaults;
+    GERBVIEW_SETTINGS* cfg = static_cast<GERBVIEW_SETTINGS*>( config() );
+    cfg->GetExcellonDefaults( nc_defaults );
+
+    thread_pool&                   tp = GetKiCadThreadPool();
+    std::vector<std::future<void>> futures;
 
-                    if( firstLoadedLayer == NO_AVAILABLE_LAYERS )
+    for( PENDING_LOAD& load : loads )
+    {
+        futures.emplace_back( tp.submit_task(
+                [&load, &nc_defaults]()
+                {
+                    try
                     {
-                        firstLoadedLayer = layer;
+                        // 2 = Autodetect
+                        if( load.type == 2 )
+                        {
+                            wxString fullPath = load.fileName.GetFullPath();
+
+                            if( EXCELLON_IMAGE::TestFileIsExcellon( fullPath ) )
+                                load.type = 1;
+                            else if( GERBER_FILE_IMAGE::TestFileIsRS274( fullPath ) )
+                                load.type = 0;
+                        }
+
+                        switch( load.type )
+                        {
+                        case 0:
+                        {
+                            auto gerber = std::make_unique<GERBER_FILE_IMAGE>( load.layer );
+
+                            // The image will be attached only if it can be read, to avoid
+                            // broken data.
+                            if( gerber->LoadGerberFile( load.fileName.GetFullPath() ) )
+                                load.image = std::move( gerber );
+
+                            break;
+                        }
+
+                        case 1:
+                        {
+                            auto drill = std::make_unique<EXCELLON_IMAGE>( load.layer );
+
+                            if( drill->LoadFile( load.fileName.GetFullPath(), &nc_defaults ) )
+                                load.image = std::move( drill );
+
+                            break;
+                        }
+
+                        default:
+                            break;
+                        }
                     }
-                }
+                    catch( const std::bad_alloc& )
+                    {
+                        load.oom = true;
+                        load.image.reset();
+                    }
+                } ) );
+    }
 
-                break;
+    for( size_t ii = 0; ii < futures.size(); ++ii )
+    {
+        while( futures[ii].wait_for( std::chrono::milliseconds( 50 ) )
+               != std::future_status::ready )
+        {
+            if( progress )
+                progress->KeepRefreshing();
+        }
 
-            case 1:
+        if( progress )
+        {
+            progress->Report( wxString::Format( _( "Loading %zu/%zu %s..." ),
+                                                ii + 1,
+                                                loads.size(),
+                                                loads[ii].fileName.GetFullPath() ) );
+            progress->AdvanceProgress();
+        }
+    }
 
-                if( Read_EXCELLON_File( filename.GetFullPath() ) )
-                {
-                    UpdateFileHistory( filename.GetFullPath(), &m_drillFileHistory );
+    // Attach the parsed images to the layer stack in the original file order, and run the
+    // per-file reporting the sequential loaders used to do.
+    GERBER_FILE_IMAGE_LIST* images = GetImagesList();
 
-                    // Select the first added layer by default when done loading
-                    if( firstLoadedLayer == NO_AVAILABLE_LAYERS )
-                    {
-                        firstLoadedLayer = layer;
-                    }
-                }
+    for( PENDING_LOAD& load : loads )
+    {
+        ( *aFileType )[load.index] = load.type;
 
-                break;
-            default:
-                wxString txt = wxString::Format( MSG_NOT_LOADED, filename.GetFullName() );
-                reporter.Report( txt, RPT_SEVERITY_ERROR );
-            }
-        }
-        catch( const std::bad_alloc& )
+        if( load.oom )
         {
-            wxString txt = wxString::Format( MSG_OOM, filename.GetFullName() );
+            wxString txt = wxString::Format( MSG_OOM, load.fileName.GetFullName() );
             reporter.Report( txt, RPT_SEVERITY_ERROR );
             success = false;
             continue;
         }
 
-        if( progress )
-            progress->AdvanceProgress();
+        if( load.type != 0 && load.type != 1 )
+        {
+            wxString txt = wxString::Format( MSG_NOT_LOADED, load.fileName.GetFullName() );
+            reporter.Report( txt, RPT_SEVERITY_ERROR );
+            continue;
+        }
+
+        bool isDrill = load.type == 1;
+
+        if( !load.image )
+        {
+            wxString msg;
+            msg.Printf( isDrill ? _( "File %s not found." ) : _( "File '%s' not found" ),
+                        load.fileName.GetFullPath() );
+            ShowInfoBarError( msg );
+            continue;
+        }
+
+        GERBER_FILE_IMAGE* gerber = load.image.release();
+        images->AddGbrImage( gerber, load.layer );
+
+        if( isDrill )
+            UpdateFileHistory( load.fileName.GetFullPath(), &m_drillFileHistory );
+        else
+            UpdateFileHistory( load.fileName.GetFullPath() );
+
+        // Select the first added layer by default when done loading
+        if( firstLoadedLayer == NO_AVAILABLE_LAYERS )
+            firstLoadedLayer = load.layer;
+
+        // Display errors list
+        if( gerber->GetMessages().size() > 0 )
+        {
+            HTML_MESSAGE_BOX dlg( this, isDrill ? _( "Error reading EXCELLON drill file" )
+                                                : _( "Errors" ) );
+            dlg.ListSet( gerber->GetMessages() );
+            dlg.ShowModal();
+        }
+
+        /* if the gerber file has items using D codes but missing D codes definitions,
+         * it can be a deprecated RS274D file (i.e. without any aperture information),
+         * or has missing definitions,
+         * warn the user:
+         */
+        if( !isDrill && gerber->GetItemsCount() && gerber->m_Has_MissingDCode )
+        {
+            wxString msg;
+
+            if( !gerber->m_Has_DCode )
+                msg = _("Warning: this file has no D-Code definition\n"
+                        "Therefore the size of some items is undefined");
+            else
+                msg = _("Warning: this file has some missing D-Code definitions\n"
+                        "Therefore the size of some items is undefined");
+
+            wxMessageBox( msg );
+        }
+
+        if( GetCanvas() )
+        {
+            for( GERBER_DRAW_ITEM* item : gerber->GetItems() )
+                GetCanvas()->GetView()->Add( (KIGFX::VIEW_ITEM*) item );
+        }
     }
 
     if( !success )
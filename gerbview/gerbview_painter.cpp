@@ -461,21 +461,36 @@ void GERBVIEW_PAINTER::drawPolygon( GERBER_DRAW_ITEM* aParent, const SHAPE_POLY_
     if( aPolygon.OutlineCount() == 0 )
         return;
 
-    SHAPE_POLY_SET poly;
-    poly.NewOutline();
-    const std::vector<VECTOR2I> pts = aPolygon.COutline( 0 ).CPoints();
-    VECTOR2I offset = aShift ? VECTOR2I( aParent->m_Start ) : VECTOR2I( 0, 0 );
+    // The source polygon is in local (aperture) coordinates, so the transformed copy and
+    // its triangulation only depend on the item.  Keep them in the item so the next canvas
+    // recache reuses them instead of re-tessellating every flash; they are cleared when the
+    // draw coordinates become outdated (see GERBER_FILE_IMAGE::SetDrawOffetAndRotation).
+    SHAPE_POLY_SET& poly = aParent->m_AbsolutePolygon;
 
-    for( const VECTOR2I& pt : pts )
-        poly.Append( aParent->GetABPosition( pt + offset ) );
+    if( poly.OutlineCount() == 0 )
+    {
+        poly.NewOutline();
+        const std::vector<VECTOR2I> pts = aPolygon.COutline( 0 ).CPoints();
+        VECTOR2I offset = aShift ? VECTOR2I( aParent->m_Start ) : VECTOR2I( 0, 0 );
+
+        for( const VECTOR2I& pt : pts )
+            poly.Append( aParent->GetABPosition( pt + offset ) );
+    }
 
     if( !gvconfig()->m_Display.m_DisplayPolygonsFill )
         m_gal->SetLineWidth( m_gerbviewSettings.m_outlineWidth );
 
     if( !aFilled )
+    {
         m_gal->DrawPolyline( poly.COutline( 0 ) );
+    }
     else
+    {
+        if( m_gal->IsOpenGlEngine() && !poly.IsTriangulationUpToDate() )
+            poly.CacheTriangulation( false /* fastest triangulation calculation mode */ );
+
         m_gal->DrawPolygon( poly );
+    }
 }
 
 
@@ -616,6 +631,9 @@ void GERBVIEW_PAINTER::drawApertureMacro( GERBER_DRAW_ITEM* aParent, bool aFille
     }
     else
     {
+        if( m_gal->IsOpenGlEngine() && !polyset.IsTriangulationUpToDate() )
+            polyset.CacheTriangulation( false /* fastest triangulation calculation mode */ );
+
         m_gal->DrawPolygon( polyset );
     }
 }
@@ -332,8 +332,9 @@ static void fillArcPOLY( GERBER_DRAW_ITEM* aGbrItem, const VECTOR2I& aStart, con
 {
     /* in order to calculate arc parameters, we use fillArcGBRITEM
      * so we muse create a dummy track and use its geometric parameters
+     * (a local item: files can be parsed concurrently)
      */
-    static GERBER_DRAW_ITEM dummyGbrItem( nullptr );
+    GERBER_DRAW_ITEM dummyGbrItem( nullptr );
 
     aGbrItem->SetLayerPolarity( aLayerNegative );
 
@@ -282,6 +282,17 @@ public:
      */
     bool m_DrawTriangulationOutlines;
 
+    /**
+     * Draw an on-canvas overlay with the per-frame and per-layer draw timings.
+     *
+     * The same numbers are also sent to the KICAD_GAL_PROFILE trace channel.
+     *
+     * Setting name: "ShowFrameTimingHUD"
+     * Valid values: 0 or 1
+     * Default value: 0
+     */
+    bool m_ShowFrameTimingHUD;
+
     /**
      * When true, adds zone-display-modes for stroking the zone fracture boundaries and the zone
      * triangulation.
@@ -313,6 +324,26 @@ public:
      */
     bool m_DebugZoneFiller;
 
+    /**
+     * Persist clean item-pair DRC results to a board sidecar file so that re-running DRC
+     * only evaluates pairs whose geometry or rules changed.
+     *
+     * Setting name: "EnableDRCPairCache"
+     * Valid values: 0 or 1
+     * Default value: 0
+     */
+    bool m_EnableDRCPairCache;
+
+    /**
+     * Persist zone-fill triangulations to a board sidecar file so that loading a board
+     * only re-tessellates fills whose polygons changed.
+     *
+     * Setting name: "EnableTriangulationCache"
+     * Valid values: 0 or 1
+     * Default value: 0
+     */
+    bool m_EnableTriangulationCache;
+
     /**
      * A mode that writes PDFs without compression.
      *
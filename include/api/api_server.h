@@ -31,6 +31,7 @@
 #include <kicommon.h>
 
 class API_HANDLER;
+class KINNG_PUBLISH_SERVER;
 class KINNG_REQUEST_SERVER;
 class wxEvtHandler;
 
@@ -69,6 +70,22 @@ public:
 
     std::string SocketPath() const;
 
+    /**
+     * Publishes an event message to all subscribers of the event socket.  Delivery is
+     * best-effort: the transport drops the message if no subscriber is connected.
+     *
+     * Clients subscribe by connecting an nng sub socket to EventSocketPath(), so they can
+     * react to editor changes without polling the request socket.
+     *
+     * @param aEvent is the serialized event payload
+     */
+    void Publish( const std::string& aEvent );
+
+    /// True when the event push channel is up; callers can skip serializing events otherwise
+    bool Publishing() const;
+
+    std::string EventSocketPath() const;
+
     const std::string& Token() const { return m_token; }
 
 private:
@@ -92,6 +109,8 @@ private:
 
     std::unique_ptr<KINNG_REQUEST_SERVER> m_server;
 
+    std::unique_ptr<KINNG_PUBLISH_SERVER> m_eventServer;
+
     std::set<API_HANDLER*> m_handlers;
 
     std::string m_token;
@@ -26,6 +26,7 @@
 #include <memory>
 #include <functional>
 #include <atomic>
+#include <mutex>
 
 // Forward declarations
 class wxSocketServer;
@@ -104,26 +105,47 @@ public:
      * Get the current authentication token (access token).
      * @return JWT token string, or empty if not authenticated.
      */
-    wxString GetAuthToken() const { return m_token; }
-    
+    wxString GetAuthToken() const
+    {
+        std::lock_guard<std::mutex> lock( m_tokenMutex );
+        return m_token;
+    }
+
     /**
      * Get the refresh token for transparent token renewal.
      * @return Refresh token string, or empty if not available.
      */
-    wxString GetRefreshToken() const { return m_refreshToken; }
-    
+    wxString GetRefreshToken() const
+    {
+        std::lock_guard<std::mutex> lock( m_tokenMutex );
+        return m_refreshToken;
+    }
+
     /**
      * Get the current authentication token.
      * @return JWT token string, or empty if not authenticated.
      * @deprecated Use GetAuthToken() instead.
      */
-    wxString GetToken() const { return m_token; }
-    
+    wxString GetToken() const { return GetAuthToken(); }
+
     /**
      * Refresh the access token using the stored refresh token.
-     * @return True if token was refreshed successfully.
+     *
+     * Refreshes are serialized: a caller arriving while another thread is
+     * already refreshing waits for it and then reuses the fresh token instead
+     * of issuing a second network request.
+     * @return True if a valid token is available after the call.
      */
     bool RefreshAccessToken();
+
+    /**
+     * Kick off a token refresh on a background thread if one is needed.
+     *
+     * Returns immediately; callers keep using the current token, which remains
+     * valid while it is merely expiring soon.  Concurrent calls coalesce into
+     * a single in-flight refresh.
+     */
+    void RefreshAccessTokenAsync();
     
     /**
      * Update stored tokens (called when tokens are refreshed).
@@ -138,6 +160,12 @@ public:
      * @return True if token should be refreshed proactively.
      */
     bool IsTokenExpiringSoon() const;
+
+    /**
+     * Check if the access token has actually expired.
+     * @return True if a request made now would be rejected by the backend.
+     */
+    bool IsTokenExpired() const;
     
     /**
      * Start the login flow.
@@ -305,6 +333,10 @@ private:
     
     // Track last failed refresh attempt to prevent infinite retry loops
     wxLongLong                  m_lastFailedRefreshAt; // Timestamp of last failed refresh (0 = never failed or cleared)
+
+    mutable std::mutex          m_tokenMutex;      // Guards token fields shared across UI/worker threads
+    std::mutex                  m_refreshMutex;    // Serializes refresh attempts
+    std::atomic<bool>           m_refreshInFlight; // True while a background refresh is running
     
     // Constants
     static const int            DEFAULT_CALLBACK_PORT_START = 19847;
@@ -0,0 +1,185 @@
+/*
+ * This program source code file is part of Trace, an AI-native PCB design application.
+ *
+ * Copyright The Trace Developers, see TRACE_AUTHORS.txt for contributors.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BACKGROUND_JOB_SCHEDULER_H
+#define BACKGROUND_JOB_SCHEDULER_H
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <kicommon.h>
+#include <thread_pool.h>
+#include <wx/string.h>
+
+class BACKGROUND_JOBS_MONITOR;
+class BACKGROUND_JOB_SCHEDULER;
+class BACKGROUND_JOB_WORK;
+class PROGRESS_REPORTER;
+struct BACKGROUND_JOB;
+
+/**
+ * Handle to one job submitted to BACKGROUND_JOB_SCHEDULER.
+ *
+ * Handles are shared pointers: keep one to cancel, wait on, or depend on the job; dropping
+ * it does not cancel anything.
+ */
+class KICOMMON_API SCHEDULED_JOB
+{
+    friend class BACKGROUND_JOB_SCHEDULER;
+    friend class BACKGROUND_JOB_WORK;
+
+public:
+    enum class STATE
+    {
+        PENDING,    ///< waiting on dependencies or for a pool worker
+        RUNNING,
+        FINISHED,   ///< ran to completion (or the work function threw)
+        CANCELLED   ///< cancelled before or while running
+    };
+
+    const wxString& GetName() const { return m_name; }
+    STATE GetState() const { return m_state.load(); }
+    bool IsCancelled() const { return m_cancelled.load(); }
+
+private:
+    wxString                                     m_name;
+    KICAD_TASK_PRIORITY                          m_priority = TP_PRIORITY_BATCH;
+    std::function<void( BACKGROUND_JOB_WORK& )>  m_work;
+    std::atomic<STATE>                           m_state = STATE::PENDING;
+    std::atomic<bool>                            m_cancelled = false;
+
+    /// Guarded by the scheduler mutex.
+    int                                          m_pendingDeps = 0;
+    std::vector<std::shared_ptr<SCHEDULED_JOB>>  m_dependents;
+
+    /// Monitor entry; only set while running.
+    std::shared_ptr<BACKGROUND_JOB>              m_monitorJob;
+};
+
+
+/**
+ * Context handed to a running job's work function; the job's view of the scheduler.
+ *
+ * Work functions are expected to call KeepGoing() at reasonable intervals: it blocks while
+ * the scheduler is holding background work for user interaction and returns false once the
+ * job has been cancelled, at which point the work function should unwind.
+ */
+class KICOMMON_API BACKGROUND_JOB_WORK
+{
+    friend class BACKGROUND_JOB_SCHEDULER;
+
+public:
+    /**
+     * Cooperative checkpoint: sleeps while interactive work has priority, then reports
+     * whether the job should continue.
+     */
+    bool KeepGoing() const;
+
+    bool IsCancelled() const;
+
+    /// Reporter feeding the background jobs monitor UI (progress, status text).
+    PROGRESS_REPORTER* Reporter() const;
+
+private:
+    BACKGROUND_JOB_WORK( const std::shared_ptr<void>& aCore,
+                         const std::shared_ptr<SCHEDULED_JOB>& aJob ) :
+            m_core( aCore ),
+            m_job( aJob )
+    {
+    }
+
+    std::shared_ptr<void>          m_core;
+    std::shared_ptr<SCHEDULED_JOB> m_job;
+};
+
+
+/**
+ * Runs named background jobs on the shared thread pool with priorities, dependencies and
+ * cooperative cancellation, showing each running job in BACKGROUND_JOBS_MONITOR.
+ *
+ * This replaces the ad-hoc thread + abort-flag pattern used for library scans and cache
+ * warming.  Jobs submitted at TP_PRIORITY_BATCH queue behind interactive pool work, and
+ * NotifyUserActivity() additionally pauses *running* jobs (at their KeepGoing() checkpoints)
+ * for a short window after each user input, so long jobs yield the machine the moment an
+ * interactive operation starts.
+ *
+ * Owned by PGM_BASE next to the monitor; access it via Pgm().GetBackgroundJobScheduler().
+ */
+class KICOMMON_API BACKGROUND_JOB_SCHEDULER
+{
+public:
+    BACKGROUND_JOB_SCHEDULER( BACKGROUND_JOBS_MONITOR& aMonitor );
+
+    /// Cancels outstanding jobs and blocks until running ones reach a checkpoint and unwind.
+    ~BACKGROUND_JOB_SCHEDULER();
+
+    /**
+     * Queue \a aWork to run once every job in \a aDependsOn has finished.
+     *
+     * @param aName user-visible name shown in the background jobs monitor.
+     * @param aPriority pool priority; long opportunistic work belongs at TP_PRIORITY_BATCH.
+     * @param aWork the job body; must poll BACKGROUND_JOB_WORK::KeepGoing().
+     * @param aDependsOn jobs that must finish first; if any is cancelled, this job is too.
+     */
+    std::shared_ptr<SCHEDULED_JOB> Submit( const wxString& aName, KICAD_TASK_PRIORITY aPriority,
+                                           std::function<void( BACKGROUND_JOB_WORK& )> aWork,
+                                           std::vector<std::shared_ptr<SCHEDULED_JOB>> aDependsOn = {} );
+
+    /**
+     * Request cancellation of \a aJob and, transitively, of everything depending on it.
+     * Pending jobs are dropped immediately; a running job unwinds at its next checkpoint.
+     */
+    void Cancel( const std::shared_ptr<SCHEDULED_JOB>& aJob );
+
+    void CancelAll();
+
+    /// Block until \a aJob is FINISHED or CANCELLED.
+    void Wait( const std::shared_ptr<SCHEDULED_JOB>& aJob );
+
+    /**
+     * Note that the user just did something interactive; running jobs pause at their next
+     * checkpoint until input has been quiet for a short window.
+     */
+    void NotifyUserActivity();
+
+private:
+    friend class BACKGROUND_JOB_WORK;
+
+    struct CORE;
+
+    static void enqueueJob( const std::shared_ptr<CORE>& aCore,
+                            const std::shared_ptr<SCHEDULED_JOB>& aJob );
+    static void runJob( const std::shared_ptr<CORE>& aCore,
+                        const std::shared_ptr<SCHEDULED_JOB>& aJob );
+
+    /**
+     * Mark \a aJob finished or cancelled, release dependents (cancelling them if \a aJob
+     * was cancelled), and drop it from the live list; returns jobs now ready to run.
+     */
+    static std::vector<std::shared_ptr<SCHEDULED_JOB>>
+    finishJobLocked( const std::shared_ptr<CORE>& aCore,
+                     const std::shared_ptr<SCHEDULED_JOB>& aJob );
+
+    /// Shared with worker lambdas so in-flight jobs outlive the scheduler object safely.
+    std::shared_ptr<CORE> m_core;
+};
+
+#endif // BACKGROUND_JOB_SCHEDULER_H
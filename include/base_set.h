@@ -200,9 +200,17 @@ public:
         }
         else
         {
-            BASE_SET tmp( other );
-            tmp.resize( my_size );
-            sul::dynamic_bitset<uint64_t>::operator&=( tmp );
+            // The shorter operand's missing tail reads as zero, so AND clears our tail.
+            // Work on the storage words directly rather than heap-allocating a resized copy.
+            uint64_t*       myBlocks = data();
+            const uint64_t* otherBlocks = other.data();
+            size_t          sharedBlocks = other.num_blocks();
+
+            for( size_t ii = 0; ii < sharedBlocks; ++ii )
+                myBlocks[ii] &= otherBlocks[ii];
+
+            for( size_t ii = sharedBlocks; ii < num_blocks(); ++ii )
+                myBlocks[ii] = 0;
         }
 
         return *this;
@@ -225,9 +233,14 @@ public:
         }
         else
         {
-            BASE_SET tmp( other );
-            tmp.resize( my_size );
-            sul::dynamic_bitset<uint64_t>::operator|=( tmp );
+            // The shorter operand's missing tail reads as zero, which leaves our tail
+            // unchanged; OR the shared storage words directly.
+            uint64_t*       myBlocks = data();
+            const uint64_t* otherBlocks = other.data();
+            size_t          sharedBlocks = other.num_blocks();
+
+            for( size_t ii = 0; ii < sharedBlocks; ++ii )
+                myBlocks[ii] |= otherBlocks[ii];
         }
 
         return *this;
@@ -250,9 +263,14 @@ public:
         }
         else
         {
-            BASE_SET tmp( other );
-            tmp.resize( my_size );
-            sul::dynamic_bitset<uint64_t>::operator^=( tmp );
+            // The shorter operand's missing tail reads as zero, which leaves our tail
+            // unchanged; XOR the shared storage words directly.
+            uint64_t*       myBlocks = data();
+            const uint64_t* otherBlocks = other.data();
+            size_t          sharedBlocks = other.num_blocks();
+
+            for( size_t ii = 0; ii < sharedBlocks; ++ii )
+                myBlocks[ii] ^= otherBlocks[ii];
         }
 
         return *this;
@@ -260,14 +278,32 @@ public:
 
     int compare( const BASE_SET& other ) const
     {
+        // Word-wise fast path for the common case of equal-sized sets (LSET vs LSET).
+        // Lexicographic bit order means the lowest differing bit decides.
+        if( size() == other.size() )
+        {
+            const uint64_t* myBlocks = data();
+            const uint64_t* otherBlocks = other.data();
+            size_t          blockCount = num_blocks();
+
+            for( size_t ii = 0; ii < blockCount; ++ii )
+            {
+                uint64_t diff = myBlocks[ii] ^ otherBlocks[ii];
+
+                if( diff )
+                    return ( myBlocks[ii] & ( diff & ~( diff - 1 ) ) ) ? 1 : -1;
+            }
+
+            return 0;
+        }
+
         return alg::lexicographical_compare_three_way( begin(), end(), other.begin(), other.end() );
     }
 
     // Define less-than operator for comparison
     bool operator<( const BASE_SET& other ) const
     {
-        return alg::lexicographical_compare_three_way( begin(), end(), other.begin(),
-                                                       other.end() ) < 0;
+        return compare( other ) < 0;
     }
 
     /**
@@ -442,8 +478,14 @@ public:
     protected:
         void advance_to_next_set_bit()
         {
-            while( m_index < m_baseSet.size() && !m_baseSet.test( m_index ) )
-                ++m_index;
+            const size_t bitCount = m_baseSet.size();
+
+            if( m_index >= bitCount || m_baseSet.test( m_index ) )
+                return;
+
+            // Jump to the next set bit with the underlying word-wise (ctz) search rather
+            // than probing one position at a time.
+            m_index = std::min( m_baseSet.find_next( m_index ), bitCount );
         }
 
         const BASE_SET& m_baseSet;
@@ -540,10 +582,13 @@ struct hash<BASE_SET>
 {
     size_t operator()( const BASE_SET& bs ) const
     {
-        size_t hashVal = 0;
+        // Hash the storage words rather than probing bit by bit.  The size participates
+        // because equal bit patterns of different lengths are unequal sets.
+        const uint64_t* blocks = bs.data();
+        size_t          hashVal = std::hash<size_t>()( bs.size() );
 
-        for( const auto& bit : bs )
-            hashVal = hashVal * 31 + std::hash<int>()( bit );
+        for( size_t ii = 0; ii < bs.num_blocks(); ++ii )
+            hashVal = hashVal * 31 + std::hash<uint64_t>()( blocks[ii] );
 
         return hashVal;
     }
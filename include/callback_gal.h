@@ -26,6 +26,7 @@
 
 #include <gal/gal.h>
 #include <gal/graphics_abstraction_layer.h>
+#include <geometry/seg.h>
 
 class GAL_API CALLBACK_GAL : public KIGFX::GAL
 {
@@ -69,11 +70,39 @@ public:
         m_triangulate = false;
     }
 
+    /**
+     * Buffered mode: primitives are accumulated into flat arrays and handed to the batch
+     * callbacks once per DrawGlyphs() run instead of once per segment or triangle, which
+     * eliminates the per-primitive std::function dispatch in text-to-polygon hot paths.
+     * Triangles are packed three points per triangle.
+     */
+    CALLBACK_GAL( KIGFX::GAL_DISPLAY_OPTIONS& aDisplayOptions,
+                  std::function<void( const std::vector<SEG>& aSegments )> aStrokeBatchCallback,
+                  std::function<void( const std::vector<VECTOR2I>& aTriangles )> aTriangleBatchCallback ) :
+        GAL( aDisplayOptions )
+    {
+        m_strokeBatchCallback = std::move( aStrokeBatchCallback );
+        m_triangleBatchCallback = std::move( aTriangleBatchCallback );
+        m_outlineCallback = []( const SHAPE_LINE_CHAIN& ) {};
+        m_stroke = true;
+        m_triangulate = true;
+        m_buffered = true;
+    }
+
+    ~CALLBACK_GAL()
+    {
+        flushBatches();
+    }
+
     /**
      * Draw a polygon representing an outline font glyph.
      */
     void DrawGlyph( const KIFONT::GLYPH& aGlyph, int aNth, int aTotal ) override;
 
+private:
+    /// Hand any buffered primitives to the batch callbacks and clear the buffers.
+    void flushBatches();
+
 private:
     std::function<void( const VECTOR2I& aPt1,
                         const VECTOR2I& aPt2 )> m_strokeCallback;
@@ -84,8 +113,16 @@ private:
 
     std::function<void( const SHAPE_LINE_CHAIN& aPoly )> m_outlineCallback;
 
+    std::function<void( const std::vector<SEG>& aSegments )> m_strokeBatchCallback;
+
+    std::function<void( const std::vector<VECTOR2I>& aTriangles )> m_triangleBatchCallback;
+
+    std::vector<SEG>      m_segBuffer;
+    std::vector<VECTOR2I> m_triBuffer;
+
     bool m_stroke;
     bool m_triangulate;
+    bool m_buffered = false;
 };
 
 
@@ -270,6 +270,9 @@ protected:
     void onRefreshTimer( wxTimerEvent& aEvent );
     void onShowEvent( wxShowEvent& aEvent );
 
+    /// Draw the opt-in frame timing overlay (see ADVANCED_CFG::m_ShowFrameTimingHUD).
+    void drawTimingHUD( double aFrameMs, double aUpdateMs, double aRedrawMs );
+
     wxWindow*                m_parent;           ///< Pointer to the parent window
     EDA_DRAW_FRAME*          m_edaFrame;         ///< Parent EDA_DRAW_FRAME (if available)
 
@@ -27,7 +27,8 @@
 
 #pragma once
 
-#include <set>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <wx/string.h>
 #include <undo_redo_container.h>
@@ -159,6 +160,7 @@ protected:
         m_changedItems.clear();
         m_deletedItems.clear();
         m_entries.clear();
+        m_entryIndex.clear();
     }
 
     virtual void makeEntry( EDA_ITEM* aItem, CHANGE_TYPE aType, EDA_ITEM* aCopy = nullptr,
@@ -179,9 +181,26 @@ protected:
     UNDO_REDO convert( CHANGE_TYPE aType ) const;
 
 protected:
-    std::set<std::pair<EDA_ITEM*, BASE_SCREEN*>> m_addedItems;
-    std::set<std::pair<EDA_ITEM*, BASE_SCREEN*>> m_changedItems;
-    std::set<std::pair<EDA_ITEM*, BASE_SCREEN*>> m_deletedItems;
-    std::vector<COMMIT_LINE>                     m_entries;
+    /// Hash for the (item, screen) keys of the staging bookkeeping containers.
+    struct ITEM_SCREEN_HASH
+    {
+        size_t operator()( const std::pair<EDA_ITEM*, BASE_SCREEN*>& aKey ) const
+        {
+            return std::hash<void*>()( aKey.first ) ^ ( std::hash<void*>()( aKey.second ) << 1 );
+        }
+    };
+
+    template <typename T>
+    using ITEM_SCREEN_MAP = std::unordered_map<std::pair<EDA_ITEM*, BASE_SCREEN*>, T,
+                                               ITEM_SCREEN_HASH>;
+
+    std::unordered_set<std::pair<EDA_ITEM*, BASE_SCREEN*>, ITEM_SCREEN_HASH> m_addedItems;
+    std::unordered_set<std::pair<EDA_ITEM*, BASE_SCREEN*>, ITEM_SCREEN_HASH> m_changedItems;
+    std::unordered_set<std::pair<EDA_ITEM*, BASE_SCREEN*>, ITEM_SCREEN_HASH> m_deletedItems;
+    std::vector<COMMIT_LINE>                                                 m_entries;
+
+    /// Index of the first entry for each (item, screen) pair; keeps findEntry() O(1) so that
+    /// callers polling GetStatus() per item don't go quadratic on large commits.
+    ITEM_SCREEN_MAP<size_t>                                                  m_entryIndex;
 };
 
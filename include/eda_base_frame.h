@@ -34,6 +34,7 @@
 
 
 #include <map>
+#include <memory>
 #include <optional>
 #include <vector>
 
@@ -91,6 +92,7 @@ struct WINDOW_STATE;
 class ACTION_MENU;
 class TOOL_INTERACTIVE;
 class TOOLBAR_SETTINGS;
+class SCHEDULED_JOB;
 
 #define DEFAULT_MAX_UNDO_ITEMS 0
 #define ABS_MAX_UNDO_ITEMS (INT_MAX / 2)
@@ -805,6 +807,10 @@ private:
     wxTimer*                m_autoSaveTimer;
     bool                    m_autoSavePermissionError;
 
+    // Last scheduled local-history commit; successive autosaves chain on it so commits
+    // never run concurrently
+    std::shared_ptr<SCHEDULED_JOB> m_historyCommitJob;
+
     int                     m_undoRedoCountMax;  // undo/Redo command Max depth
 
     UNDO_REDO_CONTAINER     m_undoList;          // Objects list for the undo command (old data)
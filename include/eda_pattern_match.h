@@ -52,6 +52,25 @@ struct KICOMMON_API SEARCH_TERM
             Normalized( false )
     {}
 
+    /**
+     * Normalize the term text for matching: lowercased, trimmed, and truncated.
+     * Idempotent; called lazily the first time the term is scored or indexed.
+     */
+    void Normalize()
+    {
+        if( Normalized )
+            return;
+
+        Text = Text.MakeLower().Trim( false ).Trim( true );
+
+        // Don't cause KiCad to hang if someone accidentally pastes the PCB or schematic
+        // into the search box.
+        if( Text.Length() > 1000 )
+            Text = Text.Left( 1000 );
+
+        Normalized = true;
+    }
+
     wxString Text;
     int      Score;
     bool     Normalized;
@@ -248,7 +267,10 @@ private:
     /// Add matcher if it can compile the pattern.
     void AddMatcher( const wxString& aPattern, std::unique_ptr<EDA_PATTERN_MATCH> aMatcher );
 
-    std::vector<std::unique_ptr<EDA_PATTERN_MATCH>> m_matchers;
+    ///< Compiled matcher set, shared through a per-thread LRU cache keyed by
+    ///< (pattern, context): interactive filtering constructs a fresh combined matcher
+    ///< per keystroke and pattern compilation (wxRegEx) dominates.
+    std::shared_ptr<std::vector<std::unique_ptr<EDA_PATTERN_MATCH>>> m_matchers;
     wxString m_pattern;
 };
 
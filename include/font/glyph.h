@@ -91,6 +91,15 @@ public:
      */
     void CacheTriangulation(
             std::vector<std::unique_ptr<SHAPE_POLY_SET::TRIANGULATED_POLYGON>>& aHintData );
+
+    /**
+     * Cache the triangulation for the glyph by instancing a mesh tessellated once in font
+     * units, mapping its vertices into place with \a aVertexTransform.  No tessellation is
+     * performed.
+     */
+    void CacheTriangulation(
+            const std::vector<std::unique_ptr<SHAPE_POLY_SET::TRIANGULATED_POLYGON>>& aFontUnitMesh,
+            const std::function<VECTOR2I( const VECTOR2I& )>& aVertexTransform );
 };
 
 
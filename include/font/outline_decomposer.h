@@ -60,8 +60,8 @@ struct GLYPH_DATA
 {
     std::vector<CONTOUR> m_Contours;
 
-    // Cache of the triangulation data.  We'll use this as a hint for triangulating the actual
-    // OUTLINE_GLYPHs.
+    // Shared mesh for the glyph, tessellated once in font units.  The actual OUTLINE_GLYPHs
+    // are instanced from it by transforming its vertices into place.
     std::vector<std::unique_ptr<SHAPE_POLY_SET::TRIANGULATED_POLYGON>> m_TriangulationData;
 };
 
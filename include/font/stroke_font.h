@@ -92,10 +92,21 @@ private:
      */
     void loadNewStrokeFont( const char* const aNewStrokeFont[], int aNewStrokeFontSize );
 
+    /**
+     * Parse the font data recorded by loadNewStrokeFont() if it hasn't been parsed yet.
+     *
+     * Parsing the glyph strings is deferred until a glyph is actually needed so that
+     * processes which never render stroke text (most CLI jobs) skip it entirely.
+     */
+    void ensureGlyphsLoaded() const;
+
 private:
-    const std::vector<std::shared_ptr<GLYPH>>* m_glyphs;
-    const std::vector<BOX2D>*                  m_glyphBoundingBoxes;
-    double                                     m_maxGlyphWidth;
+    const char* const*                                 m_fontData;
+    int                                                m_fontDataSize;
+
+    mutable const std::vector<std::shared_ptr<GLYPH>>* m_glyphs;
+    mutable const std::vector<BOX2D>*                  m_glyphBoundingBoxes;
+    mutable double                                     m_maxGlyphWidth;
 };
 
 } //namespace KIFONT
@@ -732,6 +732,24 @@ public:
         return true;
     };
 
+    /**
+     * Restrict rendering and target clears to the given screen-space rectangle until
+     * ClearScissor() is called.
+     *
+     * Used by the VIEW to re-rasterize only the damaged part of the cached render targets;
+     * the untouched part of their framebuffers is composited unchanged.
+     *
+     * @param aRect is the allowed drawing region, in screen pixels.
+     * @return false if the backend cannot restrict rendering; the caller has to do a full
+     *         redraw then.
+     */
+    virtual bool SetScissor( const BOX2I& aRect ) { return false; }
+
+    /**
+     * Remove the rendering restriction set by SetScissor().
+     */
+    virtual void ClearScissor() {}
+
     /**
      * Set negative draw mode in the renderer.
      *
@@ -94,6 +94,14 @@ public:
     ///< @copydoc VERTEX_CONTAINER::Unmap()
     virtual void Unmap() override = 0;
 
+    /**
+     * Mark the end of drawing from the stored data.
+     *
+     * Called by the GPU manager once all draw calls referencing the container have been
+     * issued for the current frame, so implementations may synchronize buffer reuse.
+     */
+    virtual void FinishDrawing() {}
+
     virtual unsigned int AllItemsSize() const { return 0; }
 
 protected:
@@ -57,6 +57,9 @@ public:
     ///< @copydoc VERTEX_CONTAINER::Unmap()
     void Unmap() override;
 
+    ///< @copydoc CACHED_CONTAINER::FinishDrawing()
+    void FinishDrawing() override;
+
     virtual unsigned int AllItemsSize() const override;
 
 
@@ -81,6 +84,14 @@ protected:
 
     ///< Flag saying whether it is safe to use glCopyBufferSubData
     bool m_useCopyBuffer;
+
+    ///< Flag saying whether the buffer is allocated with glBufferStorage and kept
+    ///< persistently mapped between frames (GL_ARB_buffer_storage)
+    bool m_usePersistentBuffer;
+
+    ///< Fence signalled once the GPU has finished drawing from the persistently mapped
+    ///< buffer; the following Map() waits on it before allowing CPU writes
+    GLsync m_fence;
 };
 } // namespace KIGFX
 
@@ -29,7 +29,6 @@
 
 #include <vector>
 #include <gal/opengl/vertex_common.h>
-#include <boost/scoped_array.hpp>
 
 namespace KIGFX
 {
@@ -102,21 +101,6 @@ protected:
 class GPU_CACHED_MANAGER : public GPU_MANAGER
 {
 public:
-
-    struct VRANGE
-    {
-        VRANGE( int aStart, int aEnd, bool aContinuous ) :
-                m_start( aStart ),
-                m_end( aEnd ),
-                m_isContinuous( aContinuous )
-        {
-        }
-
-        unsigned int m_start, m_end;
-        bool m_isContinuous;
-    };
-
-
     GPU_CACHED_MANAGER( VERTEX_CONTAINER* aContainer );
     ~GPU_CACHED_MANAGER();
 
@@ -136,35 +120,14 @@ public:
     void Unmap();
 
 protected:
-    ///< Resizes the indices buffer to aNewSize if necessary
-    void resizeIndices( unsigned int aNewSize );
-
     ///< Buffers initialization flag
     bool m_buffersInitialized;
 
-    ///< Pointer to the current indices buffer
-    boost::scoped_array<GLuint> m_indices;
-
-    ///< Current indices buffer size
-    unsigned int m_indicesCapacity;
-
-    ///< Ranges of visible vertex indices to render
-    std::vector<VRANGE> m_vranges;
-
-    ///< Number of huge VRANGEs (i.e. large zones) with separate draw calls
-    int m_totalHuge;
-
-    ///< Number of regular VRANGEs (small items) pooled into single draw call
-    int m_totalNormal;
-
-    ///< Current size of index buffer
-    unsigned int m_indexBufSize;
-
-    ///< Maximum size taken by the index buffer for all frames rendered so far
-    unsigned int m_indexBufMaxSize;
+    ///< First vertices of the visible items' ranges, in draw order
+    std::vector<GLint> m_vrangeFirsts;
 
-    ///< Size of the current VRANGE
-    unsigned int m_curVrangeSize;
+    ///< Vertex counts of the visible items' ranges, in draw order
+    std::vector<GLsizei> m_vrangeCounts;
 };
 
 
@@ -266,6 +266,12 @@ public:
     /// @copydoc GAL::HasTarget()
     virtual bool HasTarget( RENDER_TARGET aTarget ) override;
 
+    /// @copydoc GAL::SetScissor()
+    bool SetScissor( const BOX2I& aRect ) override;
+
+    /// @copydoc GAL::ClearScissor()
+    void ClearScissor() override;
+
     /// @copydoc GAL::SetNegativeDrawMode()
     void SetNegativeDrawMode( bool aSetting ) override {}
 
@@ -275,6 +281,12 @@ public:
     /// @copydoc GAL::EndDiffLayer()
     void EndDiffLayer() override;
 
+    /// @copydoc GAL::StartNegativesLayer()
+    void StartNegativesLayer() override;
+
+    /// @copydoc GAL::EndNegativesLayer()
+    void EndNegativesLayer() override;
+
     void ComputeWorldScreenMatrix() override;
 
     // -------
@@ -313,6 +313,12 @@ public:
         return m_transform;
     }
 
+    /// Return true if the current transformation matrix is the identity matrix.
+    bool IsTransformIdentity() const
+    {
+        return m_noTransform;
+    }
+
     /**
      * Set a shader program that is going to be used during rendering.
      *
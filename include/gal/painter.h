@@ -96,6 +96,17 @@ public:
      */
     virtual bool Draw( const VIEW_ITEM* aItem, int aLayer ) = 0;
 
+    /**
+     * Precompute expensive GAL-independent caches (e.g. polygon triangulation) for an item
+     * that is about to be drawn.
+     *
+     * May be called concurrently for different items from worker threads; implementations
+     * must not touch the GAL.
+     *
+     * @param aItem is the item to be prepared.
+     */
+    virtual void PrepareItem( const VIEW_ITEM* aItem ) {}
+
 protected:
     /// Instance of graphic abstraction layer that gives an interface to call
     /// commands used to draw (eg. DrawLine, DrawCircle, etc.)
@@ -20,6 +20,7 @@
 #ifndef JSON_SCHEMA_VALIDATOR_H
 #define JSON_SCHEMA_VALIDATOR_H
 
+#include <memory>
 #include <wx/filename.h>
 #include <kicommon.h>
 #include <json_common.h>
@@ -28,6 +29,12 @@
 class KICOMMON_API JSON_SCHEMA_VALIDATOR
 {
 public:
+    /**
+     * Construction is cheap: the schema is not read or compiled until the first Validate()
+     * call, and compiled schemas are shared process-wide (keyed by schema path and file
+     * stamp), so constructing the same validator from several frames or kifaces compiles
+     * the schema only once.
+     */
     JSON_SCHEMA_VALIDATOR( const wxFileName& aSchemaFile );
 
     ~JSON_SCHEMA_VALIDATOR() = default;
@@ -37,7 +44,12 @@ public:
                              const nlohmann::json_uri& aInitialUri = nlohmann::json_uri("#") ) const;
 
 private:
-    nlohmann::json_schema::json_validator m_validator;
+    /// Compiles the schema, or fetches an already-compiled copy from the process-wide cache
+    void compileIfNeeded() const;
+
+    wxFileName m_schemaFile;
+
+    mutable std::shared_ptr<nlohmann::json_schema::json_validator> m_validator;
 };
 
 #endif //JSON_SCHEMA_VALIDATOR_H
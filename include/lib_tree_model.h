@@ -23,9 +23,12 @@
 #ifndef LIB_TREE_MODEL_H
 #define LIB_TREE_MODEL_H
 
+#include <cstdint>
 #include <vector>
 #include <map>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
 #include <wx/string.h>
 #include <eda_pattern_match.h>
 #include <lib_tree_item.h>
@@ -78,10 +81,15 @@ public:
      * Update the score for this part. This is accumulative - it will be
      * called once per search term.
      *
-     * @param aMatcher  an EDA_COMBINED_MATCHER initialized with the search term
+     * @param aMatcher    an EDA_COMBINED_MATCHER initialized with the search term
+     * @param aCandidates optional set of item nodes that can possibly match the search
+     *                    terms (see LIB_TREE_NODE_ROOT::GetSearchCandidates()); item
+     *                    nodes not in the set are scored zero without running the
+     *                    matchers.  Pass nullptr to score every item.
      */
     virtual void UpdateScore( const std::vector<std::unique_ptr<EDA_COMBINED_MATCHER>>& aMatchers,
-                              std::function<bool( LIB_TREE_NODE& aNode )>* aFilter ) = 0;
+                              std::function<bool( LIB_TREE_NODE& aNode )>* aFilter,
+                              const std::unordered_set<LIB_TREE_NODE*>* aCandidates ) = 0;
 
     /**
      * Rebuild search terms from source search terms and shown fields.
@@ -179,7 +187,8 @@ public:
     LIB_TREE_NODE_UNIT( LIB_TREE_NODE* aParent, LIB_TREE_ITEM* aItem, int aUnit );
 
     void UpdateScore( const std::vector<std::unique_ptr<EDA_COMBINED_MATCHER>>& aMatchers,
-                      std::function<bool( LIB_TREE_NODE& aNode )>* aFilter ) override;
+                      std::function<bool( LIB_TREE_NODE& aNode )>* aFilter,
+                      const std::unordered_set<LIB_TREE_NODE*>* aCandidates ) override;
 };
 
 
@@ -219,7 +228,8 @@ public:
      * Perform the actual search.
      */
     void UpdateScore( const std::vector<std::unique_ptr<EDA_COMBINED_MATCHER>>& aMatchers,
-                      std::function<bool( LIB_TREE_NODE& aNode )>* aFilter ) override;
+                      std::function<bool( LIB_TREE_NODE& aNode )>* aFilter,
+                      const std::unordered_set<LIB_TREE_NODE*>* aCandidates ) override;
 
 protected:
     /**
@@ -261,7 +271,8 @@ public:
     LIB_TREE_NODE_ITEM& AddItem( LIB_TREE_ITEM* aItem );
 
     void UpdateScore( const std::vector<std::unique_ptr<EDA_COMBINED_MATCHER>>& aMatchers,
-                      std::function<bool( LIB_TREE_NODE& aNode )>* aFilter ) override;
+                      std::function<bool( LIB_TREE_NODE& aNode )>* aFilter,
+                      const std::unordered_set<LIB_TREE_NODE*>* aCandidates ) override;
 };
 
 
@@ -288,6 +299,11 @@ public:
      */
     LIB_TREE_NODE_LIBRARY& AddLib( wxString const& aName, wxString const& aDesc );
 
+    /**
+     * Remove the library node with the given name, if one exists.
+     */
+    void RemoveLib( wxString const& aName );
+
     /**
      * Remove a library node from the root.
      */
@@ -299,7 +315,42 @@ public:
     void Clear();
 
     void UpdateScore( const std::vector<std::unique_ptr<EDA_COMBINED_MATCHER>>& aMatchers,
-                      std::function<bool( LIB_TREE_NODE& aNode )>* aFilter ) override;
+                      std::function<bool( LIB_TREE_NODE& aNode )>* aFilter,
+                      const std::unordered_set<LIB_TREE_NODE*>* aCandidates ) override;
+
+    /**
+     * Compute the set of item nodes that can possibly match every search term, using a
+     * lazily-built trigram index over the items' normalized search-term texts.
+     *
+     * Only plain terms (alphanumeric, '_' or '-', at least three characters) can be
+     * answered from the index; terms using regex, wildcard or relational syntax could
+     * match text sharing no trigram with the pattern and are skipped.  The result is a
+     * superset of the items UpdateScore() would score non-zero, so it is safe to skip
+     * scoring everything else.
+     *
+     * @return true if aCandidates was populated; false if no term was indexable and the
+     *         caller must fall back to scoring every item.
+     */
+    bool GetSearchCandidates( const std::vector<std::unique_ptr<EDA_COMBINED_MATCHER>>& aMatchers,
+                              std::unordered_set<LIB_TREE_NODE*>& aCandidates );
+
+    /**
+     * Mark the trigram index stale.  It is rebuilt on the next GetSearchCandidates()
+     * call; any tree mutation or search-term rebuild must invalidate it.
+     */
+    void InvalidateTrigramIndex()
+    {
+        m_trigramIndex.clear();
+        m_trigramIndexValid = false;
+    }
+
+private:
+    void buildTrigramIndex();
+
+    ///< Posting lists mapping each trigram of an item's search-term texts to the items
+    ///< containing it, sorted by address so lookups can binary-search them.
+    std::unordered_map<uint32_t, std::vector<LIB_TREE_NODE*>> m_trigramIndex;
+    bool m_trigramIndexValid;
 };
 
 
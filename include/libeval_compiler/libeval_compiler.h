@@ -420,6 +420,17 @@ public:
     }
 
     VALUE* Run( CONTEXT* ctx );
+
+    /**
+     * Fold constant subexpressions into single PUSH_VALUE ops.
+     *
+     * Rule expressions are compiled once but executed per item pair, so arithmetic on
+     * literals (e.g. "0.2mm + 0.1mm") is worth collapsing at compile time.  Folding
+     * executes the candidate ops on a scratch CONTEXT, so it has exactly the runtime
+     * semantics, including the units heuristics.
+     */
+    void ConstantFold();
+
     wxString Dump() const;
 
     virtual std::unique_ptr<VAR_REF> CreateVarRef( const wxString& var, const wxString& field )
@@ -463,6 +474,11 @@ public:
 
     void Exec( CONTEXT* ctx );
 
+    int GetOp() const { return m_op; }
+
+    /// @return true if this op pushes a concrete (non-variable) value.
+    bool IsValuePush() const { return m_op == TR_UOP_PUSH_VALUE && m_value != nullptr; }
+
     wxString Format() const;
 
 private:
@@ -23,6 +23,7 @@
 
 #include <future>
 #include <memory>
+#include <unordered_map>
 
 #include <kicommon.h>
 #include <libraries/library_table.h>
@@ -303,6 +304,12 @@ public:
 
     static bool UrisAreEquivalent( const wxString& aURI1, const wxString& aURI2 );
 
+    /**
+     * Notifies all managers that the environment variables used for URI substitution have
+     * changed, invalidating any cached resolved library URIs.
+     */
+    static void EnvVarsChanged();
+
 private:
     void loadTables( const wxString& aTablePath, LIBRARY_TABLE_SCOPE aScope,
                      std::vector<LIBRARY_TABLE_TYPE> aTablesToLoad = {} );
@@ -313,6 +320,24 @@ private:
 
     void createEmptyTable( LIBRARY_TABLE_TYPE aType, LIBRARY_TABLE_SCOPE aScope );
 
+    /// Precomputed nickname lookup for one table type; validated against tableFingerprint()
+    struct ROW_CACHE
+    {
+        long long                                        fingerprint = -1;
+        std::unordered_map<wxString, LIBRARY_TABLE_ROW*> rows;
+        std::unordered_map<wxString, wxString>           resolvedUris;
+    };
+
+    /**
+     * Computes a stamp that changes whenever any table holding rows of the given type is
+     * reloaded or edited, or the substitution environment changes.  Cheap: walks table
+     * headers only, never rows.
+     */
+    long long tableFingerprint( LIBRARY_TABLE_TYPE aType ) const;
+
+    /// Returns the up-to-date row cache for a type; caller must hold m_rowCacheMutex
+    ROW_CACHE& rowCache( LIBRARY_TABLE_TYPE aType ) const;
+
     std::map<LIBRARY_TABLE_TYPE, std::unique_ptr<LIBRARY_TABLE>> m_tables;
 
     /// Map of full URI to table object for tables that are referenced by global or project tables
@@ -324,6 +349,10 @@ private:
     std::map<LIBRARY_TABLE_TYPE, std::unique_ptr<LIBRARY_MANAGER_ADAPTER>> m_adapters;
 
     mutable std::mutex m_adaptersMutex;
+
+    mutable std::map<LIBRARY_TABLE_TYPE, ROW_CACHE> m_rowCache;
+
+    mutable std::mutex m_rowCacheMutex;
 };
 
 #endif //LIBRARY_MANAGER_H
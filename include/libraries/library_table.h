@@ -190,6 +190,15 @@ public:
 
     LIBRARY_RESULT<void> Save();
 
+    /**
+     * A process-unique, monotonically-increasing stamp of the last structural change to this
+     * table.  LIBRARY_MANAGER uses it to cheaply validate its resolved-row cache.
+     */
+    long long Generation() const { return m_generation; }
+
+    /// Marks the table as structurally modified (rows added, removed, or saved)
+    void Touch();
+
     static std::map<std::string, UTF8> ParseOptions( const std::string& aOptionsList );
     static UTF8 FormatOptions( const std::map<std::string, UTF8>* aProperties );
 
@@ -212,6 +221,9 @@ private:
     wxString m_errorDescription;
 
     std::vector<LIBRARY_TABLE_ROW> m_rows;
+
+    /// Stamp of the last structural change (@see Generation)
+    long long m_generation = 0;
 };
 
 #endif //LIBRARY_TABLE_H
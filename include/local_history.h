@@ -72,6 +72,16 @@ public:
     /** Run all registered savers and, if any staged changes differ from HEAD, create a commit. */
     bool RunRegisteredSaversAndCommit( const wxString& aProjectPath, const wxString& aTitle );
 
+    /** Run all registered savers and return the exported files (filtered to the project
+     *  directory).  Must be called on the UI thread; savers read live documents. */
+    std::vector<wxString> RunRegisteredSavers( const wxString& aProjectPath );
+
+    /** Stage the given files into the history mirror and commit if the result differs from
+     *  HEAD.  Touches no LOCAL_HISTORY state beyond the repository lock, so it may run off
+     *  the UI thread once the files are fully written. */
+    bool CommitFiles( const wxString& aProjectPath, const std::vector<wxString>& aFiles,
+                      const wxString& aTitle );
+
     /** Record that a file has been modified and should be included in the next snapshot. */
     void NoteFileChange( const wxString& aFile );
 
@@ -0,0 +1,139 @@
+/*
+ * This program source code file is part of Trace, an AI-native PCB design application.
+ *
+ * Copyright The Trace Developers, see TRACE_AUTHORS.txt for contributors.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include <core/profile.h>
+#include <kicommon.h>
+#include <nlohmann/json_fwd.hpp>
+
+class wxString;
+
+/**
+ * A process-wide registry of named performance counters and duration histograms.
+ *
+ * Unlike PROF_TIMER, which measures a single run and prints to a trace channel, this registry
+ * accumulates across a whole session so that slowness reports can be quantified: how many zone
+ * fills, how long each took, how the numbers compare between two versions.  Hot sites record
+ * into it unconditionally - a sample is one mutex lock plus a few adds, which is noise next to
+ * the operations being measured (fills, DRC, saves, frame paints).
+ *
+ * The accumulated data can be exported as JSON, either explicitly (the AI executor's
+ * get_perf_counters tool) or automatically at process exit when the KICAD_PERF_COUNTERS
+ * environment variable names an output file (the kicad-cli path).
+ */
+class KICOMMON_API PERF_COUNTERS
+{
+public:
+    static PERF_COUNTERS& Get();
+
+    /**
+     * Add \a aDelta to the named event counter, creating it at zero if needed.
+     */
+    void Increment( const std::string& aName, int64_t aDelta = 1 );
+
+    /**
+     * Overwrite the named counter with \a aValue (gauge semantics, e.g. current memory usage
+     * rather than a cumulative event count).
+     */
+    void Set( const std::string& aName, int64_t aValue );
+
+    /**
+     * Record one duration sample against the named histogram.
+     */
+    void RecordDuration( const std::string& aName, const std::chrono::nanoseconds& aDuration );
+
+    /**
+     * Export all counters and histograms, e.g.:
+     * @code
+     * { "version": "...",
+     *   "counters": { "zone_fill.zones": 12 },
+     *   "durations": { "zone_fill": { "count": 3, "total_ms": ..., "min_ms": ..., "max_ms": ...,
+     *                                 "mean_ms": ..., "histogram_us": { "1024": 2, ... } } } }
+     * @endcode
+     * Histogram keys are power-of-two bucket lower bounds in microseconds.
+     */
+    nlohmann::json ExportJson() const;
+
+    /**
+     * Write ExportJson() to \a aPath; returns false (and logs) on I/O failure.
+     */
+    bool WriteJsonFile( const wxString& aPath ) const;
+
+    /**
+     * Drop all accumulated data (a new baseline run without restarting).
+     */
+    void Reset();
+
+private:
+    PERF_COUNTERS() = default;
+
+    struct DURATION_STAT
+    {
+        int64_t count = 0;
+        int64_t totalNs = 0;
+        int64_t minNs = INT64_MAX;
+        int64_t maxNs = 0;
+
+        ///< Bucket N counts samples in [2^N, 2^(N+1)) microseconds; bucket 0 also holds sub-µs.
+        std::array<int64_t, 32> buckets{};
+    };
+
+    mutable std::mutex                   m_mutex;
+    std::map<std::string, int64_t>       m_counters;
+    std::map<std::string, DURATION_STAT> m_durations;
+};
+
+/**
+ * RAII helper recording the lifetime of a scope into PERF_COUNTERS.
+ *
+ *     {
+ *         PERF_SCOPED_SAMPLE sample( "zone_fill" );
+ *         fill();
+ *     }
+ */
+class KICOMMON_API PERF_SCOPED_SAMPLE
+{
+public:
+    PERF_SCOPED_SAMPLE( const std::string& aName ) :
+            m_name( aName ),
+            m_timer( aName )
+    {
+    }
+
+    ~PERF_SCOPED_SAMPLE()
+    {
+        PERF_COUNTERS::Get().RecordDuration( m_name,
+                m_timer.SinceStart<std::chrono::nanoseconds>() );
+    }
+
+private:
+    std::string m_name;
+    PROF_TIMER  m_timer;
+};
+
+#endif // PERF_COUNTERS_H
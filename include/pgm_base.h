@@ -52,6 +52,8 @@ class wxSingleInstanceChecker;
 
 struct BACKGROUND_JOB;
 class BACKGROUND_JOBS_MONITOR;
+class BACKGROUND_JOB_SCHEDULER;
+class SCHEDULED_JOB;
 class NOTIFICATIONS_MANAGER;
 class COMMON_SETTINGS;
 class SETTINGS_MANAGER;
@@ -135,6 +137,8 @@ public:
 
     virtual BACKGROUND_JOBS_MONITOR& GetBackgroundJobMonitor() const { return *m_background_jobs_monitor; }
 
+    virtual BACKGROUND_JOB_SCHEDULER& GetBackgroundJobScheduler() const { return *m_background_job_scheduler; }
+
     virtual NOTIFICATIONS_MANAGER& GetNotificationsManager() const { return *m_notifications_manager; }
 
 #ifdef KICAD_IPC_API
@@ -375,6 +379,9 @@ protected:
     std::unique_ptr<SETTINGS_MANAGER>        m_settings_manager;
     std::unique_ptr<LIBRARY_MANAGER>         m_library_manager;
     std::unique_ptr<BACKGROUND_JOBS_MONITOR> m_background_jobs_monitor;
+
+    /// Declared after the monitor: the scheduler's destructor drains jobs that report to it.
+    std::unique_ptr<BACKGROUND_JOB_SCHEDULER> m_background_job_scheduler;
     std::unique_ptr<NOTIFICATIONS_MANAGER>   m_notifications_manager;
 
     std::unique_ptr<SCRIPTING>                   m_python_scripting;
@@ -416,10 +423,7 @@ protected:
 
     wxSplashScreen* m_splash;
 
-    std::shared_ptr<BACKGROUND_JOB> m_libraryPreloadBackgroundJob;
-    std::future<void>               m_libraryPreloadReturn;
-    std::atomic_bool                m_libraryPreloadInProgress;
-    std::atomic_bool                m_libraryPreloadAbort;
+    std::shared_ptr<SCHEDULED_JOB> m_libraryPreloadJob;
 };
 
 
@@ -23,6 +23,8 @@
 #include "plotter.h"
 #include "gbr_plotter_apertures.h"
 
+#include <fmt/format.h>
+
 class SHAPE_ARC;
 class GBR_METADATA;
 
@@ -326,9 +328,18 @@ protected:
      * coordinate.
      *
      * For n decimal positions, see header generation in start_plot.
+     *
+     * Coordinates are modal in RS-274X, so an ordinate equal to the last emitted one is
+     * omitted.  When m_batchedEmit is set the record is only appended to m_emitBuffer;
+     * flushEmitBuffer() must be called before anything else is written to the file.
      */
     void emitDcode( const VECTOR2D& pt, int dcode );
 
+    /**
+     * Write the coordinate records pending in m_emitBuffer to the output file.
+     */
+    void flushEmitBuffer();
+
     /**
      * Print a Gerber net attribute object record.
      *
@@ -370,6 +381,13 @@ protected:
 
     std::vector<APERTURE> m_apertures;  // The list of available apertures
     int     m_currentApertureIdx;       // The index of the current aperture in m_apertures
+
+    fmt::memory_buffer m_emitBuffer;    // Batches the coordinate records of a vertex run so a
+                                        // region is written with one stdio call per run
+    bool    m_batchedEmit;              // When true emitDcode() only appends to m_emitBuffer
+    int     m_lastEmitX;                // Last emitted ordinates; RS-274X coordinates are
+    int     m_lastEmitY;                // modal, so unchanged ordinates are not repeated
+    bool    m_lastEmitValid;            // False until a full X/Y pair has been emitted
     bool    m_hasApertureRoundRect;     // true is at least one round rect aperture is in use
     bool    m_hasApertureRotOval;       // true is at least one oval rotated aperture is in use
     bool    m_hasApertureRotRect;       // true is at least one rect. rotated aperture is in use
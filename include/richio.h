@@ -29,6 +29,7 @@
 // "richio" after its author, Richard Hollenbeck, aka Dick Hollenbeck.
 
 
+#include <future>
 #include <vector>
 #include <core/utf8.h>
 
@@ -247,6 +248,45 @@ protected:
 };
 
 
+/**
+ * A #LINE_READER that reads the whole file into memory up front and serves lines as
+ * pointers into that single buffer.
+ *
+ * Unlike #FILE_LINE_READER there is no per-line copy into a separate line buffer; each
+ * line is nul terminated in place and the overwritten byte is restored on the next read.
+ * This keeps tokenization of very large s-expression files bandwidth-bound instead of
+ * allocator-bound, at the cost of holding the entire file in memory while parsing.
+ *
+ * @note A returned line is only valid until the next call to ReadLine() or Rewind().
+ */
+class KICOMMON_API WHOLE_FILE_LINE_READER : public LINE_READER
+{
+public:
+    /**
+     * Read the entire contents of \a aFileName into the internal buffer.
+     *
+     * @throw IO_ERROR if \a aFileName cannot be opened.
+     */
+    WHOLE_FILE_LINE_READER( const wxString& aFileName, unsigned aStartingLineNumber = 0 );
+
+    ~WHOLE_FILE_LINE_READER();
+
+    char* ReadLine() override;
+
+    /**
+     * Rewind to the start of the buffer and reset the line number back to zero.
+     *
+     * Line number will go to 1 on first ReadLine().
+     */
+    void Rewind();
+
+protected:
+    std::string m_buffer;       ///< The entire file; lines are nul terminated in place.
+    size_t      m_ndx;          ///< Start of the next line in m_buffer.
+    char        m_savedChar;    ///< Byte displaced by the current line's nul terminator.
+};
+
+
 /**
  * Is a #LINE_READER that reads from a multiline 8 bit wide std::string
  */
@@ -528,16 +568,28 @@ public:
     ~PRETTIFIED_FILE_OUTPUTFORMATTER();
 
     /**
-     * Performs prettification and writes the stored buffer to the file.
+     * Performs prettification and writes the stored buffer to a temporary file alongside the
+     * destination, which is then atomically renamed over it, so an interrupted save never
+     * leaves a truncated file behind.
      * @return true if the write succeeded.
      */
     bool Finish() override;
 
+    /**
+     * Like #Finish(), but performs the prettification, disk write and atomic rename on a
+     * background thread so the caller can overlap other work.  The formatter gives up its
+     * buffer and may be destroyed before the write completes; any #IO_ERROR raised by the
+     * write is rethrown from the returned future's get().
+     */
+    std::future<bool> FinishAsync();
+
 protected:
     void write( const char* aOutBuf, int aCount ) override;
 
 private:
     FILE* m_fp;
+    wxString m_filename;            ///< final destination of the atomic rename
+    wxString m_tempFilename;        ///< scratch file actually written to
     std::string m_buf;
     KICAD_FORMAT::FORMAT_MODE m_mode;
 };
@@ -23,6 +23,7 @@
 
 #include <algorithm>
 #include <mutex>
+#include <set>
 #include <typeinfo>
 #include <core/wx_stl_compat.h> // for wxString hash
 #include <settings/color_settings.h>
@@ -153,6 +154,10 @@ public:
             // Do NOT use dynamic_cast here.  CLang will think it's the wrong class across
             // compile boundaries and return nullptr.
             ret = static_cast<T*>( it->get() );
+
+            // Settings registered with aLoadNow = false are loaded on first access, which
+            // keeps rarely-used stores (and their legacy migrations) off the startup path.
+            loadIfPending( ret );
         }
         else
         {
@@ -200,6 +205,8 @@ public:
             // Do NOT use dynamic_cast here.  CLang will think it's the wrong class across
             // compile boundaries and return nullptr.
             ret = static_cast<T*>( it->get() );
+
+            loadIfPending( ret );
         }
         else
         {
@@ -448,6 +455,14 @@ public:
 private:
     JSON_SETTINGS* registerSettings( JSON_SETTINGS* aSettings, bool aLoadNow = true );
 
+    /**
+     * Load the given settings object from disk if its load was deferred at registration time.
+     *
+     * Does nothing for settings that have already been loaded.  Safe to call re-entrantly:
+     * legacy migrations triggered by the load may call GetAppSettings() for other stores.
+     */
+    void loadIfPending( JSON_SETTINGS* aSettings );
+
     /**
      * Compare two settings versions, like "5.99" and "6.0".
      *
@@ -507,9 +522,16 @@ private:
 
     std::unordered_map<wxString, COLOR_SETTINGS*> m_color_settings;
 
+    /// Settings registered with aLoadNow = false that have not yet been loaded from disk.
+    /// Guarded by m_app_settings_mutex.
+    std::set<JSON_SETTINGS*> m_pendingLoad;
+
     /// Cache for app settings
     std::unordered_map<size_t, JSON_SETTINGS*> m_app_settings_cache;
-    std::mutex m_app_settings_mutex;
+
+    /// Recursive because a deferred load can run a legacy migration that re-enters
+    /// GetAppSettings() for the stores it migrates data into.
+    std::recursive_mutex m_app_settings_mutex;
 
     // Convenience shortcut
     COMMON_SETTINGS* m_common_settings;
@@ -35,6 +35,14 @@
 
 void ConvertMarkdown2Html( const wxString& aMarkdownInput, wxString& aHtmlOutput );
 
+/**
+ * Convert Markdown to HTML, memoizing the result.
+ *
+ * Repeated conversions of the same source -- message re-renders, re-opened help dialogs --
+ * return the cached HTML without re-running the parser.
+ */
+void ConvertMarkdown2HtmlCached( const wxString& aMarkdownInput, wxString& aHtmlOutput );
+
 /**
  * Convert the old `~...~` overbar notation to the new `~{...}` one.
  */
@@ -30,6 +30,20 @@
 
 using thread_pool = BS::priority_thread_pool;
 
+/**
+ * Priority classes for tasks submitted to the shared pool.
+ *
+ * Every subsystem contends on the same workers, so long-running batch work (zone fills, DRC,
+ * exporters, 3D tessellation) must not queue ahead of tasks an interactive tool is blocked on.
+ * Pass one of these as the trailing priority argument of submit_task() / submit_loop().
+ */
+enum KICAD_TASK_PRIORITY : BS::priority_t
+{
+    TP_PRIORITY_BATCH       = BS::pr::low,    ///< background work nobody is waiting on yet
+    TP_PRIORITY_INCREMENTAL = BS::pr::normal, ///< work tied to completing an edit
+    TP_PRIORITY_INTERACTIVE = BS::pr::high    ///< work an interactive tool blocks on
+};
+
 /**
  * Get a reference to the current thread pool.  N.B., you cannot copy the thread pool
  * so if you accidentally write thread_pool tp = GetKiCadThreadPool(), you will break
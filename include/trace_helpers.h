@@ -255,6 +255,13 @@ extern KICOMMON_API const wxChar* const traceEnvVars;
  */
 extern KICOMMON_API const wxChar* const traceGalProfile;
 
+/**
+ * Flag to enable debug output of per-test ERC timing.
+ *
+ * Use "KICAD_ERC_PROFILE" to enable.
+ */
+extern KICOMMON_API const wxChar* const traceErcProfile;
+
 /**
  * Flag to enable KiCad2Step debug tracing.
  *
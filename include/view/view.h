@@ -411,6 +411,9 @@ public:
             // Target has to be redrawn after changing its visibility
             MarkTargetDirty( layer.target );
             layer.visible = aVisible;
+
+            // Layer visibility feeds the items' ViewGetLOD() calculations
+            MarkLODsDirty();
         }
     }
 
@@ -598,6 +601,25 @@ public:
      */
     virtual void Redraw();
 
+    /// Per-layer draw statistics of the last redraw (see GetLastLayerTimings()).
+    struct LAYER_TIMING
+    {
+        int    layer;        ///< Layer number.
+        int    itemCount;    ///< Number of items drawn on the layer.
+        double durationMs;   ///< CPU time spent drawing the layer, in milliseconds.
+    };
+
+    /**
+     * Return the per-layer draw timings collected during the last redraw.
+     *
+     * The timings are only collected when the KICAD_GAL_PROFILE trace channel or the
+     * ShowFrameTimingHUD advanced config flag is enabled; otherwise the list is empty.
+     */
+    const std::vector<LAYER_TIMING>& GetLastLayerTimings() const
+    {
+        return m_lastLayerTimings;
+    }
+
     /**
      * Rebuild GAL display lists.
      */
@@ -640,6 +662,11 @@ public:
     {
         wxCHECK( aTarget < TARGETS_NUMBER, /* void */ );
         m_dirtyTargets[aTarget] = true;
+
+        // The extent of the change is unknown at this point, so the next redraw cannot be
+        // restricted to a damage region.  Per-item updates committed via UpdateItems()
+        // re-establish a bounded damage extent themselves.
+        m_damageFull = true;
     }
 
     /// Return true if the layer is cached.
@@ -653,6 +680,17 @@ public:
         return it->second.target == TARGET_CACHED;
     }
 
+    /**
+     * Force recalculation of the items' cached ViewGetLOD() results.
+     *
+     * Has to be called whenever state feeding the LOD calculations (render settings,
+     * layer visibility) changes outside of the items themselves.
+     */
+    void MarkLODsDirty()
+    {
+        ++m_lodGeneration;
+    }
+
     /**
      * Force redraw of view on the next rendering.
      */
@@ -660,6 +698,8 @@ public:
     {
         for( int i = 0; i < TARGETS_NUMBER; ++i )
             m_dirtyTargets[i] = true;
+
+        m_damageFull = true;
     }
 
     /**
@@ -775,6 +815,23 @@ protected:
     /// Redraw contents within rectangle \a aRect.
     void redrawRect( const BOX2I& aRect );
 
+    /**
+     * Restrict the GAL to the screen-space projection of the accumulated damage extent.
+     *
+     * Called when the damage is bounded (i.e. only per-item updates happened since the
+     * last redraw), so target clears and the following redraw touch only the damaged
+     * region while the rest of the cached framebuffers is reused.
+     *
+     * @return true if the GAL accepted the restriction; false means a full redraw.
+     */
+    bool setDamageScissor();
+
+    /**
+     * Return the cached ViewGetLOD() result for an item on a layer, recomputing it only
+     * when the item or the LOD-related view state has changed.
+     */
+    double itemLOD( const VIEW_ITEM* aItem, int aLayer ) const;
+
     inline void markTargetClean( int aTarget )
     {
         wxCHECK( aTarget < TARGETS_NUMBER, /* void */ );
@@ -893,6 +950,24 @@ protected:
     /// Flag to mark targets as dirty so they have to be redrawn on the next refresh event.
     bool m_dirtyTargets[TARGETS_NUMBER];
 
+    /// Accumulated world-space extent of per-item updates since the last redraw.
+    BOX2I m_damage;
+
+    /// True if m_damage holds a valid extent.
+    bool m_damageValid;
+
+    /// True if the whole viewport has to be redrawn (damage of unknown extent).
+    bool m_damageFull;
+
+    /// True while the GAL is restricted to the damage region by setDamageScissor().
+    bool m_damageScissor;
+
+    /// Generation counter for the items' cached level-of-detail values.
+    int m_lodGeneration;
+
+    /// Per-layer draw timings of the last redraw (only filled when profiling is enabled).
+    std::vector<LAYER_TIMING> m_lastLayerTimings;
+
     /// Flag to respect draw priority when drawing items.
     bool m_useDrawPriority;
 
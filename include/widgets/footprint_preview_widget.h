@@ -37,6 +37,10 @@ class EDA_DRAW_PANEL_GAL;
 class wxStaticText;
 class wxSizer;
 
+// Fired by a FOOTPRINT_PREVIEW_WIDGET when an asynchronous DisplayFootprint request has
+// completed.  GetInt() is non-zero if the footprint was found and displayed.
+wxDECLARE_EVENT( FP_PREVIEW_LOADED_EVENT, wxCommandEvent );
+
 
 class FOOTPRINT_PREVIEW_WIDGET: public wxPanel
 {
@@ -129,9 +133,18 @@ public:
     /**
      * Set the currently displayed footprint. Any footprint passed in here *MUST* have been
      * passed to CacheFootprint before.
+     *
+     * @return true if the footprint was displayed immediately; false if it is being loaded
+     *         asynchronously, in which case the load handler reports the result.
      */
     virtual bool DisplayFootprint( LIB_ID const& aFPID ) = 0;
 
+    /**
+     * Set a callback invoked (on the UI thread) when an asynchronous DisplayFootprint request
+     * completes.  The argument is true if the footprint was found and displayed.
+     */
+    virtual void SetLoadHandler( std::function<void( bool aFootprintFound )> aHandler ) {}
+
     /**
      * Display a pair of footprints.  (Normally used for diff'ing.)
      */
@@ -564,6 +564,12 @@ public:
     virtual size_t GetCount() const = 0;
     virtual int GetSweepCount() const { return 1; }
 
+    /** Informs the layer of the visible x range and plot width in pixels before enumeration with
+     *  Rewind() / GetNextXY() begins.  Layers holding more samples than the plot can resolve may
+     *  use this to enumerate a decimated view of their data.  The default does nothing.
+     */
+    virtual void SetViewWindow( double aXMin, double aXMax, int aPixelWidth ) {}
+
     /** Layer plot handler.
      *  This implementation will plot the locus in the visible area and put a label according to
      *  the alignment specified.
@@ -1452,11 +1458,32 @@ public:
     size_t GetCount() const override { return m_xs.size(); }
     int GetSweepCount() const override { return m_sweepCount; }
 
+    /** Selects the min/max envelope level matching the visible range and resolution, so that very
+     *  large traces are enumerated from roughly twice the plot width in bins rather than at full
+     *  resolution.  Overridden in this implementation.
+     */
+    void SetViewWindow( double aXMin, double aXMax, int aPixelWidth ) override;
+
 protected:
-    /** The internal copy of the set of data to draw.
+    /** The internal copy of the set of points to draw.
      */
     std::vector<double> m_xs, m_ys;
 
+    /** One level of the min/max envelope pyramid built at SetData() for large traces.  Each bin
+     *  holds the exact minimum and maximum y over binSize consecutive samples, so rendering from
+     *  a level preserves the exact envelope of the full-resolution data.
+     */
+    struct ENVELOPE_LEVEL
+    {
+        size_t              binSize;    // number of raw samples per bin
+        std::vector<double> minY;       // per-bin minimum
+        std::vector<double> maxY;       // per-bin maximum
+    };
+
+    /** (Re)builds the envelope pyramid from the current data, if it is large enough to benefit.
+     */
+    void buildEnvelope();
+
     size_t m_index;           // internal counter for the "GetNextXY" interface
     size_t m_sweepWindow;     // last m_index of the current sweep
 
@@ -1466,6 +1493,13 @@ protected:
     int    m_sweepCount = 1;                                   // sweeps to split data into
     size_t m_sweepSize = std::numeric_limits<size_t>::max();   // data-points in each sweep
 
+    std::vector<ENVELOPE_LEVEL> m_envelope;             // envelope pyramid, finest level first
+    int    m_envLevel = -1;   // active envelope level for enumeration, or -1 for full resolution
+    size_t m_envStart = 0;    // first bin of the decimated enumeration
+    size_t m_envEnd = 0;      // one-past-last bin of the decimated enumeration
+    size_t m_envIndex = 0;    // current bin during decimated enumeration
+    bool   m_envEmitMax = false;    // alternates min/max emission within the current bin
+
     /** Rewind value enumeration with mpFXY::GetNextXY.
      *  Overridden in this implementation.
      */
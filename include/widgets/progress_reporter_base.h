@@ -33,6 +33,9 @@
 
 /**
  * This implements all the tricky bits for thread safety, but the GUI is left to derived classes.
+ *
+ * Workers only bump relaxed atomic counters; the UI side samples them from its own timer
+ * (KeepRefreshing() / updateUI()), so progress reporting never serializes parallel workloads.
  */
 class KICOMMON_API PROGRESS_REPORTER_BASE : public PROGRESS_REPORTER
 {
@@ -105,7 +108,8 @@ public:
      */
     void SetTitle( const wxString& aTitle ) override { }
 
-    bool IsCancelled() const override { return m_cancelled; }
+    // Polled per item from worker loops; a relaxed load keeps the check free on the hot path.
+    bool IsCancelled() const override { return m_cancelled.load( std::memory_order_relaxed ); }
 
     int CurrentProgress() const;
 
@@ -53,6 +53,7 @@
 #include <trace_helpers.h>
 #include <wildcards_and_files_ext.h>
 #include <confirm.h>
+#include <core/profile.h>
 
 #include <git/git_backend.h>
 #include <git/libgit_backend.h>
@@ -126,6 +127,8 @@ bool PGM_KICAD::OnPgmInit()
         { wxCMD_LINE_SWITCH, nullptr, "software-rendering", "Use software rendering instead of OpenGL",
           wxCMD_LINE_VAL_NONE, 0 },
 #endif
+        { wxCMD_LINE_SWITCH, nullptr, "profile-startup", "Report per-phase startup times on stderr",
+          wxCMD_LINE_VAL_NONE, 0 },
         { wxCMD_LINE_PARAM, nullptr, nullptr, "File to load", wxCMD_LINE_VAL_STRING,
           wxCMD_LINE_PARAM_MULTIPLE | wxCMD_LINE_PARAM_OPTIONAL },
         { wxCMD_LINE_NONE, nullptr, nullptr, nullptr, wxCMD_LINE_VAL_NONE, 0 }
@@ -135,6 +138,16 @@ bool PGM_KICAD::OnPgmInit()
     parser.SetDesc( desc );
     parser.Parse( false );
 
+    const bool profileStartup = parser.Found( "profile-startup" );
+    PROF_TIMER startupTimer( "startup" );
+
+    auto reportPhase =
+            [&]( const char* aPhase )
+            {
+                if( profileStartup )
+                    fprintf( stderr, "startup: %-36s %8.1f ms\n", aPhase, startupTimer.msecs( true ) );
+            };
+
     FRAME_T appType = KICAD_MAIN_FRAME_T;
 
     const struct
@@ -196,6 +209,8 @@ bool PGM_KICAD::OnPgmInit()
     if( !InitPgm( false, skipPythonInit ) )
         return false;
 
+    reportPhase( "InitPgm (settings, fonts, python)" );
+
     // Set library environment variables at runtime using stock paths
     // This ensures paths are correct regardless of where Trace is installed
 #ifdef _WIN32
@@ -258,10 +273,14 @@ bool PGM_KICAD::OnPgmInit()
             m_bm.m_search.Insert( it->second.GetValue(), 0 );
     }
 
+    reportPhase( "app settings + template paths" );
+
     // Restore authentication session from keychain before creating any frames
     // This ensures the Account menu shows the correct state in all windows
     AUTH_MANAGER::Instance().TryRestoreSession();
 
+    reportPhase( "auth session restore" );
+
     wxFrame*      frame = nullptr;
     KIWAY_PLAYER* playerFrame = nullptr;
     KICAD_MANAGER_FRAME* managerFrame = nullptr;
@@ -289,6 +308,8 @@ bool PGM_KICAD::OnPgmInit()
         }
     }
 
+    reportPhase( "main frame creation" );
+
     Pgm().App().SetTopWindow( frame );
 
     if( playerFrame )
@@ -303,6 +324,8 @@ bool PGM_KICAD::OnPgmInit()
 
     GetLibraryManager().LoadGlobalTables();
 
+    reportPhase( "global library tables" );
+
 #ifdef KICAD_IPC_API
     m_api_server = std::make_unique<KICAD_API_SERVER>();
     m_api_common_handler = std::make_unique<API_HANDLER_COMMON>();
@@ -427,6 +450,11 @@ bool PGM_KICAD::OnPgmInit()
     frame->Show( true );
     frame->Raise();
 
+    reportPhase( "project load + show" );
+
+    if( profileStartup )
+        fprintf( stderr, "startup: %-36s %8.1f ms\n", "total", startupTimer.msecs() );
+
 #ifdef KICAD_IPC_API
     m_api_server->SetReadyToReply();
 #endif
@@ -31,6 +31,7 @@
 
 #include <kiway.h>
 #include <libraries/library_manager.h>
+#include <perf_counters.h>
 #include <string_utils.h>
 #include <paths.h>
 #include <settings/settings_manager.h>
@@ -461,6 +462,16 @@ int PGM_KICAD::OnPgmRun()
     {
         int exitCode = cliCmd->Perform( Kiway );
 
+        // Opt-in perf baseline: KICAD_PERF_COUNTERS=<file> dumps the counters accumulated
+        // while the command ran (fills, DRC, saves, ...) as JSON for later comparison.
+        wxString perfCountersPath;
+
+        if( wxGetEnv( wxT( "KICAD_PERF_COUNTERS" ), &perfCountersPath )
+                && !perfCountersPath.IsEmpty() )
+        {
+            PERF_COUNTERS::Get().WriteJsonFile( perfCountersPath );
+        }
+
         if( exitCode != CLI::EXIT_CODES::AVOID_CLOSING )
         {
             return exitCode;
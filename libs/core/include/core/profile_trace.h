@@ -0,0 +1,166 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright The KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, you may find one here:
+ * http://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+ * or you may search the http://www.gnu.org website for the version 2 license,
+ * or you may write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
+ */
+
+/**
+ * @file profile_trace.h
+ * @brief Structured tracing built on the clocks in profile.h.
+ *
+ * Unlike PROF_TIMER, which prints a line to stderr, TRACE_SCOPE records named, timestamped
+ * events into a fixed-size in-memory ring buffer which can be dumped on demand as Chrome
+ * trace-event JSON and opened in about://tracing or Perfetto, giving a timeline of a slow
+ * session instead of isolated numbers.
+ *
+ * Recording is lock-free (one atomic increment per event) and disabled by default, so
+ * instrumentation can stay in release builds.  Set the KICAD_TRACE_FILE environment variable
+ * to a file path to enable recording at startup and dump the buffer there on exit, or drive
+ * TRACE_RECORDER programmatically.
+ *
+ * This is the timeline-level complement of PERF_COUNTERS (include/perf_counters.h), which
+ * accumulates whole-session aggregates of the same hot paths.
+ */
+
+#ifndef PROFILE_TRACE_H
+#define PROFILE_TRACE_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <core/profile.h>
+
+/**
+ * Collects trace events in a lock-free ring buffer; oldest events are overwritten once the
+ * buffer is full, so a dump always holds the most recent window of activity.
+ */
+class TRACE_RECORDER
+{
+public:
+    static TRACE_RECORDER& Instance();
+
+    bool IsEnabled() const { return m_enabled.load( std::memory_order_relaxed ); }
+
+    /**
+     * Turn recording on or off.  The event buffer is allocated on first enable; disabling
+     * keeps the buffered events for dumping.
+     */
+    void Enable( bool aEnable );
+
+    /**
+     * Record a completed duration event.
+     *
+     * @param aName event name shown on the timeline; truncated to fit EVENT::Name
+     * @param aCategory trace category (used for filtering in the viewer)
+     * @param aStartUs start time from GetRunningMicroSecs()
+     * @param aDurationUs duration in microseconds
+     */
+    void RecordComplete( const char* aName, const char* aCategory, int64_t aStartUs,
+                         int64_t aDurationUs );
+
+    /**
+     * Record an instantaneous event (a vertical marker on the timeline).
+     */
+    void RecordInstant( const char* aName, const char* aCategory );
+
+    /**
+     * Serialize the buffered events as Chrome trace-event JSON.
+     *
+     * Events recorded concurrently with the dump may be dropped or torn; dump from a
+     * quiescent point (or after Enable( false )) for an exact snapshot.
+     */
+    std::string DumpJson() const;
+
+    /**
+     * Write DumpJson() to a file.
+     *
+     * @return true if the file was written
+     */
+    bool DumpToFile( const std::string& aPath ) const;
+
+    void Clear();
+
+private:
+    TRACE_RECORDER();
+    ~TRACE_RECORDER();
+
+    struct EVENT
+    {
+        char        Name[48];
+        const char* Category;
+        int64_t     StartUs;
+        int64_t     DurationUs;
+        uint32_t    ThreadId;
+        char        Phase;          // 'X' = complete, 'i' = instant
+    };
+
+    void record( const char* aName, const char* aCategory, int64_t aStartUs,
+                 int64_t aDurationUs, char aPhase );
+
+    ///< Events kept before the oldest are overwritten (must be a power of two)
+    static constexpr size_t BUFFER_SIZE = 1 << 15;
+
+    std::vector<EVENT>    m_events;
+    std::atomic<uint64_t> m_next;       // total events recorded; index is m_next % BUFFER_SIZE
+    std::atomic<bool>     m_enabled;
+    std::string           m_dumpPath;   // from KICAD_TRACE_FILE; dumped on destruction
+};
+
+
+/**
+ * RAII duration event: records the lifetime of the scope into TRACE_RECORDER.
+ *
+ * Costs a single relaxed atomic load when recording is disabled, so it can be left in hot
+ * paths.  For example:
+ *
+ * void ZONE_FILLER::Fill( ... )
+ * {
+ *     TRACE_SCOPE trace( "ZONE_FILLER::Fill", "pcbnew" );
+ *     ...
+ * }
+ */
+class TRACE_SCOPE
+{
+public:
+    TRACE_SCOPE( const char* aName, const char* aCategory ) :
+            m_name( aName ),
+            m_category( aCategory ),
+            m_startUs( TRACE_RECORDER::Instance().IsEnabled() ? GetRunningMicroSecs() : -1 )
+    {
+    }
+
+    ~TRACE_SCOPE()
+    {
+        if( m_startUs >= 0 )
+        {
+            TRACE_RECORDER::Instance().RecordComplete( m_name, m_category, m_startUs,
+                                                       GetRunningMicroSecs() - m_startUs );
+        }
+    }
+
+private:
+    const char* m_name;
+    const char* m_category;
+    int64_t     m_startUs;
+};
+
+#endif // PROFILE_TRACE_H
@@ -0,0 +1,176 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright The KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, you may find one here:
+ * http://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+ * or you may search the http://www.gnu.org website for the version 2 license,
+ * or you may write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
+ */
+
+#include <core/profile_trace.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <thread>
+
+
+TRACE_RECORDER& TRACE_RECORDER::Instance()
+{
+    static TRACE_RECORDER instance;
+    return instance;
+}
+
+
+TRACE_RECORDER::TRACE_RECORDER() :
+        m_next( 0 ),
+        m_enabled( false )
+{
+    if( const char* path = std::getenv( "KICAD_TRACE_FILE" ) )
+    {
+        m_dumpPath = path;
+        Enable( true );
+    }
+}
+
+
+TRACE_RECORDER::~TRACE_RECORDER()
+{
+    if( !m_dumpPath.empty() && m_next.load() > 0 )
+        DumpToFile( m_dumpPath );
+}
+
+
+void TRACE_RECORDER::Enable( bool aEnable )
+{
+    if( aEnable && m_events.empty() )
+        m_events.resize( BUFFER_SIZE );
+
+    m_enabled.store( aEnable, std::memory_order_relaxed );
+}
+
+
+void TRACE_RECORDER::Clear()
+{
+    m_next.store( 0 );
+}
+
+
+static uint32_t currentThreadId()
+{
+    static thread_local uint32_t id =
+            (uint32_t) std::hash<std::thread::id>{}( std::this_thread::get_id() );
+    return id;
+}
+
+
+void TRACE_RECORDER::record( const char* aName, const char* aCategory, int64_t aStartUs,
+                             int64_t aDurationUs, char aPhase )
+{
+    // Claiming a slot is the only synchronization; concurrent writers never share a slot
+    // (short of the buffer wrapping a full lap during one write, which would need 32k
+    // events recorded inside a single strncpy).
+    uint64_t slot = m_next.fetch_add( 1, std::memory_order_relaxed );
+    EVENT&   event = m_events[slot % BUFFER_SIZE];
+
+    strncpy( event.Name, aName, sizeof( event.Name ) - 1 );
+    event.Name[sizeof( event.Name ) - 1] = '\0';
+    event.Category = aCategory;
+    event.StartUs = aStartUs;
+    event.DurationUs = aDurationUs;
+    event.ThreadId = currentThreadId();
+    event.Phase = aPhase;
+}
+
+
+void TRACE_RECORDER::RecordComplete( const char* aName, const char* aCategory, int64_t aStartUs,
+                                     int64_t aDurationUs )
+{
+    if( IsEnabled() )
+        record( aName, aCategory, aStartUs, aDurationUs, 'X' );
+}
+
+
+void TRACE_RECORDER::RecordInstant( const char* aName, const char* aCategory )
+{
+    if( IsEnabled() )
+        record( aName, aCategory, GetRunningMicroSecs(), 0, 'i' );
+}
+
+
+static void appendEscaped( std::ostream& aStream, const char* aText )
+{
+    for( const char* c = aText; *c; ++c )
+    {
+        if( *c == '"' || *c == '\\' )
+            aStream << '\\' << *c;
+        else if( (unsigned char) *c >= 0x20 )
+            aStream << *c;
+    }
+}
+
+
+std::string TRACE_RECORDER::DumpJson() const
+{
+    std::ostringstream json;
+
+    uint64_t total = m_next.load();
+    uint64_t count = std::min( total, (uint64_t) BUFFER_SIZE );
+    uint64_t first = total - count;
+
+    json << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    for( uint64_t ii = 0; ii < count; ++ii )
+    {
+        const EVENT& event = m_events[( first + ii ) % BUFFER_SIZE];
+
+        if( ii > 0 )
+            json << ",";
+
+        json << "\n{\"name\":\"";
+        appendEscaped( json, event.Name );
+        json << "\",\"cat\":\"";
+        appendEscaped( json, event.Category );
+        json << "\",\"ph\":\"" << event.Phase << "\"";
+        json << ",\"ts\":" << event.StartUs;
+
+        if( event.Phase == 'X' )
+            json << ",\"dur\":" << event.DurationUs;
+
+        json << ",\"pid\":1,\"tid\":" << event.ThreadId << "}";
+    }
+
+    json << "\n]}\n";
+
+    return json.str();
+}
+
+
+bool TRACE_RECORDER::DumpToFile( const std::string& aPath ) const
+{
+    std::ofstream file( aPath );
+
+    if( !file.is_open() )
+        return false;
+
+    file << DumpJson();
+
+    return file.good();
+}
@@ -0,0 +1,110 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright The KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, you may find one here:
+ * http://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+ * or you may search the http://www.gnu.org website for the version 2 license,
+ * or you may write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
+ */
+
+#ifndef POINT_KDTREE_H
+#define POINT_KDTREE_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <nanoflann.hpp>
+
+#include <math/vector2d.h>
+
+/**
+ * A kd-tree over a fixed set of VECTOR2I points, for repeated nearest-neighbour queries.
+ *
+ * Thin wrapper around the vendored nanoflann index: build once, query many times.
+ * Returned indices refer to the point vector handed to the constructor (retrievable via
+ * Point()), so callers can keep a parallel payload array.
+ */
+class POINT_KDTREE
+{
+public:
+    POINT_KDTREE( std::vector<VECTOR2I> aPoints ) :
+            m_points( std::move( aPoints ) ),
+            m_index( 2, *this, nanoflann::KDTreeSingleIndexAdaptorParams( 10 ) )
+    {
+        m_index.buildIndex();
+    }
+
+    size_t Size() const { return m_points.size(); }
+
+    const VECTOR2I& Point( size_t aIndex ) const { return m_points[aIndex]; }
+
+    /**
+     * Find the stored point nearest to \a aQuery.
+     *
+     * @param aQuery the query point.
+     * @param aIndex receives the index of the nearest stored point.
+     * @param aDistSq receives the exact squared distance to it (the internal double
+     *                metric is only used for ranking).
+     * @return true unless the set is empty.
+     */
+    bool NearestPoint( const VECTOR2I& aQuery, size_t& aIndex, int64_t& aDistSq ) const
+    {
+        if( m_points.empty() )
+            return false;
+
+        const double query_pt[2] = { static_cast<double>( aQuery.x ),
+                                     static_cast<double>( aQuery.y ) };
+
+        uint32_t index = 0;
+        double   dist = 0.0;
+
+        if( m_index.knnSearch( query_pt, 1, &index, &dist ) == 0 )
+            return false;
+
+        aIndex = index;
+
+        VECTOR2L d( int64_t( m_points[index].x ) - aQuery.x,
+                    int64_t( m_points[index].y ) - aQuery.y );
+        aDistSq = d.SquaredEuclideanNorm();
+
+        return true;
+    }
+
+    // nanoflann dataset adaptor interface
+    size_t kdtree_get_point_count() const { return m_points.size(); }
+
+    double kdtree_get_pt( const size_t idx, const size_t dim ) const
+    {
+        return static_cast<double>( dim == 0 ? m_points[idx].x : m_points[idx].y );
+    }
+
+    template <class BBOX>
+    bool kdtree_get_bbox( BBOX& ) const
+    {
+        return false;
+    }
+
+private:
+    using INDEX = nanoflann::KDTreeSingleIndexAdaptor<
+            nanoflann::L2_Simple_Adaptor<double, POINT_KDTREE>, POINT_KDTREE, 2>;
+
+    std::vector<VECTOR2I> m_points;
+    INDEX                 m_index;
+};
+
+#endif // POINT_KDTREE_H
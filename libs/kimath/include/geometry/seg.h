@@ -262,6 +262,26 @@ public:
 
     ecoord SquaredDistance( const VECTOR2I& aP ) const;
 
+    /**
+     * Batched form of SquaredDistance( const SEG& ): compute the minimum squared distance
+     * between this segment and a polyline given as a flat array of \a aPointCount points
+     * forming aPointCount - 1 consecutive candidate segments.
+     *
+     * The sweep is decomposed so each polyline point is measured against the query
+     * segment exactly once (shared segment endpoints are not re-evaluated per adjacent
+     * segment) and the query-segment setup is hoisted out of the loop, instead of
+     * re-deriving everything per pairwise call.
+     *
+     * @param aPoints flat polyline point array.
+     * @param aPointCount number of points in the array.
+     * @param aEarlyOutSq stop sweeping as soon as a squared distance below this is found;
+     *                    pass 0 to always compute the exact minimum.
+     * @param aNearestSegment if non-null, receives the index of the closest segment.
+     * @return the minimum squared distance.
+     */
+    ecoord SquaredDistanceToPolyline( const VECTOR2I* aPoints, size_t aPointCount,
+                                      ecoord aEarlyOutSq, size_t* aNearestSegment ) const;
+
     /**
      * Compute minimum Euclidean distance to point \a aP.
      *
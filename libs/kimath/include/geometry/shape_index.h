@@ -113,6 +113,16 @@ template <class T = SHAPE*>
 class SHAPE_INDEX
 {
     public:
+        /**
+         * A single candidate returned by QueryBulk(): the indexed object together with
+         * the bounding box it was inserted under.
+         */
+        struct ENTRY
+        {
+            BOX2I bbox;
+            T     item;
+        };
+
         class Iterator
         {
         private:
@@ -273,6 +283,38 @@ class SHAPE_INDEX
             return this->m_tree->Search( min, max, aVisitor );
         }
 
+        /**
+         * Collect every candidate in the bounding box of aShape (inflated by aMinDistance)
+         * into a flat, caller-owned buffer, without invoking a callback per candidate.
+         *
+         * Each entry carries the bounding box the object was indexed under, so callers can
+         * run cheap box-level pre-filters over the contiguous buffer before touching the
+         * objects themselves.  The buffer is appended to, not cleared, so it can be reused
+         * across queries.
+         *
+         * @param aShape is the shape to search against.
+         * @param aMinDistance is the distance threshold.
+         * @param aOut receives the candidate entries.
+         * @return the number of candidates found.
+         */
+        int QueryBulk( const SHAPE* aShape, int aMinDistance, std::vector<ENTRY>& aOut ) const
+        {
+            BOX2I box = aShape->BBox();
+            box.Inflate( aMinDistance );
+
+            int min[2] = { box.GetX(),         box.GetY() };
+            int max[2] = { box.GetRight(),     box.GetBottom() };
+
+            auto collector = [&aOut]( const int aMin[2], const int aMax[2], const T& aItem )
+            {
+                aOut.push_back( { BOX2I::ByCorners( VECTOR2I( aMin[0], aMin[1] ),
+                                                    VECTOR2I( aMax[0], aMax[1] ) ),
+                                  aItem } );
+            };
+
+            return this->m_tree->SearchEntries( min, max, collector );
+        }
+
         /**
          * Create an iterator for the current index object.
          *
@@ -883,6 +883,15 @@ public:
         return sqrt( SquaredDistance( aP, aOutlineOnly ) );
     }
 
+    /**
+     * @copydoc SHAPE_LINE_CHAIN_BASE::SquaredDistance()
+     *
+     * Overridden to sweep the point array directly instead of fetching each segment
+     * through the virtual SHAPE_LINE_CHAIN_BASE interface; the distance sweep dominates
+     * routing and DRC profiles on long serpentine chains.
+     */
+    SEG::ecoord SquaredDistance( const VECTOR2I& aP, bool aOutlineOnly = false ) const override;
+
     virtual const VECTOR2I GetPoint( int aIndex ) const override { return CPoint(aIndex); }
     virtual const SEG GetSegment( int aIndex ) const override { return CSegment(aIndex); }
     virtual size_t GetPointCount() const override { return PointCount(); }
@@ -31,6 +31,7 @@
 #include <atomic>
 #include <cstdio>
 #include <deque>                        // for deque
+#include <functional>                   // for function
 #include <iosfwd>                       // for string, stringstream
 #include <memory>
 #include <mutex>
@@ -217,6 +218,12 @@ public:
                 vertex += aVec;
         }
 
+        void Transform( const std::function<VECTOR2I( const VECTOR2I& )>& aTransform )
+        {
+            for( VECTOR2I& vertex : m_vertices )
+                vertex = aTransform( vertex );
+        }
+
     private:
         int                  m_sourceOutline;
         std::deque<TRI>      m_triangles;
@@ -582,6 +589,28 @@ public:
     {
         cacheTriangulation( aPartition, aSimplify, nullptr );
     }
+
+    /**
+     * Triangulate, reusing \a aHintData for outlines whose geometry still matches (see
+     * OUTLINE_GLYPH and pcbnew's ZONE_TRIANGULATION_CACHE).  Outlines with no matching
+     * hint are tessellated from scratch.
+     */
+    void CacheTriangulation( std::vector<std::unique_ptr<TRIANGULATED_POLYGON>>& aHintData,
+                             bool aPartition )
+    {
+        cacheTriangulation( aPartition, false, &aHintData );
+    }
+
+    /**
+     * Install a transformed copy of \a aSourceData as this polygon set's triangulation.
+     *
+     * A triangulation stays valid under any affine transform, so a mesh tessellated once
+     * (e.g. a glyph in font units) can be instanced at any position, scale, rotation or
+     * mirroring by mapping its vertices with \a aVertexTransform.  No tessellation is
+     * performed.
+     */
+    void CacheTriangulation( const std::vector<std::unique_ptr<TRIANGULATED_POLYGON>>& aSourceData,
+                             const std::function<VECTOR2I( const VECTOR2I& )>& aVertexTransform );
     bool IsTriangulationUpToDate() const;
 
     HASH_128 GetHash() const;
@@ -636,6 +665,9 @@ public:
     /// Adds a polygon to the set
     int AddPolygon( const POLYGON& apolygon );
 
+    /// Add a polygon to the set, taking ownership of its storage.
+    int AddPolygon( POLYGON&& apolygon );
+
     /// Return the area of this poly set
     double Area();
 
@@ -666,6 +698,14 @@ public:
     /// Merge polygons from two sets.
     void Append( const SHAPE_POLY_SET& aSet );
 
+    /**
+     * Append all the polygons in \a aSet to this poly set, taking ownership of their
+     * storage.  Use this instead of the copying overload for the common
+     * transform-into-temporary-then-append pattern: it avoids reallocating every point
+     * buffer in the hot zone-fill and clearance knockout loops.
+     */
+    void Append( SHAPE_POLY_SET&& aSet );
+
     /// Append a vertex at the end of the given outline/hole (default: the last outline)
     void Append( const VECTOR2I& aP, int aOutline = -1, int aHole = -1 );
 
@@ -732,6 +772,14 @@ public:
     /// Return the number of triangulated polygons
     unsigned int TriangulatedPolyCount() const { return m_triangulatedPolys.size(); }
 
+    /**
+     * Estimate the heap memory held by this set, including the cached triangulation.
+     *
+     * This is an accounting figure (vertex and triangle storage), not an exact allocator
+     * total; it is intended for memory-usage reporting.
+     */
+    size_t EstimateMemoryUsage() const;
+
     /// Return the number of outlines in the set
     int OutlineCount() const { return m_polys.size(); }
 
@@ -1020,9 +1068,22 @@ public:
     /// Perform boolean polyset union
     void BooleanAdd( const SHAPE_POLY_SET& b );
 
+    /**
+     * Perform an N-way boolean union with all of \a aShapes in a single Clipper sweep.
+     *
+     * Considerably faster than repeated pairwise BooleanAdd() calls when merging many
+     * operands, as each intermediate result would otherwise be re-scanned.  Null entries
+     * are skipped.
+     */
+    void BooleanAdd( const std::vector<const SHAPE_POLY_SET*>& aShapes );
+
     /// Perform boolean polyset difference
     void BooleanSubtract( const SHAPE_POLY_SET& b );
 
+    /// Subtract the union of all of \a aShapes in a single Clipper sweep (see the batch
+    /// BooleanAdd()).
+    void BooleanSubtract( const std::vector<const SHAPE_POLY_SET*>& aShapes );
+
     /// Perform boolean polyset intersection
     void BooleanIntersection( const SHAPE_POLY_SET& b );
 
@@ -48,6 +48,10 @@
 
 #include <algorithm>
 #include <deque>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
 
 #include <math/box2.h>
 #include <geometry/shape_line_chain.h>
@@ -250,6 +254,106 @@ class VERTEX
     void* m_userData = nullptr;
 };
 
+/**
+ * Pointer-stable slab arena for VERTEX nodes.
+ *
+ * The triangulation builds and splits linked rings of VERTEX nodes, so the nodes must
+ * never move once created.  A std::deque satisfies that but only fits a handful of these
+ * nodes per heap block, so triangulating a large zone still produces an allocation storm.
+ * The pool hands nodes out of fixed-size slabs instead: creating a node is a cursor bump,
+ * nodes are contiguous within a slab, and clear() just rewinds the cursor, keeping the
+ * slabs for the next outline.
+ */
+class VERTEX_POOL
+{
+public:
+    VERTEX_POOL() :
+            m_size( 0 )
+    {
+    }
+
+    VERTEX_POOL( const VERTEX_POOL& ) = delete;
+    VERTEX_POOL& operator=( const VERTEX_POOL& ) = delete;
+
+    size_t size() const { return m_size; }
+    bool   empty() const { return m_size == 0; }
+
+    VERTEX&       operator[]( size_t aIndex )       { return *ptr( aIndex ); }
+    const VERTEX& operator[]( size_t aIndex ) const { return *ptr( aIndex ); }
+
+    VERTEX&       front()       { return *ptr( 0 ); }
+    const VERTEX& front() const { return *ptr( 0 ); }
+    VERTEX&       back()        { return *ptr( m_size - 1 ); }
+    const VERTEX& back() const  { return *ptr( m_size - 1 ); }
+
+    ///< Pre-allocate slabs for aCount additional vertices.
+    void reserve( size_t aCount )
+    {
+        size_t slabs = ( m_size + aCount + SLAB_SIZE - 1 ) >> SLAB_SHIFT;
+
+        while( m_slabs.size() < slabs )
+            addSlab();
+    }
+
+    template <typename... Args>
+    VERTEX& emplace_back( Args&&... aArgs )
+    {
+        if( m_size == m_slabs.size() * SLAB_SIZE )
+            addSlab();
+
+        VERTEX* v = new( ptr( m_size ) ) VERTEX( std::forward<Args>( aArgs )... );
+        m_size++;
+
+        return *v;
+    }
+
+    ///< VERTEX is trivially destructible, so clearing is just rewinding the cursor; the
+    ///< slabs are kept for reuse.
+    void clear() { m_size = 0; }
+
+    class ITERATOR
+    {
+    public:
+        ITERATOR( VERTEX_POOL* aPool, size_t aIndex ) :
+                m_pool( aPool ),
+                m_index( aIndex )
+        {
+        }
+
+        VERTEX& operator*() const { return ( *m_pool )[m_index]; }
+        VERTEX* operator->() const { return &( *m_pool )[m_index]; }
+        ITERATOR& operator++() { ++m_index; return *this; }
+        bool operator==( const ITERATOR& aOther ) const { return m_index == aOther.m_index; }
+        bool operator!=( const ITERATOR& aOther ) const { return m_index != aOther.m_index; }
+
+    private:
+        VERTEX_POOL* m_pool;
+        size_t       m_index;
+    };
+
+    ITERATOR begin() { return ITERATOR( this, 0 ); }
+    ITERATOR end() { return ITERATOR( this, m_size ); }
+
+private:
+    static constexpr size_t SLAB_SHIFT = 10;
+    static constexpr size_t SLAB_SIZE = size_t( 1 ) << SLAB_SHIFT;  ///< vertices per slab
+
+    static_assert( std::is_trivially_destructible<VERTEX>::value,
+                   "VERTEX_POOL never runs destructors" );
+
+    VERTEX* ptr( size_t aIndex ) const
+    {
+        return reinterpret_cast<VERTEX*>( m_slabs[aIndex >> SLAB_SHIFT].get() )
+               + ( aIndex & ( SLAB_SIZE - 1 ) );
+    }
+
+    void addSlab() { m_slabs.emplace_back( new char[SLAB_SIZE * sizeof( VERTEX )] ); }
+
+    std::vector<std::unique_ptr<char[]>> m_slabs;
+    size_t                               m_size;
+};
+
+
 class VERTEX_SET
 {
     friend class VERTEX;
@@ -340,7 +444,7 @@ protected:
     double  area( const VERTEX* p, const VERTEX* q, const VERTEX* r ) const;
 
     BOX2I                   m_bbox;
-    std::deque<VERTEX>      m_vertices;
+    VERTEX_POOL             m_vertices;
     VECTOR2I::extended_type m_simplificationLevel;
 };
 
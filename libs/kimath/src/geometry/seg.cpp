@@ -99,6 +99,99 @@ SEG::ecoord SEG::SquaredDistance( const SEG& aSeg ) const
 }
 
 
+SEG::ecoord SEG::SquaredDistanceToPolyline( const VECTOR2I* aPoints, size_t aPointCount,
+                                            ecoord aEarlyOutSq, size_t* aNearestSegment ) const
+{
+    ecoord best = VECTOR2I::ECOORD_MAX;
+    size_t bestIndex = 0;
+
+    if( aPointCount < 2 )
+        return best;
+
+    const size_t segCount = aPointCount - 1;
+
+    const ecoord abx = ecoord( B.x ) - A.x;
+    const ecoord aby = ecoord( B.y ) - A.y;
+    const ecoord f = abx * abx + aby * aby;
+
+    // Distance from every polyline point to the query segment; this covers the candidate
+    // endpoints of the pairwise form, with shared segment endpoints measured only once.
+    for( size_t i = 0; i < aPointCount; ++i )
+    {
+        const ecoord apx = ecoord( aPoints[i].x ) - A.x;
+        const ecoord apy = ecoord( aPoints[i].y ) - A.y;
+        const ecoord e = apx * abx + apy * aby;
+
+        ecoord d;
+
+        if( e <= 0 )
+        {
+            d = apx * apx + apy * apy;
+        }
+        else if( e >= f )
+        {
+            const ecoord bpx = ecoord( aPoints[i].x ) - B.x;
+            const ecoord bpy = ecoord( aPoints[i].y ) - B.y;
+            d = bpx * bpx + bpy * bpy;
+        }
+        else
+        {
+            const double g = double( apx * apx + apy * apy ) - ( double( e ) * e ) / f;
+
+            if( g < 0 || g > static_cast<double>( std::numeric_limits<ecoord>::max() ) )
+                d = 0;
+            else
+                d = KiROUND<double, ecoord>( g );
+        }
+
+        if( d < best )
+        {
+            best = d;
+            bestIndex = ( i == 0 ) ? 0 : i - 1;
+
+            if( best == 0 || best < aEarlyOutSq )
+            {
+                if( aNearestSegment )
+                    *aNearestSegment = bestIndex;
+
+                return best;
+            }
+        }
+    }
+
+    // Projections of the query endpoints onto each candidate segment's interior, plus the
+    // crossing test; together with the point sweep above this covers every case of the
+    // pairwise SquaredDistance().
+    for( size_t i = 0; i < segCount; ++i )
+    {
+        const SEG s( aPoints[i], aPoints[i + 1] );
+
+        if( s.Intersects( *this ) )
+        {
+            best = 0;
+            bestIndex = i;
+            break;
+        }
+
+        const ecoord d = std::min( s.SquaredDistance( A ), s.SquaredDistance( B ) );
+
+        if( d < best )
+        {
+            best = d;
+            bestIndex = i;
+
+            if( best < aEarlyOutSq )
+                break;
+        }
+    }
+
+    if( aNearestSegment )
+        *aNearestSegment = bestIndex;
+
+    return best;
+}
+
+
 EDA_ANGLE SEG::Angle( const SEG& aOther ) const
 {
     EDA_ANGLE thisAngle = EDA_ANGLE( A - B ).Normalize180();
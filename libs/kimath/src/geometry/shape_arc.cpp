@@ -23,6 +23,10 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
  */
 
+#include <array>
+#include <map>
+#include <mutex>
+
 #include <core/kicad_algo.h>
 #include <geometry/geometry_utils.h>
 #include <geometry/seg.h>               // for SEG
@@ -907,8 +911,50 @@ double SHAPE_ARC::GetRadius() const
 }
 
 
+namespace
+{
+
+///< Memoized arc polygonizations: geometry + tolerance -> ( polyline, actual error ).
+struct ARC_POLYLINE_CACHE
+{
+    using KEY = std::array<int, 8>;
+
+    std::mutex                                      m_lock;
+    std::map<KEY, std::pair<SHAPE_LINE_CHAIN, int>> m_entries;
+
+    ///< When full the cache is simply emptied; eviction bookkeeping isn't worth the
+    ///< contention on this path.
+    static constexpr size_t MAX_ENTRIES = 4096;
+};
+
+ARC_POLYLINE_CACHE s_polylineCache;
+
+} // namespace
+
+
 const SHAPE_LINE_CHAIN SHAPE_ARC::ConvertToPolyline( int aMaxError, int* aActualError ) const
 {
+    // Polygonization is deterministic in the arc geometry and the requested maximum
+    // error, and the same arcs are re-discretized over and over by DRC, painting and
+    // plotting with only a handful of distinct tolerances each, so the results are
+    // memoized process-wide.
+    const ARC_POLYLINE_CACHE::KEY key = { m_start.x, m_start.y, m_mid.x, m_mid.y,
+                                          m_end.x, m_end.y, m_width, aMaxError };
+
+    {
+        std::lock_guard<std::mutex> guard( s_polylineCache.m_lock );
+
+        auto it = s_polylineCache.m_entries.find( key );
+
+        if( it != s_polylineCache.m_entries.end() )
+        {
+            if( aActualError )
+                *aActualError = it->second.second;
+
+            return it->second.first;
+        }
+    }
+
     SHAPE_LINE_CHAIN rv;
     double    r    = GetRadius();
     EDA_ANGLE sa   = GetStartAngle();
@@ -965,6 +1011,16 @@ const SHAPE_LINE_CHAIN SHAPE_ARC::ConvertToPolyline( int aMaxError, int* aActual
 
     rv.Append( m_end );
 
+    {
+        std::lock_guard<std::mutex> guard( s_polylineCache.m_lock );
+
+        if( s_polylineCache.m_entries.size() >= ARC_POLYLINE_CACHE::MAX_ENTRIES )
+            s_polylineCache.m_entries.clear();
+
+        s_polylineCache.m_entries.emplace( key,
+                                           std::make_pair( rv, KiROUND( effectiveError ) ) );
+    }
+
     if( aActualError )
         *aActualError = KiROUND( effectiveError );
 
@@ -823,6 +823,44 @@ bool SHAPE_LINE_CHAIN::Collide( const SEG& aSeg, int aClearance, int* aActual,
     SEG::ecoord clearance_sq = SEG::Square( aClearance );
     VECTOR2I    nearest;
 
+    // Fast path for chains without arcs: sweep the flat point array with the batched
+    // polyline kernel instead of measuring one segment pair at a time.
+    if( m_arcs.empty() && m_points.size() >= 2 )
+    {
+        size_t nearestIdx = 0;
+
+        closest_dist_sq = aSeg.SquaredDistanceToPolyline( m_points.data(), m_points.size(),
+                                                          aActual ? 0 : clearance_sq,
+                                                          &nearestIdx );
+
+        SEG nearestSeg( m_points[nearestIdx], m_points[nearestIdx + 1] );
+
+        if( m_closed && closest_dist_sq > 0 )
+        {
+            const SEG   wrap( m_points.back(), m_points.front() );
+            SEG::ecoord wrap_dist_sq = wrap.SquaredDistance( aSeg );
+
+            if( wrap_dist_sq < closest_dist_sq )
+            {
+                closest_dist_sq = wrap_dist_sq;
+                nearestSeg = wrap;
+            }
+        }
+
+        if( closest_dist_sq == 0 || closest_dist_sq < clearance_sq )
+        {
+            if( aLocation )
+                *aLocation = nearestSeg.NearestPoint( aSeg );
+
+            if( aActual )
+                *aActual = sqrt( closest_dist_sq );
+
+            return true;
+        }
+
+        return false;
+    }
+
     // Collide line segments
     for( size_t i = 0; i < GetSegmentCount(); i++ )
     {
@@ -1171,6 +1209,31 @@ SEG::ecoord SHAPE_LINE_CHAIN_BASE::SquaredDistance( const VECTOR2I& aP, bool aOu
 }
 
 
+SEG::ecoord SHAPE_LINE_CHAIN::SquaredDistance( const VECTOR2I& aP, bool aOutlineOnly ) const
+{
+    ecoord d = VECTOR2I::ECOORD_MAX;
+
+    if( m_closed && !aOutlineOnly && PointInside( aP ) )
+        return 0;
+
+    const VECTOR2I* pts = m_points.data();
+    const size_t    count = m_points.size();
+
+    if( count == 0 )
+        return d;
+
+    // Flat sweep over the raw point array: no virtual GetSegment() dispatch and no
+    // per-iteration count re-evaluation, so the compiler can keep the loop tight.
+    for( size_t s = 0; s + 1 < count; s++ )
+        d = std::min( d, SEG( pts[s], pts[s + 1] ).SquaredDistance( aP ) );
+
+    if( m_closed )
+        d = std::min( d, SEG( pts[count - 1], pts[0] ).SquaredDistance( aP ) );
+
+    return d;
+}
+
+
 int SHAPE_LINE_CHAIN::Split( const VECTOR2I& aP, bool aExact )
 {
     int ii = -1;
@@ -1722,7 +1785,9 @@ struct compareOriginDistance
 
 int SHAPE_LINE_CHAIN::Intersect( const SEG& aSeg, INTERSECTIONS& aIp ) const
 {
-    for( int s = 0; s < SegmentCount(); s++ )
+    const int count = SegmentCount();
+
+    for( int s = 0; s < count; s++ )
     {
         OPT_VECTOR2I p = CSegment( s ).Intersect( aSeg );
 
@@ -1747,9 +1812,25 @@ int SHAPE_LINE_CHAIN::Intersect( const SEG& aSeg, INTERSECTIONS& aIp ) const
 
 bool SHAPE_LINE_CHAIN::Intersects( const SEG& aSeg ) const
 {
-    for( int s = 0; s < SegmentCount(); s++ )
+    const int count = SegmentCount();
+
+    const int minx = std::min( aSeg.A.x, aSeg.B.x );
+    const int maxx = std::max( aSeg.A.x, aSeg.B.x );
+    const int miny = std::min( aSeg.A.y, aSeg.B.y );
+    const int maxy = std::max( aSeg.A.y, aSeg.B.y );
+
+    for( int s = 0; s < count; s++ )
     {
-        if( CSegment( s ).Intersects( aSeg ) )
+        const SEG& cur = CSegment( s );
+
+        // Interval-overlap reject before the exact intersection test.
+        if( std::min( cur.A.x, cur.B.x ) > maxx || std::max( cur.A.x, cur.B.x ) < minx
+                || std::min( cur.A.y, cur.B.y ) > maxy || std::max( cur.A.y, cur.B.y ) < miny )
+        {
+            continue;
+        }
+
+        if( cur.Intersects( aSeg ) )
             return true;
     }
 
@@ -1783,9 +1864,24 @@ int SHAPE_LINE_CHAIN::Intersect( const SHAPE_LINE_CHAIN& aChain, INTERSECTIONS&
         if( !bb_other.Intersects( bb_cur ) )
             continue;
 
+        const int a_minx = std::min( a.A.x, a.B.x );
+        const int a_maxx = std::max( a.A.x, a.B.x );
+        const int a_miny = std::min( a.A.y, a.B.y );
+        const int a_maxy = std::max( a.A.y, a.B.y );
+
         for( int s2 = 0; s2 < aChain.SegmentCount(); s2++ )
         {
             const SEG& b = aChain.CSegment( s2 );
+
+            // Cheap interval-overlap reject before the exact (and far more expensive)
+            // intersection and collinearity tests; on long chains the vast majority of
+            // segment pairs are nowhere near each other.
+            if( std::min( b.A.x, b.B.x ) > a_maxx || std::max( b.A.x, b.B.x ) < a_minx
+                    || std::min( b.A.y, b.B.y ) > a_maxy || std::max( b.A.y, b.B.y ) < a_miny )
+            {
+                continue;
+            }
+
             INTERSECTION is;
 
             is.index_our = s1;
@@ -2580,6 +2676,56 @@ void SHAPE_LINE_CHAIN::Simplify( int aTolerance )
     if( PointCount() < 3 )
         return;
 
+    // Pre-pass: drop duplicates and interior points lying exactly on the segment between
+    // their neighbours.  Such a point can never block a simplification window (its
+    // distance to any chord is bounded by its neighbours' distances, by convexity), so
+    // removing it up front cannot change the result — and the post-Boolean outlines this
+    // is run on are full of exactly collinear runs that otherwise make the quadratic
+    // window scan below crawl.
+    {
+        std::vector<VECTOR2I> pts;
+        std::vector<std::pair<ssize_t, ssize_t>> shapes;
+
+        pts.reserve( m_points.size() );
+        shapes.reserve( m_shapes.size() );
+
+        pts.push_back( m_points[0] );
+        shapes.push_back( m_shapes[0] );
+
+        for( size_t j = 1; j < m_points.size(); ++j )
+        {
+            // The main loop below only ever removes plain points flanked by plain
+            // points, so the pre-pass must not remove anything else.
+            if( j + 1 < m_points.size()
+                    && shapes.back().first == SHAPE_IS_PT
+                    && m_shapes[j].first == SHAPE_IS_PT
+                    && m_shapes[j + 1].first == SHAPE_IS_PT )
+            {
+                const VECTOR2I& a = pts.back();
+                const VECTOR2I& p = m_points[j];
+                const VECTOR2I& b = m_points[j + 1];
+
+                VECTOR2L ap( int64_t( p.x ) - a.x, int64_t( p.y ) - a.y );
+                VECTOR2L pb( int64_t( b.x ) - p.x, int64_t( b.y ) - p.y );
+
+                if( ap.Cross( pb ) == 0 && ap.Dot( pb ) >= 0 )
+                    continue;
+            }
+
+            pts.push_back( m_points[j] );
+            shapes.push_back( m_shapes[j] );
+        }
+
+        if( pts.size() < m_points.size() )
+        {
+            m_points = std::move( pts );
+            m_shapes = std::move( shapes );
+        }
+
+        if( PointCount() < 3 )
+            return;
+    }
+
     std::vector<VECTOR2I> new_points;
     std::vector<std::pair<ssize_t, ssize_t>> new_shapes;
 
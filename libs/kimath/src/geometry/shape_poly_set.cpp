@@ -545,6 +545,32 @@ bool SHAPE_POLY_SET::IsSelfIntersecting() const
 }
 
 
+size_t SHAPE_POLY_SET::EstimateMemoryUsage() const
+{
+    size_t size = sizeof( *this );
+
+    for( const POLYGON& polygon : m_polys )
+    {
+        for( const SHAPE_LINE_CHAIN& chain : polygon )
+        {
+            // Each point carries its coordinates plus its entry in the shape index
+            size += sizeof( SHAPE_LINE_CHAIN );
+            size += chain.PointCount() * ( sizeof( VECTOR2I ) + 2 * sizeof( ssize_t ) );
+            size += chain.ArcCount() * sizeof( SHAPE_ARC );
+        }
+    }
+
+    for( const std::unique_ptr<TRIANGULATED_POLYGON>& tpoly : m_triangulatedPolys )
+    {
+        size += sizeof( TRIANGULATED_POLYGON );
+        size += tpoly->GetVertexCount() * sizeof( VECTOR2I );
+        size += tpoly->GetTriangleCount() * sizeof( TRIANGULATED_POLYGON::TRI );
+    }
+
+    return size;
+}
+
+
 int SHAPE_POLY_SET::AddOutline( const SHAPE_LINE_CHAIN& aOutline )
 {
     POLYGON poly;
@@ -590,6 +616,14 @@ int SHAPE_POLY_SET::AddPolygon( const POLYGON& apolygon )
 }
 
 
+int SHAPE_POLY_SET::AddPolygon( POLYGON&& apolygon )
+{
+    m_polys.push_back( std::move( apolygon ) );
+
+    return m_polys.size() - 1;
+}
+
+
 double SHAPE_POLY_SET::Area()
 {
     double area = 0.0;
@@ -869,12 +903,44 @@ void SHAPE_POLY_SET::BooleanAdd( const SHAPE_POLY_SET& b )
 }
 
 
+void SHAPE_POLY_SET::BooleanAdd( const std::vector<const SHAPE_POLY_SET*>& aShapes )
+{
+    SHAPE_POLY_SET merged;
+
+    for( const SHAPE_POLY_SET* shape : aShapes )
+    {
+        if( shape )
+            merged.Append( *shape );
+    }
+
+    // A union treats overlaps among the clip paths the same as overlaps with the subject,
+    // so all operands can be resolved in one sweep.
+    booleanOp( Clipper2Lib::ClipType::Union, merged );
+}
+
+
 void SHAPE_POLY_SET::BooleanSubtract( const SHAPE_POLY_SET& b )
 {
     booleanOp( Clipper2Lib::ClipType::Difference, b );
 }
 
 
+void SHAPE_POLY_SET::BooleanSubtract( const std::vector<const SHAPE_POLY_SET*>& aShapes )
+{
+    SHAPE_POLY_SET merged;
+
+    for( const SHAPE_POLY_SET* shape : aShapes )
+    {
+        if( shape )
+            merged.Append( *shape );
+    }
+
+    // Clipper's difference subtracts the union of the clip paths, which is exactly the
+    // batch semantic we want.
+    booleanOp( Clipper2Lib::ClipType::Difference, merged );
+}
+
+
 void SHAPE_POLY_SET::BooleanIntersection( const SHAPE_POLY_SET& b )
 {
     booleanOp( Clipper2Lib::ClipType::Intersection, b );
@@ -2475,6 +2541,22 @@ void SHAPE_POLY_SET::Append( const SHAPE_POLY_SET& aSet )
 }
 
 
+void SHAPE_POLY_SET::Append( SHAPE_POLY_SET&& aSet )
+{
+    if( m_polys.empty() )
+    {
+        m_polys = std::move( aSet.m_polys );
+    }
+    else
+    {
+        m_polys.insert( m_polys.end(), std::make_move_iterator( aSet.m_polys.begin() ),
+                        std::make_move_iterator( aSet.m_polys.end() ) );
+    }
+
+    aSet.m_polys.clear();
+}
+
+
 void SHAPE_POLY_SET::Append( const VECTOR2I& aP, int aOutline, int aHole )
 {
     Append( aP.x, aP.y, aOutline, aHole );
@@ -3126,6 +3208,28 @@ void SHAPE_POLY_SET::cacheTriangulation( bool aPartition, bool aSimplify,
 }
 
 
+void SHAPE_POLY_SET::CacheTriangulation(
+        const std::vector<std::unique_ptr<TRIANGULATED_POLYGON>>& aSourceData,
+        const std::function<VECTOR2I( const VECTOR2I& )>& aVertexTransform )
+{
+    std::unique_lock<std::mutex> lock( m_triangulationMutex );
+
+    m_triangulationValid = false;
+    m_hashValid = false;
+    m_triangulatedPolys.clear();
+
+    for( const std::unique_ptr<TRIANGULATED_POLYGON>& source : aSourceData )
+    {
+        m_triangulatedPolys.push_back( std::make_unique<TRIANGULATED_POLYGON>( *source ) );
+        m_triangulatedPolys.back()->Transform( aVertexTransform );
+    }
+
+    m_hash = checksum();
+    m_hashValid = true;
+    m_triangulationValid = true;
+}
+
+
 HASH_128 SHAPE_POLY_SET::checksum() const
 {
     MMH3_HASH hash( 0x68AF835D ); // Arbitrary seed
@@ -29,6 +29,8 @@ VERTEX* VERTEX_SET::createList( const SHAPE_LINE_CHAIN& points, VERTEX* aTail, v
     VERTEX* tail = aTail;
     double sum = 0.0;
 
+    m_vertices.reserve( points.PointCount() );
+
     // Check for winding order
     for( int i = 0; i < points.PointCount(); i++ )
     {
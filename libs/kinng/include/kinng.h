@@ -23,6 +23,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <functional>
 #include <mutex>
 #include <thread>
@@ -43,7 +44,7 @@ public:
 
     void SetCallback( std::function<void(std::string*)> aFunc ) { m_callback = aFunc; }
 
-    void Reply( const std::string& aReply );
+    void Reply( std::string aReply );
 
     const std::string& SocketPath() const { return m_socketUrl; }
 
@@ -67,4 +68,55 @@ private:
     std::mutex m_mutex;
 };
 
+
+/**
+ * A one-way publisher socket: messages handed to Publish() are fanned out to every connected
+ * subscriber, and dropped by the transport when no subscriber is connected.  Clients connect
+ * with an nng sub socket and filter by message prefix.
+ */
+class KINNG_PUBLISH_SERVER
+{
+public:
+    KINNG_PUBLISH_SERVER( const std::string& aSocketUrl );
+
+    ~KINNG_PUBLISH_SERVER();
+
+    bool Start();
+
+    void Stop();
+
+    bool Running() const;
+
+    /**
+     * Queues a message for delivery to all connected subscribers.  Safe to call from any
+     * thread; the message is sent from the server's own thread, so callers never block on
+     * the transport.
+     */
+    void Publish( std::string aMessage );
+
+    const std::string& SocketPath() const { return m_socketUrl; }
+
+private:
+    void publishThread();
+
+    /// Mark the socket as dead and discard anything already queued.
+    void socketFailed();
+
+    std::thread m_thread;
+
+    std::atomic<bool> m_shutdown;
+
+    /// Set when the publisher thread could not open its socket; makes Running() report
+    /// false so producers stop queueing messages nothing will ever send.
+    std::atomic<bool> m_socketFailed;
+
+    std::string m_socketUrl;
+
+    std::deque<std::string> m_queue;
+
+    std::condition_variable m_queueReady;
+
+    std::mutex m_mutex;
+};
+
 #endif //KICAD_KINNG_H
@@ -18,8 +18,12 @@
  * with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <chrono>
+#include <cstring>
+
 #include <kinng.h>
 #include <nng/nng.h>
+#include <nng/protocol/pubsub0/pub.h>
 #include <nng/protocol/reqrep0/rep.h>
 #include <wx/log.h>
 
@@ -74,10 +78,10 @@ void KINNG_REQUEST_SERVER::Stop()
 }
 
 
-void KINNG_REQUEST_SERVER::Reply( const std::string& aReply )
+void KINNG_REQUEST_SERVER::Reply( std::string aReply )
 {
     std::lock_guard<std::mutex> lock( m_mutex );
-    m_pendingReply = aReply;
+    m_pendingReply = std::move( aReply );
     m_replyReady.notify_all();
 }
 
@@ -135,6 +139,7 @@ void KINNG_REQUEST_SERVER::listenThread()
         }
 
         m_sharedMessage.assign( buf, sz );
+        nng_free( buf, sz );
 
         if( m_callback )
             m_callback( &m_sharedMessage );
@@ -142,13 +147,30 @@ void KINNG_REQUEST_SERVER::listenThread()
         std::unique_lock<std::mutex> lock( m_mutex );
         m_replyReady.wait( lock, [&]() { return !m_pendingReply.empty(); } );
 
-        retCode = nng_send( socket, const_cast<std::string::value_type*>( m_pendingReply.c_str() ),
-                            m_pendingReply.length(), 0 );
+        // Hand the reply to the transport in an nng-allocated buffer; with
+        // NNG_FLAG_ALLOC nng takes ownership instead of making its own copy,
+        // which matters for multi-megabyte design payloads.
+        size_t replySize = m_pendingReply.length();
+        void*  replyBuf = nng_alloc( replySize );
 
-        if( retCode != 0 )
+        if( replyBuf )
         {
-            wxLogTrace( TraceNng,
-                        wxString::Format( wxS( "Got error code %d from nng_send!" ), retCode ) );
+            memcpy( replyBuf, m_pendingReply.data(), replySize );
+
+            retCode = nng_send( socket, replyBuf, replySize, NNG_FLAG_ALLOC );
+
+            if( retCode != 0 )
+            {
+                // On failure ownership stays with us
+                nng_free( replyBuf, replySize );
+                wxLogTrace( TraceNng,
+                            wxString::Format( wxS( "Got error code %d from nng_send!" ),
+                                              retCode ) );
+            }
+        }
+        else
+        {
+            wxLogTrace( TraceNng, wxS( "Failed to allocate nng reply buffer!" ) );
         }
 
         m_pendingReply.clear();
@@ -158,3 +180,150 @@ void KINNG_REQUEST_SERVER::listenThread()
 
     nng_close( socket );
 }
+
+
+KINNG_PUBLISH_SERVER::KINNG_PUBLISH_SERVER( const std::string& aSocketUrl ) :
+        m_socketUrl( aSocketUrl )
+{
+    Start();
+}
+
+
+KINNG_PUBLISH_SERVER::~KINNG_PUBLISH_SERVER()
+{
+    Stop();
+}
+
+
+bool KINNG_PUBLISH_SERVER::Running() const
+{
+    return m_thread.joinable() && !m_socketFailed.load();
+}
+
+
+bool KINNG_PUBLISH_SERVER::Start()
+{
+    m_shutdown.store( false );
+    m_socketFailed.store( false );
+    m_thread = std::thread( [&]() { publishThread(); } );
+    return true;
+}
+
+
+void KINNG_PUBLISH_SERVER::Stop()
+{
+    if( !m_thread.joinable() )
+        return;
+
+    m_shutdown.store( true );
+
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_queueReady.notify_all();
+    }
+
+    m_thread.join();
+}
+
+
+void KINNG_PUBLISH_SERVER::Publish( std::string aMessage )
+{
+    // With no working socket nothing will ever drain the queue; don't let it grow.
+    if( m_socketFailed.load() )
+        return;
+
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_queue.emplace_back( std::move( aMessage ) );
+    m_queueReady.notify_all();
+}
+
+
+void KINNG_PUBLISH_SERVER::socketFailed()
+{
+    m_socketFailed.store( true );
+
+    // Drop anything queued before the failure was detected
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_queue.clear();
+}
+
+
+void KINNG_PUBLISH_SERVER::publishThread()
+{
+    nng_socket   socket;
+    nng_listener listener;
+    int          retCode = 0;
+
+    wxLogTrace( TraceNng, wxS( "KINNG_PUBLISH_SERVER starting" ) );
+
+    retCode = nng_pub0_open( &socket );
+
+    if( retCode != 0 )
+    {
+        wxLogTrace( TraceNng,
+                    wxString::Format( wxS( "Got error code %d from nng_pub0_open!" ), retCode ) );
+        socketFailed();
+        return;
+    }
+
+    retCode = nng_listener_create( &listener, socket, m_socketUrl.c_str() );
+
+    if( retCode != 0 )
+    {
+        wxLogTrace( TraceNng,
+                    wxString::Format( wxS( "Got error code %d from nng_listener_create!" ),
+                                      retCode ) );
+        socketFailed();
+        nng_close( socket );
+        return;
+    }
+
+    nng_listener_start( listener, 0 );
+
+    wxLogTrace( TraceNng, wxS( "KINNG_PUBLISH_SERVER listener has started" ) );
+
+    while( true )
+    {
+        std::string message;
+
+        {
+            std::unique_lock<std::mutex> lock( m_mutex );
+            m_queueReady.wait_for( lock, std::chrono::milliseconds( 500 ),
+                                   [&]() { return !m_queue.empty() || m_shutdown.load(); } );
+
+            if( m_shutdown.load() )
+                break;
+
+            if( m_queue.empty() )
+                continue;
+
+            message = std::move( m_queue.front() );
+            m_queue.pop_front();
+        }
+
+        size_t msgSize = message.length();
+        void*  msgBuf = nng_alloc( msgSize );
+
+        if( !msgBuf )
+        {
+            wxLogTrace( TraceNng, wxS( "Failed to allocate nng publish buffer!" ) );
+            continue;
+        }
+
+        memcpy( msgBuf, message.data(), msgSize );
+
+        retCode = nng_send( socket, msgBuf, msgSize, NNG_FLAG_ALLOC );
+
+        if( retCode != 0 )
+        {
+            // On failure ownership stays with us
+            nng_free( msgBuf, msgSize );
+            wxLogTrace( TraceNng,
+                        wxString::Format( wxS( "Got error code %d from nng_send!" ), retCode ) );
+        }
+    }
+
+    wxLogTrace( TraceNng, wxS( "KINNG_PUBLISH_SERVER shutting down" ) );
+
+    nng_close( socket );
+}
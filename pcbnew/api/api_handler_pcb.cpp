@@ -42,6 +42,7 @@
 #include <drc/drc_item.h>
 #include <layer_ids.h>
 #include <project.h>
+#include <thread_pool.h>
 #include <tool/tool_manager.h>
 #include <tools/pcb_actions.h>
 #include <tools/pcb_selection_tool.h>
@@ -663,15 +664,30 @@ HANDLER_RESULT<GetItemsResponse> API_HANDLER_PCB::handleGetItems( const HANDLER_
         return tl::unexpected( e );
     }
 
-    for( const BOARD_ITEM* item : items )
-    {
-        if( !typesRequested.count( item->Type() ) )
-            continue;
+    std::erase_if( items,
+                   [&]( const BOARD_ITEM* aItem )
+                   {
+                       return !typesRequested.count( aItem->Type() );
+                   } );
+
+    // Pre-size the repeated field: growing it one item at a time reallocates and
+    // moves the accumulated Any messages repeatedly on large boards
+    response.mutable_items()->Reserve( static_cast<int>( items.size() ) );
+
+    // Each item serializes independently, and on large boards serialization dominates the
+    // request cost, so fan it out over the thread pool.
+    std::vector<google::protobuf::Any> serialized( items.size() );
 
-        google::protobuf::Any itemBuf;
-        item->Serialize( itemBuf );
+    thread_pool& tp = GetKiCadThreadPool();
+
+    tp.submit_loop( 0, items.size(),
+            [&]( size_t i )
+            {
+                items[i]->Serialize( serialized[i] );
+            } ).wait();
+
+    for( google::protobuf::Any& itemBuf : serialized )
         response.mutable_items()->Add( std::move( itemBuf ) );
-    }
 
     response.set_status( ItemRequestStatus::IRS_OK );
     return response;
@@ -694,6 +710,7 @@ HANDLER_RESULT<GetItemsResponse> API_HANDLER_PCB::handleGetItemsById(
     GetItemsResponse response;
 
     std::vector<BOARD_ITEM*> items;
+    items.reserve( aCtx.Request.items().size() );
 
     for( const kiapi::common::types::KIID& id : aCtx.Request.items() )
     {
@@ -709,12 +726,20 @@ HANDLER_RESULT<GetItemsResponse> API_HANDLER_PCB::handleGetItemsById(
         return tl::unexpected( e );
     }
 
-    for( const BOARD_ITEM* item : items )
-    {
-        google::protobuf::Any itemBuf;
-        item->Serialize( itemBuf );
+    response.mutable_items()->Reserve( static_cast<int>( items.size() ) );
+
+    std::vector<google::protobuf::Any> serialized( items.size() );
+
+    thread_pool& tp = GetKiCadThreadPool();
+
+    tp.submit_loop( 0, items.size(),
+            [&]( size_t i )
+            {
+                items[i]->Serialize( serialized[i] );
+            } ).wait();
+
+    for( google::protobuf::Any& itemBuf : serialized )
         response.mutable_items()->Add( std::move( itemBuf ) );
-    }
 
     response.set_status( ItemRequestStatus::IRS_OK );
     return response;
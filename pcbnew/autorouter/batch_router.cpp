@@ -0,0 +1,389 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright The KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, you may find one here:
+ * http://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+ * or you may search the http://www.gnu.org website for the version 2 license,
+ * or you may write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
+ */
+
+#include "batch_router.h"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <map>
+#include <numeric>
+
+#include <base_units.h>
+#include <board.h>
+#include <board_commit.h>
+#include <board_design_settings.h>
+#include <connectivity/connectivity_algo.h>
+#include <connectivity/connectivity_data.h>
+#include <netinfo.h>
+#include <pad.h>
+#include <pcb_track.h>
+#include <progress_reporter.h>
+#include <ratsnest/ratsnest_data.h>
+#include <thread_pool.h>
+
+#include <router/pns_arc.h>
+#include <router/pns_kicad_iface.h>
+#include <router/pns_node.h>
+#include <router/pns_router.h>
+#include <router/pns_routing_settings.h>
+#include <router/pns_segment.h>
+#include <router/pns_sizes_settings.h>
+#include <router/pns_via.h>
+
+
+BATCH_ROUTER::BATCH_ROUTER( BOARD* aBoard ) :
+        m_board( aBoard ),
+        m_fanoutOnly( false ),
+        m_progressReporter( nullptr )
+{
+}
+
+
+BATCH_ROUTER::~BATCH_ROUTER()
+{
+}
+
+
+std::vector<BATCH_ROUTER::CONNECTION> BATCH_ROUTER::collectConnections() const
+{
+    std::vector<CONNECTION> conns;
+
+    std::shared_ptr<CONNECTIVITY_DATA> connectivity = m_board->GetConnectivity();
+
+    // Routed regions stay independent as long as the routes for two different regions can't
+    // come within the worst-case clearance of each other.
+    int margin = m_board->GetDesignSettings().GetBiggestClearanceValue() + pcbIUScale.mmToIU( 1 );
+
+    // Rough upper bound on a BGA escape route; fanout mode ignores anything longer.
+    const int fanoutMaxLength = pcbIUScale.mmToIU( 5 );
+
+    for( unsigned netCode = 1; netCode < m_board->GetNetCount(); ++netCode )
+    {
+        RN_NET* net = connectivity->GetRatsnestForNet( netCode );
+
+        if( !net )
+            continue;
+
+        for( const CN_EDGE& edge : net->GetEdges() )
+        {
+            std::shared_ptr<const CN_ANCHOR> src = edge.GetSourceNode();
+            std::shared_ptr<const CN_ANCHOR> tgt = edge.GetTargetNode();
+
+            if( !src || !tgt || src->Dirty() || tgt->Dirty() )
+                continue;
+
+            CONNECTION conn;
+            conn.a = src->Pos();
+            conn.b = tgt->Pos();
+            conn.itemA = src->Parent();
+            conn.itemB = tgt->Parent();
+            conn.netCode = netCode;
+
+            if( !conn.itemA || !conn.itemB )
+                continue;
+
+            if( m_fanoutOnly )
+            {
+                bool hasPad = conn.itemA->Type() == PCB_PAD_T || conn.itemB->Type() == PCB_PAD_T;
+
+                if( !hasPad || ( conn.b - conn.a ).EuclideanNorm() > fanoutMaxLength )
+                    continue;
+            }
+
+            conn.bbox = BOX2I::ByCorners( conn.a, conn.b );
+            conn.bbox.Inflate( margin );
+
+            conns.push_back( conn );
+        }
+    }
+
+    return conns;
+}
+
+
+std::vector<std::vector<BATCH_ROUTER::CONNECTION>>
+BATCH_ROUTER::partitionConnections( std::vector<CONNECTION> aConns ) const
+{
+    size_t n = aConns.size();
+
+    std::vector<int> parent( n );
+    std::iota( parent.begin(), parent.end(), 0 );
+
+    std::function<int( int )> find =
+            [&]( int x )
+            {
+                while( parent[x] != x )
+                {
+                    parent[x] = parent[parent[x]];
+                    x = parent[x];
+                }
+
+                return x;
+            };
+
+    // Plane sweep over the x-extents; only y-overlap needs an explicit test.
+    std::vector<size_t> order( n );
+    std::iota( order.begin(), order.end(), 0 );
+    std::sort( order.begin(), order.end(),
+               [&]( size_t a, size_t b )
+               {
+                   return aConns[a].bbox.GetX() < aConns[b].bbox.GetX();
+               } );
+
+    for( size_t i = 0; i < n; ++i )
+    {
+        const BOX2I& bi = aConns[order[i]].bbox;
+
+        for( size_t j = i + 1; j < n && aConns[order[j]].bbox.GetX() <= bi.GetRight(); ++j )
+        {
+            if( bi.Intersects( aConns[order[j]].bbox ) )
+            {
+                int ri = find( order[i] );
+                int rj = find( order[j] );
+
+                if( ri != rj )
+                    parent[ri] = rj;
+            }
+        }
+    }
+
+    std::map<int, std::vector<CONNECTION>> byRoot;
+
+    for( size_t i = 0; i < n; ++i )
+        byRoot[ find( (int) i ) ].push_back( aConns[i] );
+
+    std::vector<std::vector<CONNECTION>> regions;
+
+    for( auto& [ root, conns ] : byRoot )
+        regions.push_back( std::move( conns ) );
+
+    return regions;
+}
+
+
+int BATCH_ROUTER::Route( BOARD_COMMIT& aCommit )
+{
+    std::vector<CONNECTION> conns = collectConnections();
+
+    if( conns.empty() )
+        return 0;
+
+    std::vector<std::vector<CONNECTION>> regions = partitionConnections( std::move( conns ) );
+
+    thread_pool& tp = GetKiCadThreadPool();
+
+    size_t numWorkers = std::min<size_t>( regions.size(),
+                                          std::max<size_t>( 1, tp.get_thread_count() ) );
+
+    // One private router per worker.  The worlds are synced serially: SyncWorld() populates
+    // lazy caches on the board items and is therefore not safe to run concurrently.
+    struct WORKER
+    {
+        PNS_KICAD_IFACE_BASE                     iface;
+        std::unique_ptr<PNS::ROUTER>             router;
+        std::unique_ptr<PNS::ROUTING_SETTINGS>   settings;
+        std::vector<std::unique_ptr<PNS::ITEM>>  results;
+        int                                      routedCount = 0;
+    };
+
+    std::vector<std::unique_ptr<WORKER>> workers;
+
+    for( size_t ii = 0; ii < numWorkers; ++ii )
+    {
+        std::unique_ptr<WORKER> worker = std::make_unique<WORKER>();
+
+        worker->iface.SetBoard( m_board );
+        worker->router = std::make_unique<PNS::ROUTER>();
+        worker->router->SetInterface( &worker->iface );
+        worker->router->ClearWorld();
+        worker->router->SyncWorld();
+
+        worker->settings = std::make_unique<PNS::ROUTING_SETTINGS>( nullptr, "" );
+        worker->settings->SetMode( PNS::RM_Walkaround );
+        worker->router->LoadSettings( worker->settings.get() );
+        worker->router->SetMode( PNS::PNS_MODE_ROUTE_SINGLE );
+
+        workers.push_back( std::move( worker ) );
+    }
+
+    if( m_progressReporter )
+        m_progressReporter->SetMaxProgress( (int) regions.size() );
+
+    auto routeRegion =
+            []( WORKER& aWorker, const std::vector<CONNECTION>& aRegion )
+            {
+                PNS::ROUTER* router = aWorker.router.get();
+
+                for( const CONNECTION& conn : aRegion )
+                {
+                    PNS::NODE* world = router->GetWorld();
+                    PNS::ITEM* startItem = world->FindItemByParent( conn.itemA );
+                    PNS::ITEM* endItem = world->FindItemByParent( conn.itemB );
+
+                    if( !startItem )
+                        continue;
+
+                    int layer = startItem->Layers().Start();
+
+                    if( endItem )
+                    {
+                        PNS_LAYER_RANGE common = startItem->Layers().Intersection( endItem->Layers() );
+
+                        if( common.Start() >= 0 )
+                            layer = common.Start();
+                    }
+
+                    PNS::SIZES_SETTINGS sizes;
+                    aWorker.iface.ImportSizes( sizes, startItem, startItem->Net(),
+                                               VECTOR2D( conn.a ) );
+                    router->UpdateSizes( sizes );
+
+                    if( !router->StartRouting( conn.a, startItem, layer ) )
+                        continue;
+
+                    router->Move( conn.b, endItem );
+
+                    if( router->FixRoute( conn.b, endItem, true, false ) )
+                    {
+                        // Clone the new items before CommitRouting() folds them into the
+                        // worker's world (which keeps later connections in this region from
+                        // colliding with them).
+                        std::vector<PNS::ITEM*> removed, added, heads;
+                        router->GetUpdatedItems( removed, added, heads );
+
+                        for( PNS::ITEM* item : added )
+                        {
+                            if( !item->IsVirtual() )
+                                aWorker.results.emplace_back( item->Clone() );
+                        }
+
+                        for( PNS::ITEM* head : heads )
+                            delete head;
+
+                        router->CommitRouting();
+                        aWorker.routedCount++;
+                    }
+                    else
+                    {
+                        router->StopRouting();
+                    }
+                }
+            };
+
+    std::vector<std::future<void>> futures;
+
+    for( size_t ii = 0; ii < numWorkers; ++ii )
+    {
+        futures.push_back( tp.submit_task(
+                [&, ii]()
+                {
+                    for( size_t rr = ii; rr < regions.size(); rr += numWorkers )
+                    {
+                        routeRegion( *workers[ii], regions[rr] );
+
+                        if( m_progressReporter )
+                            m_progressReporter->AdvanceProgress();
+                    }
+                } ) );
+    }
+
+    for( std::future<void>& fut : futures )
+    {
+        while( fut.wait_for( std::chrono::milliseconds( 250 ) ) != std::future_status::ready )
+        {
+            if( m_progressReporter )
+                m_progressReporter->KeepRefreshing();
+        }
+    }
+
+    // Merge the workers' routes into the board on the calling thread.
+    int routedCount = 0;
+
+    for( std::unique_ptr<WORKER>& worker : workers )
+    {
+        routedCount += worker->routedCount;
+
+        for( std::unique_ptr<PNS::ITEM>& item : worker->results )
+        {
+            NETINFO_ITEM* net = static_cast<NETINFO_ITEM*>( item->Net() );
+
+            if( !net )
+                net = NETINFO_LIST::OrphanedItem();
+
+            switch( item->Kind() )
+            {
+            case PNS::ITEM::SEGMENT_T:
+            {
+                PNS::SEGMENT* seg = static_cast<PNS::SEGMENT*>( item.get() );
+                PCB_TRACK*    track = new PCB_TRACK( m_board );
+                const SEG&    s = seg->Seg();
+
+                track->SetStart( VECTOR2I( s.A.x, s.A.y ) );
+                track->SetEnd( VECTOR2I( s.B.x, s.B.y ) );
+                track->SetWidth( seg->Width() );
+                track->SetLayer( worker->iface.GetBoardLayerFromPNSLayer( seg->Layers().Start() ) );
+                track->SetNet( net );
+                aCommit.Add( track );
+                break;
+            }
+
+            case PNS::ITEM::ARC_T:
+            {
+                PNS::ARC* arc = static_cast<PNS::ARC*>( item.get() );
+                PCB_ARC*  newArc = new PCB_ARC( m_board,
+                                                static_cast<const SHAPE_ARC*>( arc->Shape( -1 ) ) );
+
+                newArc->SetWidth( arc->Width() );
+                newArc->SetLayer( worker->iface.GetBoardLayerFromPNSLayer( arc->Layers().Start() ) );
+                newArc->SetNet( net );
+                aCommit.Add( newArc );
+                break;
+            }
+
+            case PNS::ITEM::VIA_T:
+            {
+                PNS::VIA* via = static_cast<PNS::VIA*>( item.get() );
+                PCB_VIA*  newVia = new PCB_VIA( m_board );
+
+                newVia->SetPosition( VECTOR2I( via->Pos().x, via->Pos().y ) );
+                newVia->SetWidth( PADSTACK::ALL_LAYERS, via->Diameter( 0 ) );
+                newVia->SetDrill( via->Drill() );
+                newVia->SetNet( net );
+                newVia->SetViaType( via->ViaType() ); // MUST be before SetLayerPair()
+                newVia->SetLayerPair(
+                        worker->iface.GetBoardLayerFromPNSLayer( via->Layers().Start() ),
+                        worker->iface.GetBoardLayerFromPNSLayer( via->Layers().End() ) );
+                aCommit.Add( newVia );
+                break;
+            }
+
+            default:
+                break;
+            }
+        }
+    }
+
+    return routedCount;
+}
@@ -0,0 +1,99 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright The KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, you may find one here:
+ * http://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+ * or you may search the http://www.gnu.org website for the version 2 license,
+ * or you may write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
+ */
+
+#ifndef __BATCH_ROUTER_H
+#define __BATCH_ROUTER_H
+
+#include <memory>
+#include <vector>
+
+#include <math/box2.h>
+#include <math/vector2d.h>
+
+class BOARD;
+class BOARD_COMMIT;
+class BOARD_CONNECTED_ITEM;
+class PROGRESS_REPORTER;
+
+/**
+ * Batch autorouting engine built on top of the PNS router.
+ *
+ * Unrouted connections are taken from the board's ratsnest, partitioned into spatially
+ * independent regions, and routed headlessly (walkaround mode, no shove) by several
+ * PNS::ROUTER instances running in parallel — one worker per thread, each on its own
+ * synced world, so concurrently routed regions cannot interact.  Each worker commits its
+ * routes into its private world as it goes, which keeps successive connections within a
+ * region from colliding with each other.  Results are merged into the board through a
+ * single BOARD_COMMIT on the calling thread.
+ *
+ * This is not a competitor to a topological autorouter: it is intended for bulk fanout
+ * and other short, mostly-unconstrained connections (see SetFanoutOnly()), where routing
+ * each connection independently is good enough and wall-clock time dominates.
+ */
+class BATCH_ROUTER
+{
+public:
+    BATCH_ROUTER( BOARD* aBoard );
+    ~BATCH_ROUTER();
+
+    /**
+     * Restrict the run to fanout-style connections: those with at least one pad endpoint
+     * and an as-the-crow-flies length below the escape-length threshold.
+     */
+    void SetFanoutOnly( bool aEnable ) { m_fanoutOnly = aEnable; }
+
+    void SetProgressReporter( PROGRESS_REPORTER* aReporter ) { m_progressReporter = aReporter; }
+
+    /**
+     * Route as many unrouted connections as possible, adding the new tracks and vias to
+     * aCommit.  The caller is responsible for pushing the commit.
+     *
+     * @return the number of connections successfully routed.
+     */
+    int Route( BOARD_COMMIT& aCommit );
+
+private:
+    ///< A single unrouted ratsnest connection.
+    struct CONNECTION
+    {
+        VECTOR2I              a;
+        VECTOR2I              b;
+        BOARD_CONNECTED_ITEM* itemA;
+        BOARD_CONNECTED_ITEM* itemB;
+        int                   netCode;
+        BOX2I                 bbox;      ///< endpoints' bbox inflated by the routing margin
+    };
+
+    ///< Collect the unrouted connections to attempt, applying the fanout filter if set.
+    std::vector<CONNECTION> collectConnections() const;
+
+    ///< Group connections into spatially disjoint regions (union-find on inflated bboxes).
+    std::vector<std::vector<CONNECTION>> partitionConnections( std::vector<CONNECTION> aConns ) const;
+
+private:
+    BOARD*             m_board;
+    bool               m_fanoutOnly;
+    PROGRESS_REPORTER* m_progressReporter;
+};
+
+#endif
@@ -34,6 +34,7 @@
 #include <drc/drc_rtree.h>
 #include <board_design_settings.h>
 #include <board_commit.h>
+#include <advanced_config.h>
 #include <board.h>
 #include <core/arraydim.h>
 #include <core/kicad_algo.h>
@@ -41,9 +42,12 @@
 #include <convert_shape_list_to_polygon.h>
 #include <footprint.h>
 #include <font/outline_font.h>
+#include <hash.h>
+#include <hash_eda.h>
 #include <length_delay_calculation/length_delay_calculation.h>
 #include <lset.h>
 #include <pcb_base_frame.h>
+#include <perf_counters.h>
 #include <pcb_track.h>
 #include <pcb_marker.h>
 #include <pcb_group.h>
@@ -71,6 +75,7 @@
 #include <string_utils.h>
 #include <thread_pool.h>
 #include <zone.h>
+#include <zone_triangulation_cache.h>
 #include <mutex>
 #include <pcb_board_outline.h>
 #include <local_history.h>
@@ -110,6 +115,8 @@ BOARD::BOARD() :
     // we have not loaded a board yet, assume latest until then.
     m_fileFormatVersionAtLoad = LEGACY_BOARD_FILE_VERSION;
 
+    m_historyDigest = 0;
+
     for( int layer = 0; layer < PCB_LAYER_ID_COUNT; ++layer )
     {
         m_layers[layer].m_name = GetStandardLayerName( ToLAYER_ID( layer ) );
@@ -273,6 +280,7 @@ void BOARD::IncrementTimeStamp()
         || !m_ZoneBBoxCache.empty()
         || m_CopperItemRTreeCache
         || m_maxClearanceValue.has_value()
+        || !m_EffectiveShapeCache.empty()
         || !m_itemByIdCache.empty() )
     {
         m_IntersectsAreaCache.clear();
@@ -284,6 +292,8 @@ void BOARD::IncrementTimeStamp()
 
         m_ZoneBBoxCache.clear();
 
+        m_EffectiveShapeCache.clear();
+
         m_CopperItemRTreeCache = nullptr;
 
         // These are always regenerated before use, but still probably safer to clear them
@@ -302,6 +312,81 @@ void BOARD::IncrementTimeStamp()
 }
 
 
+std::shared_ptr<SHAPE> BOARD::GetCachedEffectiveShape( const BOARD_ITEM* aItem,
+                                                       PCB_LAYER_ID aLayer, FLASHING aFlash )
+{
+    PTR_LAYER_FLASH_CACHE_KEY key = { aItem, aLayer, (int) aFlash };
+
+    {
+        std::shared_lock<std::shared_mutex> readLock( m_CachesMutex );
+
+        auto it = m_EffectiveShapeCache.find( key );
+
+        if( it != m_EffectiveShapeCache.end() )
+            return it->second;
+    }
+
+    std::shared_ptr<SHAPE> shape = aItem->GetEffectiveShape( aLayer, aFlash );
+
+    std::unique_lock<std::shared_mutex> writeLock( m_CachesMutex );
+    m_EffectiveShapeCache[ key ] = shape;
+
+    return shape;
+}
+
+
+std::map<std::string, size_t> BOARD::ReportMemoryUsage() const
+{
+    std::map<std::string, size_t> report;
+
+    size_t zoneBytes = 0;
+
+    for( ZONE* zone : m_zones )
+    {
+        zoneBytes += zone->Outline()->EstimateMemoryUsage();
+
+        for( PCB_LAYER_ID layer : zone->GetLayerSet() )
+        {
+            if( zone->HasFilledPolysForLayer( layer ) )
+                zoneBytes += zone->GetFilledPolysList( layer )->EstimateMemoryUsage();
+        }
+    }
+
+    report["zones"] = zoneBytes;
+
+    if( m_connectivity )
+        report["connectivity"] = m_connectivity->EstimateMemoryUsage();
+
+    size_t cacheBytes = 0;
+
+    {
+        std::shared_lock<std::shared_mutex> readLock( m_CachesMutex );
+
+        // Hash maps are counted by entry footprint; the RTrees and shapes behind the
+        // pointers have no size API, so they contribute only their entry overhead here.
+        cacheBytes += ( m_IntersectsCourtyardCache.size() + m_IntersectsFCourtyardCache.size()
+                        + m_IntersectsBCourtyardCache.size() )
+                      * ( sizeof( PTR_PTR_CACHE_KEY ) + sizeof( bool ) );
+        cacheBytes += ( m_IntersectsAreaCache.size() + m_EnclosedByAreaCache.size() )
+                      * ( sizeof( PTR_PTR_LAYER_CACHE_KEY ) + sizeof( bool ) );
+        cacheBytes += m_LayerExpressionCache.size() * ( sizeof( wxString ) + sizeof( LSET ) );
+        cacheBytes += m_ZoneBBoxCache.size() * ( sizeof( const ZONE* ) + sizeof( BOX2I ) );
+        cacheBytes += m_EffectiveShapeCache.size()
+                      * ( sizeof( PTR_LAYER_FLASH_CACHE_KEY ) + sizeof( std::shared_ptr<SHAPE> ) );
+        cacheBytes += m_CopperZoneRTreeCache.size()
+                      * ( sizeof( ZONE* ) + sizeof( std::unique_ptr<DRC_RTREE> ) );
+    }
+
+    report["caches"] = cacheBytes;
+    report["item_index"] = m_itemByIdCache.size() * ( sizeof( KIID ) + sizeof( BOARD_ITEM* ) );
+
+    for( const auto& [subsystem, bytes] : report )
+        PERF_COUNTERS::Get().Set( "mem." + subsystem, (int64_t) bytes );
+
+    return report;
+}
+
+
 void BOARD::UpdateRatsnestExclusions()
 {
     std::set<std::pair<KIID, KIID>> m_ratsnestExclusions;
@@ -1119,18 +1204,28 @@ void BOARD::CacheTriangulation( PROGRESS_REPORTER* aReporter, const std::vector<
     if( aReporter )
         aReporter->Report( _( "Tessellating copper zones..." ) );
 
+    // Persistent triangulation sidecar: fills whose polygon hash is unchanged are decoded
+    // from disk instead of re-tessellated; only changed fills hit the triangulator.
+    std::shared_ptr<ZONE_TRIANGULATION_CACHE> triCache;
+
+    if( ADVANCED_CFG::GetCfg().m_EnableTriangulationCache && !GetFileName().IsEmpty() )
+    {
+        triCache = std::make_shared<ZONE_TRIANGULATION_CACHE>( GetFileName() );
+        triCache->Load();
+    }
+
     thread_pool& tp = GetKiCadThreadPool();
     std::vector<std::future<size_t>> returns;
 
     returns.reserve( zones.size() );
 
     auto cache_zones =
-            [aReporter]( ZONE* aZone ) -> size_t
+            [aReporter, triCache]( ZONE* aZone ) -> size_t
             {
                 if( aReporter && aReporter->IsCancelled() )
                     return 0;
 
-                aZone->CacheTriangulation();
+                aZone->CacheTriangulation( UNDEFINED_LAYER, triCache.get() );
 
                 if( aReporter )
                     aReporter->AdvanceProgress();
@@ -1154,6 +1249,9 @@ void BOARD::CacheTriangulation( PROGRESS_REPORTER* aReporter, const std::vector<
             status = ret.wait_for( std::chrono::milliseconds( 250 ) );
         }
     }
+
+    if( triCache )
+        triCache->Save();
 }
 
 
@@ -1359,6 +1457,7 @@ void BOARD::Remove( BOARD_ITEM* aBoardItem, REMOVE_MODE aRemoveMode )
     wxASSERT( aBoardItem );
 
     m_itemByIdCache.erase( aBoardItem->m_Uuid );
+    m_lengthDelayCalc->InvalidateCachedItem( aBoardItem );
 
     switch( aBoardItem->Type() )
     {
@@ -2464,6 +2563,9 @@ void BOARD::SynchronizeNetsAndNetClasses( bool aResetTrackAndViaSizes )
         bds.SetCustomDiffPairViaGap( defaultNetClass->GetDiffPairViaGap() );
     }
 
+    // Cached calculation items hold effective netclass pointers which are now stale
+    m_lengthDelayCalc->ClearItemCache();
+
     InvokeListeners( &BOARD_LISTENER::OnBoardNetSettingsChanged, *this );
 }
 
@@ -3009,12 +3111,17 @@ void BOARD::RemoveAllListeners()
 
 void BOARD::OnItemChanged( BOARD_ITEM* aItem )
 {
+    m_lengthDelayCalc->InvalidateCachedItem( aItem );
+
     InvokeListeners( &BOARD_LISTENER::OnBoardItemChanged, *this, aItem );
 }
 
 
 void BOARD::OnItemsChanged( std::vector<BOARD_ITEM*>& aItems )
 {
+    for( const BOARD_ITEM* item : aItems )
+        m_lengthDelayCalc->InvalidateCachedItem( item );
+
     InvokeListeners( &BOARD_LISTENER::OnBoardItemsChanged, *this, aItems );
 }
 
@@ -3023,6 +3130,12 @@ void BOARD::OnItemsCompositeUpdate( std::vector<BOARD_ITEM*>& aAddedItems,
                                     std::vector<BOARD_ITEM*>& aRemovedItems,
                                     std::vector<BOARD_ITEM*>& aChangedItems )
 {
+    for( const BOARD_ITEM* item : aRemovedItems )
+        m_lengthDelayCalc->InvalidateCachedItem( item );
+
+    for( const BOARD_ITEM* item : aChangedItems )
+        m_lengthDelayCalc->InvalidateCachedItem( item );
+
     InvokeListeners( &BOARD_LISTENER::OnBoardCompositeUpdate, *this, aAddedItems, aRemovedItems,
                      aChangedItems );
 }
@@ -3452,6 +3565,46 @@ int BOARD::GetPadWithCastellatedAttrCount()
 }
 
 
+// Digest one top-level item for autosave rate limiting.  hash_eda covers the common
+// high-count types; everything else falls back to a cheap structural signature.
+static size_t historyItemDigest( const BOARD_ITEM* aItem )
+{
+    switch( aItem->Type() )
+    {
+    case PCB_FOOTPRINT_T:
+    case PCB_TRACE_T:
+    case PCB_ARC_T:
+    case PCB_VIA_T:
+    case PCB_FIELD_T:
+    case PCB_TEXT_T:
+    case PCB_TEXTBOX_T:
+    case PCB_TABLE_T:
+    case PCB_SHAPE_T:
+    case PCB_BARCODE_T:
+        return hash_fp_item( aItem, HASH_FLAGS::HASH_ALL );
+
+    case PCB_ZONE_T:
+    {
+        const ZONE* zone = static_cast<const ZONE*>( aItem );
+        size_t      ret = (size_t) zone->Outline()->GetHash().Value64[0];
+
+        hash_combine( ret, zone->GetNetCode(), zone->GetAssignedPriority() );
+        return ret;
+    }
+
+    default:
+    {
+        BOX2I  bbox = aItem->GetBoundingBox();
+        size_t ret = 0;
+
+        hash_combine( ret, aItem->Type(), aItem->GetLayer(), bbox.GetX(), bbox.GetY(),
+                      bbox.GetWidth(), bbox.GetHeight() );
+        return ret;
+    }
+    }
+}
+
+
 void BOARD::SaveToHistory( const wxString& aProjectPath, std::vector<wxString>& aFiles )
 {
     wxString projPath = GetProject()->GetProjectPath();
@@ -3482,6 +3635,30 @@ void BOARD::SaveToHistory( const wxString& aProjectPath, std::vector<wxString>&
 
     wxString rel = boardPath.Mid( projPath.length() );
 
+    // Rate-limit by actual change volume: digest the board contents and skip the export
+    // (and the downstream git commit) when nothing material changed since the last
+    // snapshot.  Hashing is far cheaper than serializing the board, and the autosave
+    // timer fires whether or not the edits since the last run amounted to anything.
+    size_t digest = 0xb0a4d;    // non-zero seed so an empty board still records a digest
+
+    for( const FOOTPRINT* footprint : Footprints() )
+        hash_combine( digest, historyItemDigest( footprint ) );
+
+    for( const PCB_TRACK* track : Tracks() )
+        hash_combine( digest, historyItemDigest( track ) );
+
+    for( const ZONE* zone : Zones() )
+        hash_combine( digest, historyItemDigest( zone ) );
+
+    for( const BOARD_ITEM* drawing : Drawings() )
+        hash_combine( digest, historyItemDigest( drawing ) );
+
+    if( digest == m_historyDigest )
+    {
+        wxLogTrace( traceAutoSave, wxS("[history] pcb saver skipping - no material changes") );
+        return;
+    }
+
     // Build destination path inside .history mirror.
     wxFileName historyRoot( projPath, wxEmptyString );
     historyRoot.AppendDir( wxS( ".history" ) );
@@ -3500,6 +3677,7 @@ void BOARD::SaveToHistory( const wxString& aProjectPath, std::vector<wxString>&
         // Save directly to history mirror path.
         pi->SaveBoard( dst.GetFullPath(), this, nullptr );
         aFiles.push_back( dst.GetFullPath() );
+        m_historyDigest = digest;
         wxLogTrace( traceAutoSave, wxS("[history] pcb saver exported '%s'"), dst.GetFullPath() );
     }
     catch( const IO_ERROR& ioe )
@@ -112,6 +112,18 @@ struct PTR_LAYER_CACHE_KEY
     }
 };
 
+struct PTR_LAYER_FLASH_CACHE_KEY
+{
+    const BOARD_ITEM* A;
+    PCB_LAYER_ID      Layer;
+    int               Flash;
+
+    bool operator==(const PTR_LAYER_FLASH_CACHE_KEY& other) const
+    {
+        return A == other.A && Layer == other.Layer && Flash == other.Flash;
+    }
+};
+
 struct PTR_PTR_LAYER_CACHE_KEY
 {
     BOARD_ITEM*  A;
@@ -165,6 +177,17 @@ namespace std
         }
     };
 
+    template <>
+    struct hash<PTR_LAYER_FLASH_CACHE_KEY>
+    {
+        std::size_t operator()( const PTR_LAYER_FLASH_CACHE_KEY& k ) const
+        {
+            std::size_t seed = 0xa82de1c0;
+            hash_combine( seed, k.A, k.Layer, k.Flash );
+            return seed;
+        }
+    };
+
     template <>
     struct hash<PTR_PTR_LAYER_CACHE_KEY>
     {
@@ -1380,6 +1403,31 @@ public:
         return m_itemByIdCache;
     }
 
+    /**
+     * Return the effective shape of \a aItem on \a aLayer, memoized in the board's run-time
+     * caches.
+     *
+     * DRC, router sync, connectivity and plotting all need the same compound shapes; this
+     * lets them share one geometry instance per (item, layer, flashing) instead of each
+     * rebuilding its own.  The cache is cleared by IncrementTimeStamp(), which BOARD_COMMIT
+     * drives on any board modification.
+     */
+    std::shared_ptr<SHAPE> GetCachedEffectiveShape( const BOARD_ITEM* aItem, PCB_LAYER_ID aLayer,
+                                                    FLASHING aFlash = FLASHING::DEFAULT );
+
+    /**
+     * Estimate per-subsystem memory usage for this board: zone outlines and fills (with
+     * their cached triangulations), the connectivity database, the run-time geometry/DRC
+     * caches and the item-by-id index.
+     *
+     * The figures are accounting estimates, not allocator totals.  Each entry is also
+     * published to the PERF_COUNTERS registry as a "mem.<subsystem>" gauge, so memory can
+     * be tracked and budgeted alongside the timing counters.
+     *
+     * @return map of subsystem name to estimated bytes
+     */
+    std::map<std::string, size_t> ReportMemoryUsage() const;
+
     // --------- Item order comparators ---------
 
     struct cmp_items
@@ -1406,6 +1454,8 @@ public:
     mutable std::unordered_map<const ZONE*, BOX2I>        m_ZoneBBoxCache;
     mutable std::optional<int>                            m_maxClearanceValue;
 
+    std::unordered_map<PTR_LAYER_FLASH_CACHE_KEY, std::shared_ptr<SHAPE>> m_EffectiveShapeCache;
+
     // ------------ DRC caches -------------
     std::vector<ZONE*>    m_DRCZones;
     std::vector<ZONE*>    m_DRCCopperZones;
@@ -1465,6 +1515,9 @@ private:
     int                 m_fileFormatVersionAtLoad;  // the version loaded from the file
     wxString            m_generator;                // the generator tag from the file
 
+    size_t              m_historyDigest;            // content digest of the last local-history
+                                                    // export (0 = never exported)
+
     std::map<wxString, wxString>        m_properties;
     std::shared_ptr<CONNECTIVITY_DATA>  m_connectivity;
 
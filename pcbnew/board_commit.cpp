@@ -25,6 +25,12 @@
 
 #include <macros.h>
 #include <pgm_base.h>
+
+#ifdef KICAD_IPC_API
+#include <api/api_server.h>
+#include <nlohmann/json.hpp>
+#endif
+
 #include <settings/settings_manager.h>
 #include <board.h>
 #include <footprint.h>
@@ -129,6 +135,24 @@ COMMIT& BOARD_COMMIT::Stage( const PICKED_ITEMS_LIST& aItems, UNDO_REDO aModFlag
 }
 
 
+std::vector<BOX2I> BOARD_COMMIT::GetChangedAreas() const
+{
+    std::vector<BOX2I> areas;
+
+    for( const COMMIT_LINE& entry : m_entries )
+    {
+        if( BOARD_ITEM* item = dynamic_cast<BOARD_ITEM*>( entry.m_item ) )
+            areas.push_back( item->GetBoundingBox() );
+
+        // For modifications the item may have moved; the old location is dirty too.
+        if( BOARD_ITEM* copy = dynamic_cast<BOARD_ITEM*>( entry.m_copy ) )
+            areas.push_back( copy->GetBoundingBox() );
+    }
+
+    return areas;
+}
+
+
 void BOARD_COMMIT::propagateDamage( BOARD_ITEM* aChangedItem, std::vector<ZONE*>* aStaleZones,
                                     std::vector<BOX2I>& aStaleRuleAreas )
 {
@@ -186,6 +210,15 @@ void BOARD_COMMIT::Push( const wxString& aMessage, int aCommitFlags )
     bool                itemsDeselected = false;
     bool                selectedModified = false;
 
+    // KIID / change type pairs pushed to API event subscribers once the commit has landed.
+    // Collected up front because removed items may no longer be alive by the end of Push().
+    std::vector<std::pair<KIID, int>> apiChanges;
+    bool publishApiEvents = false;
+
+#ifdef KICAD_IPC_API
+    publishApiEvents = m_isBoardEditor && PgmOrNull() && Pgm().GetApiServer().Publishing();
+#endif
+
     // Dirty flags and lists
     bool                     solderMaskDirty = false;
     bool                     autofillZones = false;
@@ -220,6 +253,13 @@ void BOARD_COMMIT::Push( const wxString& aMessage, int aCommitFlags )
             zone->CacheBoundingBox();
     }
 
+    // Captured before the entries are processed below; the copies recording the old item
+    // positions may have been freed by the end of Push().
+    std::vector<BOX2I> changedAreas;
+
+    if( autofillZones )
+        changedAreas = GetChangedAreas();
+
     for( COMMIT_LINE& entry : m_entries )
     {
         if( !entry.m_item || !entry.m_item->IsBOARD_ITEM() )
@@ -271,6 +311,9 @@ void BOARD_COMMIT::Push( const wxString& aMessage, int aCommitFlags )
             }
         }
 
+        if( publishApiEvents )
+            apiChanges.emplace_back( boardItem->m_Uuid, entry.m_type & CHT_TYPE );
+
         if( boardItem->IsSelected() )
             selectedModified = true;
     }
@@ -602,6 +645,8 @@ void BOARD_COMMIT::Push( const wxString& aMessage, int aCommitFlags )
         for( ZONE* zone : *staleZones )
             zoneFillerTool->DirtyZone( zone );
 
+        zoneFillerTool->DirtyRegions( changedAreas );
+
         m_toolMgr->PostAction( PCB_ACTIONS::zoneFillDirty );
     }
 
@@ -627,6 +672,33 @@ void BOARD_COMMIT::Push( const wxString& aMessage, int aCommitFlags )
         }
     }
 
+#ifdef KICAD_IPC_API
+    if( !apiChanges.empty() )
+    {
+        nlohmann::json event;
+        event["event"] = "board.changed";
+        event["board"] = std::string( board->GetFileName().ToUTF8() );
+        event["changes"] = nlohmann::json::array();
+
+        for( const auto& [uuid, changeType] : apiChanges )
+        {
+            nlohmann::json change;
+            change["id"] = uuid.AsStdString();
+
+            switch( changeType )
+            {
+            case CHT_ADD:    change["type"] = "added";    break;
+            case CHT_REMOVE: change["type"] = "removed";  break;
+            default:         change["type"] = "modified"; break;
+            }
+
+            event["changes"].push_back( change );
+        }
+
+        Pgm().GetApiServer().Publish( event.dump() );
+    }
+#endif
+
     clear();
 }
 
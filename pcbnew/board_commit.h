@@ -26,6 +26,7 @@
 #pragma once
 
 #include <commit.h>
+#include <math/box2.h>
 
 class BOARD_ITEM;
 class PCB_SHAPE;
@@ -70,6 +71,13 @@ public:
 
     static EDA_ITEM* MakeImage( EDA_ITEM* aItem );
 
+    /**
+     * Collect the bounding boxes of all staged changes (for modifications, both the
+     * pre-modification image and the current state).  Used to drive incremental
+     * recomputation such as ZONE_FILLER::SetDirtyRegions().
+     */
+    std::vector<BOX2I> GetChangedAreas() const;
+
 private:
     EDA_ITEM* undoLevelItem( EDA_ITEM* aItem ) const override;
 
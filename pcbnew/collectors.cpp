@@ -23,6 +23,7 @@
  */
 
 #include <collectors.h>
+#include <board.h>
 #include <board_item.h>             // class BOARD_ITEM
 
 #include <footprint.h>
@@ -31,12 +32,16 @@
 #include <pcb_track.h>
 #include <pcb_marker.h>
 #include <pcb_dimension.h>
+#include <pcb_table.h>
 #include <zone.h>
 #include <pcb_shape.h>
 #include <pcb_group.h>
 #include <macros.h>
 #include <math/util.h>      // for KiROUND
 
+#include <algorithm>
+#include <unordered_set>
+
 
 const std::vector<KICAD_T> GENERAL_COLLECTOR::AllBoardItems = {
     PCB_MARKER_T,           // in m_markers
@@ -152,6 +157,21 @@ const std::vector<KICAD_T> GENERAL_COLLECTOR::DraggableItems = {
 
 INSPECT_RESULT GENERAL_COLLECTOR::Inspect( EDA_ITEM* aTestItem, void* aTestData )
 {
+    // Fast reject on the (cached) bounding box before any of the per-type logic below.
+    // The collector is run over every board item for every pick, and on dense boards
+    // this is the only test the vast majority of items need.
+    if( aTestItem->IsBOARD_ITEM() )
+    {
+        BOX2I bbox = static_cast<BOARD_ITEM*>( aTestItem )->GetBoundingBox();
+
+        // Cover the largest hit-test slop used below (the zone corner test doubles the
+        // base accuracy)
+        bbox.Inflate( m_Guide->Accuracy() * 2 );
+
+        if( !bbox.Contains( m_refPos ) )
+            return INSPECT_RESULT::CONTINUE;
+    }
+
     BOARD_ITEM*         boardItem   = nullptr;
     FOOTPRINT*          footprint   = nullptr;
     PCB_GROUP*          group       = nullptr;
@@ -535,7 +555,79 @@ void GENERAL_COLLECTOR::Collect( BOARD_ITEM* aItem, const std::vector<KICAD_T>&
     SetRefPos( aRefPos );
 
     wxCHECK_RET( aItem, "" );
-    aItem->Visit( m_inspector, nullptr, m_scanTypes );
+
+    KIGFX::VIEW* view = aGuide.View();
+
+    // Clicking or hovering shouldn't have to test every item on a large board: when
+    // collecting from the whole board, use the view's R-tree to narrow the scan to the
+    // items around the hit position, the same way box selection
+    // (PCB_SELECTION_TOOL::SelectMultiple) already queries the view.  Anything else
+    // (e.g. collecting from a single footprint) just visits everything.
+    if( view && aItem->Type() == PCB_T )
+    {
+        BOARD* board = static_cast<BOARD*>( aItem );
+
+        // Cover the largest hit-test slop used by Inspect() (the zone corner test doubles
+        // the base accuracy).
+        int   slop = aGuide.Accuracy() * 2;
+        BOX2I queryBox( aRefPos - VECTOR2I( slop, slop ), VECTOR2I( 2 * slop, 2 * slop ) );
+
+        std::map<KICAD_T, size_t> typeRank;
+
+        for( size_t ii = 0; ii < m_scanTypes.size(); ++ii )
+            typeRank.try_emplace( m_scanTypes[ii], ii );
+
+        std::vector<EDA_ITEM*>        candidates;
+        std::unordered_set<EDA_ITEM*> uniqueItems;
+
+        auto addCandidate =
+                [&]( EDA_ITEM* item )
+                {
+                    if( typeRank.count( item->Type() ) && uniqueItems.insert( item ).second )
+                        candidates.push_back( item );
+                };
+
+        view->Query( queryBox,
+                [&]( KIGFX::VIEW_ITEM* viewItem ) -> bool
+                {
+                    if( !viewItem->IsBOARD_ITEM() )
+                        return true;
+
+                    BOARD_ITEM* item = static_cast<BOARD_ITEM*>( viewItem );
+
+                    addCandidate( item );
+
+                    // Table cells are not in the view's R-tree; their parent table is.
+                    if( item->Type() == PCB_TABLE_T )
+                    {
+                        for( PCB_TABLECELL* cell : static_cast<PCB_TABLE*>( item )->GetCells() )
+                            addCandidate( cell );
+                    }
+
+                    return true;
+                } );
+
+        // Board-level groups are not in the view's R-tree either; only their members are.
+        for( PCB_GROUP* group : board->Groups() )
+            addCandidate( group );
+
+        // Keep the collection in scan-list priority order, as a full visit would.
+        std::stable_sort( candidates.begin(), candidates.end(),
+                [&]( EDA_ITEM* a, EDA_ITEM* b )
+                {
+                    return typeRank[ a->Type() ] < typeRank[ b->Type() ];
+                } );
+
+        for( EDA_ITEM* candidate : candidates )
+        {
+            if( Inspect( candidate, nullptr ) == INSPECT_RESULT::QUIT )
+                break;
+        }
+    }
+    else
+    {
+        aItem->Visit( m_inspector, nullptr, m_scanTypes );
+    }
 
     // append 2nd list onto end of the first list
     for( EDA_ITEM* item : m_List2nd )
@@ -163,6 +163,13 @@ public:
     virtual int Accuracy() const = 0;
 
     virtual double OnePixelInIU() const = 0;
+
+    /**
+     * @return the view whose R-tree can be used to narrow collection to the items near
+     *         the hit position, or nullptr if none is available (the collector then
+     *         falls back to visiting every item).
+     */
+    virtual KIGFX::VIEW* View() const { return nullptr; }
 };
 
 
@@ -368,6 +375,8 @@ public:
 
         m_onePixelInIU = abs( aView->ToWorld( one, false ).x );
         m_accuracy = KiROUND( 5 * m_onePixelInIU );
+
+        m_view = aView;
     }
 
     /**
@@ -480,6 +489,8 @@ public:
 
     double OnePixelInIU() const override { return m_onePixelInIU; }
 
+    KIGFX::VIEW* View() const override { return m_view; }
+
 private:
     // the storage architecture here is not important, since this is only
     // a carrier object and its functions are what is used, and data only indirectly.
@@ -509,6 +520,8 @@ private:
 
     double m_onePixelInIU;
     int    m_accuracy;
+
+    KIGFX::VIEW* m_view;
 };
 
 
@@ -52,7 +52,7 @@ bool CN_CONNECTIVITY_ALGO::Remove( BOARD_ITEM* aItem )
     case PCB_FOOTPRINT_T:
         for( PAD* pad : static_cast<FOOTPRINT*>( aItem )->Pads() )
         {
-            m_itemMap[pad].MarkItemsAsInvalid();
+            m_itemMap[pad].MarkItemsAsInvalid( &m_staleRefs );
             m_itemMap.erase( pad );
         }
 
@@ -65,7 +65,7 @@ bool CN_CONNECTIVITY_ALGO::Remove( BOARD_ITEM* aItem )
     case PCB_VIA_T:
     case PCB_ZONE_T:
     case PCB_SHAPE_T:
-        m_itemMap[aItem].MarkItemsAsInvalid();
+        m_itemMap[aItem].MarkItemsAsInvalid( &m_staleRefs );
         m_itemMap.erase ( aItem );
         m_itemList.SetDirty( true );
         break;
@@ -221,8 +221,12 @@ bool CN_CONNECTIVITY_ALGO::Add( BOARD_ITEM* aItem )
 
 void CN_CONNECTIVITY_ALGO::RemoveInvalidRefs()
 {
-    for( CN_ITEM* item : m_itemList )
+    // Incremental repair: only the recorded neighbours of invalidated items can hold
+    // stale references, so a full scan of m_itemList isn't needed.
+    for( CN_ITEM* item : m_staleRefs )
         item->RemoveInvalidRefs();
+
+    m_staleRefs.clear();
 }
 
 
@@ -285,7 +289,7 @@ void CN_CONNECTIVITY_ALGO::searchConnections()
                             m_progressReporter->AdvanceProgress();
 
                         return 1;
-                    } );
+                    }, TP_PRIORITY_INCREMENTAL );
         }
 
         for( const std::future<size_t>& ret : returns )
@@ -310,7 +314,11 @@ void CN_CONNECTIVITY_ALGO::searchConnections()
         search_basic.Show();
 #endif
 
-    m_itemList.ClearDirtyFlags();
+    // Only the items we just searched can be dirty; don't touch the whole list.
+    for( CN_ITEM* item : dirtyItems )
+        item->SetDirty( false );
+
+    m_itemList.SetDirty( false );
 }
 
 
@@ -492,7 +500,7 @@ void CN_CONNECTIVITY_ALGO::Build( BOARD* aBoard, PROGRESS_REPORTER* aReporter )
     {
         CN_ZONE_LAYER* ptr = zitems[ii];
         returns[ii] = tp.submit_task(
-            [cache_zones, ptr] { return cache_zones( ptr ); } );
+            [cache_zones, ptr] { return cache_zones( ptr ); }, TP_PRIORITY_INCREMENTAL );
     }
 
     for( const std::future<size_t>& ret : returns )
@@ -513,6 +521,10 @@ void CN_CONNECTIVITY_ALGO::Build( BOARD* aBoard, PROGRESS_REPORTER* aReporter )
     //
     int ii = zitems.size();
 
+    // From-scratch build: defer spatial-index insertion and bulk-load the sorted batch at
+    // the end, which packs the R-tree much better than item-at-a-time insertion.
+    m_itemList.SetBulkMode( true );
+
     for( CN_ZONE_LAYER* zitem : zitems )
     {
         m_itemList.Add( zitem );
@@ -546,6 +558,8 @@ void CN_CONNECTIVITY_ALGO::Build( BOARD* aBoard, PROGRESS_REPORTER* aReporter )
         report( ++ii );
     }
 
+    m_itemList.FinishBulkLoad();
+
     if( aReporter )
     {
         aReporter->SetCurrentProgress( (double) ii / (double) size );
@@ -940,6 +954,7 @@ void CN_CONNECTIVITY_ALGO::Clear()
     m_connClusters.clear();
     m_itemMap.clear();
     m_itemList.Clear();
+    m_staleRefs.clear();
 
 }
 
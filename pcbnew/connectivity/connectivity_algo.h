@@ -184,10 +184,21 @@ public:
                 m_items.push_back( aItem );
         }
 
-        void MarkItemsAsInvalid()
+        void MarkItemsAsInvalid( std::vector<CN_ITEM*>* aStaleRefs = nullptr )
         {
             for( CN_ITEM* item : m_items )
+            {
                 item->SetValid( false );
+
+                // Only items physically connected to an invalidated item can hold a stale
+                // back-reference, so remembering them lets reference repair avoid visiting
+                // the whole item list.
+                if( aStaleRefs )
+                {
+                    for( CN_ITEM* neighbour : item->ConnectedItems() )
+                        aStaleRefs->push_back( neighbour );
+                }
+            }
         }
 
         void Link( CN_ITEM* aItem )
@@ -328,6 +339,10 @@ private:
     CN_LIST                                               m_itemList;
     std::unordered_map<const BOARD_ITEM*, ITEM_MAP_ENTRY> m_itemMap;
 
+    /// Valid items which may hold references to items invalidated since the last
+    /// connectivity search; only these need their reference lists repaired.
+    std::vector<CN_ITEM*>                                 m_staleRefs;
+
     std::vector<std::shared_ptr<CN_CLUSTER>>              m_connClusters;
     std::vector<std::shared_ptr<CN_CLUSTER>>              m_ratsnestClusters;
     std::vector<bool>                                     m_dirtyNets;
@@ -25,6 +25,7 @@
 
 #ifdef PROFILE
 #include <core/profile.h>
+#include <core/profile_trace.h>
 #endif
 
 #include <algorithm>
@@ -77,6 +78,7 @@ CONNECTIVITY_DATA::~CONNECTIVITY_DATA()
 bool CONNECTIVITY_DATA::Add( BOARD_ITEM* aItem )
 {
     m_connAlgo->Add( aItem );
+    markFromToCacheDirty( aItem );
     return true;
 }
 
@@ -84,6 +86,7 @@ bool CONNECTIVITY_DATA::Add( BOARD_ITEM* aItem )
 bool CONNECTIVITY_DATA::Remove( BOARD_ITEM* aItem )
 {
     m_connAlgo->Remove( aItem );
+    markFromToCacheDirty( aItem );
     return true;
 }
 
@@ -92,12 +95,31 @@ bool CONNECTIVITY_DATA::Update( BOARD_ITEM* aItem )
 {
     m_connAlgo->Remove( aItem );
     m_connAlgo->Add( aItem );
+    markFromToCacheDirty( aItem );
     return true;
 }
 
 
+void CONNECTIVITY_DATA::markFromToCacheDirty( BOARD_ITEM* aItem )
+{
+    if( !m_fromToCache )
+        return;
+
+    if( BOARD_CONNECTED_ITEM* citem = dynamic_cast<BOARD_CONNECTED_ITEM*>( aItem ) )
+        m_fromToCache->SetNetDirty( citem->GetNetCode() );
+
+    if( FOOTPRINT* footprint = dynamic_cast<FOOTPRINT*>( aItem ) )
+    {
+        for( PAD* pad : footprint->Pads() )
+            m_fromToCache->SetNetDirty( pad->GetNetCode() );
+    }
+}
+
+
 bool CONNECTIVITY_DATA::Build( BOARD* aBoard, PROGRESS_REPORTER* aReporter )
 {
+    TRACE_SCOPE traceScope( "CONNECTIVITY_DATA::Build", "connectivity" );
+
     aBoard->CacheTriangulation( aReporter );
 
     std::unique_lock<KISPINLOCK> lock( m_lock, std::try_to_lock );
@@ -179,6 +201,7 @@ void CONNECTIVITY_DATA::updateRatsnest()
 #ifdef PROFILE
     PROF_TIMER rnUpdate( "update-ratsnest" );
 #endif
+    TRACE_SCOPE traceScope( "CONNECTIVITY_DATA::updateRatsnest", "connectivity" );
 
     std::vector<RN_NET*> dirty_nets;
 
@@ -196,14 +219,14 @@ void CONNECTIVITY_DATA::updateRatsnest()
                             [&]( const int ii )
                             {
                                 dirty_nets[ii]->UpdateNet();
-                            } );
+                            }, TP_PRIORITY_INCREMENTAL );
     results.wait();
 
     auto results2 = tp.submit_loop( 0, dirty_nets.size(),
                             [&]( const int ii )
                             {
                                 dirty_nets[ii]->OptimizeRNEdges();
-                            } );
+                            }, TP_PRIORITY_INCREMENTAL );
     results2.wait();
 
 #ifdef PROFILE
@@ -373,7 +396,7 @@ void CONNECTIVITY_DATA::ComputeLocalRatsnest( const std::vector<BOARD_ITEM*>& aI
                             [&]( const int ii )
                             {
                                 update_lambda( ii );
-                            });
+                            }, TP_PRIORITY_INCREMENTAL );
     results.wait();
 
     // This gets the ratsnest for internal connections in the moving set
@@ -572,6 +595,34 @@ void CONNECTIVITY_DATA::ClearRatsnest()
 }
 
 
+size_t CONNECTIVITY_DATA::EstimateMemoryUsage() const
+{
+    size_t size = sizeof( *this );
+
+    if( m_connAlgo )
+    {
+        for( CN_ITEM* item : m_connAlgo->ItemList() )
+        {
+            size += sizeof( CN_ITEM );
+            size += item->Anchors().size()
+                    * ( sizeof( std::shared_ptr<CN_ANCHOR> ) + sizeof( CN_ANCHOR ) );
+        }
+    }
+
+    for( RN_NET* net : m_nets )
+    {
+        if( !net )
+            continue;
+
+        size += sizeof( RN_NET );
+        size += net->GetNodeCount() * sizeof( std::shared_ptr<CN_ANCHOR> );
+        size += net->GetEdges().size() * sizeof( CN_EDGE );
+    }
+
+    return size;
+}
+
+
 const std::vector<BOARD_CONNECTED_ITEM*>
 CONNECTIVITY_DATA::GetConnectedItems( const BOARD_CONNECTED_ITEM *aItem, int aFlags ) const
 {
@@ -825,7 +876,12 @@ bool CONNECTIVITY_DATA::TestTrackEndpointDangling( PCB_TRACK* aTrack, bool aIgno
             }
             else
             {
-                std::shared_ptr<SHAPE> shape = item->GetEffectiveShape( layer );
+                std::shared_ptr<SHAPE> shape;
+
+                if( BOARD* board = item->GetBoard() )
+                    shape = board->GetCachedEffectiveShape( item, layer );
+                else
+                    shape = item->GetEffectiveShape( layer );
 
                 hitStart = shape->Collide( aTrack->GetStart(), accuracy );
                 hitEnd = shape->Collide( aTrack->GetEnd(), accuracy );
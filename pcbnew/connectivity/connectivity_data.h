@@ -32,6 +32,7 @@
 
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <vector>
 #include <wx/string.h>
 
@@ -265,6 +266,13 @@ public:
 
     std::shared_ptr<CN_CONNECTIVITY_ALGO> GetConnectivityAlgo() const { return m_connAlgo; }
 
+    /**
+     * Estimate the heap memory held by the connectivity database (items, anchors, ratsnest
+     * nets and edges).  An accounting figure for memory-usage reporting, not an exact
+     * allocator total.
+     */
+    size_t EstimateMemoryUsage() const;
+
     KISPINLOCK& GetLock() { return m_lock; }
 
     void MarkItemNetAsDirty( BOARD_ITEM* aItem );
@@ -302,6 +310,10 @@ private:
 
     void addRatsnestCluster( const std::shared_ptr<CN_CLUSTER>& aCluster );
 
+    ///< Record aItem's net(s) as dirty in the from-to cache so its next Rebuild() is
+    ///< incremental (see FROM_TO_CACHE::SetNetDirty()).
+    void markFromToCacheDirty( BOARD_ITEM* aItem );
+
 private:
     std::shared_ptr<CN_CONNECTIVITY_ALGO> m_connAlgo;
 
@@ -320,7 +332,7 @@ private:
     std::weak_ptr<NET_SETTINGS> m_netSettings;
 
     /// @brief Used to map netcode to net name
-    std::map<int, wxString> m_netcodeMap;
+    std::unordered_map<int, wxString> m_netcodeMap;
 };
 
 #endif
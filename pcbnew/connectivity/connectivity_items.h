@@ -437,6 +437,23 @@ public:
 
     void RemoveInvalidItems( std::vector<CN_ITEM*>& aGarbage );
 
+    /**
+     * Defer spatial-index insertion while a from-scratch build adds items in bulk.
+     * FinishBulkLoad() sorts the deferred items along a space-filling curve and loads
+     * them into the index in one pass (see CN_RTREE::BulkLoad()).
+     */
+    void SetBulkMode( bool aEnable )
+    {
+        m_bulkMode = aEnable;
+    }
+
+    void FinishBulkLoad()
+    {
+        m_index.BulkLoad( m_pendingItems );
+        m_pendingItems.clear();
+        m_bulkMode = false;
+    }
+
     void ClearDirtyFlags()
     {
         for( CN_ITEM* item : m_items )
@@ -459,7 +476,10 @@ public:
 protected:
     void addItemtoTree( CN_ITEM* item )
     {
-        m_index.Insert( item );
+        if( m_bulkMode )
+            m_pendingItems.push_back( item );
+        else
+            m_index.Insert( item );
     }
 
 protected:
@@ -468,6 +488,8 @@ protected:
 private:
     bool                  m_dirty;
     bool                  m_hasInvalid;
+    bool                  m_bulkMode = false;
+    std::vector<CN_ITEM*> m_pendingItems;
     CN_RTREE<CN_ITEM*>    m_index;
 };
 
@@ -24,6 +24,10 @@
 #ifndef PCBNEW_CONNECTIVITY_RTREE_H_
 #define PCBNEW_CONNECTIVITY_RTREE_H_
 
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
 #include <math/box2.h>
 #include <router/pns_layerset.h>
 
@@ -64,6 +68,49 @@ public:
         m_tree->Insert( mmin, mmax, aItem );
     }
 
+    /**
+     * Function BulkLoad()
+     * Inserts a batch of items into the tree, pre-sorted along a space-filling curve.
+     * Spatially coherent insertion order packs the tree far more tightly than arbitrary
+     * per-item insertion, which matters for the initial from-scratch connectivity build.
+     * The incoming vector is reordered in place.
+     */
+    void BulkLoad( std::vector<T>& aItems )
+    {
+        auto mortonKey =
+                []( const T& aItem ) -> uint64_t
+                {
+                    const BOX2I& bbox = aItem->BBox();
+
+                    // Bias signed coordinates into unsigned space and keep the top 16 bits
+                    // of each axis; that is ample resolution for an insertion ordering.
+                    uint64_t x = ( (uint32_t) ( bbox.GetCenter().x - (int64_t) INT_MIN ) ) >> 16;
+                    uint64_t y = ( (uint32_t) ( bbox.GetCenter().y - (int64_t) INT_MIN ) ) >> 16;
+
+                    uint64_t key = 0;
+
+                    for( int bit = 0; bit < 16; ++bit )
+                    {
+                        key |= ( ( x >> bit ) & 1 ) << ( 2 * bit );
+                        key |= ( ( y >> bit ) & 1 ) << ( 2 * bit + 1 );
+                    }
+
+                    return key;
+                };
+
+        std::sort( aItems.begin(), aItems.end(),
+                [&]( const T& a, const T& b )
+                {
+                    if( a->StartLayer() != b->StartLayer() )
+                        return a->StartLayer() < b->StartLayer();
+
+                    return mortonKey( a ) < mortonKey( b );
+                } );
+
+        for( const T& item : aItems )
+            Insert( item );
+    }
+
     /**
      * Function Remove()
      * Removes an item from the tree. Removal is done by comparing pointers, attempting
@@ -121,14 +121,20 @@ static PATH_STATUS uniquePathBetweenNodes( CN_ITEM* u, CN_ITEM* v, std::vector<C
 };
 
 
-int FROM_TO_CACHE::cacheFromToPaths( const wxString& aFrom, const wxString& aTo )
+int FROM_TO_CACHE::cacheFromToPaths( const wxString& aFrom, const wxString& aTo,
+                                     const std::set<int>* aNetFilter )
 {
+    m_queriedPairs.emplace( aFrom, aTo );
+
     std::vector<FT_PATH>                  paths;
     std::shared_ptr<CONNECTIVITY_DATA>    connectivity = m_board->GetConnectivity();
     std::shared_ptr<CN_CONNECTIVITY_ALGO> cnAlgo = connectivity->GetConnectivityAlgo();
 
     for( FT_ENDPOINT& endpoint : m_ftEndpoints )
     {
+        if( aNetFilter && !aNetFilter->count( endpoint.parent->GetNetCode() ) )
+            continue;
+
         if( WildCompareString( aFrom, endpoint.name, false ) )
         {
             FT_PATH p;
@@ -250,11 +256,48 @@ bool  FROM_TO_CACHE::IsOnFromToPath( BOARD_CONNECTED_ITEM* aItem, const wxString
 }
 
 
+void FROM_TO_CACHE::SetNetDirty( int aNet )
+{
+    if( aNet >= 0 )
+        m_dirtyNets.insert( aNet );
+}
+
+
 void FROM_TO_CACHE::Rebuild( BOARD* aBoard )
 {
+    if( m_initialized && m_board == aBoard )
+    {
+        // Incremental rebuild: only paths crossing nets touched since the last rebuild can
+        // have changed, so drop those and recompute.  Untouched paths (typically almost all
+        // of them on a large board) are kept as-is.
+        if( m_dirtyNets.empty() )
+            return;
+
+        buildEndpointList();
+
+        std::erase_if( m_ftPaths,
+                [&]( const FT_PATH& path )
+                {
+                    return m_dirtyNets.count( path.net ) > 0;
+                } );
+
+        // Every queried pair must be revisited, not just the ones whose paths we erased
+        // above: an edit on a dirty net may have completed a path for a pair that matched
+        // nothing before (or whose other paths all run on clean nets).  The net filter
+        // keeps the endpoint scan restricted to the dirty nets.
+        for( const auto& [from, to] : m_queriedPairs )
+            cacheFromToPaths( from, to, &m_dirtyNets );
+
+        m_dirtyNets.clear();
+        return;
+    }
+
     m_board = aBoard;
     buildEndpointList();
     m_ftPaths.clear();
+    m_queriedPairs.clear();
+    m_dirtyNets.clear();
+    m_initialized = true;
 }
 
 
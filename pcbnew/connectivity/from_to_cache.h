@@ -58,16 +58,32 @@ public:
     void Rebuild( BOARD* aBoard );
     bool IsOnFromToPath( BOARD_CONNECTED_ITEM* aItem, const wxString& aFrom, const wxString& aTo );
 
+    /**
+     * Mark a net as touched by an edit.  The next Rebuild() will recompute only the cached
+     * paths crossing dirty nets instead of dropping the whole cache.
+     */
+    void SetNetDirty( int aNet );
+
     FT_PATH* QueryFromToPath( const std::set<BOARD_CONNECTED_ITEM*>& aItems );
 
 private:
-    int cacheFromToPaths( const wxString& aFrom, const wxString& aTo );
+    int cacheFromToPaths( const wxString& aFrom, const wxString& aTo,
+                          const std::set<int>* aNetFilter = nullptr );
     void buildEndpointList();
 
 private:
     std::vector<FT_ENDPOINT> m_ftEndpoints;
     std::vector<FT_PATH>     m_ftPaths;
 
+    ///< Every (from, to) wildcard pair ever cached, including pairs that currently match no
+    ///< path.  Incremental rebuilds must revisit all of them, not just the pairs whose paths
+    ///< were invalidated: an edit on a dirty net can complete a path for a pair whose other
+    ///< paths were untouched.
+    std::set<std::pair<wxString, wxString>> m_queriedPairs;
+
+    std::set<int>            m_dirtyNets;
+    bool                     m_initialized = false;
+
     BOARD*                   m_board;
 };
 
@@ -976,7 +976,7 @@ void PANEL_SETUP_RULES::OnSyntaxHelp( wxHyperlinkEvent& aEvent )
     m_helpWindow->SetDialogSizeInDU( 420, 320 );
 
     wxString html_txt = wxEmptyString;
-    ConvertMarkdown2Html( msGg_txt, html_txt );
+    ConvertMarkdown2HtmlCached( msGg_txt, html_txt );
 
     html_txt.Replace( wxS( "<td" ), wxS( "<td valign=top" ) );
     m_helpWindow->AddHTML_Text( html_txt );
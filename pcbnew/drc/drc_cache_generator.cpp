@@ -25,12 +25,16 @@
 #include <board_design_settings.h>
 #include <pcb_board_outline.h>
 #include <footprint.h>
+#include <pad.h>
+#include <geometry/approximation.h>
 #include <thread_pool.h>
 #include <zone.h>
 #include <connectivity/connectivity_data.h>
 #include <drc/drc_engine.h>
 #include <drc/drc_rtree.h>
 #include <drc/drc_cache_generator.h>
+#include <algorithm>
+#include <cstdint>
 #include <mutex>
 
 bool DRC_CACHE_GENERATOR::Run()
@@ -118,12 +122,68 @@ bool DRC_CACHE_GENERATOR::Run()
                 return true;
             };
 
-    auto addToCopperTree =
-            [&]( BOARD_ITEM* item ) -> bool
+    if( !reportPhase( _( "Gathering copper items..." ) ) )
+        return false;   // DRC cancelled
+
+    static const std::vector<KICAD_T> itemTypes = {
+        PCB_TRACE_T, PCB_ARC_T, PCB_VIA_T,
+        PCB_PAD_T,
+        PCB_SHAPE_T,
+        PCB_FIELD_T, PCB_TEXT_T, PCB_TEXTBOX_T,
+        PCB_TABLE_T, PCB_TABLECELL_T,
+        PCB_DIMENSION_T,
+        PCB_BARCODE_T
+    };
+
+    forEachGeometryItem( itemTypes, boardCopperLayers, countItems );
+
+    // Pad effective shapes are built lazily and cached on the item; build them up front so
+    // that the per-layer build tasks below only perform read accesses (c.f. ZONE_FILLER).
+    for( FOOTPRINT* footprint : m_board->Footprints() )
+    {
+        for( PAD* pad : footprint->Pads() )
+        {
+            if( pad->IsDirty() )
             {
-                if( m_drcEngine->IsCancelled() )
-                    return false;
+                pad->BuildEffectiveShapes();
+                pad->BuildEffectivePolygon( ERROR_OUTSIDE );
+            }
+        }
+    }
 
+    // Interleave the bits of the bounding-box centre coordinates (Morton order).  Inserting
+    // in this order approximates a sort-tile-recursive bulk load: spatially close items end
+    // up in the same R-tree pages, which cuts node visits on every later query.
+    auto mortonKey =
+            []( const BOX2I& aBBox ) -> uint64_t
+            {
+                auto spread =
+                        []( uint32_t x ) -> uint64_t
+                        {
+                            uint64_t v = x;
+                            v = ( v | ( v << 16 ) ) & 0x0000FFFF0000FFFFULL;
+                            v = ( v | ( v << 8 ) )  & 0x00FF00FF00FF00FFULL;
+                            v = ( v | ( v << 4 ) )  & 0x0F0F0F0F0F0F0F0FULL;
+                            v = ( v | ( v << 2 ) )  & 0x3333333333333333ULL;
+                            v = ( v | ( v << 1 ) )  & 0x5555555555555555ULL;
+                            return v;
+                        };
+
+                // Bias into unsigned space and drop the low bits; 16 bits per axis is
+                // plenty to sort a board into tiles.
+                uint32_t x = (uint32_t) ( (int64_t) aBBox.GetCenter().x - INT_MIN ) >> 16;
+                uint32_t y = (uint32_t) ( (int64_t) aBBox.GetCenter().y - INT_MIN ) >> 16;
+
+                return ( spread( x ) << 1 ) | spread( y );
+            };
+
+    // Gather the per-layer batches serially (cheap layer-set tests), then build each
+    // layer's tree in parallel: the per-layer trees inside DRC_RTREE are independent.
+    std::map<PCB_LAYER_ID, std::vector<std::pair<uint64_t, BOARD_ITEM*>>> layerBatches;
+
+    forEachGeometryItem( itemTypes, boardCopperLayers,
+            [&]( BOARD_ITEM* item ) -> bool
+            {
                 LSET copperLayers = item->GetLayerSet() & boardCopperLayers;
 
                 // Special-case pad holes which pierce all the copper layers
@@ -135,48 +195,64 @@ bool DRC_CACHE_GENERATOR::Run()
                         copperLayers = boardCopperLayers;
                 }
 
+                uint64_t key = mortonKey( item->GetBoundingBox() );
+
                 copperLayers.RunOnLayers(
                         [&]( PCB_LAYER_ID layer )
                         {
-                            m_board->m_CopperItemRTreeCache->Insert( item, layer, largestClearance );
+                            layerBatches[ layer ].emplace_back( key, item );
                         } );
 
-                done.fetch_add( 1 );
                 return true;
-            };
+            } );
 
-    if( !reportPhase( _( "Gathering copper items..." ) ) )
-        return false;   // DRC cancelled
+    count = 0;
 
-    static const std::vector<KICAD_T> itemTypes = {
-        PCB_TRACE_T, PCB_ARC_T, PCB_VIA_T,
-        PCB_PAD_T,
-        PCB_SHAPE_T,
-        PCB_FIELD_T, PCB_TEXT_T, PCB_TEXTBOX_T,
-        PCB_TABLE_T, PCB_TABLECELL_T,
-        PCB_DIMENSION_T,
-        PCB_BARCODE_T
-    };
+    for( const auto& [ layer, batch ] : layerBatches )
+        count += batch.size();
 
-    forEachGeometryItem( itemTypes, boardCopperLayers, countItems );
+    std::vector<std::future<void>> layerRets;
 
-    std::future<void> retn = tp.submit_task(
-            [&]()
-            {
-                std::unique_lock<std::shared_mutex> writeLock( m_board->m_CachesMutex );
+    {
+        std::unique_lock<std::shared_mutex> writeLock( m_board->m_CachesMutex );
 
-                if( !m_board->m_CopperItemRTreeCache )
-                    m_board->m_CopperItemRTreeCache = std::make_shared<DRC_RTREE>();
+        if( !m_board->m_CopperItemRTreeCache )
+            m_board->m_CopperItemRTreeCache = std::make_shared<DRC_RTREE>();
 
-                forEachGeometryItem( itemTypes, boardCopperLayers, addToCopperTree );
-            } );
+        for( auto& [ layer, batch ] : layerBatches )
+        {
+            layerRets.push_back( tp.submit_task(
+                    [this, layer = layer, &batch = batch, &largestClearance, &done]()
+                    {
+                        std::sort( batch.begin(), batch.end(),
+                                   []( const std::pair<uint64_t, BOARD_ITEM*>& a,
+                                       const std::pair<uint64_t, BOARD_ITEM*>& b )
+                                   {
+                                       return a.first < b.first;
+                                   } );
+
+                        for( const auto& [ key, item ] : batch )
+                        {
+                            if( m_drcEngine->IsCancelled() )
+                                return;
+
+                            m_board->m_CopperItemRTreeCache->Insert( item, layer,
+                                                                     largestClearance );
+                            done.fetch_add( 1 );
+                        }
+                    }, TP_PRIORITY_BATCH ) );
+        }
 
-    std::future_status status = retn.wait_for( std::chrono::milliseconds( 250 ) );
+        for( std::future<void>& ret : layerRets )
+        {
+            std::future_status status = ret.wait_for( std::chrono::milliseconds( 250 ) );
 
-    while( status != std::future_status::ready )
-    {
-        reportProgress( done, count );
-        status = retn.wait_for( std::chrono::milliseconds( 250 ) );
+            while( status != std::future_status::ready )
+            {
+                reportProgress( done, count );
+                status = ret.wait_for( std::chrono::milliseconds( 250 ) );
+            }
+        }
     }
 
     if( !reportPhase( _( "Tessellating copper zones..." ) ) )
@@ -232,7 +308,7 @@ bool DRC_CACHE_GENERATOR::Run()
                 [cache_zones, zone]
                 {
                     return cache_zones( zone );
-                } ) );
+                }, TP_PRIORITY_BATCH ) );
     }
 
     done.store( 1 );
@@ -20,6 +20,7 @@
     * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
     */
 
+#include <connectivity/connectivity_data.h>
 #include <drc/drc_creepage_utils.h>
 #include <geometry/intersection.h>
 #include <thread_pool.h>
@@ -2192,6 +2193,11 @@ void CREEPAGE_GRAPH::GeneratePaths( double aMaxWeight, PCB_LAYER_ID aLayer )
     std::unordered_map<const BOARD_ITEM*, std::unordered_map<int, std::vector<std::shared_ptr<GRAPH_NODE>>>> parent_net_groups;
     std::vector<const BOARD_ITEM*> parent_keys;
 
+    // Merged shape extents per parent item, used to prune whole parent pairs which are further
+    // apart than the creepage distance under test before enumerating their node pairs
+    std::unordered_map<const BOARD_ITEM*, BOX2I> parent_extents;
+    const double                                 maxWeightSquared = aMaxWeight * aMaxWeight;
+
     for( const auto& gn : nodes )
     {
         const BOARD_ITEM* parent = gn->m_parent->GetParent();
@@ -2200,6 +2206,11 @@ void CREEPAGE_GRAPH::GeneratePaths( double aMaxWeight, PCB_LAYER_ID aLayer )
             parent_keys.push_back( parent );
 
         parent_net_groups[parent][gn->m_net].push_back( gn );
+
+        auto [extentIt, inserted] = parent_extents.try_emplace( parent, gn->m_parent->GetExtents() );
+
+        if( !inserted )
+            extentIt->second.Merge( gn->m_parent->GetExtents() );
     }
 
     // Generate work items: compare nodes between different parents only
@@ -2209,6 +2220,14 @@ void CREEPAGE_GRAPH::GeneratePaths( double aMaxWeight, PCB_LAYER_ID aLayer )
     {
         for( size_t j = i + 1; j < parent_keys.size(); ++j )
         {
+            // No path below the target distance can exist between shapes further apart than the
+            // distance bound; skip the pair instead of rejecting its paths one by one
+            if( static_cast<double>( parent_extents[parent_keys[i]].SquaredDistance(
+                        parent_extents[parent_keys[j]] ) ) > maxWeightSquared )
+            {
+                continue;
+            }
+
             const auto& group1_nets = parent_net_groups[parent_keys[i]];
             const auto& group2_nets = parent_net_groups[parent_keys[j]];
 
@@ -2235,11 +2254,23 @@ void CREEPAGE_GRAPH::GeneratePaths( double aMaxWeight, PCB_LAYER_ID aLayer )
                             continue;
                     }
 
-                    // Add all node pairs from these net groups
+                    // Add all node pairs from these net groups.  Individual shapes can be much
+                    // smaller than their parent (e.g. the arcs and points of a board outline), so
+                    // prune once more at shape level.
                     for( const auto& gn1 : nodes1 )
                     {
+                        const BOX2I extents1 = gn1->m_parent->GetExtents();
+
                         for( const auto& gn2 : nodes2 )
+                        {
+                            if( static_cast<double>( extents1.SquaredDistance(
+                                        gn2->m_parent->GetExtents() ) ) > maxWeightSquared )
+                            {
+                                continue;
+                            }
+
                             work_items.push_back( { gn1, gn2 } );
+                        }
                     }
                 }
             }
@@ -2454,53 +2485,31 @@ std::shared_ptr<GRAPH_NODE> CREEPAGE_GRAPH::AddNetElements( int aNetCode, PCB_LA
     std::shared_ptr<GRAPH_NODE> virtualNode = AddNodeVirtual();
     virtualNode->m_net = aNetCode;
 
-    for( FOOTPRINT* footprint : m_board.Footprints() )
+    // Fetch the net's items from connectivity rather than scanning every pad, track, zone and
+    // drawing on the board for each net / layer combination
+    for( BOARD_CONNECTED_ITEM* item : m_board.GetConnectivity()->GetNetItems(
+                 aNetCode,
+                 { PCB_PAD_T, PCB_TRACE_T, PCB_ARC_T, PCB_VIA_T, PCB_ZONE_T, PCB_SHAPE_T } ) )
     {
-        for( PAD* pad : footprint->Pads() )
-        {
-            if( pad->GetNetCode() != aNetCode || !pad->IsOnLayer( aLayer ) )
-                continue;
+        if( !item->IsOnLayer( aLayer ) )
+            continue;
 
+        if( PAD* pad = dynamic_cast<PAD*>( item ) )
+        {
             if( std::shared_ptr<SHAPE> padShape = pad->GetEffectiveShape( aLayer ) )
                 Addshape( *padShape, virtualNode, pad );
         }
-    }
-
-    for( PCB_TRACK* track : m_board.Tracks() )
-    {
-        if( track->GetNetCode() != aNetCode || !track->IsOnLayer( aLayer ) )
-            continue;
-
-        if( std::shared_ptr<SHAPE> shape = track->GetEffectiveShape() )
-            Addshape( *shape, virtualNode, track );
-    }
-
-
-    for( ZONE* zone : m_board.Zones() )
-    {
-        if( zone->GetNetCode() != aNetCode || !zone->IsOnLayer( aLayer ) )
-            continue;
-
-        if( std::shared_ptr<SHAPE> shape = zone->GetEffectiveShape( aLayer ) )
-            Addshape( *shape, virtualNode, zone );
-    }
-
-    const DRAWINGS drawings = m_board.Drawings();
-
-    for( BOARD_ITEM* drawing : drawings )
-    {
-        if( drawing->IsConnected() )
+        else if( ZONE* zone = dynamic_cast<ZONE*>( item ) )
         {
-            BOARD_CONNECTED_ITEM* bci = static_cast<BOARD_CONNECTED_ITEM*>( drawing );
-
-            if( bci->GetNetCode() != aNetCode || !bci->IsOnLayer( aLayer ) )
-                continue;
-
-            if( std::shared_ptr<SHAPE> shape = bci->GetEffectiveShape() )
-                Addshape( *shape, virtualNode, bci );
+            if( std::shared_ptr<SHAPE> shape = zone->GetEffectiveShape( aLayer ) )
+                Addshape( *shape, virtualNode, zone );
+        }
+        else
+        {
+            if( std::shared_ptr<SHAPE> shape = item->GetEffectiveShape() )
+                Addshape( *shape, virtualNode, item );
         }
     }
 
-
     return virtualNode;
 }
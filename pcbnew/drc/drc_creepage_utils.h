@@ -185,6 +185,15 @@ public:
     virtual VECTOR2I  GetStartPoint() const { return VECTOR2I( 0, 0 ); };
     virtual VECTOR2I  GetEndPoint() const { return VECTOR2I( 0, 0 ); };
     VECTOR2I          GetPos() const { return m_pos; };
+
+    /// Conservative bounding box of the shape, used for spatial pruning of path candidates
+    virtual BOX2I GetExtents() const
+    {
+        BOX2I bbox( m_pos, VECTOR2I( 0, 0 ) );
+        bbox.Inflate( GetRadius() );
+        return bbox;
+    }
+
     CREEP_SHAPE::TYPE GetType() const { return m_type; };
     const BOARD_ITEM* GetParent() const { return m_parent; };
     void              SetParent( BOARD_ITEM* aParent ) { m_parent = aParent; };
@@ -313,6 +322,14 @@ public:
     VECTOR2I GetEnd() const { return m_end; };
     double   GetWidth() const { return m_width; };
 
+    BOX2I GetExtents() const override
+    {
+        BOX2I bbox( m_start, m_end - m_start );
+        bbox.Normalize();
+        bbox.Inflate( KiROUND( m_width / 2 ) );
+        return bbox;
+    }
+
     std::vector<PATH_CONNECTION> Paths( const BE_SHAPE_POINT& aS2, double aMaxWeight,
                                         double aMaxSquaredWeight ) const override;
     std::vector<PATH_CONNECTION> Paths( const BE_SHAPE_CIRCLE& aS2, double aMaxWeight,
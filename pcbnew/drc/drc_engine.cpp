@@ -43,7 +43,14 @@
 #include <pcb_track.h>
 #include <pcb_shape.h>
 #include <core/profile.h>
+#include <core/profile_trace.h>
+#include <perf_counters.h>
+#include <future>
 #include <thread_pool.h>
+#include <hash.h>
+#include <wx/filename.h>
+#include <advanced_config.h>
+#include <drc/drc_pair_cache.h>
 #include <zone.h>
 #include <project/project_file.h>
 #include <project/tuning_profiles.h>
@@ -785,10 +792,74 @@ void DRC_ENGINE::InitEngine( const wxFileName& aRulePath )
 }
 
 
+void DRC_ENGINE::SetChangedItems( const std::vector<BOARD_ITEM*>& aItems )
+{
+    m_changedRegions.clear();
+
+    // Anything within the worst-case clearance of a change can produce a new violation, so
+    // the regions are inflated once here rather than on every scope query.
+    int worstClearance = m_board->GetMaxClearanceValue();
+
+    for( BOARD_ITEM* item : aItems )
+    {
+        BOX2I bbox = item->GetBoundingBox();
+        bbox.Inflate( worstClearance );
+        m_changedRegions.push_back( bbox );
+    }
+}
+
+
+bool DRC_ENGINE::IsInTestScope( const BOX2I& aBBox ) const
+{
+    if( m_changedRegions.empty() )
+        return true;
+
+    for( const BOX2I& region : m_changedRegions )
+    {
+        if( region.Intersects( aBBox ) )
+            return true;
+    }
+
+    return false;
+}
+
+
+std::size_t DRC_ENGINE::rulesetHash() const
+{
+    std::size_t seed = m_rules.size();
+
+    // Implicit rules (board setup constraints, netclasses, keepouts) are materialized into
+    // m_rules by loadImplicitRules(), so hashing the compiled rules covers netclass and
+    // board-setup changes as well as the .kicad_dru file.
+    for( const std::shared_ptr<DRC_RULE>& rule : m_rules )
+    {
+        hash_combine( seed, rule->m_Name.ToStdString(), rule->m_LayerSource.ToStdString(),
+                      static_cast<int>( rule->m_Severity ) );
+
+        if( rule->m_Condition )
+            hash_combine( seed, rule->m_Condition->GetExpression().ToStdString() );
+
+        for( const DRC_CONSTRAINT& constraint : rule->m_Constraints )
+        {
+            const MINOPTMAX<int>& value = constraint.GetValue();
+
+            hash_combine( seed, static_cast<int>( constraint.m_Type ), constraint.m_DisallowFlags,
+                          static_cast<int>( constraint.m_ZoneConnection ), value.Min(),
+                          value.Opt(), value.Max() );
+        }
+    }
+
+    hash_combine( seed, m_designSettings->GetDRCEpsilon() );
+
+    return seed;
+}
+
+
 void DRC_ENGINE::RunTests( EDA_UNITS aUnits, bool aReportAllTrackErrors, bool aTestFootprints,
                            BOARD_COMMIT* aCommit )
 {
-    PROF_TIMER timer;
+    PROF_TIMER  timer;
+    TRACE_SCOPE traceScope( "DRC_ENGINE::RunTests", "drc" );
 
     SetUserUnits( aUnits );
 
@@ -807,6 +878,20 @@ void DRC_ENGINE::RunTests( EDA_UNITS aUnits, bool aReportAllTrackErrors, bool aT
 
     DRC_TEST_PROVIDER::Init();
 
+    wxFileName cacheFile( m_board->GetFileName() );
+    cacheFile.SetExt( wxT( "drc_cache" ) );
+
+    if( ADVANCED_CFG::GetCfg().m_EnableDRCPairCache && cacheFile.IsOk()
+            && !m_board->GetFileName().IsEmpty() )
+    {
+        m_pairCache = std::make_unique<DRC_PAIR_CACHE>( rulesetHash() );
+        m_pairCache->Load( cacheFile.GetFullPath() );
+    }
+    else
+    {
+        m_pairCache.reset();
+    }
+
     m_board->IncrementTimeStamp();      // Invalidate all caches...
 
     DRC_CACHE_GENERATOR cacheGenerator;
@@ -820,18 +905,74 @@ void DRC_ENGINE::RunTests( EDA_UNITS aUnits, bool aReportAllTrackErrors, bool aT
 
     int timestamp = m_board->GetTimeStamp();
 
-    for( DRC_TEST_PROVIDER* provider : m_testProviders )
+    // Schedule the providers.  Consecutive providers which declare themselves safe to run
+    // concurrently (read-only over the board and the caches generated above) are launched as
+    // a batch on separate threads; everything else runs exclusively, in registration order.
+    // Concurrent scheduling is only used on headless runs: with a UI progress reporter the
+    // phase/progress reporting (and cancellation UX) assumes one provider at a time.
+    bool cancelled = false;
+
+    for( size_t ii = 0; ii < m_testProviders.size() && !cancelled; )
     {
-        if( m_logReporter )
-            m_logReporter->Report( wxString::Format( wxT( "Run DRC provider: '%s'" ), provider->GetName() ) );
+        DRC_TEST_PROVIDER* provider = m_testProviders[ii];
 
-        if( !provider->RunTests( aUnits ) )
-            break;
+        if( m_progressReporter || !provider->CanRunConcurrently() )
+        {
+            if( m_logReporter )
+                m_logReporter->Report( wxString::Format( wxT( "Run DRC provider: '%s'" ), provider->GetName() ) );
+
+            std::string providerName( provider->GetName().ToUTF8() );
+            TRACE_SCOPE providerScope( providerName.c_str(), "drc" );
+
+            if( !provider->RunTests( aUnits ) )
+                cancelled = true;
+
+            ++ii;
+            continue;
+        }
+
+        std::vector<std::future<bool>> batch;
+
+        while( ii < m_testProviders.size() && m_testProviders[ii]->CanRunConcurrently() )
+        {
+            DRC_TEST_PROVIDER* batchProvider = m_testProviders[ii++];
+
+            if( m_logReporter )
+            {
+                m_logReporter->Report( wxString::Format( wxT( "Run DRC provider: '%s'" ),
+                                                         batchProvider->GetName() ) );
+            }
+
+            batch.emplace_back( std::async( std::launch::async,
+                                            [batchProvider, aUnits]()
+                                            {
+                                                std::string providerName( batchProvider->GetName().ToUTF8() );
+                                                TRACE_SCOPE providerScope( providerName.c_str(), "drc" );
+
+                                                return batchProvider->RunTests( aUnits );
+                                            } ) );
+        }
+
+        for( std::future<bool>& ret : batch )
+        {
+            if( !ret.get() )
+                cancelled = true;
+        }
     }
 
+    if( m_pairCache && !cancelled )
+        m_pairCache->Save( cacheFile.GetFullPath() );
+
+    m_changedRegions.clear();
+
     timer.Stop();
     wxLogTrace( traceDrcProfile, "DRC took %0.3f ms", timer.msecs() );
 
+    PERF_COUNTERS::Get().RecordDuration( "drc.run", timer.SinceStart<std::chrono::nanoseconds>() );
+
+    if( cancelled )
+        PERF_COUNTERS::Get().Increment( "drc.cancelled" );
+
     // DRC tests are multi-threaded; anything that causes us to attempt to re-generate the
     // caches while DRC is running is problematic.
     wxASSERT( timestamp == m_board->GetTimeStamp() );
@@ -1938,7 +2079,11 @@ void DRC_ENGINE::ReportViolation( const std::shared_ptr<DRC_ITEM>& aItem, const
 {
     static std::mutex globalLock;
 
-    m_errorLimits[ aItem->GetErrorCode() ] -= 1;
+    {
+        // Providers (and now batches of providers) report from multiple threads.
+        std::lock_guard<std::mutex> guard( globalLock );
+        m_errorLimits[ aItem->GetErrorCode() ] -= 1;
+    }
 
     if( m_violationHandler )
     {
@@ -36,6 +36,7 @@
 class BOARD_COMMIT;
 class BOARD_DESIGN_SETTINGS;
 class DRC_TEST_PROVIDER;
+class DRC_PAIR_CACHE;
 class DRC_TEST_PROVIDER_CREEPAGE;
 class PCB_EDIT_FRAME;
 class DS_PROXY_VIEW_ITEM;
@@ -185,6 +186,24 @@ public:
 
     REPORTER* GetLogReporter() const { return m_logReporter; }
 
+    /**
+     * @return the persistent item-pair result cache, or nullptr when disabled (see the
+     * EnableDRCPairCache advanced config setting).
+     */
+    DRC_PAIR_CACHE* GetPairCache() const { return m_pairCache.get(); }
+
+    /**
+     * Restrict the next RunTests() to the neighbourhoods of the given changed items
+     * (commit-scoped incremental DRC).  Scope-aware providers skip reference items outside
+     * the changed regions; markers previously reported for those items remain valid because
+     * nothing within the worst-case clearance of them has changed.  The scope is cleared
+     * when RunTests() finishes.
+     */
+    void SetChangedItems( const std::vector<BOARD_ITEM*>& aItems );
+
+    /// @return false iff an incremental scope is set and aBBox is outside all changed regions.
+    bool IsInTestScope( const BOX2I& aBBox ) const;
+
     bool QueryWorstConstraint( DRC_CONSTRAINT_T aRuleId, DRC_CONSTRAINT& aConstraint );
     std::set<int> QueryDistinctConstraints( DRC_CONSTRAINT_T aConstraintId );
 
@@ -248,6 +267,9 @@ private:
     void loadImplicitRules();
     std::shared_ptr<DRC_RULE> createImplicitRule( const wxString& name, DRC_IMPLICIT_SOURCE aImplicitSource );
 
+    ///< Hash of the compiled rule set; any change invalidates the persistent pair cache.
+    std::size_t rulesetHash() const;
+
 protected:
     BOARD_DESIGN_SETTINGS*     m_designSettings;
     BOARD*                     m_board;
@@ -265,6 +287,11 @@ protected:
     // constraint -> rule -> provider
     std::map<DRC_CONSTRAINT_T, std::vector<DRC_ENGINE_CONSTRAINT*>*> m_constraintMap;
 
+    std::unique_ptr<DRC_PAIR_CACHE> m_pairCache;
+
+    ///< Regions changed by the current commit; empty = full (non-incremental) run.
+    std::vector<BOX2I>         m_changedRegions;
+
     DRC_VIOLATION_HANDLER      m_violationHandler;
     REPORTER*                  m_logReporter;
     PROGRESS_REPORTER*         m_progressReporter;
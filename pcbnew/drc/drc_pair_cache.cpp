@@ -0,0 +1,153 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright The KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, you may find one here:
+ * http://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+ * or you may search the http://www.gnu.org website for the version 2 license,
+ * or you may write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
+ */
+
+#include <drc/drc_pair_cache.h>
+
+#include <fstream>
+#include <vector>
+
+#include <board_item.h>
+#include <hash.h>
+#include <hash_eda.h>
+
+// Bump when the key derivation or the file layout changes.
+static constexpr uint32_t DRC_PAIR_CACHE_MAGIC = 0x4b445243;   // 'KDRC'
+static constexpr uint32_t DRC_PAIR_CACHE_VERSION = 2;
+
+
+std::size_t DRC_PAIR_CACHE::itemHash( const BOARD_ITEM* aItem ) const
+{
+    {
+        std::lock_guard<std::mutex> lock( m_hashMutex );
+        auto it = m_itemHashes.find( aItem );
+
+        if( it != m_itemHashes.end() )
+            return it->second;
+    }
+
+    // Hash outside the lock; two workers racing on the same item just do the work twice.
+    // Absolute coordinates, not REL_COORD: a pad's hash must change when its footprint
+    // moves, or stale "clean" verdicts survive the move.
+    std::size_t hash = hash_fp_item( aItem, HASH_FLAGS::HASH_ALL & ~HASH_FLAGS::REL_COORD );
+
+    std::lock_guard<std::mutex> lock( m_hashMutex );
+    m_itemHashes.emplace( aItem, hash );
+
+    return hash;
+}
+
+
+uint64_t DRC_PAIR_CACHE::pairKey( const BOARD_ITEM* aItemA, const BOARD_ITEM* aItemB,
+                                  int aLayer ) const
+{
+    std::size_t hashA = itemHash( aItemA );
+    std::size_t hashB = itemHash( aItemB );
+
+    // The key must not depend on which item came out of the R-tree first.
+    if( hashA > hashB )
+        std::swap( hashA, hashB );
+
+    std::size_t key = hashA;
+    hash_combine( key, hashB, aLayer );
+
+    return static_cast<uint64_t>( key );
+}
+
+
+bool DRC_PAIR_CACHE::IsKnownClean( const BOARD_ITEM* aItemA, const BOARD_ITEM* aItemB,
+                                   int aLayer ) const
+{
+    uint64_t key = pairKey( aItemA, aItemB, aLayer );
+
+    std::lock_guard<std::mutex> lock( m_mutex );
+    return m_cleanPairs.count( key ) > 0;
+}
+
+
+void DRC_PAIR_CACHE::MarkClean( const BOARD_ITEM* aItemA, const BOARD_ITEM* aItemB, int aLayer )
+{
+    uint64_t key = pairKey( aItemA, aItemB, aLayer );
+
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_cleanPairs.insert( key );
+}
+
+
+void DRC_PAIR_CACHE::Load( const wxString& aPath )
+{
+    std::ifstream file( aPath.ToStdString(), std::ios::binary );
+
+    if( !file.good() )
+        return;
+
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    uint64_t rulesetHash = 0;
+    uint64_t count = 0;
+
+    file.read( reinterpret_cast<char*>( &magic ), sizeof( magic ) );
+    file.read( reinterpret_cast<char*>( &version ), sizeof( version ) );
+    file.read( reinterpret_cast<char*>( &rulesetHash ), sizeof( rulesetHash ) );
+    file.read( reinterpret_cast<char*>( &count ), sizeof( count ) );
+
+    if( !file.good()
+            || magic != DRC_PAIR_CACHE_MAGIC
+            || version != DRC_PAIR_CACHE_VERSION
+            || rulesetHash != static_cast<uint64_t>( m_rulesetHash ) )
+    {
+        return;
+    }
+
+    std::vector<uint64_t> keys( count );
+    file.read( reinterpret_cast<char*>( keys.data() ), count * sizeof( uint64_t ) );
+
+    if( !file.good() )
+        return;
+
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_cleanPairs.insert( keys.begin(), keys.end() );
+}
+
+
+void DRC_PAIR_CACHE::Save( const wxString& aPath ) const
+{
+    std::ofstream file( aPath.ToStdString(), std::ios::binary | std::ios::trunc );
+
+    if( !file.good() )
+        return;
+
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    uint32_t magic = DRC_PAIR_CACHE_MAGIC;
+    uint32_t version = DRC_PAIR_CACHE_VERSION;
+    uint64_t rulesetHash = static_cast<uint64_t>( m_rulesetHash );
+    uint64_t count = m_cleanPairs.size();
+
+    file.write( reinterpret_cast<const char*>( &magic ), sizeof( magic ) );
+    file.write( reinterpret_cast<const char*>( &version ), sizeof( version ) );
+    file.write( reinterpret_cast<const char*>( &rulesetHash ), sizeof( rulesetHash ) );
+    file.write( reinterpret_cast<const char*>( &count ), sizeof( count ) );
+
+    for( uint64_t key : m_cleanPairs )
+        file.write( reinterpret_cast<const char*>( &key ), sizeof( key ) );
+}
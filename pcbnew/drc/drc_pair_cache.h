@@ -0,0 +1,87 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright The KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, you may find one here:
+ * http://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+ * or you may search the http://www.gnu.org website for the version 2 license,
+ * or you may write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <wx/string.h>
+
+class BOARD_ITEM;
+
+/**
+ * A persistent cache of item-pair DRC results.
+ *
+ * Pairs which were tested clean are remembered across sessions, keyed by geometry hashes of
+ * both items (see hash_fp_item()) so that any change to either item — position, size, net,
+ * layer — produces a new key.  The whole cache is discarded when the rule-set hash changes.
+ *
+ * Only clean results are cached: violations are always re-evaluated so that markers carry
+ * fresh positions and messages.
+ *
+ * All methods are safe to call from multiple DRC worker threads.
+ */
+class DRC_PAIR_CACHE
+{
+public:
+    DRC_PAIR_CACHE( std::size_t aRulesetHash ) :
+            m_rulesetHash( aRulesetHash )
+    {}
+
+    /**
+     * Load previously saved results from aPath.  Results saved against a different rule-set
+     * hash (or an unreadable/corrupt file) are silently discarded.
+     */
+    void Load( const wxString& aPath );
+
+    /// Write all currently known-clean pairs to aPath.
+    void Save( const wxString& aPath ) const;
+
+    /// @return true if this exact pair (same geometry, nets and layer) was clean last time.
+    bool IsKnownClean( const BOARD_ITEM* aItemA, const BOARD_ITEM* aItemB, int aLayer ) const;
+
+    void MarkClean( const BOARD_ITEM* aItemA, const BOARD_ITEM* aItemB, int aLayer );
+
+private:
+    uint64_t pairKey( const BOARD_ITEM* aItemA, const BOARD_ITEM* aItemB, int aLayer ) const;
+
+    /**
+     * Memoized hash_fp_item() for the current DRC run.
+     *
+     * An item participates in one pair per R-tree neighbour, so without the memo its hash —
+     * a full walk of the item, including all pads of a footprint — is recomputed once per
+     * pair.  The board is read-only while providers run and the cache object is recreated
+     * for every run, so a hash computed once per item stays valid for the whole run.
+     */
+    std::size_t itemHash( const BOARD_ITEM* aItem ) const;
+
+private:
+    std::size_t                                              m_rulesetHash;
+    std::unordered_set<uint64_t>                             m_cleanPairs;
+    mutable std::unordered_map<const BOARD_ITEM*, std::size_t> m_itemHashes;
+    mutable std::mutex                                       m_mutex;
+    mutable std::mutex                                       m_hashMutex;
+};
@@ -25,9 +25,11 @@
 #ifndef DRC_RTREE_H_
 #define DRC_RTREE_H_
 
+#include <board.h>
 #include <board_item.h>
 #include <pad.h>
 #include <pcb_field.h>
+#include <atomic>
 #include <memory>
 #include <unordered_set>
 #include <set>
@@ -122,7 +124,12 @@ public:
             parent = aItem->GetParent();
 
         std::vector<const SHAPE*> subshapes;
-        std::shared_ptr<SHAPE> shape = aItem->GetEffectiveShape( aRefLayer );
+        std::shared_ptr<SHAPE> shape;
+
+        if( BOARD* board = aItem->GetBoard() )
+            shape = board->GetCachedEffectiveShape( aItem, aRefLayer );
+        else
+            shape = aItem->GetEffectiveShape( aRefLayer );
 
         wxCHECK2_MSG( shape, return, wxT( "Item does not have a valid shape for this layer" ) );
 
@@ -234,7 +241,12 @@ public:
         int min[2] = { box.GetX(),     box.GetY() };
         int max[2] = { box.GetRight(), box.GetBottom() };
 
-        std::shared_ptr<SHAPE> refShape = aRefItem->GetEffectiveShape( aRefLayer );
+        std::shared_ptr<SHAPE> refShape;
+
+        if( BOARD* board = aRefItem->GetBoard() )
+            refShape = board->GetCachedEffectiveShape( aRefItem, aRefLayer );
+        else
+            refShape = aRefItem->GetEffectiveShape( aRefLayer );
 
         int count = 0;
 
@@ -605,7 +617,10 @@ public:
 
 private:
     std::map<int, drc_rtree*> m_tree;
-    size_t                    m_count;
+
+    // Insertions into different layers' trees may run on different threads (see the bulk
+    // build in DRC_CACHE_GENERATOR), so the shared count must be atomic.
+    std::atomic<size_t>       m_count;
 };
 
 
@@ -98,12 +98,27 @@ public:
 
     virtual const wxString GetName() const;
 
+    /**
+     * Providers which only read the board and the caches built by DRC_CACHE_GENERATOR can be
+     * scheduled concurrently with other such providers on a headless (no progress reporter)
+     * run.  Providers which build or mutate shared state — connectivity, zone fills, netlist
+     * or library data — must keep the default and run exclusively.
+     */
+    virtual bool CanRunConcurrently() const { return false; }
+
 protected:
     int forEachGeometryItem( const std::vector<KICAD_T>& aTypes, const LSET& aLayers,
                              const std::function<bool(BOARD_ITEM*)>& aFunc );
 
     REPORTER* getLogReporter() const { return m_drcEngine->GetLogReporter(); }
 
+    /// @return true if aItem should be tested as a reference item on this (possibly
+    /// commit-scoped incremental) run.  See DRC_ENGINE::SetChangedItems().
+    bool isItemInTestScope( const BOARD_ITEM* aItem ) const
+    {
+        return m_drcEngine->IsInTestScope( aItem->GetBoundingBox() );
+    }
+
 #define REPORT_AUX( s ) if( getLogReporter() ) getLogReporter()->Report( s, RPT_SEVERITY_INFO )
 
     void reportViolation( std::shared_ptr<DRC_ITEM>& item, const VECTOR2I& aMarkerPos,
@@ -54,6 +54,8 @@ public:
     virtual bool Run() override;
 
     virtual const wxString GetName() const override { return wxT( "annular_width" ); };
+
+    bool CanRunConcurrently() const override { return true; }
 };
 
 
@@ -523,7 +523,7 @@ bool DRC_TEST_PROVIDER_CONNECTION_WIDTH::Run()
                 [&, netcode, layer]()
                 {
                     return build_netlayer_polys( netcode, layer );
-                } ) );
+                }, TP_PRIORITY_BATCH ) );
     }
 
     for( auto& ret : returns )
@@ -551,7 +551,7 @@ bool DRC_TEST_PROVIDER_CONNECTION_WIDTH::Run()
                     [min_checker, &itemsPoly, &netLayer, minWidth]()
                     {
                         return min_checker( itemsPoly, netLayer.Layer, minWidth );
-                    } ) );
+                    }, TP_PRIORITY_BATCH ) );
         }
     }
 
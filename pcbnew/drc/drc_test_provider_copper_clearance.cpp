@@ -36,6 +36,7 @@
 #include <geometry/shape_segment.h>
 
 #include <drc/drc_engine.h>
+#include <drc/drc_pair_cache.h>
 #include <drc/drc_rtree.h>
 #include <drc/drc_item.h>
 #include <drc/drc_rule.h>
@@ -184,6 +185,11 @@ bool DRC_TEST_PROVIDER_COPPER_CLEARANCE::testSingleLayerItemAgainstItem( BOARD_I
                                                                          PCB_LAYER_ID layer,
                                                                          BOARD_ITEM* other )
 {
+    DRC_PAIR_CACHE* pairCache = m_drcEngine->GetPairCache();
+
+    if( pairCache && pairCache->IsKnownClean( item, other, layer ) )
+        return true;
+
     bool           testClearance = !m_drcEngine->IsErrorLimitExceeded( DRCE_CLEARANCE );
     bool           testShorting = !m_drcEngine->IsErrorLimitExceeded( DRCE_SHORTING_ITEMS );
     bool           testHoles = !m_drcEngine->IsErrorLimitExceeded( DRCE_HOLE_CLEARANCE );
@@ -360,6 +366,9 @@ bool DRC_TEST_PROVIDER_COPPER_CLEARANCE::testSingleLayerItemAgainstItem( BOARD_I
         }
     }
 
+    if( !has_error && pairCache )
+        pairCache->MarkClean( item, other, layer );
+
     return !has_error;
 }
 
@@ -611,6 +620,9 @@ void DRC_TEST_PROVIDER_COPPER_CLEARANCE::testTrackClearances()
             {
                 PCB_TRACK* track = m_board->Tracks()[trackIdx];
 
+                if( !isItemInTestScope( track ) )
+                    return;
+
                 for( PCB_LAYER_ID layer : LSET( track->GetLayerSet() & boardCopperLayers ) )
                 {
                     std::shared_ptr<SHAPE> trackShape = track->GetEffectiveShape( layer );
@@ -712,7 +724,7 @@ void DRC_TEST_PROVIDER_COPPER_CLEARANCE::testTrackClearances()
 
     thread_pool& tp = GetKiCadThreadPool();
 
-    auto track_futures = tp.submit_loop( 0, m_board->Tracks().size(), testTrack );
+    auto track_futures = tp.submit_loop( 0, m_board->Tracks().size(), testTrack, TP_PRIORITY_BATCH );
 
     while( done < count )
     {
@@ -734,6 +746,11 @@ bool DRC_TEST_PROVIDER_COPPER_CLEARANCE::testPadAgainstItem( PAD* pad, SHAPE* pa
                                                              PCB_LAYER_ID aLayer,
                                                              BOARD_ITEM* other )
 {
+    DRC_PAIR_CACHE* pairCache = m_drcEngine->GetPairCache();
+
+    if( pairCache && pairCache->IsKnownClean( pad, other, aLayer ) )
+        return true;
+
     bool testClearance = !m_drcEngine->IsErrorLimitExceeded( DRCE_CLEARANCE );
     bool testShorting = !m_drcEngine->IsErrorLimitExceeded( DRCE_SHORTING_ITEMS );
     bool testHoles = !m_drcEngine->IsErrorLimitExceeded( DRCE_HOLE_CLEARANCE );
@@ -938,6 +955,9 @@ bool DRC_TEST_PROVIDER_COPPER_CLEARANCE::testPadAgainstItem( PAD* pad, SHAPE* pa
             doTestHole( pad, padShape, otherVia, otherVia->GetEffectiveHoleShape().get(), clearance );
     }
 
+    if( !has_error && pairCache )
+        pairCache->MarkClean( pad, other, aLayer );
+
     return !has_error;
 }
 
@@ -959,6 +979,9 @@ void DRC_TEST_PROVIDER_COPPER_CLEARANCE::testPadClearances( )
 
                 for( PAD* pad : footprint->Pads() )
                 {
+                    if( !isItemInTestScope( pad ) )
+                        continue;
+
                     for( PCB_LAYER_ID layer : LSET( pad->GetLayerSet() & boardCopperLayers ) )
                     {
                         if( m_drcEngine->IsCancelled() )
@@ -1025,7 +1048,7 @@ void DRC_TEST_PROVIDER_COPPER_CLEARANCE::testPadClearances( )
             };
 
     size_t numFootprints = m_board->Footprints().size();
-    auto returns = tp.submit_loop( 0, numFootprints, fp_check );
+    auto returns = tp.submit_loop( 0, numFootprints, fp_check, TP_PRIORITY_BATCH );
 
     // Wait for all threads to finish
     for( size_t ii = 0; ii < returns.size(); ++ii )
@@ -1143,17 +1166,20 @@ void DRC_TEST_PROVIDER_COPPER_CLEARANCE::testGraphicClearances()
                 {
                     if( !m_drcEngine->IsCancelled() )
                     {
-                        testGraphicAgainstZone( item );
-
-                        if( ( item->Type() == PCB_SHAPE_T || item->Type() == PCB_BARCODE_T )
-                                && item->IsOnCopperLayer() )
+                        if( isItemInTestScope( item ) )
                         {
-                            testCopperGraphic( static_cast<PCB_SHAPE*>( item ) );
+                            testGraphicAgainstZone( item );
+
+                            if( ( item->Type() == PCB_SHAPE_T || item->Type() == PCB_BARCODE_T )
+                                    && item->IsOnCopperLayer() )
+                            {
+                                testCopperGraphic( static_cast<PCB_SHAPE*>( item ) );
+                            }
                         }
 
                         done.fetch_add( 1 );
                     }
-                } );
+                }, TP_PRIORITY_BATCH );
     }
 
     for( FOOTPRINT* footprint : m_board->Footprints() )
@@ -1165,18 +1191,21 @@ void DRC_TEST_PROVIDER_COPPER_CLEARANCE::testGraphicClearances()
                     {
                         if( !m_drcEngine->IsCancelled() )
                         {
-                            testGraphicAgainstZone( item );
-
-                            if( ( item->Type() == PCB_SHAPE_T || item->Type() == PCB_BARCODE_T )
-                                    && item->IsOnCopperLayer() )
+                            if( isItemInTestScope( item ) )
                             {
-                                testCopperGraphic( static_cast<PCB_SHAPE*>( item ) );
+                                testGraphicAgainstZone( item );
+
+                                if( ( item->Type() == PCB_SHAPE_T || item->Type() == PCB_BARCODE_T )
+                                        && item->IsOnCopperLayer() )
+                                {
+                                    testCopperGraphic( static_cast<PCB_SHAPE*>( item ) );
+                                }
                             }
 
                             done.fetch_add( 1 );
                         }
                     }
-                } );
+                }, TP_PRIORITY_BATCH );
     }
 
     while( true )
@@ -1370,12 +1399,15 @@ void DRC_TEST_PROVIDER_COPPER_CLEARANCE::testZonesToZones()
                 if( !polyA->BBoxFromCaches().Intersects( polyB->BBoxFromCaches() ) )
                     continue;
 
+                if( !isItemInTestScope( zoneA ) && !isItemInTestScope( zoneB ) )
+                    continue;
+
                 count++;
                 (void)tp.submit_task(
                         [checkZones, ia, ia2, sameNet, layer]()
                         {
                             checkZones( ia, ia2, sameNet, layer );
-                        } );
+                        }, TP_PRIORITY_BATCH );
             }
         }
     }
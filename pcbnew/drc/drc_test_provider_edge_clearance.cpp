@@ -65,6 +65,8 @@ public:
 
     virtual const wxString GetName() const override { return wxT( "edge_clearance" ); }
 
+    bool CanRunConcurrently() const override { return true; }
+
 private:
     void resolveSilkDisposition( BOARD_ITEM* aItem, const SHAPE* aItemShape, const SHAPE_POLY_SET& aBoardOutline );
 
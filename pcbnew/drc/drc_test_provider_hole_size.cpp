@@ -51,6 +51,8 @@ public:
 
     virtual const wxString GetName() const override { return wxT( "hole_size" ); };
 
+    bool CanRunConcurrently() const override { return true; }
+
 private:
     void checkViaHole( PCB_VIA* via, bool aExceedMicro, bool aExceedStd );
     void checkPadHole( PAD* aPad );
@@ -56,6 +56,8 @@ public:
 
     virtual const wxString GetName() const override { return wxT( "hole_to_hole_clearance" ); };
 
+    bool CanRunConcurrently() const override { return true; }
+
 private:
     bool testHoleAgainstHole( BOARD_ITEM* aItem, SHAPE_CIRCLE* aHole, BOARD_ITEM* aOther );
 
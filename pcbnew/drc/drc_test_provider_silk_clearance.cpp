@@ -55,6 +55,8 @@ public:
 
     virtual const wxString GetName() const override { return wxT( "silk_clearance" ); };
 
+    bool CanRunConcurrently() const override { return true; }
+
 private:
 
     BOARD* m_board;
@@ -91,6 +91,10 @@ private:
     std::unique_ptr<DRC_RTREE> m_fullSolderMaskRTree;
     std::unique_ptr<DRC_RTREE> m_itemTree;
 
+    // Zone fills collected during the geometry walk; unioned into the mask layers in one
+    // parallel batch afterwards rather than zone-by-zone.
+    std::map<PCB_LAYER_ID, std::vector<std::shared_ptr<SHAPE_POLY_SET>>> m_zoneMaskFills;
+
     std::mutex                                  m_checkedPairsMutex;
     std::unordered_map<PTR_PTR_CACHE_KEY, LSET> m_checkedPairs;
 
@@ -115,7 +119,7 @@ void DRC_TEST_PROVIDER_SOLDER_MASK::addItemToRTrees( BOARD_ITEM* aItem )
         {
             ZONE* zone = static_cast<ZONE*>( aItem );
 
-            solderMask->BooleanAdd( *zone->GetFilledPolysList( layer ) );
+            m_zoneMaskFills[ layer ].push_back( zone->GetFilledPolysList( layer ) );
         }
         else
         {
@@ -177,6 +181,44 @@ void DRC_TEST_PROVIDER_SOLDER_MASK::buildRTrees()
                 return true;
             } );
 
+    // Union the collected zone fills into the mask layers with a parallel tree reduction:
+    // each worker merges a slice of the fills with a single batch union, and the partial
+    // results are folded in with one more sweep.
+    thread_pool& tp = GetKiCadThreadPool();
+
+    for( PCB_LAYER_ID layer : { F_Mask, B_Mask } )
+    {
+        std::vector<std::shared_ptr<SHAPE_POLY_SET>>& fills = m_zoneMaskFills[ layer ];
+
+        if( fills.empty() )
+            continue;
+
+        size_t numChunks = std::min<size_t>( fills.size(),
+                                             std::max<size_t>( 1, tp.get_thread_count() ) );
+
+        std::vector<SHAPE_POLY_SET> partials( numChunks );
+
+        tp.submit_loop( 0, numChunks,
+                [&]( size_t aChunk )
+                {
+                    std::vector<const SHAPE_POLY_SET*> operands;
+
+                    for( size_t jj = aChunk; jj < fills.size(); jj += numChunks )
+                        operands.push_back( fills[jj].get() );
+
+                    partials[aChunk].BooleanAdd( operands );
+                }, TP_PRIORITY_BATCH ).wait();
+
+        std::vector<const SHAPE_POLY_SET*> operands;
+
+        for( const SHAPE_POLY_SET& partial : partials )
+            operands.push_back( &partial );
+
+        solderMask->GetFill( layer )->BooleanAdd( operands );
+    }
+
+    m_zoneMaskFills.clear();
+
     solderMask->GetFill( F_Mask )->Simplify();
     solderMask->GetFill( B_Mask )->Simplify();
 
@@ -771,7 +813,7 @@ void DRC_TEST_PROVIDER_SOLDER_MASK::testMaskBridges()
                 ++count;
 
                 return true;
-            } );
+            }, TP_PRIORITY_BATCH );
 
     for( auto& ret : returns )
     {
@@ -51,6 +51,8 @@ public:
     virtual bool Run() override;
 
     virtual const wxString GetName() const override { return wxT( "text_dimensions" ); };
+
+    bool CanRunConcurrently() const override { return true; }
 };
 
 
@@ -52,6 +52,8 @@ public:
     virtual bool Run() override;
 
     virtual const wxString GetName() const override { return wxT( "text_mirroring" ); };
+
+    bool CanRunConcurrently() const override { return true; }
 };
 
 
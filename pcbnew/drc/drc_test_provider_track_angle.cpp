@@ -49,6 +49,8 @@ public:
     virtual bool Run() override;
 
     virtual const wxString GetName() const override { return wxT( "angle" ); };
+
+    bool CanRunConcurrently() const override { return true; }
 };
 
 
@@ -196,7 +198,8 @@ bool DRC_TEST_PROVIDER_TRACK_ANGLE::Run()
     int       ii = 0;
 
     thread_pool& tp = GetKiCadThreadPool();
-    auto futures = tp.submit_loop( 0, m_drcEngine->GetBoard()->Tracks().size(), checkTrackAngle );
+    auto futures = tp.submit_loop( 0, m_drcEngine->GetBoard()->Tracks().size(), checkTrackAngle,
+                                  TP_PRIORITY_BATCH );
 
     for( auto& ret : futures )
     {
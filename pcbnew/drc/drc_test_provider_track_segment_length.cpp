@@ -46,6 +46,8 @@ public:
     virtual bool Run() override;
 
     virtual const wxString GetName() const override { return wxT( "segment_length" ); };
+
+    bool CanRunConcurrently() const override { return true; }
 };
 
 
@@ -152,7 +154,8 @@ bool DRC_TEST_PROVIDER_TRACK_SEGMENT_LENGTH::Run()
     int       ii = 0;
 
     thread_pool&                   tp = GetKiCadThreadPool();
-    auto futures = tp.submit_loop( 0, m_drcEngine->GetBoard()->Tracks().size(), checkTrackSegmentLength );
+    auto futures = tp.submit_loop( 0, m_drcEngine->GetBoard()->Tracks().size(), checkTrackSegmentLength,
+                                  TP_PRIORITY_BATCH );
 
     for( auto& ret : futures )
     {
@@ -45,6 +45,8 @@ public:
     virtual bool Run() override;
 
     virtual const wxString GetName() const override { return wxT( "width" ); };
+
+    bool CanRunConcurrently() const override { return true; }
 };
 
 
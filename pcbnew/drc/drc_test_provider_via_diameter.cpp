@@ -45,6 +45,8 @@ public:
     virtual bool Run() override;
 
     virtual const wxString GetName() const override { return wxT( "diameter" ); };
+
+    bool CanRunConcurrently() const override { return true; }
 };
 
 
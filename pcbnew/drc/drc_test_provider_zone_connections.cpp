@@ -324,7 +324,7 @@ bool DRC_TEST_PROVIDER_ZONE_CONNECTIONS::Run()
                                     testZoneLayer( zoneLayers[ii].first, zoneLayers[ii].second );
                                     done.fetch_add( zoneLayers[ii].first->GetFilledPolysList( zoneLayers[ii].second )->FullPointCount() );
                                 }
-                            } );
+                            }, TP_PRIORITY_BATCH );
 
     for( auto& ret : returns )
     {
@@ -306,9 +306,11 @@ void IPC356D_WRITER::write_D356_records( std::vector <D356_RECORD> &aRecords, FI
 
         if( !rk.netname.empty() )
         {
-            d356_net = d356_net_map[rk.netname];
+            auto it = d356_net_map.find( rk.netname );
 
-            if( d356_net.empty() )
+            if( it != d356_net_map.end() )
+                d356_net = it->second;
+            else
                 d356_net = intern_new_d356_netname( rk.netname, d356_net_map, d356_net_set );
         }
 
@@ -370,8 +372,16 @@ bool IPC356D_WRITER::Write( const wxString& aFilename )
         return false;
     }
 
-    // This will contain everything needed for the 356 file
+    // This will contain everything needed for the 356 file; preallocate for the
+    // worst case (every track a via and every pad exported) to avoid regrowing
+    // the record buffer on large boards
     std::vector<D356_RECORD> d356_records;
+    size_t                   maxRecords = m_pcb->Tracks().size();
+
+    for( FOOTPRINT* footprint : m_pcb->Footprints() )
+        maxRecords += footprint->Pads().size();
+
+    d356_records.reserve( maxRecords );
 
     build_via_testpoints( m_pcb, d356_records );
 
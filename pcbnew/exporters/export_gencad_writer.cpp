@@ -838,6 +838,19 @@ void GENCAD_EXPORTER::createSignalsSection()
     NETINFO_ITEM* net;
     int           NbNoConn = 1;
 
+    // Build the netcode -> pads index in a single pass: rescanning every pad of the
+    // board for each net is quadratic and gets noticeable on large designs.
+    std::map<int, std::vector<std::pair<FOOTPRINT*, PAD*>>> padsByNet;
+
+    for( FOOTPRINT* footprint : m_board->Footprints() )
+    {
+        for( PAD* pad : footprint->Pads() )
+        {
+            if( pad->GetNetCode() > 0 )
+                padsByNet[ pad->GetNetCode() ].emplace_back( footprint, pad );
+        }
+    }
+
     fmt::print( m_file, "$SIGNALS\n" );
 
     for( unsigned ii = 0; ii < m_board->GetNetCount(); ii++ )
@@ -859,20 +872,14 @@ void GENCAD_EXPORTER::createSignalsSection()
             fmt::print( m_file, "{}", TO_UTF8( msg ) );
             fmt::print( m_file, "\n" );
 
-            for( FOOTPRINT* footprint : m_board->Footprints() )
+            for( const auto& [footprint, pad] : padsByNet[ net->GetNetCode() ] )
             {
-                for( PAD* pad : footprint->Pads() )
-                {
-                    if( pad->GetNetCode() != net->GetNetCode() )
-                        continue;
+                msg.Printf( wxT( "NODE \"%s\" \"%s\"" ),
+                            escapeString( footprint->GetReference() ),
+                            escapeString( pad->GetNumber() ) );
 
-                    msg.Printf( wxT( "NODE \"%s\" \"%s\"" ),
-                                escapeString( footprint->GetReference() ),
-                                escapeString( pad->GetNumber() ) );
-
-                    fmt::print( m_file, "{}", TO_UTF8( msg ) );
-                    fmt::print( m_file, "\n" );
-                }
+                fmt::print( m_file, "{}", TO_UTF8( msg ) );
+                fmt::print( m_file, "\n" );
             }
         }
     }
@@ -43,6 +43,7 @@
 #include <reporter.h>
 #include <richio.h>
 #include <string_utils.h>
+#include <thread_pool.h>
 #include <tools/board_editor_control.h>
 #include <exporters/board_exporter_base.h>
 
@@ -127,7 +128,7 @@ private:
 class HYPERLYNX_EXPORTER : public BOARD_EXPORTER_BASE
 {
 public:
-    HYPERLYNX_EXPORTER() : m_polyId( 1 )
+    HYPERLYNX_EXPORTER()
     {
     }
 
@@ -200,19 +201,28 @@ private:
     bool writeDevices();
     bool writePadStacks();
     bool writeNets();
-    bool writeNetObjects( const std::vector<BOARD_ITEM*>& aObjects );
 
+    /**
+     * Format the items of one net section.
+     *
+     * Writes to the given formatter rather than the output file so that sections can be
+     * generated concurrently; @a aPolyId is the pre-assigned id of the first filled
+     * polygon of the section.
+     */
+    bool writeNetObjects( const std::vector<BOARD_ITEM*>& aObjects, OUTPUTFORMATTER& aOut,
+                          int& aPolyId );
 
-    void writeSinglePadStack( HYPERLYNX_PAD_STACK& aStack );
 
-    const std::vector<BOARD_ITEM*> collectNetObjects( int netcode );
+    void writeSinglePadStack( HYPERLYNX_PAD_STACK& aStack );
 
 private:
     std::vector<HYPERLYNX_PAD_STACK*>           m_padStacks;
     std::map<BOARD_ITEM*, HYPERLYNX_PAD_STACK*> m_padMap;
 
+    /// Simplified copper fills, one entry per zone layer, computed up front in parallel
+    std::map<ZONE*, std::vector<std::pair<PCB_LAYER_ID, SHAPE_POLY_SET>>> m_zoneFills;
+
     std::shared_ptr<FILE_OUTPUTFORMATTER>       m_out;
-    int                                         m_polyId;
 };
 
 
@@ -427,7 +437,8 @@ bool HYPERLYNX_EXPORTER::writePadStacks()
 }
 
 
-bool HYPERLYNX_EXPORTER::writeNetObjects( const std::vector<BOARD_ITEM*>& aObjects )
+bool HYPERLYNX_EXPORTER::writeNetObjects( const std::vector<BOARD_ITEM*>& aObjects,
+                                          OUTPUTFORMATTER& aOut, int& aPolyId )
 {
     for( BOARD_ITEM* item : aObjects )
     {
@@ -448,7 +459,7 @@ bool HYPERLYNX_EXPORTER::writeNetObjects( const std::vector<BOARD_ITEM*>& aObjec
                     padName = wxT( "1" );
 
 
-                m_out->Print( 1, "(PIN X=%.10f Y=%.10f R=\"%s.%s\" P=%d)\n",
+                aOut.Print( 1, "(PIN X=%.10f Y=%.10f R=\"%s.%s\" P=%d)\n",
                               iu2hyp( pad->GetPosition().x ),
                               iu2hyp( -pad->GetPosition().y ),
                               (const char*) ref.c_str(),
@@ -462,7 +473,7 @@ bool HYPERLYNX_EXPORTER::writeNetObjects( const std::vector<BOARD_ITEM*>& aObjec
 
             if( pstackIter != m_padMap.end() )
             {
-                m_out->Print( 1, "(VIA X=%.10f Y=%.10f P=%d)\n",
+                aOut.Print( 1, "(VIA X=%.10f Y=%.10f P=%d)\n",
                               iu2hyp( via->GetPosition().x ),
                               iu2hyp( -via->GetPosition().y ),
                               pstackIter->second->GetId() );
@@ -472,7 +483,7 @@ bool HYPERLYNX_EXPORTER::writeNetObjects( const std::vector<BOARD_ITEM*>& aObjec
         {
             const wxString layerName = m_board->GetLayerName( track->GetLayer() );
 
-            m_out->Print( 1, "(SEG X1=%.10f Y1=%.10f X2=%.10f Y2=%.10f W=%.10f L=\"%s\")\n",
+            aOut.Print( 1, "(SEG X1=%.10f Y1=%.10f X2=%.10f Y2=%.10f W=%.10f L=\"%s\")\n",
                           iu2hyp( track->GetStart().x ),
                           iu2hyp( -track->GetStart().y ),
                           iu2hyp( track->GetEnd().x ),
@@ -489,7 +500,7 @@ bool HYPERLYNX_EXPORTER::writeNetObjects( const std::vector<BOARD_ITEM*>& aObjec
             if( !arc->IsCCW() )
                 std::swap( start, end );
 
-            m_out->Print( 1, "(ARC X1=%.10f Y1=%.10f X2=%.10f Y2=%.10f XC=%.10f YC=%.10f R=%.10f W=%.10f L=\"%s\")\n",
+            aOut.Print( 1, "(ARC X1=%.10f Y1=%.10f X2=%.10f Y2=%.10f XC=%.10f YC=%.10f R=%.10f W=%.10f L=\"%s\")\n",
                           iu2hyp( start.x ),
                           iu2hyp( -start.y ),
                           iu2hyp( end.x ),
@@ -502,58 +513,55 @@ bool HYPERLYNX_EXPORTER::writeNetObjects( const std::vector<BOARD_ITEM*>& aObjec
         }
         else if( ZONE* zone = dyn_cast<ZONE*>( item ) )
         {
-            for( PCB_LAYER_ID layer : zone->GetLayerSet().Seq() )
+            for( const auto& [layer, fill] : m_zoneFills.at( zone ) )
             {
-                const wxString layerName   = m_board->GetLayerName( layer );
-                SHAPE_POLY_SET fill = zone->GetFilledPolysList( layer )->CloneDropTriangulation();
-
-                fill.Simplify();
+                const wxString layerName = m_board->GetLayerName( layer );
 
                 for( int i = 0; i < fill.OutlineCount(); i++ )
                 {
                     const SHAPE_LINE_CHAIN& outl = fill.COutline( i );
                     const VECTOR2I          p0 = outl.CPoint( 0 );
 
-                    m_out->Print( 1, "{POLYGON T=POUR L=\"%s\" ID=%d X=%.10f Y=%.10f\n",
+                    aOut.Print( 1, "{POLYGON T=POUR L=\"%s\" ID=%d X=%.10f Y=%.10f\n",
                                   (const char*) layerName.c_str(),
-                                  m_polyId,
+                                  aPolyId,
                                   iu2hyp( p0.x ),
                                   iu2hyp( -p0.y ) );
 
                     for( int v = 0; v < outl.PointCount(); v++ )
                     {
-                        m_out->Print( 2, "(LINE X=%.10f Y=%.10f)\n",
+                        aOut.Print( 2, "(LINE X=%.10f Y=%.10f)\n",
                                       iu2hyp( outl.CPoint( v ).x ),
                                       iu2hyp( -outl.CPoint( v ).y ) );
                     }
 
-                    m_out->Print( 2, "(LINE X=%.10f Y=%.10f)\n", iu2hyp( p0.x ), iu2hyp( -p0.y ) );
-                    m_out->Print( 1, "}\n" );
+                    aOut.Print( 2, "(LINE X=%.10f Y=%.10f)\n", iu2hyp( p0.x ), iu2hyp( -p0.y ) );
+                    aOut.Print( 1, "}\n" );
 
                     for( int h = 0; h < fill.HoleCount( i ); h++ )
                     {
                         const SHAPE_LINE_CHAIN& holeShape = fill.CHole( i, h );
                         const VECTOR2I          ph0       = holeShape.CPoint( 0 );
 
-                        m_out->Print( 1, "{POLYVOID ID=%d X=%.10f Y=%.10f\n",
-                                      m_polyId,
+                        aOut.Print( 1, "{POLYVOID ID=%d X=%.10f Y=%.10f\n",
+                                      aPolyId,
                                       iu2hyp( ph0.x ),
                                       iu2hyp( -ph0.y ) );
 
                         for( int v = 0; v < holeShape.PointCount(); v++ )
                         {
-                            m_out->Print( 2, "(LINE X=%.10f Y=%.10f)\n",
+                            aOut.Print( 2, "(LINE X=%.10f Y=%.10f)\n",
                                           iu2hyp( holeShape.CPoint( v ).x ),
                                           iu2hyp( -holeShape.CPoint( v ).y ) );
                         }
 
-                        m_out->Print( 2, "(LINE X=%.10f Y=%.10f)\n",
+                        aOut.Print( 2, "(LINE X=%.10f Y=%.10f)\n",
                                       iu2hyp( ph0.x ),
                                       iu2hyp( -ph0.y ) );
-                        m_out->Print( 1, "}\n" );
+                        aOut.Print( 1, "}\n" );
                     }
 
-                    m_polyId++;
+                    aPolyId++;
                 }
             }
         }
@@ -563,81 +571,143 @@ bool HYPERLYNX_EXPORTER::writeNetObjects( const std::vector<BOARD_ITEM*>& aObjec
 }
 
 
-const std::vector<BOARD_ITEM*> HYPERLYNX_EXPORTER::collectNetObjects( int netcode )
+bool HYPERLYNX_EXPORTER::writeNets()
 {
-    std::vector<BOARD_ITEM*> rv;
-
-    auto check =
-            [&]( BOARD_CONNECTED_ITEM* item ) -> bool
+    // Bucket the copper items by net in a single pass over the board: re-collecting
+    // them per net re-scans every footprint, track and zone for each net, which is
+    // quadratic and dominates the export time on dense boards.  Items on the null
+    // net all land in bucket 0.
+    std::map<int, std::vector<BOARD_ITEM*>> itemsByNet;
+
+    auto collect =
+            [&]( BOARD_CONNECTED_ITEM* item )
             {
                 if( ( item->GetLayerSet() & LSET::AllCuMask() ).none() )
-                    return false;
-
-                if( item->GetNetCode() == netcode || ( netcode < 0 && item->GetNetCode() <= 0 ) )
-                    return true;
+                    return;
 
-                return false;
+                itemsByNet[ std::max( item->GetNetCode(), 0 ) ].push_back( item );
             };
 
     for( FOOTPRINT* footprint : m_board->Footprints() )
     {
         for( PAD* pad : footprint->Pads() )
+            collect( pad );
+    }
+
+    for( PCB_TRACK* track : m_board->Tracks() )
+        collect( track );
+
+    for( ZONE* zone : m_board->Zones() )
+        collect( zone );
+
+    // Simplifying the zone fills is the expensive part of the net sections and each
+    // zone is independent, so farm it out to the thread pool first.  The slots are
+    // created up front so that the workers never mutate the map itself.
+    thread_pool& tp = GetKiCadThreadPool();
+
+    m_zoneFills.clear();
+
+    for( const auto& [netcode, items] : itemsByNet )
+    {
+        for( BOARD_ITEM* item : items )
         {
-            if( check( pad ) )
-                rv.push_back( pad );
+            if( ZONE* zone = dyn_cast<ZONE*>( item ) )
+                m_zoneFills[ zone ];
         }
     }
 
-    for( PCB_TRACK* item : m_board->Tracks() )
+    std::vector<std::future<void>> returns;
+
+    returns.reserve( m_zoneFills.size() );
+
+    for( auto& [zone, fills] : m_zoneFills )
     {
-        if( check( item ) )
-            rv.push_back( item );
+        returns.emplace_back( tp.submit_task(
+                [zone = zone, &fills = fills]
+                {
+                    for( PCB_LAYER_ID layer : zone->GetLayerSet().Seq() )
+                    {
+                        SHAPE_POLY_SET fill =
+                                zone->GetFilledPolysList( layer )->CloneDropTriangulation();
+
+                        fill.Simplify();
+                        fills.emplace_back( layer, std::move( fill ) );
+                    }
+                } ) );
     }
 
-    for( ZONE* zone : m_board->Zones() )
+    for( const std::future<void>& ret : returns )
+        ret.wait();
+
+    // Build the net sections in file order: the named nets first, then one section
+    // per null-net item.
+    std::vector<std::pair<wxString, std::vector<BOARD_ITEM*>>> sections;
+
+    for( const NETINFO_ITEM* netInfo : m_board->GetNetInfo() )
     {
-        if( check( zone ) )
-            rv.push_back( zone );
-    }
+        if( netInfo->GetNetCode() <= 0 || netInfo->GetNetname().IsEmpty() )
+            continue;
 
-    return rv;
-}
+        auto it = itemsByNet.find( netInfo->GetNetCode() );
 
+        if( it != itemsByNet.end() && it->second.size() )
+            sections.emplace_back( netInfo->GetNetname(), it->second );
+    }
 
-bool HYPERLYNX_EXPORTER::writeNets()
-{
-    m_polyId = 1;
+    int idx = 0;
 
-    for( const NETINFO_ITEM* netInfo : m_board->GetNetInfo() )
+    for( BOARD_ITEM* item : itemsByNet[ 0 ] )
     {
-        int  netcode = netInfo->GetNetCode();
-        bool isNullNet = netInfo->GetNetCode() <= 0 || netInfo->GetNetname().IsEmpty();
+        sections.emplace_back( wxString::Format( wxT( "EmptyNet%d" ), idx++ ),
+                               std::vector<BOARD_ITEM*>{ item } );
+    }
 
-        if( isNullNet )
-            continue;
+    // Pre-assign the polygon ids so that the concurrently generated sections number
+    // their polygons exactly as the serial writer did.
+    std::vector<int> firstPolyId( sections.size() );
+    int              polyId = 1;
 
-        const std::vector<BOARD_ITEM*> netObjects = collectNetObjects( netcode );
+    for( size_t ii = 0; ii < sections.size(); ii++ )
+    {
+        firstPolyId[ii] = polyId;
 
-        if( netObjects.size() )
+        for( BOARD_ITEM* item : sections[ii].second )
         {
-            m_out->Print( 0, "{NET=\"%s\"\n", (const char*) netInfo->GetNetname().c_str() );
-            writeNetObjects( netObjects );
-            m_out->Print( 0, "}\n\n" );
+            if( ZONE* zone = dyn_cast<ZONE*>( item ) )
+            {
+                for( const auto& [layer, fill] : m_zoneFills.at( zone ) )
+                    polyId += fill.OutlineCount();
+            }
         }
     }
 
-    const std::vector<BOARD_ITEM*> nullNetObjects = collectNetObjects( -1 );
+    // Format each section into its own buffer in parallel, then merge them to the
+    // file in net order.
+    std::vector<STRING_FORMATTER>  buffers( sections.size() );
+    std::vector<std::future<void>> formatReturns;
 
-    int idx = 0;
+    formatReturns.reserve( sections.size() );
 
-    for( BOARD_ITEM* item : nullNetObjects )
+    for( size_t ii = 0; ii < sections.size(); ii++ )
     {
-        m_out->Print( 0, "{NET=\"EmptyNet%d\"\n", idx );
-        writeNetObjects( { item } );
-        m_out->Print( 0, "}\n\n" );
-        idx++;
+        formatReturns.emplace_back( tp.submit_task(
+                [this, &sections, &buffers, &firstPolyId, ii]
+                {
+                    int sectionPolyId = firstPolyId[ii];
+
+                    buffers[ii].Print( 0, "{NET=\"%s\"\n",
+                                       (const char*) sections[ii].first.c_str() );
+                    writeNetObjects( sections[ii].second, buffers[ii], sectionPolyId );
+                    buffers[ii].Print( 0, "}\n\n" );
+                } ) );
     }
 
+    for( const std::future<void>& ret : formatReturns )
+        ret.wait();
+
+    for( STRING_FORMATTER& buffer : buffers )
+        m_out->Print( 0, "%s", buffer.GetString().c_str() );
+
     return true;
 }
 
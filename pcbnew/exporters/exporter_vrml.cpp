@@ -49,6 +49,7 @@
 #include <convert_basic_shapes_to_polygon.h>
 #include <geometry/geometry_utils.h>
 #include <macros.h>
+#include <wildcards_and_files_ext.h>
 
 #include <exporter_vrml.h>
 
@@ -1097,82 +1098,126 @@ void EXPORTER_PCB_VRML::ExportVrmlFootprint( FOOTPRINT* aFootprint, std::ostream
         {
             wxCHECK( aOutputFile, /* void */ );
 
-            int old_precision = aOutputFile->precision();
-            aOutputFile->precision( m_precision );
+            // Copy (or convert) each distinct model file only once: on boards with
+            // thousands of identical passives the path resolution and file system
+            // checks below would otherwise be repeated for every instance.  Embedded
+            // models resolve through the footprint's own file table, so only regular
+            // file references can share a cache entry.
+            bool       cacheable = !sM->m_Filename.StartsWith( FILEEXT::KiCadUriPrefix );
+            wxString   cacheKey = footprintBasePath + wxT( "|" ) + sM->m_Filename;
+            wxFileName dstFile;
 
-            embeddedFilesStack.clear();
-            embeddedFilesStack.push_back( aFootprint->GetEmbeddedFiles() );
-            embeddedFilesStack.push_back( m_board->GetEmbeddedFiles() );
+            auto cacheIt = cacheable ? m_inlineModelCache.find( cacheKey )
+                                     : m_inlineModelCache.end();
 
-            wxFileName srcFile = m_Cache3Dmodels->GetResolver()->ResolvePath( sM->m_Filename, footprintBasePath,
-                                                                              std::move( embeddedFilesStack ) );
-            if( !srcFile.FileExists() ) {
-		// skip model where the file cannot be resolved
-                ++sM;
-                continue;
-            }
+            if( cacheIt != m_inlineModelCache.end() )
+            {
+                if( cacheIt->second.IsEmpty() )
+                {
+                    // this model is already known to be unusable
+                    ++sM;
+                    continue;
+                }
 
-            wxFileName dstFile;
-            dstFile.SetPath( m_Subdir3DFpModels );
-            dstFile.SetName( srcFile.GetName() );
-            dstFile.SetExt( wxT( "wrl" ) );
+                dstFile.Assign( cacheIt->second );
+            }
+            else
+            {
+                embeddedFilesStack.clear();
+                embeddedFilesStack.push_back( aFootprint->GetEmbeddedFiles() );
+                embeddedFilesStack.push_back( m_board->GetEmbeddedFiles() );
+
+                wxFileName srcFile = m_Cache3Dmodels->GetResolver()->ResolvePath( sM->m_Filename, footprintBasePath,
+                                                                                  std::move( embeddedFilesStack ) );
+                if( !srcFile.FileExists() ) {
+                    // skip model where the file cannot be resolved
+                    if( cacheable )
+                        m_inlineModelCache[cacheKey] = wxEmptyString;
+
+                    ++sM;
+                    continue;
+                }
 
-            // copy the file if necessary
-            wxDateTime srcModTime = srcFile.GetModificationTime();
-            wxDateTime destModTime = wxDateTime();
+                dstFile.SetPath( m_Subdir3DFpModels );
+                dstFile.SetName( srcFile.GetName() );
+                dstFile.SetExt( wxT( "wrl" ) );
 
-            if( dstFile.FileExists() )
-                destModTime = dstFile.GetModificationTime();
+                // copy the file if necessary
+                wxDateTime srcModTime = srcFile.GetModificationTime();
+                wxDateTime destModTime = wxDateTime();
 
-            if( srcModTime != destModTime )
-            {
-                wxString fileExt = srcFile.GetExt();
-                fileExt.LowerCase();
+                if( dstFile.FileExists() )
+                    destModTime = dstFile.GetModificationTime();
 
-                // copy VRML models and use the scenegraph library to
-                // translate other model types
-                if( fileExt == wxT( "wrl" ) )
-                {
-                    if( !wxCopyFile( srcFile.GetFullPath(), dstFile.GetFullPath() ) )
-                    {
-                        ++sM;
-                        continue;
-                    }
-                }
-                else if( fileExt == wxT( "wrz" ) )
+                if( srcModTime != destModTime )
                 {
-                    wxFileInputStream input_file_stream( srcFile.GetFullPath() );
-                    if( !input_file_stream.IsOk() || input_file_stream.GetSize() == wxInvalidSize )
+                    wxString fileExt = srcFile.GetExt();
+                    fileExt.LowerCase();
+
+                    // copy VRML models and use the scenegraph library to
+                    // translate other model types
+                    if( fileExt == wxT( "wrl" ) )
                     {
-                        ++sM;
-                        continue;
+                        if( !wxCopyFile( srcFile.GetFullPath(), dstFile.GetFullPath() ) )
+                        {
+                            if( cacheable )
+                                m_inlineModelCache[cacheKey] = wxEmptyString;
+
+                            ++sM;
+                            continue;
+                        }
                     }
-
-                    wxZlibInputStream   zlib_input_stream( input_file_stream, wxZLIB_GZIP );
-                    wxFFileOutputStream output_file_stream( dstFile.GetFullPath() );
-                    if( !zlib_input_stream.IsOk() || !output_file_stream.IsOk() )
+                    else if( fileExt == wxT( "wrz" ) )
                     {
+                        wxFileInputStream input_file_stream( srcFile.GetFullPath() );
+                        if( !input_file_stream.IsOk() || input_file_stream.GetSize() == wxInvalidSize )
+                        {
+                            if( cacheable )
+                                m_inlineModelCache[cacheKey] = wxEmptyString;
+
+                            ++sM;
+                            continue;
+                        }
+
+                        wxZlibInputStream   zlib_input_stream( input_file_stream, wxZLIB_GZIP );
+                        wxFFileOutputStream output_file_stream( dstFile.GetFullPath() );
+                        if( !zlib_input_stream.IsOk() || !output_file_stream.IsOk() )
+                        {
+                            output_file_stream.Close();
+
+                            if( cacheable )
+                                m_inlineModelCache[cacheKey] = wxEmptyString;
+
+                            ++sM;
+                            continue;
+                        }
+
+                        output_file_stream.Write( zlib_input_stream );
                         output_file_stream.Close();
-                        ++sM;
-                        continue;
                     }
+                    else
+                    {
 
-                    output_file_stream.Write( zlib_input_stream );
-                    output_file_stream.Close();
-                }
-                else
-                {
+                        if( ( nullptr == mod3d) ||
+                            ( !S3D::WriteVRML( dstFile.GetFullPath().ToUTF8(), true, mod3d, m_ReuseDef,
+                                             true ) ) )
+                        {
+                            if( cacheable )
+                                m_inlineModelCache[cacheKey] = wxEmptyString;
 
-                    if( ( nullptr == mod3d) ||
-                        ( !S3D::WriteVRML( dstFile.GetFullPath().ToUTF8(), true, mod3d, m_ReuseDef,
-                                         true ) ) )
-                    {
-                        ++sM;
-                        continue;
+                            ++sM;
+                            continue;
+                        }
                     }
                 }
+
+                if( cacheable )
+                    m_inlineModelCache[cacheKey] = dstFile.GetFullPath();
             }
 
+            int old_precision = aOutputFile->precision();
+            aOutputFile->precision( m_precision );
+
             (*aOutputFile) << "Transform {\n";
 
             // only write a rotation if it is >= 0.1 deg
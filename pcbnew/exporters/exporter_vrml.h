@@ -240,6 +240,12 @@ private:
     // 3D subdirectory to copy footprint vrml 3D models when not merged in board file
     wxString m_Subdir3DFpModels;
 
+    // Destination of the model files already copied (or converted) into
+    // m_Subdir3DFpModels, keyed by library path and source filename; an empty value
+    // records a model that could not be exported.  Further instances of the same
+    // model reuse the entry instead of resolving and testing the file again.
+    std::map<wxString, wxString> m_inlineModelCache;
+
     // true to use relative paths in VRML inline{} for footprint 3D models
     // used only if m_UseInlineModelsInBrdfile = true
     bool     m_UseRelPathIn3DModelFilename;
@@ -51,6 +51,7 @@
 #include <gbr_metadata.h>
 
 #include <fmt/format.h>
+#include <stdexcept>
 
 
 // Oblong holes can be drilled by a "canned slot" command (G85) or a routing command
@@ -152,7 +153,7 @@ bool EXCELLON_WRITER::CreateDrillandMapFilesSet( const wxString& aPlotDirectory,
                     createDrillFile( file, span, file_type );
                     wroteDrillFile = true;
                 }
-                catch( ... )     // Capture fmt::print exception on write issues
+                catch( ... )     // Capture the write error reported by the output flush
                 {
                     fclose( file );
                     msg.Printf( _( "Failed to write file '%s'." ), fullFilename );
@@ -192,36 +193,36 @@ void EXCELLON_WRITER::writeHoleAttribute( HOLE_ATTRIBUTE aAttribute )
         switch( aAttribute )
         {
         case HOLE_ATTRIBUTE::HOLE_VIA_THROUGH:
-            fmt::print( m_file, "{}", "; #@! TA.AperFunction,Plated,PTH,ViaDrill\n" );
+            print( "{}", "; #@! TA.AperFunction,Plated,PTH,ViaDrill\n" );
             break;
 
         case HOLE_ATTRIBUTE::HOLE_VIA_BURIED:
-            fmt::print( m_file, "{}", "; #@! TA.AperFunction,Plated,Buried,ViaDrill\n" );
+            print( "{}", "; #@! TA.AperFunction,Plated,Buried,ViaDrill\n" );
             break;
 
         case HOLE_ATTRIBUTE::HOLE_VIA_BACKDRILL:
-            fmt::print( m_file, "{}", "; #@! TA.AperFunction,NonPlated,BackDrill\n" );
+            print( "{}", "; #@! TA.AperFunction,NonPlated,BackDrill\n" );
             break;
 
         case HOLE_ATTRIBUTE::HOLE_PAD:
         //case HOLE_ATTRIBUTE::HOLE_PAD_CASTELLATED:
-            fmt::print( m_file, "{}", "; #@! TA.AperFunction,Plated,PTH,ComponentDrill\n" );
+            print( "{}", "; #@! TA.AperFunction,Plated,PTH,ComponentDrill\n" );
             break;
 
         case HOLE_ATTRIBUTE::HOLE_PAD_CASTELLATED:
-            fmt::print( m_file, "{}", "; #@! TA.AperFunction,Plated,PTH,CastelletedDrill\n" );
+            print( "{}", "; #@! TA.AperFunction,Plated,PTH,CastelletedDrill\n" );
             break;
 
         case HOLE_ATTRIBUTE::HOLE_PAD_PRESSFIT:
-            fmt::print( m_file, "{}", "; #@! TA.AperFunction,Plated,PTH,ComponentDrill,PressFit\n" );
+            print( "{}", "; #@! TA.AperFunction,Plated,PTH,ComponentDrill,PressFit\n" );
             break;
 
         case HOLE_ATTRIBUTE::HOLE_MECHANICAL:
-            fmt::print( m_file, "{}", "; #@! TA.AperFunction,NonPlated,NPTH,ComponentDrill\n" );
+            print( "{}", "; #@! TA.AperFunction,NonPlated,NPTH,ComponentDrill\n" );
             break;
 
         case HOLE_ATTRIBUTE::HOLE_UNKNOWN:
-            fmt::print( m_file, "{}", "; #@! TD\n" );
+            print( "{}", "; #@! TD\n" );
             break;
         }
     }
@@ -236,6 +237,7 @@ int EXCELLON_WRITER::createDrillFile( FILE* aFile, const DRILL_SPAN& aSpan,
     m_mantissaLenght = m_unitsMetric ? 3 : 4;
 
     m_file = aFile;
+    m_outBuf.clear();
 
     int    diam, holes_count;
     int    x0, y0, xf, yf, xc, yc;
@@ -254,7 +256,7 @@ int EXCELLON_WRITER::createDrillFile( FILE* aFile, const DRILL_SPAN& aSpan,
 #if USE_ATTRIB_FOR_HOLES
         writeHoleAttribute( tool_descr.m_HoleAttribute );
 #endif
-        fmt::print( m_file, "T{}C{:.{}f}\n", ii + 1, tool_descr.m_Diameter * m_conversionUnits, m_mantissaLenght );
+        print( "T{}C{:.{}f}\n", ii + 1, tool_descr.m_Diameter * m_conversionUnits, m_mantissaLenght );
 
         if( !m_minimalHeader )
         {
@@ -287,18 +289,18 @@ int EXCELLON_WRITER::createDrillFile( FILE* aFile, const DRILL_SPAN& aSpan,
                     comment += wxT( ", post-machining" );
 
                 comment += wxT( "\n" );
-                fmt::print( m_file, "{}", TO_UTF8( comment ) );
+                print( "{}", TO_UTF8( comment ) );
             }
             else if( tool_descr.m_HasPostMachining )
             {
-                fmt::print( m_file, "{}", "; Post-machining\n" );
+                print( "{}", "; Post-machining\n" );
             }
         }
     }
 
-    fmt::print( m_file, "{}", "%\n" );              // End of header info
-    fmt::print( m_file, "{}", "G90\n" );            // Absolute mode
-    fmt::print( m_file, "{}", "G05\n" );            // Drill mode
+    print( "{}", "%\n" );              // End of header info
+    print( "{}", "G90\n" );            // Absolute mode
+    print( "{}", "G05\n" );            // Drill mode
 
     /* Read the hole list and generate data for normal holes (oblong
      * holes will be created later) */
@@ -314,7 +316,7 @@ int EXCELLON_WRITER::createDrillFile( FILE* aFile, const DRILL_SPAN& aSpan,
         if( tool_reference != hole_descr.m_Tool_Reference )
         {
             tool_reference = hole_descr.m_Tool_Reference;
-            fmt::print( m_file, "T{}\n", tool_reference );
+            print( "T{}\n", tool_reference );
         }
 
         x0 = hole_descr.m_Hole_Pos.x - m_offset.x;
@@ -328,7 +330,7 @@ int EXCELLON_WRITER::createDrillFile( FILE* aFile, const DRILL_SPAN& aSpan,
         writeHoleComments( hole_descr, aTagBackdrillHit );
         writeCoordinates( line, sizeof( line ), xt, yt );
 
-        fmt::print( m_file, "{}", line );
+        print( "{}", line );
         holes_count++;
     }
 
@@ -347,7 +349,7 @@ int EXCELLON_WRITER::createDrillFile( FILE* aFile, const DRILL_SPAN& aSpan,
         if( tool_reference != hole_descr.m_Tool_Reference )
         {
             tool_reference = hole_descr.m_Tool_Reference;
-            fmt::print( m_file, "T{}\n", tool_reference );
+            print( "T{}\n", tool_reference );
         }
 
         diam = std::min( hole_descr.m_Hole_Size.x, hole_descr.m_Hole_Size.y );
@@ -387,7 +389,7 @@ int EXCELLON_WRITER::createDrillFile( FILE* aFile, const DRILL_SPAN& aSpan,
         writeHoleComments( hole_descr, aTagBackdrillHit );
 
         if( m_useRouteModeForOval )
-            fmt::print( m_file, "{}", "G00" );    // Select the routing mode
+            print( "{}", "G00" );    // Select the routing mode
 
         writeCoordinates( line, sizeof( line ), xt, yt );
 
@@ -401,25 +403,25 @@ int EXCELLON_WRITER::createDrillFile( FILE* aFile, const DRILL_SPAN& aSpan,
                     line[kk] = 0;
             }
 
-            fmt::print( m_file, "{}", line );
-            fmt::print( m_file, "{}", "G85" );         // add the "G85" command
+            print( "{}", line );
+            print( "{}", "G85" );         // add the "G85" command
         }
         else
         {
-            fmt::print( m_file, "{}", line );
-            fmt::print( m_file, "{}", "M15\nG01" );    // tool down and linear routing from last coordinates
+            print( "{}", line );
+            print( "{}", "M15\nG01" );    // tool down and linear routing from last coordinates
         }
 
         xt = xf * m_conversionUnits;
         yt = yf * m_conversionUnits;
         writeCoordinates( line, sizeof( line ), xt, yt );
 
-        fmt::print( m_file, "{}",line );
+        print( "{}",line );
 
         if( m_useRouteModeForOval )
-            fmt::print( m_file, "{}", "M16\n" );       // Tool up (end routing)
+            print( "{}", "M16\n" );       // Tool up (end routing)
 
-        fmt::print( m_file, "{}", "G05\n" );           // Select drill mode
+        print( "{}", "G05\n" );           // Select drill mode
         holes_count++;
     }
 
@@ -557,7 +559,7 @@ void EXCELLON_WRITER::writeCoordinates( char* aLine, size_t aLineSize, double aC
 
 void EXCELLON_WRITER::writeEXCELLONHeader( const DRILL_SPAN& aSpan, TYPE_FILE aHolesType )
 {
-    fmt::print( m_file, "{}", "M48\n" );    // The beginning of a header
+    print( "{}", "M48\n" );    // The beginning of a header
 
     if( !m_minimalHeader )
     {
@@ -565,7 +567,7 @@ void EXCELLON_WRITER::writeEXCELLONHeader( const DRILL_SPAN& aSpan, TYPE_FILE aH
         wxString msg;
         msg << wxT( "KiCad " ) << GetBuildVersion();
 
-        fmt::print( m_file, "; DRILL file {} date {}\n",
+        print( "; DRILL file {} date {}\n",
                             TO_UTF8( msg ), TO_UTF8( GetISO8601CurrentDateTime() ) );
         msg = wxT( "; FORMAT={" );
 
@@ -598,45 +600,45 @@ void EXCELLON_WRITER::writeEXCELLONHeader( const DRILL_SPAN& aSpan, TYPE_FILE aH
         };
 
         msg << zero_fmt[m_zeroFormat] << wxT( "}\n" );
-        fmt::print( m_file, "{}", TO_UTF8( msg ) );
+        print( "{}", TO_UTF8( msg ) );
 
         // add the structured comment TF.CreationDate:
         // The attribute value must conform to the full version of the ISO 8601
         msg = GbrMakeCreationDateAttributeString( GBR_NC_STRING_FORMAT_NCDRILL ) + wxT( "\n" );
-        fmt::print( m_file, "{}", TO_UTF8( msg ) );
+        print( "{}", TO_UTF8( msg ) );
 
         // Add the application name that created the drill file
         msg = wxT( "; #@! TF.GenerationSoftware,Kicad,Pcbnew," );
         msg << GetBuildVersion() << wxT( "\n" );
-        fmt::print( m_file, "{}", TO_UTF8( msg ) );
+        print( "{}", TO_UTF8( msg ) );
 
         // Add the standard X2 FileFunction for drill files
         // TF.FileFunction,Plated[NonPlated],layer1num,layer2num,PTH[NPTH]
         msg = BuildFileFunctionAttributeString( aSpan, aHolesType , true ) + wxT( "\n" );
-        fmt::print( m_file, "{}", TO_UTF8( msg ) );
+        print( "{}", TO_UTF8( msg ) );
 
-        fmt::print( m_file, "{}",  "FMAT,2\n" );     // Use Format 2 commands (version used since 1979)
+        print( "{}",  "FMAT,2\n" );     // Use Format 2 commands (version used since 1979)
     }
 
-    fmt::print( m_file, "{}", m_unitsMetric ? "METRIC" : "INCH" );
+    print( "{}", m_unitsMetric ? "METRIC" : "INCH" );
 
     switch( m_zeroFormat )
     {
     case DECIMAL_FORMAT:
-        fmt::print( m_file, "{}", "\n" );
+        print( "{}", "\n" );
         break;
 
     case SUPPRESS_LEADING:
-        fmt::print( m_file, "{}", ",TZ\n" );
+        print( "{}", ",TZ\n" );
         break;
 
     case SUPPRESS_TRAILING:
-        fmt::print( m_file, "{}", ",LZ\n" );
+        print( "{}", ",LZ\n" );
         break;
 
     case KEEP_ZEROS:
         // write nothing, but TZ is acceptable when all zeros are kept
-        fmt::print( m_file, "{}", "\n" );
+        print( "{}", "\n" );
         break;
     }
 }
@@ -645,7 +647,18 @@ void EXCELLON_WRITER::writeEXCELLONHeader( const DRILL_SPAN& aSpan, TYPE_FILE aH
 void EXCELLON_WRITER::writeEXCELLONEndOfFile()
 {
     // add if minimal here
-    fmt::print( m_file, "{}", "M30\n" );
+    print( "{}", "M30\n" );
+
+    // Flush the whole formatted file in a single write; the buffer keeps its
+    // allocation for the next drill file of the job.
+    const size_t size = m_outBuf.size();
+    const bool   writeOk = fwrite( m_outBuf.data(), 1, size, m_file ) == size;
+
+    m_outBuf.clear();
+
+    if( !writeOk )
+        throw std::runtime_error( "Drill file write error" );
+
     fclose( m_file );
 }
 
@@ -718,7 +731,7 @@ bool EXCELLON_WRITER::writeBackdrillLayerPairFile( const wxString& aPlotDirector
 void EXCELLON_WRITER::writeHoleComments( const HOLE_INFO& aHole, bool aTagBackdrillHit )
 {
     if( aTagBackdrillHit && aHole.m_IsBackdrill )
-        fmt::print( m_file, "{}", "; backdrill\n" );
+        print( "{}", "; backdrill\n" );
 
     writePostMachiningComment( aHole.m_FrontPostMachining, aHole.m_FrontPostMachiningSize,
                                aHole.m_FrontPostMachiningDepth, aHole.m_FrontPostMachiningAngle,
@@ -769,7 +782,7 @@ void EXCELLON_WRITER::writePostMachiningComment( PAD_DRILL_POST_MACHINING_MODE a
     }
 
     comment << wxT( "\n" );
-    fmt::print( m_file, "{}", TO_UTF8( comment ) );
+    print( "{}", TO_UTF8( comment ) );
 }
 
 
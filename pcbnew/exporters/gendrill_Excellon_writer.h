@@ -33,6 +33,7 @@
 
 #include "gendrill_file_writer_base.h"
 
+#include <fmt/format.h>
 #include <wx/filename.h>
 
 class BOARD;
@@ -164,7 +165,22 @@ private:
                                           const wxString& aSideLabel );
     wxString   formatLinearValue( int aValueIU ) const;
 
+    /**
+     * Append formatted text to the in-memory output buffer.
+     *
+     * The whole drill file is formatted in memory and flushed to disk in a single
+     * write by writeEXCELLONEndOfFile().
+     */
+    template <typename... Args>
+    void print( fmt::format_string<Args...> aFormat, Args&&... aArgs )
+    {
+        fmt::format_to( std::back_inserter( m_outBuf ), aFormat,
+                        std::forward<Args>( aArgs )... );
+    }
+
     FILE*     m_file;                    // The output file
+    fmt::memory_buffer m_outBuf;         // Output buffer; the allocation is reused for
+                                         // each drill file of the job
     bool      m_minimalHeader;           // True to use minimal header
     bool      m_mirror;
     bool      m_useRouteModeForOval;     // True to use a route command for oval holes
@@ -51,6 +51,8 @@
 #include <pad.h>
 #include <pcb_track.h>
 #include <kiplatform/io.h>
+#include <mmh3_hash.h>
+#include <paths.h>
 #include <string_utils.h>
 #include <build_version.h>
 #include <geometry/shape_segment.h>
@@ -119,6 +121,9 @@
 #include <BRepAlgoAPI_Check.hxx>
 #include <BRepAlgoAPI_Cut.hxx>
 #include <BRepAlgoAPI_Fuse.hxx>
+#include <BinXCAFDrivers.hxx>
+#include <PCDM_ReaderStatus.hxx>
+#include <PCDM_StoreStatus.hxx>
 #include <ShapeUpgrade_UnifySameDomain.hxx>
 
 #include <BRepBndLib.hxx>
@@ -783,6 +788,11 @@ STEP_PCB_MODEL::STEP_PCB_MODEL( const wxString& aPcbName, REPORTER* aReporter )
         m_reporter( aReporter )
 {
     m_app = XCAFApp_Application::GetApplication();
+
+    // Register the binary XCAF persistence driver so translated models can be cached on
+    // disk and reloaded without re-parsing their STEP/IGES sources
+    BinXCAFDrivers::DefineFormat( m_app );
+
     m_app->NewDocument( "MDTV-XCAF", m_doc );
     m_assy = XCAFDoc_DocumentTool::ShapeTool( m_doc->Main() );
     m_assy_label = m_assy->NewShape();
@@ -3231,206 +3241,255 @@ bool STEP_PCB_MODEL::getModelLabel( const std::string& aFileNameUTF8, const VECT
     std::string                pname( modelFile.GetName().ToUTF8() );
     TCollection_ExtendedString partname( pname.c_str() );
 
-    switch( modelFmt )
-    {
-    case FMT_IGES:
-        if( !readIGES( doc, aFileNameUTF8.c_str() ) )
-        {
-            m_reporter->Report( wxString::Format( wxT( "readIGES() failed on filename '%s'." ),
-                                                  fileName ),
-                                RPT_SEVERITY_ERROR );
-            return false;
-        }
-        break;
-
-    case FMT_STEP:
-        if( !readSTEP( doc, aFileNameUTF8.c_str() ) )
-        {
-            m_reporter->Report( wxString::Format( wxT( "readSTEP() failed on filename '%s'." ),
-                                                  fileName ),
-                                RPT_SEVERITY_ERROR );
-            return false;
-        }
-        break;
+    // Try the on-disk translation cache first: parsing large STEP/IGES sources dominates the
+    // export time, while reloading the translated document in binary form is nearly free.
+    // The cache name is keyed by the source file contents, so an edited model never reuses a
+    // stale translation.
+    wxString cacheFile;
+    bool     fromCache = false;
 
-    case FMT_STEPZ:
+    if( modelFmt == FMT_STEP || modelFmt == FMT_IGES )
     {
-        // To export a compressed step file (.stpz or .stp.gz file), the best way is to
-        // decaompress it in a temporaty file and load this temporary file
-        wxFFileInputStream ifile( fileName );
-        wxFileName         outFile( fileName );
+        cacheFile = getCacheFileName( aFileNameUTF8 );
 
-        outFile.SetPath( wxStandardPaths::Get().GetTempDir() );
-        outFile.SetExt( wxT( "step" ) );
-        wxFileOffset size = ifile.GetLength();
-
-        if( size == wxInvalidOffset )
+        if( !cacheFile.IsEmpty() && wxFileName::FileExists( cacheFile ) )
         {
-            m_reporter->Report( wxString::Format( wxT( "getModelLabel() failed on filename '%s'." ),
-                                                  fileName ),
-                                RPT_SEVERITY_ERROR );
-            return false;
+            try
+            {
+                TCollection_ExtendedString cachePath( cacheFile.ToUTF8().data(), true );
+                fromCache = m_app->Open( cachePath, doc ) == PCDM_RS_OK;
+            }
+            catch( const Standard_Failure& )
+            {
+                fromCache = false;
+            }
+
+            // A stale or corrupted entry; retranslate from the source file
+            if( !fromCache )
+                m_app->NewDocument( "MDTV-XCAF", doc );
         }
+    }
 
+    if( !fromCache )
+    {
+        switch( modelFmt )
         {
-            bool                success = false;
-            wxFFileOutputStream ofile( outFile.GetFullPath() );
+        case FMT_IGES:
+            if( !readIGES( doc, aFileNameUTF8.c_str() ) )
+            {
+                m_reporter->Report( wxString::Format( wxT( "readIGES() failed on filename '%s'." ),
+                                                      fileName ),
+                                    RPT_SEVERITY_ERROR );
+                return false;
+            }
+            break;
 
-            if( !ofile.IsOk() )
+        case FMT_STEP:
+            if( !readSTEP( doc, aFileNameUTF8.c_str() ) )
+            {
+                m_reporter->Report( wxString::Format( wxT( "readSTEP() failed on filename '%s'." ),
+                                                      fileName ),
+                                    RPT_SEVERITY_ERROR );
                 return false;
+            }
+            break;
 
-            char* buffer = new char[size];
+        case FMT_STEPZ:
+        {
+            // To export a compressed step file (.stpz or .stp.gz file), the best way is to
+            // decaompress it in a temporaty file and load this temporary file
+            wxFFileInputStream ifile( fileName );
+            wxFileName         outFile( fileName );
 
-            ifile.Read( buffer, size );
-            std::string expanded;
+            outFile.SetPath( wxStandardPaths::Get().GetTempDir() );
+            outFile.SetExt( wxT( "step" ) );
+            wxFileOffset size = ifile.GetLength();
 
-            try
+            if( size == wxInvalidOffset )
             {
-                expanded = gzip::decompress( buffer, size );
-                success = true;
-            }
-            catch( ... )
-            {
-                m_reporter->Report( wxString::Format( wxT( "failed to decompress '%s'." ),
+                m_reporter->Report( wxString::Format( wxT( "getModelLabel() failed on filename '%s'." ),
                                                       fileName ),
                                     RPT_SEVERITY_ERROR );
+                return false;
             }
 
-            if( expanded.empty() )
             {
-                ifile.Reset();
-                ifile.SeekI( 0 );
-                wxZipInputStream            izipfile( ifile );
-                std::unique_ptr<wxZipEntry> zip_file( izipfile.GetNextEntry() );
+                bool                success = false;
+                wxFFileOutputStream ofile( outFile.GetFullPath() );
 
-                if( zip_file && !zip_file->IsDir() && izipfile.CanRead() )
-                {
-                    izipfile.Read( ofile );
-                    success = true;
-                }
-            }
-            else
-            {
-                ofile.Write( expanded.data(), expanded.size() );
-            }
-
-            delete[] buffer;
-            ofile.Close();
+                if( !ofile.IsOk() )
+                    return false;
 
-            if( success )
-            {
-                std::string altFileNameUTF8 = TO_UTF8( outFile.GetFullPath() );
-                success = getModelLabel( altFileNameUTF8, VECTOR3D( 1.0, 1.0, 1.0 ), aLabel, false );
-            }
+                char* buffer = new char[size];
 
-            return success;
-        }
+                ifile.Read( buffer, size );
+                std::string expanded;
 
-        break;
-    }
+                try
+                {
+                    expanded = gzip::decompress( buffer, size );
+                    success = true;
+                }
+                catch( ... )
+                {
+                    m_reporter->Report( wxString::Format( wxT( "failed to decompress '%s'." ),
+                                                          fileName ),
+                                        RPT_SEVERITY_ERROR );
+                }
 
-    case FMT_WRL:
-    case FMT_WRZ:
-        /* WRL files are preferred for internal rendering, due to superior material properties, etc.
-         * However they are not suitable for MCAD export.
-         *
-         * If a .wrl file is specified, attempt to locate a replacement file for it.
-         *
-         * If a valid replacement file is found, the label for THAT file will be associated with
-         * the .wrl file
-         */
-        if( aSubstituteModels )
-        {
-            wxFileName wrlName( fileName );
+                if( expanded.empty() )
+                {
+                    ifile.Reset();
+                    ifile.SeekI( 0 );
+                    wxZipInputStream            izipfile( ifile );
+                    std::unique_ptr<wxZipEntry> zip_file( izipfile.GetNextEntry() );
 
-            wxString basePath = wrlName.GetPath();
-            wxString baseName = wrlName.GetName();
+                    if( zip_file && !zip_file->IsDir() && izipfile.CanRead() )
+                    {
+                        izipfile.Read( ofile );
+                        success = true;
+                    }
+                }
+                else
+                {
+                    ofile.Write( expanded.data(), expanded.size() );
+                }
 
-            // List of alternate files to look for
-            // Given in order of preference
-            // (Break if match is found)
-            wxArrayString alts;
+                delete[] buffer;
+                ofile.Close();
 
-            // Step files
-            alts.Add( wxT( "stp" ) );
-            alts.Add( wxT( "step" ) );
-            alts.Add( wxT( "STP" ) );
-            alts.Add( wxT( "STEP" ) );
-            alts.Add( wxT( "Stp" ) );
-            alts.Add( wxT( "Step" ) );
-            alts.Add( wxT( "stpz" ) );
-            alts.Add( wxT( "stpZ" ) );
-            alts.Add( wxT( "STPZ" ) );
-            alts.Add( wxT( "step.gz" ) );
-            alts.Add( wxT( "stp.gz" ) );
+                if( success )
+                {
+                    std::string altFileNameUTF8 = TO_UTF8( outFile.GetFullPath() );
+                    success = getModelLabel( altFileNameUTF8, VECTOR3D( 1.0, 1.0, 1.0 ), aLabel, false );
+                }
 
-            // IGES files
-            alts.Add( wxT( "iges" ) );
-            alts.Add( wxT( "IGES" ) );
-            alts.Add( wxT( "igs" ) );
-            alts.Add( wxT( "IGS" ) );
+                return success;
+            }
 
-            //TODO - Other alternative formats?
+            break;
+        }
 
-            for( const auto& alt : alts )
+        case FMT_WRL:
+        case FMT_WRZ:
+            /* WRL files are preferred for internal rendering, due to superior material properties, etc.
+             * However they are not suitable for MCAD export.
+             *
+             * If a .wrl file is specified, attempt to locate a replacement file for it.
+             *
+             * If a valid replacement file is found, the label for THAT file will be associated with
+             * the .wrl file
+             */
+            if( aSubstituteModels )
             {
-                wxFileName altFile( basePath, baseName + wxT( "." ) + alt );
-
-                if( altFile.IsOk() && altFile.FileExists() )
+                wxFileName wrlName( fileName );
+
+                wxString basePath = wrlName.GetPath();
+                wxString baseName = wrlName.GetName();
+
+                // List of alternate files to look for
+                // Given in order of preference
+                // (Break if match is found)
+                wxArrayString alts;
+
+                // Step files
+                alts.Add( wxT( "stp" ) );
+                alts.Add( wxT( "step" ) );
+                alts.Add( wxT( "STP" ) );
+                alts.Add( wxT( "STEP" ) );
+                alts.Add( wxT( "Stp" ) );
+                alts.Add( wxT( "Step" ) );
+                alts.Add( wxT( "stpz" ) );
+                alts.Add( wxT( "stpZ" ) );
+                alts.Add( wxT( "STPZ" ) );
+                alts.Add( wxT( "step.gz" ) );
+                alts.Add( wxT( "stp.gz" ) );
+
+                // IGES files
+                alts.Add( wxT( "iges" ) );
+                alts.Add( wxT( "IGES" ) );
+                alts.Add( wxT( "igs" ) );
+                alts.Add( wxT( "IGS" ) );
+
+                //TODO - Other alternative formats?
+
+                for( const auto& alt : alts )
                 {
-                    std::string altFileNameUTF8 = TO_UTF8( altFile.GetFullPath() );
-
-                    // When substituting a STEP/IGS file for VRML, do not apply the VRML scaling
-                    // to the new STEP model.  This process of auto-substitution is janky as all
-                    // heck so let's not mix up un-displayed scale factors with potentially
-                    // mis-matched files.  And hope that the user doesn't have multiples files
-                    // named "model.wrl" and "model.stp" referring to different parts.
-                    // TODO: Fix model handling in v7.  Default models should only be STP.
-                    //       Have option to override this in DISPLAY.
-                    if( getModelLabel( altFileNameUTF8, VECTOR3D( 1.0, 1.0, 1.0 ), aLabel, false ) )
+                    wxFileName altFile( basePath, baseName + wxT( "." ) + alt );
+
+                    if( altFile.IsOk() && altFile.FileExists() )
                     {
-                        return true;
+                        std::string altFileNameUTF8 = TO_UTF8( altFile.GetFullPath() );
+
+                        // When substituting a STEP/IGS file for VRML, do not apply the VRML scaling
+                        // to the new STEP model.  This process of auto-substitution is janky as all
+                        // heck so let's not mix up un-displayed scale factors with potentially
+                        // mis-matched files.  And hope that the user doesn't have multiples files
+                        // named "model.wrl" and "model.stp" referring to different parts.
+                        // TODO: Fix model handling in v7.  Default models should only be STP.
+                        //       Have option to override this in DISPLAY.
+                        if( getModelLabel( altFileNameUTF8, VECTOR3D( 1.0, 1.0, 1.0 ), aLabel, false ) )
+                        {
+                            return true;
+                        }
                     }
                 }
             }
-        }
 
-        // VRML models only work when exporting to mesh formats
-        // Also OCCT < 7.9.0 fails to load most VRML 2.0 models because of Switch nodes
-        if( m_outFmt == OUTPUT_FORMAT::FMT_OUT_GLTF || m_outFmt == OUTPUT_FORMAT::FMT_OUT_STL
-            || m_outFmt == OUTPUT_FORMAT::FMT_OUT_PLY || m_outFmt == OUTPUT_FORMAT::FMT_OUT_U3D
-            || m_outFmt == OUTPUT_FORMAT::FMT_OUT_PDF )
-        {
-            if( readVRML( doc, aFileNameUTF8.c_str() ) )
+            // VRML models only work when exporting to mesh formats
+            // Also OCCT < 7.9.0 fails to load most VRML 2.0 models because of Switch nodes
+            if( m_outFmt == OUTPUT_FORMAT::FMT_OUT_GLTF || m_outFmt == OUTPUT_FORMAT::FMT_OUT_STL
+                || m_outFmt == OUTPUT_FORMAT::FMT_OUT_PLY || m_outFmt == OUTPUT_FORMAT::FMT_OUT_U3D
+                || m_outFmt == OUTPUT_FORMAT::FMT_OUT_PDF )
             {
-                Handle( XCAFDoc_ShapeTool ) shapeTool = XCAFDoc_DocumentTool::ShapeTool( doc->Main() );
+                if( readVRML( doc, aFileNameUTF8.c_str() ) )
+                {
+                    Handle( XCAFDoc_ShapeTool ) shapeTool = XCAFDoc_DocumentTool::ShapeTool( doc->Main() );
 
-                prefixNames( shapeTool->Label(), partname );
+                    prefixNames( shapeTool->Label(), partname );
+                }
+                else
+                {
+                    m_reporter->Report( wxString::Format( wxT( "readVRML() failed on filename '%s'." ), fileName ),
+                                        RPT_SEVERITY_ERROR );
+                    return false;
+                }
             }
             else
             {
-                m_reporter->Report( wxString::Format( wxT( "readVRML() failed on filename '%s'." ), fileName ),
-                                    RPT_SEVERITY_ERROR );
+                if( aErrorMessage )
+                    aErrorMessage->Printf( _( "Cannot use VRML models when exporting to non-mesh formats." ) );
+
                 return false;
             }
-        }
-        else
-        {
-            if( aErrorMessage )
-                aErrorMessage->Printf( _( "Cannot use VRML models when exporting to non-mesh formats." ) );
 
+            break;
+
+            // TODO: implement IDF and EMN converters
+
+        default:
+            m_reporter->Report( wxString::Format( _( "Cannot identify actual file type for '%s'." ),
+                                                  fileName ),
+                                RPT_SEVERITY_ERROR );
             return false;
         }
 
-        break;
-
-        // TODO: implement IDF and EMN converters
+        // Keep the translated document for later runs; a failed save must not leave a
+        // truncated file behind to poison the next export
+        if( !cacheFile.IsEmpty() )
+        {
+            try
+            {
+                TCollection_ExtendedString cachePath( cacheFile.ToUTF8().data(), true );
 
-    default:
-        m_reporter->Report( wxString::Format( _( "Cannot identify actual file type for '%s'." ),
-                                              fileName ),
-                            RPT_SEVERITY_ERROR );
-        return false;
+                if( m_app->SaveAs( doc, cachePath ) != PCDM_SS_OK )
+                    wxRemoveFile( cacheFile );
+            }
+            catch( const Standard_Failure& )
+            {
+                wxRemoveFile( cacheFile );
+            }
+        }
     }
 
     aLabel = transferModel( doc, m_doc, aScale );
@@ -3453,6 +3512,47 @@ bool STEP_PCB_MODEL::getModelLabel( const std::string& aFileNameUTF8, const VECT
 }
 
 
+wxString STEP_PCB_MODEL::getCacheFileName( const std::string& aFileNameUTF8 )
+{
+    wxString cacheDir = PATHS::GetUserCachePath();
+
+    if( cacheDir.IsEmpty() )
+        return wxString();
+
+    wxFileName cacheFile;
+    cacheFile.AssignDir( cacheDir );
+    cacheFile.AppendDir( wxT( "step_models" ) );
+
+    if( !PATHS::EnsurePathExists( cacheFile.GetPath() ) )
+        return wxString();
+
+#ifdef _WIN32
+    FILE* fp = _wfopen( wxString::FromUTF8( aFileNameUTF8.c_str() ).wc_str(), L"rb" );
+#else
+    FILE* fp = fopen( aFileNameUTF8.c_str(), "rb" );
+#endif
+
+    if( nullptr == fp )
+        return wxString();
+
+    MMH3_HASH dblock( 0xA1B2C3D4 );
+    std::vector<char> block( 4096 );
+    size_t bsize = 0;
+
+    while( ( bsize = fread( block.data(), 1, 4096, fp ) ) > 0 )
+        dblock.addData( reinterpret_cast<const uint8_t*>( block.data() ), bsize );
+
+    fclose( fp );
+
+    HASH_128 hash = dblock.digest();
+
+    cacheFile.SetName( wxString::FromUTF8( hash.ToString() ) );
+    cacheFile.SetExt( wxT( "xbf" ) );
+
+    return cacheFile.GetFullPath();
+}
+
+
 bool STEP_PCB_MODEL::getModelLocation( bool aBottom, const VECTOR2D& aPosition, double aRotation,
                                        const VECTOR3D& aOffset, const VECTOR3D& aOrientation,
                                        TopLoc_Location& aLocation )
@@ -312,6 +312,18 @@ private:
     bool getModelLabel( const std::string& aFileNameUTF8, const VECTOR3D& aScale, TDF_Label& aLabel,
                         bool aSubstituteModels, wxString* aErrorMessage = nullptr );
 
+    /**
+     * Return the path of the on-disk translated-model cache entry for a source model.
+     *
+     * The name is keyed by a hash of the file contents, so an edited model never matches
+     * a stale translation.
+     *
+     * @param aFileNameUTF8 is the source model filename encoded UTF8.
+     * @return the full path of the cache entry, or an empty string if the source file
+     *         cannot be hashed or the cache directory is unavailable.
+     */
+    wxString getCacheFileName( const std::string& aFileNameUTF8 );
+
     bool getModelLocation( bool aBottom, const VECTOR2D& aPosition, double aRotation, const VECTOR3D& aOffset,
                            const VECTOR3D& aOrientation, TopLoc_Location& aLocation );
 
@@ -40,6 +40,7 @@
 #include <footprint_library_adapter.h>
 #include <kiface_base.h>
 #include <macros.h>
+#include <perf_counters.h>
 #include <trace_helpers.h>
 #include <length_delay_calculation/length_delay_calculation.h>
 #include <lockfile.h>
@@ -961,6 +962,9 @@ bool PCB_EDIT_FRAME::OpenProjectFiles( const std::vector<wxString>& aFileSet, in
         GetCanvas()->SetFocus();
     }
 
+    // Opportunistically prewarm the run-time caches while the app sits idle post-load
+    scheduleCacheWarming();
+
     return true;
 }
 
@@ -986,6 +990,8 @@ bool PCB_EDIT_FRAME::SavePcbFile( const wxString& aFileName, bool addToHistory,
         return false;
     }
 
+    PERF_SCOPED_SAMPLE perfSample( "board_save" );
+
     // TODO: these will break if we ever go multi-board
     wxFileName projectFile( pcbFileName );
     wxFileName rulesFile( pcbFileName );
@@ -2747,12 +2747,29 @@ void FOOTPRINT::SetOrientation( const EDA_ANGLE& aNewAngle )
     for( PCB_POINT* point : m_points )
         point->Rotate( GetPosition(), angleChange );
 
+    // The axis-aligned bounding boxes cannot survive a rotation, but the hull and
+    // courtyard polygons can: rotation is a rigid transform, so rotate the cached
+    // polygons the same way SetPosition() translates them instead of rebuilding them
+    // from the footprint's items on the next query.  This keeps rotate-while-dragging
+    // from re-polygonizing the whole footprint every step.
     m_boundingBoxCacheTimeStamp = 0;
     m_textExcludedBBoxCacheTimeStamp = 0;
-    m_hullCacheTimeStamp = 0;
 
-    // The courtyard caches need to be rebuilt, as the geometry has changed
-    BuildCourtyardCaches();
+    m_cachedHull.Rotate( angleChange, GetPosition() );
+
+    if( m_courtyard_cache_front_hash == m_courtyard_cache_front.GetHash()
+            && m_courtyard_cache_back_hash == m_courtyard_cache_back.GetHash() )
+    {
+        m_courtyard_cache_front.Rotate( angleChange, GetPosition() );
+        m_courtyard_cache_front_hash = m_courtyard_cache_front.GetHash();
+        m_courtyard_cache_back.Rotate( angleChange, GetPosition() );
+        m_courtyard_cache_back_hash = m_courtyard_cache_back.GetHash();
+    }
+    else
+    {
+        // The courtyard caches were already stale; rebuild them outright.
+        BuildCourtyardCaches();
+    }
 }
 
 
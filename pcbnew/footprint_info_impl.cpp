@@ -22,6 +22,9 @@
 
 #include <footprint_info_impl.h>
 
+#include <algorithm>
+#include <unordered_set>
+
 #include <dialogs/html_message_box.h>
 #include <footprint.h>
 #include <footprint_info.h>
@@ -67,6 +70,7 @@ void FOOTPRINT_INFO_IMPL::load()
 void FOOTPRINT_LIST_IMPL::Clear()
 {
     m_list.clear();
+    m_libTimestamps.clear();
     m_list_timestamp = 0;
 }
 
@@ -128,19 +132,51 @@ bool FOOTPRINT_LIST_IMPL::ReadFootprintFiles( FOOTPRINT_LIBRARY_ADAPTER* aAdapte
     m_cancelled = false;
     m_adapter = aAdapter;
 
-    // Clear data before reading files
     m_errors.clear();
-    m_list.clear();
     m_queue.clear();
 
     if( aNickname )
     {
+        m_list.clear();
+        m_libTimestamps.clear();
         m_queue.push( *aNickname );
     }
     else
     {
+        // Check staleness per library so a single changed library doesn't force
+        // re-parsing all of them; unchanged libraries keep their cached entries.
+        std::map<wxString, long long>              stamps;
+        std::unordered_set<wxString>               keep;
+
         for( const wxString& nickname : aAdapter->GetLibraryNames() )
-            m_queue.push( nickname );
+        {
+            long long stamp = 0;
+
+            CatchErrors( [&]()
+                         {
+                             stamp = aAdapter->GenerateTimestamp( &nickname );
+                         } );
+
+            stamps[nickname] = stamp;
+
+            auto it = m_libTimestamps.find( nickname );
+
+            if( it != m_libTimestamps.end() && it->second == stamp )
+                keep.insert( nickname );
+            else
+                m_queue.push( nickname );
+        }
+
+        // Drop entries from stale or removed libraries; loadFootprints() re-adds the
+        // stale ones and re-sorts the whole list.
+        m_list.erase( std::remove_if( m_list.begin(), m_list.end(),
+                                      [&]( const std::unique_ptr<FOOTPRINT_INFO>& aInfo )
+                                      {
+                                          return !aInfo || !keep.count( aInfo->GetLibNickname() );
+                                      } ),
+                      m_list.end() );
+
+        m_libTimestamps = std::move( stamps );
     }
 
     if( m_progress_reporter )
@@ -259,7 +295,12 @@ void FOOTPRINT_LIST_IMPL::WriteCacheToFile( const wxString& aFilePath )
         return;
     }
 
+    txtStream << wxT( "fp-info-cache-v2" ) << endl;
     txtStream << wxString::Format( wxT( "%lld" ), m_list_timestamp ) << endl;
+    txtStream << wxString::Format( wxT( "%zu" ), m_libTimestamps.size() ) << endl;
+
+    for( const auto& [nickname, stamp] : m_libTimestamps )
+        txtStream << nickname << wxT( "\t" ) << wxString::Format( wxT( "%lld" ), stamp ) << endl;
 
     for( std::unique_ptr<FOOTPRINT_INFO>& fpinfo : m_list )
     {
@@ -293,12 +334,39 @@ void FOOTPRINT_LIST_IMPL::ReadCacheFromFile( const wxString& aFilePath )
 
     m_list_timestamp = 0;
     m_list.clear();
+    m_libTimestamps.clear();
 
     try
     {
         if( cacheFile.Exists() && cacheFile.Open() )
         {
-            cacheFile.GetFirstLine().ToLongLong( &m_list_timestamp );
+            wxString firstLine = cacheFile.GetFirstLine();
+
+            if( firstLine == wxT( "fp-info-cache-v2" ) )
+            {
+                cacheFile.GetNextLine().ToLongLong( &m_list_timestamp );
+
+                long libCount = 0;
+                cacheFile.GetNextLine().ToLong( &libCount );
+
+                for( long ii = 0; ii < libCount && !cacheFile.Eof(); ++ii )
+                {
+                    wxString  line = cacheFile.GetNextLine();
+                    wxString  nickname = line.BeforeLast( '\t' );
+                    long long stamp = 0;
+
+                    line.AfterLast( '\t' ).ToLongLong( &stamp );
+
+                    if( !nickname.IsEmpty() )
+                        m_libTimestamps[nickname] = stamp;
+                }
+            }
+            else
+            {
+                // Legacy cache: a bare timestamp with no per-library stamps; any change
+                // anywhere will trigger a full rescan.
+                firstLine.ToLongLong( &m_list_timestamp );
+            }
 
             while( cacheFile.GetCurrentLine() + 6 < cacheFile.GetLineCount() )
             {
@@ -322,11 +390,15 @@ void FOOTPRINT_LIST_IMPL::ReadCacheFromFile( const wxString& aFilePath )
     {
         // whatever went wrong, invalidate the cache
         m_list_timestamp = 0;
+        m_libTimestamps.clear();
     }
 
     // Sanity check: an empty list is very unlikely to be correct.
     if( m_list.size() == 0 )
+    {
         m_list_timestamp = 0;
+        m_libTimestamps.clear();
+    }
 
     if( cacheFile.IsOpened() )
         cacheFile.Close();
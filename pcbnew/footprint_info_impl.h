@@ -22,6 +22,7 @@
 
 #include <atomic>
 #include <functional>
+#include <map>
 #include <memory>
 #include <thread>
 #include <vector>
@@ -107,6 +108,10 @@ private:
 
     SYNC_QUEUE<wxString>     m_queue;
     long long                m_list_timestamp;
+
+    /// Per-library timestamps (mtime+size hashes) from the last scan, so only libraries
+    /// that actually changed are re-parsed; persisted in the fp-info-cache file.
+    std::map<wxString, long long> m_libTimestamps;
     PROGRESS_REPORTER*       m_progress_reporter;
     std::atomic_bool         m_cancelled;
     std::mutex               m_join;
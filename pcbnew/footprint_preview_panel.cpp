@@ -41,12 +41,17 @@
 #include <pcb_edit_frame.h>
 #include <pgm_base.h>
 #include <settings/settings_manager.h>
+#include <thread_pool.h>
 #include <view/view.h>
 #include <wx/stattext.h>
 #include <dialog_shim.h>
 #include <project_pcb.h>
 
 
+///< Number of loaded footprints kept for instant re-display while browsing.
+static constexpr size_t CACHED_FOOTPRINT_LIMIT = 64;
+
+
 FOOTPRINT_PREVIEW_PANEL::FOOTPRINT_PREVIEW_PANEL( KIWAY* aKiway, wxWindow* aParent,
                                                   UNITS_PROVIDER* aUnitsProvider,
                                                   std::unique_ptr<KIGFX::GAL_DISPLAY_OPTIONS> aOpts,
@@ -64,6 +69,9 @@ FOOTPRINT_PREVIEW_PANEL::FOOTPRINT_PREVIEW_PANEL( KIWAY* aKiway, wxWindow* aPare
     m_dummyBoard = std::make_unique<BOARD>();
     m_dummyBoard->SetUserUnits( m_userUnits );
     m_dummyBoard->SetBoardUse( BOARD_USE::FPHOLDER );
+
+    m_loadState = std::make_shared<ASYNC_LOAD_STATE>();
+    m_loadState->Panel = this;
     UpdateColors();
     SyncLayersVisibility( m_dummyBoard.get() );
 
@@ -75,6 +83,12 @@ FOOTPRINT_PREVIEW_PANEL::FOOTPRINT_PREVIEW_PANEL( KIWAY* aKiway, wxWindow* aPare
 
 FOOTPRINT_PREVIEW_PANEL::~FOOTPRINT_PREVIEW_PANEL( )
 {
+    // Orphan any in-flight loader tasks; they check this pointer before delivering results.
+    {
+        std::lock_guard<std::mutex> lock( m_loadState->Mutex );
+        m_loadState->Panel = nullptr;
+    }
+
     ClearViewAndData();
 }
 
@@ -93,6 +107,9 @@ void FOOTPRINT_PREVIEW_PANEL::ClearViewAndData()
 
     m_currentFootprint = nullptr;
     m_otherFootprint = nullptr;
+
+    m_cacheIndex.clear();
+    m_cacheLru.clear();
 }
 
 
@@ -163,40 +180,145 @@ void FOOTPRINT_PREVIEW_PANEL::fitToCurrentFootprint()
 }
 
 
-bool FOOTPRINT_PREVIEW_PANEL::DisplayFootprint( const LIB_ID& aFPID )
+std::shared_ptr<FOOTPRINT> FOOTPRINT_PREVIEW_PANEL::cachedFootprint( const wxString& aFPKey )
 {
-    m_dummyBoard->DetachAllFootprints();
+    auto it = m_cacheIndex.find( aFPKey );
 
-    if( m_currentFootprint )
-        GetView()->Remove( m_currentFootprint.get() );
+    if( it == m_cacheIndex.end() )
+        return nullptr;
 
-    GetView()->Clear();
+    m_cacheLru.splice( m_cacheLru.begin(), m_cacheLru, it->second );
+    return it->second->second;
+}
 
-    FOOTPRINT_LIBRARY_ADAPTER* adapter = PROJECT_PCB::FootprintLibAdapter( &Prj() );
 
-    try
+void FOOTPRINT_PREVIEW_PANEL::cacheFootprint( const wxString& aFPKey,
+                                              std::shared_ptr<FOOTPRINT> aFootprint )
+{
+    auto it = m_cacheIndex.find( aFPKey );
+
+    if( it != m_cacheIndex.end() )
     {
-        const FOOTPRINT* fp = adapter->LoadFootprint( aFPID.GetLibNickname(), aFPID.GetLibItemName(), false );
+        it->second->second = std::move( aFootprint );
+        m_cacheLru.splice( m_cacheLru.begin(), m_cacheLru, it->second );
+        return;
+    }
 
-        if( fp )
-            m_currentFootprint.reset( static_cast<FOOTPRINT*>( fp->Duplicate( IGNORE_PARENT_GROUP ) ) );
-        else
-            m_currentFootprint.reset();
+    m_cacheLru.emplace_front( aFPKey, std::move( aFootprint ) );
+    m_cacheIndex[ aFPKey ] = m_cacheLru.begin();
+
+    // Evicting the displayed footprint is safe; m_currentFootprint keeps it alive.
+    while( m_cacheLru.size() > CACHED_FOOTPRINT_LIMIT )
+    {
+        m_cacheIndex.erase( m_cacheLru.back().first );
+        m_cacheLru.pop_back();
     }
-    catch( ... )
+}
+
+
+void FOOTPRINT_PREVIEW_PANEL::onFootprintLoaded( long aSequence, const wxString& aFPKey,
+                                                 std::shared_ptr<FOOTPRINT> aFootprint )
+{
+    if( aFootprint )
+        cacheFootprint( aFPKey, aFootprint );
+
+    bool isLatest;
+
     {
-        m_currentFootprint.reset();
+        std::lock_guard<std::mutex> lock( m_loadState->Mutex );
+        isLatest = ( aSequence == m_loadState->Sequence );
     }
 
+    // A newer selection is pending or displayed; keep the result cached but let the latest win.
+    if( !isLatest )
+        return;
+
+    if( aFootprint )
+    {
+        m_currentFootprint = aFootprint;
+        renderFootprint( m_currentFootprint );
+        fitToCurrentFootprint();
+        ForceRefresh();
+    }
+
+    if( m_loadHandler )
+        m_loadHandler( aFootprint != nullptr );
+}
+
+
+bool FOOTPRINT_PREVIEW_PANEL::DisplayFootprint( const LIB_ID& aFPID )
+{
+    m_dummyBoard->DetachAllFootprints();
+
     if( m_currentFootprint )
+        GetView()->Remove( m_currentFootprint.get() );
+
+    GetView()->Clear();
+    m_currentFootprint = nullptr;
+
+    const wxString fpKey = aFPID.Format();
+
+    if( std::shared_ptr<FOOTPRINT> cached = cachedFootprint( fpKey ) )
     {
+        m_currentFootprint = cached;
         renderFootprint( m_currentFootprint );
         fitToCurrentFootprint();
+        ForceRefresh();
+        return true;
     }
 
     ForceRefresh();
 
-    return m_currentFootprint != nullptr;
+    long seq;
+
+    {
+        std::lock_guard<std::mutex> lock( m_loadState->Mutex );
+        seq = ++m_loadState->Sequence;
+    }
+
+    FOOTPRINT_LIBRARY_ADAPTER*        adapter = PROJECT_PCB::FootprintLibAdapter( &Prj() );
+    std::shared_ptr<ASYNC_LOAD_STATE> state = m_loadState;
+
+    GetKiCadThreadPool().detach_task(
+            [state, adapter, aFPID, fpKey, seq]()
+            {
+                {
+                    // Coalesce: if browsing has already moved on, skip this load entirely.
+                    std::lock_guard<std::mutex> lock( state->Mutex );
+
+                    if( seq != state->Sequence || !state->Panel )
+                        return;
+                }
+
+                std::shared_ptr<FOOTPRINT> fp;
+
+                try
+                {
+                    const FOOTPRINT* libFp = adapter->LoadFootprint( aFPID.GetLibNickname(),
+                                                                     aFPID.GetLibItemName(), false );
+
+                    if( libFp )
+                        fp.reset( static_cast<FOOTPRINT*>( libFp->Duplicate( IGNORE_PARENT_GROUP ) ) );
+                }
+                catch( ... )
+                {
+                }
+
+                // The mutex guarantees the panel is alive while the result is queued; wx drops
+                // the queued call if the panel is destroyed before it runs.
+                std::lock_guard<std::mutex> lock( state->Mutex );
+
+                if( FOOTPRINT_PREVIEW_PANEL* panel = state->Panel )
+                {
+                    panel->CallAfter(
+                            [panel, seq, fpKey, fp]()
+                            {
+                                panel->onFootprintLoaded( seq, fpKey, fp );
+                            } );
+                }
+            } );
+
+    return false;
 }
 
 
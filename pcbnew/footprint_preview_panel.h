@@ -22,9 +22,12 @@
 #ifndef __FOOTPRINT_PREVIEW_PANEL_H
 #define __FOOTPRINT_PREVIEW_PANEL_H
 
+#include <list>
 #include <map>
 #include <deque>
 #include <functional>
+#include <mutex>
+#include <utility>
 
 #include <pcb_draw_panel_gal.h>
 #include <gal/color4d.h>
@@ -64,6 +67,11 @@ public:
     void DisplayFootprints( std::shared_ptr<FOOTPRINT> aFootprintA,
                             std::shared_ptr<FOOTPRINT> aFootprintB ) override;
 
+    void SetLoadHandler( std::function<void( bool aFootprintFound )> aHandler ) override
+    {
+        m_loadHandler = std::move( aHandler );
+    }
+
     const KIGFX::COLOR4D& GetBackgroundColor() const override;
     const KIGFX::COLOR4D& GetForegroundColor() const override;
 
@@ -97,13 +105,42 @@ private:
 
     void fitToCurrentFootprint();
 
+    /**
+     * State shared with the background loader tasks.  The panel pointer is cleared in the dtor
+     * so a late-finishing task has nowhere to deliver its result, and the sequence number lets
+     * superseded loads be dropped (only the latest selection wins).
+     */
+    struct ASYNC_LOAD_STATE
+    {
+        std::mutex               Mutex;
+        FOOTPRINT_PREVIEW_PANEL* Panel = nullptr;
+        long                     Sequence = 0;
+    };
+
+    ///< Look up a footprint in the LRU cache, refreshing its recency on a hit.
+    std::shared_ptr<FOOTPRINT> cachedFootprint( const wxString& aFPKey );
+
+    ///< Insert a loaded footprint into the LRU cache, evicting the oldest entries.
+    void cacheFootprint( const wxString& aFPKey, std::shared_ptr<FOOTPRINT> aFootprint );
+
+    ///< Completion handler (UI thread) for a background footprint load.
+    void onFootprintLoaded( long aSequence, const wxString& aFPKey, std::shared_ptr<FOOTPRINT> aFootprint );
+
 private:
+    using FP_CACHE_ENTRY = std::pair<wxString, std::shared_ptr<FOOTPRINT>>;
+
     std::unique_ptr<BOARD>                      m_dummyBoard;
     std::unique_ptr<KIGFX::GAL_DISPLAY_OPTIONS> m_displayOptions;
     EDA_UNITS                                   m_userUnits;
     std::map<wxString, wxString>                m_pinFunctions;
     std::shared_ptr<FOOTPRINT>                  m_currentFootprint;
     std::shared_ptr<FOOTPRINT>                  m_otherFootprint;
+
+    std::function<void( bool )>                 m_loadHandler;
+    std::shared_ptr<ASYNC_LOAD_STATE>           m_loadState;
+
+    std::list<FP_CACHE_ENTRY>                   m_cacheLru;    ///< Most-recently-used first
+    std::map<wxString, std::list<FP_CACHE_ENTRY>::iterator> m_cacheIndex;
 };
 
 #endif
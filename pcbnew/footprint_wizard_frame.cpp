@@ -33,6 +33,7 @@
 #include <bitmaps.h>
 #include <grid_tricks.h>
 #include <board.h>
+#include <footprint.h>
 #include <footprint_edit_frame.h>
 #include <footprint_editor_settings.h>
 #include <pcbnew_id.h>
@@ -595,6 +596,10 @@ BOARD_ITEM_CONTAINER* FOOTPRINT_WIZARD_FRAME::GetModel() const
 
 void FOOTPRINT_WIZARD_FRAME::PythonPluginsReload()
 {
+    // A reloaded script can generate different geometry for the same parameter values, so
+    // memoized builds are no longer trustworthy.
+    m_buildCache.clear();
+
     // Reload the Python plugins
     // Because the board editor has also a plugin python menu,
     // call the PCB_EDIT_FRAME RunAction() if the board editor is running
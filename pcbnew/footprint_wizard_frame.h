@@ -30,6 +30,9 @@
 #ifndef FOOTPRINT_WIZARD_FRAME_H_
 #define FOOTPRINT_WIZARD_FRAME_H_
 
+#include <map>
+#include <memory>
+
 #include <wx/gdicmn.h>
 #include <footprint_wizard.h>
 #include <pcb_base_edit_frame.h>
@@ -138,6 +141,19 @@ private:
      */
     void RegenerateFootprint();
 
+    /**
+     * Build a footprint for the current wizard parameters, memoizing the result.
+     *
+     * The Python build script only runs for parameter sets that have not been built before;
+     * returning to already-seen values serves a clone from the cache, so exploring parameters
+     * back and forth does not re-run the script.
+     *
+     * @param aWizard is the wizard to build with.
+     * @param aMessages is filled with the build messages reported by the script.
+     * @return a new #FOOTPRINT owned by the caller, or nullptr if the build failed.
+     */
+    FOOTPRINT* buildFootprint( FOOTPRINT_WIZARD* aWizard, wxString& aMessages );
+
     /**
      * Display the message generated by the python build footprint script.
      */
@@ -195,6 +211,15 @@ private:
     nlohmann::json  m_viewerAuiState;
 
     bool            m_wizardListShown;      ///< A show-once flag for the wizard list
+
+    /// A memoized wizard build: the generated footprint and the script's build messages.
+    struct WIZARD_BUILD
+    {
+        std::unique_ptr<FOOTPRINT> footprint;
+        wxString                   messages;
+    };
+
+    std::map<wxString, WIZARD_BUILD> m_buildCache;  ///< wizard builds keyed by parameter set
 };
 
 
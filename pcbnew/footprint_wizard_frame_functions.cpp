@@ -70,7 +70,7 @@ void FOOTPRINT_WIZARD_FRAME::RegenerateFootprint()
 
     // Creates the footprint
     wxString   msg;
-    FOOTPRINT* footprint = footprintWizard->GetFootprint( &msg );
+    FOOTPRINT* footprint = buildFootprint( footprintWizard, msg );
     DisplayBuildMessage( msg );
 
     if( footprint )
@@ -108,6 +108,46 @@ FOOTPRINT_WIZARD* FOOTPRINT_WIZARD_FRAME::GetMyWizard()
 }
 
 
+FOOTPRINT* FOOTPRINT_WIZARD_FRAME::buildFootprint( FOOTPRINT_WIZARD* aWizard, wxString& aMessages )
+{
+    // Key the cache on the wizard name and the full parameter set, so changing any value (on
+    // any page) forces a rebuild.  Reading the values back from the wizard is cheap; running
+    // the build script is not.
+    wxString key = aWizard->GetName();
+
+    for( int page = 0; page < aWizard->GetNumParameterPages(); page++ )
+    {
+        key << wxT( '\x1e' );
+
+        for( const wxString& value : aWizard->GetParameterValues( page ) )
+            key << wxT( '\x1f' ) << value;
+    }
+
+    auto it = m_buildCache.find( key );
+
+    if( it != m_buildCache.end() )
+    {
+        aMessages = it->second.messages;
+        return static_cast<FOOTPRINT*>( it->second.footprint->Clone() );
+    }
+
+    FOOTPRINT* footprint = aWizard->GetFootprint( &aMessages );
+
+    if( footprint )
+    {
+        // Keep only the working set of one exploration session; the geometry can be large.
+        if( m_buildCache.size() >= 32 )
+            m_buildCache.clear();
+
+        WIZARD_BUILD& entry = m_buildCache[ key ];
+        entry.footprint.reset( static_cast<FOOTPRINT*>( footprint->Clone() ) );
+        entry.messages = aMessages;
+    }
+
+    return footprint;
+}
+
+
 FOOTPRINT* FOOTPRINT_WIZARD_FRAME::GetBuiltFootprint()
 {
     FOOTPRINT_WIZARD* footprintWizard = FOOTPRINT_WIZARD_LIST::GetWizard( m_wizardName );
@@ -115,7 +155,7 @@ FOOTPRINT* FOOTPRINT_WIZARD_FRAME::GetBuiltFootprint()
     if( footprintWizard && m_modal_ret_val )
     {
         wxString   msg;
-        FOOTPRINT* footprint = footprintWizard->GetFootprint( &msg );
+        FOOTPRINT* footprint = buildFootprint( footprintWizard, msg );
         DisplayBuildMessage( msg );
 
         return footprint;
@@ -0,0 +1,155 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright The KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, you may find one here:
+ * http://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+ * or you may search the http://www.gnu.org website for the version 2 license,
+ * or you may write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
+ */
+
+#ifndef ITEM_POOL_H
+#define ITEM_POOL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include <core/spinlock.h>
+
+/**
+ * A type-segregated slab allocator for high-count board items.
+ *
+ * A million-segment board allocates each PCB_TRACK, PCB_VIA and PAD individually, which
+ * fragments the heap and spreads consecutive items across it, so the container walks in
+ * connectivity and DRC miss cache.  This pool carves fixed-size cells for one type out of
+ * large slabs: allocation is a free-list pop, same-type items end up adjacent in memory,
+ * and pointers are ordinary stable pointers, so ownership can keep moving between BOARD,
+ * commits and the undo stack exactly as it does today.
+ *
+ * Intended to back class-level operator new/delete (see PCB_TRACK, PAD).  Those overloads
+ * must route foreign allocations - SWIG subclasses with a different size, arrays - to the
+ * global heap, so deallocation goes through TryDeallocate(), which answers whether the
+ * pointer belongs to one of this pool's slabs.
+ *
+ * Slabs are retained for the life of the process (freed cells are recycled, the high-water
+ * mark is not returned to the OS), which is the usual slab-allocator trade for pointer
+ * stability without per-cell bookkeeping.
+ */
+template <typename T>
+class ITEM_POOL
+{
+public:
+    static ITEM_POOL& Get()
+    {
+        static ITEM_POOL instance;
+        return instance;
+    }
+
+    void* Allocate()
+    {
+        std::lock_guard<KISPINLOCK> guard( m_lock );
+
+        if( !m_freeList )
+            addSlab();
+
+        void* cell = m_freeList;
+        m_freeList = *static_cast<void**>( cell );
+
+        return cell;
+    }
+
+    /**
+     * Return \a aPtr's cell to the free list if it came from this pool.
+     *
+     * @return false if the pointer is not pool-managed (caller must free it normally)
+     */
+    bool TryDeallocate( void* aPtr )
+    {
+        std::lock_guard<KISPINLOCK> guard( m_lock );
+
+        if( !ownsLocked( aPtr ) )
+            return false;
+
+        *static_cast<void**>( aPtr ) = m_freeList;
+        m_freeList = aPtr;
+
+        return true;
+    }
+
+private:
+    // A cell must be able to hold the free-list link when vacant
+    static constexpr size_t CELL_SIZE = std::max( sizeof( T ), sizeof( void* ) );
+    static constexpr size_t SLAB_ITEMS = 4096;
+
+    static_assert( alignof( T ) <= alignof( std::max_align_t ),
+                   "ITEM_POOL slabs rely on malloc alignment" );
+
+    struct SLAB
+    {
+        std::unique_ptr<char[]> Storage;
+        char*                   Start;
+        char*                   End;
+    };
+
+    void addSlab()
+    {
+        SLAB slab;
+        slab.Storage = std::make_unique<char[]>( CELL_SIZE * SLAB_ITEMS );
+        slab.Start = slab.Storage.get();
+        slab.End = slab.Start + CELL_SIZE * SLAB_ITEMS;
+
+        // Thread the fresh cells onto the free list back to front, so they are handed out
+        // in address order
+        for( size_t ii = SLAB_ITEMS; ii > 0; --ii )
+        {
+            void* cell = slab.Start + ( ii - 1 ) * CELL_SIZE;
+            *static_cast<void**>( cell ) = m_freeList;
+            m_freeList = cell;
+        }
+
+        // Keep the slab index sorted for the binary search in ownsLocked()
+        auto it = std::lower_bound( m_slabs.begin(), m_slabs.end(), slab,
+                                    []( const SLAB& a, const SLAB& b )
+                                    {
+                                        return a.Start < b.Start;
+                                    } );
+
+        m_slabs.insert( it, std::move( slab ) );
+    }
+
+    bool ownsLocked( void* aPtr ) const
+    {
+        char* ptr = static_cast<char*>( aPtr );
+
+        auto it = std::upper_bound( m_slabs.begin(), m_slabs.end(), ptr,
+                                    []( char* p, const SLAB& slab )
+                                    {
+                                        return p < slab.Start;
+                                    } );
+
+        return it != m_slabs.begin() && ptr < std::prev( it )->End;
+    }
+
+    KISPINLOCK        m_lock;
+    std::vector<SLAB> m_slabs;      // sorted by Start address
+    void*             m_freeList = nullptr;
+};
+
+#endif // ITEM_POOL_H
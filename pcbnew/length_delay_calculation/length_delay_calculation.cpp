@@ -25,6 +25,7 @@
 
 #include <board.h>
 #include <board_design_settings.h>
+#include <footprint.h>
 #include <geometry/geometry_utils.h>
 #include <wx/log.h>
 
@@ -590,6 +591,52 @@ void LENGTH_DELAY_CALCULATION::OptimiseTraceInPad( SHAPE_LINE_CHAIN& aLine, cons
 
 LENGTH_DELAY_CALCULATION_ITEM
 LENGTH_DELAY_CALCULATION::GetLengthCalculationItem( const BOARD_CONNECTED_ITEM* aBoardItem ) const
+{
+    {
+        std::lock_guard<std::mutex> lock( m_itemCacheMutex );
+        auto                        it = m_itemCache.find( aBoardItem->m_Uuid );
+
+        if( it != m_itemCache.end() )
+            return it->second;
+    }
+
+    LENGTH_DELAY_CALCULATION_ITEM item = buildLengthCalculationItem( aBoardItem );
+
+    if( item.Type() != LENGTH_DELAY_CALCULATION_ITEM::TYPE::UNKNOWN )
+    {
+        std::lock_guard<std::mutex> lock( m_itemCacheMutex );
+        m_itemCache[aBoardItem->m_Uuid] = item;
+    }
+
+    return item;
+}
+
+
+void LENGTH_DELAY_CALCULATION::InvalidateCachedItem( const BOARD_ITEM* aBoardItem ) const
+{
+    std::lock_guard<std::mutex> lock( m_itemCacheMutex );
+
+    if( const FOOTPRINT* footprint = dynamic_cast<const FOOTPRINT*>( aBoardItem ) )
+    {
+        for( const PAD* pad : footprint->Pads() )
+            m_itemCache.erase( pad->m_Uuid );
+    }
+    else
+    {
+        m_itemCache.erase( aBoardItem->m_Uuid );
+    }
+}
+
+
+void LENGTH_DELAY_CALCULATION::ClearItemCache() const
+{
+    std::lock_guard<std::mutex> lock( m_itemCacheMutex );
+    m_itemCache.clear();
+}
+
+
+LENGTH_DELAY_CALCULATION_ITEM
+LENGTH_DELAY_CALCULATION::buildLengthCalculationItem( const BOARD_CONNECTED_ITEM* aBoardItem ) const
 {
     if( const PCB_TRACK* track = dynamic_cast<const PCB_TRACK*>( aBoardItem ) )
     {
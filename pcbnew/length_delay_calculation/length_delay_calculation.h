@@ -30,6 +30,8 @@
 #include <board_design_settings.h>
 #include <connectivity/connectivity_data.h>
 #include <length_delay_calculation/length_delay_calculation_item.h>
+#include <mutex>
+#include <unordered_map>
 #include <unordered_set>
 
 class BOARD;
@@ -193,6 +195,15 @@ public:
     /// Return a LENGTH_CALCULATION_ITEM constructed from the given BOARD_CONNECTED_ITEM
     LENGTH_DELAY_CALCULATION_ITEM GetLengthCalculationItem( const BOARD_CONNECTED_ITEM* aBoardItem ) const;
 
+    /**
+     * Invalidate any cached calculation item for the given board item (and, for footprints, their
+     * pads).  Called from BOARD change notifications so that edits only recompute what changed.
+     */
+    void InvalidateCachedItem( const BOARD_ITEM* aBoardItem ) const;
+
+    /// Drop all cached calculation items, e.g. after netclass or stackup changes
+    void ClearItemCache() const;
+
     /// Sets the provider for tuning profile parameter resolution
     void SetTuningProfileParametersProvider( std::unique_ptr<TUNING_PROFILE_PARAMETERS_IFACE>&& aProvider );
 
@@ -213,6 +224,18 @@ protected:
     /// The active provider of tuning profile parameters
     std::unique_ptr<TUNING_PROFILE_PARAMETERS_IFACE> m_tuningProfileParameters;
 
+    /// Construct a calculation item from the given board item (cache miss path)
+    LENGTH_DELAY_CALCULATION_ITEM buildLengthCalculationItem( const BOARD_CONNECTED_ITEM* aBoardItem ) const;
+
+    /**
+     * Cache of constructed calculation items keyed by board item KIID.  Rebuilding the items for
+     * every length query re-derives via layer spans, pad layer sets and effective netclasses for
+     * items that have not changed; with the cache, live readouts while routing a wide interface
+     * only pay construction costs for the items a commit actually touched.
+     */
+    mutable std::mutex                                      m_itemCacheMutex;
+    mutable std::unordered_map<KIID, LENGTH_DELAY_CALCULATION_ITEM> m_itemCache;
+
     /// Enum to describe whether track merging is attempted from the start or end of a track segment
     enum class MERGE_POINT
     {
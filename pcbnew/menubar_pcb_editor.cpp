@@ -357,6 +357,10 @@ void PCB_EDIT_FRAME::doReCreateMenuBar()
     routeMenu->Add( PCB_ACTIONS::routeSingleTrack );
     routeMenu->Add( PCB_ACTIONS::routeDiffPair );
 
+    routeMenu->AppendSeparator();
+    routeMenu->Add( PCB_ACTIONS::batchRouteUnrouted );
+    routeMenu->Add( PCB_ACTIONS::batchRouteFanout );
+
     routeMenu->AppendSeparator();
     routeMenu->Add( PCB_ACTIONS::tuneSingleTrack );
     routeMenu->Add( PCB_ACTIONS::tuneDiffPair );
@@ -29,6 +29,8 @@
 #ifndef CLASS_NETINFO_
 #define CLASS_NETINFO_
 
+#include <unordered_map>
+
 #include <macros_swig.h>
 #include <netclass.h>
 #include <board_item.h>
@@ -371,6 +373,11 @@ private:
     NETNAMES_MAP m_netNames;        ///< map of <wxString, NETINFO_ITEM*>, is NETINFO_ITEM owner
     NETCODES_MAP m_netCodes;        ///< map of <int, NETINFO_ITEM*> is NOT owner
 
+    ///< Hash index shadowing m_netNames: name lookups are hot (netlist updates, connectivity,
+    ///< rule evaluation) and the sorted map costs a wide-string compare per tree level.  The
+    ///< sorted map stays as the owner and for SWIG/ordered iteration.
+    std::unordered_map<wxString, NETINFO_ITEM*> m_netNameIndex;
+
     int          m_newNetCode;      ///< possible value for new net code assignment
 };
 
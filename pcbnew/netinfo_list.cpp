@@ -60,6 +60,7 @@ void NETINFO_LIST::clear()
         delete it->second;
 
     m_netNames.clear();
+    m_netNameIndex.clear();
     m_netCodes.clear();
     m_newNetCode = 0;
 }
@@ -78,10 +79,10 @@ NETINFO_ITEM* NETINFO_LIST::GetNetItem( int aNetCode ) const
 
 NETINFO_ITEM* NETINFO_LIST::GetNetItem( const wxString& aNetName ) const
 {
-    NETNAMES_MAP::const_iterator result = m_netNames.find( aNetName );
+    auto result = m_netNameIndex.find( aNetName );
 
-    if( result != m_netNames.end() )
-        return (*result).second;
+    if( result != m_netNameIndex.end() )
+        return result->second;
 
     return nullptr;
 }
@@ -107,6 +108,7 @@ void NETINFO_LIST::RemoveNet( NETINFO_ITEM* aNet )
         {
             wxASSERT_MSG( removed, wxT( "NETINFO_LIST::RemoveNet: target net found in m_netNames "
                                         "but not m_netCodes!" ) );
+            m_netNameIndex.erase( i->first );
             m_netNames.erase(i);
             break;
         }
@@ -127,12 +129,14 @@ void NETINFO_LIST::RemoveUnusedNets( BOARD_COMMIT* aCommit )
 
     m_netCodes.clear();
     m_netNames.clear();
+    m_netNameIndex.clear();
 
     for( const auto& [ netCode, netInfo ] : existingNets )
     {
         if( netInfo->IsCurrent() )
         {
             m_netNames.insert( std::make_pair( netInfo->GetNetname(), netInfo ) );
+            m_netNameIndex.insert( std::make_pair( netInfo->GetNetname(), netInfo ) );
             m_netCodes.insert( std::make_pair( netCode, netInfo ) );
         }
         else
@@ -170,6 +174,7 @@ void NETINFO_LIST::AppendNet( NETINFO_ITEM* aNewElement )
 
     // add an entry for fast look up by a net name using a map
     m_netNames.insert( std::make_pair( aNewElement->GetNetname(), aNewElement ) );
+    m_netNameIndex.insert( std::make_pair( aNewElement->GetNetname(), aNewElement ) );
     m_netCodes.insert( std::make_pair( aNewElement->GetNetCode(), aNewElement ) );
 
     m_DisplayNetnamesDirty = true;
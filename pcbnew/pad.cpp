@@ -42,6 +42,7 @@
 #include <board_connected_item.h>
 #include <board_design_settings.h>
 #include <footprint.h>
+#include <item_pool.h>
 #include <lset.h>
 #include <pad.h>
 #include <pad_utils.h>
@@ -73,6 +74,22 @@ using KIGFX::PCB_PAINTER;
 using KIGFX::PCB_RENDER_SETTINGS;
 
 
+void* PAD::operator new( size_t aSize )
+{
+    if( aSize == sizeof( PAD ) )
+        return ITEM_POOL<PAD>::Get().Allocate();
+
+    return ::operator new( aSize );
+}
+
+
+void PAD::operator delete( void* aPtr )
+{
+    if( aPtr && !ITEM_POOL<PAD>::Get().TryDeallocate( aPtr ) )
+        ::operator delete( aPtr );
+}
+
+
 PAD::PAD( FOOTPRINT* parent ) :
     BOARD_CONNECTED_ITEM( parent, PCB_PAD_T ),
     m_padStack( this )
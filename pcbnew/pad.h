@@ -61,6 +61,11 @@ public:
     PAD( const PAD& aPad );
     PAD& operator=( const PAD &aOther );
 
+    // Pooled allocation (see item_pool.h): exact-size allocations come from a
+    // type-segregated slab; anything else (e.g. SWIG subclasses) from the heap.
+    void* operator new( size_t aSize );
+    void  operator delete( void* aPtr );
+
     void CopyFrom( const BOARD_ITEM* aOther ) override;
 
     void Serialize( google::protobuf::Any &aContainer ) const override;
@@ -1025,6 +1025,12 @@ void PCB_BASE_FRAME::SetDisplayOptions( const PCB_DISPLAY_OPTIONS& aOptions, boo
     bool hcChanged    = m_displayOptions.m_ContrastModeDisplay != aOptions.m_ContrastModeDisplay;
     bool hcVisChanged = m_displayOptions.m_ContrastModeDisplay == HIGH_CONTRAST_MODE::HIDDEN
                         || aOptions.m_ContrastModeDisplay == HIGH_CONTRAST_MODE::HIDDEN;
+    bool opacityChanged = m_displayOptions.m_TrackOpacity != aOptions.m_TrackOpacity
+                          || m_displayOptions.m_ViaOpacity != aOptions.m_ViaOpacity
+                          || m_displayOptions.m_PadOpacity != aOptions.m_PadOpacity
+                          || m_displayOptions.m_ZoneOpacity != aOptions.m_ZoneOpacity
+                          || m_displayOptions.m_ImageOpacity != aOptions.m_ImageOpacity
+                          || m_displayOptions.m_FilledShapeOpacity != aOptions.m_FilledShapeOpacity;
     m_displayOptions  = aOptions;
 
     EDA_DRAW_PANEL_GAL* canvas = GetCanvas();
@@ -1034,6 +1040,12 @@ void PCB_BASE_FRAME::SetDisplayOptions( const PCB_DISPLAY_OPTIONS& aOptions, boo
     canvas->SetHighContrastLayer( GetActiveLayer() );
     OnDisplayOptionsChanged();
 
+    // Opacity only affects the colors of already-cached geometry, so patch the cached
+    // groups in place rather than re-streaming the (potentially very large) zone fill
+    // and track meshes to the GPU.
+    if( opacityChanged )
+        view->UpdateAllLayersColor();
+
     // Vias on a restricted layer set must be redrawn when high contrast mode is changed
     if( hcChanged )
     {
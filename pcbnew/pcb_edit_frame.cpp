@@ -23,6 +23,7 @@
 #include <advanced_config.h>
 #include <ai_diff_analyzer.h>
 #include <auth/auth_manager.h>
+#include <background_job_scheduler.h>
 #include <connectivity/connectivity_data.h>
 #include <kiface_base.h>
 #include <kiway.h>
@@ -704,6 +705,9 @@ void PCB_EDIT_FRAME::OnCrossProbeFlashTimer( wxTimerEvent& aEvent )
 
 PCB_EDIT_FRAME::~PCB_EDIT_FRAME()
 {
+    // The warming job holds a raw pointer to the board
+    cancelCacheWarming();
+
     // Unbind auth state change handler
     AUTH_MANAGER::Instance().Unbind( EVT_AUTH_STATE_CHANGED, &PCB_EDIT_FRAME::onAuthStateChanged, this );
 
@@ -743,6 +747,8 @@ PCB_EDIT_FRAME::~PCB_EDIT_FRAME()
 void PCB_EDIT_FRAME::SetBoard( BOARD* aBoard, bool aBuildConnectivity,
                                PROGRESS_REPORTER* aReporter )
 {
+    cancelCacheWarming();
+
     if( m_pcb )
         m_pcb->ClearProject();
 
@@ -758,6 +764,77 @@ void PCB_EDIT_FRAME::SetBoard( BOARD* aBoard, bool aBuildConnectivity,
 }
 
 
+void PCB_EDIT_FRAME::scheduleCacheWarming()
+{
+    cancelCacheWarming();
+
+    BOARD* board = GetBoard();
+
+    if( !board )
+        return;
+
+    // Snapshot the item pointers on the UI thread.  The job checkpoints on the board
+    // timestamp, which BOARD_COMMIT bumps on any modification, so it unwinds before a
+    // commit's deletions can leave it holding stale pointers (the scheduler additionally
+    // pauses background work as soon as the user interacts).
+    std::vector<BOARD_ITEM*> items;
+
+    for( PCB_TRACK* track : board->Tracks() )
+        items.push_back( track );
+
+    for( FOOTPRINT* footprint : board->Footprints() )
+    {
+        for( PAD* pad : footprint->Pads() )
+            items.push_back( pad );
+    }
+
+    // Text warms the font/glyph caches along with its effective shape
+    for( BOARD_ITEM* drawing : board->Drawings() )
+        items.push_back( drawing );
+
+    const int       timestamp = board->GetTimeStamp();
+    const LSET      copperMask = LSET::AllCuMask( board->GetCopperLayerCount() );
+
+    m_cacheWarmJob = Pgm().GetBackgroundJobScheduler().Submit(
+            _( "Warming board caches" ), TP_PRIORITY_BATCH,
+            [board, items = std::move( items ), timestamp, copperMask]( BACKGROUND_JOB_WORK& aWork )
+            {
+                board->GetMaxClearanceValue();
+
+                size_t count = 0;
+
+                for( BOARD_ITEM* item : items )
+                {
+                    if( ( count++ % 64 ) == 0 )
+                    {
+                        if( !aWork.KeepGoing() || board->GetTimeStamp() != timestamp )
+                            return;
+                    }
+
+                    LSET layers = item->GetLayerSet();
+
+                    // Connected items only matter where DRC and the router will look
+                    if( dynamic_cast<BOARD_CONNECTED_ITEM*>( item ) )
+                        layers &= copperMask;
+
+                    for( PCB_LAYER_ID layer : layers )
+                        board->GetCachedEffectiveShape( item, layer );
+                }
+            } );
+}
+
+
+void PCB_EDIT_FRAME::cancelCacheWarming()
+{
+    if( m_cacheWarmJob )
+    {
+        Pgm().GetBackgroundJobScheduler().Cancel( m_cacheWarmJob );
+        Pgm().GetBackgroundJobScheduler().Wait( m_cacheWarmJob );
+        m_cacheWarmJob.reset();
+    }
+}
+
+
 BOARD_ITEM_CONTAINER* PCB_EDIT_FRAME::GetModel() const
 {
     return m_pcb;
@@ -64,6 +64,7 @@ class TOOL_ACTION;
 class DIALOG_BOARD_SETUP;
 class PCB_DESIGN_BLOCK_PANE;
 class AI_CHAT_PANEL;
+class SCHEDULED_JOB;
 struct DIFF_RESULT;
 
 
@@ -926,6 +927,17 @@ public:
      */
     std::string severityToString( SEVERITY aSeverity );
 
+    /**
+     * Queue an idle-priority background job prewarming the board's run-time caches
+     * (effective shapes per copper layer, max clearance, text/font geometry), so that the
+     * first DRC, router start or zone fill after a load doesn't pay the cold-cache cost.
+     * The job yields to user interaction and aborts if the board is modified.
+     */
+    void scheduleCacheWarming();
+
+    /// Cancel a pending cache-warming job and wait out a running one.
+    void cancelCacheWarming();
+
 private:
     friend struct PCB::IFACE;
     friend class APPEARANCE_CONTROLS;
@@ -959,6 +971,8 @@ private:
 
     wxTimer*     m_eventCounterTimer;
 
+    std::shared_ptr<SCHEDULED_JOB> m_cacheWarmJob;
+
     // AI edit undo/redo state tracking
     std::map<KIID, std::unique_ptr<BOARD_ITEM>>  m_aiEditBeforeState;  ///< Map of UUID to BOARD_ITEM copy for items before AI edit
     wxString                                    m_aiEditTracePcbBackupPath;  ///< Path to backup of trace_pcb file
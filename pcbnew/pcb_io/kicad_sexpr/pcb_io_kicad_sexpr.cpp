@@ -27,7 +27,9 @@
 #include <wx/log.h>
 #include <wx/msgdlg.h>
 #include <wx/mstream.h>
+#include <wx/tokenzr.h>
 
+#include <advanced_config.h>
 #include <board.h>
 #include <board_design_settings.h>
 #include <callback_gal.h>
@@ -64,6 +66,7 @@
 #include <trace_helpers.h>
 #include <wildcards_and_files_ext.h>
 #include <zone.h>
+#include <zone_triangulation_cache.h>
 
 #include <build_version.h>
 #include <filter_reader.h>
@@ -321,9 +324,41 @@ void PCB_IO_KICAD_SEXPR::SaveBoard( const wxString& aFileName, BOARD* aBoard,
     Format( aBoard );
 
     m_out->Print( ")" );
-    m_out->Finish();
+
+    // Prettification, the disk write and the atomic rename run on a background thread;
+    // overlap them with the sidecar refresh below and rejoin before returning so callers
+    // still see the finished file (and any IO_ERROR) when we return.
+    std::future<bool> writeDone = formatter.FinishAsync();
 
     m_out = nullptr;
+
+    // Refresh the triangulation sidecar so a board closed right after saving -- or saved
+    // under a new name -- reopens warm.  The text file remains the source of truth: every
+    // sidecar entry is keyed by its polygon checksum, so a stale or mismatched sidecar
+    // can never be applied; it just misses and the fill is re-tessellated.
+    if( ADVANCED_CFG::GetCfg().m_EnableTriangulationCache )
+    {
+        ZONE_TRIANGULATION_CACHE sidecar( aFileName );
+        sidecar.Load();
+
+        for( ZONE* zone : aBoard->Zones() )
+        {
+            for( PCB_LAYER_ID layer : zone->GetLayerSet().Seq() )
+            {
+                if( !zone->HasFilledPolysForLayer( layer ) )
+                    continue;
+
+                const std::shared_ptr<SHAPE_POLY_SET>& fill = zone->GetFilledPolysList( layer );
+
+                if( fill->IsTriangulationUpToDate() )
+                    sidecar.Put( *fill );
+            }
+        }
+
+        sidecar.Save();
+    }
+
+    writeDone.get();
 }
 
 
@@ -2964,7 +2999,9 @@ BOARD* PCB_IO_KICAD_SEXPR::LoadBoard( const wxString& aFileName, BOARD* aAppendT
                                       const std::map<std::string, UTF8>* aProperties,
                                       PROJECT* aProject )
 {
-    FILE_LINE_READER reader( aFileName );
+    // Reading the whole board into memory up front keeps the parse bandwidth-bound
+    // instead of allocator-bound on very large boards.
+    WHOLE_FILE_LINE_READER reader( aFileName );
 
     unsigned lineCount = 0;
 
@@ -3027,10 +3064,111 @@ BOARD* PCB_IO_KICAD_SEXPR::DoLoad( LINE_READER& aReader, BOARD* aAppendToMe,
                            parser.CurLine(), parser.CurLineNumber(), parser.CurOffset() );
     }
 
+    applyRegionOfInterest( board );
+
     return board;
 }
 
 
+void PCB_IO_KICAD_SEXPR::applyRegionOfInterest( BOARD* aBoard )
+{
+    if( !m_props )
+        return;
+
+    auto roiIt = m_props->find( "region_of_interest" );
+    auto layersIt = m_props->find( "region_of_interest_layers" );
+
+    if( roiIt == m_props->end() && layersIt == m_props->end() )
+        return;
+
+    bool  haveRoi = false;
+    BOX2I roi;
+
+    if( roiIt != m_props->end() )
+    {
+        double x, y, w, h;
+
+        if( sscanf( roiIt->second.c_str(), "%lf %lf %lf %lf", &x, &y, &w, &h ) != 4 )
+        {
+            THROW_IO_ERROR( _( "Invalid \"region_of_interest\" property: expected \"x y w h\" "
+                               "in mm." ) );
+        }
+
+        roi = BOX2I( VECTOR2I( pcbIUScale.mmToIU( x ), pcbIUScale.mmToIU( y ) ),
+                     VECTOR2I( pcbIUScale.mmToIU( w ), pcbIUScale.mmToIU( h ) ) );
+        haveRoi = true;
+    }
+
+    bool haveLayers = false;
+    LSET scopeLayers;
+
+    if( layersIt != m_props->end() )
+    {
+        wxStringTokenizer tokenizer( wxString( layersIt->second ), wxS( "," ) );
+
+        while( tokenizer.HasMoreTokens() )
+        {
+            wxString     name = tokenizer.GetNextToken().Trim( true ).Trim( false );
+            PCB_LAYER_ID layer = aBoard->GetLayerID( name );
+
+            if( layer == UNDEFINED_LAYER )
+            {
+                THROW_IO_ERROR( wxString::Format( _( "Unknown layer '%s' in "
+                                                     "\"region_of_interest_layers\" property." ),
+                                                  name ) );
+            }
+
+            scopeLayers.set( layer );
+        }
+
+        haveLayers = true;
+    }
+
+    auto inScope =
+            [&]( BOARD_ITEM* aItem )
+            {
+                if( haveRoi && !aItem->GetBoundingBox().Intersects( roi ) )
+                    return false;
+
+                if( haveLayers && !( aItem->GetLayerSet() & scopeLayers ).any() )
+                    return false;
+
+                return true;
+            };
+
+    // Footprints are kept or dropped atomically; groups and generators are retained (they
+    // are cheap) but pruned members are detached so they don't dangle.
+    std::vector<BOARD_ITEM*> candidates;
+    candidates.insert( candidates.end(), aBoard->Tracks().begin(), aBoard->Tracks().end() );
+    candidates.insert( candidates.end(), aBoard->Zones().begin(), aBoard->Zones().end() );
+    candidates.insert( candidates.end(), aBoard->Drawings().begin(), aBoard->Drawings().end() );
+    candidates.insert( candidates.end(), aBoard->Footprints().begin(),
+                       aBoard->Footprints().end() );
+
+    std::vector<BOARD_ITEM*> removed;
+
+    for( BOARD_ITEM* item : candidates )
+    {
+        if( inScope( item ) )
+            continue;
+
+        if( EDA_GROUP* group = item->GetParentGroup() )
+            group->RemoveItem( item );
+
+        aBoard->Remove( item, REMOVE_MODE::BULK );
+        removed.push_back( item );
+    }
+
+    if( !removed.empty() )
+    {
+        aBoard->FinalizeBulkRemove( removed );
+
+        for( BOARD_ITEM* item : removed )
+            delete item;
+    }
+}
+
+
 void PCB_IO_KICAD_SEXPR::init( const std::map<std::string, UTF8>* aProperties )
 {
     m_board = nullptr;
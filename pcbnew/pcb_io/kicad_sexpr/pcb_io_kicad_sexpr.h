@@ -347,6 +347,21 @@ public:
     void SaveBoard( const wxString& aFileName, BOARD* aBoard,
                     const std::map<std::string, UTF8>* aProperties = nullptr ) override;
 
+    /**
+     * Load a board, optionally scoped to a region of interest.
+     *
+     * Two optional \a aProperties keys restrict what the returned board contains, for
+     * viewer-style workflows (fab review of one sub-board in a panel) that don't need --
+     * and can't afford to build connectivity and caches for -- the whole file:
+     *
+     *  - "region_of_interest": "x y w h" in mm; items whose bounding boxes fall entirely
+     *    outside the rectangle are dropped after parsing.
+     *  - "region_of_interest_layers": comma-separated layer names (canonical or
+     *    user-renamed); items on none of the listed layers are dropped.
+     *
+     * A board loaded with either key is a partial view: saving it back would discard the
+     * pruned items, so callers are expected to treat it as read-only.
+     */
     BOARD* LoadBoard( const wxString& aFileName, BOARD* aAppendToMe,
                       const std::map<std::string, UTF8>* aProperties = nullptr,
                       PROJECT* aProject = nullptr ) override;
@@ -424,6 +439,13 @@ protected:
 
     void init( const std::map<std::string, UTF8>* aProperties );
 
+    /**
+     * Prune a freshly parsed board down to the region of interest requested via the
+     * "region_of_interest" / "region_of_interest_layers" load properties (no-op when
+     * neither was given).  See LoadBoard() for the property formats.
+     */
+    void applyRegionOfInterest( BOARD* aBoard );
+
     /// formats the board setup information
     void formatSetup( const BOARD* aBoard ) const;
 
@@ -628,6 +628,30 @@ int PCB_PAINTER::getViaDrillSize( const PCB_VIA* aVia ) const
 }
 
 
+void PCB_PAINTER::PrepareItem( const VIEW_ITEM* aItem )
+{
+    // Triangulating filled zones is by far the most expensive CPU-side part of a recache;
+    // doing it here lets the VIEW farm it out to worker threads, so the serial GAL pass
+    // only commits ready-made triangle data.
+    if( const ZONE* zone = dynamic_cast<const ZONE*>( aItem ) )
+    {
+        if( !m_gal->IsOpenGlEngine() )
+            return;
+
+        for( PCB_LAYER_ID layer : zone->GetLayerSet().Seq() )
+        {
+            if( !zone->HasFilledPolysForLayer( layer ) )
+                continue;
+
+            const std::shared_ptr<SHAPE_POLY_SET>& polySet = zone->GetFilledPolysList( layer );
+
+            if( polySet->OutlineCount() > 0 && !polySet->IsTriangulationUpToDate() )
+                polySet->CacheTriangulation( true, true );
+        }
+    }
+}
+
+
 bool PCB_PAINTER::Draw( const VIEW_ITEM* aItem, int aLayer )
 {
     if( !aItem->IsBOARD_ITEM() )
@@ -194,6 +194,9 @@ public:
     /// @copydoc PAINTER::Draw()
     virtual bool Draw( const VIEW_ITEM* aItem, int aLayer ) override;
 
+    ///< @copydoc PAINTER::PrepareItem()
+    virtual void PrepareItem( const VIEW_ITEM* aItem ) override;
+
 protected:
     PCB_VIEWERS_SETTINGS_BASE* viewer_settings();
 
@@ -45,6 +45,8 @@
 #include <api/api_utils.h>
 #include <api/board/board_types.pb.h>
 
+#include <mutex>
+
 
 PCB_TEXT::PCB_TEXT( BOARD_ITEM* parent, KICAD_T idtype ) :
         BOARD_ITEM( parent, idtype ),
@@ -498,17 +500,23 @@ std::shared_ptr<SHAPE> PCB_TEXT::GetEffectiveShape( PCB_LAYER_ID aLayer, FLASHIN
 {
     if( IsKnockout() )
     {
-        SHAPE_POLY_SET poly;
-
-        TransformTextToPolySet( poly, 0, GetMaxError(), ERROR_INSIDE );
+        KIFONT::FONT* font = GetDrawFont( nullptr );
 
-        return std::make_shared<SHAPE_POLY_SET>( std::move( poly ) );
+        return std::make_shared<SHAPE_POLY_SET>( GetKnockoutCache( font, GetShownText( true ),
+                                                                   GetMaxError() ) );
     }
 
     return GetEffectiveTextShape();
 }
 
 
+// The knockout Boolean is expensive and its result is shared between the painter, the DRC
+// engine and the plotters, so access to the memoized copy must be serialized.  (A member
+// mutex would make PCB_TEXT non-swappable; knockout texts are rare enough that a global
+// lock doesn't contend.)
+static std::mutex s_knockoutCacheMutex;
+
+
 SHAPE_POLY_SET PCB_TEXT::GetKnockoutCache( const KIFONT::FONT* aFont, const wxString& forResolvedText,
                                            int aMaxError ) const
 {
@@ -516,6 +524,8 @@ SHAPE_POLY_SET PCB_TEXT::GetKnockoutCache( const KIFONT::FONT* aFont, const wxSt
     EDA_ANGLE       drawAngle = GetDrawRotation();
     VECTOR2I        drawPos = GetDrawPos();
 
+    std::lock_guard<std::mutex> lock( s_knockoutCacheMutex );
+
     if( m_knockout_cache.IsEmpty()
             || m_knockout_cache_text_attrs != attrs
             || m_knockout_cache_text != forResolvedText
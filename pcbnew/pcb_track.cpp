@@ -26,6 +26,7 @@
 
 #include "pcb_track.h"
 
+#include <item_pool.h>
 #include <pcb_base_frame.h>
 #include <core/mirror.h>
 #include <connectivity/connectivity_data.h>
@@ -60,6 +61,55 @@
 using KIGFX::PCB_PAINTER;
 using KIGFX::PCB_RENDER_SETTINGS;
 
+
+void* PCB_TRACK::operator new( size_t aSize )
+{
+    if( aSize == sizeof( PCB_TRACK ) )
+        return ITEM_POOL<PCB_TRACK>::Get().Allocate();
+
+    return ::operator new( aSize );
+}
+
+
+void PCB_TRACK::operator delete( void* aPtr )
+{
+    if( aPtr && !ITEM_POOL<PCB_TRACK>::Get().TryDeallocate( aPtr ) )
+        ::operator delete( aPtr );
+}
+
+
+void* PCB_ARC::operator new( size_t aSize )
+{
+    if( aSize == sizeof( PCB_ARC ) )
+        return ITEM_POOL<PCB_ARC>::Get().Allocate();
+
+    return ::operator new( aSize );
+}
+
+
+void PCB_ARC::operator delete( void* aPtr )
+{
+    if( aPtr && !ITEM_POOL<PCB_ARC>::Get().TryDeallocate( aPtr ) )
+        ::operator delete( aPtr );
+}
+
+
+void* PCB_VIA::operator new( size_t aSize )
+{
+    if( aSize == sizeof( PCB_VIA ) )
+        return ITEM_POOL<PCB_VIA>::Get().Allocate();
+
+    return ::operator new( aSize );
+}
+
+
+void PCB_VIA::operator delete( void* aPtr )
+{
+    if( aPtr && !ITEM_POOL<PCB_VIA>::Get().TryDeallocate( aPtr ) )
+        ::operator delete( aPtr );
+}
+
+
 PCB_TRACK::PCB_TRACK( BOARD_ITEM* aParent, KICAD_T idtype ) :
     BOARD_CONNECTED_ITEM( aParent, idtype )
 {
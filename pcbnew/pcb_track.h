@@ -126,6 +126,11 @@ public:
 
     // Do not create a copy constructor.  The one generated by the compiler is adequate.
 
+    // Pooled allocation (see item_pool.h): exact-size allocations come from a
+    // type-segregated slab; anything else (e.g. SWIG subclasses) from the heap.
+    void* operator new( size_t aSize );
+    void  operator delete( void* aPtr );
+
     void CopyFrom( const BOARD_ITEM* aOther ) override;
 
     void Move( const VECTOR2I& aMoveVector ) override
@@ -323,6 +328,10 @@ public:
 
     PCB_ARC( BOARD_ITEM* aParent, const SHAPE_ARC* aArc );
 
+    // Pooled allocation; each concrete type has its own slab (cell sizes differ)
+    void* operator new( size_t aSize );
+    void  operator delete( void* aPtr );
+
     void CopyFrom( const BOARD_ITEM* aOther ) override;
 
     static inline bool ClassOf( const EDA_ITEM *aItem )
@@ -425,6 +434,10 @@ public:
     PCB_VIA( const PCB_VIA& aOther );
     PCB_VIA& operator=( const PCB_VIA &aOther );
 
+    // Pooled allocation; each concrete type has its own slab (cell sizes differ)
+    void* operator new( size_t aSize );
+    void  operator delete( void* aPtr );
+
     void CopyFrom( const BOARD_ITEM* aOther ) override;
 
     bool IsType( const std::vector<KICAD_T>& aScanTypes ) const override
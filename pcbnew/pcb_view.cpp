@@ -152,5 +152,8 @@ void PCB_VIEW::UpdateDisplayOptions( const PCB_DISPLAY_OPTIONS& aOptions )
     KIGFX::PCB_RENDER_SETTINGS* settings = painter->GetSettings();
 
     settings->LoadDisplayOptions( aOptions );
+
+    // Display options feed the items' ViewGetLOD() calculations
+    MarkLODsDirty();
 }
 }
@@ -435,18 +435,19 @@ bool IFACE::OnKifaceStart( PGM_BASE* aProgram, int aCtlBits, KIWAY* aKiway )
 
     SETTINGS_MANAGER& mgr = aProgram->GetSettingsManager();
 
-    mgr.RegisterSettings( new FOOTPRINT_EDITOR_SETTINGS );
-    mgr.RegisterSettings( new EDA_3D_VIEWER_SETTINGS );
+    // Loads are deferred to first access (via GetAppSettings()) to keep cold start fast; the
+    // footprint editor and 3D viewer stores still have to be registered before KifaceSettings
+    // because in legacy configs many settings were in a single editor config, and the migration
+    // routine for the main editor file calls into the now separate settings stores to move the
+    // settings into them (which triggers their deferred loads first)
+    mgr.RegisterSettings( new FOOTPRINT_EDITOR_SETTINGS, false );
+    mgr.RegisterSettings( new EDA_3D_VIEWER_SETTINGS, false );
 
-    // We intentionally register KifaceSettings after FOOTPRINT_EDITOR_SETTINGS and EDA_3D_VIEWER_SETTINGS
-    // In legacy configs, many settings were in a single editor config and the migration routine
-    // for the main editor file will try and call into the now separate settings stores
-    // to move the settings into them
     mgr.RegisterSettings( KifaceSettings() );
 
-    // Register the footprint editor settings as well because they share a KiFACE and need to be
-    // loaded prior to use to avoid threading deadlocks
-    mgr.RegisterSettings( new CVPCB_SETTINGS );
+    // Register the cvpcb settings as well because they share a KiFACE; their load is likewise
+    // deferred until cvpcb is actually opened
+    mgr.RegisterSettings( new CVPCB_SETTINGS, false );
 
     start_common( aCtlBits );
 
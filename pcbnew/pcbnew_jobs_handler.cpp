@@ -117,7 +117,6 @@
 
 PCBNEW_JOBS_HANDLER::PCBNEW_JOBS_HANDLER( KIWAY* aKiway ) :
         JOB_DISPATCHER( aKiway ),
-        m_cliBoard( nullptr ),
         m_toolManager( nullptr )
 {
     Register( "3d", std::bind( &PCBNEW_JOBS_HANDLER::JobExportStep, this, std::placeholders::_1 ),
@@ -401,6 +400,22 @@ TOOL_MANAGER* PCBNEW_JOBS_HANDLER::getToolManager( BOARD* aBrd )
 }
 
 
+BOARD* PCBNEW_JOBS_HANDLER::loadCachedBoard( const wxString& aPath )
+{
+    auto it = m_cliBoards.find( aPath );
+
+    if( it != m_cliBoards.end() )
+        return it->second;
+
+    BOARD* brd = LoadBoard( aPath, true );
+
+    if( brd )
+        m_cliBoards[aPath] = brd;
+
+    return brd;
+}
+
+
 BOARD* PCBNEW_JOBS_HANDLER::getBoard( const wxString& aPath )
 {
     BOARD* brd = nullptr;
@@ -417,10 +432,7 @@ BOARD* PCBNEW_JOBS_HANDLER::getBoard( const wxString& aPath )
             pcbPath = path.GetFullPath();
         }
 
-        if( !m_cliBoard )
-            m_cliBoard = LoadBoard( pcbPath, true );
-
-        brd = m_cliBoard;
+        brd = loadCachedBoard( pcbPath );
     }
     else if( Pgm().IsGUI() && Pgm().GetSettingsManager().IsProjectOpen() )
     {
@@ -431,7 +443,7 @@ BOARD* PCBNEW_JOBS_HANDLER::getBoard( const wxString& aPath )
     }
     else
     {
-        brd = LoadBoard( aPath, true );
+        brd = loadCachedBoard( aPath );
     }
 
     if( !brd )
@@ -1413,7 +1425,7 @@ int PCBNEW_JOBS_HANDLER::JobExportGencad( JOB* aJob )
     if( aGencadJob == nullptr )
         return CLI::EXIT_CODES::ERR_UNKNOWN;
 
-    BOARD* brd = LoadBoard( aGencadJob->m_filename, true ); // Ensure m_board is of type BOARD*
+    BOARD* brd = getBoard( aGencadJob->m_filename );
 
     if( brd == nullptr )
         return CLI::EXIT_CODES::ERR_UNKNOWN;
@@ -21,6 +21,8 @@
 #ifndef PCBNEW_JOBS_HANDLER_H
 #define PCBNEW_JOBS_HANDLER_H
 
+#include <map>
+
 #include <jobs/job_dispatcher.h>
 #include <pcb_plot_params.h>
 
@@ -61,6 +63,7 @@ public:
 
 private:
     BOARD* getBoard( const wxString& aPath = wxEmptyString );
+    BOARD* loadCachedBoard( const wxString& aPath );
     LSEQ convertLayerArg( wxString& aLayerString, BOARD* aBoard ) const;
 
     void populateGerberPlotOptionsFromJob( PCB_PLOT_PARAMS&  aPlotOpts,
@@ -75,7 +78,10 @@ private:
 
     TOOL_MANAGER* getToolManager( BOARD* aBrd );
 
-    BOARD* m_cliBoard;
+    /// Boards already parsed in this session, keyed by file path; a jobset runs many
+    /// jobs against the same board and reparsing it for each one is pure overhead
+    std::map<wxString, BOARD*> m_cliBoards;
+
     std::unique_ptr<TOOL_MANAGER> m_toolManager;
 };
 
@@ -794,11 +794,15 @@ void BRDITEMS_PLOTTER::PlotText( const EDA_TEXT* aText, PCB_LAYER_ID aLayer, boo
         SHAPE_POLY_SET  finalPoly;
 
         if( const PCB_TEXT* text = dynamic_cast<const PCB_TEXT*>( aText) )
-            text->TransformTextToPolySet( finalPoly, 0, maxError, ERROR_INSIDE );
+        {
+            // Already fractured; shared with the painter and the DRC engine.
+            finalPoly = text->GetKnockoutCache( font, shownText, maxError );
+        }
         else if( const PCB_TEXTBOX* textbox = dynamic_cast<const PCB_TEXTBOX*>( aText ) )
+        {
             textbox->TransformTextToPolySet( finalPoly, 0, maxError, ERROR_INSIDE );
-
-        finalPoly.Fracture();
+            finalPoly.Fracture();
+        }
 
         for( int ii = 0; ii < finalPoly.OutlineCount(); ++ii )
             m_plotter->PlotPoly( finalPoly.Outline( ii ), FILL_T::FILLED_SHAPE, 0, getMetadata() );
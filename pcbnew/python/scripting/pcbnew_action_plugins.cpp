@@ -42,6 +42,7 @@
 #include <pcb_painter.h>
 #include <wx/msgdlg.h>
 #include <wx/app.h>
+#include <unordered_set>
 #include <kiplatform/app.h>
 #include "../../scripting/python_scripting.h"
 
@@ -341,6 +342,14 @@ void PCB_EDIT_FRAME::RunActionPlugin( ACTION_PLUGIN* aActionPlugin )
     // Try do discover what was modified
     PICKED_ITEMS_LIST deletedItemsList;
 
+    // PICKED_ITEMS_LIST::ContainsItem() is a linear scan; with one lookup per board item the
+    // reconciliation below turns quadratic on large boards, so hash the pre-plugin items once.
+    std::unordered_set<EDA_ITEM*> oldItems;
+    oldItems.reserve( oldBuffer->GetCount() );
+
+    for( unsigned int i = 0; i < oldBuffer->GetCount(); i++ )
+        oldItems.insert( oldBuffer->GetPickedItem( i ) );
+
     // The list of existing items after running the action script
     const auto currItemList = currentPcb->GetItemSet();
 
@@ -369,7 +378,7 @@ void PCB_EDIT_FRAME::RunActionPlugin( ACTION_PLUGIN* aActionPlugin )
     // Find new footprints
     for( FOOTPRINT* item : currentPcb->Footprints() )
     {
-        if( !oldBuffer->ContainsItem( item ) )
+        if( !oldItems.count( item ) )
         {
             ITEM_PICKER picker( nullptr, item, UNDO_REDO::NEWITEM );
             oldBuffer->PushItem( picker );
@@ -379,7 +388,7 @@ void PCB_EDIT_FRAME::RunActionPlugin( ACTION_PLUGIN* aActionPlugin )
 
     for( PCB_TRACK* item : currentPcb->Tracks() )
     {
-        if( !oldBuffer->ContainsItem( item ) )
+        if( !oldItems.count( item ) )
         {
             ITEM_PICKER picker( nullptr, item, UNDO_REDO::NEWITEM );
             oldBuffer->PushItem( picker );
@@ -389,7 +398,7 @@ void PCB_EDIT_FRAME::RunActionPlugin( ACTION_PLUGIN* aActionPlugin )
 
     for( BOARD_ITEM* item : currentPcb->Drawings() )
     {
-        if( !oldBuffer->ContainsItem( item ) )
+        if( !oldItems.count( item ) )
         {
             ITEM_PICKER picker( nullptr, item, UNDO_REDO::NEWITEM );
             oldBuffer->PushItem( picker );
@@ -399,7 +408,7 @@ void PCB_EDIT_FRAME::RunActionPlugin( ACTION_PLUGIN* aActionPlugin )
 
     for( ZONE* zone : currentPcb->Zones() )
     {
-        if( !oldBuffer->ContainsItem( zone ) )
+        if( !oldItems.count( zone ) )
         {
             ITEM_PICKER picker( nullptr, zone, UNDO_REDO::NEWITEM );
             oldBuffer->PushItem( picker );
@@ -34,8 +34,12 @@
 
 #include <action_plugin.h>
 #include <board.h>
+#include <board_commit.h>
 #include <board_design_settings.h>
+#include <footprint.h>
+#include <pad.h>
 #include <pcb_marker.h>
+#include <pcb_track.h>
 #include <cstdlib>
 #include <drawing_sheet/ds_data_model.h>
 #include <drc/drc_engine.h>
@@ -45,6 +49,7 @@
 #include <pcb_io/pcb_io_mgr.h>
 #include <string_utils.h>
 #include <filename_resolver.h>
+#include <geometry/shape_poly_set.h>
 #include <macros.h>
 #include <pcbnew_scripting_helpers.h>
 #include <pgm_base.h>
@@ -54,6 +59,7 @@
 #include <project/project_file.h>
 #include <settings/settings_manager.h>
 #include <specctra.h>
+#include <thread_pool.h>
 #include <project/project_local_settings.h>
 #include <wildcards_and_files_ext.h>
 #include <wx/app.h>
@@ -61,6 +67,8 @@
 #include <wx/image.h>
 
 static PCB_EDIT_FRAME* s_PcbEditFrame = nullptr;
+
+static std::unique_ptr<BOARD_COMMIT> s_batchCommit;
 static SETTINGS_MANAGER* s_SettingsManager = nullptr;
 
 
@@ -82,7 +90,12 @@ void ScriptingSetPcbEditFrame( PCB_EDIT_FRAME* aPcbEditFrame )
 void ScriptingOnDestructPcbEditFrame( PCB_EDIT_FRAME* aPcbEditFrame )
 {
     if( s_PcbEditFrame == aPcbEditFrame )
+    {
         s_PcbEditFrame = nullptr;
+
+        // Any open batch edit references the frame's tool manager and cannot outlive it
+        s_batchCommit.reset();
+    }
 }
 
 
@@ -671,3 +684,212 @@ wxString GetLanguage()
     else
         return "";
 }
+
+
+std::vector<int> GetTrackEndpoints( BOARD* aBoard )
+{
+    std::vector<int> result;
+
+    if( !aBoard )
+        return result;
+
+    result.reserve( aBoard->Tracks().size() * 4 );
+
+    for( const PCB_TRACK* track : aBoard->Tracks() )
+    {
+        result.push_back( track->GetStart().x );
+        result.push_back( track->GetStart().y );
+        result.push_back( track->GetEnd().x );
+        result.push_back( track->GetEnd().y );
+    }
+
+    return result;
+}
+
+
+std::vector<int> GetTrackWidths( BOARD* aBoard )
+{
+    std::vector<int> result;
+
+    if( !aBoard )
+        return result;
+
+    result.reserve( aBoard->Tracks().size() );
+
+    for( const PCB_TRACK* track : aBoard->Tracks() )
+        result.push_back( track->GetWidth() );
+
+    return result;
+}
+
+
+std::vector<int> GetTrackNetCodes( BOARD* aBoard )
+{
+    std::vector<int> result;
+
+    if( !aBoard )
+        return result;
+
+    result.reserve( aBoard->Tracks().size() );
+
+    for( const PCB_TRACK* track : aBoard->Tracks() )
+        result.push_back( track->GetNetCode() );
+
+    return result;
+}
+
+
+std::vector<int> GetPadPositions( BOARD* aBoard )
+{
+    std::vector<int> result;
+
+    if( !aBoard )
+        return result;
+
+    for( const FOOTPRINT* footprint : aBoard->Footprints() )
+    {
+        for( const PAD* pad : footprint->Pads() )
+        {
+            result.push_back( pad->GetPosition().x );
+            result.push_back( pad->GetPosition().y );
+        }
+    }
+
+    return result;
+}
+
+
+std::vector<int> GetPadNetCodes( BOARD* aBoard )
+{
+    std::vector<int> result;
+
+    if( !aBoard )
+        return result;
+
+    for( const FOOTPRINT* footprint : aBoard->Footprints() )
+    {
+        for( const PAD* pad : footprint->Pads() )
+            result.push_back( pad->GetNetCode() );
+    }
+
+    return result;
+}
+
+
+bool BeginBatchEdit()
+{
+    if( !s_PcbEditFrame || s_batchCommit )
+        return false;
+
+    s_batchCommit = std::make_unique<BOARD_COMMIT>( s_PcbEditFrame->GetToolManager() );
+    return true;
+}
+
+
+bool BatchAddItem( BOARD_ITEM* aItem )
+{
+    if( !s_batchCommit || !aItem )
+        return false;
+
+    s_batchCommit->Add( aItem );
+    return true;
+}
+
+
+bool BatchModifyItem( BOARD_ITEM* aItem )
+{
+    if( !s_batchCommit || !aItem )
+        return false;
+
+    s_batchCommit->Modify( aItem );
+    return true;
+}
+
+
+bool BatchRemoveItem( BOARD_ITEM* aItem )
+{
+    if( !s_batchCommit || !aItem )
+        return false;
+
+    s_batchCommit->Remove( aItem );
+    return true;
+}
+
+
+bool EndBatchEdit( const wxString& aMessage )
+{
+    if( !s_batchCommit )
+        return false;
+
+    // One Push() applies every staged change and triggers a single connectivity rebuild and
+    // view refresh, no matter how many items were staged.
+    s_batchCommit->Push( aMessage );
+    s_batchCommit.reset();
+    return true;
+}
+
+
+bool AbortBatchEdit()
+{
+    if( !s_batchCommit )
+        return false;
+
+    s_batchCommit->Revert();
+    s_batchCommit.reset();
+    return true;
+}
+
+
+std::vector<int> CollideShapes( const std::vector<SHAPE_POLY_SET*>& aShapes,
+                                SHAPE_POLY_SET* aAgainst, int aClearance )
+{
+    std::vector<int> result( aShapes.size(), 0 );
+
+    if( !aAgainst )
+        return result;
+
+    // Colliding against an untriangulated target would make every worker race to build the
+    // target's triangulation cache, so build it once up front.
+    aAgainst->CacheTriangulation( false );
+
+    thread_pool& tp = GetKiCadThreadPool();
+
+    tp.submit_loop( 0, aShapes.size(),
+            [&]( size_t i )
+            {
+                if( aShapes[i] )
+                    result[i] = aShapes[i]->Collide( aAgainst, aClearance ) ? 1 : 0;
+            } ).wait();
+
+    return result;
+}
+
+
+void InflateShapes( const std::vector<SHAPE_POLY_SET*>& aShapes, int aAmount, int aMaxError )
+{
+    thread_pool& tp = GetKiCadThreadPool();
+
+    tp.submit_loop( 0, aShapes.size(),
+            [&]( size_t i )
+            {
+                if( aShapes[i] )
+                    aShapes[i]->Inflate( aAmount, CORNER_STRATEGY::ROUND_ALL_CORNERS, aMaxError );
+            } ).wait();
+}
+
+
+std::vector<double> ShapeAreas( const std::vector<SHAPE_POLY_SET*>& aShapes )
+{
+    std::vector<double> result( aShapes.size(), 0.0 );
+
+    thread_pool& tp = GetKiCadThreadPool();
+
+    tp.submit_loop( 0, aShapes.size(),
+            [&]( size_t i )
+            {
+                if( aShapes[i] )
+                    result[i] = aShapes[i]->Area();
+            } ).wait();
+
+    return result;
+}
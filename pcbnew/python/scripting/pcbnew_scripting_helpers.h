@@ -26,6 +26,7 @@
 #define __PCBNEW_SCRIPTING_HELPERS_H
 
 #include <deque>
+#include <vector>
 #include <pcb_io/pcb_io_mgr.h>
 #include <layer_ids.h>
 
@@ -33,6 +34,7 @@ class PCB_EDIT_FRAME;
 class BOARD;
 class SETTINGS_MANAGER;
 class BOARD_ITEM;
+class SHAPE_POLY_SET;
 enum class EDA_UNITS;
 enum PCB_LAYER_ID : int;
 
@@ -261,4 +263,124 @@ bool WriteDRCReport( BOARD* aBoard, const wxString& aFileName, EDA_UNITS aUnits,
  */
 wxString GetLanguage();
 
+/*
+ * Bulk accessors: each call returns one flat array covering every item of the given kind, so
+ * analysis scripts iterate plain numeric containers instead of making per-item getter calls
+ * across the Python / C++ boundary.  All coordinates are in internal units.
+ */
+
+/**
+ * Return the endpoints of every track, arc and via as a flat [x1, y1, x2, y2, ...] array,
+ * in board Tracks() order.  Vias report their position for both endpoints.
+ *
+ * @param aBoard is a valid loaded board.
+ */
+std::vector<int> GetTrackEndpoints( BOARD* aBoard );
+
+/**
+ * Return the width of every track, arc and via, in board Tracks() order.
+ *
+ * @param aBoard is a valid loaded board.
+ */
+std::vector<int> GetTrackWidths( BOARD* aBoard );
+
+/**
+ * Return the net code of every track, arc and via, in board Tracks() order.
+ *
+ * @param aBoard is a valid loaded board.
+ */
+std::vector<int> GetTrackNetCodes( BOARD* aBoard );
+
+/**
+ * Return the position of every pad as a flat [x, y, ...] array, iterating footprints and their
+ * pads in board order.
+ *
+ * @param aBoard is a valid loaded board.
+ */
+std::vector<int> GetPadPositions( BOARD* aBoard );
+
+/**
+ * Return the net code of every pad, in the same order as GetPadPositions().
+ *
+ * @param aBoard is a valid loaded board.
+ */
+std::vector<int> GetPadNetCodes( BOARD* aBoard );
+
+/*
+ * Batch edit support: scripts that create, modify or delete many items one call at a time pay
+ * for a connectivity rebuild and view refresh per step.  Opening a batch stages all changes in
+ * a single BOARD_COMMIT, which is pushed with one consolidated refresh by EndBatchEdit().
+ */
+
+/**
+ * Open a batch edit on the board in the current editor frame.
+ *
+ * @return true if a batch was opened; false when no editor frame is running or a batch is
+ *         already open.
+ */
+bool BeginBatchEdit();
+
+/**
+ * Stage a new item for addition to the board.  The item appears when the batch is closed.
+ */
+bool BatchAddItem( BOARD_ITEM* aItem );
+
+/**
+ * Stage an item that is about to be modified.  Must be called before changing the item, so
+ * the batch can snapshot its current state for undo.
+ */
+bool BatchModifyItem( BOARD_ITEM* aItem );
+
+/**
+ * Stage an item for removal from the board.  The item disappears when the batch is closed.
+ */
+bool BatchRemoveItem( BOARD_ITEM* aItem );
+
+/**
+ * Close the current batch edit, pushing the staged changes as one undoable commit with a
+ * single connectivity rebuild and view refresh.
+ *
+ * @param aMessage is the undo list description for the commit.
+ * @return true if a batch was open and has been committed.
+ */
+bool EndBatchEdit( const wxString& aMessage = wxT( "Scripted batch edit" ) );
+
+/**
+ * Abandon the current batch edit, reverting any staged changes.
+ */
+bool AbortBatchEdit();
+
+/*
+ * Batch geometry operations: one call processes a whole list of polygon sets on the thread
+ * pool, so scripted DFM checks use all cores instead of paying a Python call per polygon.
+ */
+
+/**
+ * Test every polygon set in a list for collision against a single target.
+ *
+ * @param aShapes is the list of polygon sets to test.
+ * @param aAgainst is the polygon set to collide each entry with.
+ * @param aClearance is the collision clearance in internal units.
+ * @return one entry per input: 1 on collision, 0 otherwise.
+ */
+std::vector<int> CollideShapes( const std::vector<SHAPE_POLY_SET*>& aShapes,
+                                SHAPE_POLY_SET* aAgainst, int aClearance );
+
+/**
+ * Inflate (or deflate, with a negative amount) every polygon set in a list in place.
+ *
+ * @param aShapes is the list of polygon sets to offset.
+ * @param aAmount is the offset distance in internal units.
+ * @param aMaxError is the allowable deviation when rounding corners.
+ */
+void InflateShapes( const std::vector<SHAPE_POLY_SET*>& aShapes, int aAmount, int aMaxError );
+
+/**
+ * Compute the area of every polygon set in a list.
+ *
+ * @param aShapes is the list of polygon sets to measure.
+ * @return one entry per input: the area in internal units squared, holes subtracted.
+ */
+std::vector<double> ShapeAreas( const std::vector<SHAPE_POLY_SET*>& aShapes );
+
 #endif      // __PCBNEW_SCRIPTING_HELPERS_H
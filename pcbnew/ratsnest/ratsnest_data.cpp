@@ -42,8 +42,12 @@ using namespace std::placeholders;
 #include <cassert>
 #include <limits>
 
+#include <hash.h>
+
 #include <delaunator.hpp>
 
+#include <geometry/point_kdtree.h>
+
 class disjoint_set
 {
 
@@ -279,12 +283,40 @@ public:
 };
 
 
-RN_NET::RN_NET() : m_dirty( true )
+RN_NET::RN_NET() :
+        m_dirty( true ),
+        m_topologyHash( 0 ),
+        m_cachedTopologyHash( 0 )
 {
     m_triangulator.reset( new TRIANGULATOR_STATE );
 }
 
 
+std::size_t RN_NET::topologyHash() const
+{
+    std::size_t seed = m_nodes.size();
+
+    // m_nodes is ordered by position, so the hash is stable across rebuilds.  Including the
+    // parent item guards against an anchor being replaced by a different item at the same
+    // location.
+    for( const std::shared_ptr<CN_ANCHOR>& node : m_nodes )
+        hash_combine( seed, node->Pos().x, node->Pos().y, node->Parent() );
+
+    // The board edges encode the cluster grouping (they chain the anchors of each cluster),
+    // so a connectivity change with identical anchor positions still changes the hash.
+    for( const CN_EDGE& edge : m_boardEdges )
+    {
+        if( const std::shared_ptr<const CN_ANCHOR>& src = edge.GetSourceNode() )
+            hash_combine( seed, src->Pos().x, src->Pos().y );
+
+        if( const std::shared_ptr<const CN_ANCHOR>& tgt = edge.GetTargetNode() )
+            hash_combine( seed, tgt->Pos().x, tgt->Pos().y );
+    }
+
+    return seed;
+}
+
+
 void RN_NET::compute()
 {
     // Special cases do not need complicated algorithms (actually, it does not work well with
@@ -539,7 +571,22 @@ void RN_NET::OptimizeRNEdges()
 
 void RN_NET::UpdateNet()
 {
-    compute();
+    std::size_t hash = topologyHash();
+
+    if( hash != 0 && hash == m_cachedTopologyHash && m_nodes.size() > 2 )
+    {
+        // The anchors and their cluster grouping are unchanged since the last computation,
+        // so the cached triangulation/MST result is still valid.
+        m_rnEdges = std::move( m_cachedRnEdges );
+    }
+    else
+    {
+        compute();
+    }
+
+    m_topologyHash = hash;
+    m_cachedRnEdges.clear();
+    m_cachedTopologyHash = 0;
 
     m_dirty = false;
 }
@@ -566,6 +613,12 @@ void RN_NET::RemoveInvalidRefs()
 
 void RN_NET::Clear()
 {
+    // Keep the last computed edges around: if the anchors turn out not to have moved,
+    // UpdateNet() can reuse them instead of re-triangulating.
+    m_cachedRnEdges = std::move( m_rnEdges );
+    m_cachedTopologyHash = m_topologyHash;
+    m_topologyHash = 0;
+
     m_rnEdges.clear();
     m_boardEdges.clear();
     m_nodes.clear();
@@ -627,6 +680,48 @@ bool RN_NET::NearestBicoloredPair( RN_NET* aOtherNet, VECTOR2I& aPos1, VECTOR2I&
                 }
             };
 
+    /// On high-fanout nets the x-ordered sweep below degenerates: many anchors share
+    /// nearly the same x coordinate, so the primary-sort cutoff stops pruning.  Above a
+    /// modest node count, answer the queries from a kd-tree over our anchors instead;
+    /// below it, building the tree costs more than the sweep saves.
+    constexpr size_t KDTREE_THRESHOLD = 64;
+
+    if( m_nodes.size() >= KDTREE_THRESHOLD )
+    {
+        std::vector<VECTOR2I> points;
+        points.reserve( m_nodes.size() );
+
+        for( const std::shared_ptr<CN_ANCHOR>& node : m_nodes )
+        {
+            if( !node->GetNoLine() )
+                points.push_back( node->Pos() );
+        }
+
+        if( points.empty() )
+            return false;
+
+        POINT_KDTREE tree( std::move( points ) );
+
+        for( const std::shared_ptr<CN_ANCHOR>& nodeA : aOtherNet->m_nodes )
+        {
+            if( nodeA->GetNoLine() )
+                continue;
+
+            size_t  index;
+            int64_t dist_sq;
+
+            if( tree.NearestPoint( nodeA->Pos(), index, dist_sq ) && dist_sq < distMax_sq )
+            {
+                rv         = true;
+                distMax_sq = dist_sq;
+                aPos1      = nodeA->Pos();
+                aPos2      = tree.Point( index );
+            }
+        }
+
+        return rv;
+    }
+
     /// Sweep-line algorithm to cut the number of comparisons to find the closest point
     ///
     /// Step 1: The outer loop needs to be the subset (selected nodes) as it is a linear search
@@ -123,6 +123,10 @@ protected:
     ///< Recompute ratsnest from scratch.
     void compute();
 
+    ///< Hash of the current anchor set and its cluster grouping; used to detect nets whose
+    ///< anchors didn't actually move so the previous triangulation/MST can be reused.
+    std::size_t topologyHash() const;
+
     ///< Compute the minimum spanning tree using Kruskal's algorithm
     void kruskalMST( const std::vector<CN_EDGE> &aEdges );
 
@@ -139,6 +143,14 @@ protected:
     ///< Flag indicating necessity of recalculation of ratsnest for a net.
     bool m_dirty;
 
+    ///< Hash of the anchor topology m_rnEdges was computed from (0 = never computed).
+    std::size_t m_topologyHash;
+
+    ///< Result of the previous computation, kept across Clear() so that UpdateNet() can
+    ///< reuse it when the anchor topology is unchanged.
+    std::vector<CN_EDGE> m_cachedRnEdges;
+    std::size_t          m_cachedTopologyHash;
+
     class TRIANGULATOR_STATE;
 
     std::shared_ptr<TRIANGULATOR_STATE> m_triangulator;
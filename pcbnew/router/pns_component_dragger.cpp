@@ -20,6 +20,7 @@
  */
 
 #include <memory>
+#include <unordered_map>
 
 #include "pns_arc.h"
 #include "pns_line.h"
@@ -37,6 +38,7 @@ COMPONENT_DRAGGER::COMPONENT_DRAGGER( ROUTER* aRouter ) : DRAG_ALGO( aRouter )
     // ensure all variables are initialized
     m_dragStatus = false;
     m_currentNode = nullptr;
+    m_workingSetValid = false;
 }
 
 
@@ -53,6 +55,47 @@ bool COMPONENT_DRAGGER::Start( const VECTOR2I& aP, ITEM_SET& aPrimitives )
     m_initialDraggedItems = aPrimitives;
     m_p0                  = aP;
 
+    m_workingSet.clear();
+    m_draggedSourceItems.clear();
+    m_workingSetValid = false;
+    m_itemsExtent = BOX2I();
+    m_connsExtent = BOX2I();
+
+    // Pre-pass: compute the hull bboxes and the overall extent of the dragged solids, so
+    // the joint gathering below can be done with a single query over the whole component
+    // instead of one full joint-map scan per pad (prohibitive on large BGAs).
+    std::unordered_map<SOLID*, BOX2I> hullBBoxes;
+    bool                              haveExtent = false;
+
+    for( ITEM* item : aPrimitives.Items() )
+    {
+        if( item->Kind() != ITEM::SOLID_T )
+            continue;
+
+        SOLID* solid = static_cast<SOLID*>( item );
+        BOX2I  bb = solid->Hull().BBox();
+
+        hullBBoxes[solid] = bb;
+
+        if( !haveExtent )
+        {
+            m_itemsExtent = bb;
+            haveExtent = true;
+        }
+        else
+        {
+            m_itemsExtent.Merge( bb );
+        }
+    }
+
+    std::vector<JOINT*> workingJoints;
+
+    if( haveExtent )
+    {
+        m_world->QueryJoints( m_itemsExtent, workingJoints, PNS_LAYER_RANGE::All(),
+                              ITEM::SEGMENT_T | ITEM::ARC_T );
+    }
+
     std::unordered_set<LINKED_ITEM*> seenItems;
 
     auto addLinked =
@@ -132,13 +175,16 @@ bool COMPONENT_DRAGGER::Start( const VECTOR2I& aP, ITEM_SET& aPrimitives )
                 addLinked( solid, jt, static_cast<LINKED_ITEM*>( link ) );
         }
 
-        std::vector<JOINT*> extraJoints;
-
-        m_world->QueryJoints( solid->Hull().BBox(), extraJoints, solid->Layers(),
-                              ITEM::SEGMENT_T | ITEM::ARC_T );
+        const BOX2I& hullBB = hullBBoxes[solid];
 
-        for( JOINT* extraJoint : extraJoints )
+        for( JOINT* extraJoint : workingJoints )
         {
+            if( !hullBB.Contains( extraJoint->Pos() ) )
+                continue;
+
+            if( !extraJoint->Layers().Overlaps( solid->Layers() ) )
+                continue;
+
             if( extraJoint->Net() == jt->Net() && extraJoint->LinkCount() == 1 )
             {
                 LINKED_ITEM* li = static_cast<LINKED_ITEM*>( extraJoint->LinkList().front() );
@@ -149,14 +195,124 @@ bool COMPONENT_DRAGGER::Start( const VECTOR2I& aP, ITEM_SET& aPrimitives )
         }
     }
 
+    // Everything that moves with the drag; these are never obstacles.
+    for( ITEM* item : aPrimitives.Items() )
+        m_draggedSourceItems.insert( item );
+
+    for( ITEM* item : m_fixedItems )
+        m_draggedSourceItems.insert( item );
+
+    bool firstConn = true;
+
+    for( const DRAGGED_CONNECTION& cn : m_conns )
+    {
+        for( ITEM* link : cn.origLine.Links() )
+            m_draggedSourceItems.insert( link );
+
+        if( firstConn )
+        {
+            m_connsExtent = cn.origLine.CLine().BBox();
+            firstConn = false;
+        }
+        else
+        {
+            m_connsExtent.Merge( cn.origLine.CLine().BBox() );
+        }
+    }
+
     return true;
 }
 
 
+void COMPONENT_DRAGGER::updateWorkingSet( const VECTOR2I& aP )
+{
+    if( m_solids.empty() )
+        return;
+
+    // The dragged geometry fits in the solids' extent at the current position plus the
+    // extent of the original attached lines (their far ends stay anchored to the world).
+    BOX2I current = m_itemsExtent;
+    current.Move( aP - m_p0 );
+
+    if( !m_conns.empty() )
+        current.Merge( m_connsExtent );
+
+    current.Inflate( m_world->GetMaxClearance() );
+
+    if( m_workingSetValid && m_workingSetRegion.Contains( current ) )
+        return;
+
+    // Gather a region comfortably larger than needed, so that small cursor moves keep
+    // reusing the cached set.
+    BOX2I region = current;
+    region.Inflate( std::max( current.GetWidth(), current.GetHeight() ) / 2 );
+
+    m_workingSet.clear();
+    m_world->QueryItemsInBox( region, m_workingSet );
+
+    std::erase_if( m_workingSet,
+                   [&]( ITEM* item )
+                   {
+                       return m_draggedSourceItems.count( item ) > 0;
+                   } );
+
+    m_workingSetItemsBBox = BOX2I();
+    bool first = true;
+
+    for( ITEM* item : m_workingSet )
+    {
+        if( const SHAPE* shape = item->Shape( item->Layer() ) )
+        {
+            if( first )
+            {
+                m_workingSetItemsBBox = shape->BBox();
+                first = false;
+            }
+            else
+            {
+                m_workingSetItemsBBox.Merge( shape->BBox() );
+            }
+        }
+    }
+
+    m_workingSetRegion = region;
+    m_workingSetValid = true;
+}
+
+
+bool COMPONENT_DRAGGER::draggedItemsCollide( NODE* aNode )
+{
+    if( m_workingSetValid && m_workingSet.empty() )
+        return false;
+
+    int clearance = m_world->GetMaxClearance();
+
+    for( ITEM* item : m_draggedItems.Items() )
+    {
+        const SHAPE* shape = item->Shape( item->Layer() );
+
+        // Items that can't reach any member of the working set can't collide; this skips
+        // the interior pads of a large BGA entirely.
+        if( shape && m_workingSetValid
+                && !m_workingSetItemsBBox.Intersects( shape->BBox().GetInflated( clearance ) ) )
+        {
+            continue;
+        }
+
+        if( aNode->CheckColliding( item ) )
+            return true;
+    }
+
+    return false;
+}
+
+
 bool COMPONENT_DRAGGER::Drag( const VECTOR2I& aP )
 {
     assert( m_world );
 
+    updateWorkingSet( aP );
+
     m_world->KillChildren();
     m_currentNode = m_world->Branch();
 
@@ -250,7 +406,7 @@ bool COMPONENT_DRAGGER::FixRoute( bool aForceCommit )
 
     if( node )
     {
-        if( Settings().AllowDRCViolations() || aForceCommit || !node->CheckColliding( m_draggedItems ) )
+        if( Settings().AllowDRCViolations() || aForceCommit || !draggedItemsCollide( node ) )
         {
             Router()->CommitRouting( node );
             return true;
@@ -125,6 +125,15 @@ private:
         VECTOR2I offset;
     };
 
+    /**
+     * Rebuild the spatially pruned working set if the drag has moved outside the region it
+     * was gathered for.  Small cursor moves reuse the cached set.
+     */
+    void updateWorkingSet( const VECTOR2I& aP );
+
+    ///< Check the dragged items against the working set (instead of the whole world).
+    bool draggedItemsCollide( NODE* aNode );
+
     std::set<SOLID*>                m_solids;       // Pads being dragged
     std::set<ITEM*>                 m_fixedItems;   // Items being moved along with pads
     std::vector<DRAGGED_CONNECTION> m_conns;        // Lines being dragged with pads
@@ -134,6 +143,14 @@ private:
     ITEM_SET m_initialDraggedItems;
     NODE*    m_currentNode;
     VECTOR2I m_p0;
+
+    std::set<ITEM*>    m_draggedSourceItems;   // World items that move with the drag
+    std::vector<ITEM*> m_workingSet;           // World items within the swept region
+    BOX2I              m_workingSetRegion;     // Region the working set was gathered for
+    BOX2I              m_workingSetItemsBBox;  // Union bbox of the working set items
+    BOX2I              m_itemsExtent;          // Dragged solids' extent at the start position
+    BOX2I              m_connsExtent;          // Extent of the attached (dragged) lines
+    bool               m_workingSetValid;
 };
 
 }; // namespace PNS
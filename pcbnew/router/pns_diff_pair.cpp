@@ -25,9 +25,13 @@
 #include <limits>
 
 #include <algorithm>
+#include <optional>
+#include <set>
 
 #include <geometry/shape_rect.h>
 
+#include <thread_pool.h>
+
 #include "pns_diff_pair.h"
 #include "pns_router.h"
 
@@ -336,10 +340,20 @@ void DP_GATEWAYS::BuildOrthoProjections( DP_GATEWAYS& aEntries, const VECTOR2I&
 bool DP_GATEWAYS::FitGateways( DP_GATEWAYS& aEntry, DP_GATEWAYS& aTarget, bool aPrefDiagonal,
                                DIFF_PAIR& aDp )
 {
-    DP_CANDIDATE best;
-
-    int bestScore = -1000;
-    bool found = false;
+    struct CANDIDATE
+    {
+        const DP_GATEWAY* entry;
+        const DP_GATEWAY* target;
+        bool              preferred;
+        int               score;
+    };
+
+    // Gather all entry/target combinations up front, keyed by score.  A candidate's score
+    // depends only on the gateway priorities, so the groups can be tried from the best
+    // score down and the search stopped at the first group with a feasible fit; within a
+    // group the last candidate in enumeration order wins, matching the original scan.
+    std::vector<CANDIDATE> candidates;
+    candidates.reserve( aEntry.Gateways().size() * aTarget.Gateways().size() * 2 );
 
     for( const DP_GATEWAY& g_entry : aEntry.Gateways() )
     {
@@ -351,29 +365,66 @@ bool DP_GATEWAYS::FitGateways( DP_GATEWAYS& aEntry, DP_GATEWAYS& aTarget, bool a
                 score += g_entry.Priority();
                 score += g_target.Priority();
 
-                if( score >= bestScore )
-                {
-                    DIFF_PAIR l( m_gap );
-
-                    if( l.BuildInitial( g_entry, g_target, preferred ? aPrefDiagonal
-                                                                     : !aPrefDiagonal ) )
-                    {
-                        best.p = l.CP();
-                        best.n = l.CN();
-                        bestScore = score;
-                        found = true;
-                    }
-                }
+                candidates.push_back( { &g_entry, &g_target, preferred, score } );
             }
         }
     }
 
+    std::set<int, std::greater<int>> scores;
 
-    if( found )
+    for( const CANDIDATE& c : candidates )
+        scores.insert( c.score );
+
+    // BuildInitial() is pure geometry, so a score group can be evaluated on the thread
+    // pool; BGA escapes easily produce hundreds of combinations per cursor move.
+    constexpr size_t PARALLEL_THRESHOLD = 16;
+
+    for( int score : scores )
     {
-        aDp.SetGap( m_gap );
-        aDp.SetShape( best.p, best.n );
-        return true;
+        std::vector<size_t> group;
+
+        for( size_t ii = 0; ii < candidates.size(); ++ii )
+        {
+            if( candidates[ii].score == score )
+                group.push_back( ii );
+        }
+
+        std::vector<std::optional<std::pair<SHAPE_LINE_CHAIN, SHAPE_LINE_CHAIN>>>
+                results( group.size() );
+
+        auto evaluate =
+                [&]( size_t aIdx )
+                {
+                    const CANDIDATE& c = candidates[ group[aIdx] ];
+                    DIFF_PAIR        l( m_gap );
+
+                    if( l.BuildInitial( *c.entry, *c.target,
+                                        c.preferred ? aPrefDiagonal : !aPrefDiagonal ) )
+                    {
+                        results[aIdx] = std::make_pair( l.CP(), l.CN() );
+                    }
+                };
+
+        if( group.size() >= PARALLEL_THRESHOLD )
+        {
+            thread_pool& tp = GetKiCadThreadPool();
+            tp.submit_loop( 0, group.size(), evaluate, TP_PRIORITY_INTERACTIVE ).wait();
+        }
+        else
+        {
+            for( size_t ii = 0; ii < group.size(); ++ii )
+                evaluate( ii );
+        }
+
+        for( auto it = results.rbegin(); it != results.rend(); ++it )
+        {
+            if( it->has_value() )
+            {
+                aDp.SetGap( m_gap );
+                aDp.SetShape( ( *it )->first, ( *it )->second );
+                return true;
+            }
+        }
     }
 
     return false;
@@ -131,6 +131,9 @@ bool DP_MEANDER_PLACER::Start( const VECTOR2I& aP, ITEM* aStartItem )
     m_tunedPathN = topo.AssembleTuningPath( Router()->GetInterface(), m_originPair.NLine().GetLink( 0 ), &m_startPad_n,
                                             &m_endPad_n );
 
+    m_cachedOrigLength.reset();
+    m_cachedOrigDelay.reset();
+
     m_padToDieLengthN = 0;
     m_padToDieDelayN = 0;
 
@@ -167,17 +170,27 @@ void DP_MEANDER_PLACER::release()
 
 long long int DP_MEANDER_PLACER::origPathLength() const
 {
+    if( m_cachedOrigLength )
+        return *m_cachedOrigLength;
+
     long long int totalP = m_padToDieLengthP + lineLength( m_tunedPathP, m_startPad_p, m_endPad_p );
     long long int totalN = m_padToDieLengthN + lineLength( m_tunedPathN, m_startPad_n, m_endPad_n );
-    return std::max( totalP, totalN );
+
+    m_cachedOrigLength = std::max( totalP, totalN );
+    return *m_cachedOrigLength;
 }
 
 
 int64_t DP_MEANDER_PLACER::origPathDelay() const
 {
+    if( m_cachedOrigDelay )
+        return *m_cachedOrigDelay;
+
     const int64_t totalP = m_padToDieDelayP + lineDelay( m_tunedPathP, m_startPad_p, m_endPad_p );
     const int64_t totalN = m_padToDieDelayP + lineDelay( m_tunedPathN, m_startPad_n, m_endPad_n );
-    return std::max( totalP, totalN );
+
+    m_cachedOrigDelay = std::max( totalP, totalN );
+    return *m_cachedOrigDelay;
 }
 
 
@@ -28,6 +28,8 @@
 #include <geometry/shape.h>
 #include <geometry/shape_line_chain.h>
 
+#include <optional>
+
 #include "pns_node.h"
 #include "pns_via.h"
 #include "pns_line.h"
@@ -136,6 +138,11 @@ private:
 
     int64_t origPathDelay() const;
 
+    ///< See MEANDER_PLACER: the tuned paths don't change during a drag, so their baseline
+    ///< length/delay are computed once per Start().
+    mutable std::optional<long long int> m_cachedOrigLength;
+    mutable std::optional<int64_t>       m_cachedOrigDelay;
+
     void calculateTimeDomainTargets();
 
     ///< Current routing start point (end of tail, beginning of head).
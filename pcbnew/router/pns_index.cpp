@@ -25,6 +25,96 @@
 namespace PNS {
 
 
+void INDEX_LAYER_SNAPSHOT::Build( const std::unordered_set<ITEM*>& aItems )
+{
+    std::vector<ENTRY> entries;
+    entries.reserve( aItems.size() );
+
+    bool first = true;
+
+    for( ITEM* item : aItems )
+    {
+        const PNS_LAYER_RANGE& layers = item->Layers();
+
+        if( m_layer < layers.Start() || m_layer > layers.End() )
+            continue;
+
+        const SHAPE* shape = item->Shape( m_layer );
+
+        if( !shape )
+            continue;
+
+        BOX2I bbox = shape->BBox();
+
+        if( first )
+        {
+            m_extent = bbox;
+            first = false;
+        }
+        else
+        {
+            m_extent.Merge( bbox );
+        }
+
+        entries.push_back( { bbox, item } );
+    }
+
+    if( entries.empty() )
+        return;
+
+    int n = (int) entries.size();
+
+    m_cols = std::clamp( (int) std::sqrt( (double) n ), 1, 1024 );
+    m_rows = m_cols;
+    m_cellW = std::max<int64_t>( 1, ( (int64_t) m_extent.GetWidth() + m_cols ) / m_cols );
+    m_cellH = std::max<int64_t>( 1, ( (int64_t) m_extent.GetHeight() + m_rows ) / m_rows );
+
+    m_cells.resize( (size_t) m_cols * m_rows );
+
+    for( const ENTRY& ent : entries )
+    {
+        int x0 = cellX( ent.bbox.GetX() );
+        int x1 = cellX( ent.bbox.GetRight() );
+        int y0 = cellY( ent.bbox.GetY() );
+        int y1 = cellY( ent.bbox.GetBottom() );
+
+        // Entries covering many cells would be duplicated all over the grid; keep them in
+        // a short linear list instead.
+        if( (int64_t) ( x1 - x0 + 1 ) * ( y1 - y0 + 1 ) > 64 )
+        {
+            m_large.push_back( ent );
+            continue;
+        }
+
+        for( int cy = y0; cy <= y1; ++cy )
+        {
+            for( int cx = x0; cx <= x1; ++cx )
+                m_cells[ cy * m_cols + cx ].push_back( ent );
+        }
+    }
+}
+
+
+INDEX_LAYER_SNAPSHOT* INDEX::snapshotForLayer( std::size_t aIndex ) const
+{
+    if( m_allItems.size() < SNAPSHOT_THRESHOLD )
+        return nullptr;
+
+    std::lock_guard<std::mutex> lock( m_snapshotMutex );
+
+    if( m_snapshots.size() <= aIndex )
+        m_snapshots.resize( aIndex + 1 );
+
+    if( !m_snapshots[aIndex] )
+    {
+        m_snapshots[aIndex] = std::make_unique<INDEX_LAYER_SNAPSHOT>( (int) aIndex );
+        m_snapshots[aIndex]->Build( m_allItems );
+    }
+
+    return m_snapshots[aIndex].get();
+}
+
+
 void INDEX::Add( ITEM* aItem )
 {
     const PNS_LAYER_RANGE& range = aItem->Layers();
@@ -39,6 +129,9 @@ void INDEX::Add( ITEM* aItem )
     for( int i = range.Start(); i <= range.End(); ++i )
         m_subIndices[i]->Add( aItem );
 
+    m_generation++;
+    invalidateSnapshots();
+
     m_allItems.insert( aItem );
     NET_HANDLE net = aItem->Net();
 
@@ -58,6 +151,9 @@ void INDEX::Remove( ITEM* aItem )
     for( int i = range.Start(); i <= range.End(); ++i )
         m_subIndices[i]->Remove( aItem );
 
+    m_generation++;
+    invalidateSnapshots();
+
     m_allItems.erase( aItem );
     NET_HANDLE net = aItem->Net();
 
@@ -22,10 +22,14 @@
 #ifndef __PNS_INDEX_H
 #define __PNS_INDEX_H
 
+#include <algorithm>
+#include <cmath>
 #include <deque>
 #include <list>
 #include <map>
+#include <mutex>
 #include <unordered_set>
+#include <vector>
 
 #include <layer_ids.h>
 #include <geometry/shape_index.h>
@@ -35,6 +39,169 @@
 
 namespace PNS {
 
+/**
+ * INDEX_LAYER_SNAPSHOT
+ *
+ * Immutable, read-optimized view of a single layer of the INDEX: a flat uniform grid of
+ * (bbox, item) entries in contiguous storage.  Walkaround/shove candidate queries during a
+ * drag hit the same index thousands of times while it doesn't change (mutations during the
+ * move go to the child NODE's own index), so the snapshot is built lazily on first query
+ * and thrown away on any mutation.  Queries walk plain arrays with no tree recursion and
+ * no indirect calls; once built, the snapshot is immutable and thus safe to query from the
+ * worker threads LINE_PLACER uses for candidate evaluation.
+ **/
+class INDEX_LAYER_SNAPSHOT
+{
+public:
+    ///< (bbox, item) candidate record, shared with the R-tree bulk query so both paths
+    ///< fill the same caller-owned buffers.
+    using ENTRY = SHAPE_INDEX<ITEM*>::ENTRY;
+
+    INDEX_LAYER_SNAPSHOT( int aLayer ) :
+        m_layer( aLayer ),
+        m_cols( 0 ),
+        m_rows( 0 ),
+        m_cellW( 1 ),
+        m_cellH( 1 )
+    {}
+
+    /**
+     * Populates the grid from all items of the parent index spanning this layer.
+     */
+    void Build( const std::unordered_set<ITEM*>& aItems );
+
+    template<class Visitor>
+    int Query( const SHAPE* aShape, int aMinDistance, Visitor& aVisitor ) const
+    {
+        int found = 0;
+
+        BOX2I box = aShape->BBox();
+        box.Inflate( aMinDistance );
+
+        // Items spanning many cells live in m_large and are scanned linearly; there are
+        // only a handful of them (long traces, zone islands) per layer.
+        for( const ENTRY& ent : m_large )
+        {
+            if( !ent.bbox.Intersects( box ) )
+                continue;
+
+            found++;
+
+            if( !aVisitor( ent.item ) )
+                return found;
+        }
+
+        if( m_cols == 0 || !box.Intersects( m_extent ) )
+            return found;
+
+        int qx0 = cellX( box.GetX() );
+        int qx1 = cellX( box.GetRight() );
+        int qy0 = cellY( box.GetY() );
+        int qy1 = cellY( box.GetBottom() );
+
+        for( int cy = qy0; cy <= qy1; ++cy )
+        {
+            for( int cx = qx0; cx <= qx1; ++cx )
+            {
+                for( const ENTRY& ent : m_cells[ cy * m_cols + cx ] )
+                {
+                    if( !ent.bbox.Intersects( box ) )
+                        continue;
+
+                    // Visit each entry only from the first query cell it overlaps, so
+                    // items straddling several cells aren't reported twice.
+                    if( std::max( cellX( ent.bbox.GetX() ), qx0 ) != cx )
+                        continue;
+
+                    if( std::max( cellY( ent.bbox.GetY() ), qy0 ) != cy )
+                        continue;
+
+                    found++;
+
+                    if( !aVisitor( ent.item ) )
+                        return found;
+                }
+            }
+        }
+
+        return found;
+    }
+
+    ///< Callback-free variant of Query(): appends every candidate to aOut.
+    int QueryBulk( const SHAPE* aShape, int aMinDistance, std::vector<ENTRY>& aOut ) const
+    {
+        int found = 0;
+
+        BOX2I box = aShape->BBox();
+        box.Inflate( aMinDistance );
+
+        for( const ENTRY& ent : m_large )
+        {
+            if( ent.bbox.Intersects( box ) )
+            {
+                aOut.push_back( ent );
+                found++;
+            }
+        }
+
+        if( m_cols == 0 || !box.Intersects( m_extent ) )
+            return found;
+
+        int qx0 = cellX( box.GetX() );
+        int qx1 = cellX( box.GetRight() );
+        int qy0 = cellY( box.GetY() );
+        int qy1 = cellY( box.GetBottom() );
+
+        for( int cy = qy0; cy <= qy1; ++cy )
+        {
+            for( int cx = qx0; cx <= qx1; ++cx )
+            {
+                for( const ENTRY& ent : m_cells[ cy * m_cols + cx ] )
+                {
+                    if( !ent.bbox.Intersects( box ) )
+                        continue;
+
+                    // Visit each entry only from the first query cell it overlaps, so
+                    // items straddling several cells aren't reported twice.
+                    if( std::max( cellX( ent.bbox.GetX() ), qx0 ) != cx )
+                        continue;
+
+                    if( std::max( cellY( ent.bbox.GetY() ), qy0 ) != cy )
+                        continue;
+
+                    aOut.push_back( ent );
+                    found++;
+                }
+            }
+        }
+
+        return found;
+    }
+
+private:
+    int cellX( int aX ) const
+    {
+        int64_t c = ( (int64_t) aX - m_extent.GetX() ) / m_cellW;
+        return (int) std::clamp<int64_t>( c, 0, m_cols - 1 );
+    }
+
+    int cellY( int aY ) const
+    {
+        int64_t c = ( (int64_t) aY - m_extent.GetY() ) / m_cellH;
+        return (int) std::clamp<int64_t>( c, 0, m_rows - 1 );
+    }
+
+private:
+    int                             m_layer;
+    BOX2I                           m_extent;
+    int                             m_cols;
+    int                             m_rows;
+    int64_t                         m_cellW;
+    int64_t                         m_cellH;
+    std::vector<std::vector<ENTRY>> m_cells;
+    std::vector<ENTRY>              m_large;
+};
+
 
 /**
  * INDEX
@@ -49,6 +216,7 @@ public:
     typedef std::list<ITEM*>            NET_ITEMS_LIST;
     typedef SHAPE_INDEX<ITEM*>          ITEM_SHAPE_INDEX;
     typedef std::unordered_set<ITEM*>   ITEM_SET;
+    typedef ITEM_SHAPE_INDEX::ENTRY     ENTRY;
 
     INDEX(){};
 
@@ -95,6 +263,33 @@ public:
     template<class Visitor>
     int Query( const SHAPE* aShape, int aMinDistance, Visitor& aVisitor ) const;
 
+    /**
+     * Callback-free variant of the shape query: appends every (bbox, item) candidate in
+     * proximity of aShape to a flat, caller-owned buffer.  Treats all layers as
+     * colliding; an item spanning several layers is reported once per layer subindex,
+     * so callers needing unique items must deduplicate.  The buffer is appended to, not
+     * cleared, so it can be reused across queries.
+     *
+     * @param aShape shape to search against
+     * @param aMinDistance proximity distance (wrs to the item's shape)
+     * @param aOut receives the candidate entries
+     * @return number of candidates found.
+     */
+    int QueryBulk( const SHAPE* aShape, int aMinDistance, std::vector<ENTRY>& aOut ) const
+    {
+        int total = 0;
+
+        for( std::size_t i = 0; i < m_subIndices.size(); ++i )
+        {
+            if( INDEX_LAYER_SNAPSHOT* snapshot = snapshotForLayer( i ) )
+                total += snapshot->QueryBulk( aShape, aMinDistance, aOut );
+            else
+                total += m_subIndices[i]->QueryBulk( aShape, aMinDistance, aOut );
+        }
+
+        return total;
+    }
+
     /**
      * Returns list of all items in a given net.
      */
@@ -115,6 +310,12 @@ public:
      */
     int Size() const { return m_allItems.size(); }
 
+    /**
+     * Monotonic counter bumped by every mutation; lets algorithms detect that cached
+     * results derived from this index are stale (see OPTIMIZER's collision memo).
+     */
+    uint64_t Generation() const { return m_generation; }
+
     ITEM_SET::iterator begin() { return m_allItems.begin(); }
     ITEM_SET::iterator end() { return m_allItems.end(); }
 
@@ -122,10 +323,32 @@ private:
     template <class Visitor>
     int querySingle( std::size_t aIndex, const SHAPE* aShape, int aMinDistance, Visitor& aVisitor ) const;
 
+    ///< Returns the (lazily built) read-only snapshot for a layer, or nullptr if this index
+    ///< is too small for snapshots to pay off.
+    INDEX_LAYER_SNAPSHOT* snapshotForLayer( std::size_t aIndex ) const;
+
+    ///< Thrown away on any mutation; rebuilt lazily per layer on the next query.
+    void invalidateSnapshots()
+    {
+        std::lock_guard<std::mutex> lock( m_snapshotMutex );
+
+        if( !m_snapshots.empty() )
+            m_snapshots.clear();
+    }
+
+    ///< Below this size the R-tree is queried directly; a snapshot of a tiny, frequently
+    ///< mutated child-node index would be rebuilt on nearly every query.
+    static constexpr size_t SNAPSHOT_THRESHOLD = 4096;
+
 private:
     std::deque<std::unique_ptr<ITEM_SHAPE_INDEX>> m_subIndices;
     std::map<NET_HANDLE, NET_ITEMS_LIST> m_netMap;
     ITEM_SET                             m_allItems;
+
+    uint64_t                             m_generation = 0;
+
+    mutable std::deque<std::unique_ptr<INDEX_LAYER_SNAPSHOT>> m_snapshots;
+    mutable std::mutex                                        m_snapshotMutex;
 };
 
 
@@ -136,6 +359,10 @@ int INDEX::querySingle( std::size_t aIndex, const SHAPE* aShape, int aMinDistanc
         return 0;
 
     LAYER_CONTEXT_SETTER layerContext( aVisitor, aIndex );
+
+    if( INDEX_LAYER_SNAPSHOT* snapshot = snapshotForLayer( aIndex ) )
+        return snapshot->Query( aShape, aMinDistance, aVisitor );
+
     return m_subIndices[aIndex]->Query( aShape, aMinDistance, aVisitor);
 }
 
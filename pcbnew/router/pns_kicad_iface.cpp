@@ -38,7 +38,10 @@
 #include <board_commit.h>
 #include <eda_group.h>
 #include <layer_ids.h>
+#include <mutex>
 #include <optional>
+
+#include <thread_pool.h>
 #include <kidialog.h>
 #include <tools/pcb_tool_base.h>
 #include <tool/tool_manager.h>
@@ -161,6 +164,10 @@ private:
 
     std::unordered_map<CLEARANCE_CACHE_KEY, int> m_clearanceCache;
     std::unordered_map<CLEARANCE_CACHE_KEY, int> m_tempClearanceCache;
+
+    ///< Guards the clearance caches and the dummy items used for constraint resolution;
+    ///< LINE_PLACER evaluates walkaround candidates on worker threads (see rhWalkBase()).
+    std::mutex         m_cacheMutex;
 };
 
 
@@ -499,6 +506,7 @@ void PNS_PCBNEW_RULE_RESOLVER::ClearCaches()
 
 void PNS_PCBNEW_RULE_RESOLVER::ClearTemporaryCaches()
 {
+    std::lock_guard<std::mutex> lock( m_cacheMutex );
     m_tempClearanceCache.clear();
 }
 
@@ -508,6 +516,8 @@ int PNS_PCBNEW_RULE_RESOLVER::Clearance( const PNS::ITEM* aA, const PNS::ITEM* a
 {
     CLEARANCE_CACHE_KEY key = { aA, aB, aUseClearanceEpsilon };
 
+    std::lock_guard<std::mutex> lock( m_cacheMutex );
+
     // Search cache (used for actual board items)
     auto it = m_clearanceCache.find( key );
 
@@ -1813,15 +1823,38 @@ void PNS_KICAD_IFACE_BASE::SyncWorld( PNS::NODE *aWorld )
         syncZone( aWorld, zone, boardOutline );
     }
 
+    // Converting pads to PNS solids is the costly part of the sync on big layouts (hull
+    // shapes, polygon fallbacks), so it runs on the thread pool partitioned by footprint;
+    // pads of distinct footprints share no shape caches.  The world itself is still
+    // populated serially below, as NODE::Add() maintains the joint map.
+    thread_pool& tp = GetKiCadThreadPool();
+
+    std::vector<FOOTPRINT*> footprints( m_board->Footprints().begin(),
+                                        m_board->Footprints().end() );
+    std::vector<std::vector<std::unique_ptr<PNS::SOLID>>> fpSolids( footprints.size() );
+
+    auto convertPads = tp.submit_loop( 0, footprints.size(),
+            [&]( size_t ii )
+            {
+                for( PAD* pad : footprints[ii]->Pads() )
+                {
+                    for( std::unique_ptr<PNS::SOLID>& solid : syncPad( pad ) )
+                        fpSolids[ii].push_back( std::move( solid ) );
+                }
+            }, TP_PRIORITY_INTERACTIVE );
+
+    convertPads.wait();
+
+    for( std::vector<std::unique_ptr<PNS::SOLID>>& solids : fpSolids )
+    {
+        for( std::unique_ptr<PNS::SOLID>& solid : solids )
+            aWorld->Add( std::move( solid ) );
+    }
+
     for( FOOTPRINT* footprint : m_board->Footprints() )
     {
         for( PAD* pad : footprint->Pads() )
         {
-            std::vector<std::unique_ptr<PNS::SOLID>> solids = syncPad( pad );
-
-            for( std::unique_ptr<PNS::SOLID>& solid : solids )
-                aWorld->Add( std::move( solid ) );
-
             std::optional<int> clearanceOverride = pad->GetClearanceOverrides( nullptr );
 
             if( clearanceOverride.has_value() )
@@ -19,9 +19,12 @@
  * with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <future>
 #include <optional>
 #include <memory>
 
+#include <thread_pool.h>
+
 #include "pns_arc.h"
 #include "pns_debug_decorator.h"
 #include "pns_line_placer.h"
@@ -603,11 +606,6 @@ bool LINE_PLACER::rhWalkBase( const VECTOR2I& aP, LINE& aWalkLine, int aCollisio
         WALKAROUND::RESULT wr = walkaround.Route( initTrack );
         std::optional<LINE> bestLine;
 
-        OPTIMIZER optimizer( m_currentNode );
-
-        optimizer.SetEffortLevel( OPTIMIZER::MERGE_SEGMENTS );
-        optimizer.SetCollisionMask( aCollisionMask );
-
         using WALKAROUND::WP_CW;
         using WALKAROUND::WP_CCW;
 
@@ -616,44 +614,66 @@ bool LINE_PLACER::rhWalkBase( const VECTOR2I& aP, LINE& aWalkLine, int aCollisio
         int len_ccw = wr.status[WP_CCW] != WALKAROUND::ST_STUCK ? wr.lines[WP_CCW].CLine().Length()
                                                         : std::numeric_limits<int>::max();
 
+        // Post-walkaround optimization of a candidate only reads m_currentNode, so the two
+        // variants can be refined concurrently.  Each worker gets its own OPTIMIZER; the
+        // node is not mutated until one candidate is committed.
+        auto refineCandidate =
+                [&]( LINE& aLine ) -> int
+                {
+                    LINE      tmpHead, tmpTail;
+                    OPTIMIZER optimizer( m_currentNode );
 
-        if( wr.status[ WP_CW ] == WALKAROUND::ST_DONE )
-        {
-            PNS_DBG( Dbg(), AddItem, &wr.lines[WP_CW], BLUE, 20000, wxT( "wf-result-cw-preopt" ) );
-            LINE tmpHead, tmpTail;
+                    optimizer.SetEffortLevel( OPTIMIZER::MERGE_SEGMENTS );
+                    optimizer.SetCollisionMask( aCollisionMask );
 
+                    OPTIMIZER::Optimize( &aLine, OPTIMIZER::MERGE_SEGMENTS, m_currentNode );
 
-            OPTIMIZER::Optimize( &wr.lines[WP_CW], OPTIMIZER::MERGE_SEGMENTS, m_currentNode );
+                    if( splitHeadTail( aLine, m_tail, tmpHead, tmpTail ) )
+                    {
+                        optimizer.Optimize( &tmpHead );
+                        aLine.SetShape( tmpTail.CLine () );
+                        aLine.Line().Append( tmpHead.CLine( ) );
+                    }
 
-            if( splitHeadTail( wr.lines[WP_CW], m_tail, tmpHead, tmpTail ) )
-            {
-                optimizer.Optimize( &tmpHead );
-                wr.lines[WP_CW].SetShape( tmpTail.CLine () );
-                wr.lines[WP_CW].Line().Append( tmpHead.CLine( ) );
-            }
+                    return aLine.CLine().Length();
+                };
 
-            PNS_DBG( Dbg(), AddItem, &wr.lines[WP_CW], RED, 20000, wxT( "wf-result-cw-postopt" ) );
-            len_cw = wr.lines[WP_CW].CLine().Length();
-            bestLine = wr.lines[WP_CW];
-        }
+        bool doCw = wr.status[WP_CW] == WALKAROUND::ST_DONE;
+        bool doCcw = wr.status[WP_CCW] == WALKAROUND::ST_DONE;
 
-        if( wr.status[WP_CCW] == WALKAROUND::ST_DONE )
+        if( doCw && doCcw )
         {
+            PNS_DBG( Dbg(), AddItem, &wr.lines[WP_CW], BLUE, 20000, wxT( "wf-result-cw-preopt" ) );
             PNS_DBG( Dbg(), AddItem, &wr.lines[WP_CCW], BLUE, 20000, wxT( "wf-result-ccw-preopt" ) );
 
-            LINE tmpHead, tmpTail;
+            thread_pool& tp = GetKiCadThreadPool();
 
-            OPTIMIZER::Optimize( &wr.lines[WP_CCW], OPTIMIZER::MERGE_SEGMENTS, m_currentNode );
+            std::future<int> cwResult = tp.submit_task(
+                    [&]() -> int
+                    {
+                        return refineCandidate( wr.lines[WP_CW] );
+                    }, TP_PRIORITY_INTERACTIVE );
 
-            if( splitHeadTail( wr.lines[WP_CCW], m_tail, tmpHead, tmpTail ) )
-            {
-                optimizer.Optimize( &tmpHead );
-                wr.lines[WP_CCW].SetShape( tmpTail.CLine () );
-                wr.lines[WP_CCW].Line().Append( tmpHead.CLine( ) );
-            }
+            len_ccw = refineCandidate( wr.lines[WP_CCW] );
+            len_cw = cwResult.get();
 
+            PNS_DBG( Dbg(), AddItem, &wr.lines[WP_CW], RED, 20000, wxT( "wf-result-cw-postopt" ) );
+            PNS_DBG( Dbg(), AddItem, &wr.lines[WP_CCW], RED, 20000, wxT( "wf-result-ccw-postopt" ) );
+
+            bestLine = len_ccw < len_cw ? wr.lines[WP_CCW] : wr.lines[WP_CW];
+        }
+        else if( doCw )
+        {
+            PNS_DBG( Dbg(), AddItem, &wr.lines[WP_CW], BLUE, 20000, wxT( "wf-result-cw-preopt" ) );
+            len_cw = refineCandidate( wr.lines[WP_CW] );
+            PNS_DBG( Dbg(), AddItem, &wr.lines[WP_CW], RED, 20000, wxT( "wf-result-cw-postopt" ) );
+            bestLine = wr.lines[WP_CW];
+        }
+        else if( doCcw )
+        {
+            PNS_DBG( Dbg(), AddItem, &wr.lines[WP_CCW], BLUE, 20000, wxT( "wf-result-ccw-preopt" ) );
+            len_ccw = refineCandidate( wr.lines[WP_CCW] );
             PNS_DBG( Dbg(), AddItem, &wr.lines[WP_CCW], RED, 20000, wxT( "wf-result-ccw-postopt" ) );
-            len_ccw = wr.lines[WP_CCW].CLine().Length();
 
             if( len_ccw < len_cw )
                 bestLine = wr.lines[WP_CCW];
@@ -79,6 +79,9 @@ bool MEANDER_PLACER::Start( const VECTOR2I& aP, ITEM* aStartItem )
     TOPOLOGY topo( m_world );
     m_tunedPath = topo.AssembleTuningPath( Router()->GetInterface(), m_initialSegment, &m_startPad_n, &m_endPad_n );
 
+    m_cachedOrigLength.reset();
+    m_cachedOrigDelay.reset();
+
     m_padToDieLength = 0;
     m_padToDieDelay = 0;
 
@@ -110,13 +113,19 @@ bool MEANDER_PLACER::Start( const VECTOR2I& aP, ITEM* aStartItem )
 
 long long int MEANDER_PLACER::origPathLength() const
 {
-    return m_padToDieLength + lineLength( m_tunedPath, m_startPad_n, m_endPad_n );
+    if( !m_cachedOrigLength )
+        m_cachedOrigLength = m_padToDieLength + lineLength( m_tunedPath, m_startPad_n, m_endPad_n );
+
+    return *m_cachedOrigLength;
 }
 
 
 int64_t MEANDER_PLACER::origPathDelay() const
 {
-    return m_padToDieDelay + lineDelay( m_tunedPath, m_startPad_n, m_endPad_n );
+    if( !m_cachedOrigDelay )
+        m_cachedOrigDelay = m_padToDieDelay + lineDelay( m_tunedPath, m_startPad_n, m_endPad_n );
+
+    return *m_cachedOrigDelay;
 }
 
 
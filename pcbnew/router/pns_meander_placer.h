@@ -31,6 +31,8 @@
 #include "pns_line.h"
 #include "pns_placement_algo.h"
 #include "pns_meander.h"
+#include <optional>
+
 #include "pns_meander_placer_base.h"
 
 namespace PNS {
@@ -123,6 +125,11 @@ protected:
     LINE     m_currentTrace;
     ITEM_SET m_tunedPath;
 
+    ///< The tuned path is fixed for the duration of a tuning drag, so its baseline length
+    ///< and delay are computed once and reused on every cursor move.
+    mutable std::optional<long long int> m_cachedOrigLength;
+    mutable std::optional<int64_t>       m_cachedOrigDelay;
+
     SHAPE_LINE_CHAIN m_finalShape;
     MEANDERED_LINE   m_result;
     LINKED_ITEM*     m_initialSegment;
@@ -20,6 +20,7 @@
  * with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <vector>
 #include <cassert>
 #include <utility>
@@ -28,6 +29,7 @@
 
 #include <geometry/seg.h>
 #include <geometry/shape_line_chain.h>
+#include <geometry/shape_rect.h>
 #include <zone.h>
 
 #include <wx/log.h>
@@ -185,6 +187,12 @@ void NODE::unlinkParent()
 }
 
 
+uint64_t NODE::IndexGeneration() const
+{
+    return m_index->Generation();
+}
+
+
 OBSTACLE_VISITOR::OBSTACLE_VISITOR( const ITEM* aItem ) :
     m_item( aItem ),
     m_node( nullptr ),
@@ -1714,6 +1722,42 @@ int NODE::QueryJoints( const BOX2I& aBox, std::vector<JOINT*>& aJoints, PNS_LAYE
 }
 
 
+int NODE::QueryItemsInBox( const BOX2I& aBox, std::vector<ITEM*>& aItems ) const
+{
+    SHAPE_RECT rect( aBox );
+
+    // Collect candidates into a flat buffer first, then filter with a plain loop; the
+    // bulk query avoids a callback per candidate.
+    std::vector<INDEX::ENTRY> candidates;
+
+    m_index->QueryBulk( &rect, 0, candidates );
+
+    for( const INDEX::ENTRY& ent : candidates )
+    {
+        if( !ent.item->IsVirtual() )
+            aItems.push_back( ent.item );
+    }
+
+    if( !isRoot() )
+    {
+        candidates.clear();
+        m_root->m_index->QueryBulk( &rect, 0, candidates );
+
+        for( const INDEX::ENTRY& ent : candidates )
+        {
+            if( !ent.item->IsVirtual() && !Overrides( ent.item ) )
+                aItems.push_back( ent.item );
+        }
+    }
+
+    // Multi-layer items are reported once per layer sub-index; deduplicate them.
+    std::sort( aItems.begin(), aItems.end() );
+    aItems.erase( std::unique( aItems.begin(), aItems.end() ), aItems.end() );
+
+    return (int) aItems.size();
+}
+
+
 ITEM *NODE::FindItemByParent( const BOARD_ITEM* aParent )
 {
     if( aParent && aParent->IsConnected() )
@@ -284,6 +284,9 @@ public:
         return m_depth;
     }
 
+    ///< Return the mutation counter of the spatial index (see INDEX::Generation()).
+    uint64_t IndexGeneration() const;
+
     /**
      * Find items colliding (closer than clearance) with the item \a aItem.
      *
@@ -299,6 +302,17 @@ public:
     int QueryJoints( const BOX2I& aBox, std::vector<JOINT*>& aJoints,
                      PNS_LAYER_RANGE aLayerMask = PNS_LAYER_RANGE::All(), int aKindMask = ITEM::ANY_T );
 
+    /**
+     * Collect all items whose bounding boxes intersect \a aBox.  This is a cheap,
+     * clearance-free region gather (bbox test only, no shape collision refinement) used to
+     * maintain spatially pruned working sets - see COMPONENT_DRAGGER.
+     *
+     * @param aBox region of interest
+     * @param aItems the items found, each reported once regardless of layer span
+     * @return number of items found
+     */
+    int QueryItemsInBox( const BOX2I& aBox, std::vector<ITEM*>& aItems ) const;
+
     /**
      * Follow the line in search of an obstacle that is nearest to the starting to the line's
      * starting point.
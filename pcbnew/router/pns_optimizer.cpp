@@ -24,12 +24,14 @@
 #include <geometry/shape_simple.h>
 
 #include <cmath>
+#include <hash.h>
 
 #include "pns_arc.h"
 #include "pns_line.h"
 #include "pns_diff_pair.h"
 #include "pns_node.h"
 #include "pns_solid.h"
+
 #include "pns_optimizer.h"
 
 #include "pns_utils.h"
@@ -459,9 +461,35 @@ bool OPTIMIZER::checkConstraints( int aVertex1, int aVertex2, LINE* aOriginLine,
 
 bool OPTIMIZER::checkColliding( LINE* aLine, const SHAPE_LINE_CHAIN& aOptPath )
 {
+    uint64_t generation = m_world->IndexGeneration();
+
+    if( generation != m_memoGeneration )
+    {
+        m_collisionMemo.clear();
+        m_memoGeneration = generation;
+    }
+
+    std::size_t key = 0xF00DB00F;
+
+    hash_combine( key, aLine->Layer(), aLine->Width(), aLine->Net() );
+
+    for( int i = 0; i < aOptPath.PointCount(); i++ )
+    {
+        const VECTOR2I& pt = aOptPath.CPoint( i );
+        hash_combine( key, pt.x, pt.y );
+    }
+
+    auto memoized = m_collisionMemo.find( key );
+
+    if( memoized != m_collisionMemo.end() )
+        return memoized->second;
+
     LINE tmp( *aLine, aOptPath );
 
-    return checkColliding( &tmp );
+    bool collides = checkColliding( &tmp );
+    m_collisionMemo[ key ] = collides;
+
+    return collides;
 }
 
 
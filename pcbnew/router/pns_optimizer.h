@@ -120,7 +120,11 @@ public:
     bool Optimize( DIFF_PAIR* aPair );
 
 
-    void SetWorld( NODE* aNode ) { m_world = aNode; }
+    void SetWorld( NODE* aNode )
+    {
+        m_world = aNode;
+        m_collisionMemo.clear();
+    }
     void CacheRemove( ITEM* aItem );
     void ClearCache( bool aStaticOnly = false );
 
@@ -202,6 +206,12 @@ private:
     std::vector<OPT_CONSTRAINT*>           m_constraints;
     std::unordered_map<ITEM*, CACHED_ITEM> m_cacheTags;
 
+    ///< Memoized collision results for candidate paths, keyed by path geometry.  Repeated
+    ///< passes over the same line during a drag retest mostly identical candidates; the
+    ///< memo is dropped whenever the world's index generation changes.
+    mutable std::unordered_map<uint64_t, bool> m_collisionMemo;
+    mutable uint64_t                           m_memoGeneration = 0;
+
     NODE*               m_world;
     int                 m_collisionKindMask;
     int                 m_effortLevel;
@@ -39,6 +39,8 @@
 #include "pns_line.h"
 #include "pns_solid.h"
 #include "pns_utils.h"
+#include <core/profile.h>
+
 #include "pns_router.h"
 #include "pns_shove.h"
 #include "pns_dragger.h"
@@ -470,22 +472,45 @@ bool ROUTER::Move( const VECTOR2I& aP, ITEM* endItem )
     if( m_logger )
         m_logger->Log( LOGGER::EVT_MOVE, aP, endItem );
 
+    PROF_TIMER totalTimer( "pns-move", true );
+
+    bool ret = false;
+    bool handled = true;
+
     switch( m_state )
     {
     case ROUTE_TRACK:
-        return movePlacing( aP, endItem );
+        ret = movePlacing( aP, endItem );
+        break;
 
     case DRAG_SEGMENT:
     case DRAG_COMPONENT:
-        return moveDragging( aP, endItem );
+        ret = moveDragging( aP, endItem );
+        break;
 
     default:
+        handled = false;
         break;
     }
 
-    GetRuleResolver()->ClearTemporaryCaches();
+    if( !handled )
+    {
+        GetRuleResolver()->ClearTemporaryCaches();
+        return false;
+    }
 
-    return false;
+    totalTimer.Stop();
+    m_moveStats.totalTimeMs = totalTimer.msecs();
+    m_moveStats.eventCount++;
+
+    PNS_DBG( Dbg(), Message,
+             wxString::Format( wxT( "move-stats: total %.2f ms (algo %.2f, display %.2f, "
+                                    "view %.2f), event %d" ),
+                               m_moveStats.totalTimeMs, m_moveStats.algoTimeMs,
+                               m_moveStats.displayTimeMs, m_moveStats.updateViewTimeMs,
+                               m_moveStats.eventCount ) );
+
+    return ret;
 }
 
 
@@ -631,12 +656,22 @@ bool ROUTER::moveDragging( const VECTOR2I& aP, ITEM* aEndItem )
 {
     m_iface->EraseView();
 
+    PROF_TIMER algoTimer( "pns-drag", true );
+
     bool ret = m_dragger->Drag( aP );
     ITEM_SET dragged = m_dragger->Traces();
 
+    algoTimer.Stop();
+    m_moveStats.algoTimeMs = algoTimer.msecs();
+    m_moveStats.displayTimeMs = 0.0;
+
     m_leaderSegments = m_dragger->GetLastCommittedLeaderSegments();
 
+    PROF_TIMER viewTimer( "pns-update-view", true );
     updateView( m_dragger->CurrentNode(), dragged, true );
+    viewTimer.Stop();
+    m_moveStats.updateViewTimeMs = viewTimer.msecs();
+
     return ret;
 }
 
@@ -753,9 +788,16 @@ bool ROUTER::movePlacing( const VECTOR2I& aP, ITEM* aEndItem )
 {
     m_iface->EraseView();
 
+    PROF_TIMER algoTimer( "pns-place", true );
+
     bool ret = m_placer->Move( aP, aEndItem );
     ITEM_SET current = m_placer->Traces();
 
+    algoTimer.Stop();
+    m_moveStats.algoTimeMs = algoTimer.msecs();
+
+    PROF_TIMER displayTimer( "pns-display", true );
+
     for( const ITEM* item : current.CItems() )
     {
         if( !item->OfKind( ITEM::LINE_T ) )
@@ -785,9 +827,15 @@ bool ROUTER::movePlacing( const VECTOR2I& aP, ITEM* aEndItem )
         }
     }
 
+    displayTimer.Stop();
+    m_moveStats.displayTimeMs = displayTimer.msecs();
+
     //ITEM_SET tmp( &current );
 
+    PROF_TIMER viewTimer( "pns-update-view", true );
     updateView( m_placer->CurrentNode( true ), current );
+    viewTimer.Stop();
+    m_moveStats.updateViewTimeMs = viewTimer.msecs();
 
     return ret;
 }
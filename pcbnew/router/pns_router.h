@@ -155,6 +155,22 @@ public:
 
     static ROUTER* GetInstance();
 
+    /**
+     * Wall-clock breakdown of the most recent Move() event, for regression hunting.  When a
+     * debug decorator is installed the same numbers are emitted through it, so they show up
+     * in the PNS debug tool alongside the geometric trace.
+     */
+    struct MOVE_STATS
+    {
+        double algoTimeMs = 0.0;        ///< placer/dragger algorithm (walkaround/shove/optimize)
+        double displayTimeMs = 0.0;     ///< head trace display
+        double updateViewTimeMs = 0.0;  ///< world diff + view update
+        double totalTimeMs = 0.0;
+        int    eventCount = 0;          ///< cumulative number of Move() events this session
+    };
+
+    const MOVE_STATS& GetMoveStats() const { return m_moveStats; }
+
     void ClearWorld();
     void SyncWorld();
 
@@ -273,6 +289,8 @@ private:
 
     wxString          m_toolStatusbarName;
     wxString          m_failureReason;
+
+    MOVE_STATS        m_moveStats;
 };
 
 }
@@ -41,6 +41,23 @@ const SHAPE_LINE_CHAIN SOLID::Hull( int aClearance, int aWalkaroundThickness, in
     if( !m_shape )
         return SHAPE_LINE_CHAIN();
 
+    std::pair<int, int>         key( aClearance, aWalkaroundThickness );
+    std::lock_guard<std::mutex> lock( m_hullCacheMutex );
+
+    auto cached = m_hullCache.find( key );
+
+    if( cached != m_hullCache.end() )
+        return cached->second;
+
+    SHAPE_LINE_CHAIN hull = buildHull( aClearance, aWalkaroundThickness );
+    m_hullCache[ key ] = hull;
+
+    return hull;
+}
+
+
+const SHAPE_LINE_CHAIN SOLID::buildHull( int aClearance, int aWalkaroundThickness ) const
+{
     if( m_shape->Type() == SH_COMPOUND )
     {
         SHAPE_COMPOUND* cmpnd = static_cast<SHAPE_COMPOUND*>( m_shape );
@@ -89,6 +106,7 @@ void SOLID::SetPos( const VECTOR2I& aCenter )
         m_hole->Move( delta );
 
     m_pos = aCenter;
+    m_hullCache.clear();
 }
 
 
@@ -28,6 +28,9 @@
 #include <geometry/shape.h>
 #include <geometry/shape_line_chain.h>
 
+#include <map>
+#include <mutex>
+
 #include "pns_item.h"
 #include "pns_hole.h"
 
@@ -112,6 +115,7 @@ public:
     {
         delete m_shape;
         m_shape = shape;
+        m_hullCache.clear();
     }
 
     const VECTOR2I& Pos() const { return m_pos; }
@@ -151,6 +155,9 @@ public:
     virtual bool HasHole() const override { return m_hole != nullptr; }
     virtual HOLE *Hole() const override { return m_hole; }
 
+private:
+    const SHAPE_LINE_CHAIN buildHull( int aClearance, int aWalkaroundThickness ) const;
+
 private:
     VECTOR2I    m_pos;
     SHAPE*      m_shape;
@@ -160,6 +167,12 @@ private:
     EDA_ANGLE   m_orientation;
     HOLE*       m_hole;
     std::vector<VECTOR2I> m_anchorPoints;
+
+    ///< Hulls keyed by (clearance, walkaround thickness).  Complex custom pad shapes make
+    ///< hull construction the dominant cost of shoving, and the same few clearances are
+    ///< requested over and over; cleared whenever the shape changes or moves.
+    mutable std::map<std::pair<int, int>, SHAPE_LINE_CHAIN> m_hullCache;
+    mutable std::mutex                                      m_hullCacheMutex;
 };
 
 }
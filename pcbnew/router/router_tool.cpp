@@ -37,6 +37,8 @@ using namespace std::placeholders;
 #include <geometry/geometry_utils.h>
 #include <pad.h>
 #include <zone.h>
+#include <autorouter/batch_router.h>
+#include <board_commit.h>
 #include <pcb_edit_frame.h>
 #include <pcbnew_id.h>
 #include <dialogs/dialog_pns_settings.h>
@@ -47,6 +49,7 @@ using namespace std::placeholders;
 #include <confirm.h>
 #include <kidialog.h>
 #include <widgets/wx_infobar.h>
+#include <widgets/wx_progress_reporters.h>
 #include <widgets/appearance_controls.h>
 #include <connectivity/connectivity_data.h>
 #include <connectivity/connectivity_algo.h>
@@ -1709,6 +1712,40 @@ void ROUTER_TOOL::breakTrack()
 }
 
 
+int ROUTER_TOOL::BatchRoute( const TOOL_EVENT& aEvent )
+{
+    if( m_router->RoutingInProgress() )
+    {
+        wxBell();
+        return 0;
+    }
+
+    PCB_EDIT_FRAME* frame = getEditFrame<PCB_EDIT_FRAME>();
+
+    board()->GetConnectivity()->RecalculateRatsnest();
+
+    BOARD_COMMIT commit( this );
+    BATCH_ROUTER batchRouter( board() );
+
+    if( aEvent.Parameter<bool>() )
+        batchRouter.SetFanoutOnly( true );
+
+    WX_PROGRESS_REPORTER reporter( frame, _( "Batch Route" ), 1, PR_CAN_ABORT );
+    batchRouter.SetProgressReporter( &reporter );
+
+    int routed = batchRouter.Route( commit );
+
+    if( routed > 0 )
+        commit.Push( _( "Batch Route" ) );
+    else
+        commit.Revert();
+
+    frame->SetStatusText( wxString::Format( _( "Batch routed %d connection(s)." ), routed ) );
+
+    return 0;
+}
+
+
 int ROUTER_TOOL::RouteSelected( const TOOL_EVENT& aEvent )
 {
     PNS::ROUTER_MODE mode = aEvent.Parameter<PNS::ROUTER_MODE>();
@@ -2978,6 +3015,8 @@ void ROUTER_TOOL::setTransitions()
     Go( &ROUTER_TOOL::RouteSelected,          PCB_ACTIONS::routerRouteSelected.MakeEvent() );
     Go( &ROUTER_TOOL::RouteSelected,          PCB_ACTIONS::routerRouteSelectedFromEnd.MakeEvent() );
     Go( &ROUTER_TOOL::RouteSelected,          PCB_ACTIONS::routerAutorouteSelected.MakeEvent() );
+    Go( &ROUTER_TOOL::BatchRoute,             PCB_ACTIONS::batchRouteUnrouted.MakeEvent() );
+    Go( &ROUTER_TOOL::BatchRoute,             PCB_ACTIONS::batchRouteFanout.MakeEvent() );
     Go( &ROUTER_TOOL::DpDimensionsDialog,     PCB_ACTIONS::routerDiffPairDialog.MakeEvent() );
     Go( &ROUTER_TOOL::SettingsDialog,         PCB_ACTIONS::routerSettingsDialog.MakeEvent() );
     Go( &ROUTER_TOOL::ChangeRouterMode,       PCB_ACTIONS::routerHighlightMode.MakeEvent() );
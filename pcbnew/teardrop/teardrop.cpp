@@ -23,6 +23,8 @@
  */
 
 
+#include <future>
+
 #include <confirm.h>
 
 #include <board_design_settings.h>
@@ -38,6 +40,7 @@
 #include <geometry/rtree.h>
 #include <convert_basic_shapes_to_polygon.h>
 #include <bezier_curves.h>
+#include <thread_pool.h>
 
 #include <wx/log.h>
 
@@ -220,6 +223,21 @@ void TEARDROP_MANAGER::UpdateTeardrops( BOARD_COMMIT& aCommit,
                                         const std::set<PCB_TRACK*>* dirtyTracks,
                                         bool aForceFullUpdate )
 {
+    // A track with the connected pads/vias that still need a teardrop check
+    struct TD_CANDIDATE
+    {
+        PCB_TRACK*            Track;
+        std::vector<PAD*>     Pads;
+        std::vector<PCB_VIA*> Vias;
+    };
+
+    // A teardrop polygon computed by a worker, pending zone creation on the main thread
+    struct PENDING_TEARDROP
+    {
+        std::vector<VECTOR2I> Points;
+        PCB_TRACK*            Track;
+    };
+
     if( m_board->LegacyTeardrops() )
         return;
 
@@ -242,112 +260,223 @@ void TEARDROP_MANAGER::UpdateTeardrops( BOARD_COMMIT& aCommit,
 
     std::shared_ptr<CONNECTIVITY_DATA> connectivity = m_board->GetConnectivity();
 
-    for( PCB_TRACK* track : m_board->Tracks() )
-    {
-        if( ! ( track->Type() == PCB_TRACE_T || track->Type() == PCB_ARC_T ) )
-            continue;
-
-        std::vector<PAD*>     connectedPads;
-        std::vector<PCB_VIA*> connectedVias;
-
-        connectivity->GetConnectedPadsAndVias( track, &connectedPads, &connectedVias );
+    auto acceptTrack =
+            []( PCB_TRACK* aTrack )
+            {
+                return aTrack->Type() == PCB_TRACE_T || aTrack->Type() == PCB_ARC_T;
+            };
 
-        bool forceUpdate = aForceFullUpdate || dirtyTracks->contains( track );
+    // Collect the tracks that can actually be affected.  For an incremental update these
+    // are the dirty tracks plus the tracks connected to a dirty pad or via; walking the
+    // whole track container and querying connectivity for each would touch every item on
+    // the board for every commit.
+    std::vector<PCB_TRACK*> candidateTracks;
 
-        for( PAD* pad : connectedPads )
+    if( aForceFullUpdate )
+    {
+        for( PCB_TRACK* track : m_board->Tracks() )
         {
-            if( !forceUpdate && !alg::contains( *dirtyPadsAndVias, pad ) )
-                continue;
-
-            TEARDROP_PARAMETERS& tdParams = pad->GetTeardropParams();
-            VECTOR2I padSize = pad->GetSize( track->GetLayer() );
-            int annularWidth = std::min( padSize.x, padSize.y );
+            if( acceptTrack( track ) )
+                candidateTracks.push_back( track );
+        }
+    }
+    else
+    {
+        std::set<PCB_TRACK*> seen;
 
-            if( !tdParams.m_Enabled )
-                continue;
+        for( PCB_TRACK* track : *dirtyTracks )
+        {
+            if( acceptTrack( track ) && seen.insert( track ).second )
+                candidateTracks.push_back( track );
+        }
 
-            // Ensure a teardrop shape can be built: track width must be < teardrop width and
-            // filter width
-            if( track->GetWidth() >= tdParams.m_TdMaxWidth
-                || track->GetWidth() >= annularWidth * tdParams.m_BestWidthRatio
-                || track->GetWidth() >= annularWidth * tdParams.m_WidthtoSizeFilterRatio )
+        for( BOARD_ITEM* item : *dirtyPadsAndVias )
+        {
+            for( PCB_TRACK* track : connectivity->GetConnectedTracks( item ) )
             {
-                continue;
+                if( acceptTrack( track ) && seen.insert( track ).second )
+                    candidateTracks.push_back( track );
             }
+        }
+    }
 
-            bool startHitsPad = pad->HitTest( track->GetStart(), 0, track->GetLayer() );
-            bool endHitsPad = pad->HitTest( track->GetEnd(), 0, track->GetLayer() );
-
-            // The track is entirely inside the pad; cannot create a teardrop
-            if( startHitsPad && endHitsPad )
-                continue;
-
-            // Skip case where pad and the track are within a copper zone with the same net
-            // (and the pad can be connected to the zone)
-            if( !tdParams.m_TdOnPadsInZones && areItemsInSameZone( pad, track ) )
-                continue;
+    // Resolve connectivity up front on this thread; the polygon computation below runs on
+    // the pool and must only perform read-only geometry queries.
+    std::vector<TD_CANDIDATE> candidates;
+    candidates.reserve( candidateTracks.size() );
 
-            tryCreateTrackTeardrop( aCommit, tdParams, TEARDROP_MANAGER::TD_TYPE_PADVIA, track, pad, pad->GetPosition() );
+    for( PCB_TRACK* track : candidateTracks )
+    {
+        TD_CANDIDATE candidate;
+        candidate.Track = track;
 
-            // A track can be connected to pad when just crossing it. So we can create 2 teardrops,
-            // one from pad to track start point and the other to track end point.
-            // However this is acceptable only if the pad position is inside the track.
-            // Otherwise the 2 teardrop shapes can be strange (and of course incorrect
-            if( !startHitsPad && !endHitsPad && track->HitTest( pad->GetPosition() ) )
-            {
-                PCB_TRACK reversed( *track );
-                reversed.SetStart( track->GetEnd() );
-                reversed.SetEnd( pad->GetPosition() );
-                tryCreateTrackTeardrop( aCommit, tdParams, TEARDROP_MANAGER::TD_TYPE_PADVIA, &reversed, pad, pad->GetPosition() );
-                reversed.SetStart( track->GetStart() );
-                tryCreateTrackTeardrop( aCommit, tdParams, TEARDROP_MANAGER::TD_TYPE_PADVIA, &reversed, pad, pad->GetPosition() );
-            }
-        }
+        connectivity->GetConnectedPadsAndVias( track, &candidate.Pads, &candidate.Vias );
 
-        for( PCB_VIA* via : connectedVias )
+        if( !aForceFullUpdate && !dirtyTracks->contains( track ) )
         {
-            if( !forceUpdate && !alg::contains( *dirtyPadsAndVias, via ) )
-                continue;
+            // Only the dirty pads/vias on this track need rebuilding
+            std::erase_if( candidate.Pads,
+                           [&]( PAD* pad )
+                           {
+                               return !alg::contains( *dirtyPadsAndVias, pad );
+                           } );
+            std::erase_if( candidate.Vias,
+                           [&]( PCB_VIA* via )
+                           {
+                               return !alg::contains( *dirtyPadsAndVias, via );
+                           } );
+        }
 
-            TEARDROP_PARAMETERS tdParams = via->GetTeardropParams();
-            int                 annularWidth = via->GetWidth( track->GetLayer() );
+        if( !candidate.Pads.empty() || !candidate.Vias.empty() )
+            candidates.push_back( std::move( candidate ) );
+    }
 
-            if( !tdParams.m_Enabled )
-                continue;
+    // Compute the teardrop polygons.  Candidates are independent, so they fan out across
+    // the thread pool; zone creation (board/commit mutation) stays on this thread.
+    std::vector<std::vector<PENDING_TEARDROP>> pending( candidates.size() );
 
-            // Ensure a teardrop shape can be built: track width must be < teardrop width and
-            // filter width
-            if( track->GetWidth() >= tdParams.m_TdMaxWidth
-                || track->GetWidth() >= annularWidth * tdParams.m_BestWidthRatio
-                || track->GetWidth() >= annularWidth * tdParams.m_WidthtoSizeFilterRatio )
+    auto processCandidate =
+            [&]( size_t aIdx )
             {
-                continue;
-            }
+                const TD_CANDIDATE& candidate = candidates[aIdx];
+                PCB_TRACK*          track = candidate.Track;
+
+                auto tryCompute =
+                        [&]( const TEARDROP_PARAMETERS& aParams, PCB_TRACK* aTdTrack,
+                             BOARD_ITEM* aOther, const VECTOR2I& aPos )
+                        {
+                            std::vector<VECTOR2I> points;
+
+                            if( computeTeardropPolygon( aParams, points, aTdTrack, aOther, aPos ) )
+                            {
+                                // The created zone only takes layer/net/mask attributes from
+                                // the track, so the original stands in for reversed copies
+                                pending[aIdx].push_back( { std::move( points ), track } );
+                            }
+                        };
+
+                for( PAD* pad : candidate.Pads )
+                {
+                    TEARDROP_PARAMETERS& tdParams = pad->GetTeardropParams();
+                    VECTOR2I padSize = pad->GetSize( track->GetLayer() );
+                    int annularWidth = std::min( padSize.x, padSize.y );
+
+                    if( !tdParams.m_Enabled )
+                        continue;
+
+                    // Ensure a teardrop shape can be built: track width must be < teardrop
+                    // width and filter width
+                    if( track->GetWidth() >= tdParams.m_TdMaxWidth
+                        || track->GetWidth() >= annularWidth * tdParams.m_BestWidthRatio
+                        || track->GetWidth() >= annularWidth * tdParams.m_WidthtoSizeFilterRatio )
+                    {
+                        continue;
+                    }
+
+                    bool startHitsPad = pad->HitTest( track->GetStart(), 0, track->GetLayer() );
+                    bool endHitsPad = pad->HitTest( track->GetEnd(), 0, track->GetLayer() );
+
+                    // The track is entirely inside the pad; cannot create a teardrop
+                    if( startHitsPad && endHitsPad )
+                        continue;
+
+                    // Skip case where pad and the track are within a copper zone with the same
+                    // net (and the pad can be connected to the zone)
+                    if( !tdParams.m_TdOnPadsInZones && areItemsInSameZone( pad, track ) )
+                        continue;
+
+                    tryCompute( tdParams, track, pad, pad->GetPosition() );
+
+                    // A track can be connected to pad when just crossing it. So we can create
+                    // 2 teardrops, one from pad to track start point and the other to track
+                    // end point.  However this is acceptable only if the pad position is
+                    // inside the track.  Otherwise the 2 teardrop shapes can be strange (and
+                    // of course incorrect
+                    if( !startHitsPad && !endHitsPad && track->HitTest( pad->GetPosition() ) )
+                    {
+                        PCB_TRACK reversed( *track );
+                        reversed.SetStart( track->GetEnd() );
+                        reversed.SetEnd( pad->GetPosition() );
+                        tryCompute( tdParams, &reversed, pad, pad->GetPosition() );
+                        reversed.SetStart( track->GetStart() );
+                        tryCompute( tdParams, &reversed, pad, pad->GetPosition() );
+                    }
+                }
 
-            bool startHitsVia = via->HitTest( track->GetStart() );
-            bool endHitsVia = via->HitTest( track->GetEnd() );
+                for( PCB_VIA* via : candidate.Vias )
+                {
+                    TEARDROP_PARAMETERS tdParams = via->GetTeardropParams();
+                    int                 annularWidth = via->GetWidth( track->GetLayer() );
+
+                    if( !tdParams.m_Enabled )
+                        continue;
+
+                    // Ensure a teardrop shape can be built: track width must be < teardrop
+                    // width and filter width
+                    if( track->GetWidth() >= tdParams.m_TdMaxWidth
+                        || track->GetWidth() >= annularWidth * tdParams.m_BestWidthRatio
+                        || track->GetWidth() >= annularWidth * tdParams.m_WidthtoSizeFilterRatio )
+                    {
+                        continue;
+                    }
+
+                    bool startHitsVia = via->HitTest( track->GetStart() );
+                    bool endHitsVia = via->HitTest( track->GetEnd() );
+
+                    // The track is entirely inside the via; cannot create a teardrop
+                    if( startHitsVia && endHitsVia )
+                        continue;
+
+                    tryCompute( tdParams, track, via, via->GetPosition() );
+
+                    // A track can be connected to via when just crossing it. So we can create
+                    // 2 teardrops, one from via to track start point and the other to track
+                    // end point.  However this is acceptable only if the via position is
+                    // inside the track.  Otherwise the 2 teardrop shapes can be strange (and
+                    // of course incorrect
+                    if( !startHitsVia && !endHitsVia && track->HitTest( via->GetPosition() ) )
+                    {
+                        PCB_TRACK reversed( *track );
+                        reversed.SetStart( track->GetEnd() );
+                        reversed.SetEnd( via->GetPosition() );
+                        tryCompute( tdParams, &reversed, via, via->GetPosition() );
+                        reversed.SetStart( track->GetStart() );
+                        tryCompute( tdParams, &reversed, via, via->GetPosition() );
+                    }
+                }
+            };
 
-            // The track is entirely inside the via; cannot create a teardrop
-            if( startHitsVia && endHitsVia )
-                continue;
+    if( candidates.size() > 1 )
+    {
+        thread_pool& tp = GetKiCadThreadPool();
 
+        std::vector<std::future<void>> returns;
+        returns.reserve( candidates.size() );
 
-            tryCreateTrackTeardrop( aCommit, tdParams, TEARDROP_MANAGER::TD_TYPE_PADVIA, track, via,
-                                    via->GetPosition() );
+        for( size_t ii = 0; ii < candidates.size(); ++ii )
+        {
+            returns.emplace_back( tp.submit_task(
+                    [&, ii]()
+                    {
+                        processCandidate( ii );
+                    },
+                    TP_PRIORITY_INCREMENTAL ) );
+        }
 
-            // A track can be connected to via when just crossing it. So we can create 2 teardrops,
-            // one from via to track start point and the other to track end point.
-            // However this is acceptable only if the via position is inside the track.
-            // Otherwise the 2 teardrop shapes can be strange (and of course incorrect
-            if( !startHitsVia && !endHitsVia && track->HitTest( via->GetPosition() ) )
-            {
-                PCB_TRACK reversed( *track );
-                reversed.SetStart( track->GetEnd() );
-                reversed.SetEnd( via->GetPosition() );
-                tryCreateTrackTeardrop( aCommit, tdParams, TEARDROP_MANAGER::TD_TYPE_PADVIA, &reversed, via, via->GetPosition() );
-                reversed.SetStart( track->GetStart() );
-                tryCreateTrackTeardrop( aCommit, tdParams, TEARDROP_MANAGER::TD_TYPE_PADVIA, &reversed, via, via->GetPosition() );
-            }
+        for( std::future<void>& ret : returns )
+            ret.get();
+    }
+    else if( !candidates.empty() )
+    {
+        processCandidate( 0 );
+    }
+
+    for( std::vector<PENDING_TEARDROP>& batch : pending )
+    {
+        for( PENDING_TEARDROP& teardrop : batch )
+        {
+            createAndAddTeardropWithMask( aCommit, TEARDROP_MANAGER::TD_TYPE_PADVIA,
+                                          teardrop.Points, teardrop.Track );
         }
     }
 
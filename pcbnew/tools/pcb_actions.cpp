@@ -2537,6 +2537,22 @@ TOOL_ACTION PCB_ACTIONS::routeDiffPair( TOOL_ACTION_ARGS()
         .Flags( AF_ACTIVATE )
         .Parameter( PNS::PNS_MODE_ROUTE_DIFF_PAIR ) );
 
+TOOL_ACTION PCB_ACTIONS::batchRouteUnrouted( TOOL_ACTION_ARGS()
+        .Name( "pcbnew.InteractiveRouter.BatchRoute" )
+        .Scope( AS_GLOBAL )
+        .FriendlyName( _( "Batch Route Unrouted" ) )
+        .Tooltip( _( "Automatically route the remaining unrouted connections" ) )
+        .Icon( BITMAPS::add_tracks )
+        .Parameter( false ) );
+
+TOOL_ACTION PCB_ACTIONS::batchRouteFanout( TOOL_ACTION_ARGS()
+        .Name( "pcbnew.InteractiveRouter.BatchRouteFanout" )
+        .Scope( AS_GLOBAL )
+        .FriendlyName( _( "Batch Route Fanout" ) )
+        .Tooltip( _( "Automatically route short pad-anchored connections (BGA escape)" ) )
+        .Icon( BITMAPS::add_tracks )
+        .Parameter( true ) );
+
 TOOL_ACTION PCB_ACTIONS::routerSettingsDialog( TOOL_ACTION_ARGS()
         .Name( "pcbnew.InteractiveRouter.SettingsDialog" )
         .Scope( AS_GLOBAL )
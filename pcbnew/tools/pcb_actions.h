@@ -271,6 +271,10 @@ public:
     static TOOL_ACTION routerRouteSelectedFromEnd;
     static TOOL_ACTION routerAutorouteSelected;
 
+    /// Headless batch routing of the remaining ratsnest connections
+    static TOOL_ACTION batchRouteUnrouted;
+    static TOOL_ACTION batchRouteFanout;
+
     /// Activation of the Push and Shove settings dialogs
     static TOOL_ACTION routerSettingsDialog;
     static TOOL_ACTION routerDiffPairDialog;
@@ -223,7 +223,10 @@ int ZONE_FILLER_TOOL::ZoneFillDirty( const TOOL_EVENT& aEvent )
     int64_t startTime = GetRunningMicroSecs();
     m_fillInProgress = true;
 
+    std::vector<BOX2I> dirtyRegions = std::move( m_dirtyRegions );
+
     m_dirtyZoneIDs.clear();
+    m_dirtyRegions.clear();
 
     board()->IncrementTimeStamp();    // Clear caches
 
@@ -232,6 +235,7 @@ int ZONE_FILLER_TOOL::ZoneFillDirty( const TOOL_EVENT& aEvent )
     int                                   pts = 0;
 
     m_filler = std::make_unique<ZONE_FILLER>( board(), &commit );
+    m_filler->SetDirtyRegions( dirtyRegions );
 
     if( !board()->GetDesignSettings().m_DRCEngine->RulesValid() )
     {
@@ -68,6 +68,15 @@ public:
         m_dirtyZoneIDs.insert( aZone->m_Uuid );
     }
 
+    /**
+     * Record the board areas changed by a commit (see BOARD_COMMIT::GetChangedAreas()) so the
+     * next dirty-zone refill can be restricted to the zones those areas can actually affect.
+     */
+    void DirtyRegions( const std::vector<BOX2I>& aAreas )
+    {
+        m_dirtyRegions.insert( m_dirtyRegions.end(), aAreas.begin(), aAreas.end() );
+    }
+
     static bool IsZoneFillAction( const TOOL_EVENT* aEvent );
 
 private:
@@ -85,6 +94,7 @@ private:
     bool                         m_fillInProgress;
 
     std::set<KIID>               m_dirtyZoneIDs;
+    std::vector<BOX2I>           m_dirtyRegions;
 };
 
 #endif
@@ -1315,18 +1315,32 @@ void APPEARANCE_CONTROLS::setVisibleLayers( const LSET& aLayers )
     }
     else
     {
+        LSET changed = m_frame->GetBoard()->GetVisibleLayers() ^ aLayers;
+
         m_frame->GetBoard()->SetVisibleLayers( aLayers );
 
+        // The visibility flip itself is a pure per-layer enable/disable in the view (the
+        // callers do it with VIEW::SetLayerVisible()); items only need recaching when their
+        // rendered appearance depends on which layers are visible.  That's the case for pads
+        // and vias rendered to composite layers (such as LAYER_PAD_TH), whose flashing follows
+        // copper visibility -- and then only for the ones present on a changed copper layer.
+        //
         // Note: KIGFX::REPAINT isn't enough for things that go from invisible to visible as
         // they won't be found in the view layer's itemset for repainting.
-        view->UpdateAllItemsConditionally( KIGFX::ALL,
-                []( KIGFX::VIEW_ITEM* aItem ) -> bool
-                {
-                    // Items rendered to composite layers (such as LAYER_PAD_TH) must be redrawn
-                    // whether they're optionally flashed or not (as the layer being hidden/shown
-                    // might be the last layer the item is visible on).
-                    return dynamic_cast<PCB_VIA*>( aItem ) || dynamic_cast<PAD*>( aItem );
-                } );
+        if( ( changed & LSET::AllCuMask() ).any() )
+        {
+            view->UpdateAllItemsConditionally( KIGFX::ALL,
+                    [&changed]( KIGFX::VIEW_ITEM* aItem ) -> bool
+                    {
+                        if( PCB_VIA* via = dynamic_cast<PCB_VIA*>( aItem ) )
+                            return ( via->GetLayerSet() & changed ).any();
+
+                        if( PAD* pad = dynamic_cast<PAD*>( aItem ) )
+                            return ( pad->GetLayerSet() & changed ).any();
+
+                        return false;
+                    } );
+        }
 
         m_frame->Update3DView( true, m_frame->GetPcbNewSettings()->m_Display.m_Live3DRefresh );
     }
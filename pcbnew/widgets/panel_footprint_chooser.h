@@ -98,6 +98,12 @@ protected:
 
     void onFootprintSelected( wxCommandEvent& aEvent );
 
+    /**
+     * Handle completion of a background preview load; refreshes m_CurrFootprint and re-fires
+     * FP_SELECTION_EVENT so the 3D view picks up the newly loaded footprint.
+     */
+    void onFootprintLoaded( wxCommandEvent& aEvent );
+
     /**
      * Handle the selection of an item. This is called when either the search
      * box or the tree receive an Enter, or the tree receives a double click.
@@ -45,7 +45,7 @@
 
 PCB_DESIGN_BLOCK_PREVIEW_WIDGET::PCB_DESIGN_BLOCK_PREVIEW_WIDGET( wxWindow* aParent, PCB_EDIT_FRAME* aFrame ) :
         DESIGN_BLOCK_PREVIEW_WIDGET( aParent ), m_preview( nullptr ), m_status( nullptr ), m_statusPanel( nullptr ),
-        m_statusSizer( nullptr ), m_previewItem( nullptr )
+        m_statusSizer( nullptr )
 {
     COMMON_SETTINGS* common_settings = Pgm().GetCommonSettings();
     PCBNEW_SETTINGS* cfg = GetAppSettings<PCBNEW_SETTINGS>( "pcbnew" );
@@ -110,12 +110,31 @@ PCB_DESIGN_BLOCK_PREVIEW_WIDGET::PCB_DESIGN_BLOCK_PREVIEW_WIDGET( wxWindow* aPar
 }
 
 
+// Parsed design block boards are expensive to build, so recently displayed ones are kept
+// for reuse by any preview widget instead of being torn down with the widget.
+static DESIGN_BLOCK_PREVIEW_CACHE<BOARD> g_pcbPreviewCache;
+
+
 PCB_DESIGN_BLOCK_PREVIEW_WIDGET::~PCB_DESIGN_BLOCK_PREVIEW_WIDGET()
 {
-    if( m_previewItem )
-        m_preview->GetView()->Remove( m_previewItem );
+    detachPreviewItem();
+}
+
+
+void PCB_DESIGN_BLOCK_PREVIEW_WIDGET::detachPreviewItem()
+{
+    if( !m_previewItem.Document )
+        return;
+
+    KIGFX::VIEW* view = m_preview->GetView();
 
-    delete m_previewItem;
+    // Remove() (unlike Clear()) unlinks each item from the view, so the cached board can
+    // outlive this widget and be re-displayed in a new canvas later.
+    for( BOARD_ITEM* item : m_previewItem.Document->GetItemSet() )
+        view->Remove( item );
+
+    g_pcbPreviewCache.Release( std::move( m_previewItem ) );
+    m_previewItem = {};
 }
 
 
@@ -132,7 +151,7 @@ void PCB_DESIGN_BLOCK_PREVIEW_WIDGET::SetStatusText( wxString const& aText )
 
 void PCB_DESIGN_BLOCK_PREVIEW_WIDGET::onSize( wxSizeEvent& aEvent )
 {
-    if( m_previewItem )
+    if( m_previewItem.Document )
     {
         fitOnDrawArea();
         m_preview->ForceRefresh();
@@ -144,7 +163,7 @@ void PCB_DESIGN_BLOCK_PREVIEW_WIDGET::onSize( wxSizeEvent& aEvent )
 
 void PCB_DESIGN_BLOCK_PREVIEW_WIDGET::fitOnDrawArea()
 {
-    if( !m_previewItem )
+    if( !m_previewItem.Document )
         return;
 
     // set the view scale to fit the item on screen
@@ -170,50 +189,51 @@ void PCB_DESIGN_BLOCK_PREVIEW_WIDGET::DisplayDesignBlock( DESIGN_BLOCK* aDesignB
 {
     KIGFX::VIEW* view = m_preview->GetView();
 
-    if( m_previewItem )
-    {
-        view->Clear();
-        delete m_previewItem;
-        m_previewItem = nullptr;
-    }
+    detachPreviewItem();
 
     if( aDesignBlock && wxFileExists( aDesignBlock->GetBoardFile() ) )
     {
-        try
-        {
-            IO_RELEASER<PCB_IO>  pi( PCB_IO_MGR::FindPlugin( PCB_IO_MGR::KICAD_SEXP ) );
-            WX_PROGRESS_REPORTER progressReporter( this, _( "Load PCB" ), 1, PR_CAN_ABORT );
+        const wxString& boardFile = aDesignBlock->GetBoardFile();
 
-            pi->SetProgressReporter( &progressReporter );
+        m_previewItem = g_pcbPreviewCache.Take( boardFile );
 
-            m_previewItem = pi->LoadBoard( aDesignBlock->GetBoardFile(), nullptr );
-        }
-        catch( const IO_ERROR& ioe )
+        if( !m_previewItem.Document )
         {
-            // You wouldn't think boardFn.GetFullPath() would throw, but we get a stack buffer
-            // underflow from ASAN.  While it's probably an ASAN error, a second try/catch doesn't
-            // cost us much.
             try
             {
-                if( ioe.Problem() != wxT( "CANCEL" ) )
-                {
-                    wxString msg =
-                            wxString::Format( _( "Error loading board file:\n%s" ), aDesignBlock->GetBoardFile() );
-                    DisplayErrorMessage( this, msg, ioe.What() );
-                }
+                IO_RELEASER<PCB_IO>  pi( PCB_IO_MGR::FindPlugin( PCB_IO_MGR::KICAD_SEXP ) );
+                WX_PROGRESS_REPORTER progressReporter( this, _( "Load PCB" ), 1, PR_CAN_ABORT );
+
+                pi->SetProgressReporter( &progressReporter );
+
+                m_previewItem = DESIGN_BLOCK_PREVIEW_CACHE<BOARD>::MakeEntry(
+                        boardFile, std::shared_ptr<BOARD>( pi->LoadBoard( boardFile, nullptr ) ) );
             }
-            catch( ... )
+            catch( const IO_ERROR& ioe )
             {
-                // That was already our best-efforts
+                // You wouldn't think boardFn.GetFullPath() would throw, but we get a stack buffer
+                // underflow from ASAN.  While it's probably an ASAN error, a second try/catch doesn't
+                // cost us much.
+                try
+                {
+                    if( ioe.Problem() != wxT( "CANCEL" ) )
+                    {
+                        wxString msg = wxString::Format( _( "Error loading board file:\n%s" ), boardFile );
+                        DisplayErrorMessage( this, msg, ioe.What() );
+                    }
+                }
+                catch( ... )
+                {
+                    // That was already our best-efforts
+                }
             }
         }
 
-
         BOX2I bBox;
 
-        if( m_previewItem )
+        if( m_previewItem.Document )
         {
-            for( BOARD_ITEM* item : m_previewItem->GetItemSet() )
+            for( BOARD_ITEM* item : m_previewItem.Document->GetItemSet() )
             {
                 view->Add( item );
 
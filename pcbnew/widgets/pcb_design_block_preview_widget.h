@@ -29,6 +29,7 @@
 
 class LIB_ID;
 class DESIGN_BLOCK;
+class BOARD;
 class SCHEMATIC;
 class PCB_SHEET;
 class wxStaticText;
@@ -62,6 +63,9 @@ protected:
 
     void fitOnDrawArea();    // set the view scale to fit the item on screen and center
 
+    /// Unlink the displayed board's items from the view and return it to the cache.
+    void detachPreviewItem();
+
     GAL_DISPLAY_OPTIONS_IMPL   m_galDisplayOptions;
     EDA_DRAW_PANEL_GAL*        m_preview;
 
@@ -70,7 +74,7 @@ protected:
     wxSizer*                   m_statusSizer;
     wxSizer*                   m_outerSizer;
 
-    BOARD*                     m_previewItem;
+    DESIGN_BLOCK_PREVIEW_CACHE<BOARD>::ENTRY m_previewItem;
 
     /// The bounding box of the current item
     BOX2I                      m_itemBBox;
@@ -444,6 +444,9 @@ void PCB_NET_INSPECTOR_PANEL::buildNetsList( const bool rebuildColumns )
     m_dataModel->deleteAllItems();
     m_custom_group_rules.clear();
 
+    // A full rebuild supersedes any board-change updates still awaiting their deferred recompute
+    m_pendingNetUpdates.clear();
+
     for( const wxString& rule : cfg->custom_group_rules )
         m_custom_group_rules.push_back( std::make_unique<EDA_COMBINED_MATCHER>( rule, CTX_NET ) );
 
@@ -579,22 +582,33 @@ struct NETCODE_CMP_LESS
 };
 
 
-std::vector<CN_ITEM*> PCB_NET_INSPECTOR_PANEL::relevantConnectivityItems() const
+std::vector<CN_ITEM*>
+PCB_NET_INSPECTOR_PANEL::relevantConnectivityItems( const std::vector<NETINFO_ITEM*>& aNetCodes ) const
 {
-    // Pre-filter the connectivity items and sort them by netcode. This avoids quadratic runtime when building the whole
-    // net list.
+    // Pre-filter the connectivity items to the requested nets and sort them by netcode. This avoids quadratic runtime
+    // when building the whole net list, and keeps incremental updates (which typically touch only a handful of nets)
+    // from collecting and sorting every connected item on the board for each change notification.
     const auto type_bits = std::bitset<MAX_STRUCT_TYPE_ID>().set( PCB_TRACE_T )
                                                             .set( PCB_ARC_T )
                                                             .set( PCB_VIA_T )
                                                             .set( PCB_PAD_T );
 
+    std::vector<int> netCodes;
+    netCodes.reserve( aNetCodes.size() );
+
+    for( const NETINFO_ITEM* net : aNetCodes )
+        netCodes.push_back( net->GetNetCode() );
+
     std::vector<CN_ITEM*> cn_items;
     cn_items.reserve( 1024 );
 
     for( CN_ITEM* cn_item : m_board->GetConnectivity()->GetConnectivityAlgo()->ItemList() )
     {
-        if( cn_item->Valid() && type_bits[cn_item->Parent()->Type()] )
+        if( cn_item->Valid() && type_bits[cn_item->Parent()->Type()]
+            && std::ranges::binary_search( netCodes, cn_item->Net() ) )
+        {
             cn_items.push_back( cn_item );
+        }
     }
 
     std::ranges::sort( cn_items, NETCODE_CMP_LESS() );
@@ -609,7 +623,7 @@ PCB_NET_INSPECTOR_PANEL::calculateNets( const std::vector<NETINFO_ITEM*>& aNetCo
     std::vector<std::unique_ptr<LIST_ITEM>> results;
 
     LENGTH_DELAY_CALCULATION*   calc = m_board->GetLengthCalculation();
-    const std::vector<CN_ITEM*> conItems = relevantConnectivityItems();
+    const std::vector<CN_ITEM*> conItems = relevantConnectivityItems( aNetCodes );
 
     // First assemble the LENGTH_CALCULATION_ITEMs for board items which match the nets we need to recompute
     // Precondition: conItems and aNetCodes are sorted in increasing netcode value
@@ -836,13 +850,38 @@ void PCB_NET_INSPECTOR_PANEL::updateBoardItems( const std::vector<BOARD_ITEM*>&
             }
         }
 
-        std::ranges::sort( changedNets,
-                           []( const NETINFO_ITEM* a, const NETINFO_ITEM* b )
-                           {
-                               return a->GetNetCode() < b->GetNetCode();
-                           } );
+        // Coalesce bursts of listener notifications (e.g. the many item-changed events generated while dragging)
+        // into a single recompute per event loop iteration, rather than recomputing the affected nets once per
+        // notification. The accumulated nets are processed after the current event handler has returned.
+        m_pendingNetUpdates.insert( changedNets.begin(), changedNets.end() );
+
+        if( !m_netUpdateScheduled )
+        {
+            m_netUpdateScheduled = true;
+
+            CallAfter(
+                    [this]()
+                    {
+                        m_netUpdateScheduled = false;
+
+                        if( m_pendingNetUpdates.empty() )
+                            return;
+
+                        std::vector<NETINFO_ITEM*> nets( m_pendingNetUpdates.begin(), m_pendingNetUpdates.end() );
+                        m_pendingNetUpdates.clear();
+
+                        std::ranges::sort( nets,
+                                           []( const NETINFO_ITEM* a, const NETINFO_ITEM* b )
+                                           {
+                                               return a->GetNetCode() < b->GetNetCode();
+                                           } );
 
-        updateNets( changedNets );
+                        updateNets( nets );
+                        m_netsList->Refresh();
+                    } );
+        }
+
+        return;
     }
 
     m_netsList->Refresh();
@@ -866,6 +905,9 @@ void PCB_NET_INSPECTOR_PANEL::updateNets( const std::vector<NETINFO_ITEM*>& aNet
 
     wxWindowUpdateLocker updateLocker( m_netsList );
 
+    // Coalesce the per-row resorts below into (at most) one
+    m_dataModel->BeginRowUpdateBatch();
+
     std::vector<std::unique_ptr<LIST_ITEM>> newListItems = calculateNets( aNets, true );
 
     for( std::unique_ptr<LIST_ITEM>& newListItem : newListItems )
@@ -915,6 +957,8 @@ void PCB_NET_INSPECTOR_PANEL::updateNets( const std::vector<NETINFO_ITEM*>& aNet
     // Delete any nets we have not yet handled
     for( const NETINFO_ITEM* netToDelete : netsToDelete )
         m_dataModel->deleteItem( m_dataModel->findItem( netToDelete->GetNetCode() ) );
+
+    m_dataModel->EndRowUpdateBatch();
 }
 
 
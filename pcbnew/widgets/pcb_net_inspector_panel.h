@@ -25,6 +25,7 @@
 #include <widgets/net_inspector_panel.h>
 
 #include <optional>
+#include <unordered_set>
 #include <vector>
 
 class PCB_EDIT_FRAME;
@@ -112,8 +113,12 @@ private:
     /// Generates a sub-menu for the show / hide columns submenu
     void generateShowHideColumnMenu( wxMenu* target );
 
-    /// Fetches an ordered (by NetCode) list of all board connectivity items
-    std::vector<CN_ITEM*> relevantConnectivityItems() const;
+    /**
+     * Fetches an ordered (by NetCode) list of board connectivity items on the given nets
+     *
+     * @param aNetCodes the nets to fetch items for, sorted in ascending netcode order
+    */
+    std::vector<CN_ITEM*> relevantConnectivityItems( const std::vector<NETINFO_ITEM*>& aNetCodes ) const;
 
     /// Filter to determine whether a board net should be included in the net inspector
     bool netFilterMatches( NETINFO_ITEM* aNet, PANEL_NET_INSPECTOR_SETTINGS* cfg = nullptr ) const;
@@ -241,6 +246,12 @@ private:
     bool m_rowExpanding = false;
     bool m_highlightingNets = false;
 
+    /// Nets touched by board listener events, awaiting the deferred (coalesced) statistics recompute
+    std::unordered_set<NETINFO_ITEM*> m_pendingNetUpdates;
+
+    /// True when a deferred net statistics recompute is already queued on the event loop
+    bool m_netUpdateScheduled = false;
+
     /*
      * Configuration flags - these are all persisted to the project storage
      */
@@ -698,7 +698,7 @@ public:
         {
             ItemChanged( wxDataViewItem( parent ) );
 
-            if( m_parent.m_groupByNetclass && parent != nullptr && parent->ChildrenCount() == 0 )
+            if( m_parent.m_groupByNetclass && parent->ChildrenCount() == 0 )
             {
                 auto p = std::find_if( m_items.begin(), m_items.end(),
                                        [&]( std::unique_ptr<LIST_ITEM>& x )
@@ -710,10 +710,15 @@ public:
                 m_items.erase( p );
 
                 ItemDeleted( wxDataViewItem( parent->Parent() ), wxDataViewItem( parent ) );
+                parent = nullptr;
             }
         }
 
-        Resort();
+        // Deleting a row doesn't change the relative order of the remaining rows; only the
+        // parent group's aggregates can move, so don't pay for an unconditional full resort.
+        if( parent )
+            resortIfChanged( parent );
+
         return i;
     }
 
@@ -778,7 +783,23 @@ public:
                 i->ResetColumnChangedBits();
 
             if( changed )
-                Resort();
+                requestResort();
+        }
+    }
+
+    /**
+     * Suspend sorting while a batch of rows is updated or deleted.  Any resort requested
+     * during the batch is coalesced into a single Resort() when the outermost batch ends,
+     * instead of re-sorting the whole control once per touched row.
+     */
+    void BeginRowUpdateBatch() { ++m_rowBatchDepth; }
+
+    void EndRowUpdateBatch()
+    {
+        if( --m_rowBatchDepth == 0 && m_resortPending )
+        {
+            m_resortPending = false;
+            Resort();
         }
     }
 
@@ -1073,6 +1094,15 @@ protected:
 
     wxString GetColumnType( unsigned int /* aCol */ ) const override { return wxS( "string" ); }
 
+private:
+    void requestResort()
+    {
+        if( m_rowBatchDepth > 0 )
+            m_resortPending = true;
+        else
+            Resort();
+    }
+
 private:
     PCB_NET_INSPECTOR_PANEL& m_parent;
 
@@ -1081,6 +1111,9 @@ private:
     // of the filter strings as input by the user
     std::vector<std::unique_ptr<LIST_ITEM>> m_items;
 
+    int  m_rowBatchDepth{ 0 };
+    bool m_resortPending{ false };
+
     /// Map of custom group names to their representative list item
     std::map<wxString, LIST_ITEM*> m_custom_group_map;
 
@@ -46,6 +46,52 @@ void PCB_SEARCH_HANDLER::ActivateItem( long aItemRow )
 }
 
 
+static bool isPlainTextQuery( const wxString& aQuery )
+{
+    for( const wxUniChar& c : aQuery )
+    {
+        if( !wxIsalnum( c ) && c != '_' && c != '-' && c != ' ' )
+            return false;
+    }
+
+    return true;
+}
+
+
+bool PCB_SEARCH_HANDLER::canNarrowSearch( const wxString& aQuery ) const
+{
+    BOARD* board = m_frame->GetBoard();
+
+    if( !board || board->GetTimeStamp() != m_lastTimeStamp )
+        return false;
+
+    APP_SETTINGS_BASE::SEARCH_PANE& settings = m_frame->config()->m_SearchPane;
+
+    if( settings.search_hidden_fields != m_lastAllFields
+            || settings.search_metadata != m_lastMetadata )
+    {
+        return false;
+    }
+
+    // Narrowing is only sound when the old hit list is guaranteed to be a superset of the new
+    // one: the new query must extend the old one (an empty old query matched everything), and
+    // it must be plain text (a prefix of a plain query is itself plain).
+    return aQuery.StartsWith( m_lastQuery ) && isPlainTextQuery( aQuery );
+}
+
+
+void PCB_SEARCH_HANDLER::rememberSearch( const wxString& aQuery )
+{
+    BOARD* board = m_frame->GetBoard();
+    APP_SETTINGS_BASE::SEARCH_PANE& settings = m_frame->config()->m_SearchPane;
+
+    m_lastQuery = aQuery;
+    m_lastTimeStamp = board ? board->GetTimeStamp() : -1;
+    m_lastAllFields = settings.search_hidden_fields;
+    m_lastMetadata = settings.search_metadata;
+}
+
+
 void PCB_SEARCH_HANDLER::Sort( int aCol, bool aAscending, std::vector<long>* aSelection )
 {
     std::vector<BOARD_ITEM*> selection;
@@ -130,11 +176,13 @@ FOOTPRINT_SEARCH_HANDLER::FOOTPRINT_SEARCH_HANDLER( PCB_EDIT_FRAME* aFrame ) :
 
 int FOOTPRINT_SEARCH_HANDLER::Search( const wxString& aQuery )
 {
-    m_hitlist.clear();
     BOARD* board = m_frame->GetBoard();
 
     if( board == nullptr )
+    {
+        m_hitlist.clear();
         return 0;
+    }
 
     APP_SETTINGS_BASE::SEARCH_PANE& settings = m_frame->config()->m_SearchPane;
     EDA_SEARCH_DATA                 frp;
@@ -146,8 +194,18 @@ int FOOTPRINT_SEARCH_HANDLER::Search( const wxString& aQuery )
     // Try to handle whatever the user throws at us (substring, wildcards, regex, etc.)
     frp.matchMode = EDA_SEARCH_MATCH_MODE::PERMISSIVE;
 
-    for( FOOTPRINT* fp : board->Footprints() )
+    std::vector<BOARD_ITEM*> candidates;
+
+    if( canNarrowSearch( aQuery ) )
+        candidates = std::move( m_hitlist );
+    else
+        candidates.assign( board->Footprints().begin(), board->Footprints().end() );
+
+    m_hitlist.clear();
+
+    for( BOARD_ITEM* candidate : candidates )
     {
+        FOOTPRINT* fp = static_cast<FOOTPRINT*>( candidate );
         bool found = false;
 
         if( frp.findString.IsEmpty() )
@@ -172,6 +230,8 @@ int FOOTPRINT_SEARCH_HANDLER::Search( const wxString& aQuery )
             m_hitlist.push_back( fp );
     }
 
+    rememberSearch( aQuery );
+
     return (int) m_hitlist.size();
 }
 
@@ -214,7 +274,6 @@ ZONE_SEARCH_HANDLER::ZONE_SEARCH_HANDLER( PCB_EDIT_FRAME* aFrame ) :
 
 int ZONE_SEARCH_HANDLER::Search( const wxString& aQuery )
 {
-    m_hitlist.clear();
     BOARD* board = m_frame->GetBoard();
 
     APP_SETTINGS_BASE::SEARCH_PANE& settings = m_frame->config()->m_SearchPane;
@@ -227,12 +286,23 @@ int ZONE_SEARCH_HANDLER::Search( const wxString& aQuery )
     // Try to handle whatever the user throws at us (substring, wildcards, regex, etc.)
     frp.matchMode = EDA_SEARCH_MATCH_MODE::PERMISSIVE;
 
-    for( BOARD_ITEM* item : board->Zones() )
+    std::vector<BOARD_ITEM*> candidates;
+
+    if( canNarrowSearch( aQuery ) )
+        candidates = std::move( m_hitlist );
+    else
+        candidates.assign( board->Zones().begin(), board->Zones().end() );
+
+    m_hitlist.clear();
+
+    for( BOARD_ITEM* item : candidates )
     {
         if( frp.findString.IsEmpty() || item->Matches( frp, nullptr ) )
             m_hitlist.push_back( item );
     }
 
+    rememberSearch( aQuery );
+
     return (int) m_hitlist.size();
 }
 
@@ -285,7 +355,6 @@ TEXT_SEARCH_HANDLER::TEXT_SEARCH_HANDLER( PCB_EDIT_FRAME* aFrame ) :
 
 int TEXT_SEARCH_HANDLER::Search( const wxString& aQuery )
 {
-    m_hitlist.clear();
     BOARD* board = m_frame->GetBoard();
 
     APP_SETTINGS_BASE::SEARCH_PANE& settings = m_frame->config()->m_SearchPane;
@@ -298,18 +367,36 @@ int TEXT_SEARCH_HANDLER::Search( const wxString& aQuery )
     // Try to handle whatever the user throws at us (substring, wildcards, regex, etc.)
     frp.matchMode = EDA_SEARCH_MATCH_MODE::PERMISSIVE;
 
-    for( BOARD_ITEM* item : board->Drawings() )
+    std::vector<BOARD_ITEM*> candidates;
+
+    if( canNarrowSearch( aQuery ) )
     {
-        if( item->Type() == PCB_TEXT_T
-            || BaseType( item->Type() ) == PCB_DIMENSION_T
-            || item->Type() == PCB_TEXTBOX_T
-            || item->Type() == PCB_TABLECELL_T )
+        candidates = std::move( m_hitlist );
+    }
+    else
+    {
+        for( BOARD_ITEM* item : board->Drawings() )
         {
-            if( frp.findString.IsEmpty() || item->Matches( frp, nullptr ) )
-                m_hitlist.push_back( item );
+            if( item->Type() == PCB_TEXT_T
+                || BaseType( item->Type() ) == PCB_DIMENSION_T
+                || item->Type() == PCB_TEXTBOX_T
+                || item->Type() == PCB_TABLECELL_T )
+            {
+                candidates.push_back( item );
+            }
         }
     }
 
+    m_hitlist.clear();
+
+    for( BOARD_ITEM* item : candidates )
+    {
+        if( frp.findString.IsEmpty() || item->Matches( frp, nullptr ) )
+            m_hitlist.push_back( item );
+    }
+
+    rememberSearch( aQuery );
+
     return (int) m_hitlist.size();
 }
 
@@ -357,7 +444,6 @@ GROUP_SEARCH_HANDLER::GROUP_SEARCH_HANDLER( PCB_EDIT_FRAME* aFrame ) :
 
 int GROUP_SEARCH_HANDLER::Search( const wxString& aQuery )
 {
-    m_hitlist.clear();
     BOARD* board = m_frame->GetBoard();
 
     APP_SETTINGS_BASE::SEARCH_PANE& settings = m_frame->config()->m_SearchPane;
@@ -370,16 +456,34 @@ int GROUP_SEARCH_HANDLER::Search( const wxString& aQuery )
     // Try to handle whatever the user throws at us (substring, wildcards, regex, etc.)
     frp.matchMode = EDA_SEARCH_MATCH_MODE::PERMISSIVE;
 
-    for( BOARD_ITEM* item : board->Groups() )
+    std::vector<BOARD_ITEM*> candidates;
+
+    if( canNarrowSearch( aQuery ) )
     {
-        // Skip generators, they are for internal use, not user-facing grouping
-        if( item->Type() == PCB_GENERATOR_T )
-            continue;
+        candidates = std::move( m_hitlist );
+    }
+    else
+    {
+        for( BOARD_ITEM* item : board->Groups() )
+        {
+            // Skip generators, they are for internal use, not user-facing grouping
+            if( item->Type() == PCB_GENERATOR_T )
+                continue;
 
+            candidates.push_back( item );
+        }
+    }
+
+    m_hitlist.clear();
+
+    for( BOARD_ITEM* item : candidates )
+    {
         if( frp.findString.IsEmpty() || item->Matches( frp, nullptr ) )
             m_hitlist.push_back( item );
     }
 
+    rememberSearch( aQuery );
+
     return (int) m_hitlist.size();
 }
 
@@ -414,8 +518,6 @@ NETS_SEARCH_HANDLER::NETS_SEARCH_HANDLER( PCB_EDIT_FRAME* aFrame ) :
 
 int NETS_SEARCH_HANDLER::Search( const wxString& aQuery )
 {
-    m_hitlist.clear();
-
     APP_SETTINGS_BASE::SEARCH_PANE& settings = m_frame->config()->m_SearchPane;
     EDA_SEARCH_DATA                 frp;
 
@@ -428,12 +530,31 @@ int NETS_SEARCH_HANDLER::Search( const wxString& aQuery )
 
     BOARD* board = m_frame->GetBoard();
 
-    for( NETINFO_ITEM* net : board->GetNetInfo() )
+    std::vector<BOARD_ITEM*> candidates;
+
+    if( canNarrowSearch( aQuery ) )
     {
-        if( net && ( aQuery.IsEmpty() || net->Matches( frp, nullptr ) ) )
-            m_hitlist.push_back( net );
+        candidates = std::move( m_hitlist );
+    }
+    else
+    {
+        for( NETINFO_ITEM* net : board->GetNetInfo() )
+        {
+            if( net )
+                candidates.push_back( net );
+        }
+    }
+
+    m_hitlist.clear();
+
+    for( BOARD_ITEM* item : candidates )
+    {
+        if( aQuery.IsEmpty() || item->Matches( frp, nullptr ) )
+            m_hitlist.push_back( item );
     }
 
+    rememberSearch( aQuery );
+
     return (int) m_hitlist.size();
 }
 
@@ -497,8 +618,6 @@ RATSNEST_SEARCH_HANDLER::RATSNEST_SEARCH_HANDLER( PCB_EDIT_FRAME* aFrame ) :
 
 int RATSNEST_SEARCH_HANDLER::Search( const wxString& aQuery )
 {
-    m_hitlist.clear();
-
     APP_SETTINGS_BASE::SEARCH_PANE& settings = m_frame->config()->m_SearchPane;
     EDA_SEARCH_DATA                 frp;
 
@@ -511,9 +630,28 @@ int RATSNEST_SEARCH_HANDLER::Search( const wxString& aQuery )
 
     BOARD* board = m_frame->GetBoard();
 
-    for( NETINFO_ITEM* net : board->GetNetInfo() )
+    std::vector<BOARD_ITEM*> candidates;
+
+    if( canNarrowSearch( aQuery ) )
+    {
+        candidates = std::move( m_hitlist );
+    }
+    else
+    {
+        for( NETINFO_ITEM* net : board->GetNetInfo() )
+        {
+            if( net )
+                candidates.push_back( net );
+        }
+    }
+
+    m_hitlist.clear();
+
+    for( BOARD_ITEM* item : candidates )
     {
-        if( net == nullptr || !net->Matches( frp, nullptr ) )
+        NETINFO_ITEM* net = static_cast<NETINFO_ITEM*>( item );
+
+        if( !net->Matches( frp, nullptr ) )
             continue;
 
         RN_NET* rn = board->GetConnectivity()->GetRatsnestForNet( net->GetNetCode() );
@@ -522,6 +660,8 @@ int RATSNEST_SEARCH_HANDLER::Search( const wxString& aQuery )
             m_hitlist.push_back( net );
     }
 
+    rememberSearch( aQuery );
+
     return (int) m_hitlist.size();
 }
 
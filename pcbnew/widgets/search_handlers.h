@@ -63,9 +63,29 @@ public:
 protected:
     virtual wxString getResultCell( BOARD_ITEM* aItem, int aCol ) = 0;
 
+    /**
+     * Return true if aQuery can be answered by rescanning only the previous hit list.
+     *
+     * Find-as-you-type queries usually extend the previous query, and for plain-text queries
+     * every new hit must already be in the old hit list, so the scan can be restricted to it.
+     * The shortcut is abandoned whenever the board has been modified (BOARD_COMMIT bumps the
+     * timestamp), the search settings changed, or the query uses wildcard/regex syntax whose
+     * matches aren't monotonic under appended characters.
+     */
+    bool canNarrowSearch( const wxString& aQuery ) const;
+
+    ///< Record the state the current hit list was computed from, for canNarrowSearch().
+    void rememberSearch( const wxString& aQuery );
+
 protected:
     PCB_EDIT_FRAME*          m_frame;
     std::vector<BOARD_ITEM*> m_hitlist;
+
+private:
+    wxString                 m_lastQuery;
+    int                      m_lastTimeStamp = -1;
+    bool                     m_lastAllFields = false;
+    bool                     m_lastMetadata = false;
 };
 
 
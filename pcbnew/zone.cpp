@@ -34,6 +34,7 @@
 #include <lset.h>
 #include <pad.h>
 #include <zone.h>
+#include <zone_triangulation_cache.h>
 #include <footprint.h>
 #include <string_utils.h>
 #include <properties/property_validators.h>
@@ -1302,19 +1303,40 @@ void ZONE::swapData( BOARD_ITEM* aImage )
 }
 
 
-void ZONE::CacheTriangulation( PCB_LAYER_ID aLayer )
+void ZONE::CacheTriangulation( PCB_LAYER_ID aLayer, ZONE_TRIANGULATION_CACHE* aCache )
 {
+    auto cacheOne =
+            [&]( SHAPE_POLY_SET& aPolySet, bool aPartition )
+            {
+                if( aCache )
+                {
+                    std::vector<std::unique_ptr<SHAPE_POLY_SET::TRIANGULATED_POLYGON>> hint;
+
+                    if( aCache->Get( aPolySet.GetHash(), hint ) )
+                    {
+                        aPolySet.CacheTriangulation( hint, aPartition );
+                        return;
+                    }
+
+                    aPolySet.CacheTriangulation( aPartition );
+                    aCache->Put( aPolySet );
+                    return;
+                }
+
+                aPolySet.CacheTriangulation( aPartition );
+            };
+
     if( aLayer == UNDEFINED_LAYER )
     {
         for( auto& [ layer, poly ] : m_FilledPolysList )
-            poly->CacheTriangulation();
+            cacheOne( *poly, true );
 
-        m_Poly->CacheTriangulation( false );
+        cacheOne( *m_Poly, false );
     }
     else
     {
         if( m_FilledPolysList.count( aLayer ) )
-            m_FilledPolysList[ aLayer ]->CacheTriangulation();
+            cacheOne( *m_FilledPolysList[ aLayer ], true );
     }
 }
 
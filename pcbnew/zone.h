@@ -40,6 +40,7 @@
 
 
 class LINE_READER;
+class ZONE_TRIANGULATION_CACHE;
 class PCB_EDIT_FRAME;
 class BOARD;
 class ZONE;
@@ -609,7 +610,8 @@ public:
      * Create a list of triangles that "fill" the solid areas used for instance to draw
      * these solid areas on OpenGL.
      */
-    void CacheTriangulation( PCB_LAYER_ID aLayer = UNDEFINED_LAYER );
+    void CacheTriangulation( PCB_LAYER_ID aLayer = UNDEFINED_LAYER,
+                             ZONE_TRIANGULATION_CACHE* aCache = nullptr );
 
     /**
      * Set the list of filled polygons.
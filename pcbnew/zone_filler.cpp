@@ -23,6 +23,7 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
  */
 
+#include <deque>
 #include <future>
 #include <core/kicad_algo.h>
 #include <advanced_config.h>
@@ -47,6 +48,8 @@
 #include <geometry/geometry_utils.h>
 #include <geometry/vertex_set.h>
 #include <kidialog.h>
+#include <core/profile_trace.h>
+#include <perf_counters.h>
 #include <thread_pool.h>
 #include <math/util.h>      // for KiROUND
 #include "zone_filler.h"
@@ -216,6 +219,26 @@ ZONE_FILLER::~ZONE_FILLER()
 }
 
 
+bool ZONE_FILLER::isZoneDirty( const ZONE* aZone ) const
+{
+    if( m_dirtyRegions.empty() )
+        return true;
+
+    // Anything within the worst-case clearance of a change can modify the knockouts (and
+    // therefore the fill), so test against an inflated zone extent.
+    BOX2I zoneBBox = aZone->GetBoundingBox();
+    zoneBBox.Inflate( m_worstClearance );
+
+    for( const BOX2I& region : m_dirtyRegions )
+    {
+        if( zoneBBox.Intersects( region ) )
+            return true;
+    }
+
+    return false;
+}
+
+
 void ZONE_FILLER::SetProgressReporter( PROGRESS_REPORTER* aReporter )
 {
     m_progressReporter = aReporter;
@@ -237,6 +260,10 @@ bool ZONE_FILLER::Fill( const std::vector<ZONE*>& aZones, bool aCheck, wxWindow*
 {
     std::lock_guard<KISPINLOCK> lock( m_board->GetConnectivity()->GetLock() );
 
+    PERF_SCOPED_SAMPLE perfSample( "zone_fill" );
+    TRACE_SCOPE        traceScope( "ZONE_FILLER::Fill", "pcbnew" );
+    PERF_COUNTERS::Get().Increment( "zone_fill.zones", (int64_t) aZones.size() );
+
     std::vector<std::pair<ZONE*, PCB_LAYER_ID>>               toFill;
     std::map<std::pair<ZONE*, PCB_LAYER_ID>, HASH_128>        oldFillHashes;
     std::map<ZONE*, std::map<PCB_LAYER_ID, ISOLATED_ISLANDS>> isolatedIslandsMap;
@@ -474,6 +501,11 @@ bool ZONE_FILLER::Fill( const std::vector<ZONE*>& aZones, bool aCheck, wxWindow*
         if( zone->GetNumCorners() <= 2 )
             continue;
 
+        // Incremental refill: zones whose existing fill cannot be affected by the dirty
+        // regions keep their current fill.
+        if( zone->IsFilled() && !isZoneDirty( zone ) )
+            continue;
+
         if( m_commit )
             m_commit->Modify( zone );
 
@@ -621,7 +653,7 @@ bool ZONE_FILLER::Fill( const std::vector<ZONE*>& aZones, bool aCheck, wxWindow*
                 [&, fillItem]()
                 {
                     return fill_lambda( fillItem );
-                } ), 0 ) );
+                }, TP_PRIORITY_BATCH ), 0 ) );
     }
 
     while( !cancelled && finished != 2 * toFill.size() )
@@ -652,7 +684,7 @@ bool ZONE_FILLER::Fill( const std::vector<ZONE*>& aZones, bool aCheck, wxWindow*
                                 [&, idx = ii]()
                                 {
                                     return fill_lambda( toFill[idx] );
-                                } );
+                                }, TP_PRIORITY_BATCH );
                     }
                     else if( ret.second == 1 )
                     {
@@ -660,7 +692,7 @@ bool ZONE_FILLER::Fill( const std::vector<ZONE*>& aZones, bool aCheck, wxWindow*
                                 [&, idx = ii]()
                                 {
                                     return tesselate_lambda( toFill[idx] );
-                                } );
+                                }, TP_PRIORITY_BATCH );
                     }
                 }
             }
@@ -987,7 +1019,7 @@ void ZONE_FILLER::addKnockout( BOARD_ITEM* aItem, PCB_LAYER_ID aLayer, int aGap,
                 aHoles.Append( pt );
         }
         else
-            aHoles.Append( poly );
+            aHoles.Append( std::move( poly ) );
     }
     else
     {
@@ -1608,7 +1640,7 @@ void ZONE_FILLER::buildCopperItemClearances( const ZONE* aZone, PCB_LAYER_ID aLa
                     {
                         SHAPE_POLY_SET hole = aFootprint->GetCourtyard( aLayer );
                         hole.Inflate( gap, CORNER_STRATEGY::ROUND_ALL_CORNERS, m_maxError );
-                        aHoles.Append( hole );
+                        aHoles.Append( std::move( hole ) );
                     }
                 }
             };
@@ -1714,7 +1746,7 @@ void ZONE_FILLER::buildCopperItemClearances( const ZONE* aZone, PCB_LAYER_ID aLa
                         SHAPE_POLY_SET poly;
                         aKnockout->TransformShapeToPolygon( poly, aLayer, gap + extra_margin,
                                                             m_maxError, ERROR_OUTSIDE );
-                        aHoles.Append( poly );
+                        aHoles.Append( std::move( poly ) );
                     }
                 }
             };
@@ -2197,6 +2229,11 @@ bool ZONE_FILLER::fillNonCopperZone( const ZONE* aZone, PCB_LAYER_ID aLayer,
     aFillPolys = aSmoothedOutline;
     aFillPolys.BooleanSubtract( clearanceHoles );
 
+    // Collect the keepout outlines and subtract them in a single batch sweep rather than
+    // one Boolean per keepout.
+    std::deque<SHAPE_POLY_SET>         arclessOutlines;
+    std::vector<const SHAPE_POLY_SET*> keepoutOutlines;
+
     auto subtractKeepout =
             [&]( ZONE* candidate )
             {
@@ -2212,13 +2249,13 @@ bool ZONE_FILLER::fillNonCopperZone( const ZONE* aZone, PCB_LAYER_ID aLayer,
                     {
                         if( candidate->Outline()->ArcCount() == 0 )
                         {
-                            aFillPolys.BooleanSubtract( *candidate->Outline() );
+                            keepoutOutlines.push_back( candidate->Outline() );
                         }
                         else
                         {
-                            SHAPE_POLY_SET keepoutOutline( *candidate->Outline() );
-                            keepoutOutline.ClearArcs();
-                            aFillPolys.BooleanSubtract( keepoutOutline );
+                            arclessOutlines.emplace_back( *candidate->Outline() );
+                            arclessOutlines.back().ClearArcs();
+                            keepoutOutlines.push_back( &arclessOutlines.back() );
                         }
                     }
                 }
@@ -2241,6 +2278,9 @@ bool ZONE_FILLER::fillNonCopperZone( const ZONE* aZone, PCB_LAYER_ID aLayer,
             subtractKeepout( keepout );
     }
 
+    if( !keepoutOutlines.empty() )
+        aFillPolys.BooleanSubtract( keepoutOutlines );
+
     // Features which are min_width should survive pruning; features that are *less* than
     // min_width should not.  Therefore we subtract epsilon from the min_width when
     // deflating/inflating.
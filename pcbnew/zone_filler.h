@@ -57,6 +57,18 @@ public:
      */
     bool Fill( const std::vector<ZONE*>& aZones, bool aCheck = false, wxWindow* aParent = nullptr );
 
+    /**
+     * Restrict the fill to zones whose filled areas might be affected by the given dirty
+     * regions (typically the bounding boxes of the items changed in a BOARD_COMMIT; see
+     * BOARD_COMMIT::GetChangedAreas()).
+     *
+     * Zones with a valid existing fill that don't come within the worst-case clearance of
+     * any dirty region keep their current fill and are skipped entirely, which turns a
+     * board-wide refill into one proportional to the size of the edit.  An empty list (the
+     * default) refills everything.
+     */
+    void SetDirtyRegions( const std::vector<BOX2I>& aRegions ) { m_dirtyRegions = aRegions; }
+
     bool IsDebug() const { return m_debugZoneFiller; }
 
 private:
@@ -125,6 +137,12 @@ private:
      */
     bool fillSingleZone( ZONE* aZone, PCB_LAYER_ID aLayer, SHAPE_POLY_SET& aFillPolys );
 
+    /**
+     * @return true if aZone's fill could be affected by one of the dirty regions (or if no
+     * dirty regions have been set, in which case every zone is considered dirty).
+     */
+    bool isZoneDirty( const ZONE* aZone ) const;
+
     /**
      * for zones having the ZONE_FILL_MODE::ZONE_FILL_MODE::HATCH_PATTERN, create a grid pattern
      * in filled areas of aZone, giving to the filled polygons a fill style like a grid
@@ -136,6 +154,7 @@ private:
                                  SHAPE_POLY_SET& aFillPolys );
 
     BOARD*                m_board;
+    std::vector<BOX2I>    m_dirtyRegions;       // when non-empty, only refill zones touching these
     SHAPE_POLY_SET        m_boardOutline;       // the board outlines, if exists
     bool                  m_brdOutlinesValid;   // true if m_boardOutline is well-formed
     COMMIT*               m_commit;
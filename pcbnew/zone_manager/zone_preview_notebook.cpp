@@ -31,6 +31,7 @@
 #include <wx/sizer.h>
 #include <wx/dcbuffer.h>
 #include <board.h>
+#include <hash.h>
 #include <zone.h>
 #include <gal/color4d.h>
 #include <widgets/color_swatch.h>
@@ -53,24 +54,66 @@ public:
     ZONE_PREVIEW_NOTEBOOK_PAGE( wxWindow* aParent, BOARD* aBoard, ZONE* aZone, PCB_LAYER_ID aLayer,
                                 GAL_DISPLAY_OPTIONS_IMPL& aOpts ) :
             wxPanel( aParent ),
+            m_board( aBoard ),
+            m_zone( aZone ),
             m_layer( aLayer ),
+            m_opts( aOpts ),
             m_canvas( nullptr )
     {
         SetSizer( new wxBoxSizer( wxHORIZONTAL ) );
+    }
+
+    /**
+     * Build the GAL canvas on first use.  Creating a canvas clones the zone outline and spins up
+     * a GAL backend, so it is deferred until the page actually becomes visible.
+     */
+    void EnsureCanvas()
+    {
+        if( m_canvas )
+            return;
 
-        m_canvas = new ZONE_PREVIEW_CANVAS( aBoard, aZone->Clone( aLayer ), aLayer, this, aOpts );
+        m_canvas = new ZONE_PREVIEW_CANVAS( m_board, m_zone->Clone( m_layer ), m_layer, this, m_opts );
         GetSizer()->Add( m_canvas, 1, wxEXPAND );
+        Layout();
+        m_canvas->ZoomFitScreen();
     }
 
     int  GetLayer() const { return m_layer; }
     ZONE_PREVIEW_CANVAS* GetCanvas() const { return m_canvas; }
 
 private:
-    int                  m_layer;
-    ZONE_PREVIEW_CANVAS* m_canvas;
+    BOARD*                    m_board;
+    ZONE*                     m_zone;
+    PCB_LAYER_ID              m_layer;
+    GAL_DISPLAY_OPTIONS_IMPL& m_opts;
+    ZONE_PREVIEW_CANVAS*      m_canvas;
 };
 
 
+/**
+ * Hash the zone parameters a preview canvas depends on, so cached pages can be reused while the
+ * zone is unchanged and rebuilt when its outline, net, hatching or fill state changes.
+ */
+static std::size_t zoneParameterHash( ZONE* aZone )
+{
+    const HASH_128 outlineHash = aZone->Outline()->GetHash();
+
+    std::size_t hash = 0;
+    hash_combine( hash, outlineHash.Value64[0], outlineHash.Value64[1], aZone->GetNetCode(),
+                  static_cast<int>( aZone->GetHatchStyle() ), aZone->GetBorderHatchPitch() );
+
+    for( PCB_LAYER_ID layer : aZone->GetLayerSet().Seq() )
+    {
+        hash_combine( hash, static_cast<int>( layer ) );
+
+        if( const std::shared_ptr<SHAPE_POLY_SET>& fill = aZone->GetFilledPolysList( layer ) )
+            hash_combine( hash, fill->GetHash().Value64[0] );
+    }
+
+    return hash;
+}
+
+
 ZONE_PREVIEW_NOTEBOOK::ZONE_PREVIEW_NOTEBOOK( wxWindow* aParent, PCB_BASE_FRAME* aPcbFrame ) :
         wxNotebook( aParent, wxID_ANY, wxDefaultPosition, wxDefaultSize ),
         m_pcbFrame( aPcbFrame )
@@ -105,26 +148,55 @@ void ZONE_PREVIEW_NOTEBOOK::OnZoneSelectionChanged( ZONE* aZone )
     if( GetSelection() >= 0 && GetSelection() < (int) GetPageCount() )
         preferredLayer = static_cast<ZONE_PREVIEW_NOTEBOOK_PAGE*>( GetCurrentPage() )->GetLayer();
 
+    // Detach (but keep alive) the pages of the previously displayed zone; they stay in
+    // m_pageCache and can be reattached later without rebuilding their canvases.
     while( GetPageCount() )
+    {
+        GetPage( 0 )->Hide();
         RemovePage( 0 );
+    }
 
     if( !aZone )
         return;
 
+    BOARD*            board = m_pcbFrame->GetBoard();
+    const std::size_t paramsHash = zoneParameterHash( aZone );
+    auto              cacheIt = m_pageCache.find( aZone );
+
+    if( cacheIt != m_pageCache.end() && cacheIt->second.ParamsHash != paramsHash )
+    {
+        // The zone parameters changed since the pages were built; the cached canvases are stale.
+        for( ZONE_PREVIEW_NOTEBOOK_PAGE* page : cacheIt->second.Pages )
+            page->Destroy();
+
+        m_pageCache.erase( cacheIt );
+        cacheIt = m_pageCache.end();
+    }
+
+    if( cacheIt == m_pageCache.end() )
+    {
+        PAGE_CACHE_ENTRY entry;
+        entry.ParamsHash = paramsHash;
+
+        for( PCB_LAYER_ID layer : aZone->GetLayerSet().UIOrder() )
+        {
+            entry.Pages.push_back( new ZONE_PREVIEW_NOTEBOOK_PAGE( this, board, aZone, layer,
+                                                                   m_pcbFrame->GetGalDisplayOptions() ) );
+        }
+
+        cacheIt = m_pageCache.emplace( aZone, std::move( entry ) ).first;
+    }
+
     ZONE_PREVIEW_NOTEBOOK_PAGE* preferredPage = nullptr;
 
-    for( PCB_LAYER_ID layer : aZone->GetLayerSet().UIOrder() )
+    for( ZONE_PREVIEW_NOTEBOOK_PAGE* page : cacheIt->second.Pages )
     {
-        BOARD*                      board = m_pcbFrame->GetBoard();
-        wxString                    layerName = board->GetLayerName( layer );
-        ZONE_PREVIEW_NOTEBOOK_PAGE* page = new ZONE_PREVIEW_NOTEBOOK_PAGE( this, board, aZone, layer,
-                                                                           m_pcbFrame->GetGalDisplayOptions() );
+        PCB_LAYER_ID layer = ToLAYER_ID( page->GetLayer() );
 
-        AddPage( page, layerName, false, layer );
-        page->Layout();
-        page->GetCanvas()->ZoomFitScreen();
+        page->Show();
+        AddPage( page, board->GetLayerName( layer ), false, layer );
 
-        if( layer == preferredLayer )
+        if( page->GetLayer() == preferredLayer )
             preferredPage = page;
     }
 
@@ -133,6 +205,9 @@ void ZONE_PREVIEW_NOTEBOOK::OnZoneSelectionChanged( ZONE* aZone )
 
     SetSelection( FindPage( preferredPage ) );
 
+    // Only the visible page gets a canvas; the other layers build theirs on first activation.
+    preferredPage->EnsureCanvas();
+
     // Reinit canvas size parameters and display
     PostSizeEvent();
 }
@@ -143,6 +218,9 @@ void ZONE_PREVIEW_NOTEBOOK::OnPageChanged( wxNotebookEvent& aEvent )
     SetSelection( aEvent.GetSelection() );
     aEvent.Skip();
 
+    if( aEvent.GetSelection() >= 0 && aEvent.GetSelection() < (int) GetPageCount() )
+        static_cast<ZONE_PREVIEW_NOTEBOOK_PAGE*>( GetPage( aEvent.GetSelection() ) )->EnsureCanvas();
+
     // Reinit canvas size parameters and display
     PostSizeEvent();
 }
@@ -151,5 +229,8 @@ void ZONE_PREVIEW_NOTEBOOK::OnPageChanged( wxNotebookEvent& aEvent )
 void ZONE_PREVIEW_NOTEBOOK::FitCanvasToScreen()
 {
     for( int ii = 0; ii < (int) GetPageCount(); ++ii )
-        static_cast<ZONE_PREVIEW_NOTEBOOK_PAGE*>( GetPage( ii ) )->GetCanvas()->ZoomFitScreen();
+    {
+        if( ZONE_PREVIEW_CANVAS* canvas = static_cast<ZONE_PREVIEW_NOTEBOOK_PAGE*>( GetPage( ii ) )->GetCanvas() )
+            canvas->ZoomFitScreen();
+    }
 }
\ No newline at end of file
@@ -24,13 +24,16 @@
 
 #pragma once
 
+#include <cstddef>
 #include <unordered_map>
+#include <vector>
 #include <wx/window.h>
 #include <wx/panel.h>
 #include <wx/notebook.h>
 
 class PCB_BASE_FRAME;
 class ZONE;
+class ZONE_PREVIEW_NOTEBOOK_PAGE;
 
 
 class ZONE_PREVIEW_NOTEBOOK : public wxNotebook
@@ -46,5 +49,16 @@ public:
     void FitCanvasToScreen();
 
 private:
-    PCB_BASE_FRAME* m_pcbFrame;
+    /**
+     * Preview pages already built for a zone, together with the parameter hash they were built
+     * from so they can be discarded when the zone changes.
+     */
+    struct PAGE_CACHE_ENTRY
+    {
+        std::size_t                              ParamsHash;
+        std::vector<ZONE_PREVIEW_NOTEBOOK_PAGE*> Pages;
+    };
+
+    PCB_BASE_FRAME*                             m_pcbFrame;
+    std::unordered_map<ZONE*, PAGE_CACHE_ENTRY> m_pageCache;
 };
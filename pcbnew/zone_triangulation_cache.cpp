@@ -0,0 +1,308 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright The KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, you may find one here:
+ * http://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+ * or you may search the http://www.gnu.org website for the version 2 license,
+ * or you may write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
+ */
+
+#include "zone_triangulation_cache.h"
+
+#include <cstring>
+
+#include <wx/ffile.h>
+
+// File layout (native endianness; the cache is a per-machine sidecar):
+//   u32 magic, u32 version, u32 entryCount
+//   per entry: 16-byte polygon hash, u32 payloadLength, payload
+// Payload:
+//   u32 polyCount
+//   per poly: i32 sourceOutline, u32 vertexCount, u32 triangleCount,
+//             vertexCount * ( i32 x, i32 y ), triangleCount * ( i32 a, i32 b, i32 c )
+static constexpr uint32_t TRI_CACHE_MAGIC = 0x4B545243;     // 'KTRC'
+static constexpr uint32_t TRI_CACHE_VERSION = 1;
+
+
+ZONE_TRIANGULATION_CACHE::ZONE_TRIANGULATION_CACHE( const wxString& aBoardFilename ) :
+        m_path( aBoardFilename + wxT( ".tri-cache" ) )
+{
+}
+
+
+std::string ZONE_TRIANGULATION_CACHE::hashKey( const HASH_128& aHash )
+{
+    return std::string( reinterpret_cast<const char*>( aHash.Value8 ), sizeof( aHash.Value8 ) );
+}
+
+
+namespace
+{
+
+struct READER
+{
+    const uint8_t* data;
+    size_t         size;
+    size_t         pos = 0;
+    bool           ok = true;
+
+    template <typename T>
+    T get()
+    {
+        T val{};
+
+        if( pos + sizeof( T ) > size )
+        {
+            ok = false;
+            return val;
+        }
+
+        memcpy( &val, data + pos, sizeof( T ) );
+        pos += sizeof( T );
+        return val;
+    }
+
+    bool skip( size_t aBytes )
+    {
+        if( pos + aBytes > size )
+        {
+            ok = false;
+            return false;
+        }
+
+        pos += aBytes;
+        return true;
+    }
+};
+
+
+template <typename T>
+void append( std::vector<uint8_t>& aBuf, T aVal )
+{
+    size_t at = aBuf.size();
+    aBuf.resize( at + sizeof( T ) );
+    memcpy( aBuf.data() + at, &aVal, sizeof( T ) );
+}
+
+
+bool decodePayload( const uint8_t* aData, size_t aLength,
+                    std::vector<std::unique_ptr<SHAPE_POLY_SET::TRIANGULATED_POLYGON>>& aOut )
+{
+    READER r{ aData, aLength };
+
+    uint32_t polyCount = r.get<uint32_t>();
+
+    for( uint32_t ii = 0; r.ok && ii < polyCount; ++ii )
+    {
+        int32_t  sourceOutline = r.get<int32_t>();
+        uint32_t vertexCount = r.get<uint32_t>();
+        uint32_t triangleCount = r.get<uint32_t>();
+
+        if( !r.ok )
+            return false;
+
+        auto poly = std::make_unique<SHAPE_POLY_SET::TRIANGULATED_POLYGON>( sourceOutline );
+
+        for( uint32_t jj = 0; r.ok && jj < vertexCount; ++jj )
+        {
+            int32_t x = r.get<int32_t>();
+            int32_t y = r.get<int32_t>();
+            poly->AddVertex( VECTOR2I( x, y ) );
+        }
+
+        for( uint32_t jj = 0; r.ok && jj < triangleCount; ++jj )
+        {
+            int32_t a = r.get<int32_t>();
+            int32_t b = r.get<int32_t>();
+            int32_t c = r.get<int32_t>();
+            poly->AddTriangle( a, b, c );
+        }
+
+        if( !r.ok )
+            return false;
+
+        aOut.push_back( std::move( poly ) );
+    }
+
+    return r.ok;
+}
+
+} // namespace
+
+
+bool ZONE_TRIANGULATION_CACHE::Load()
+{
+    m_buffer.clear();
+    m_index.clear();
+
+    if( !wxFileExists( m_path ) )
+        return false;
+
+    wxFFile file( m_path, wxT( "rb" ) );
+
+    if( !file.IsOpened() )
+        return false;
+
+    wxFileOffset length = file.Length();
+
+    if( length <= 0 )
+        return false;
+
+    m_buffer.resize( (size_t) length );
+
+    if( file.Read( m_buffer.data(), m_buffer.size() ) != (size_t) length )
+    {
+        m_buffer.clear();
+        return false;
+    }
+
+    READER r{ m_buffer.data(), m_buffer.size() };
+
+    if( r.get<uint32_t>() != TRI_CACHE_MAGIC || r.get<uint32_t>() != TRI_CACHE_VERSION )
+    {
+        m_buffer.clear();
+        return false;
+    }
+
+    uint32_t entryCount = r.get<uint32_t>();
+
+    for( uint32_t ii = 0; r.ok && ii < entryCount; ++ii )
+    {
+        if( r.pos + 16 > r.size )
+            break;
+
+        std::string key( reinterpret_cast<const char*>( r.data + r.pos ), 16 );
+        r.skip( 16 );
+
+        uint32_t payloadLength = r.get<uint32_t>();
+
+        if( !r.ok || r.pos + payloadLength > r.size )
+            break;
+
+        m_index[ key ] = { r.pos, payloadLength };
+        r.skip( payloadLength );
+    }
+
+    return true;
+}
+
+
+bool ZONE_TRIANGULATION_CACHE::Get(
+        const HASH_128& aHash,
+        std::vector<std::unique_ptr<SHAPE_POLY_SET::TRIANGULATED_POLYGON>>& aData ) const
+{
+    std::string key = hashKey( aHash );
+
+    auto it = m_index.find( key );
+
+    if( it == m_index.end() )
+        return false;
+
+    if( !decodePayload( m_buffer.data() + it->second.offset, it->second.length, aData ) )
+    {
+        aData.clear();
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_used.insert( key );
+
+    return true;
+}
+
+
+void ZONE_TRIANGULATION_CACHE::Put( const SHAPE_POLY_SET& aPolySet )
+{
+    if( !aPolySet.IsTriangulationUpToDate() )
+        return;
+
+    std::vector<uint8_t> payload;
+
+    append<uint32_t>( payload, aPolySet.TriangulatedPolyCount() );
+
+    for( unsigned ii = 0; ii < aPolySet.TriangulatedPolyCount(); ++ii )
+    {
+        const SHAPE_POLY_SET::TRIANGULATED_POLYGON* poly = aPolySet.TriangulatedPolygon( ii );
+
+        append<int32_t>( payload, poly->GetSourceOutlineIndex() );
+        append<uint32_t>( payload, (uint32_t) poly->GetVertexCount() );
+        append<uint32_t>( payload, (uint32_t) poly->GetTriangleCount() );
+
+        for( const VECTOR2I& vertex : poly->Vertices() )
+        {
+            append<int32_t>( payload, vertex.x );
+            append<int32_t>( payload, vertex.y );
+        }
+
+        for( const SHAPE_POLY_SET::TRIANGULATED_POLYGON::TRI& tri : poly->Triangles() )
+        {
+            append<int32_t>( payload, tri.a );
+            append<int32_t>( payload, tri.b );
+            append<int32_t>( payload, tri.c );
+        }
+    }
+
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_pending[ hashKey( aPolySet.GetHash() ) ] = std::move( payload );
+}
+
+
+bool ZONE_TRIANGULATION_CACHE::Save() const
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    // Keep what was used or added this session; anything else belongs to fills that no
+    // longer exist on the board.
+    std::map<std::string, std::pair<const uint8_t*, size_t>> entries;
+
+    for( const std::string& key : m_used )
+    {
+        auto it = m_index.find( key );
+
+        if( it != m_index.end() )
+            entries[ key ] = { m_buffer.data() + it->second.offset, it->second.length };
+    }
+
+    for( const auto& [ key, payload ] : m_pending )
+        entries[ key ] = { payload.data(), payload.size() };
+
+    if( entries.empty() )
+        return false;
+
+    wxFFile file( m_path, wxT( "wb" ) );
+
+    if( !file.IsOpened() )
+        return false;
+
+    std::vector<uint8_t> header;
+    append<uint32_t>( header, TRI_CACHE_MAGIC );
+    append<uint32_t>( header, TRI_CACHE_VERSION );
+    append<uint32_t>( header, (uint32_t) entries.size() );
+
+    file.Write( header.data(), header.size() );
+
+    for( const auto& [ key, payload ] : entries )
+    {
+        file.Write( key.data(), key.size() );
+
+        uint32_t payloadLength = (uint32_t) payload.second;
+        file.Write( &payloadLength, sizeof( payloadLength ) );
+        file.Write( payload.first, payload.second );
+    }
+
+    return true;
+}
@@ -0,0 +1,93 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright The KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, you may find one here:
+ * http://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+ * or you may search the http://www.gnu.org website for the version 2 license,
+ * or you may write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
+ */
+
+#ifndef ZONE_TRIANGULATION_CACHE_H
+#define ZONE_TRIANGULATION_CACHE_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <wx/string.h>
+
+#include <geometry/shape_poly_set.h>
+#include <hash_128.h>
+
+/**
+ * Persistent cache of zone-fill triangulations, stored in a sidecar file next to the board.
+ *
+ * Entries are keyed by the polygon checksum (SHAPE_POLY_SET::GetHash()), so a stale entry
+ * can never be applied to a modified fill: a changed polygon simply misses and is
+ * re-triangulated (in parallel, by BOARD::CacheTriangulation()'s existing thread-pool
+ * dispatch).  The file is read into memory in one go and entries are decoded lazily on
+ * lookup, so concurrent zone tasks only pay for the polygons they actually reuse.  Save()
+ * keeps the entries used or added this session and drops the rest, which garbage-collects
+ * fills that no longer exist.
+ *
+ * Enabled via the EnableTriangulationCache advanced config setting.
+ */
+class ZONE_TRIANGULATION_CACHE
+{
+public:
+    ZONE_TRIANGULATION_CACHE( const wxString& aBoardFilename );
+
+    ///< Read the sidecar file; a missing or malformed file just leaves the cache empty.
+    bool Load();
+
+    ///< Write the entries used or added this session back to the sidecar file.
+    bool Save() const;
+
+    /**
+     * Look up the triangulation for a polygon hash and decode it into aData.
+     *
+     * @return true on a hit; the entry is marked as used so Save() keeps it.
+     */
+    bool Get( const HASH_128& aHash,
+              std::vector<std::unique_ptr<SHAPE_POLY_SET::TRIANGULATED_POLYGON>>& aData ) const;
+
+    ///< Store the polygon set's current (up-to-date) triangulation under its hash.
+    void Put( const SHAPE_POLY_SET& aPolySet );
+
+private:
+    struct ENTRY_VIEW
+    {
+        size_t offset;      ///< payload offset into m_buffer
+        size_t length;      ///< payload length
+    };
+
+    ///< 16 raw hash bytes, used as the map key for both stored and pending entries.
+    static std::string hashKey( const HASH_128& aHash );
+
+    wxString                          m_path;
+    std::vector<uint8_t>              m_buffer;   ///< raw cache image; decoded lazily
+    std::map<std::string, ENTRY_VIEW> m_index;
+
+    mutable std::mutex                           m_mutex;
+    mutable std::set<std::string>                m_used;     ///< entries hit this session
+    std::map<std::string, std::vector<uint8_t>>  m_pending;  ///< entries added this session
+};
+
+#endif
@@ -89,6 +89,28 @@ BOOST_AUTO_TEST_CASE( IteratingSetBits )
     BOOST_CHECK_EQUAL( reverse_set_bits[1], 2 );
 }
 
+BOOST_AUTO_TEST_CASE( IteratingSetBitsAcrossWords )
+{
+    // Exercise the word-wise set-bit search across the 64-bit storage boundaries
+    BASE_SET bs( 200 );
+    bs.set( 0 );
+    bs.set( 63 );
+    bs.set( 64 );
+    bs.set( 130 );
+    bs.set( 199 );
+
+    std::vector<size_t> set_bits;
+    for( auto it = bs.set_bits_begin(); it != bs.set_bits_end(); ++it )
+        set_bits.push_back( *it );
+
+    BOOST_CHECK_EQUAL( set_bits.size(), 5 );
+    BOOST_CHECK_EQUAL( set_bits[0], 0 );
+    BOOST_CHECK_EQUAL( set_bits[1], 63 );
+    BOOST_CHECK_EQUAL( set_bits[2], 64 );
+    BOOST_CHECK_EQUAL( set_bits[3], 130 );
+    BOOST_CHECK_EQUAL( set_bits[4], 199 );
+}
+
 // Test equality operator
 BOOST_AUTO_TEST_CASE( BASE_SETEqualityOperator )
 {
@@ -151,6 +173,29 @@ BOOST_AUTO_TEST_CASE(BASE_SETCompareFunction)
 }
 
 
+// Compare equal-sized multi-word sets (word-wise path): lowest differing bit decides
+BOOST_AUTO_TEST_CASE(BASE_SETCompareMultiWord)
+{
+    BASE_SET set1( 200 );
+    BASE_SET set2( 200 );
+
+    set1.set( 70 );
+    set2.set( 70 );
+
+    BOOST_CHECK_EQUAL( set1.compare( set2 ), 0 );
+
+    set1.set( 130 );
+    BOOST_CHECK_EQUAL( set1.compare( set2 ), 1 );
+    BOOST_CHECK_EQUAL( set2.compare( set1 ), -1 );
+    BOOST_CHECK( set2 < set1 );
+
+    // A lower differing bit outweighs a higher one
+    set2.set( 5 );
+    BOOST_CHECK_EQUAL( set2.compare( set1 ), 1 );
+    BOOST_CHECK( set1 < set2 );
+}
+
+
 // Test boolean operator&=
 BOOST_AUTO_TEST_CASE(BASE_SETAndAssignment)
 {
@@ -167,6 +212,25 @@ BOOST_AUTO_TEST_CASE(BASE_SETAndAssignment)
     BOOST_CHECK_EQUAL( bs1.test( 3 ), true );
 }
 
+// Test operator&= against a shorter operand: its missing tail reads as zero
+BOOST_AUTO_TEST_CASE(BASE_SETAndAssignmentMismatchedSizes)
+{
+    BASE_SET bs1( 200 );
+    BASE_SET bs2( 10 );
+    bs1.set( 3 );
+    bs1.set( 70 );
+    bs1.set( 130 );
+    bs2.set( 3 );
+    bs2.set( 4 );
+
+    bs1 &= bs2;
+    BOOST_CHECK_EQUAL( bs1.size(), 200 );
+    BOOST_CHECK_EQUAL( bs1.count(), 1 );
+    BOOST_CHECK_EQUAL( bs1.test( 3 ), true );
+    BOOST_CHECK_EQUAL( bs1.test( 70 ), false );
+    BOOST_CHECK_EQUAL( bs1.test( 130 ), false );
+}
+
 // Test boolean operator|=
 BOOST_AUTO_TEST_CASE(BASE_SETOrAssignment)
 {
@@ -182,6 +246,21 @@ BOOST_AUTO_TEST_CASE(BASE_SETOrAssignment)
     BOOST_CHECK_EQUAL( bs1.test( 3 ), true );
 }
 
+// Test operator|= against a shorter operand: the longer operand's tail is unchanged
+BOOST_AUTO_TEST_CASE(BASE_SETOrAssignmentMismatchedSizes)
+{
+    BASE_SET bs1( 200 );
+    BASE_SET bs2( 10 );
+    bs1.set( 130 );
+    bs2.set( 2 );
+
+    bs1 |= bs2;
+    BOOST_CHECK_EQUAL( bs1.size(), 200 );
+    BOOST_CHECK_EQUAL( bs1.count(), 2 );
+    BOOST_CHECK_EQUAL( bs1.test( 2 ), true );
+    BOOST_CHECK_EQUAL( bs1.test( 130 ), true );
+}
+
 // Test boolean operator^=
 BOOST_AUTO_TEST_CASE(BASE_SETXorAssignment)
 {
@@ -0,0 +1,150 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright The KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, you may find one here:
+ * http://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+ * or you may search the http://www.gnu.org website for the version 2 license,
+ * or you may write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
+ */
+
+/**
+ * @file test_batch_router.cpp
+ * Smoke tests for the headless batch autorouting engine
+ */
+
+#include <qa_utils/wx_utils/unit_test_utils.h>
+#include <pcbnew_utils/board_test_utils.h>
+
+#include <autorouter/batch_router.h>
+#include <board.h>
+#include <board_commit.h>
+#include <board_design_settings.h>
+#include <connectivity/connectivity_data.h>
+#include <drc/drc_engine.h>
+#include <footprint.h>
+#include <netinfo.h>
+#include <pad.h>
+#include <pcb_track.h>
+#include <tool/tool_manager.h>
+
+
+namespace
+{
+
+struct BATCH_ROUTER_TEST_FIXTURE
+{
+    BATCH_ROUTER_TEST_FIXTURE()
+    {
+        m_board = std::make_unique<BOARD>();
+        m_board->SetCopperLayerCount( 2 );
+
+        BOARD_DESIGN_SETTINGS& bds = m_board->GetDesignSettings();
+
+        auto drcEngine = std::make_shared<DRC_ENGINE>( m_board.get(), &bds );
+        drcEngine->InitEngine( wxFileName() );
+        bds.m_DRCEngine = drcEngine;
+    }
+
+    FOOTPRINT* CreateFootprintWithPad( const VECTOR2I& aPos, NETINFO_ITEM* aNet,
+                                       const wxString& aRef )
+    {
+        FOOTPRINT* fp = new FOOTPRINT( m_board.get() );
+        fp->SetPosition( aPos );
+        fp->SetReference( aRef );
+
+        PAD* pad = new PAD( fp );
+        pad->SetPosition( aPos );
+        pad->SetNumber( "1" );
+        pad->SetShape( PADSTACK::ALL_LAYERS, PAD_SHAPE::CIRCLE );
+        pad->SetSize( PADSTACK::ALL_LAYERS,
+                      VECTOR2I( pcbIUScale.mmToIU( 1.5 ), pcbIUScale.mmToIU( 1.5 ) ) );
+        pad->SetDrillSize( VECTOR2I( pcbIUScale.mmToIU( 0.8 ), pcbIUScale.mmToIU( 0.8 ) ) );
+        pad->SetAttribute( PAD_ATTRIB::PTH );
+        pad->SetLayerSet( LSET::AllCuMask() | LSET( { F_Mask, B_Mask } ) );
+        pad->SetNet( aNet );
+        fp->Add( pad );
+
+        m_board->Add( fp );
+        return fp;
+    }
+
+    int RunBatchRouter( bool aFanoutOnly )
+    {
+        m_board->BuildConnectivity();
+        m_board->GetConnectivity()->RecalculateRatsnest();
+
+        TOOL_MANAGER toolMgr;
+        toolMgr.SetEnvironment( m_board.get(), nullptr, nullptr, nullptr, nullptr );
+
+        KI_TEST::DUMMY_TOOL* dummyTool = new KI_TEST::DUMMY_TOOL();
+        toolMgr.RegisterTool( dummyTool );
+
+        BOARD_COMMIT commit( dummyTool );
+        BATCH_ROUTER router( m_board.get() );
+
+        router.SetFanoutOnly( aFanoutOnly );
+
+        int routed = router.Route( commit );
+
+        commit.Push( _( "Batch route" ), SKIP_UNDO | SKIP_SET_DIRTY );
+        return routed;
+    }
+
+    std::unique_ptr<BOARD> m_board;
+};
+
+} // namespace
+
+
+BOOST_FIXTURE_TEST_SUITE( BatchRouter, BATCH_ROUTER_TEST_FIXTURE )
+
+
+BOOST_AUTO_TEST_CASE( RouteSimpleConnection )
+{
+    NETINFO_ITEM* net = new NETINFO_ITEM( m_board.get(), "N1", 1 );
+    m_board->Add( net );
+
+    CreateFootprintWithPad( VECTOR2I( 0, 0 ), net, "U1" );
+    CreateFootprintWithPad( VECTOR2I( pcbIUScale.mmToIU( 10 ), 0 ), net, "U2" );
+
+    BOOST_CHECK_EQUAL( RunBatchRouter( false ), 1 );
+    BOOST_CHECK( m_board->Tracks().size() > 0 );
+
+    for( PCB_TRACK* track : m_board->Tracks() )
+        BOOST_CHECK_EQUAL( track->GetNetCode(), 1 );
+
+    // The connection must actually be closed
+    m_board->GetConnectivity()->RecalculateRatsnest();
+    BOOST_CHECK_EQUAL( m_board->GetConnectivity()->GetUnconnectedCount( false ), 0 );
+}
+
+
+BOOST_AUTO_TEST_CASE( FanoutFilterSkipsLongConnections )
+{
+    NETINFO_ITEM* net = new NETINFO_ITEM( m_board.get(), "N1", 1 );
+    m_board->Add( net );
+
+    // Far beyond the fanout escape-length threshold
+    CreateFootprintWithPad( VECTOR2I( 0, 0 ), net, "U1" );
+    CreateFootprintWithPad( VECTOR2I( pcbIUScale.mmToIU( 50 ), 0 ), net, "U2" );
+
+    BOOST_CHECK_EQUAL( RunBatchRouter( true ), 0 );
+    BOOST_CHECK_EQUAL( m_board->Tracks().size(), 0 );
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
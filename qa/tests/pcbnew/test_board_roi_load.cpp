@@ -0,0 +1,128 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright The KiCad Developers, see AUTHORS.txt for contributors.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, you may find one here:
+ * http://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+ * or you may search the http://www.gnu.org website for the version 2 license,
+ * or you may write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
+ */
+
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <string>
+
+#include <base_units.h>
+#include <board.h>
+#include <core/utf8.h>
+#include <ki_exception.h>
+#include <pcb_io/kicad_sexpr/pcb_io_kicad_sexpr.h>
+#include <pcb_track.h>
+#include <pcbnew_utils/board_file_utils.h>
+#include <qa_utils/wx_utils/unit_test_utils.h>
+
+namespace
+{
+
+/*
+ * A board with three tracks: one on F.Cu near the origin, one on F.Cu 100 mm away, and one
+ * on B.Cu near the origin.  The ROI tests below select subsets of these.
+ */
+std::unique_ptr<BOARD> createTestBoard()
+{
+    std::unique_ptr<BOARD> board = std::make_unique<BOARD>();
+
+    auto addTrack =
+            [&]( double aStartMm, double aEndMm, PCB_LAYER_ID aLayer )
+            {
+                PCB_TRACK* track = new PCB_TRACK( board.get() );
+                track->SetStart( VECTOR2I( pcbIUScale.mmToIU( aStartMm ),
+                                           pcbIUScale.mmToIU( aStartMm ) ) );
+                track->SetEnd( VECTOR2I( pcbIUScale.mmToIU( aEndMm ),
+                                         pcbIUScale.mmToIU( aEndMm ) ) );
+                track->SetWidth( pcbIUScale.mmToIU( 0.25 ) );
+                track->SetLayer( aLayer );
+                board->Add( track );
+            };
+
+    addTrack( 1.0, 2.0, F_Cu );
+    addTrack( 100.0, 101.0, F_Cu );
+    addTrack( 1.0, 2.0, B_Cu );
+
+    return board;
+}
+
+
+std::unique_ptr<BOARD> saveAndReload( const std::map<std::string, UTF8>& aProperties )
+{
+    std::unique_ptr<BOARD> board = createTestBoard();
+    auto path = std::filesystem::temp_directory_path() / "board_roi_load_tst.kicad_pcb";
+    ::KI_TEST::DumpBoardToFile( *board, path.string() );
+
+    PCB_IO_KICAD_SEXPR io;
+    return std::unique_ptr<BOARD>(
+            io.LoadBoard( wxString( path.string() ), nullptr, &aProperties ) );
+}
+
+} // namespace
+
+
+BOOST_AUTO_TEST_SUITE( BoardRoiLoad )
+
+
+BOOST_AUTO_TEST_CASE( NoFilterLoadsEverything )
+{
+    std::unique_ptr<BOARD> board = saveAndReload( {} );
+    BOOST_CHECK_EQUAL( board->Tracks().size(), 3 );
+}
+
+
+BOOST_AUTO_TEST_CASE( RegionFilter )
+{
+    // Both near-origin tracks intersect the window; the 100 mm track does not
+    std::unique_ptr<BOARD> board = saveAndReload( { { "region_of_interest", "0 0 10 10" } } );
+    BOOST_CHECK_EQUAL( board->Tracks().size(), 2 );
+}
+
+
+BOOST_AUTO_TEST_CASE( LayerFilter )
+{
+    std::unique_ptr<BOARD> board =
+            saveAndReload( { { "region_of_interest_layers", "B.Cu" } } );
+    BOOST_CHECK_EQUAL( board->Tracks().size(), 1 );
+    BOOST_CHECK_EQUAL( board->Tracks().front()->GetLayer(), B_Cu );
+}
+
+
+BOOST_AUTO_TEST_CASE( CombinedFilter )
+{
+    std::unique_ptr<BOARD> board =
+            saveAndReload( { { "region_of_interest", "0 0 10 10" },
+                             { "region_of_interest_layers", "F.Cu" } } );
+    BOOST_CHECK_EQUAL( board->Tracks().size(), 1 );
+    BOOST_CHECK_EQUAL( board->Tracks().front()->GetLayer(), F_Cu );
+}
+
+
+BOOST_AUTO_TEST_CASE( BadRegionSpecThrows )
+{
+    BOOST_CHECK_THROW( saveAndReload( { { "region_of_interest", "not a rectangle" } } ),
+                       IO_ERROR );
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,120 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright The KiCad Developers, see AUTHORS.TXT for contributors.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, you may find one here:
+ * http://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+ * or you may search the http://www.gnu.org website for the version 2 license,
+ * or you may write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
+ */
+
+/**
+ * @file
+ * Test suite for SPICE_SWEEP_RUNNER
+ */
+
+#include <qa_utils/wx_utils/unit_test_utils.h>
+
+#include <sim/spice_simulator.h>
+#include <sim/spice_sweep_runner.h>
+
+// A relative max error accepted when comparing 2 values
+#define MAX_REL_ERROR 1e-3
+
+
+class TEST_SPICE_SWEEP_RUNNER_FIXTURE
+{
+public:
+    TEST_SPICE_SWEEP_RUNNER_FIXTURE() :
+            m_simulator( SPICE_SIMULATOR::CreateInstance( "ngspice" ) )
+    {
+    }
+
+    std::shared_ptr<SPICE_SIMULATOR> m_simulator;
+};
+
+
+BOOST_FIXTURE_TEST_SUITE( SpiceSweepRunner, TEST_SPICE_SWEEP_RUNNER_FIXTURE )
+
+
+/**
+ * Sweep the bottom resistor of a divider and check the operating point at
+ * each step.
+ */
+BOOST_AUTO_TEST_CASE( VoltageDividerSweep )
+{
+    std::string netlist = "Voltage divider\n"
+                          "V1 in 0 1\n"
+                          "R1 in out 1k\n"
+                          "R2 out 0 1k\n"
+                          ".op\n"
+                          ".end\n";
+
+    BOOST_REQUIRE( m_simulator->LoadNetlist( netlist ) );
+
+    SPICE_SWEEP_RUNNER runner( m_simulator );
+
+    // R2 = 1k -> V(out) = 0.5; R2 = 3k -> V(out) = 0.75
+    runner.SetSteps( { { { { "R2", 1000.0 } } },
+                       { { { "R2", 3000.0 } } } } );
+    runner.SetCaptureVectors( { "out" } );
+
+    int progressCalls = 0;
+    runner.SetProgressCallback(
+            [&]( int aCompleted, int aTotal )
+            {
+                progressCalls++;
+                BOOST_CHECK_EQUAL( aTotal, 2 );
+            } );
+
+    BOOST_REQUIRE( runner.Start() );
+
+    // A second Start() while the sweep is in flight must be rejected
+    BOOST_CHECK( !runner.Start() );
+
+    std::vector<SPICE_SWEEP_RESULT> results = runner.WaitForResults();
+
+    BOOST_REQUIRE_EQUAL( results.size(), 2 );
+    BOOST_CHECK_EQUAL( progressCalls, 2 );
+
+    const double expected[] = { 0.5, 0.75 };
+
+    for( size_t ii = 0; ii < results.size(); ++ii )
+    {
+        BOOST_CHECK( results[ii].succeeded );
+
+        const std::vector<double>& vout = results[ii].vectors["out"];
+
+        BOOST_REQUIRE_EQUAL( vout.size(), 1 );
+        BOOST_CHECK_CLOSE( vout[0], expected[ii], MAX_REL_ERROR * 100 );
+    }
+}
+
+
+/**
+ * Starting with no steps must be a no-op.
+ */
+BOOST_AUTO_TEST_CASE( EmptySweepRejected )
+{
+    SPICE_SWEEP_RUNNER runner( m_simulator );
+
+    BOOST_CHECK( !runner.Start() );
+    BOOST_CHECK( !runner.IsRunning() );
+    BOOST_CHECK( runner.WaitForResults().empty() );
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,308 @@
+/*
+ * This program source code file is part of KiCad, a free EDA CAD application.
+ *
+ * Copyright The KiCad Developers, see AUTHORS.TXT for contributors.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, you may find one here:
+ * http://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+ * or you may search the http://www.gnu.org website for the version 2 license,
+ * or you may write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
+ */
+
+/**
+ * @file pcb_perf_tool.cpp
+ *
+ * Benchmark representative pcbnew workloads against a board file and emit
+ * machine-readable (JSON) timings, so that performance regressions between
+ * releases can be caught quantitatively (e.g. by CI tracking the numbers
+ * over time).
+ *
+ * Workloads:
+ *  - load:          full board parse via PCB_IO_KICAD_SEXPR
+ *  - connectivity:  connectivity rebuild from scratch
+ *  - zone_fill:     ZONE_FILLER::Fill() over all zones
+ *  - drc:           full DRC_ENGINE::RunTests()
+ *  - pns_sync:      PNS router world sync
+ */
+
+#include <qa_utils/utility_registry.h>
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <wx/cmdline.h>
+#include <wx/filename.h>
+#include <wx/msgout.h>
+
+#include <board.h>
+#include <board_commit.h>
+#include <board_design_settings.h>
+#include <core/profile.h>
+#include <drc/drc_engine.h>
+#include <drc/drc_item.h>
+#include <json_common.h>
+#include <pcb_io/kicad_sexpr/pcb_io_kicad_sexpr.h>
+#include <pcbnew_utils/board_test_utils.h>
+#include <router/pns_kicad_iface.h>
+#include <router/pns_router.h>
+#include <tool/tool_manager.h>
+#include <zone.h>
+#include <zone_filler.h>
+
+
+namespace
+{
+
+struct BENCH_RESULT
+{
+    std::string         Name;
+    std::vector<double> RunsUs;
+};
+
+
+/**
+ * Time aIterations executions of aWorkload with PROF_TIMER.
+ */
+BENCH_RESULT runBenchmark( const std::string& aName, int aIterations,
+                           const std::function<void()>& aWorkload )
+{
+    BENCH_RESULT result;
+    result.Name = aName;
+
+    for( int i = 0; i < aIterations; ++i )
+    {
+        PROF_TIMER timer;
+        aWorkload();
+        result.RunsUs.push_back(
+                (double) timer.SinceStart<std::chrono::microseconds>().count() );
+    }
+
+    return result;
+}
+
+
+std::unique_ptr<BOARD> loadBoard( const wxString& aPath )
+{
+    PCB_IO_KICAD_SEXPR io;
+
+    std::unique_ptr<BOARD> board( io.LoadBoard( aPath, nullptr ) );
+    board->BuildListOfNets();
+
+    return board;
+}
+
+} // namespace
+
+
+static const wxCmdLineEntryDesc g_cmdLineDesc[] = {
+    { wxCMD_LINE_SWITCH, "h", "help", _( "displays help on the command line parameters" ).mb_str(),
+            wxCMD_LINE_VAL_NONE, wxCMD_LINE_OPTION_HELP },
+    { wxCMD_LINE_OPTION, "i", "iterations", _( "number of timed runs per workload (default 3)" ).mb_str(),
+            wxCMD_LINE_VAL_NUMBER },
+    { wxCMD_LINE_OPTION, "b", "benchmark", _( "run only the named workload" ).mb_str(),
+            wxCMD_LINE_VAL_STRING },
+    { wxCMD_LINE_PARAM, nullptr, nullptr, _( "input board file" ).mb_str(), wxCMD_LINE_VAL_STRING },
+    { wxCMD_LINE_NONE }
+};
+
+
+enum PERF_RET_CODES
+{
+    LOAD_FAILED = KI_TEST::RET_CODES::TOOL_SPECIFIC,
+};
+
+
+int pcb_perf_main_func( int argc, char** argv )
+{
+    wxMessageOutput::Set( new wxMessageOutputStderr );
+    wxCmdLineParser cl_parser( argc, argv );
+    cl_parser.SetDesc( g_cmdLineDesc );
+    cl_parser.AddUsageText( _( "This program benchmarks representative pcbnew workloads (board "
+                               "load, connectivity rebuild, zone fill, DRC, PNS world sync) "
+                               "against the given board file and prints JSON timings on stdout." ) );
+
+    int cmd_parsed_ok = cl_parser.Parse();
+    if( cmd_parsed_ok != 0 )
+    {
+        // Help and invalid input both stop here
+        return ( cmd_parsed_ok == -1 ) ? KI_TEST::RET_CODES::OK : KI_TEST::RET_CODES::BAD_CMDLINE;
+    }
+
+    long iterations = 3;
+    cl_parser.Found( "iterations", &iterations );
+    iterations = std::max( 1L, iterations );
+
+    wxString only;
+    cl_parser.Found( "benchmark", &only );
+
+    const wxString boardPath = cl_parser.GetParam( 0 );
+
+    auto enabled =
+            [&]( const std::string& aName ) -> bool
+            {
+                return only.IsEmpty() || only == aName;
+            };
+
+    std::vector<BENCH_RESULT>  results;
+    std::unique_ptr<BOARD>     board;
+
+    try
+    {
+        if( enabled( "load" ) )
+        {
+            results.push_back( runBenchmark( "load", iterations,
+                    [&]()
+                    {
+                        board = loadBoard( boardPath );
+                    } ) );
+        }
+
+        if( !board )
+            board = loadBoard( boardPath );
+    }
+    catch( const IO_ERROR& ioe )
+    {
+        std::cerr << "Failed to load board: " << ioe.What() << std::endl;
+        return PERF_RET_CODES::LOAD_FAILED;
+    }
+
+    if( enabled( "connectivity" ) )
+    {
+        results.push_back( runBenchmark( "connectivity", iterations,
+                [&]()
+                {
+                    board->BuildConnectivity();
+                } ) );
+    }
+    else
+    {
+        // The zone fill and DRC workloads need valid connectivity regardless
+        board->BuildConnectivity();
+    }
+
+    // Both the zone filler and the DRC providers fetch their rules through the design
+    // settings' DRC engine, so set one up (untimed).  Use a sibling .kicad_dru if present.
+    BOARD_DESIGN_SETTINGS& bds = board->GetDesignSettings();
+    auto                   drcEngine = std::make_shared<DRC_ENGINE>( board.get(), &bds );
+
+    wxFileName rulesFile( boardPath );
+    rulesFile.SetExt( "kicad_dru" );
+
+    try
+    {
+        drcEngine->InitEngine( rulesFile.Exists() ? rulesFile : wxFileName() );
+    }
+    catch( const PARSE_ERROR& pe )
+    {
+        std::cerr << "Failed to parse DRC rules: " << pe.What() << std::endl;
+        return PERF_RET_CODES::LOAD_FAILED;
+    }
+
+    bds.m_DRCEngine = drcEngine;
+
+    if( enabled( "zone_fill" ) )
+    {
+        TOOL_MANAGER toolMgr;
+        toolMgr.SetEnvironment( board.get(), nullptr, nullptr, nullptr, nullptr );
+
+        KI_TEST::DUMMY_TOOL* dummyTool = new KI_TEST::DUMMY_TOOL();
+        toolMgr.RegisterTool( dummyTool );
+
+        results.push_back( runBenchmark( "zone_fill", iterations,
+                [&]()
+                {
+                    BOARD_COMMIT       commit( dummyTool );
+                    ZONE_FILLER        filler( board.get(), &commit );
+                    std::vector<ZONE*> toFill;
+
+                    for( ZONE* zone : board->Zones() )
+                        toFill.push_back( zone );
+
+                    if( filler.Fill( toFill, false, nullptr ) )
+                    {
+                        commit.Push( _( "Fill Zone(s)" ),
+                                     SKIP_UNDO | SKIP_SET_DIRTY | ZONE_FILL_OP | SKIP_CONNECTIVITY );
+                    }
+                } ) );
+    }
+
+    if( enabled( "drc" ) )
+    {
+        size_t violations = 0;
+
+        drcEngine->SetViolationHandler(
+                [&]( const std::shared_ptr<DRC_ITEM>& aItem, const VECTOR2I& aPos, int aLayer,
+                     const std::function<void( PCB_MARKER* )>& aPathGenerator )
+                {
+                    violations++;
+                } );
+
+        results.push_back( runBenchmark( "drc", iterations,
+                [&]()
+                {
+                    drcEngine->RunTests( EDA_UNITS::MM, true, false );
+                } ) );
+
+        drcEngine->ClearViolationHandler();
+    }
+
+    if( enabled( "pns_sync" ) )
+    {
+        PNS_KICAD_IFACE_BASE iface;
+        PNS::ROUTER          router;
+
+        iface.SetBoard( board.get() );
+        router.SetInterface( &iface );
+
+        results.push_back( runBenchmark( "pns_sync", iterations,
+                [&]()
+                {
+                    router.SyncWorld();
+                } ) );
+    }
+
+    nlohmann::ordered_json report;
+
+    report["board"] = boardPath.ToStdString();
+    report["iterations"] = iterations;
+    report["benchmarks"] = nlohmann::ordered_json::array();
+
+    for( const BENCH_RESULT& result : results )
+    {
+        nlohmann::ordered_json entry;
+
+        entry["name"] = result.Name;
+        entry["runs_us"] = result.RunsUs;
+        entry["best_us"] = *std::min_element( result.RunsUs.begin(), result.RunsUs.end() );
+        entry["mean_us"] = std::accumulate( result.RunsUs.begin(), result.RunsUs.end(), 0.0 )
+                           / result.RunsUs.size();
+
+        report["benchmarks"].push_back( entry );
+    }
+
+    std::cout << report.dump( 2 ) << std::endl;
+
+    return KI_TEST::RET_CODES::OK;
+}
+
+
+static bool registered = UTILITY_REGISTRY::Register( { "perf",
+                                                       "Benchmark pcbnew workloads on a board file",
+                                                       pcb_perf_main_func } );
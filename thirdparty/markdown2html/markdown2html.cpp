@@ -18,6 +18,8 @@
  */
 
 #include <macros.h>
+#include <map>
+#include <mutex>
 #include <string>
 #include <string_utils.h>
 
@@ -50,3 +52,27 @@ void ConvertMarkdown2Html( const wxString& aMarkdownInput, wxString& aHtmlOutput
     bufrelease( ob );
 
 }
+
+
+void ConvertMarkdown2HtmlCached( const wxString& aMarkdownInput, wxString& aHtmlOutput )
+{
+    static std::map<wxString, wxString> cache;
+    static std::mutex                   cacheMutex;
+
+    std::lock_guard<std::mutex> lock( cacheMutex );
+
+    auto it = cache.find( aMarkdownInput );
+
+    if( it == cache.end() )
+    {
+        /* keep the cache from growing without bound on long sessions */
+        if( cache.size() >= 256 )
+            cache.clear();
+
+        wxString html;
+        ConvertMarkdown2Html( aMarkdownInput, html );
+        it = cache.emplace( aMarkdownInput, html ).first;
+    }
+
+    aHtmlOutput = it->second;
+}
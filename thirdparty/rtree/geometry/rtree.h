@@ -206,6 +206,41 @@ public:
         return cnt;
     }
 
+    /// Find all within search rectangle, handing each entry's stored rect to the collector
+    /// along with its data.  Unlike Search() the collector cannot stop the search; this is
+    /// meant for bulk collection into caller-owned buffers.
+    /// \param a_min Min of search bounding rect
+    /// \param a_max Max of search bounding rect
+    /// \param a_collector Called as a_collector( a_minEntry, a_maxEntry, a_dataId ) per entry
+    /// \return Returns the number of entries found
+    template <class COLLECTOR>
+    int SearchEntries( const ELEMTYPE a_min[NUMDIMS], const ELEMTYPE a_max[NUMDIMS],
+                       COLLECTOR& a_collector ) const
+    {
+  #ifdef _DEBUG
+
+        for( int index = 0; index < NUMDIMS; ++index )
+        {
+            ASSERT( a_min[index] <= a_max[index] );
+        }
+
+  #endif    // _DEBUG
+
+        Rect rect;
+
+        for( int axis = 0; axis < NUMDIMS; ++axis )
+        {
+            rect.m_min[axis] = a_min[axis];
+            rect.m_max[axis] = a_max[axis];
+        }
+
+        int cnt = 0;
+
+        SearchEntries( m_root, &rect, a_collector, cnt );
+
+        return cnt;
+    }
+
     /// Calculate Statistics
 
     Statistics CalcStats();
@@ -604,6 +639,40 @@ protected:
         return true; // Continue searching
     }
 
+    template <class COLLECTOR>
+    void SearchEntries( const Node* a_node, const Rect* a_rect, COLLECTOR& a_collector,
+                        int& a_foundCount ) const
+    {
+        ASSERT( a_node );
+        ASSERT( a_node->m_level >= 0 );
+        ASSERT( a_rect );
+
+        if( a_node->IsInternalNode() ) // This is an internal node in the tree
+        {
+            for( int index = 0; index < a_node->m_count; ++index )
+            {
+                if( Overlap( a_rect, &a_node->m_branch[index].m_rect ) )
+                {
+                    SearchEntries( a_node->m_branch[index].m_child, a_rect, a_collector,
+                                   a_foundCount );
+                }
+            }
+        }
+        else // This is a leaf node
+        {
+            for( int index = 0; index < a_node->m_count; ++index )
+            {
+                if( Overlap( a_rect, &a_node->m_branch[index].m_rect ) )
+                {
+                    const Branch& branch = a_node->m_branch[index];
+
+                    a_collector( branch.m_rect.m_min, branch.m_rect.m_max, branch.m_data );
+                    a_foundCount++;
+                }
+            }
+        }
+    }
+
     void    RemoveAllRec( Node* a_node ) const;
     void    Reset() const;
     void    CountRec( const Node* a_node, int& a_count ) const;